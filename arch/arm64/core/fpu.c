@@ -318,15 +318,16 @@ static void fpu_access_update(unsigned int exc_update_level)
 	__ASSERT(read_daif() & DAIF_IRQ_BIT, "must be called with IRQs disabled");
 
 	uint64_t cpacr = read_cpacr_el1();
+	uint64_t new_cpacr;
 
 	if (arch_exception_depth() == exc_update_level) {
 		/* We're about to execute non-exception code */
 		if (atomic_ptr_get(&_current_cpu->arch.fpu_owner) == _current) {
 			/* turn on FPU access */
-			write_cpacr_el1(cpacr | CPACR_EL1_FPEN_NOTRAP);
+			new_cpacr = cpacr | CPACR_EL1_FPEN_NOTRAP;
 		} else {
 			/* deny FPU access */
-			write_cpacr_el1(cpacr & ~CPACR_EL1_FPEN_NOTRAP);
+			new_cpacr = cpacr & ~CPACR_EL1_FPEN_NOTRAP;
 		}
 	} else {
 		/*
@@ -334,9 +335,18 @@ static void fpu_access_update(unsigned int exc_update_level)
 		 * access as we want to make sure IRQs are disabled before
 		 * granting it access (see z_arm64_fpu_trap() documentation).
 		 */
-		write_cpacr_el1(cpacr & ~CPACR_EL1_FPEN_NOTRAP);
+		new_cpacr = cpacr & ~CPACR_EL1_FPEN_NOTRAP;
+	}
+
+	/*
+	 * Most switches and exception exits don't change FPU access,
+	 * e.g. between threads that don't use the FPU. Spare the
+	 * synchronization barrier then.
+	 */
+	if (new_cpacr != cpacr) {
+		write_cpacr_el1(new_cpacr);
+		barrier_isync_fence_full();
 	}
-	barrier_isync_fence_full();
 }
 
 /*
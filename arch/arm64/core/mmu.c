@@ -1168,6 +1168,148 @@ static uint16_t get_asid(uint64_t ttbr0)
 	return ttbr0 >> TTBR_ASID_SHIFT;
 }
 
+/* Above this many pages, invalidating everything is cheaper */
+#define TLB_RANGE_MAX_PAGES 32
+
+static inline void invalidate_tlb_asid(uint16_t asid)
+{
+#ifdef CONFIG_SMP
+	__asm__ volatile (
+	"dsb ishst; tlbi aside1is, %0; dsb ish; isb"
+	: : "r" ((uint64_t)asid << TTBR_ASID_SHIFT) : "memory");
+#else
+	__asm__ volatile (
+	"dsb ishst; tlbi aside1, %0; dsb ish; isb"
+	: : "r" ((uint64_t)asid << TTBR_ASID_SHIFT) : "memory");
+#endif
+}
+
+/* Invalidate a range for all ASIDs, including global entries */
+static void invalidate_tlb_range(uintptr_t virt, size_t size)
+{
+	uintptr_t end = virt + size;
+
+	if ((size / CONFIG_MMU_PAGE_SIZE) > TLB_RANGE_MAX_PAGES) {
+		invalidate_tlb_all();
+		return;
+	}
+
+	__asm__ volatile ("dsb ishst" : : : "memory");
+	for (; virt < end; virt += CONFIG_MMU_PAGE_SIZE) {
+#ifdef CONFIG_SMP
+		__asm__ volatile ("tlbi vaae1is, %0"
+				  : : "r" (virt >> PAGE_SIZE_SHIFT) : "memory");
+#else
+		__asm__ volatile ("tlbi vaae1, %0"
+				  : : "r" (virt >> PAGE_SIZE_SHIFT) : "memory");
+#endif
+	}
+	__asm__ volatile ("dsb ish; isb" : : : "memory");
+}
+
+/*
+ * TLB maintenance for memory domain updates.
+ *
+ * Private mappings are marked non-global and tagged with the domain ASID,
+ * so dropping them only needs to invalidate that ASID. Making a range
+ * private replaces global kernel entries, so that range is invalidated
+ * for all ASIDs.
+ *
+ * Between arch_mem_domain_batch_begin() and arch_mem_domain_batch_end(),
+ * the invalidations and IPIs requested on a CPU are recorded instead and
+ * issued once at the end. Batches run with z_mem_domain_lock held so they
+ * stay on one CPU, other CPUs keep invalidating right away.
+ */
+enum tlb_flush {
+	TLB_FLUSH_NONE,
+	TLB_FLUSH_ASID,
+	TLB_FLUSH_ALL,
+};
+
+static struct tlb_batch {
+	uint8_t depth;
+	uint8_t flush;
+	uint16_t asid;
+	bool ipi;
+} tlb_batches[CONFIG_MP_MAX_NUM_CPUS];
+
+void arch_mem_domain_batch_begin(void)
+{
+	tlb_batches[arch_curr_cpu()->id].depth++;
+}
+
+void arch_mem_domain_batch_end(void)
+{
+	struct tlb_batch *batch = &tlb_batches[arch_curr_cpu()->id];
+
+	__ASSERT(batch->depth > 0, "unbalanced memory domain batch");
+	if (--batch->depth > 0) {
+		return;
+	}
+
+	if (batch->flush == TLB_FLUSH_ALL) {
+		invalidate_tlb_all();
+	} else if (batch->flush == TLB_FLUSH_ASID) {
+		invalidate_tlb_asid(batch->asid);
+	}
+
+#ifdef CONFIG_SMP
+	if (batch->ipi) {
+		z_arm64_mem_cfg_ipi();
+	}
+#endif
+
+	batch->flush = TLB_FLUSH_NONE;
+	batch->ipi = false;
+}
+
+static void domain_tlb_invalidate_range(uintptr_t virt, size_t size)
+{
+	unsigned int key = arch_irq_lock();
+	struct tlb_batch *batch = &tlb_batches[arch_curr_cpu()->id];
+
+	if (batch->depth > 0) {
+		batch->flush = TLB_FLUSH_ALL;
+	} else {
+		invalidate_tlb_range(virt, size);
+	}
+
+	arch_irq_unlock(key);
+}
+
+static void domain_tlb_invalidate_asid(uint16_t asid)
+{
+	unsigned int key = arch_irq_lock();
+	struct tlb_batch *batch = &tlb_batches[arch_curr_cpu()->id];
+
+	if (batch->depth == 0) {
+		invalidate_tlb_asid(asid);
+	} else if (batch->flush == TLB_FLUSH_NONE) {
+		batch->flush = TLB_FLUSH_ASID;
+		batch->asid = asid;
+	} else if (batch->asid != asid) {
+		batch->flush = TLB_FLUSH_ALL;
+	}
+
+	arch_irq_unlock(key);
+}
+
+#ifdef CONFIG_SMP
+static void domain_mem_cfg_ipi(void)
+{
+	unsigned int key = arch_irq_lock();
+	struct tlb_batch *batch = &tlb_batches[arch_curr_cpu()->id];
+
+	if (batch->depth > 0) {
+		batch->ipi = true;
+	} else {
+		z_arm64_mem_cfg_ipi();
+	}
+
+	arch_irq_unlock(key);
+}
+#endif
+
 static void z_arm64_swap_ptables(struct k_thread *incoming);
 
 int arch_mem_domain_max_partitions_get(void)
@@ -1218,7 +1360,7 @@ static int private_map(struct arm_mmu_ptables *ptables, const char *name,
 	__ASSERT(ret == 0, "privatize_page_range() returned %d", ret);
 	ret = add_map(ptables, name, phys, virt, size, attrs | MT_NG);
 	__ASSERT(ret == 0, "add_map() returned %d", ret);
-	invalidate_tlb_all();
+	domain_tlb_invalidate_range(virt, size);
 
 	return ret;
 }
@@ -1230,7 +1372,7 @@ static int reset_map(struct arm_mmu_ptables *ptables, const char *name,
 
 	ret = globalize_page_range(ptables, &kernel_ptables, addr, size, name);
 	__ASSERT(ret == 0, "globalize_page_range() returned %d", ret);
-	invalidate_tlb_all();
+	domain_tlb_invalidate_asid(get_asid(ptables->ttbr0));
 
 	return ret;
 }
@@ -1284,10 +1426,12 @@ int arch_mem_domain_thread_add(struct k_thread *thread)
 	thread->arch.ptables = domain_ptables;
 	if (thread == _current) {
 		z_arm64_swap_ptables(thread);
-	} else {
+	} else if (old_ptables != NULL) {
 #ifdef CONFIG_SMP
-		/* the thread could be running on another CPU right now */
-		z_arm64_mem_cfg_ipi();
+		/* the thread could be running on another CPU right now,
+		 * which cannot be the case if it never had page tables
+		 */
+		domain_mem_cfg_ipi();
 #endif
 	}
 
@@ -16,6 +16,13 @@ extern void z_riscv_fpu_restore(struct z_riscv_fp_context *saved_fp_context);
 
 #define FPU_DEBUG 0
 
+/*
+ * Number of consecutive runs a thread must have modified the FPU in
+ * before its context is restored on switch-in rather than on first use.
+ */
+#define FPU_USE_COUNT_RECLAIM 2
+#define FPU_USE_COUNT_MAX     3
+
 #if FPU_DEBUG
 
 /*
@@ -117,8 +124,12 @@ void arch_flush_local_fpu(void)
 			z_riscv_fpu_save(&owner->arch.saved_fp_context);
 		}
 
-		/* dirty means active use */
-		owner->arch.fpu_recently_used = dirty;
+		/* dirty means active use, anything else breaks the streak */
+		if (!dirty) {
+			owner->arch.fpu_use_count = 0;
+		} else if (owner->arch.fpu_use_count < FPU_USE_COUNT_MAX) {
+			owner->arch.fpu_use_count++;
+		}
 
 		/* disable FPU access */
 		csr_clear(mstatus, MSTATUS_FS);
@@ -262,13 +273,15 @@ static bool fpu_access_allowed(unsigned int exc_update_level)
 			/* everything is already in place */
 			return true;
 		}
-		if (_current->arch.fpu_recently_used) {
+		if (_current->arch.fpu_use_count >= FPU_USE_COUNT_RECLAIM) {
 			/*
 			 * Before this thread was context-switched out,
-			 * it made active use of the FPU, but someone else
-			 * took it away in the mean time. Let's preemptively
-			 * claim it back to avoid the likely exception trap
-			 * to come otherwise.
+			 * it made active use of the FPU repeatedly, but
+			 * someone else took it away in the mean time. Let's
+			 * preemptively claim it back to avoid the likely
+			 * exception trap to come otherwise. Threads using
+			 * the FPU only occasionally are left to trap, so
+			 * they don't pay for a restore on every switch.
 			 */
 			z_riscv_fpu_disable();
 			arch_flush_local_fpu();
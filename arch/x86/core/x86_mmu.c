@@ -1742,6 +1742,52 @@ static int copy_page_table(pentry_t *dst, pentry_t *src, int level)
 	return 0;
 }
 
+#ifdef CONFIG_SMP
+/* TLB shootdowns for memory domain updates. Between
+ * arch_mem_domain_batch_begin() and arch_mem_domain_batch_end(), the
+ * shootdowns requested on a CPU are coalesced into a single IPI sent at the
+ * end. Batches run with z_mem_domain_lock held so they stay on one CPU,
+ * other CPUs keep sending their IPIs right away.
+ */
+static struct {
+	uint8_t depth;
+	bool pending;
+} tlb_batches[CONFIG_MP_MAX_NUM_CPUS];
+
+__pinned_func
+void arch_mem_domain_batch_begin(void)
+{
+	tlb_batches[arch_curr_cpu()->id].depth++;
+}
+
+__pinned_func
+void arch_mem_domain_batch_end(void)
+{
+	unsigned int id = arch_curr_cpu()->id;
+
+	__ASSERT(tlb_batches[id].depth > 0, "unbalanced memory domain batch");
+	if (--tlb_batches[id].depth == 0 && tlb_batches[id].pending) {
+		tlb_batches[id].pending = false;
+		tlb_shootdown();
+	}
+}
+
+__pinned_func
+static void domain_tlb_shootdown(void)
+{
+	unsigned int key = arch_irq_lock();
+	unsigned int id = arch_curr_cpu()->id;
+
+	if (tlb_batches[id].depth > 0) {
+		tlb_batches[id].pending = true;
+	} else {
+		tlb_shootdown();
+	}
+
+	arch_irq_unlock(key);
+}
+#endif /* CONFIG_SMP */
+
 __pinned_func
 static int region_map_update(pentry_t *ptables, void *start,
 			      size_t size, pentry_t flags, bool reset)
@@ -1763,7 +1809,7 @@ static int region_map_update(pentry_t *ptables, void *start,
 	k_spin_unlock(&x86_mmu_lock, key);
 
 #ifdef CONFIG_SMP
-	tlb_shootdown();
+	domain_tlb_shootdown();
 #endif
 
 	return ret;
@@ -140,6 +140,14 @@ if(CONFIG_SETTINGS)
   zephyr_iterable_section(NAME settings_handler_static KVMA RAM_REGION GROUP RODATA_REGION)
 endif()
 
+if(CONFIG_RETENTION_WARM_BOOT)
+  zephyr_iterable_section(NAME warmboot_handler KVMA RAM_REGION GROUP RODATA_REGION)
+endif()
+
+if(CONFIG_SETTINGS_ZMS_FIXED_IDS)
+  zephyr_iterable_section(NAME settings_zms_fixed_id KVMA RAM_REGION GROUP RODATA_REGION)
+endif()
+
 if(CONFIG_SENSING)
   zephyr_iterable_section(NAME sensing_sensor_info KVMA RAM_REGION GROUP RODATA_REGION)
 endif()
@@ -242,6 +250,7 @@ endif()
 
 if(CONFIG_INPUT)
   zephyr_iterable_section(NAME input_callback KVMA RAM_REGION GROUP RODATA_REGION)
+  zephyr_iterable_section(NAME input_frame_callback KVMA RAM_REGION GROUP RODATA_REGION)
 endif()
 
 if(CONFIG_USBD_MSC_CLASS)
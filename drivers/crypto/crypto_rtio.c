@@ -0,0 +1,134 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/crypto/rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(crypto_rtio, CONFIG_CRYPTO_LOG_LEVEL);
+
+static int cipher_exec(struct crypto_rtio_req *req)
+{
+	struct cipher_ctx *ctx = req->cipher.ctx;
+
+	switch (ctx->ops.cipher_mode) {
+	case CRYPTO_CIPHER_MODE_ECB:
+		return cipher_block_op(ctx, req->cipher.pkt);
+	case CRYPTO_CIPHER_MODE_CBC:
+		return cipher_cbc_op(ctx, req->cipher.pkt, req->cipher.iv);
+	case CRYPTO_CIPHER_MODE_CTR:
+		return cipher_ctr_op(ctx, req->cipher.pkt, req->cipher.iv);
+	default:
+		return -EINVAL;
+	}
+}
+
+static int aead_exec(struct crypto_rtio_req *req)
+{
+	struct cipher_ctx *ctx = req->aead.ctx;
+
+	switch (ctx->ops.cipher_mode) {
+	case CRYPTO_CIPHER_MODE_CCM:
+		return cipher_ccm_op(ctx, req->aead.pkt, req->aead.nonce);
+	case CRYPTO_CIPHER_MODE_GCM:
+		return cipher_gcm_op(ctx, req->aead.pkt, req->aead.nonce);
+	default:
+		return -EINVAL;
+	}
+}
+
+int crypto_rtio_req_exec(struct crypto_rtio_req *req)
+{
+	switch (req->op) {
+	case CRYPTO_RTIO_OP_CIPHER:
+		return cipher_exec(req);
+	case CRYPTO_RTIO_OP_AEAD:
+		return aead_exec(req);
+	case CRYPTO_RTIO_OP_HASH_UPDATE:
+		return hash_update(req->hash.ctx, req->hash.pkt);
+	case CRYPTO_RTIO_OP_HASH_COMPUTE:
+		return hash_compute(req->hash.ctx, req->hash.pkt);
+	default:
+		return -EINVAL;
+	}
+}
+
+static const struct device *req_device(struct crypto_rtio_req *req)
+{
+	switch (req->op) {
+	case CRYPTO_RTIO_OP_CIPHER:
+		return req->cipher.ctx->device;
+	case CRYPTO_RTIO_OP_AEAD:
+		return req->aead.ctx->device;
+	case CRYPTO_RTIO_OP_HASH_UPDATE:
+	case CRYPTO_RTIO_OP_HASH_COMPUTE:
+		return req->hash.ctx->device;
+	default:
+		return NULL;
+	}
+}
+
+static void crypto_iodev_work_handler(struct rtio_iodev_sqe *txn_first)
+{
+	struct rtio_iodev_sqe *txn_curr = txn_first;
+	int rc = 0;
+
+	/* the transaction fails as a whole on the first failing request */
+	do {
+		if (txn_curr->sqe.op != RTIO_OP_TX ||
+		    txn_curr->sqe.tx.buf_len != sizeof(struct crypto_rtio_req)) {
+			LOG_ERR("Invalid submission %p", (void *)&txn_curr->sqe);
+			rc = -EINVAL;
+			break;
+		}
+
+		rc = crypto_rtio_req_exec(crypto_rtio_req_get(txn_curr));
+		txn_curr = rtio_txn_next(txn_curr);
+	} while (rc == 0 && txn_curr != NULL);
+
+	if (rc != 0) {
+		rtio_iodev_sqe_err(txn_first, rc);
+	} else {
+		rtio_iodev_sqe_ok(txn_first, 0);
+	}
+}
+
+static void crypto_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct crypto_driver_api *api;
+	const struct device *dev = NULL;
+	struct rtio_work_req *req;
+
+	if (iodev_sqe->sqe.op == RTIO_OP_TX &&
+	    iodev_sqe->sqe.tx.buf_len == sizeof(struct crypto_rtio_req)) {
+		dev = req_device(crypto_rtio_req_get(iodev_sqe));
+	}
+
+	if (dev == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	api = dev->api;
+	if (api->submit != NULL) {
+		api->submit(dev, iodev_sqe);
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, crypto_iodev_work_handler);
+}
+
+const struct rtio_iodev_api crypto_iodev_api = {
+	.submit = crypto_iodev_submit,
+};
@@ -34,6 +34,16 @@ struct dma_emul_xfer_desc {
 	struct dma_config config;
 };
 
+#ifdef CONFIG_DMA_PREPARED
+struct dma_emul_prepared {
+	struct dma_prepared prepared;
+	struct dma_config config;
+	/* points to num_requests blocks of the prepared block pool */
+	struct dma_block_config *block;
+	bool used;
+};
+#endif
+
 struct dma_emul_work {
 	const struct device *dev;
 	uint32_t channel;
@@ -56,6 +66,12 @@ struct dma_emul_config {
 	struct dma_emul_xfer_desc *xfer;
 	/* points to an array of size num_channels * num_requests */
 	struct dma_block_config *block;
+#ifdef CONFIG_DMA_PREPARED
+	/* points to an array of size CONFIG_DMA_EMUL_PREPARED_POOL_SIZE */
+	struct dma_emul_prepared *prepared;
+	/* points to an array of size CONFIG_DMA_EMUL_PREPARED_POOL_SIZE * num_requests */
+	struct dma_block_config *prepared_block;
+#endif
 };
 
 struct dma_emul_data {
@@ -508,6 +524,113 @@ static bool dma_emul_chan_filter(const struct device *dev, int channel, void *fi
 	return success;
 }
 
+#ifdef CONFIG_DMA_PREPARED
+static int dma_emul_prepare(const struct device *dev, uint32_t channel,
+			    struct dma_config *xfer_config, struct dma_prepared **prepared)
+{
+	size_t i;
+	k_spinlock_key_t key;
+	struct dma_block_config *block_it;
+	struct dma_emul_prepared *xfer = NULL;
+	struct dma_emul_data *data = dev->data;
+	const struct dma_emul_config *config = dev->config;
+
+	if (!dma_emul_config_valid(dev, channel, xfer_config)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	for (i = 0; i < CONFIG_DMA_EMUL_PREPARED_POOL_SIZE; ++i) {
+		if (!config->prepared[i].used) {
+			xfer = &config->prepared[i];
+			xfer->used = true;
+			break;
+		}
+	}
+	k_spin_unlock(&data->lock, key);
+
+	if (xfer == NULL) {
+		LOG_ERR("no prepared transfer left");
+		return -ENOMEM;
+	}
+
+	xfer->prepared.channel = channel;
+	memcpy(&xfer->config, xfer_config, sizeof(xfer->config));
+
+	/* the blocks are stored as the slots they are copied to on start */
+	for (i = 0, block_it = xfer_config->head_block; i < xfer_config->block_count;
+	     ++i, block_it = block_it->next_block) {
+		memcpy(&xfer->block[i], block_it, sizeof(xfer->block[i]));
+		xfer->block[i].next_block =
+			(i + 1 < xfer_config->block_count) ? &xfer->block[i + 1] : NULL;
+	}
+	xfer->config.head_block = xfer->block;
+
+	*prepared = &xfer->prepared;
+
+	return 0;
+}
+
+static int dma_emul_prepared_start(const struct device *dev, struct dma_prepared *prepared)
+{
+	k_spinlock_key_t key;
+	uint32_t channel = prepared->channel;
+	struct dma_emul_data *data = dev->data;
+	const struct dma_emul_config *config = dev->config;
+	struct dma_emul_prepared *xfer = CONTAINER_OF(prepared, struct dma_emul_prepared, prepared);
+
+	key = k_spin_lock(&data->lock);
+	if (dma_emul_get_channel_state(dev, channel) == DMA_EMUL_CHANNEL_STARTED) {
+		k_spin_unlock(&data->lock, key);
+		return -EBUSY;
+	}
+
+	memcpy(&config->xfer[channel].config, &xfer->config, sizeof(xfer->config));
+	memcpy(&config->block[channel * config->num_requests + xfer->config.dma_slot], xfer->block,
+	       xfer->config.block_count * sizeof(*xfer->block));
+	dma_emul_set_channel_state(dev, channel, DMA_EMUL_CHANNEL_LOADED);
+	k_spin_unlock(&data->lock, key);
+
+	return dma_emul_start(dev, channel);
+}
+
+static int dma_emul_prepared_update(const struct device *dev, struct dma_prepared *prepared,
+				    uint32_t block, dma_addr_t src, dma_addr_t dst, size_t size)
+{
+	int ret = 0;
+	k_spinlock_key_t key;
+	struct dma_emul_data *data = dev->data;
+	struct dma_emul_prepared *xfer = CONTAINER_OF(prepared, struct dma_emul_prepared, prepared);
+
+	if (block >= xfer->config.block_count) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (dma_emul_get_channel_state(dev, prepared->channel) == DMA_EMUL_CHANNEL_STARTED) {
+		ret = -EBUSY;
+	} else {
+		xfer->block[block].source_address = src;
+		xfer->block[block].dest_address = dst;
+		xfer->block[block].block_size = size;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static void dma_emul_prepared_release(const struct device *dev, struct dma_prepared *prepared)
+{
+	k_spinlock_key_t key;
+	struct dma_emul_data *data = dev->data;
+	struct dma_emul_prepared *xfer = CONTAINER_OF(prepared, struct dma_emul_prepared, prepared);
+
+	key = k_spin_lock(&data->lock);
+	xfer->used = false;
+	k_spin_unlock(&data->lock, key);
+}
+#endif /* CONFIG_DMA_PREPARED */
+
 static DEVICE_API(dma, dma_emul_driver_api) = {
 	.config = dma_emul_configure,
 	.reload = dma_emul_reload,
@@ -518,6 +641,12 @@ static DEVICE_API(dma, dma_emul_driver_api) = {
 	.get_status = dma_emul_get_status,
 	.get_attribute = dma_emul_get_attribute,
 	.chan_filter = dma_emul_chan_filter,
+#ifdef CONFIG_DMA_PREPARED
+	.prepare = dma_emul_prepare,
+	.prepared_start = dma_emul_prepared_start,
+	.prepared_update = dma_emul_prepared_update,
+	.prepared_release = dma_emul_prepared_release,
+#endif
 };
 
 #ifdef CONFIG_PM_DEVICE
@@ -540,6 +669,12 @@ static int dma_emul_init(const struct device *dev)
 	data->dma_ctx.dma_channels = config->num_channels;
 	data->dma_ctx.atomic = data->channels_atomic;
 
+#ifdef CONFIG_DMA_PREPARED
+	for (size_t i = 0; i < CONFIG_DMA_EMUL_PREPARED_POOL_SIZE; ++i) {
+		config->prepared[i].block = &config->prepared_block[i * config->num_requests];
+	}
+#endif
+
 	k_work_queue_init(&data->work_q);
 	k_work_init(&data->work.work, dma_emul_work_handler);
 	k_work_queue_start(&data->work_q, config->work_q_stack, config->work_q_stack_size,
@@ -566,6 +701,21 @@ static int dma_emul_init(const struct device *dev)
 
 #define DMA_EMUL_INST_NUM_REQUESTS(_inst) DT_INST_PROP_OR(_inst, dma_requests, 1)
 
+#ifdef CONFIG_DMA_PREPARED
+#define DMA_EMUL_PREPARED_DEFINE(_inst)                                                            \
+	static struct dma_emul_prepared                                                            \
+		dma_emul_prepared_##_inst[CONFIG_DMA_EMUL_PREPARED_POOL_SIZE];                     \
+	static struct dma_block_config                                                             \
+		dma_emul_prepared_block_##_inst[CONFIG_DMA_EMUL_PREPARED_POOL_SIZE *               \
+						DMA_EMUL_INST_NUM_REQUESTS(_inst)];
+
+#define DMA_EMUL_PREPARED_INIT(_inst)                                                              \
+	.prepared = dma_emul_prepared_##_inst, .prepared_block = dma_emul_prepared_block_##_inst,
+#else
+#define DMA_EMUL_PREPARED_DEFINE(_inst)
+#define DMA_EMUL_PREPARED_INIT(_inst)
+#endif
+
 #define DEFINE_DMA_EMUL(_inst)                                                                     \
 	BUILD_ASSERT(DMA_EMUL_INST_HAS_PROP(_inst, dma_channel_mask) ||                            \
 			     DMA_EMUL_INST_HAS_PROP(_inst, dma_channels),                          \
@@ -582,6 +732,8 @@ static int dma_emul_init(const struct device *dev)
 		dma_emul_block_config_##_inst[DMA_EMUL_INST_NUM_CHANNELS(_inst) *                  \
 					      DMA_EMUL_INST_NUM_REQUESTS(_inst)];                  \
                                                                                                    \
+	DMA_EMUL_PREPARED_DEFINE(_inst)                                                            \
+                                                                                                   \
 	static const struct dma_emul_config dma_emul_config_##_inst = {                            \
 		.channel_mask = DMA_EMUL_INST_CHANNEL_MASK(_inst),                                 \
 		.num_channels = DMA_EMUL_INST_NUM_CHANNELS(_inst),                                 \
@@ -594,6 +746,7 @@ static int dma_emul_init(const struct device *dev)
 		.work_q_priority = DT_INST_PROP_OR(_inst, priority, 0),                            \
 		.xfer = dma_emul_xfer_desc_##_inst,                                                \
 		.block = dma_emul_block_config_##_inst,                                            \
+		DMA_EMUL_PREPARED_INIT(_inst)                                                      \
 	};                                                                                         \
                                                                                                    \
 	static ATOMIC_DEFINE(dma_emul_channels_atomic_##_inst,                                     \
@@ -63,6 +63,7 @@ struct eth_context {
 	struct z_thread_stack_element *rx_stack;
 	size_t rx_stack_size;
 	int dev_fd;
+	int rx_batch;
 	bool init_done;
 	bool status;
 	bool promisc_mode;
@@ -243,7 +244,7 @@ static int read_data(struct eth_context *ctx, int fd)
 
 	count = nsi_host_read(fd, ctx->recv, sizeof(ctx->recv));
 	if (count <= 0) {
-		return 0;
+		return -EAGAIN;
 	}
 
 	pkt = prepare_pkt(ctx, count, &status);
@@ -271,7 +272,13 @@ static void eth_rx(void *p1, void *p2, void *p3)
 	while (1) {
 		if (net_if_is_up(ctx->iface)) {
 			while (!eth_wait_data(ctx->dev_fd)) {
-				read_data(ctx, ctx->dev_fd);
+				/* Past the first frame, the read itself tells if there is more */
+				for (int i = 0; i < ctx->rx_batch; i++) {
+					if (read_data(ctx, ctx->dev_fd) == -EAGAIN) {
+						break;
+					}
+				}
+
 				k_yield();
 			}
 		}
@@ -405,6 +412,15 @@ static void eth_iface_init(struct net_if *iface)
 		LOG_ERR("Cannot create %s (%d/%s)", ctx->if_name, ctx->dev_fd,
 			strerror(-ctx->dev_fd));
 	} else {
+		ctx->rx_batch = CONFIG_ETH_NATIVE_TAP_RX_BATCH;
+
+		if ((ctx->rx_batch > 1) && (eth_iface_nonblock(ctx->dev_fd) < 0)) {
+			/* Reading past the last frame would block the whole process */
+			LOG_ERR("Cannot make %s non-blocking, reading one frame at a time",
+				ctx->if_name);
+			ctx->rx_batch = 1;
+		}
+
 		/* Create a thread that will handle incoming data from host */
 		create_rx_handler(ctx);
 	}
@@ -72,6 +72,17 @@ int eth_iface_remove(int fd)
 	return close(fd);
 }
 
+int eth_iface_nonblock(int fd)
+{
+	int flags = fcntl(fd, F_GETFL);
+
+	if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
 static int ssystem(const char *fmt, ...)
 	__attribute__((__format__(__printf__, 1, 2)));
 
@@ -13,6 +13,7 @@
 
 int eth_iface_create(const char *dev_name, const char *if_name, bool tun_only);
 int eth_iface_remove(int fd);
+int eth_iface_nonblock(int fd);
 int eth_wait_data(int fd);
 int eth_clock_gettime(uint64_t *second, uint32_t *nanosecond);
 int eth_promisc_mode(const char *if_name, bool enable);
@@ -0,0 +1,99 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+enum flash_async_type {
+	FLASH_ASYNC_READ,
+	FLASH_ASYNC_WRITE,
+	FLASH_ASYNC_ERASE,
+};
+
+static K_THREAD_STACK_DEFINE(flash_async_stack, CONFIG_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q flash_async_workq;
+
+static void flash_async_handler(struct k_work *work)
+{
+	struct flash_async_op *op = CONTAINER_OF(work, struct flash_async_op, work);
+	int rc;
+
+	switch (op->type) {
+	case FLASH_ASYNC_READ:
+		rc = flash_read(op->dev, op->offset, op->data, op->len);
+		break;
+	case FLASH_ASYNC_WRITE:
+		rc = flash_write(op->dev, op->offset, op->data, op->len);
+		break;
+	default:
+		rc = flash_erase(op->dev, op->offset, op->len);
+		break;
+	}
+
+	/* The operation may be submitted again from the callback */
+	op->callback(op, rc);
+}
+
+static int flash_async_submit(struct flash_async_op *op, enum flash_async_type type,
+			      const struct device *dev, off_t offset, void *data, size_t len)
+{
+	if ((k_work_busy_get(&op->work) & K_WORK_QUEUED) != 0) {
+		return -EBUSY;
+	}
+
+	op->type = type;
+	op->dev = dev;
+	op->offset = offset;
+	op->data = data;
+	op->len = len;
+
+	(void)k_work_submit_to_queue(&flash_async_workq, &op->work);
+
+	return 0;
+}
+
+void flash_async_op_init(struct flash_async_op *op, flash_async_callback_t callback,
+			 void *user_data)
+{
+	op->callback = callback;
+	op->user_data = user_data;
+	k_work_init(&op->work, flash_async_handler);
+}
+
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_op *op)
+{
+	return flash_async_submit(op, FLASH_ASYNC_READ, dev, offset, data, len);
+}
+
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op)
+{
+	return flash_async_submit(op, FLASH_ASYNC_WRITE, dev, offset, (void *)data, len);
+}
+
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op)
+{
+	return flash_async_submit(op, FLASH_ASYNC_ERASE, dev, offset, NULL, size);
+}
+
+static int flash_async_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "flash_async",
+	};
+
+	k_work_queue_start(&flash_async_workq, flash_async_stack,
+			   K_THREAD_STACK_SIZEOF(flash_async_stack),
+			   CONFIG_FLASH_ASYNC_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(flash_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -56,3 +56,56 @@ int z_impl_i2s_buf_write(const struct device *dev, void *buf, size_t size)
 
 	return ret;
 }
+
+int i2s_relay(const struct device *rx_dev, const struct device *tx_dev,
+	      i2s_block_process_t process, void *user_data)
+{
+	const struct i2s_config *rx_cfg;
+	const struct i2s_config *tx_cfg;
+	void *rx_block;
+	void *tx_block;
+	size_t size;
+	int ret;
+
+	rx_cfg = i2s_config_get(rx_dev, I2S_DIR_RX);
+	tx_cfg = i2s_config_get(tx_dev, I2S_DIR_TX);
+	if (!rx_cfg || !tx_cfg) {
+		return -EIO;
+	}
+
+	ret = i2s_read(rx_dev, &rx_block, &size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (process) {
+		process(rx_block, size, user_data);
+	}
+
+	if (rx_cfg->mem_slab == tx_cfg->mem_slab) {
+		/* Hand the received block over to the TX queue */
+		tx_block = rx_block;
+	} else {
+		if (size > tx_cfg->block_size) {
+			k_mem_slab_free(rx_cfg->mem_slab, rx_block);
+			return -EINVAL;
+		}
+
+		ret = k_mem_slab_alloc(tx_cfg->mem_slab, &tx_block,
+				       SYS_TIMEOUT_MS(tx_cfg->timeout));
+		if (ret < 0) {
+			k_mem_slab_free(rx_cfg->mem_slab, rx_block);
+			return -ENOMEM;
+		}
+
+		memcpy(tx_block, rx_block, size);
+		k_mem_slab_free(rx_cfg->mem_slab, rx_block);
+	}
+
+	ret = i2s_write(tx_dev, tx_block, size);
+	if (ret != 0) {
+		k_mem_slab_free(tx_cfg->mem_slab, tx_block);
+	}
+
+	return ret;
+}
@@ -49,6 +49,10 @@ uint32_t var = MIPI_DBI_SPI_READ_REQUIRED;
 #define MIPI_DBI_SPI_WRITE_8BIT_REQUIRED DT_INST_FOREACH_STATUS_OKAY(MIPI_DBI_SPI_XFR_8BITS) 0
 #define MIPI_DBI_SPI_WRITE_16BIT_REQUIRED DT_INST_FOREACH_STATUS_OKAY(MIPI_DBI_SPI_XFR_16BITS) 0
 
+/* Word buffer is used to batch 9 bit words in 3 wire mode and 16 bit words */
+#define MIPI_DBI_SPI_WORD_BUF_REQUIRED \
+	(IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE) || MIPI_DBI_SPI_WRITE_16BIT_REQUIRED)
+
 /* In Type C mode 1 MIPI BIT communication, the 9th bit of the word
  * (first bit sent in each word) indicates if the word is a command or
  * data. Typically 0 indicates a command and 1 indicates data, but some
@@ -80,6 +84,10 @@ struct mipi_dbi_spi_data {
 #endif
 	/* Used for 3 wire mode */
 	uint16_t spi_byte;
+#if MIPI_DBI_SPI_WORD_BUF_REQUIRED
+	/* Words collected to be sent in a single transfer */
+	uint16_t word_buf[CONFIG_MIPI_DBI_SPI_WORD_BUF_SIZE];
+#endif
 };
 
 #if MIPI_DBI_SPI_TE_REQUIRED
@@ -104,21 +112,62 @@ static void mipi_dbi_spi_te_cb(const struct device *dev,
 
 #endif /* MIPI_DBI_SPI_TE_REQUIRED */
 
-static inline int
-mipi_dbi_spi_write_helper_3wire(const struct device *dev,
-				const struct mipi_dbi_config *dbi_config,
-				bool cmd_present, uint8_t cmd,
-				const uint8_t *data_buf, size_t len)
+#if MIPI_DBI_SPI_WORD_BUF_REQUIRED
+
+/*
+ * Sends an optional command word followed by one word per data byte,
+ * batching as many words as fit in the word buffer into each transfer.
+ */
+static int mipi_dbi_spi_write_words(const struct device *dev,
+				    const struct mipi_dbi_config *dbi_config,
+				    bool cmd_present, uint16_t cmd_word,
+				    uint16_t data_flag, bool big_endian,
+				    const uint8_t *data_buf, size_t len)
 {
 	const struct mipi_dbi_spi_config *config = dev->config;
 	struct mipi_dbi_spi_data *data = dev->data;
-	struct spi_buf buffer;
+	struct spi_buf buffer = {
+		.buf = data->word_buf,
+	};
 	struct spi_buf_set buf_set = {
 		.buffers = &buffer,
 		.count = 1,
 	};
+	size_t cnt = 0;
 	int ret = 0;
 
+	if (cmd_present) {
+		data->word_buf[cnt++] = cmd_word;
+	}
+
+	while (cnt > 0 || len > 0) {
+		while (cnt < ARRAY_SIZE(data->word_buf) && len > 0) {
+			uint16_t word = data_flag | *data_buf++;
+
+			data->word_buf[cnt++] = big_endian ? sys_cpu_to_be16(word) : word;
+			len--;
+		}
+
+		buffer.len = cnt * sizeof(data->word_buf[0]);
+		ret = spi_write(config->spi_dev, &dbi_config->config, &buf_set);
+		if (ret < 0) {
+			break;
+		}
+
+		cnt = 0;
+	}
+
+	return ret;
+}
+
+#endif /* MIPI_DBI_SPI_WORD_BUF_REQUIRED */
+
+static inline int
+mipi_dbi_spi_write_helper_3wire(const struct device *dev,
+				const struct mipi_dbi_config *dbi_config,
+				bool cmd_present, uint8_t cmd,
+				const uint8_t *data_buf, size_t len)
+{
 	/*
 	 * 9 bit word mode must be used, as the command/data bit
 	 * is stored before the data word.
@@ -128,27 +177,14 @@ mipi_dbi_spi_write_helper_3wire(const struct device *dev,
 	    != SPI_WORD_SET(9)) {
 		return -ENOTSUP;
 	}
-	buffer.buf = &data->spi_byte;
-	buffer.len = 2;
 
-	/* Send command */
-	if (cmd_present) {
-		data->spi_byte = cmd;
-		ret = spi_write(config->spi_dev, &dbi_config->config, &buf_set);
-		if (ret < 0) {
-			goto out;
-		}
-	}
-	/* Write data, byte by byte */
-	for (size_t i = 0; i < len; i++) {
-		data->spi_byte = MIPI_DBI_DC_BIT | data_buf[i];
-		ret = spi_write(config->spi_dev, &dbi_config->config, &buf_set);
-		if (ret < 0) {
-			goto out;
-		}
-	}
-out:
-	return ret;
+#if MIPI_DBI_SPI_WORD_BUF_REQUIRED
+	/* Send command and data words, batched into as few transfers as possible */
+	return mipi_dbi_spi_write_words(dev, dbi_config, cmd_present, cmd,
+					MIPI_DBI_DC_BIT, false, data_buf, len);
+#else
+	return -ENOTSUP;
+#endif
 }
 
 #if MIPI_DBI_SPI_WRITE_8BIT_REQUIRED
@@ -243,16 +279,9 @@ mipi_dbi_spi_write_helper_4wire_16bit(const struct device *dev,
 			gpio_pin_set_dt(&config->cmd_data, 1);
 		}
 
-		/* iterate command data */
-		for (int i = 0; i < len; i++) {
-			data16 = sys_cpu_to_be16(data_buf[i]);
-
-			ret = spi_write(config->spi_dev, &dbi_config->config,
-					&buf_set);
-			if (ret < 0) {
-				goto out;
-			}
-		}
+		/* Send command data with stuffing, batched in the word buffer */
+		ret = mipi_dbi_spi_write_words(dev, dbi_config, false, 0, 0,
+					       true, data_buf, len);
 	} else {
 		int stuffing = len % sizeof(data16);
 
@@ -273,18 +302,10 @@ mipi_dbi_spi_write_helper_4wire_16bit(const struct device *dev,
 			}
 		}
 
-		/* iterate remaining data with stuffing */
-		for (int i = len - stuffing; i < len; i++) {
-			data16 = sys_cpu_to_be16(data_buf[i]);
-			buffer.buf = &data16;
-			buffer.len = sizeof(data16);
-
-			ret = spi_write(config->spi_dev, &dbi_config->config,
-					&buf_set);
-			if (ret < 0) {
-				goto out;
-			}
-		}
+		/* Send remaining data with stuffing */
+		ret = mipi_dbi_spi_write_words(dev, dbi_config, false, 0, 0,
+					       true, &data_buf[len - stuffing],
+					       stuffing);
 	}
 out:
 	return ret;
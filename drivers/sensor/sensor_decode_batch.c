@@ -0,0 +1,74 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/sys/util.h>
+
+/* Frames decoded per call to the decoder without a batch implementation */
+#define CHUNK_FRAMES 8
+
+int sensor_decode_batch(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			struct sensor_chan_spec chan_spec, uint32_t *fit, uint16_t max_count,
+			struct sensor_three_axis_batch *out)
+{
+	uint8_t chunk[sizeof(struct sensor_three_axis_data) +
+		      (CHUNK_FRAMES - 1) * sizeof(struct sensor_three_axis_sample_data)]
+		__aligned(8);
+	struct sensor_three_axis_data *data = (struct sensor_three_axis_data *)chunk;
+	size_t base_size;
+	size_t frame_size;
+	uint16_t total = 0;
+	int rc;
+
+	if (decoder->decode_batch != NULL) {
+		rc = decoder->decode_batch(buffer, chan_spec, fit, max_count, out);
+		if (rc != -ENOTSUP) {
+			return rc;
+		}
+	}
+
+	rc = decoder->get_size_info(chan_spec, &base_size, &frame_size);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (base_size != sizeof(struct sensor_three_axis_data)) {
+		return -EINVAL;
+	}
+
+	while (total < max_count) {
+		uint16_t count = MIN(max_count - total, CHUNK_FRAMES);
+		uint32_t offset;
+
+		rc = decoder->decode(buffer, chan_spec, fit, count, data);
+		if (rc <= 0) {
+			return (total > 0) ? total : rc;
+		}
+
+		if (total == 0) {
+			out->base_timestamp_ns = data->header.base_timestamp_ns;
+			out->shift = data->shift;
+		}
+
+		offset = (uint32_t)(data->header.base_timestamp_ns - out->base_timestamp_ns);
+
+		for (int i = 0; i < rc; i++) {
+			out->timestamp_delta[total + i] = data->readings[i].timestamp_delta + offset;
+			out->x[total + i] = data->readings[i].x;
+			out->y[total + i] = data->readings[i].y;
+			out->z[total + i] = data->readings[i].z;
+		}
+
+		total += rc;
+
+		if (rc < count) {
+			break;
+		}
+	}
+
+	return total;
+}
@@ -254,20 +254,20 @@ static inline q31_t icm4268x_read_temperature_from_packet(const uint8_t *pkt)
 	return FIELD_PREP(GENMASK(31, 22), whole) | (fraction * GENMASK64(21, 0) / 1000000);
 }
 
-static int icm4268x_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
-					 uint8_t axis_offset, q31_t *out)
+/* Scale of the FIFO samples to q31, indexed by [is_accel][is_hires] */
+static const uint32_t fifo_scale[2][2] = {
+	/* low-res,	hi-res */
+	{35744,		2235}, /* gyro */
+	{40168,		2511}, /* accel */
+};
+
+static inline int32_t icm4268x_read_raw_from_packet(const uint8_t *pkt, bool is_accel,
+						    uint8_t axis_offset)
 {
 	uint32_t unsigned_value;
-	int32_t signed_value;
 	bool is_hires = FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1;
 	int offset = 1 + (axis_offset * 2);
 
-	const uint32_t scale[2][2] = {
-		/* low-res,	hi-res */
-		{35744,		2235}, /* gyro */
-		{40168,		2511}, /* accel */
-	};
-
 	if (!is_accel && FIELD_GET(FIFO_HEADER_ACCEL, pkt[0]) == 1) {
 		offset += 6;
 	}
@@ -276,27 +276,35 @@ static int icm4268x_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 
 	if (is_hires) {
 		uint32_t mask = is_accel ? GENMASK(7, 4) : GENMASK(3, 0);
+
 		offset = 17 + axis_offset;
 		unsigned_value = (unsigned_value << 4) | FIELD_GET(mask, pkt[offset]);
-		signed_value = unsigned_value | (0 - (unsigned_value & BIT(19)));
-
-		/*
-		 * By default, INTF_CONFIG0 is set to 0x30 and thus FIFO_HOLD_LAST_DATA_EN is set to
-		 * 0. For 20-bit FIFO packets, -524288 indicates invalid data.
-		 *
-		 * At the time of writing, INTF_CONFIG0 is not configured explicitly.
-		 *
-		 * TODO: Enable/disable this check based on FIFO_HOLD_LAST_DATA_EN if INTF_CONFIG0
-		 * is configured explicitly.
-		 */
-		if (signed_value == -524288) {
-			return -ENODATA;
-		}
-	} else {
-		signed_value = unsigned_value | (0 - (unsigned_value & BIT(16)));
+		return unsigned_value | (0 - (unsigned_value & BIT(19)));
+	}
+
+	return unsigned_value | (0 - (unsigned_value & BIT(16)));
+}
+
+static int icm4268x_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
+					 uint8_t axis_offset, q31_t *out)
+{
+	int32_t signed_value = icm4268x_read_raw_from_packet(pkt, is_accel, axis_offset);
+	bool is_hires = FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1;
+
+	/*
+	 * By default, INTF_CONFIG0 is set to 0x30 and thus FIFO_HOLD_LAST_DATA_EN is set to
+	 * 0. For 20-bit FIFO packets, -524288 indicates invalid data.
+	 *
+	 * At the time of writing, INTF_CONFIG0 is not configured explicitly.
+	 *
+	 * TODO: Enable/disable this check based on FIFO_HOLD_LAST_DATA_EN if INTF_CONFIG0
+	 * is configured explicitly.
+	 */
+	if (is_hires && signed_value == -524288) {
+		return -ENODATA;
 	}
 
-	*out = (q31_t)(signed_value * scale[is_accel][is_hires]);
+	*out = (q31_t)(signed_value * fifo_scale[is_accel][is_hires]);
 	return 0;
 }
 
@@ -536,6 +544,128 @@ static int icm4268x_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 	return count;
 }
 
+/*
+ * Batch decoding of accel or gyro FIFO frames. A first pass gathers the raw samples
+ * into the output arrays, a second one scales them with a constant per axis, which
+ * the compiler can vectorize.
+ */
+static int icm4268x_fifo_decode_batch(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				      uint32_t *fit, uint16_t max_count,
+				      struct sensor_three_axis_batch *out)
+{
+	const struct icm4268x_fifo_data *edata = (const struct icm4268x_fifo_data *)buffer;
+	const uint8_t *buffer_end = buffer + sizeof(struct icm4268x_fifo_data) + edata->fifo_count;
+	const struct alignment *axis_align = edata->header.axis_align;
+	const uint8_t *last_end = NULL;
+	bool is_accel;
+	uint32_t header_bit;
+	uint64_t step;
+	int frame_count = 0;
+	int is_hires = -1;
+	uint16_t count = 0;
+
+	if (!edata->header.is_fifo || chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_ACCEL_XYZ:
+		is_accel = true;
+		header_bit = FIFO_HEADER_ACCEL;
+		step = (uint64_t)accel_period_ns[edata->accel_odr] * 32000;
+		break;
+	case SENSOR_CHAN_GYRO_XYZ:
+		is_accel = false;
+		header_bit = FIFO_HEADER_GYRO;
+		step = (uint64_t)gyro_period_ns[edata->gyro_odr] * 32000;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	if ((uintptr_t)buffer_end <= *fit) {
+		return 0;
+	}
+
+	out->base_timestamp_ns = edata->header.timestamp;
+	icm4268x_get_shift(chan_spec.chan_type, edata->header.accel_fs, edata->header.gyro_fs,
+			   edata->header.variant, &out->shift);
+
+	buffer += sizeof(struct icm4268x_fifo_data);
+	while (count < max_count && buffer < buffer_end) {
+		const uint8_t *pkt = buffer;
+		const bool is_20b = FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1;
+		int32_t raw[3];
+		uint64_t ts_delta;
+
+		if (is_20b) {
+			buffer += 20;
+		} else if (FIELD_GET(FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO, pkt[0]) == 3) {
+			buffer += 16;
+		} else {
+			buffer += 8;
+		}
+
+		if ((pkt[0] & header_bit) == 0) {
+			continue;
+		}
+
+		frame_count++;
+
+		if ((uintptr_t)pkt < *fit) {
+			continue;
+		}
+
+		/* Mixed resolutions have no common scale */
+		if (is_hires < 0) {
+			is_hires = is_20b;
+		} else if (is_hires != is_20b) {
+			return -ENOTSUP;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			raw[i] = icm4268x_read_raw_from_packet(pkt, is_accel, i);
+		}
+
+		/* See icm4268x_read_imu_from_packet() */
+		if (is_20b && (raw[0] == -524288 || raw[1] == -524288 || raw[2] == -524288)) {
+			frame_count--;
+			continue;
+		}
+
+		ts_delta = step * (frame_count - 1) / edata->rtc_freq;
+		if (ts_delta > UINT32_MAX) {
+			LOG_ERR("Timestamp delta overflow");
+			continue;
+		}
+
+		out->timestamp_delta[count] = ts_delta;
+		for (int i = 0; i < 3; i++) {
+			out->values[i][count] = raw[axis_align[i].index];
+		}
+
+		last_end = buffer;
+		count++;
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		const uint32_t scale = (uint32_t)(axis_align[i].sign *
+						  (int32_t)fifo_scale[is_accel][is_hires]);
+		q31_t *values = out->values[i];
+
+		for (uint16_t n = 0; n < count; n++) {
+			values[n] = (q31_t)((uint32_t)values[n] * scale);
+		}
+	}
+
+	*fit = (uintptr_t)last_end;
+	return count;
+}
+
 static int icm4268x_one_shot_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
 				    uint32_t *fit, uint16_t max_count, void *data_out)
 {
@@ -755,6 +885,7 @@ SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_size_info = icm4268x_decoder_get_size_info,
 	.decode = icm4268x_decoder_decode,
 	.has_trigger = icm4268x_decoder_has_trigger,
+	.decode_batch = icm4268x_fifo_decode_batch,
 };
 
 int icm4268x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
@@ -138,12 +138,12 @@ int uart_async_rx_init(struct uart_async_rx *rx_data,
 		       const struct uart_async_rx_config *config)
 {
 	__ASSERT_NO_MSG(config->buf_cnt > 0);
-	__ASSERT_NO_MSG(config->length / config->buf_cnt <= UINT8_MAX);
+	__ASSERT_NO_MSG(config->length / config->buf_cnt <= UINT16_MAX);
 	memset(rx_data, 0, sizeof(*rx_data));
 	rx_data->config = config;
 	rx_data->buf_len = (config->length / config->buf_cnt) - UART_ASYNC_RX_BUF_OVERHEAD;
 
-	if (rx_data->buf_len >= BIT(7)) {
+	if (rx_data->buf_len >= BIT(15)) {
 		return -EINVAL;
 	}
 	uart_async_rx_reset(rx_data);
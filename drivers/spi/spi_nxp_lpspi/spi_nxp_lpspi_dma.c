@@ -10,6 +10,9 @@
 LOG_MODULE_DECLARE(spi_lpspi, CONFIG_SPI_LOG_LEVEL);
 
 #include <zephyr/drivers/dma.h>
+#ifdef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
+#include <zephyr/drivers/spi/rtio.h>
+#endif
 #include "spi_nxp_lpspi_priv.h"
 
 /* These states indicate what's the status of RX and TX, also synchronization
@@ -25,10 +28,12 @@ typedef enum {
 	LPSPI_TRANSFER_STATE_INVALID = 0xFFFFFFFFUL,
 } lpspi_transfer_state_t;
 
+#ifndef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
 /* dummy memory used for transferring NOP when tx buf is null */
 static uint32_t tx_nop_val; /* check compliance says no init to 0, but should be 0 in bss */
 /* dummy memory for transferring to when RX buf is null */
 static uint32_t dummy_buffer;
+#endif
 
 struct spi_dma_stream {
 	const struct device *dma_dev;
@@ -48,6 +53,13 @@ struct spi_nxp_dma_data {
 	 * size once and update the buffer pointers at the same time.
 	 */
 	size_t synchronize_dma_size;
+#ifdef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
+	struct spi_rtio *rtio_ctx;
+	/* Channels of the current transaction left to complete */
+	atomic_t rtio_channels;
+	struct dma_block_config rtio_tx_blocks[CONFIG_SPI_NXP_LPSPI_DMA_RTIO_BLOCKS];
+	struct dma_block_config rtio_rx_blocks[CONFIG_SPI_NXP_LPSPI_DMA_RTIO_BLOCKS];
+#endif
 };
 
 /*
@@ -84,6 +96,7 @@ static void spi_mcux_issue_TCR(const struct device *dev)
 	}
 }
 
+#ifndef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
 static struct dma_block_config *lpspi_dma_common_load(struct spi_dma_stream *stream,
 						      const struct device *dev, const uint8_t *buf,
 						      size_t len)
@@ -354,6 +367,224 @@ out:
 	return ret;
 }
 
+static int spi_nxp_dma_transceive_sync(const struct device *dev, const struct spi_config *spi_cfg,
+				       const struct spi_buf_set *tx_bufs,
+				       const struct spi_buf_set *rx_bufs)
+{
+	return transceive_dma(dev, spi_cfg, tx_bufs, rx_bufs, false, NULL, NULL);
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static int spi_nxp_dma_transceive_async(const struct device *dev, const struct spi_config *spi_cfg,
+					const struct spi_buf_set *tx_bufs,
+					const struct spi_buf_set *rx_bufs, spi_callback_t cb,
+					void *userdata)
+{
+	return transceive_dma(dev, spi_cfg, tx_bufs, rx_bufs, true, cb, userdata);
+}
+#endif /* CONFIG_SPI_ASYNC */
+
+#define LPSPI_DMA_CALLBACK lpspi_dma_callback
+
+#else /* CONFIG_SPI_NXP_LPSPI_DMA_RTIO */
+/* Transmitted for transfers without transmit buffer, and receiving transfers
+ * without receive buffer.
+ */
+static uint8_t rtio_tx_nop[32];
+static uint8_t rtio_rx_sink[32];
+
+static void lpspi_dma_rtio_start(const struct device *dev);
+
+static void lpspi_dma_rtio_complete(const struct device *dev, int status)
+{
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	struct lpspi_data *data = dev->data;
+	struct spi_nxp_dma_data *dma_data = (struct spi_nxp_dma_data *)data->driver_data;
+	const struct spi_config *spi_cfg = data->ctx.config;
+
+	base->DER &= ~(LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK);
+
+	if (status < 0) {
+		(void)dma_stop(dma_data->dma_tx.dma_dev, dma_data->dma_tx.channel);
+		(void)dma_stop(dma_data->dma_rx.dma_dev, dma_data->dma_rx.channel);
+	}
+
+	if (spi_cfg == NULL || !(spi_cfg->operation & SPI_HOLD_ON_CS)) {
+		spi_context_cs_control(&data->ctx, false);
+	}
+
+	if (spi_rtio_complete(dma_data->rtio_ctx, status)) {
+		lpspi_dma_rtio_start(dev);
+	}
+}
+
+static void lpspi_dma_rtio_callback(const struct device *dev, void *arg, uint32_t channel,
+				    int status)
+{
+	const struct device *spi_dev = arg;
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(spi_dev, reg_base);
+	struct lpspi_data *data = (struct lpspi_data *)spi_dev->data;
+	struct spi_nxp_dma_data *dma_data = (struct spi_nxp_dma_data *)data->driver_data;
+
+	ARG_UNUSED(dev);
+
+	if (status < 0) {
+		/* The other channel won't complete */
+		if (atomic_set(&dma_data->rtio_channels, 0) != 0) {
+			lpspi_dma_rtio_complete(spi_dev, status);
+		}
+		return;
+	}
+
+	if (channel == dma_data->dma_tx.channel) {
+		spi_mcux_issue_TCR(spi_dev);
+		base->DER &= ~LPSPI_DER_TDDE_MASK;
+	} else {
+		base->DER &= ~LPSPI_DER_RDDE_MASK;
+	}
+
+	if (atomic_dec(&dma_data->rtio_channels) == 1) {
+		lpspi_dma_rtio_complete(spi_dev, 0);
+	}
+}
+
+static int lpspi_dma_rtio_load(const struct device *dev, struct spi_dma_stream *stream,
+			       struct dma_block_config *blocks, int count, bool tx)
+{
+	stream->dma_cfg.channel_direction = tx ? MEMORY_TO_PERIPHERAL : PERIPHERAL_TO_MEMORY;
+	stream->dma_cfg.source_burst_length = 1;
+	stream->dma_cfg.dma_callback = lpspi_dma_rtio_callback;
+	stream->dma_cfg.user_data = (void *)dev;
+	stream->dma_cfg.head_block = blocks;
+	stream->dma_cfg.block_count = count;
+
+	/* Run the list as a single program with one completion */
+	stream->dma_cfg.complete_callback_en = 0;
+	if (count > 1) {
+		blocks[0].source_gather_en = tx;
+		blocks[0].dest_scatter_en = !tx;
+	}
+
+	return dma_config(stream->dma_dev, stream->channel, &stream->dma_cfg);
+}
+
+static void lpspi_dma_rtio_start(const struct device *dev)
+{
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	struct lpspi_data *data = dev->data;
+	struct spi_nxp_dma_data *dma_data = (struct spi_nxp_dma_data *)data->driver_data;
+	struct rtio_iodev_sqe *txn_head = dma_data->rtio_ctx->txn_head;
+	struct spi_dt_spec *spi_dt_spec = txn_head->sqe.iodev->data;
+	struct spi_config *spi_cfg = &spi_dt_spec->config;
+	uint8_t major_ver = (base->VERID & LPSPI_VERID_MAJOR_MASK) >> LPSPI_VERID_MAJOR_SHIFT;
+	int count;
+	int ret;
+
+	if (SPI_OP_MODE_GET(spi_cfg->operation) != SPI_OP_MODE_MASTER ||
+	    SPI_WORD_SIZE_GET(spi_cfg->operation) != BITS_PER_BYTE ||
+	    ((spi_cfg->operation & SPI_HOLD_ON_CS) && major_ver < 2)) {
+		ret = -ENOTSUP;
+		goto error;
+	}
+
+	ret = lpspi_configure(dev, spi_cfg);
+	if (ret) {
+		goto error;
+	}
+
+	count = spi_rtio_dma_blocks(txn_head, (uintptr_t)&base->TDR, (uintptr_t)&base->RDR,
+				    rtio_tx_nop, rtio_rx_sink, sizeof(rtio_tx_nop),
+				    dma_data->rtio_tx_blocks, dma_data->rtio_rx_blocks,
+				    ARRAY_SIZE(dma_data->rtio_tx_blocks));
+	if (count <= 0) {
+		ret = (count < 0) ? count : -EINVAL;
+		goto error;
+	}
+
+	/* Always use continuous mode, the chip select is held for the whole
+	 * transaction.
+	 */
+	base->TCR |= LPSPI_TCR_CONT_MASK | LPSPI_TCR_CONTC_MASK;
+	base->FCR = LPSPI_FCR_TXWATER(0) | LPSPI_FCR_RXWATER(0);
+
+	ret = lpspi_dma_rtio_load(dev, &dma_data->dma_tx, dma_data->rtio_tx_blocks, count, true);
+	if (ret != 0) {
+		goto error;
+	}
+
+	ret = lpspi_dma_rtio_load(dev, &dma_data->dma_rx, dma_data->rtio_rx_blocks, count, false);
+	if (ret != 0) {
+		goto error;
+	}
+
+	atomic_set(&dma_data->rtio_channels, 2);
+
+	ret = dma_start(dma_data->dma_rx.dma_dev, dma_data->dma_rx.channel);
+	if (ret != 0) {
+		goto error;
+	}
+
+	ret = dma_start(dma_data->dma_tx.dma_dev, dma_data->dma_tx.channel);
+	if (ret != 0) {
+		goto error;
+	}
+
+	spi_context_cs_control(&data->ctx, true);
+	base->DER |= LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK;
+
+	return;
+
+error:
+	lpspi_dma_rtio_complete(dev, ret);
+}
+
+static void lpspi_dma_rtio_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct lpspi_data *data = dev->data;
+	struct spi_nxp_dma_data *dma_data = (struct spi_nxp_dma_data *)data->driver_data;
+
+	if (spi_rtio_submit(dma_data->rtio_ctx, iodev_sqe)) {
+		lpspi_dma_rtio_start(dev);
+	}
+}
+
+static int lpspi_dma_rtio_transceive(const struct device *dev, const struct spi_config *spi_cfg,
+				     const struct spi_buf_set *tx_bufs,
+				     const struct spi_buf_set *rx_bufs)
+{
+	struct lpspi_data *data = dev->data;
+	struct spi_nxp_dma_data *dma_data = (struct spi_nxp_dma_data *)data->driver_data;
+	int ret;
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, spi_cfg);
+	ret = spi_rtio_transceive(dma_data->rtio_ctx, spi_cfg, tx_bufs, rx_bufs);
+	spi_context_release(&data->ctx, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static int lpspi_dma_rtio_transceive_async(const struct device *dev,
+					   const struct spi_config *spi_cfg,
+					   const struct spi_buf_set *tx_bufs,
+					   const struct spi_buf_set *rx_bufs, spi_callback_t cb,
+					   void *userdata)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(spi_cfg);
+	ARG_UNUSED(tx_bufs);
+	ARG_UNUSED(rx_bufs);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(userdata);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_SPI_ASYNC */
+
+#define LPSPI_DMA_CALLBACK lpspi_dma_rtio_callback
+
+#endif /* CONFIG_SPI_NXP_LPSPI_DMA_RTIO */
+
 static int lpspi_dma_dev_ready(const struct device *dma_dev)
 {
 	if (!device_is_ready(dma_dev)) {
@@ -380,35 +611,30 @@ static int lpspi_dma_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
+	spi_rtio_init(dma_data->rtio_ctx, dev);
+#endif
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return 0;
 }
 
-static int spi_nxp_dma_transceive_sync(const struct device *dev, const struct spi_config *spi_cfg,
-				       const struct spi_buf_set *tx_bufs,
-				       const struct spi_buf_set *rx_bufs)
-{
-	return transceive_dma(dev, spi_cfg, tx_bufs, rx_bufs, false, NULL, NULL);
-}
-
-#ifdef CONFIG_SPI_ASYNC
-static int spi_nxp_dma_transceive_async(const struct device *dev, const struct spi_config *spi_cfg,
-					const struct spi_buf_set *tx_bufs,
-					const struct spi_buf_set *rx_bufs, spi_callback_t cb,
-					void *userdata)
-{
-	return transceive_dma(dev, spi_cfg, tx_bufs, rx_bufs, true, cb, userdata);
-}
-#endif /* CONFIG_SPI_ASYNC */
-
 static DEVICE_API(spi, lpspi_dma_driver_api) = {
+#ifdef CONFIG_SPI_NXP_LPSPI_DMA_RTIO
+	.transceive = lpspi_dma_rtio_transceive,
+#ifdef CONFIG_SPI_ASYNC
+	.transceive_async = lpspi_dma_rtio_transceive_async,
+#endif
+	.iodev_submit = lpspi_dma_rtio_submit,
+#else
 	.transceive = spi_nxp_dma_transceive_sync,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_nxp_dma_transceive_async,
 #endif
 #ifdef CONFIG_SPI_RTIO
 	.iodev_submit = spi_rtio_iodev_default_submit,
+#endif
 #endif
 	.release = spi_lpspi_release,
 };
@@ -419,7 +645,7 @@ static void lpspi_isr(const struct device *dev)
 }
 
 #define LPSPI_DMA_COMMON_CFG(n)			\
-	.dma_callback = lpspi_dma_callback,	\
+	.dma_callback = LPSPI_DMA_CALLBACK,	\
 	.source_data_size = 1,			\
 	.dest_data_size = 1,			\
 	.block_count = 1
@@ -442,7 +668,14 @@ static void lpspi_isr(const struct device *dev)
 	SPI_NXP_LPSPI_COMMON_INIT(n)                                                               \
 	SPI_LPSPI_CONFIG_INIT(n)                                                              \
                                                                                                    \
-	static struct spi_nxp_dma_data lpspi_dma_data##n = {SPI_DMA_CHANNELS(n)};                  \
+	IF_ENABLED(CONFIG_SPI_NXP_LPSPI_DMA_RTIO,                                                  \
+		   (SPI_RTIO_DEFINE(spi_nxp_dma_rtio_##n, CONFIG_SPI_NXP_LPSPI_DMA_RTIO_SQ_SIZE, \
+				    CONFIG_SPI_NXP_LPSPI_DMA_RTIO_SQ_SIZE)))                     \
+                                                                                                   \
+	static struct spi_nxp_dma_data lpspi_dma_data##n = {                                       \
+		SPI_DMA_CHANNELS(n)                                                                \
+		IF_ENABLED(CONFIG_SPI_NXP_LPSPI_DMA_RTIO, (.rtio_ctx = &spi_nxp_dma_rtio_##n,))   \
+	};                                                                                         \
                                                                                                    \
 	static struct lpspi_data lpspi_data_##n = {.driver_data = &lpspi_dma_data##n,        \
 							 SPI_NXP_LPSPI_COMMON_DATA_INIT(n)};       \
@@ -5,7 +5,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
+#include <zephyr/drivers/dma.h>
 #include <zephyr/drivers/spi.h>
 #include <zephyr/rtio/work.h>
 #include <zephyr/drivers/spi/rtio.h>
@@ -309,6 +312,103 @@ out:
 	return ret;
 }
 
+static int spi_rtio_dma_add(struct dma_block_config *blocks, size_t max_blocks, size_t *count,
+			    uintptr_t src, bool src_reg, uintptr_t dst, bool dst_reg, size_t len)
+{
+	struct dma_block_config *block;
+
+	if (*count == max_blocks) {
+		return -ENOMEM;
+	}
+
+	block = &blocks[*count];
+	memset(block, 0, sizeof(*block));
+	block->source_address = src;
+	block->dest_address = dst;
+	block->block_size = len;
+	block->source_addr_adj = src_reg ? DMA_ADDR_ADJ_NO_CHANGE : DMA_ADDR_ADJ_INCREMENT;
+	block->dest_addr_adj = dst_reg ? DMA_ADDR_ADJ_NO_CHANGE : DMA_ADDR_ADJ_INCREMENT;
+
+	if (*count > 0) {
+		blocks[*count - 1].next_block = block;
+	}
+
+	(*count)++;
+
+	return 0;
+}
+
+int spi_rtio_dma_blocks(struct rtio_iodev_sqe *txn_head, uintptr_t tx_reg, uintptr_t rx_reg,
+			const uint8_t *tx_nop, uint8_t *rx_sink, size_t nop_len,
+			struct dma_block_config *tx_blocks, struct dma_block_config *rx_blocks,
+			size_t max_blocks)
+{
+	size_t tx_count = 0;
+	size_t rx_count = 0;
+
+	for (struct rtio_iodev_sqe *txn = txn_head; txn != NULL; txn = rtio_txn_next(txn)) {
+		const struct rtio_sqe *sqe = &txn->sqe;
+		const uint8_t *tx_buf;
+		uint8_t *rx_buf;
+		size_t len;
+
+		switch (sqe->op) {
+		case RTIO_OP_RX:
+			tx_buf = NULL;
+			rx_buf = sqe->rx.buf;
+			len = sqe->rx.buf_len;
+			break;
+		case RTIO_OP_TX:
+			tx_buf = sqe->tx.buf;
+			rx_buf = NULL;
+			len = sqe->tx.buf_len;
+			break;
+		case RTIO_OP_TINY_TX:
+			tx_buf = sqe->tiny_tx.buf;
+			rx_buf = NULL;
+			len = sqe->tiny_tx.buf_len;
+			break;
+		case RTIO_OP_TXRX:
+			tx_buf = sqe->txrx.tx_buf;
+			rx_buf = sqe->txrx.rx_buf;
+			len = sqe->txrx.buf_len;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		/* Missing buffers are replaced by the nop ones, repeated as
+		 * many times as needed.
+		 */
+		for (size_t off = 0; off < len;) {
+			size_t chunk = len - off;
+			int err;
+
+			if (tx_buf == NULL || rx_buf == NULL) {
+				chunk = MIN(chunk, nop_len);
+			}
+
+			err = spi_rtio_dma_add(tx_blocks, max_blocks, &tx_count,
+					       (uintptr_t)(tx_buf != NULL ? &tx_buf[off] : tx_nop),
+					       false, tx_reg, true, chunk);
+			if (err < 0) {
+				return err;
+			}
+
+			err = spi_rtio_dma_add(rx_blocks, max_blocks, &rx_count, rx_reg, true,
+					       (uintptr_t)(rx_buf != NULL ? &rx_buf[off] : rx_sink),
+					       false, chunk);
+			if (err < 0) {
+				return err;
+			}
+
+			off += chunk;
+		}
+	}
+
+	return (int)tx_count;
+}
+
 /**
  * @brief Lock the SPI RTIO spinlock
  *
@@ -1004,6 +1004,10 @@ static inline int dwc2_handle_evt_dout(const struct device *dev,
 			dwc2_ensure_setup_ready(dev);
 		}
 	} else {
+		/* Arm the next queued buffer before notifying the upper
+		 * layer, whose thread may preempt this one.
+		 */
+		dwc2_handle_xfer_next(dev, cfg);
 		err = udc_submit_ep_event(dev, buf, 0);
 	}
 
@@ -1058,6 +1062,11 @@ static int dwc2_handle_evt_din(const struct device *dev,
 		return 0;
 	}
 
+	/* Arm the next queued buffer before notifying the upper layer,
+	 * whose thread may preempt this one.
+	 */
+	dwc2_handle_xfer_next(dev, cfg);
+
 	return udc_submit_ep_event(dev, buf, 0);
 }
 
@@ -3374,6 +3383,9 @@ static ALWAYS_INLINE void dwc2_thread_handler(void *const arg)
 				dwc2_handle_evt_dout(dev, ep_cfg);
 			}
 
+			/* Non-control endpoints are already armed again by the
+			 * handlers if a buffer is queued.
+			 */
 			if (!udc_ep_is_busy(ep_cfg)) {
 				dwc2_handle_xfer_next(dev, ep_cfg);
 			} else {
@@ -28,7 +28,9 @@ LOG_MODULE_REGISTER(video_common, CONFIG_VIDEO_LOG_LEVEL);
 #define VIDEO_COMMON_FREE(block) shared_multi_heap_free(block)
 #else
 K_HEAP_DEFINE(video_buffer_pool,
-		CONFIG_VIDEO_BUFFER_POOL_SZ_MAX * CONFIG_VIDEO_BUFFER_POOL_NUM_MAX);
+		(CONFIG_VIDEO_BUFFER_POOL_SZ_MAX +
+		 ROUND_UP(CONFIG_VIDEO_BUFFER_HEADROOM, CONFIG_VIDEO_BUFFER_POOL_ALIGN)) *
+		CONFIG_VIDEO_BUFFER_POOL_NUM_MAX);
 #define VIDEO_COMMON_HEAP_ALLOC(align, size, timeout)                                              \
 	k_heap_aligned_alloc(&video_buffer_pool, align, size, timeout);
 #define VIDEO_COMMON_FREE(block) k_heap_free(&video_buffer_pool, block)
@@ -46,6 +48,8 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
 {
 	struct video_buffer *vbuf = NULL;
 	struct mem_block *block;
+	/* Keep the data itself aligned */
+	size_t headroom = ROUND_UP(CONFIG_VIDEO_BUFFER_HEADROOM, align);
 	int i;
 
 	/* find available video buffer */
@@ -62,12 +66,13 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
 	}
 
 	/* Alloc buffer memory */
-	block->data = VIDEO_COMMON_HEAP_ALLOC(align, size, timeout);
+	block->data = VIDEO_COMMON_HEAP_ALLOC(align, headroom + size, timeout);
 	if (block->data == NULL) {
 		return NULL;
 	}
 
-	vbuf->buffer = block->data;
+	vbuf->buffer = (uint8_t *)block->data + headroom;
+	vbuf->headroom = headroom;
 	vbuf->size = size;
 	vbuf->bytesused = 0;
 
@@ -79,6 +84,36 @@ struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout)
 	return video_buffer_aligned_alloc(size, sizeof(void *), timeout);
 }
 
+struct video_buffer *video_buffer_import(uint8_t *mem, size_t size)
+{
+	struct video_buffer *vbuf = NULL;
+	int i;
+
+	__ASSERT_NO_MSG(mem != NULL);
+
+	/* find available video buffer */
+	for (i = 0; i < ARRAY_SIZE(video_buf); i++) {
+		if (video_buf[i].buffer == NULL) {
+			vbuf = &video_buf[i];
+			break;
+		}
+	}
+
+	if (vbuf == NULL) {
+		return NULL;
+	}
+
+	/* No block is associated, so that the memory is not freed on release */
+	video_block[i].data = NULL;
+
+	vbuf->buffer = mem;
+	vbuf->headroom = 0;
+	vbuf->size = size;
+	vbuf->bytesused = 0;
+
+	return vbuf;
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
 	struct mem_block *block = NULL;
@@ -88,7 +123,7 @@ void video_buffer_release(struct video_buffer *vbuf)
 
 	/* vbuf to block */
 	for (i = 0; i < ARRAY_SIZE(video_block); i++) {
-		if (video_block[i].data == vbuf->buffer) {
+		if (video_block[i].data == vbuf->buffer - vbuf->headroom) {
 			block = &video_block[i];
 			break;
 		}
@@ -97,6 +132,7 @@ void video_buffer_release(struct video_buffer *vbuf)
 	vbuf->buffer = NULL;
 	if (block) {
 		VIDEO_COMMON_FREE(block->data);
+		block->data = NULL;
 	}
 }
 
@@ -771,6 +771,31 @@ int arch_mem_domain_partition_add(struct k_mem_domain *domain,
 				  uint32_t partition_id);
 #endif /* CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API */
 
+#ifdef CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC
+/**
+ * @brief Start a batch of memory domain updates (arch-specific)
+ *
+ * Until the matching arch_mem_domain_batch_end() call, the architecture may
+ * defer the TLB invalidations and inter-processor interrupts required by
+ * the arch_mem_domain_* calls made on this CPU, and coalesce them. Batches
+ * may be nested.
+ *
+ * This is called with the memory domain lock held.
+ */
+void arch_mem_domain_batch_begin(void);
+
+/**
+ * @brief End a batch of memory domain updates (arch-specific)
+ *
+ * Issue whatever TLB invalidations and inter-processor interrupts have been
+ * deferred since the matching arch_mem_domain_batch_begin() call, so the
+ * updates are effective on all CPUs like they would be without batching.
+ *
+ * This is called with the memory domain lock held.
+ */
+void arch_mem_domain_batch_end(void);
+#endif /* CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC */
+
 /**
  * @brief Check memory region permissions
  *
@@ -23,6 +23,11 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_GEN_IRQ_TRAMPOLINES
+/* Size of each trampoline of arch/arm/core/cortex_m/irq_trampolines.S */
+#define ARCH_IRQ_TRAMPOLINE_SIZE 24
+#endif
+
 #ifdef _ASMLANGUAGE
 GTEXT(z_arm_int_exit);
 GTEXT(arch_irq_enable)
@@ -13,6 +13,7 @@ extern "C" {
 
 #define CPUID_BASIC_INFO_1			0x01
 #define CPUID_EXTENDED_FEATURES_LVL		0x07
+#define CPUID_ARCH_PERFMON			0x0A
 #define CPUID_EXTENDED_TOPOLOGY_ENUMERATION	0x0B
 #define CPUID_EXTENDED_TOPOLOGY_ENUMERATION_V2	0x1F
 
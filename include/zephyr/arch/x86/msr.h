@@ -21,6 +21,15 @@
 #define X86_APIC_BASE_MSR		0x0000001b
 #define X86_APIC_BASE_MSR_X2APIC	BIT(10)
 
+#define X86_PMC0_MSR			0x000000c1 /* .. thru 0x000000c8 */
+
+#define X86_PERFEVTSEL0_MSR		0x00000186 /* .. thru 0x0000018d */
+#define X86_PERFEVTSEL_USR		BIT(16)
+#define X86_PERFEVTSEL_OS		BIT(17)
+#define X86_PERFEVTSEL_EN		BIT(22)
+
+#define X86_PERF_GLOBAL_CTRL_MSR	0x0000038f
+
 #define X86_MTRR_DEF_TYPE_MSR		0x000002ff
 #define X86_MTRR_DEF_TYPE_MSR_ENABLE	BIT(11)
 
@@ -36,6 +36,7 @@
 #include <zephyr/bluetooth/crypto.h>
 #include <zephyr/bluetooth/hci_types.h>
 #include <zephyr/bluetooth/classic/classic.h>
+#include <zephyr/bluetooth/uuid.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/util.h>
@@ -2642,6 +2643,69 @@ int bt_le_scan_cb_register(struct bt_le_scan_cb *cb);
  */
 void bt_le_scan_cb_unregister(struct bt_le_scan_cb *cb);
 
+/**
+ * @brief Add an advertiser address to the host scan filter.
+ *
+ * Once any address, UUID or company identifier is added to the filter, only
+ * the advertising reports matching one of them are given to the scan
+ * callbacks.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ *
+ * @param addr Bluetooth LE identity address of the advertiser.
+ *
+ * @retval 0 Success.
+ * @retval -EALREADY if @p addr is already in the filter.
+ * @retval -ENOMEM if @kconfig{CONFIG_BT_SCAN_FILTER_ADDR_COUNT} addresses
+ *         are already in the filter.
+ */
+int bt_le_scan_filter_add_addr(const bt_addr_le_t *addr);
+
+/**
+ * @brief Add a service UUID to the host scan filter.
+ *
+ * Matches the service UUID lists and the service data of the advertising
+ * reports.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ *
+ * @param uuid Service UUID.
+ *
+ * @retval 0 Success.
+ * @retval -EALREADY if @p uuid is already in the filter.
+ * @retval -ENOMEM if @kconfig{CONFIG_BT_SCAN_FILTER_UUID_COUNT} UUIDs are
+ *         already in the filter.
+ */
+int bt_le_scan_filter_add_uuid(const struct bt_uuid *uuid);
+
+/**
+ * @brief Add a manufacturer company identifier to the host scan filter.
+ *
+ * Matches the company identifier of the manufacturer specific data of the
+ * advertising reports.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ *
+ * @param company_id Bluetooth SIG company identifier.
+ *
+ * @retval 0 Success.
+ * @retval -EALREADY if @p company_id is already in the filter.
+ * @retval -ENOMEM if @kconfig{CONFIG_BT_SCAN_FILTER_MANUF_COUNT} company
+ *         identifiers are already in the filter.
+ */
+int bt_le_scan_filter_add_manuf_id(uint16_t company_id);
+
+/**
+ * @brief Clear the host scan filter.
+ *
+ * Removes all the addresses, UUIDs and company identifiers from the filter,
+ * so that all the advertising reports are given to the scan callbacks, and
+ * forgets the advertisers in the duplicate report cache.
+ *
+ * @note Requires @kconfig{CONFIG_BT_SCAN_FILTER}.
+ */
+void bt_le_scan_filter_clear(void);
+
 /**
  * @brief Add device (LE) to filter accept list.
  *
@@ -1423,8 +1423,12 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
  *
  *  @param conn
  *    Target client.
- *    Notifying all connected clients by passing `NULL` is not yet supported,
- *    please use `bt_gatt_notify` instead.
+ *    Passing `NULL` notifies all the connected clients. The PDU is built once
+ *    and sent to each client subscribed to all the characteristics and
+ *    supporting ATT_MULTIPLE_HANDLE_VALUE_NTF. The other clients get an
+ *    ATT_HANDLE_VALUE_NTF for each characteristic they are subscribed to.
+ *    The errors below are then returned for the last client that failed, or
+ *    `-ENOTCONN` if no client is subscribed.
  *  @param num_params
  *    Element count of `params` array. Has to be greater than 1.
  *  @param params
@@ -259,6 +259,23 @@ struct bt_l2cap_le_chan {
 	/** Pending RX MTU on ECFC reconfigure, used internally by stack */
 	uint16_t pending_rx_mtu;
 
+#if defined(CONFIG_BT_L2CAP_RX_ZERO_COPY)
+	/** @brief Receive segmented SDUs without copying them.
+	 *
+	 *  Only used if the application has set an alloc_buf channel
+	 *  callback. The buffer allocated for an SDU is then left empty and
+	 *  the received segments are added to it as fragments, so the
+	 *  buffer given to @ref bt_l2cap_chan_ops.recv has to be read with
+	 *  the net_buf fragment API.
+	 *
+	 *  Each segment holds a Host RX buffer until the SDU is released,
+	 *  so the credits given to the remote are limited by the free RX
+	 *  buffers. Segments received while no RX buffer is left are copied
+	 *  to a buffer from alloc_buf instead.
+	 */
+	bool rx_zero_copy;
+#endif /* CONFIG_BT_L2CAP_RX_ZERO_COPY */
+
 	/** Channel Transmission Endpoint.
 	 *
 	 * This is an image of the remote's rx.
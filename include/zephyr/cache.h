@@ -532,6 +532,115 @@ static ALWAYS_INLINE void *sys_cache_uncached_ptr_get(void __sparse_cache *ptr)
 }
 
 
+#if defined(CONFIG_CACHE_BATCH) || defined(__DOXYGEN__)
+
+/**
+ * @brief Batched d-cache maintenance operation
+ */
+enum sys_cache_batch_op {
+	/** Flush, as sys_cache_data_flush_range() */
+	SYS_CACHE_BATCH_FLUSH,
+	/** Flush and invalidate, as sys_cache_data_flush_and_invd_range() */
+	SYS_CACHE_BATCH_FLUSH_AND_INVD,
+	/** Invalidate, as sys_cache_data_invd_range() */
+	SYS_CACHE_BATCH_INVD,
+};
+
+/** @cond INTERNAL_HIDDEN */
+struct sys_cache_batch_range {
+	uintptr_t start;
+	uintptr_t end;
+	enum sys_cache_batch_op op;
+};
+/** @endcond */
+
+/**
+ * @brief Batch of d-cache maintenance operations
+ *
+ * Collects the ranges a driver needs to maintain around a transfer chain,
+ * e.g. the buffers of all the descriptors of a DMA transfer, and issues them
+ * at once with sys_cache_batch_commit(). Ranges of the same operation are
+ * merged when they overlap or, for flushes, are less than a cache line apart,
+ * and the whole cache is maintained instead when they add up to at least
+ * @kconfig{CONFIG_CACHE_BATCH_WHOLE_CACHE_THRESHOLD} bytes.
+ *
+ * A batch is not thread-safe.
+ */
+struct sys_cache_batch {
+/** @cond INTERNAL_HIDDEN */
+	struct sys_cache_batch_range *ranges;
+	size_t max;
+	size_t num;
+/** @endcond */
+};
+
+/**
+ * @brief Statically define and initialize a cache maintenance batch
+ *
+ * @param name Name of the batch
+ * @param max_ranges Number of distinct ranges the batch holds
+ */
+#define SYS_CACHE_BATCH_DEFINE(name, max_ranges)                                                   \
+	static struct sys_cache_batch_range _CONCAT(name, _ranges)[max_ranges];                    \
+	struct sys_cache_batch name = {                                                            \
+		.ranges = _CONCAT(name, _ranges),                                                  \
+		.max = (max_ranges),                                                               \
+	}
+
+/**
+ * @brief Initialize a cache maintenance batch
+ *
+ * @param batch Batch
+ * @param ranges Storage for the ranges of the batch
+ * @param max_ranges Number of elements of @p ranges
+ */
+void sys_cache_batch_init(struct sys_cache_batch *batch, struct sys_cache_batch_range *ranges,
+			  size_t max_ranges);
+
+/**
+ * @brief Record a d-cache maintenance operation in a batch
+ *
+ * The operation is only guaranteed to be done once the batch is committed.
+ * When the batch is full, the ranges already recorded are committed first.
+ *
+ * @param batch Batch
+ * @param op Operation
+ * @param addr Starting address of the range
+ * @param size Size of the range
+ *
+ * @retval 0 If succeeded.
+ * @retval -EINVAL If @p op is not a valid operation.
+ * @retval -errno Negative errno of the operations committed to free space.
+ */
+int sys_cache_batch_add(struct sys_cache_batch *batch, enum sys_cache_batch_op op, void *addr,
+			size_t size);
+
+/**
+ * @brief Issue the d-cache maintenance operations of a batch
+ *
+ * Flushes are issued first, then flushes with invalidation, then
+ * invalidations. The batch is empty afterwards.
+ *
+ * @param batch Batch
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno of the first failing operation.
+ */
+int sys_cache_batch_commit(struct sys_cache_batch *batch);
+
+/**
+ * @brief Drop the operations of a batch without issuing them
+ *
+ * @param batch Batch
+ */
+static inline void sys_cache_batch_reset(struct sys_cache_batch *batch)
+{
+	batch->num = 0;
+}
+
+#endif /* CONFIG_CACHE_BATCH || __DOXYGEN__ */
+
 #ifdef CONFIG_LIBMETAL
 static ALWAYS_INLINE void sys_cache_flush(void *addr, size_t size)
 {
@@ -301,6 +301,31 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
  */
 int isotp_recv_net(struct isotp_recv_ctx *rctx, struct net_buf **buffer, k_timeout_t timeout);
 
+/**
+ * @brief Receive the next message directly into a buffer
+ *
+ * The payload of the next message is written to @p data as its frames are
+ * received, without going through the receive buffer pools and without
+ * flow control pauses, as the sender is granted the whole message at once.
+ * Data that is already queued or being received when this function is
+ * called is returned as isotp_recv() would.
+ * The buffer must stay valid until the function returns.
+ *
+ * @note Requires CONFIG_ISOTP_RX_DIRECT.
+ *
+ * @param rctx    Context that is already bound.
+ * @param data    Pointer to a buffer where the message is written to.
+ * @param len     Size of the buffer.
+ * @param timeout Timeout for the beginning of the message.
+ *
+ * @retval Number of bytes received on success
+ * @retval ISOTP_RECV_TIMEOUT when "timeout" timed out
+ * @retval ISOTP_N_BUFFER_OVERFLW if the message does not fit in @p data
+ * @retval ISOTP_N_* on error
+ */
+int isotp_recv_direct(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len,
+		      k_timeout_t timeout);
+
 /**
  * @brief Send data
  *
@@ -468,6 +493,16 @@ struct isotp_recv_ctx {
 	uint8_t bs;
 	uint8_t wft;
 	uint8_t sn_expected : 4;
+#ifdef CONFIG_ISOTP_RX_DIRECT
+	/* user buffer of isotp_recv_direct */
+	struct k_spinlock direct_lock;
+	struct k_sem direct_sem;
+	uint8_t *direct_buf;
+	size_t direct_size;
+	size_t direct_len;
+	int direct_ret;
+	bool direct_active;
+#endif
 };
 
 /** @endcond */
@@ -0,0 +1,371 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Polymorphic memory resources backed by kernel allocators
+ *
+ * These let C++17 @c std::pmr containers allocate from a dedicated
+ * @c k_heap, @c k_mem_slab or @c sys_mem_blocks pool, or from a fixed
+ * arena, instead of going through the global @c operator @c new and the
+ * system heap lock.
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+#define ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+
+#if __cplusplus < 201703L
+#error "Polymorphic memory resources require C++17 or later"
+#endif
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mem_blocks.h>
+
+/**
+ * @brief C++ polymorphic memory resources
+ * @defgroup cpp_memory_resource C++ memory resources
+ * @ingroup memory_management
+ * @{
+ */
+
+namespace zephyr::pmr
+{
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail
+{
+
+[[noreturn]] inline void bad_alloc()
+{
+#if defined(__cpp_exceptions)
+	throw std::bad_alloc();
+#else
+	k_panic();
+	CODE_UNREACHABLE;
+#endif
+}
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Memory resource allocating from a @c k_heap
+ *
+ * Allocations never block. A failing allocation throws @c std::bad_alloc, or
+ * panics when built without exceptions, as @c std::pmr containers expect.
+ */
+class heap_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param heap Heap to allocate from, e.g. defined with K_HEAP_DEFINE()
+	 */
+	explicit heap_resource(struct k_heap *heap) noexcept : heap_(heap)
+	{
+	}
+
+	/** @return The heap allocated from */
+	struct k_heap *heap() const noexcept
+	{
+		return heap_;
+	}
+
+protected:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		void *ptr = k_heap_aligned_alloc(heap_, alignment, bytes, K_NO_WAIT);
+
+		if (ptr == nullptr) {
+			detail::bad_alloc();
+		}
+
+		return ptr;
+	}
+
+	void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+	{
+		ARG_UNUSED(bytes);
+		ARG_UNUSED(alignment);
+
+		k_heap_free(heap_, ptr);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+private:
+	struct k_heap *heap_;
+};
+
+/**
+ * @brief Memory resource allocating fixed-size blocks from a @c k_mem_slab
+ *
+ * Suited to node based containers, such as @c std::pmr::list or
+ * @c std::pmr::unordered_map, whose nodes all fit in a slab block. Requests
+ * larger than a block, more aligned than the slab, or made while the slab is
+ * exhausted go to an upstream resource.
+ */
+class slab_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param slab Slab to allocate from, e.g. defined with K_MEM_SLAB_DEFINE()
+	 * @param align Alignment of the slab blocks
+	 * @param upstream Resource for the requests the slab cannot serve
+	 */
+	slab_resource(struct k_mem_slab *slab, std::size_t align,
+		      std::pmr::memory_resource *upstream = std::pmr::null_memory_resource()) noexcept
+		: slab_(slab), align_(align), upstream_(upstream)
+	{
+	}
+
+	/** @return The upstream resource */
+	std::pmr::memory_resource *upstream_resource() const noexcept
+	{
+		return upstream_;
+	}
+
+protected:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		void *ptr;
+
+		if (bytes <= slab_->info.block_size && alignment <= align_ &&
+		    k_mem_slab_alloc(slab_, &ptr, K_NO_WAIT) == 0) {
+			return ptr;
+		}
+
+		return upstream_->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+	{
+		if (owns(ptr)) {
+			k_mem_slab_free(slab_, ptr);
+		} else {
+			upstream_->deallocate(ptr, bytes, alignment);
+		}
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+private:
+	bool owns(const void *ptr) const noexcept
+	{
+		const char *p = static_cast<const char *>(ptr);
+
+		return p >= slab_->buffer &&
+		       p < slab_->buffer + slab_->info.num_blocks * slab_->info.block_size;
+	}
+
+	struct k_mem_slab *slab_;
+	std::size_t align_;
+	std::pmr::memory_resource *upstream_;
+};
+
+#if defined(CONFIG_SYS_MEM_BLOCKS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Memory resource allocating from a @c sys_mem_blocks pool
+ *
+ * Each request takes enough contiguous blocks to hold it. Blocks are aligned
+ * on their size, so requests more aligned than that go upstream, as do the
+ * ones the pool cannot serve.
+ *
+ * Requires @kconfig{CONFIG_SYS_MEM_BLOCKS}.
+ */
+class mem_blocks_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param blocks Pool to allocate from, e.g. defined with SYS_MEM_BLOCKS_DEFINE()
+	 * @param upstream Resource for the requests the pool cannot serve
+	 */
+	explicit mem_blocks_resource(
+		sys_mem_blocks_t *blocks,
+		std::pmr::memory_resource *upstream = std::pmr::null_memory_resource()) noexcept
+		: blocks_(blocks), upstream_(upstream)
+	{
+	}
+
+	/** @return The upstream resource */
+	std::pmr::memory_resource *upstream_resource() const noexcept
+	{
+		return upstream_;
+	}
+
+protected:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		void *ptr;
+
+		if (alignment <= block_size() &&
+		    sys_mem_blocks_alloc_contiguous(blocks_, count(bytes), &ptr) == 0) {
+			return ptr;
+		}
+
+		return upstream_->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+	{
+		if (owns(ptr)) {
+			(void)sys_mem_blocks_free_contiguous(blocks_, ptr, count(bytes));
+		} else {
+			upstream_->deallocate(ptr, bytes, alignment);
+		}
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+private:
+	std::size_t block_size() const noexcept
+	{
+		return std::size_t{1} << blocks_->info.blk_sz_shift;
+	}
+
+	std::size_t count(std::size_t bytes) const noexcept
+	{
+		return bytes == 0 ? 1 : ((bytes - 1) >> blocks_->info.blk_sz_shift) + 1;
+	}
+
+	bool owns(const void *ptr) const noexcept
+	{
+		const uint8_t *p = static_cast<const uint8_t *>(ptr);
+
+		return p >= blocks_->buffer &&
+		       p < blocks_->buffer +
+				   (std::size_t{blocks_->info.num_blocks} << blocks_->info.blk_sz_shift);
+	}
+
+	sys_mem_blocks_t *blocks_;
+	std::pmr::memory_resource *upstream_;
+};
+
+#endif /* CONFIG_SYS_MEM_BLOCKS || __DOXYGEN__ */
+
+/**
+ * @brief Monotonic arena resource with inline storage
+ *
+ * A @c std::pmr::monotonic_buffer_resource over a buffer of @p Size bytes
+ * held in the object itself, e.g. on the stack of a thread or in a static
+ * object. Deallocation is a no-op, the whole arena is released at once by
+ * @c release() or on destruction. Once the buffer is used up, further
+ * allocations go to the upstream resource, which fails them by default.
+ *
+ * @tparam Size Size of the arena, in bytes
+ */
+template <std::size_t Size>
+class arena_resource : public std::pmr::monotonic_buffer_resource {
+public:
+	/**
+	 * @param upstream Resource to fall back to once the arena is used up
+	 */
+	explicit arena_resource(
+		std::pmr::memory_resource *upstream = std::pmr::null_memory_resource()) noexcept
+		: std::pmr::monotonic_buffer_resource(buffer_, Size, upstream)
+	{
+	}
+
+	arena_resource(const arena_resource &) = delete;
+	arena_resource &operator=(const arena_resource &) = delete;
+
+private:
+	alignas(std::max_align_t) std::byte buffer_[Size];
+};
+
+#if defined(CONFIG_THREAD_LOCAL_STORAGE) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail
+{
+inline thread_local std::pmr::memory_resource *thread_resource;
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Get the default resource of the calling thread
+ *
+ * Requires @kconfig{CONFIG_THREAD_LOCAL_STORAGE}.
+ *
+ * @return The resource set with set_thread_resource(), or
+ *         @c std::pmr::get_default_resource() if none is set
+ */
+inline std::pmr::memory_resource *get_thread_resource() noexcept
+{
+	std::pmr::memory_resource *res = detail::thread_resource;
+
+	return res != nullptr ? res : std::pmr::get_default_resource();
+}
+
+/**
+ * @brief Set the default resource of the calling thread
+ *
+ * Unlike @c std::pmr::set_default_resource(), this only affects the calling
+ * thread. Containers pick it up when constructed with get_thread_resource()
+ * or a @c std::pmr::polymorphic_allocator built from it, and then keep using
+ * it from any thread.
+ *
+ * Requires @kconfig{CONFIG_THREAD_LOCAL_STORAGE}.
+ *
+ * @param res New default resource, or @c nullptr to follow the global one
+ *
+ * @return The previous default resource of the thread, @c nullptr if none
+ */
+inline std::pmr::memory_resource *set_thread_resource(std::pmr::memory_resource *res) noexcept
+{
+	std::pmr::memory_resource *prev = detail::thread_resource;
+
+	detail::thread_resource = res;
+
+	return prev;
+}
+
+/**
+ * @brief Scoped override of the default resource of the calling thread
+ *
+ * Requires @kconfig{CONFIG_THREAD_LOCAL_STORAGE}.
+ */
+class scoped_thread_resource {
+public:
+	/**
+	 * @param res Default resource of the thread until the end of the scope
+	 */
+	explicit scoped_thread_resource(std::pmr::memory_resource *res) noexcept
+		: prev_(set_thread_resource(res))
+	{
+	}
+
+	~scoped_thread_resource()
+	{
+		set_thread_resource(prev_);
+	}
+
+	scoped_thread_resource(const scoped_thread_resource &) = delete;
+	scoped_thread_resource &operator=(const scoped_thread_resource &) = delete;
+
+private:
+	std::pmr::memory_resource *prev_;
+};
+
+#endif /* CONFIG_THREAD_LOCAL_STORAGE || __DOXYGEN__ */
+
+} /* namespace zephyr::pmr */
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_ */
@@ -42,6 +42,19 @@ extern "C" {
  */
 int cpu_freq_pstate_set(const struct pstate *state);
 
+/**
+ * @brief Raise the current CPU to its highest performance state.
+ *
+ * The performance state is kept for CONFIG_CPU_FREQ_SCHEDUTIL_BOOST_MS
+ * whatever the utilization of the CPU. Meant to be called when
+ * latency-sensitive work is about to run, for example by the ISR waking up
+ * the thread which handles a request, instead of waiting for the next
+ * evaluation of the policy.
+ *
+ * @note Requires CONFIG_CPU_FREQ_POLICY_SCHEDUTIL.
+ */
+void cpu_freq_boost(void);
+
 /**
  * @}
  */
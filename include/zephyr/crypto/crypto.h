@@ -64,6 +64,8 @@
 
 /* More flags to be added as necessary */
 
+struct rtio_iodev_sqe;
+
 /** @brief Crypto driver API definition. */
 __subsystem struct crypto_driver_api {
 	int (*query_hw_caps)(const struct device *dev);
@@ -88,6 +90,10 @@ __subsystem struct crypto_driver_api {
 	/* Register async hash op completion callback with the driver */
 	int (*hash_async_callback_set)(const struct device *dev,
 					 hash_completion_cb cb);
+#if defined(CONFIG_CRYPTO_RTIO) || defined(__DOXYGEN__)
+	/* Process a transaction of crypto RTIO requests, see crypto/rtio.h */
+	void (*submit)(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
+#endif /* CONFIG_CRYPTO_RTIO */
 };
 
 /* Following are the public API a user app may call.
@@ -0,0 +1,141 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Asynchronous crypto operations over RTIO
+ */
+
+#ifndef ZEPHYR_INCLUDE_CRYPTO_RTIO_H_
+#define ZEPHYR_INCLUDE_CRYPTO_RTIO_H_
+
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Crypto RTIO APIs
+ * @defgroup crypto_rtio Crypto RTIO
+ * @ingroup crypto
+ * @{
+ */
+
+/** @brief Crypto operation carried by a submission */
+enum crypto_rtio_op {
+	/** ECB, CBC or CTR operation, depending on the session mode */
+	CRYPTO_RTIO_OP_CIPHER,
+	/** CCM or GCM operation, depending on the session mode */
+	CRYPTO_RTIO_OP_AEAD,
+	/** Hash update */
+	CRYPTO_RTIO_OP_HASH_UPDATE,
+	/** Hash computation, finishing the session */
+	CRYPTO_RTIO_OP_HASH_COMPUTE,
+};
+
+/**
+ * @brief Crypto request
+ *
+ * Describes one operation on an established session. The request and what it
+ * points to must remain valid until its completion is reaped.
+ */
+struct crypto_rtio_req {
+	/** Operation to perform */
+	enum crypto_rtio_op op;
+	union {
+		/** Arguments of @ref CRYPTO_RTIO_OP_CIPHER */
+		struct {
+			struct cipher_ctx *ctx;
+			struct cipher_pkt *pkt;
+			/** IV for CBC, IV and counter for CTR, unused for ECB */
+			uint8_t *iv;
+		} cipher;
+		/** Arguments of @ref CRYPTO_RTIO_OP_AEAD */
+		struct {
+			struct cipher_ctx *ctx;
+			struct cipher_aead_pkt *pkt;
+			uint8_t *nonce;
+		} aead;
+		/** Arguments of @ref CRYPTO_RTIO_OP_HASH_UPDATE and @ref CRYPTO_RTIO_OP_HASH_COMPUTE */
+		struct {
+			struct hash_ctx *ctx;
+			struct hash_pkt *pkt;
+		} hash;
+	};
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api crypto_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an iodev to submit crypto requests to
+ *
+ * Requests of a transaction are handed to the crypto driver of the first one
+ * at once, so that a driver implementing @c submit can process them as a
+ * single batch, e.g. as one DMA descriptor chain. Other drivers run them one
+ * after the other, with their synchronous API, from the RTIO work queue.
+ *
+ * Requests of one iodev are processed in order with
+ * @kconfig{CONFIG_RTIO_WORKQ_PER_IODEV}. Otherwise, requests depending on each
+ * other, such as the updates of a hash, must be chained or part of a single
+ * transaction.
+ *
+ * @param name Name of the iodev
+ */
+#define CRYPTO_IODEV_DEFINE(name) RTIO_IODEV_DEFINE(name, &crypto_iodev_api, NULL)
+
+/**
+ * @brief Prepare a crypto request submission
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Iodev defined with CRYPTO_IODEV_DEFINE()
+ * @param req Request to submit
+ * @param userdata User data given back in the completion
+ */
+static inline void crypto_rtio_prep(struct rtio_sqe *sqe, const struct rtio_iodev *iodev,
+				    struct crypto_rtio_req *req, void *userdata)
+{
+	rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, (const uint8_t *)req, sizeof(*req),
+			    userdata);
+}
+
+/**
+ * @brief Request carried by a crypto submission
+ *
+ * For drivers implementing @c submit.
+ *
+ * @param iodev_sqe Submission
+ *
+ * @return The request
+ */
+static inline struct crypto_rtio_req *crypto_rtio_req_get(const struct rtio_iodev_sqe *iodev_sqe)
+{
+	return (struct crypto_rtio_req *)iodev_sqe->sqe.tx.buf;
+}
+
+/**
+ * @brief Run a crypto request with the synchronous API of its driver
+ *
+ * @param req Request
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the operation does not match the session mode
+ * @retval -errno Other negative errno, result of the driver
+ */
+int crypto_rtio_req_exec(struct crypto_rtio_req *req);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_CRYPTO_RTIO_H_ */
@@ -80,6 +80,40 @@ struct json_obj_token {
 	size_t length;
 };
 
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+struct json_stream_frame {
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *base;
+	void *parent;
+	size_t *elements;
+	const struct json_obj_descr *field;
+	int64_t decoded;
+	size_t next_field;
+	uint8_t expect;
+};
+
+/**
+ * @brief State of an incremental JSON object parser
+ *
+ * Set up with json_stream_obj_parse_init(), its fields are internal.
+ */
+struct json_stream {
+	/** @cond INTERNAL_HIDDEN */
+	char *buf;
+	size_t buf_size;
+	size_t len;
+	int64_t result;
+	uint32_t skip_depth;
+	uint8_t lex_state;
+	uint8_t hex_left;
+	bool discard;
+	uint8_t depth;
+	struct json_stream_frame frames[CONFIG_JSON_LIBRARY_STREAM_DEPTH];
+	/** @endcond */
+};
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 
 struct json_obj_descr {
 	const char *field_name;
@@ -700,6 +734,57 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Initialize an incremental parser for a JSON object.
+ *
+ * The object then gets decoded as it is fed, chunk by chunk, to
+ * json_stream_obj_parse() according to the descriptor pointed to by
+ * @a descr, without ever needing the whole document in memory.
+ *
+ * Only one token, a key or the value of a decoded field, has to be held
+ * at a time, in the buffer given here. String values that are skipped
+ * do not need to fit. As data does not stay around, fields of type
+ * JSON_TOK_STRING, JSON_TOK_OPAQUE, JSON_TOK_FLOAT, JSON_TOK_OBJ_ARRAY and
+ * JSON_TOK_ENCODED_OBJ, which point into the document, cannot be decoded.
+ * Use JSON_TOK_STRING_BUF for strings.
+ *
+ * @param stream Parser state
+ * @param buf Buffer holding the token being parsed
+ * @param buf_size Size of @a buf, one more than the longest token
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be less
+ * than 63 due to implementation detail reasons (if more fields are
+ * necessary, use two descriptors)
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_stream_obj_parse_init(struct json_stream *stream, char *buf, size_t buf_size,
+				const struct json_obj_descr *descr, size_t descr_len,
+				void *val);
+
+/**
+ * @brief Feed the next chunk of a JSON object to an incremental parser.
+ *
+ * Whatever follows the end of the object is ignored, and once the object is
+ * complete or an error occurred, further calls return the same value.
+ *
+ * @param stream Parser state set up with json_stream_obj_parse_init()
+ * @param data Next chunk of JSON-encoded data
+ * @param len Length of @a data
+ *
+ * @retval -EAGAIN if the object is not complete yet.
+ * @retval -ENOSPC if a token does not fit in the parser buffer or an array in
+ * its field.
+ * @retval -ENOMEM if objects and arrays are nested deeper than
+ * CONFIG_JSON_LIBRARY_STREAM_DEPTH.
+ * @retval -ENOTSUP if a field of a type that cannot be streamed is found.
+ * @retval -EINVAL on other errors.
+ * @return bitmap of decoded fields once the object is complete, as returned
+ * by json_obj_parse().
+ */
+int64_t json_stream_obj_parse(struct json_stream *stream, const char *data, size_t len);
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -0,0 +1,103 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Boot timeline of the initialization entries
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_TIMELINE_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_TIMELINE_H_
+
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup boot_timeline Boot timeline
+ * @ingroup debugging
+ * @{
+ */
+
+/** Value of @ref boot_timeline.magic, the characters "BTLN" */
+#define BOOT_TIMELINE_MAGIC 0x4e4c5442U
+
+/** Level of device initializations done by device_init() after boot */
+#define BOOT_TIMELINE_LEVEL_RUNTIME 0xFFU
+
+struct device;
+
+/**
+ * @brief Timing of one initialization
+ */
+struct boot_timeline_entry {
+	/** Device initialized, or NULL for a SYS_INIT() function */
+	const struct device *dev;
+
+	/** Function called for a SYS_INIT() entry, NULL for a device */
+	int (*init_fn)(void);
+
+	/** Hardware cycle count when the initialization started */
+	uint32_t start;
+
+	/** Hardware cycle count when the initialization returned */
+	uint32_t end;
+
+	/** Value returned by the initialization */
+	int16_t result;
+
+	/** Initialization level, or @ref BOOT_TIMELINE_LEVEL_RUNTIME */
+	uint8_t level;
+};
+
+/**
+ * @brief Boot timeline
+ *
+ * The timeline is kept in the global @c boot_timeline symbol, so it can
+ * also be read by a debugger or from a memory dump, where the magic value
+ * tells it has been set up.
+ */
+struct boot_timeline {
+	/** @ref BOOT_TIMELINE_MAGIC once recording has started */
+	uint32_t magic;
+
+	/** Frequency of the hardware cycle counter */
+	uint32_t cycles_per_sec;
+
+	/** Hardware cycle count when main() was called */
+	uint32_t main_cycles;
+
+	/** Number of entries in @ref boot_timeline.entries */
+	uint32_t capacity;
+
+	/** Number of recorded initializations, including the dropped ones */
+	atomic_t count;
+
+	/** Recorded initializations, in the order they returned */
+	struct boot_timeline_entry entries[CONFIG_BOOT_TIMELINE_ENTRIES];
+};
+
+/**
+ * @brief Get the boot timeline
+ *
+ * Hardware cycle counts are those of k_cycle_get_32(). Entries that ran
+ * before the system timer driver was initialized may read 0 on platforms
+ * whose counter only starts then.
+ *
+ * @return Pointer to the boot timeline
+ */
+const struct boot_timeline *boot_timeline_get(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_TIMELINE_H_ */
@@ -152,6 +152,9 @@ struct coredump_cmd_copy_arg {
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
 
+#define	COREDUMP_COMPRESSED_MEM_HDR_ID	'C'
+#define COREDUMP_COMPRESSED_MEM_HDR_VER	1
+
 /* Target code */
 enum coredump_tgt_code {
 	COREDUMP_TGT_UNKNOWN = 0,
@@ -222,6 +225,24 @@ struct coredump_mem_hdr_t {
 	uintptr_t	end;
 } __packed;
 
+/* Compressed memory block header */
+struct coredump_compressed_mem_hdr_t {
+	/* COREDUMP_COMPRESSED_MEM_HDR_ID */
+	char		id;
+
+	/* Header version */
+	uint16_t	hdr_version;
+
+	/* Address of start of memory region */
+	uintptr_t	start;
+
+	/* Address of end of memory region */
+	uintptr_t	end;
+
+	/* Number of bytes of LZ4 block data following this header */
+	uint32_t	num_bytes;
+} __packed;
+
 typedef void (*coredump_backend_start_t)(void);
 typedef void (*coredump_backend_end_t)(void);
 typedef void (*coredump_backend_buffer_output_t)(uint8_t *buf, size_t buflen);
@@ -98,6 +98,10 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_ACCESS_CACHE) || defined(__DOXYGEN__)
+	/** Internally used state of the disk access cache */
+	uint8_t cache_state;
+#endif
 };
 
 /**
@@ -302,6 +302,17 @@ struct dma_context {
 	atomic_t *atomic;
 };
 
+/**
+ * Prepared DMA transfer
+ *
+ * Handle of a transfer whose descriptors were built once by dma_prepare().
+ * Drivers embed it in the entries of a descriptor pool of their own.
+ */
+struct dma_prepared {
+	/** Channel the transfer was prepared for */
+	uint32_t channel;
+};
+
 /** Magic code to identify context content */
 #define DMA_MAGIC 0x47494749
 
@@ -365,6 +376,21 @@ typedef bool (*dma_api_chan_filter)(const struct device *dev,
 typedef void (*dma_api_chan_release)(const struct device *dev,
 				     uint32_t channel);
 
+typedef int (*dma_api_prepare)(const struct device *dev, uint32_t channel,
+			       struct dma_config *config, struct dma_prepared **xfer);
+
+typedef int (*dma_api_prepared_start)(const struct device *dev, struct dma_prepared *xfer);
+
+#ifdef CONFIG_DMA_64BIT
+typedef int (*dma_api_prepared_update)(const struct device *dev, struct dma_prepared *xfer,
+				       uint32_t block, uint64_t src, uint64_t dst, size_t size);
+#else
+typedef int (*dma_api_prepared_update)(const struct device *dev, struct dma_prepared *xfer,
+				       uint32_t block, uint32_t src, uint32_t dst, size_t size);
+#endif
+
+typedef void (*dma_api_prepared_release)(const struct device *dev, struct dma_prepared *xfer);
+
 __subsystem struct dma_driver_api {
 	dma_api_config config;
 	dma_api_reload reload;
@@ -376,6 +402,12 @@ __subsystem struct dma_driver_api {
 	dma_api_get_attribute get_attribute;
 	dma_api_chan_filter chan_filter;
 	dma_api_chan_release chan_release;
+#if defined(CONFIG_DMA_PREPARED) || defined(__DOXYGEN__)
+	dma_api_prepare prepare;
+	dma_api_prepared_start prepared_start;
+	dma_api_prepared_update prepared_update;
+	dma_api_prepared_release prepared_release;
+#endif
 };
 /**
  * @endcond
@@ -696,6 +728,128 @@ static inline int dma_get_attribute(const struct device *dev, uint32_t type, uin
 	return -ENOSYS;
 }
 
+/**
+ * @brief Prepare a transfer to start it repeatedly
+ *
+ * Builds the hardware descriptors of @p config once, in a descriptor pool of
+ * the driver, so that the transfer can be started again and again with
+ * dma_prepared_start() without translating the block chain each time. The
+ * configuration and its blocks are not referenced after the call.
+ *
+ * Requires @kconfig{CONFIG_DMA_PREPARED}.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to run the transfer on
+ * @param config  Transfer configuration, as given to dma_config()
+ * @param xfer    Set to the prepared transfer
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if not implemented by the driver.
+ * @retval -ENOMEM if the descriptor pool of the driver is exhausted.
+ * @retval -EINVAL if the configuration is invalid.
+ */
+static inline int dma_prepare(const struct device *dev, uint32_t channel,
+			      struct dma_config *config, struct dma_prepared **xfer)
+{
+#ifdef CONFIG_DMA_PREPARED
+	const struct dma_driver_api *api = (const struct dma_driver_api *)dev->api;
+
+	if (api->prepare) {
+		return api->prepare(dev, channel, config, xfer);
+	}
+#endif
+
+	return -ENOSYS;
+}
+
+/**
+ * @brief Start a prepared transfer
+ *
+ * Loads the descriptors of @p xfer in its channel and starts it, as
+ * dma_config() followed by dma_start() would. The channel must not be running.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dev  Pointer to the device structure for the driver instance.
+ * @param xfer Prepared transfer
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if not implemented by the driver.
+ * @retval -EBUSY if the channel is running.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_prepared_start(const struct device *dev, struct dma_prepared *xfer)
+{
+#ifdef CONFIG_DMA_PREPARED
+	const struct dma_driver_api *api = (const struct dma_driver_api *)dev->api;
+
+	if (api->prepared_start) {
+		return api->prepared_start(dev, xfer);
+	}
+#endif
+
+	return -ENOSYS;
+}
+
+/**
+ * @brief Update the addresses and size of a block of a prepared transfer
+ *
+ * Patches the descriptor of one block in place, e.g. to point a transfer at
+ * the next buffer of a queue. The transfer must not be running.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dev   Pointer to the device structure for the driver instance.
+ * @param xfer  Prepared transfer
+ * @param block Index of the block in the chain given to dma_prepare()
+ * @param src   source address of the block
+ * @param dst   destination address of the block
+ * @param size  size of the block
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if not implemented by the driver.
+ * @retval -EINVAL if @p block is out of range.
+ * @retval -EBUSY if the transfer is running.
+ */
+#ifdef CONFIG_DMA_64BIT
+static inline int dma_prepared_update(const struct device *dev, struct dma_prepared *xfer,
+				      uint32_t block, uint64_t src, uint64_t dst, size_t size)
+#else
+static inline int dma_prepared_update(const struct device *dev, struct dma_prepared *xfer,
+				      uint32_t block, uint32_t src, uint32_t dst, size_t size)
+#endif
+{
+#ifdef CONFIG_DMA_PREPARED
+	const struct dma_driver_api *api = (const struct dma_driver_api *)dev->api;
+
+	if (api->prepared_update) {
+		return api->prepared_update(dev, xfer, block, src, dst, size);
+	}
+#endif
+
+	return -ENOSYS;
+}
+
+/**
+ * @brief Release a prepared transfer
+ *
+ * Gives the descriptors of @p xfer back to the pool of the driver. The
+ * transfer must not be running.
+ *
+ * @param dev  Pointer to the device structure for the driver instance.
+ * @param xfer Prepared transfer
+ */
+static inline void dma_prepared_release(const struct device *dev, struct dma_prepared *xfer)
+{
+#ifdef CONFIG_DMA_PREPARED
+	const struct dma_driver_api *api = (const struct dma_driver_api *)dev->api;
+
+	if (api->prepared_release) {
+		api->prepared_release(dev, xfer);
+	}
+#endif
+}
+
 /**
  * @brief Look-up generic width index to be used in registers
  *
@@ -27,6 +27,9 @@
 #include <stddef.h>
 #include <sys/types.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_FLASH_ASYNC
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -721,6 +724,104 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+
+struct flash_async_op;
+
+/**
+ * @brief Callback invoked when an asynchronous flash operation completes.
+ *
+ * The callback is invoked from the flash async thread. It may submit a new
+ * operation with @p op.
+ *
+ * @param op Completed operation.
+ * @param result 0 on success, negative errno code on fail.
+ */
+typedef void (*flash_async_callback_t)(struct flash_async_op *op, int result);
+
+/**
+ * @brief Asynchronous flash operation.
+ *
+ * Initialize with flash_async_op_init() before first use. The operation must
+ * not be modified between its submission and the invocation of its callback.
+ */
+struct flash_async_op {
+	/** User data, not used by the flash async thread. */
+	void *user_data;
+	/** @cond INTERNAL_HIDDEN */
+	flash_async_callback_t callback;
+	struct k_work work;
+	const struct device *dev;
+	off_t offset;
+	void *data;
+	size_t len;
+	uint8_t type;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize an asynchronous flash operation.
+ *
+ * @param op Operation to initialize.
+ * @param callback Invoked when an operation submitted with @p op completes.
+ * @param user_data Stored in @a flash_async_op.user_data.
+ */
+void flash_async_op_init(struct flash_async_op *op, flash_async_callback_t callback,
+			 void *user_data);
+
+/**
+ * @brief Read data from flash without blocking the caller.
+ *
+ * The read is done as flash_read() would, by the flash async thread. While
+ * the driver waits for the device, other threads can run.
+ *
+ * @param dev Flash device.
+ * @param offset Offset to read.
+ * @param data Buffer to store read data, valid until the callback of @p op.
+ * @param len Number of bytes to read.
+ * @param op Operation, initialized with flash_async_op_init().
+ *
+ * @retval 0 if the read was submitted.
+ * @retval -EBUSY if @p op is already submitted.
+ */
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_op *op);
+
+/**
+ * @brief Write data to flash without blocking the caller.
+ *
+ * The write is done as flash_write() would, by the flash async thread.
+ *
+ * @param dev Flash device.
+ * @param offset Starting offset for the write.
+ * @param data Data to write, valid until the callback of @p op.
+ * @param len Number of bytes to write.
+ * @param op Operation, initialized with flash_async_op_init().
+ *
+ * @retval 0 if the write was submitted.
+ * @retval -EBUSY if @p op is already submitted.
+ */
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op);
+
+/**
+ * @brief Erase part or all of a flash memory without blocking the caller.
+ *
+ * The erase is done as flash_erase() would, by the flash async thread.
+ *
+ * @param dev Flash device.
+ * @param offset Erase area starting offset.
+ * @param size Size of area to be erased.
+ * @param op Operation, initialized with flash_async_op_init().
+ *
+ * @retval 0 if the erase was submitted.
+ * @retval -EBUSY if @p op is already submitted.
+ */
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op);
+
+#endif /* CONFIG_FLASH_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
@@ -507,6 +507,48 @@ static inline int i2s_write(const struct device *dev, void *mem_block,
  */
 __syscall int i2s_buf_write(const struct device *dev, void *buf, size_t size);
 
+/**
+ * @brief Callback processing an audio block in place.
+ *
+ * @param mem_block Pointer to the memory block containing the samples.
+ * @param size Number of bytes of valid data in the memory block.
+ * @param user_data User data passed to i2s_relay().
+ */
+typedef void (*i2s_block_process_t)(void *mem_block, size_t size, void *user_data);
+
+/**
+ * @brief Forward a received block to a TX queue.
+ *
+ * Read a block from the RX queue of @p rx_dev, process it in place with
+ * @p process and write it to the TX queue of @p tx_dev, so that received audio
+ * is played back with a latency bounded by the queued blocks and the
+ * processing time.
+ *
+ * If both streams are configured with the same memory slab, ownership of the
+ * received block is passed on to the TX queue and no data is copied.
+ * Otherwise the block is copied into a block allocated from the TX memory
+ * slab.
+ *
+ * This function blocks as i2s_read() and i2s_write() do and is not available
+ * from user mode.
+ *
+ * @param rx_dev Pointer to the device structure of the receiving interface.
+ * @param tx_dev Pointer to the device structure of the transmitting interface,
+ *        which may be the same as @p rx_dev.
+ * @param process Callback processing the received block, or NULL.
+ * @param user_data User data passed to @p process.
+ *
+ * @retval 0 If successful.
+ * @retval -EIO One of the streams is not configured or the interface is not in
+ *         a state allowing the transfer.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOMEM No memory in TX slab queue.
+ * @retval -EINVAL Received block larger than TX queue memory block.
+ */
+int i2s_relay(const struct device *rx_dev, const struct device *tx_dev,
+	      i2s_block_process_t process, void *user_data);
+
 /**
  * @brief Send a trigger command.
  *
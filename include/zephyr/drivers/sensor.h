@@ -551,6 +551,26 @@ struct sensor_decoder_api {
 	 * @return Whether the trigger is present in the buffer
 	 */
 	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode up to @p max_count frames of a three axis channel in one call
+	 *
+	 * Optional, for decoders of sensors with a FIFO. Same as @ref decode, but the frames
+	 * are stored as arrays per axis. Used by sensor_decode_batch(), which falls back to
+	 * @ref decode when this is not implemented or returns -ENOTSUP.
+	 *
+	 * @param[in]     buffer      Buffer provided on the RTIO context
+	 * @param[in]     chan_spec   Three axis channel specification to decode
+	 * @param[in,out] fit         Current frame iterator
+	 * @param[in]     max_count   Maximum number of frames to decode
+	 * @param[out]    out         Decoded data
+	 *
+	 * @return Number of frames that were decoded
+	 * @retval -ENOTSUP  Not supported for this channel or buffer, @p fit is unchanged
+	 */
+	int (*decode_batch)(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+			    uint32_t *fit, uint16_t max_count,
+			    struct sensor_three_axis_batch *out);
 };
 
 /**
@@ -608,6 +628,39 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 	return ctx->decoder->decode(ctx->buffer, ctx->channel, &ctx->fit, max_count, out);
 }
 
+/**
+ * @brief Decode up to @p max_count frames of a three axis channel in one call
+ *
+ * Decodes a whole FIFO buffer into per axis arrays, e.g. to process them with
+ * vector DSP functions, without the per frame overhead of repeated
+ * sensor_decode() calls. Decoders without a batch implementation are called
+ * through @ref sensor_decoder_api.decode in chunks.
+ *
+ * @code{.c}
+ * static uint32_t ts[32];
+ * static q31_t x[32], y[32], z[32];
+ * struct sensor_three_axis_batch batch = {
+ *     .timestamp_delta = ts, .x = x, .y = y, .z = z,
+ * };
+ * uint32_t fit = 0;
+ *
+ * n = sensor_decode_batch(decoder, buf, (struct sensor_chan_spec){SENSOR_CHAN_ACCEL_XYZ, 0},
+ *                         &fit, 32, &batch);
+ * @endcode
+ *
+ * @param[in]     decoder   Decoder of the sensor
+ * @param[in]     buffer    Buffer provided on the RTIO context
+ * @param[in]     chan_spec Three axis channel specification to decode
+ * @param[in,out] fit       Current frame iterator
+ * @param[in]     max_count Maximum number of frames to decode
+ * @param[out]    out       Decoded data, with arrays of at least @p max_count entries
+ *
+ * @return Number of frames that were decoded, or a negative error code from the decoder
+ */
+int sensor_decode_batch(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			struct sensor_chan_spec chan_spec, uint32_t *fit, uint16_t max_count,
+			struct sensor_three_axis_batch *out);
+
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
@@ -74,6 +74,30 @@ struct sensor_three_axis_data {
 		PRIq_arg((data_).readings[(readings_offset_)].y, 6, (data_).shift),                \
 		PRIq_arg((data_).readings[(readings_offset_)].z, 6, (data_).shift)
 
+/**
+ * Frames of a three axis channel stored as a structure of arrays, as filled by
+ * :c:func:`sensor_decode_batch`. The arrays are provided by the caller and must
+ * be large enough for the number of frames requested.
+ */
+struct sensor_three_axis_batch {
+	/** Timestamp the deltas of the frames are relative to */
+	uint64_t base_timestamp_ns;
+	/** Shift shared by the values of all the frames */
+	int8_t shift;
+	/** Timestamp delta of each frame */
+	uint32_t *timestamp_delta;
+	/** Values of each axis, one entry per frame */
+	union {
+		q31_t *values[3];
+		q31_t *v[3];
+		struct {
+			q31_t *x;
+			q31_t *y;
+			q31_t *z;
+		};
+	};
+};
+
 /**
  * Data for a sensor channel which reports game rotation vector data. This is used by:
  * - :c:enum:`SENSOR_CHAN_GAME_ROTATION_VECTOR`
@@ -59,6 +59,38 @@ int spi_rtio_copy(struct rtio *r,
 		  const struct spi_buf_set *rx_bufs,
 		  struct rtio_sqe **last_sqe);
 
+struct dma_block_config;
+
+/**
+ * @brief Describe a SPI RTIO transaction as linked DMA blocks
+ *
+ * Each submission of the transaction starting at @p txn_head is turned into
+ * a block moving its transmit buffer to the transmit data register, and a
+ * block moving the receive data register to its receive buffer, the blocks of
+ * the whole transaction linked with next_block. The transaction then runs as
+ * a single DMA program per direction, for controllers driving chip select
+ * from a single transfer. Missing buffers are replaced by @p tx_nop and
+ * @p rx_sink, which splits the transfers longer than @p nop_len.
+ *
+ * @param[in] txn_head First submission of the transaction
+ * @param[in] tx_reg Address of the transmit data register
+ * @param[in] rx_reg Address of the receive data register
+ * @param[in] tx_nop Bytes to transmit when there is no transmit buffer
+ * @param[in] rx_sink Where to receive when there is no receive buffer
+ * @param[in] nop_len Length of @p tx_nop and @p rx_sink
+ * @param[out] tx_blocks Transmit blocks
+ * @param[out] rx_blocks Receive blocks
+ * @param[in] max_blocks Number of blocks in each of @p tx_blocks and @p rx_blocks
+ *
+ * @retval Number of blocks in each direction
+ * @retval -ENOMEM more than @p max_blocks blocks are needed
+ * @retval -EINVAL a submission is not a SPI transfer
+ */
+int spi_rtio_dma_blocks(struct rtio_iodev_sqe *txn_head, uintptr_t tx_reg, uintptr_t rx_reg,
+			const uint8_t *tx_nop, uint8_t *rx_sink, size_t nop_len,
+			struct dma_block_config *tx_blocks, struct dma_block_config *rx_blocks,
+			size_t max_blocks);
+
 /**
  * @brief Initialize a SPI RTIO context
  *
@@ -137,6 +137,10 @@ struct video_buffer {
 	enum video_buf_type type;
 	/** pointer to the start of the buffer. */
 	uint8_t *buffer;
+	/** number of bytes reserved before @ref video_buffer.buffer that can be used to
+	 *  prepend headers.
+	 */
+	uint16_t headroom;
 	/** index of the buffer, optionally set by the application */
 	uint8_t index;
 	/** size of the buffer in bytes. */
@@ -884,6 +888,23 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_tim
  */
 struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout);
 
+/**
+ * @brief Import external memory as a video buffer.
+ *
+ * Wrap memory allocated outside of the video buffer pool, such as a display framebuffer or a
+ * buffer owned by another subsystem, into a video buffer so that it can be enqueued to a video
+ * device without copying. The memory is not freed by @ref video_buffer_release and must stay
+ * valid until the buffer is released. It must satisfy the alignment requirements of the video
+ * devices it is enqueued to.
+ *
+ * @param mem Pointer to the memory to import.
+ * @param size Size of the memory (in bytes).
+ *
+ * @retval pointer to the video buffer wrapping @p mem
+ * @retval NULL if no video buffer is available
+ */
+struct video_buffer *video_buffer_import(uint8_t *mem, size_t size);
+
 /**
  * @brief Release a video buffer.
  *
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @brief File system RTIO backend
+ *
+ * RTIO I/O devices that read from and write to an open file, so that a
+ * thread can queue file accesses and reap their completions from an RTIO
+ * completion queue instead of blocking on the storage device.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief File system RTIO backend
+ * @defgroup file_system_rtio File system RTIO backend
+ * @ingroup file_system_api
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+struct fs_rtio_data {
+	struct fs_file_t *zfp;
+	atomic_t pending;
+};
+
+extern const struct rtio_iodev_api fs_rtio_iodev_api;
+
+/** @endcond */
+
+/**
+ * @brief Statically define a file system RTIO device
+ *
+ * The device is not usable until a file is attached to it with
+ * fs_rtio_iodev_set_file(). Submissions are run, one at a time and in
+ * submission order, by the RTIO work queue threads:
+ *
+ * - @ref RTIO_OP_RX reads from the file as fs_read() would,
+ * - @ref RTIO_OP_TX and @ref RTIO_OP_TINY_TX write to the file as fs_write()
+ *   would,
+ * - @ref RTIO_OP_NOP flushes the file as fs_sync() would.
+ *
+ * Reads and writes start at the current position of the file. The result
+ * of the completion is the number of bytes read or written, or a negative
+ * errno value. The number of submissions outstanding on all the devices is
+ * limited by CONFIG_RTIO_WORKQ_POOL_ITEMS, submissions beyond it complete
+ * with -ENOMEM.
+ *
+ * @param name Name of the RTIO device
+ */
+#define FS_RTIO_IODEV_DEFINE(name)						\
+	static struct fs_rtio_data _fs_rtio_data_##name;			\
+	RTIO_IODEV_DEFINE(name, &fs_rtio_iodev_api, &_fs_rtio_data_##name)
+
+/**
+ * @brief Attach an open file to a file system RTIO device
+ *
+ * The file must stay open while it is attached. This must not be called
+ * while submissions are pending on the device.
+ *
+ * @param iodev RTIO device defined with @ref FS_RTIO_IODEV_DEFINE
+ * @param zfp File to read from and write to, or NULL to detach the file.
+ *
+ * @retval 0 on success;
+ * @retval -EBUSY if submissions are pending on the device.
+ */
+int fs_rtio_iodev_set_file(const struct rtio_iodev *iodev, struct fs_file_t *zfp);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
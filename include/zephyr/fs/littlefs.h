@@ -53,6 +53,18 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	/* Read-ahead buffer allocated at mount, NULL if not available. */
+	uint8_t *ra_buffer;
+
+	/* Partition offset and size of the data in ra_buffer. */
+	size_t ra_off;
+	size_t ra_len;
+
+	/* Partition offset following the last read. */
+	size_t ra_next;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
@@ -67,6 +67,24 @@ struct zms_fs {
 #endif
 };
 
+/**
+ * @brief Batch of ZMS writes committed together
+ *
+ * Initialized by @ref zms_batch_begin().
+ */
+struct zms_batch {
+	/** File system the batch is written to */
+	struct zms_fs *fs;
+	/** Buffer holding the data and the ATEs of the batch until it is committed */
+	uint8_t *buf;
+	/** Size of the buffer */
+	size_t size;
+	/** Number of bytes of data in the buffer */
+	size_t data_len;
+	/** Number of entries in the batch */
+	uint16_t count;
+};
+
 /**
  * @}
  */
@@ -155,6 +173,75 @@ ssize_t zms_write(struct zms_fs *fs, zms_id_t id, const void *data, size_t len);
  */
 int zms_delete(struct zms_fs *fs, zms_id_t id);
 
+/**
+ * @brief Start a batch of writes committed together.
+ *
+ * The entries written to the batch are held in `buf` until @ref zms_batch_commit() stores all
+ * of them, with as few flash writes as possible. Either all the entries of a committed batch
+ * are found after a power loss, or none of them. A batch that is not committed is discarded
+ * by simply not using it anymore.
+ *
+ * Each entry takes the size of an ATE in the buffer, plus its data rounded up to the
+ * `write-block-size` of the device when it doesn't fit in the ATE. The buffer also holds a
+ * header of up to the size of an ATE plus 8 bytes. A committed batch takes twice the size of
+ * the ATEs of its entries in the sector until it is garbage collected, as copies of them are
+ * stored for recovery.
+ *
+ * @note Only available with @kconfig{CONFIG_ZMS_BATCH}.
+ *
+ * @param fs Pointer to the file system.
+ * @param batch Pointer to the batch to initialize.
+ * @param buf Buffer holding the batch until it is committed.
+ * @param size Size of the buffer.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -EINVAL if `fs`, `batch` or `buf` is NULL.
+ */
+int zms_batch_begin(struct zms_fs *fs, struct zms_batch *batch, void *buf, size_t size);
+
+/**
+ * @brief Add an entry to a batch.
+ *
+ * The data is copied to the buffer of the batch. Entries with the same ID are stored in the
+ * order they are added, a `len` of 0 deletes the entry.
+ *
+ * @note Unlike @ref zms_write(), entries are stored even when
+ * @kconfig{CONFIG_ZMS_NO_DOUBLE_WRITE} is enabled and they hold the data already stored.
+ *
+ * @param batch Pointer to the batch.
+ * @param id ID of the entry to be written.
+ * @param data Pointer to the data to be written.
+ * @param len Number of bytes to be written (maximum 64 KiB).
+ *
+ * @return Number of bytes added. On error, returns negative value of error codes defined in
+ * `errno.h`.
+ * @retval `len` on success.
+ * @retval -EINVAL if `batch` is NULL or `len` is invalid.
+ * @retval -ENOMEM if the buffer of the batch is full.
+ * @retval -ENOSPC if the batch would not fit in a sector.
+ */
+ssize_t zms_batch_write(struct zms_batch *batch, zms_id_t id, const void *data, size_t len);
+
+/**
+ * @brief Commit all the entries of a batch to the file system.
+ *
+ * The batch is empty once written, even on error, and can be reused for other entries.
+ * It is left untouched when there is no space for it. All the entries of a
+ * batch are stored in the same sector, the garbage collector is called as needed for @ref
+ * zms_write().
+ *
+ * @param batch Pointer to the batch.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -ENXIO if there is a device error.
+ * @retval -EIO if there is a memory read/write error.
+ * @retval -EINVAL if `batch` is NULL.
+ * @retval -ENOSPC if no space is left on the device.
+ */
+int zms_batch_commit(struct zms_batch *batch);
+
 /**
  * @brief Read an entry from the file system.
  *
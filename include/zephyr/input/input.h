@@ -169,6 +169,54 @@ struct input_callback {
 #define INPUT_CALLBACK_DEFINE(_dev, _callback, _user_data)                     \
 	INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
 
+/**
+ * @brief Input frame callback structure.
+ */
+struct input_frame_callback {
+	/** @ref device pointer or NULL. */
+	const struct device *dev;
+	/** The callback function. */
+	void (*callback)(const struct input_event *evts, size_t num, void *user_data);
+	/** User data pointer. */
+	void *user_data;
+};
+
+/**
+ * @brief Register a callback structure for input frames with a custom name.
+ *
+ * Same as @ref INPUT_FRAME_CALLBACK_DEFINE but allows specifying a custom
+ * name for the callback structure.
+ */
+#define INPUT_FRAME_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, name)   \
+	static const STRUCT_SECTION_ITERABLE(input_frame_callback,             \
+					     _input_frame_callback__##name) = { \
+		.dev = _dev,                                                   \
+		.callback = _callback,                                         \
+		.user_data = _user_data,                                       \
+	}
+
+/**
+ * @brief Register a callback structure for input frames.
+ *
+ * Requires @kconfig{CONFIG_INPUT_FRAME}. The callback is invoked once for all
+ * the events reported by a device up to the one with the sync flag set, which
+ * is the last one of the frame. Frames exceeding
+ * @kconfig{CONFIG_INPUT_FRAME_MAX_EVENTS} events are split, the first part
+ * ending with an event without the sync flag. With
+ * @kconfig{CONFIG_INPUT_FRAME_COALESCE}, repeated @ref INPUT_EV_ABS events of
+ * a frame are merged into the last value, and repeated @ref INPUT_EV_REL ones
+ * into their sum.
+ *
+ * The events are only valid during the callback. Callbacks registered with
+ * @ref INPUT_CALLBACK_DEFINE still receive each event individually.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _callback The callback function.
+ * @param _user_data Pointer to user specified data.
+ */
+#define INPUT_FRAME_CALLBACK_DEFINE(_dev, _callback, _user_data)               \
+	INPUT_FRAME_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,19 @@ struct icmsg_data_t {
 	const struct icmsg_config_t *cfg;
 #ifdef CONFIG_MULTITHREADING
 	struct k_work mbox_work;
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+	/* Buffer claimed with icmsg_get_tx_buffer, if any. */
+	void *tx_buf;
+	/* Buffer being passed to the received callback, or held. */
+	const void *rx_data;
+	bool rx_in_place;
+	atomic_t rx_held;
+	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	struct k_work_delayable notify_work;
+	atomic_t tx_pending;
 #endif
 	uint16_t remote_sid;
 	uint16_t local_sid;
@@ -170,6 +183,100 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len);
 
+/** @brief Get a buffer to fill in place and send with @ref icmsg_send_nocopy.
+ *
+ *  With CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC, sending is locked for other
+ *  threads until the buffer is sent or dropped, which must be done from the
+ *  calling thread.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[out] data Pointer to the buffer.
+ *  @param[inout] size Requested size, or 0 for the largest buffer that is
+ *                     currently available. Set to the size of the buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EBUSY when the instance has not finished handshake with the remote
+ *                 instance.
+ *  @retval -EALREADY when a buffer was already claimed and not yet sent.
+ *  @retval -ENOBUFS when there are no TX buffers available.
+ *  @retval -ENOMEM when the requested size is too big, @p size is set to the
+ *                  largest available size.
+ */
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, size_t *size);
+
+/** @brief Drop a buffer obtained with @ref icmsg_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EINVAL when @p data is not the claimed buffer.
+ */
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data);
+
+/** @brief Send a buffer obtained with @ref icmsg_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the buffer.
+ *  @param[in] len Number of bytes written to the buffer.
+ *
+ *  @retval Number of sent bytes.
+ *  @retval -EINVAL when @p data is not the claimed buffer.
+ *  @retval -EBADMSG when @p len is bigger than the buffer.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *data, size_t len);
+
+/** @brief Hold the buffer passed to the received callback.
+ *
+ *  The buffer remains valid after the callback returns, until released with
+ *  @ref icmsg_release_rx_buffer. No other message is received meanwhile.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the buffer passed to the received callback.
+ *
+ *  @retval 0 on success.
+ *  @retval -EINVAL when @p data is not the buffer being received.
+ *  @retval -EALREADY when the buffer is already held.
+ */
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data);
+
+/** @brief Release a buffer held with @ref icmsg_hold_rx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the held buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EINVAL when @p data is not the held buffer.
+ *  @retval -EALREADY when no buffer is held.
+ */
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data,
+			    const void *data);
+
 /**
  * @}
  */
@@ -235,6 +235,60 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Get space to write the next packet in place.
+ *
+ * The returned space is contiguous in memory, so packets that would wrap
+ * around the end of the buffer cannot be written in place. The packet is
+ * only visible to the reader after a call to @ref pbuf_commit_tx_buf.
+ *
+ * @param pb		A buffer to which to write.
+ * @param[out] buf	A pointer to output pointer to the packet data.
+ * @retval int		Number of bytes that can be written at @p buf, negative
+ *			error code on fail.
+ *			-EINVAL, if any of input parameter is incorrect.
+ */
+int pbuf_get_tx_buf(struct pbuf *pb, char **buf);
+
+/**
+ * @brief Make a packet written in place visible to the reader.
+ *
+ * @param pb	A buffer to which the packet was written.
+ * @param len	Number of bytes written to the space returned by
+ *		@ref pbuf_get_tx_buf. Must be positive and not bigger than the
+ *		size it returned.
+ * @retval int	Number of bytes committed, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ */
+int pbuf_commit_tx_buf(struct pbuf *pb, uint16_t len);
+
+/**
+ * @brief Get the next packet in place, without copying it.
+ *
+ * The packet remains in the buffer until it is freed with
+ * @ref pbuf_free_rx_buf, and is returned again by subsequent calls.
+ *
+ * @param pb		A buffer from which data will be read.
+ * @param[out] buf	A pointer to output pointer to the packet data.
+ * @retval int		Packet length, 0 if the buffer is empty, negative error
+ *			code on fail.
+ *			-EINVAL, if any of input parameter is incorrect.
+ *			-EAGAIN, if not whole message is ready yet.
+ *			-EFAULT, if the packet wraps around the end of the
+ *			buffer and must be read with @ref pbuf_read.
+ */
+int pbuf_get_rx_buf(struct pbuf *pb, volatile char **buf);
+
+/**
+ * @brief Free the packet returned by @ref pbuf_get_rx_buf.
+ *
+ * @param pb	A buffer from which the packet was obtained.
+ * @retval int	0 on success, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENODATA, if the buffer is empty.
+ */
+int pbuf_free_rx_buf(struct pbuf *pb);
+
 /**
  * @brief Read handshake word from pbuf.
  *
@@ -1060,6 +1060,46 @@ __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
  * @param deadline A timestamp, in cycle units
  */
 __syscall void k_thread_absolute_deadline_set(k_tid_t thread, int deadline);
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Make a thread a constant bandwidth server
+ *
+ * The thread may then run for at most @a budget cycles in every
+ * @a period cycles at its deadline. Once the budget is consumed, it is
+ * replenished and the deadline of the thread is postponed by one period,
+ * so an overrunning thread falls behind the other threads at the same
+ * static priority instead of starving them. A thread waking up with more
+ * budget left than its bandwidth allows until its deadline gets a fresh
+ * budget and a deadline one period from now.
+ *
+ * The server is only accepted if the bandwidth of all servers stays
+ * within @kconfig{CONFIG_SCHED_DEADLINE_CBS_UTILIZATION} percent of the
+ * CPUs. Its bandwidth is released when the thread exits.
+ *
+ * When the budget is exhausted, @a overrun is called in interrupt context
+ * while the thread is still current, after its deadline was postponed.
+ *
+ * @note Budgets are enforced with timeouts, so a server may overrun its
+ * budget by up to one tick. The consumed time itself is accounted with
+ * cycle precision by the thread usage tracking.
+ *
+ * @kconfig_dep{CONFIG_SCHED_DEADLINE_CBS}
+ *
+ * @param thread A thread which is not running on another CPU
+ * @param budget Run time allowed per period in cycle units, or 0 to
+ *        remove the server
+ * @param period Server period in cycle units
+ * @param overrun Callback called when the budget is exhausted, or NULL
+ * @param data Parameter for the overrun callback
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a budget exceeds @a period or @a period is invalid
+ * @retval -EBUSY if admitting the server would exceed the utilization bound
+ */
+int k_thread_cbs_set(k_tid_t thread, uint32_t budget, uint32_t period,
+		     k_thread_cbs_overrun_fn_t overrun, void *data);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 #endif
 
 /**
@@ -2466,6 +2506,15 @@ struct k_event {
 	uint32_t          events;
 	struct k_spinlock lock;
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/* Waiter lists in use, each only initialized once its bit gets set */
+	uint32_t          waiter_lists;
+	/* Events waited for by the threads in spanning_waiters, if any */
+	uint32_t          spanning_events;
+	sys_dlist_t       waiters[CONFIG_EVENTS_WAITER_INDEX_BUCKETS];
+	sys_dlist_t       spanning_waiters;
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -3782,6 +3831,41 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Submit several work items to a queue at once.
+ *
+ * Equivalent to invoking k_work_submit_to_queue() on each item of @p works
+ * in order, except that the work lock is taken only once and that the work
+ * queue thread is woken up only once, which reduces the overhead of
+ * submitting many work items, for instance from an interrupt.
+ *
+ * As with k_work_submit_to_queue(), an item that is running is queued to
+ * the queue that is running it rather than to @p queue.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the items should run.  If
+ * NULL the queue from the most recent submission of each item will be used.
+ * @param works array of pointers to the work items.
+ * @param count number of work items in @p works.
+ *
+ * @return the number of work items that have been queued.  Items that were
+ * already queued, or whose submission was rejected for any of the reasons
+ * documented for k_work_submit_to_queue(), are not counted.
+ */
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *works, size_t count);
+
+/** @brief Submit several work items to the system queue at once.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param works array of pointers to the work items.
+ * @param count number of work items in @p works.
+ *
+ * @return as with k_work_submit_batch_to_queue().
+ */
+int k_work_submit_batch(struct k_work *const *works, size_t count);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -3976,6 +4060,45 @@ int k_work_queue_unplug(struct k_work_q *queue);
  */
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+struct k_work_pool;
+
+/** @brief Start a work pool.
+ *
+ * This creates and starts the worker threads of a work pool defined with
+ * K_WORK_POOL_DEFINE().  The function should not be re-invoked on a pool.
+ *
+ * Work items are submitted to, scheduled on, flushed from and cancelled
+ * from the pool through its work queue, which is obtained with
+ * k_work_pool_queue(), using the regular work queue API.  Any idle worker
+ * picks up the next pending work item, while a work item is still never
+ * run by more than one worker at a time.
+ *
+ * A work pool cannot be stopped; k_work_queue_stop() returns -ENOTSUP
+ * for the queue of a pool.  The queue of a pool does not monitor work
+ * timeouts.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @param prio initial priority of the worker threads.
+ *
+ * @param cfg optional additional configuration parameters, which apply to
+ * all worker threads.  Pass @c NULL if not required, to use the defaults
+ * documented in k_work_queue_config.
+ */
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_queue_config *cfg);
+
+/** @brief Access the work queue of a work pool.
+ *
+ * @param pool pointer to the pool structure.
+ *
+ * @return the work queue to which the work items to be processed by the
+ * pool are submitted.
+ */
+static inline struct k_work_q *k_work_pool_queue(struct k_work_pool *pool);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__) */
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -4291,6 +4414,8 @@ enum {
 	/* Static work queue flags */
 	K_WORK_QUEUE_NO_YIELD_BIT = 8,
 	K_WORK_QUEUE_NO_YIELD = BIT(K_WORK_QUEUE_NO_YIELD_BIT),
+	K_WORK_QUEUE_POOL_BIT = 9,
+	K_WORK_QUEUE_POOL = BIT(K_WORK_QUEUE_POOL_BIT),
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -4412,6 +4537,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* The item being flushed, which may be running on another worker
+	 * of a pool when the flusher is reached.
+	 */
+	struct k_work *flushed;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4491,6 +4622,16 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** Control whether the worker threads of a work pool are pinned
+	 * to CPUs.
+	 *
+	 * If true, and CONFIG_SCHED_CPU_MASK is enabled, each worker
+	 * thread started by k_work_pool_start() is pinned to a CPU, in a
+	 * round-robin manner.  This has no effect on work queues with a
+	 * single thread.
+	 */
+	bool pin_cpus;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4526,6 +4667,38 @@ struct k_work_q {
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 };
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief A work queue processed by several threads. */
+struct k_work_pool {
+	/* The queue shared by all the workers.  Its thread is the first
+	 * worker.
+	 */
+	struct k_work_q queue;
+
+	/* The threads of the other workers. */
+	struct k_thread *threads;
+
+	/* The stacks of all the workers. */
+	k_thread_stack_t *stacks;
+
+	/* The size of each worker stack, in bytes. */
+	size_t stack_size;
+
+	/* The number of workers. */
+	uint8_t num_threads;
+
+	/* The number of workers running a work item.  Accessed only while
+	 * the work module spinlock is held.
+	 */
+	uint8_t num_busy;
+};
+
+static inline struct k_work_q *k_work_pool_queue(struct k_work_pool *pool)
+{
+	return &pool->queue;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__) */
+
 /* Provide the implementation for inline functions declared above */
 
 static inline bool k_work_is_pending(const struct k_work *work)
@@ -4784,6 +4957,34 @@ struct k_work_poll {
 #define K_WORK_DEFINE(work, work_handler) \
 	struct k_work work = Z_WORK_INITIALIZER(work_handler)
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/**
+ * @brief Statically define a work pool.
+ *
+ * This defines a work pool with its worker threads and their stacks.  The
+ * pool must then be started with k_work_pool_start(). For example,
+ *
+ * @code K_WORK_POOL_DEFINE(<pool>, CONFIG_MP_MAX_NUM_CPUS, 1024); @endcode
+ *
+ * @param name Symbol name for the work pool object
+ * @param n_threads Number of worker threads, at least 1
+ * @param stack_sz Size of the stack of each worker thread, in bytes
+ */
+#define K_WORK_POOL_DEFINE(name, n_threads, stack_sz)				\
+	BUILD_ASSERT(((n_threads) > 0) && ((n_threads) <= UINT8_MAX),		\
+		     "invalid number of work pool threads");			\
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_work_pool_stacks_##name,		\
+					   n_threads, stack_sz);		\
+	static struct k_thread							\
+		_k_work_pool_threads_##name[MAX((n_threads) - 1, 1)];		\
+	struct k_work_pool name = {						\
+		.threads = _k_work_pool_threads_##name,				\
+		.stacks = &(_k_work_pool_stacks_##name[0][0]),			\
+		.stack_size = stack_sz,						\
+		.num_threads = n_threads,					\
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__) */
+
 /**
  * @brief Initialize a triggered work item.
  *
@@ -4929,6 +5130,28 @@ struct k_msgq {
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+	/** Lock-free ring state, used with K_MSGQ_FLAG_LOCKFREE */
+	struct {
+		/** Threads waiting for free space */
+		_wait_q_t put_wait_q;
+		/** Next position to be reserved by a producer */
+		atomic_t prod_head;
+		/** Next position to be published by a producer */
+		atomic_t prod_tail;
+		/** Next position to be reserved by a consumer */
+		atomic_t cons_head;
+		/** Next position to be released by a consumer */
+		atomic_t cons_tail;
+		/** Number of threads about to pend on put_wait_q */
+		atomic_t put_waiters;
+		/** Number of threads about to pend on wait_q */
+		atomic_t get_waiters;
+		/** Ring positions wrap around at this value */
+		uint32_t wrap;
+	} lf;
+#endif
 };
 /**
  * @cond INTERNAL_HIDDEN
@@ -4950,12 +5173,32 @@ struct k_msgq {
 	.flags = 0, \
 	}
 
+#define Z_MSGQ_LOCKFREE_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.lock = {}, \
+	.msg_size = q_msg_size, \
+	.max_msgs = q_max_msgs, \
+	.buffer_start = q_buffer, \
+	.buffer_end = q_buffer + (q_max_msgs * q_msg_size), \
+	.read_ptr = q_buffer, \
+	.write_ptr = q_buffer, \
+	.used_msgs = 0, \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	.flags = K_MSGQ_FLAG_LOCKFREE, \
+	.lf = { \
+		.put_wait_q = Z_WAIT_Q_INIT(&obj.lf.put_wait_q), \
+		.wrap = (UINT32_MAX / (q_max_msgs)) * (q_max_msgs), \
+	}, \
+	}
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_LOCKFREE	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -4995,6 +5238,24 @@ struct k_msgq_attrs {
 	       Z_MSGQ_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
 				  (q_msg_size), (q_max_msgs))
 
+/**
+ * @brief Statically define and initialize a lock-free message queue.
+ *
+ * This is the lock-free counterpart of K_MSGQ_DEFINE(), see
+ * k_msgq_lockfree_init() for the properties of such a queue.
+ *
+ * @param q_name Name of the message queue.
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages that can be queued.
+ * @param q_align Alignment of the message queue's ring buffer (power of 2).
+ */
+#define K_MSGQ_LOCKFREE_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)	\
+	static char __noinit __aligned(q_align)				\
+		_k_fifo_buf_##q_name[(q_max_msgs) * (q_msg_size)];	\
+	STRUCT_SECTION_ITERABLE(k_msgq, q_name) =			\
+	       Z_MSGQ_LOCKFREE_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
+				  (q_msg_size), (q_max_msgs))
+
 /**
  * @brief Initialize a message queue.
  *
@@ -5012,6 +5273,29 @@ struct k_msgq_attrs {
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs);
 
+/**
+ * @brief Initialize a lock-free message queue.
+ *
+ * This routine initializes a message queue object like k_msgq_init(), but
+ * messages are then put and got without taking the queue's lock: producers
+ * and consumers only synchronize through atomic operations on the ring
+ * buffer positions, and the lock and wait queues are only used when a
+ * caller has to block on an empty or full queue, or has to wake up such
+ * a blocked thread.
+ *
+ * A lock-free message queue does not support k_msgq_put_front(), and
+ * k_msgq_purge() is not atomic with respect to concurrent senders.
+ *
+ * @note Requires CONFIG_MSGQ_LOCKFREE.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ */
+void k_msgq_lockfree_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
+			  uint32_t max_msgs);
+
 /**
  * @brief Initialize a message queue.
  *
@@ -5091,6 +5375,7 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -ENOTSUP The message queue is lock-free.
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
 
@@ -5185,9 +5470,29 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 				 struct k_msgq_attrs *attrs);
 
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_MSGQ_LOCKFREE
+uint32_t z_msgq_lockfree_used_get(const struct k_msgq *msgq);
+#endif
+
+static inline uint32_t z_msgq_used_get(const struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		return z_msgq_lockfree_used_get(msgq);
+	}
+#endif
+	return msgq->used_msgs;
+}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - z_msgq_used_get(msgq);
 }
 
 /**
@@ -5203,7 +5508,7 @@ __syscall uint32_t k_msgq_num_used_get(struct k_msgq *msgq);
 
 static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 {
-	return msgq->used_msgs;
+	return z_msgq_used_get(msgq);
 }
 
 /** @} */
@@ -5384,6 +5689,8 @@ __syscall void k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_s
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIM = BIT(2),
+	PIPE_FLAG_READ_CLAIM = BIT(3),
 };
 
 struct k_pipe {
@@ -5436,6 +5743,25 @@ struct k_pipe {
 	STRUCT_SECTION_ITERABLE(k_pipe, name) =				\
 		Z_PIPE_INITIALIZER(name, _k_pipe_buf_##name, pipe_buffer_size)
 
+/**
+ * @brief Statically define and initialize a pipe in non-cacheable memory.
+ *
+ * Same as K_PIPE_DEFINE(), except that the pipe's ring buffer is placed
+ * in non-cacheable memory when CONFIG_NOCACHE_MEMORY is enabled. DMA
+ * controllers can then transfer data to or from areas claimed with
+ * k_pipe_write_claim() and k_pipe_read_claim() without any cache
+ * maintenance.
+ *
+ * @param name Name of the pipe.
+ * @param pipe_buffer_size Size of the pipe's ring buffer (in bytes).
+ * @param pipe_align Alignment of the pipe's ring buffer (power of 2).
+ */
+#define K_PIPE_DEFINE_NOCACHE(name, pipe_buffer_size, pipe_align)	\
+	static unsigned char __nocache_noinit __aligned(pipe_align)	\
+		_k_pipe_buf_##name[pipe_buffer_size];			\
+	STRUCT_SECTION_ITERABLE(k_pipe, name) =				\
+		Z_PIPE_INITIALIZER(name, _k_pipe_buf_##name, pipe_buffer_size)
+
 
 /**
  * @brief Write data to a pipe
@@ -5494,6 +5820,95 @@ __syscall void k_pipe_reset(struct k_pipe *pipe);
  * @param pipe Address of the pipe.
  */
 __syscall void k_pipe_close(struct k_pipe *pipe);
+
+/**
+ * @brief Claim space in a pipe for writing in place
+ *
+ * This routine waits for free space in @a pipe and provides the address of
+ * a contiguous area of its ring buffer, of up to @a len bytes, so data can
+ * be produced there directly instead of being copied by k_pipe_write(). The
+ * data only becomes visible to readers once committed with
+ * k_pipe_write_finish().
+ *
+ * Only one write claim may be pending on a pipe at a time. While it is,
+ * k_pipe_write() and other calls to this routine wait for it to be
+ * finished. The claimed area may be shorter than requested when the ring
+ * buffer wraps around, the rest of the data can then be written with a new
+ * claim once this one is finished.
+ *
+ * @note This API is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed area.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for free space.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space was available before the timeout expired
+ * @retval -ECANCELED if the wait was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine ends the write claim made with k_pipe_write_claim() and
+ * makes the first @a len bytes of the claimed area available to readers.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written to the claimed area, may be zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a len is larger than the claimed area
+ * @retval -ECANCELED if the pipe was reset since the claim, or there is no pending write claim
+ * @retval -EPIPE if the pipe was closed since the claim, nothing was committed
+ */
+int k_pipe_write_finish(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading in place
+ *
+ * This routine waits for data in @a pipe and provides the address of a
+ * contiguous area of its ring buffer holding up to @a len bytes of it, so
+ * the data can be consumed in place instead of being copied by
+ * k_pipe_read(). The space is only given back to writers once released
+ * with k_pipe_read_finish().
+ *
+ * Only one read claim may be pending on a pipe at a time. While it is,
+ * k_pipe_read() and other calls to this routine wait for it to be finished.
+ *
+ * @note This API is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed area.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for data.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data was available before the timeout expired
+ * @retval -ECANCELED if the wait was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed and holds no more data
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ */
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Release data read in place from a pipe
+ *
+ * This routine ends the read claim made with k_pipe_read_claim() and frees
+ * the first @a len bytes of the claimed area. Bytes that are not released
+ * remain in the pipe and are read again first.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed from the claimed area, may be zero.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a len is larger than the claimed area
+ * @retval -ECANCELED if the pipe was reset since the claim, or there is no pending read claim
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t len);
 /** @} */
 
 /**
@@ -5508,6 +5923,14 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+struct z_mem_slab_cache {
+	struct k_spinlock lock;
+	uint32_t count;
+	char *blocks[CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE];
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5520,8 +5943,30 @@ struct k_mem_slab {
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	atomic_t waiters;
+	struct z_mem_slab_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
+/* Free blocks held in per-CPU caches, which info.num_used accounts for */
+static inline uint32_t z_mem_slab_num_cached(const struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	uint32_t cached = 0U;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cache[i].count;
+	}
+
+	return cached;
+#else
+	ARG_UNUSED(slab);
+	return 0U;
+#endif
+}
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
@@ -5726,7 +6171,10 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_used;
+	uint32_t used = slab->info.num_used;
+	uint32_t cached = z_mem_slab_num_cached(slab);
+
+	return (used > cached) ? (used - cached) : 0U;
 }
 
 /**
@@ -5765,7 +6213,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5808,10 +6256,26 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_HEAP_CACHE
+/* Size classes of the small block caches: 16, 32, 64 and 128 bytes */
+#define Z_HEAP_CACHE_CLASSES 4
+#define Z_HEAP_CACHE_MIN_BYTES 16U
+
+struct z_heap_cache {
+	struct k_spinlock lock;
+	uint8_t count[Z_HEAP_CACHE_CLASSES];
+	void *blocks[Z_HEAP_CACHE_CLASSES][CONFIG_HEAP_CACHE_DEPTH];
+};
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_CACHE
+	atomic_t waiters;
+	struct z_heap_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 /**
@@ -6372,6 +6836,88 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Poll Set
+ *
+ * Persistent set of poll events, see k_poll_set_init().
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set
+ *
+ * A poll set keeps the events added to it registered with their kernel
+ * objects across waits, instead of k_poll() registering and unregistering
+ * all its events on every call. Events that become ready are queued to the
+ * set, so waiting costs O(ready events) rather than O(events), which suits
+ * threads serving a large number of objects.
+ *
+ * The same conditions as for k_poll() apply: objects are not "given" to
+ * the set, and the set is only notified of an object being available when
+ * no thread is pending on that object.
+ *
+ * @note This API is not available to user mode threads.
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set
+ *
+ * The event, initialized with k_poll_event_init() or one of the
+ * K_POLL_EVENT_INITIALIZER() macros, stays registered with its kernel
+ * object until removed with k_poll_set_remove(). It must not be
+ * passed to k_poll() or added to another set meanwhile.
+ *
+ * @param set Poll set.
+ * @param event Event to add, which must remain valid while in the set.
+ */
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set
+ *
+ * @param set Poll set.
+ * @param event Event previously added to @a set.
+ */
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready
+ *
+ * Events are level-triggered: an event is returned by every call for as
+ * long as its condition is met, e.g. until its FIFO has been emptied or its
+ * poll signal reset. Its state field is set to the K_POLL_STATE_xxx value
+ * of the condition met, and is reset by the set itself: there is no need
+ * to set it back to K_POLL_STATE_NOT_READY. Events are returned in the
+ * order in which they became ready, so all of them are eventually returned
+ * even when more than @a max_events are ready.
+ *
+ * Several threads may wait on the same set, each ready event is then
+ * returned to one of them at a time.
+ *
+ * @param set Poll set.
+ * @param ready Array to fill with the events that are ready.
+ * @param max_events Size of the @a ready array, at least 1.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a ready, which is at least 1.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready, int max_events,
+		    k_timeout_t timeout);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -0,0 +1,196 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Threaded interrupt handlers
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_
+#define ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Threaded interrupt handler APIs
+ * @defgroup irq_thread_apis Threaded interrupt handler APIs
+ * @ingroup kernel_apis
+ * @{
+ *
+ * A threaded interrupt handler splits interrupt processing into a top half,
+ * run by the ISR and limited to acknowledging the device, and a bottom half
+ * run by a kernel IRQ thread. There is one IRQ thread per CPU, running at
+ * @kconfig{CONFIG_IRQ_THREAD_PRIORITY}.
+ *
+ * Raising a handler again before its bottom half ran does not queue it
+ * twice: the bottom half runs once and is given the number of times it was
+ * raised. The bottom half runs on the IRQ thread of the CPU set with
+ * k_irq_thread_set_cpu(), or on the one of the CPU that raised it by default.
+ */
+
+/** Run the bottom half on the CPU that raised the handler */
+#define K_IRQ_THREAD_CPU_ANY -1
+
+struct k_irq_thread;
+
+/**
+ * @brief Top half of a threaded interrupt handler
+ *
+ * Runs in the ISR.
+ *
+ * @param irq_thread Handler
+ *
+ * @return true to schedule the bottom half, false if there is nothing to do
+ */
+typedef bool (*k_irq_thread_top_t)(struct k_irq_thread *irq_thread);
+
+/**
+ * @brief Bottom half of a threaded interrupt handler
+ *
+ * Runs in the IRQ thread.
+ *
+ * @param irq_thread Handler
+ * @param count Number of times the handler was raised since it last ran
+ */
+typedef void (*k_irq_thread_bottom_t)(struct k_irq_thread *irq_thread, uint32_t count);
+
+/**
+ * @brief Threaded interrupt handler
+ *
+ * Embed this in the driver data and retrieve the data from the halves with
+ * CONTAINER_OF().
+ */
+struct k_irq_thread {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+	sys_snode_t node;
+	k_irq_thread_top_t top;
+	k_irq_thread_bottom_t bottom;
+	atomic_t count;
+	int cpu;
+#ifdef CONFIG_IRQ_THREAD_STATS
+	uint32_t raised_at;
+	uint32_t max_latency;
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @brief Statically initialize a threaded interrupt handler
+ *
+ * @param _top Top half, or NULL to always schedule the bottom half
+ * @param _bottom Bottom half
+ */
+#define K_IRQ_THREAD_INITIALIZER(_top, _bottom)                                                    \
+	{                                                                                          \
+		.top = (_top),                                                                     \
+		.bottom = (_bottom),                                                               \
+		.cpu = K_IRQ_THREAD_CPU_ANY,                                                       \
+	}
+
+/**
+ * @brief Statically define and initialize a threaded interrupt handler
+ *
+ * @param name Name of the handler
+ * @param _top Top half, or NULL to always schedule the bottom half
+ * @param _bottom Bottom half
+ */
+#define K_IRQ_THREAD_DEFINE(name, _top, _bottom)                                                   \
+	struct k_irq_thread name = K_IRQ_THREAD_INITIALIZER(_top, _bottom)
+
+/**
+ * @brief Connect a threaded interrupt handler to an interrupt
+ *
+ * Like IRQ_CONNECT(), with k_irq_thread_isr() as ISR.
+ *
+ * @param irq_p IRQ line number
+ * @param priority_p Interrupt priority
+ * @param irq_thread_p Address of the handler, a compile-time constant
+ * @param flags_p Architecture-specific IRQ configuration flags
+ */
+#define K_IRQ_THREAD_CONNECT(irq_p, priority_p, irq_thread_p, flags_p)                             \
+	IRQ_CONNECT(irq_p, priority_p, k_irq_thread_isr, irq_thread_p, flags_p)
+
+/**
+ * @brief Initialize a threaded interrupt handler
+ *
+ * @param irq_thread Handler
+ * @param top Top half, or NULL to always schedule the bottom half
+ * @param bottom Bottom half
+ */
+void k_irq_thread_init(struct k_irq_thread *irq_thread, k_irq_thread_top_t top,
+		       k_irq_thread_bottom_t bottom);
+
+/**
+ * @brief Select the CPU running the bottom half
+ *
+ * The handler must not be raised concurrently. On SMP, the IRQ threads are
+ * pinned to their CPU only with @kconfig{CONFIG_SCHED_CPU_MASK}.
+ *
+ * @param irq_thread Handler
+ * @param cpu CPU index, or @ref K_IRQ_THREAD_CPU_ANY
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p cpu is not a valid CPU index
+ */
+int k_irq_thread_set_cpu(struct k_irq_thread *irq_thread, int cpu);
+
+/**
+ * @brief Schedule the bottom half of a threaded interrupt handler
+ *
+ * Can be called from an ISR, e.g. from another ISR than k_irq_thread_isr()
+ * or from a device callback, or from a thread.
+ *
+ * @param irq_thread Handler
+ */
+void k_irq_thread_raise(struct k_irq_thread *irq_thread);
+
+/**
+ * @brief ISR of a threaded interrupt handler
+ *
+ * Runs the top half, then schedules the bottom half if the top half asks for
+ * it.
+ *
+ * @param arg The handler
+ */
+void k_irq_thread_isr(const void *arg);
+
+#if defined(CONFIG_IRQ_THREAD_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the longest delay before the bottom half ran
+ *
+ * Requires @kconfig{CONFIG_IRQ_THREAD_STATS}.
+ *
+ * @param irq_thread Handler
+ *
+ * @return The longest time between raising the handler while its bottom half
+ *         was idle and the start of the bottom half, in cycles
+ */
+static inline uint32_t k_irq_thread_max_latency_get(const struct k_irq_thread *irq_thread)
+{
+	return irq_thread->max_latency;
+}
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_IRQ_THREAD_H_ */
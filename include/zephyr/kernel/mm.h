@@ -135,6 +135,22 @@ extern "C" {
  */
 #define K_MEM_MAP_UNPAGED	BIT(18)
 
+/**
+ * Region will be backed by physically contiguous page frames
+ *
+ * This is meant for buffers accessed by bus masters such as DMA engines or
+ * display controllers. The page frames are taken from a single run of free
+ * physical memory and are pinned, as if K_MEM_MAP_LOCK was also specified.
+ * When the run is suitably aligned, the whole region is mapped with the
+ * largest granule supported by the architecture, which reduces the number
+ * of TLB entries and page tables needed to access it.
+ *
+ * The mapping fails if there is no free run of the requested size, even if
+ * enough free page frames are available in total. This is only meaningful
+ * for k_mem_map().
+ */
+#define K_MEM_MAP_CONTIG	BIT(19)
+
 /** @} */
 
 /**
@@ -166,9 +182,8 @@ size_t k_mem_free_get(void);
  *
  * Unless K_MEM_MAP_UNINIT is used, the returned memory will be zeroed.
  *
- * The mapped region is not guaranteed to be physically contiguous in memory.
- * Physically contiguous buffers should be allocated statically and pinned
- * at build time.
+ * The mapped region is not guaranteed to be physically contiguous in memory
+ * unless K_MEM_MAP_CONTIG is used.
  *
  * Pages mapped in this way have write-back cache settings.
  *
@@ -50,6 +50,9 @@ struct k_mem_paging_stats_t {
 		/** Number of page faults while in ISR */
 		unsigned long			in_isr;
 #endif /* !CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+		/** Number of pages paged in ahead of a fault on them */
+		unsigned long			fault_around;
 	} pagefaults;
 
 	struct {
@@ -58,6 +61,14 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+#if defined(CONFIG_EVICTION_SLRU) || defined(__DOXYGEN__)
+		/** Number of pages promoted to the protected queue */
+		unsigned long			promoted;
+
+		/** Number of pages demoted back to the probation queue */
+		unsigned long			demoted;
+#endif /* CONFIG_EVICTION_SLRU */
 	} eviction;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
@@ -0,0 +1,138 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Read-copy-update (RCU) deferred reclamation
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_RCU_H_
+#define ZEPHYR_INCLUDE_KERNEL_RCU_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RCU APIs
+ * @defgroup rcu_apis Read-copy-update APIs
+ * @ingroup kernel_apis
+ * @{
+ *
+ * RCU lets readers walk a shared data structure without taking any lock,
+ * while writers publish updated copies of its elements and reclaim the
+ * old ones only once no reader can still reference them.
+ *
+ * Readers enclose their accesses between k_rcu_read_lock() and
+ * k_rcu_read_unlock(), which only lock the scheduler, and load shared
+ * pointers with k_rcu_dereference(). Read-side sections must not block.
+ * They may be entered from interrupts, and may be preempted by MetaIRQ
+ * threads, which then do not end them.
+ *
+ * Writers still serialize among themselves, for example with a mutex or a
+ * @ref k_rwspinlock. They publish new elements with k_rcu_assign_pointer()
+ * and, after unlinking an element, wait for a grace period with
+ * k_rcu_synchronize(), or defer its reclamation with k_rcu_call(). A grace
+ * period ends once every CPU went through a quiescent state: a context
+ * switch between threads not holding the scheduler lock, or running its
+ * idle thread outside of any interrupt.
+ */
+
+/**
+ * @brief Deferred reclamation request
+ *
+ * Embed this in the element to reclaim, and retrieve the element from the
+ * callback with CONTAINER_OF().
+ */
+struct k_rcu_head {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+	sys_snode_t node;
+	void (*func)(struct k_rcu_head *head);
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @brief Enter an RCU read-side section
+ *
+ * Read-side sections may be nested and may be entered from interrupts.
+ */
+static inline void k_rcu_read_lock(void)
+{
+	if (!k_is_in_isr()) {
+		k_sched_lock();
+	}
+}
+
+/**
+ * @brief Leave an RCU read-side section
+ */
+static inline void k_rcu_read_unlock(void)
+{
+	if (!k_is_in_isr()) {
+		k_sched_unlock();
+	}
+}
+
+/**
+ * @brief Load an RCU protected pointer
+ *
+ * @param p Pointer published with k_rcu_assign_pointer()
+ * @return Value of the pointer, dereferenceable until the end of the
+ *         enclosing read-side section
+ */
+#define k_rcu_dereference(p) (*(volatile __typeof__(p) *)&(p))
+
+/**
+ * @brief Publish an RCU protected pointer
+ *
+ * Makes sure the pointed element is fully initialized, as seen from other
+ * CPUs, before the pointer itself is updated.
+ *
+ * @param p Pointer to update
+ * @param v New value
+ */
+#define k_rcu_assign_pointer(p, v)                                                                 \
+	do {                                                                                       \
+		barrier_dmem_fence_full();                                                         \
+		*(volatile __typeof__(p) *)&(p) = (v);                                             \
+	} while (false)
+
+/**
+ * @brief Wait for an RCU grace period
+ *
+ * Returns once all read-side sections entered before the call have been
+ * left. Must be called from a thread, outside of any read-side section.
+ * Without SMP, it must not be called from MetaIRQ threads.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @brief Defer a callback to after an RCU grace period
+ *
+ * @p func is called from the system work queue once all read-side sections
+ * entered before the call have been left. This may be called from
+ * interrupts and from read-side sections.
+ *
+ * @param head Reclamation request, embedded in the element to reclaim
+ * @param func Callback, typically freeing the element
+ */
+void k_rcu_call(struct k_rcu_head *head, void (*func)(struct k_rcu_head *head));
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_RCU_H_ */
@@ -27,6 +27,18 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAM) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_HISTOGRAM is selected.
+	 * @{
+	 */
+	uint32_t  ready;        /**< cycle count when the thread was made ready, 0 if not */
+	/** \# of usage windows per length, see CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS */
+	uint32_t  run_histogram[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+	/** \# of switches in per latency since being made ready */
+	uint32_t  wakeup_histogram[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
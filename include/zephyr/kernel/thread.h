@@ -93,6 +93,18 @@ struct _thread_base {
 	int prio_deadline;
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Constant bandwidth server, all times in cycle units */
+	struct {
+		uint32_t budget;
+		uint32_t period;
+		uint32_t remaining;
+		uint32_t bandwidth;
+		k_thread_cbs_overrun_fn_t overrun;
+		void *overrun_data;
+	} cbs;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
 	uint32_t order_key;
 #endif
@@ -220,6 +232,19 @@ typedef struct k_thread_runtime_stats {
 	uint64_t average_cycles;      /* average # of non-idle cycles */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	/*
+	 * Log2 histograms, see CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS.
+	 * run_histogram counts execution windows by length in cycles.
+	 * wakeup_histogram counts the cycles between a thread being made
+	 * ready and it being switched in; for CPUs, of all threads switched
+	 * in on that CPU.
+	 */
+
+	uint32_t run_histogram[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+	uint32_t wakeup_histogram[CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	/*
 	 * This field is always zero for individual threads. It only comes
@@ -274,6 +299,11 @@ struct k_thread {
 
 	/** true if timeout should not wake the thread */
 	bool no_wake_on_timeout;
+
+#if defined(CONFIG_EVENTS_WAITER_INDEX)
+	/** node in the waiter index of the event object waited on */
+	sys_dnode_t event_node;
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 #endif /* CONFIG_EVENTS */
 
 #if defined(CONFIG_THREAD_MONITOR)
@@ -324,6 +354,15 @@ struct k_thread {
 
 	/** current syscall frame pointer */
 	void *syscall_frame;
+
+#if defined(CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE)
+	/** Last dynamic kernel object looked up by this thread */
+	struct {
+		const void *obj;
+		void *dyn;
+		uint32_t gen;
+	} dyn_obj_cache;
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 
@@ -157,7 +157,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
 	struct _ready_q ready_q;
 #endif
 
@@ -178,6 +178,11 @@ struct _cpu {
 	uint8_t swap_ok;
 #endif
 
+#if defined(CONFIG_RCU) && defined(CONFIG_SMP)
+	/* Context switches, each one is an RCU quiescent state */
+	uint32_t rcu_qs;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
 	 * [usage0] is used as a timestamp to mark the beginning of an
@@ -217,7 +222,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifndef CONFIG_SCHED_PER_CPU_RUNQ
 	struct _ready_q ready_q;
 #endif
 
@@ -235,6 +240,10 @@ struct z_kernel {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	/* Identify CPUs to send IPIs to at the next scheduling point */
 	atomic_t pending_ipi;
+#ifdef CONFIG_IPI_COALESCE
+	/* Identify CPUs sent an IPI that they have not processed yet */
+	atomic_t inflight_ipi;
+#endif
 #endif
 };
 
@@ -286,6 +295,15 @@ bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 
 #define Z_WAIT_Q_INIT(wait_q) { { { .lessthan_fn = z_priq_rb_lessthan } } }
 
+#elif defined(CONFIG_WAITQ_MULTIQ)
+
+typedef struct {
+	struct _priq_mq waitq;
+} _wait_q_t;
+
+/* An all-clear bitmask is an empty queue, see kernel/include/priority_q.h */
+#define Z_WAIT_Q_INIT(wait_q) { { .bitmask = { 0 } } }
+
 #else
 
 typedef struct {
@@ -309,10 +327,16 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* CPU whose timeout queue holds this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
 
+typedef void (*k_thread_cbs_overrun_fn_t)(struct k_thread *thread, void *data);
+
 #ifdef __cplusplus
 }
 #endif
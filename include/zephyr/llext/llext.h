@@ -160,6 +160,17 @@ struct llext_load_param {
 	 */
 	bool pre_located;
 
+	/**
+	 * Execute a pre-located extension in place from its storage. The ELF
+	 * must have been fully linked for its final addresses when it was
+	 * installed, so no relocations are applied at load time. Read-only
+	 * regions are used directly from the (persistent, memory-mapped)
+	 * storage, such as XIP flash, while writable regions are copied to, or
+	 * for BSS cleared at, the RAM addresses assigned by the linker script.
+	 * Requires @ref pre_located to be set.
+	 */
+	bool xip;
+
 	/**
 	 * Extensions can implement custom ELF sections to be loaded in specific
 	 * memory regions, detached from other sections of compatible types.
@@ -313,8 +324,11 @@ __syscall ssize_t llext_get_fn_table(struct llext *ext, bool is_init, void *buf,
  * Searches for a symbol address, either in the list of symbols exported by
  * the main Zephyr binary or in an extension's symbol table.
  *
+ * Extension symbol tables are sorted by name when the extension is loaded, so
+ * that lookups are done with a binary search.
+ *
  * @param[in] sym_table Symbol table to lookup symbol in, or `NULL` to search
- *                      in the main Zephyr symbol table
+ *                      in the main Zephyr symbol table. Must be sorted by name.
  * @param[in] sym_name Symbol name to find
  *
  * @returns the address of symbol in memory, or `NULL` if not found
@@ -57,6 +57,13 @@ extern "C" {
 /** @brief Flag forcing to skip logging the source. */
 #define LOG_OUTPUT_FLAG_SKIP_SOURCE		BIT(8)
 
+/** @brief Flag keeping the message in the output buffer after processing.
+ *
+ * The buffer is written when full or on log_output_flush(), which allows
+ * backends to output several messages at once.
+ */
+#define LOG_OUTPUT_FLAG_NO_FLUSH		BIT(9)
+
 /**@} */
 
 /** @brief Supported backend logging format types for use
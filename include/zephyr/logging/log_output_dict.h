@@ -47,6 +47,26 @@ struct log_dict_output_dropped_msg_t {
 	uint16_t num_dropped_messages;
 } __packed;
 
+/** Magic number starting a frame, "ZL" */
+#define LOG_DICT_OUTPUT_FRAME_MAGIC 0x5A4C
+
+/** Version of the frame header */
+#define LOG_DICT_OUTPUT_FRAME_VERSION 1
+
+/**
+ * Header of a frame holding one dictionary based log message, for transports
+ * and storage that need message boundaries. Fields are big endian.
+ */
+struct log_dict_output_frame_hdr_t {
+	uint16_t magic;
+	uint8_t version;
+	uint8_t reserved;
+	/** Length of the message following the header. */
+	uint16_t len;
+	/** Sequence number, incremented for each frame to detect losses. */
+	uint32_t seq;
+} __packed;
+
 /** @brief Process log messages v2 for dictionary-based logging.
  *
  * Function is using provided context with the buffer and output function to
@@ -68,6 +88,27 @@ void log_dict_output_msg_process(const struct log_output *log_output,
  */
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt);
 
+/** @brief Process log messages v2 for framed dictionary-based logging.
+ *
+ * The frame is formatted in the buffer of the output instance and written in
+ * one call to the output function if it fits in the buffer.
+ *
+ * @param output Pointer to the log output instance.
+ * @param msg Log message.
+ * @param seq Sequence number of the frame.
+ */
+void log_dict_output_framed_msg_process(const struct log_output *output,
+					struct log_msg *msg, uint32_t seq);
+
+/** @brief Process dropped messages indication for framed dictionary-based logging.
+ *
+ * @param output Pointer to the log output instance.
+ * @param cnt Number of dropped messages.
+ * @param seq Sequence number of the frame.
+ */
+void log_dict_output_framed_dropped_process(const struct log_output *output, uint32_t cnt,
+					    uint32_t seq);
+
 #ifdef __cplusplus
 }
 #endif
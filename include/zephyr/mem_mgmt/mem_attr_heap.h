@@ -87,6 +87,53 @@ void mem_attr_heap_free(void *block);
  */
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr);
 
+/**
+ * @brief Memory region allocation statistics
+ *
+ * Only available with CONFIG_MEM_ATTR_HEAP_AFFINITY.
+ */
+struct mem_attr_heap_stats {
+	/** Allocations made from a CPU the region is local to */
+	uint32_t local_allocs;
+	/** Allocations made from another CPU, its local regions being exhausted */
+	uint32_t remote_allocs;
+	/** Allocations from a CPU the region is local to that did not fit */
+	uint32_t local_misses;
+};
+
+/**
+ * @brief Set the CPUs a memory region is local to
+ *
+ * Allocations first try the regions with the requested attribute that are
+ * local to the current CPU, and only fall back to the other regions with
+ * that attribute when they are exhausted. By default, every region is
+ * local to all CPUs.
+ *
+ * Requires CONFIG_MEM_ATTR_HEAP_AFFINITY.
+ *
+ * @param region memory region descriptor, as returned by @ref
+ *		 mem_attr_get_regions or @ref mem_attr_heap_get_region.
+ * @param cpu_mask bit mask of the CPUs the region is local to.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if no heap is backed by @p region.
+ */
+int mem_attr_heap_set_cpu_affinity(const struct mem_attr_region_t *region, uint32_t cpu_mask);
+
+/**
+ * @brief Get the allocation statistics of a memory region
+ *
+ * Requires CONFIG_MEM_ATTR_HEAP_AFFINITY.
+ *
+ * @param region memory region descriptor.
+ * @param stats filled with the statistics of @p region.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if no heap is backed by @p region.
+ */
+int mem_attr_heap_get_stats(const struct mem_attr_region_t *region,
+			    struct mem_attr_heap_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -201,6 +201,9 @@ struct img_mgmt_upload_req {
 	struct zcbor_string img_data;
 	struct zcbor_string data_sha;
 	bool upgrade;			/* Only allow greater version numbers. */
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	bool delta;			/* Data is a patch against the active image. */
+#endif
 };
 
 /** Global state for upload in progress. */
@@ -214,6 +217,14 @@ struct img_mgmt_state {
 	/** Hash of image data; used for resumption of a partial upload. */
 	uint8_t data_sha_len;
 	uint8_t data_sha[IMG_MGMT_DATA_SHA_LEN];
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	/** Whether the upload is a patch against the active image. */
+	bool delta;
+	/** Flash area holding the image the patch applies to. */
+	int delta_base_area_id;
+	/** Size of the image reconstructed from the patch. */
+	size_t delta_size;
+#endif
 };
 
 /** Describes what to do during processing of an upload request. */
@@ -228,6 +239,10 @@ struct img_mgmt_upload_action {
 	bool proceed;
 	/** Whether to erase the destination flash area. */
 	bool erase;
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	/** Size of the image reconstructed from the patch, for delta uploads. */
+	size_t delta_size;
+#endif
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 	/** "rsn" string to be sent as explanation for "rc" code */
 	const char *rc_rsn;
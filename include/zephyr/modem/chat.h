@@ -257,6 +257,9 @@ struct modem_chat {
 	 */
 	const struct modem_chat_match *matches[3];
 	uint16_t matches_size[3];
+	/* Size of the longest match of each matches type, computed once per line */
+	uint8_t matches_max_size[3];
+	bool matches_max_size_valid;
 
 	/* Script execution */
 	const struct modem_chat_script *script;
@@ -291,6 +291,18 @@ struct coap_resource {
 	sys_slist_t observers;
 	/** Resource age */
 	int age;
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX) || defined(__DOXYGEN__)
+	/**
+	 * Hash of the resource path.
+	 * @kconfig_dep{CONFIG_COAP_SERVER_RESOURCE_INDEX}
+	 */
+	uint32_t path_hash;
+	/**
+	 * Next resource of the same index bucket.
+	 * @kconfig_dep{CONFIG_COAP_SERVER_RESOURCE_INDEX}
+	 */
+	struct coap_resource *index_next;
+#endif
 };
 
 /**
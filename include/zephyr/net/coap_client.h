@@ -142,6 +142,31 @@ struct coap_client_request {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_WINDOW) && CONFIG_COAP_CLIENT_BLOCK2_WINDOW > 1
+#define COAP_CLIENT_BLOCK2_WINDOW CONFIG_COAP_CLIENT_BLOCK2_WINDOW
+#else
+#define COAP_CLIENT_BLOCK2_WINDOW 1
+#endif
+
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+struct coap_client_block_slot {
+	struct coap_pending pending;
+	uint32_t num;
+	uint16_t len;
+	uint8_t buf[MAX_COAP_MSG_LEN];
+};
+
+struct coap_client_block_window {
+	struct coap_client_block_slot slots[COAP_CLIENT_BLOCK2_WINDOW];
+	/* Blocks in [next, end) are requested or received, next being the first to deliver */
+	uint32_t next;
+	uint32_t end;
+	/* Last block of the transfer, UINT32_MAX until known */
+	uint32_t last;
+	bool active;
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -160,6 +185,10 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+	struct coap_client_block_window window;
+#endif
 };
 
 struct coap_client {
@@ -47,6 +47,10 @@ struct coap_service_data {
 	int sock_fd;
 	struct coap_observer observers[CONFIG_COAP_SERVICE_OBSERVERS];
 	struct coap_pending pending[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	struct coap_resource *res_buckets[CONFIG_COAP_SERVER_RESOURCE_INDEX_BUCKETS];
+	struct coap_resource *res_wildcards;
+#endif
 };
 
 struct coap_service {
@@ -307,6 +311,27 @@ int coap_resource_send(const struct coap_resource *resource, const struct coap_p
 		       const struct sockaddr *addr, socklen_t addr_len,
 		       const struct coap_transmission_parameters *params);
 
+/**
+ * @brief Send the same notification to all observers of the provided @p resource .
+ *
+ * @note This function is suitable for a @p resource defined with @ref COAP_RESOURCE_DEFINE.
+ *
+ * The notification is built once in @p cpkt, with its type, code, options and payload, and
+ * each observer is sent a copy of it patched with the token of the observer and a new message
+ * ID. The token and message ID of @p cpkt are ignored. Observers with the same token length
+ * share the copy of the options and payload, which makes notifying many observers much
+ * cheaper than building a packet for each of them in the @ref coap_resource.notify callback.
+ *
+ * @param resource Pointer to CoAP resource
+ * @param cpkt CoAP notification to send, including its Observe option
+ * @param params Pointer to transmission parameters structure or NULL to use default values.
+ * @return 0 in case of success or the first error met while sending to the observers. The
+ * notification is still sent to the remaining observers after an error.
+ */
+int coap_resource_send_notification(const struct coap_resource *resource,
+				    const struct coap_packet *cpkt,
+				    const struct coap_transmission_parameters *params);
+
 /**
  * @brief Parse a CoAP observe request for the provided @p resource .
  *
@@ -206,6 +206,18 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported. The driver splits TCP packets
+	 * that have a non-zero net_pkt_tso_size() into segments of that
+	 * size, and computes their IPv4 and TCP checksums.
+	 */
+	ETHERNET_HW_TCP_TSO		= BIT(21),
+
+	/** Partial TX checksum offloading supported. The driver completes
+	 * the UDP and TCP checksums of packets in the NET_PKT_CHKSUM_PARTIAL
+	 * state, for which the stack only computed the pseudo-header sum.
+	 */
+	ETHERNET_HW_TX_CHKSUM_PARTIAL	= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -733,6 +745,65 @@ struct ethernet_context {
  */
 void ethernet_init(struct net_if *iface);
 
+struct net_eth_napi;
+
+/**
+ * @brief Poll handler of a polled receive context
+ *
+ * @param napi Polled receive context
+ * @param budget Maximum number of frames to receive
+ *
+ * @return Number of frames received. Returning less than @p budget means that
+ * the driver has no more frames pending.
+ */
+typedef int (*net_eth_napi_poll_t)(struct net_eth_napi *napi, int budget);
+
+/**
+ * @brief Completion handler of a polled receive context
+ *
+ * @details Called once the driver has no more frames pending. It must unmask
+ * the RX interrupt, such that frames received in the meantime raise it.
+ *
+ * @param napi Polled receive context
+ */
+typedef void (*net_eth_napi_complete_t)(struct net_eth_napi *napi);
+
+/**
+ * @brief Polled receive context of an Ethernet driver
+ *
+ * @details Drivers embed it in their data, and use CONTAINER_OF() in their
+ * handlers to get back to it.
+ */
+struct net_eth_napi {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	atomic_t scheduled;
+	net_eth_napi_poll_t poll;
+	net_eth_napi_complete_t complete;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a polled receive context
+ *
+ * @param napi Polled receive context
+ * @param poll Handler receiving the pending frames
+ * @param complete Handler unmasking the RX interrupt
+ */
+void net_eth_napi_init(struct net_eth_napi *napi, net_eth_napi_poll_t poll,
+		       net_eth_napi_complete_t complete);
+
+/**
+ * @brief Schedule the poll handler of a polled receive context
+ *
+ * @details Typically called from the RX interrupt handler, after masking the
+ * RX interrupt. Calling it while the context is already scheduled has no
+ * effect. Requires @kconfig{CONFIG_NET_ETHERNET_NAPI}.
+ *
+ * @param napi Polled receive context
+ */
+void net_eth_napi_schedule(struct net_eth_napi *napi);
+
 #define ETHERNET_L2_CTX_TYPE	struct ethernet_context
 
 /* Separate header for VLAN as some of device interfaces might not
@@ -40,6 +40,19 @@ extern "C" {
 #define NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT 1
 #endif
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+struct eth_bridge_fdb_entry {
+	/* Learned source MAC address */
+	uint8_t addr[6];
+
+	/* Index of the port in eth_iface plus one, 0 if never used */
+	uint8_t port;
+
+	/* Uptime in seconds when the address was last seen */
+	uint32_t seen;
+};
+#endif
+
 struct eth_bridge_iface_context {
 	/* Lock to protect access to interface array below */
 	struct k_mutex lock;
@@ -50,6 +63,11 @@ struct eth_bridge_iface_context {
 	/* What Ethernet interfaces are bridged together */
 	struct net_if *eth_iface[NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT];
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	/* Forwarding database, open addressing hashed on the MAC address */
+	struct eth_bridge_fdb_entry fdb[CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE];
+#endif
+
 	/* How many interfaces are bridged atm */
 	size_t count;
 
@@ -100,8 +100,10 @@ enum http_hpack_static_key {
 
 #if defined(CONFIG_HTTP_SERVER)
 #define HTTP_SERVER_HUFFMAN_DECODE_BUFFER_SIZE CONFIG_HTTP_SERVER_HUFFMAN_DECODE_BUFFER_SIZE
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE
 #else
 #define HTTP_SERVER_HUFFMAN_DECODE_BUFFER_SIZE 0
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE 0
 #endif
 
 /** @endcond */
@@ -129,6 +131,39 @@ struct http_hpack_header_buf {
 
 /** @cond INTERNAL_HIDDEN */
 
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+/** HPACK encoder dynamic table. */
+struct http_hpack_table {
+	/** Entries, oldest first, each stored as name length, value length,
+	 *  name and value.
+	 */
+	uint8_t buf[HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE];
+
+	/** Number of bytes used in the entries buffer. */
+	uint16_t len;
+
+	/** Size of the table, as defined by RFC 7541, ch. 4.1. */
+	uint16_t size;
+
+	/** Maximum size of the table. */
+	uint16_t max_size;
+
+	/** Number of entries. */
+	uint8_t count;
+
+	/** The maximum size must be signalled in the next header block. */
+	bool size_update;
+};
+
+void http_hpack_table_init(struct http_hpack_table *table);
+void http_hpack_table_set_max_size(struct http_hpack_table *table, uint32_t max_size);
+int http_hpack_encode_table_size_update(uint8_t *buf, size_t buflen,
+					struct http_hpack_table *table);
+int http_hpack_encode_header_table(uint8_t *buf, size_t buflen,
+				   struct http_hpack_header_buf *header,
+				   struct http_hpack_table *table);
+#endif /* HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0 */
+
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
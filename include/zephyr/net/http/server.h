@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 
+#include <zephyr/fs/fs.h>
 #include <zephyr/kernel.h>
 #include <zephyr/net/http/parser.h>
 #include <zephyr/net/http/hpack.h>
@@ -361,6 +362,22 @@ struct http2_stream_ctx {
 
 	/** Flag indicating that END_STREAM flag was sent. */
 	bool end_stream_sent : 1;
+
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	/** Stream-level send window size. */
+	int32_t tx_window;
+
+	/** Static resource body left to send. */
+	const uint8_t *tx_data;
+
+	/** Number of body bytes left to send. */
+	size_t tx_remaining;
+
+	/** Stream priority weight, 1 to 256. */
+	uint16_t weight;
+#endif
+/** @endcond */
 };
 
 /** @brief HTTP/2 frame representation. */
@@ -443,6 +460,30 @@ struct http_client_ctx {
 	/** HTTP/2 streams context. */
 	struct http2_stream_ctx streams[HTTP_SERVER_MAX_STREAMS];
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	/** HTTP/2 frames waiting to be written to the socket. */
+	uint8_t http2_tx_buf[CONFIG_HTTP_SERVER_HTTP2_TX_BUF_SIZE];
+
+	/** Length of the data in the HTTP/2 output buffer. */
+	size_t http2_tx_len;
+
+	/** Connection-level send window size. */
+	int32_t http2_tx_window;
+
+	/** Initial send window size of the streams, set by the client. */
+	int32_t http2_peer_window_size;
+
+	/** Maximum frame payload size accepted by the client. */
+	uint32_t http2_peer_max_frame_size;
+#endif
+
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+	/** HPACK encoder dynamic table. */
+	struct http_hpack_table hpack_table;
+#endif
+/** @endcond */
+
 	/** HTTP/1 parser configuration. */
 	struct http_parser_settings parser_settings;
 
@@ -490,6 +531,28 @@ struct http_client_ctx {
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (uint8_t supported_compression));
 /** @endcond */
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+	/** Static resource body being sent (HTTP/1 only). */
+	struct {
+		/** Next static data to send, NULL when sending a file. */
+		const uint8_t *data;
+		/** Number of body bytes left to send. */
+		size_t remaining;
+#if defined(CONFIG_FILE_SYSTEM)
+		/** File being sent. */
+		struct fs_file_t file;
+#endif
+		/** Data to send after the body, or NULL. */
+		const char *trailer;
+		/** A body is being sent. */
+		bool active;
+		/** Close the connection once the body was sent. */
+		bool close;
+	} tx;
+#endif
+/** @endcond */
+
 	/** Flag indicating that HTTP2 preface was sent. */
 	bool preface_sent : 1;
 
@@ -731,6 +731,25 @@ struct mqtt_client;
 typedef void (*mqtt_evt_cb_t)(struct mqtt_client *client,
 			      const struct mqtt_evt *evt);
 
+/**
+ * @brief Callback receiving the payload of a PUBLISH message in chunks.
+ *
+ * Called from mqtt_input() with the payload of the message last notified
+ * with @ref MQTT_EVT_PUBLISH, in order, as it comes in.
+ *
+ * @param[in] client Identifies the client which received the message.
+ * @param[in] data Next chunk of the payload, only valid during the call.
+ * @param[in] len Length of @p data.
+ * @param[in] remaining Payload length still to come after this chunk, 0 for
+ *                      the last chunk.
+ *
+ * @return 0 to go on, a negative error code to have the rest of the payload
+ *         dropped.
+ */
+typedef int (*mqtt_payload_cb_t)(struct mqtt_client *client,
+				 const uint8_t *data, size_t len,
+				 uint32_t remaining);
+
 /** @brief TLS configuration for secure MQTT transports. */
 struct mqtt_sec_config {
 	/** Indicates the preference for peer verification. */
@@ -880,6 +899,20 @@ struct mqtt_internal {
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
 
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM) || defined(__DOXYGEN__)
+	/** Internal. Drop the rest of the payload being streamed. */
+	bool payload_discard;
+#endif /* CONFIG_MQTT_PAYLOAD_STREAM */
+
+#if (defined(CONFIG_MQTT_INFLIGHT_WINDOW) && (CONFIG_MQTT_INFLIGHT_WINDOW > 0)) ||                 \
+	defined(__DOXYGEN__)
+	/** Internal. Message IDs of the QoS 1 and QoS 2 messages in flight. */
+	uint16_t inflight[CONFIG_MQTT_INFLIGHT_WINDOW];
+
+	/** Internal. Number of messages in flight. */
+	uint8_t inflight_count;
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 #if defined(CONFIG_MQTT_VERSION_5_0) || defined(__DOXYGEN__)
 	/** Internal. MQTT 5.0 topic alias mapping. */
 	struct mqtt_topic_alias topic_aliases[CONFIG_MQTT_TOPIC_ALIAS_MAX];
@@ -957,6 +990,14 @@ struct mqtt_client {
 	 */
 	mqtt_evt_cb_t evt_cb;
 
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM) || defined(__DOXYGEN__)
+	/** Application callback the payload of received PUBLISH messages is
+	 *  streamed to, through the receive buffer. When NULL, the
+	 *  application reads the payload with mqtt_read_publish_payload().
+	 */
+	mqtt_payload_cb_t payload_cb;
+#endif /* CONFIG_MQTT_PAYLOAD_STREAM */
+
 	/** Receive buffer used for MQTT packet reception in RX path. */
 	uint8_t *rx_buf;
 
@@ -1079,11 +1120,41 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note With @kconfig{CONFIG_MQTT_INFLIGHT_WINDOW} set, a QoS 1 or QoS 2
+ *       message is refused with -EAGAIN while the inflight window is full,
+ *       and with -EBUSY if its message id is still in flight and the message
+ *       is not a retransmission, flagged with dup_flag.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish several messages at once.
+ *
+ * The messages are encoded one after the other in the TX buffer and handed
+ * to the transport in a single write, so that small messages share network
+ * packets rather than taking one each.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] params Parameters of the publish messages, in the order they are
+ *                   sent. Shall not be NULL.
+ * @param[in] count Number of messages in @p params, at most
+ *                  @kconfig{CONFIG_MQTT_PUBLISH_MULTI_MAX}.
+ *
+ * @note Either all messages are sent or none is, unless the transport write
+ *       fails, in which case the connection is closed.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -ENOMEM if the headers of the messages do not fit in the TX buffer,
+ *         -EAGAIN if the QoS 1 and QoS 2 messages do not fit in the inflight
+ *         window.
+ */
+int mqtt_publish_multi(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
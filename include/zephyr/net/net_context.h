@@ -290,6 +290,11 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** Event polling instances monitoring the socket */
+	sys_slist_t epoll_items;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -1290,6 +1295,36 @@ int net_context_sendto(struct net_context *context,
 		       k_timeout_t timeout,
 		       void *user_data);
 
+/**
+ * @brief Send network buffers to a peer without copying them.
+ *
+ * @details The data held in the fragment chain is sent as is, for UDP
+ * in a single datagram, and for TCP as soon as the whole of it fits in
+ * the send window. The stack takes its own references to the buffers,
+ * which it keeps until the data is sent (UDP) or acknowledged (TCP).
+ * The caller releases its reference as usual, and learns that the data
+ * is not used anymore from the destroy callback of the buffer pool. The
+ * buffers must not be modified until then.
+ *
+ * @param context The network context to use.
+ * @param frags The fragment chain to send
+ * @param dst_addr Destination address, NULL for the connected peer.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the send attempt.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, -EAGAIN if a TCP send window
+ *         has not enough room yet, a negative errno otherwise
+ */
+int net_context_send_frags(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data);
+
 /**
  * @brief Send data in iovec to a peer specified in msghdr struct.
  *
@@ -129,6 +129,23 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+/**
+ * @brief Push a batch of received network packets up in the network stack
+ *
+ * @details Same as calling net_recv_data() for each packet, but the
+ * threads handling the packets are only scheduled once the whole batch is
+ * queued. Unlike with net_recv_data(), the packets that cannot be received
+ * are released by this function. This must be called from thread context,
+ * typically from a polled receive handler.
+ *
+ * @param iface Network interface where the packets were received.
+ * @param pkts Array of network packets.
+ * @param count Number of packets in @p pkts.
+ *
+ * @return Number of packets pushed up in the network stack.
+ */
+size_t net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count);
+
 /**
  * @brief Try sending data to network.
  *
@@ -2987,6 +2987,16 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface,
 bool net_if_need_calc_tx_checksum(struct net_if *iface,
 				  enum net_if_checksum_type chksum_type);
 
+/**
+ * @brief Check if the interface can complete partial transport checksums of
+ * sent packets, the stack only computing the sum of the pseudo-header.
+ *
+ * @param iface Network interface
+ *
+ * @return True if partial checksums are supported, false otherwise.
+ */
+bool net_if_support_tx_partial_checksum(struct net_if *iface);
+
 /**
  * @brief Get interface according to index
  *
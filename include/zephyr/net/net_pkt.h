@@ -82,6 +82,25 @@ struct net_pkt_cursor {
 
 /** @endcond */
 
+/** @brief Per-packet checksum state */
+enum net_pkt_chksum_state {
+	/** Checksums are handled according to the interface capabilities */
+	NET_PKT_CHKSUM_NONE = 0,
+	/** Sent packet: the checksum field of the transport header holds the
+	 * pseudo-header sum, and the driver must add the sum of the transport
+	 * header and payload to it and store its complement.
+	 */
+	NET_PKT_CHKSUM_PARTIAL,
+	/** Received packet: the driver verified the IPv4 header, UDP and TCP
+	 * checksums of the packet.
+	 */
+	NET_PKT_CHKSUM_VERIFIED,
+	/** Checksums need neither be computed nor verified, for instance
+	 * because the packet never leaves the device.
+	 */
+	NET_PKT_CHKSUM_UNNECESSARY,
+};
+
 /**
  * @brief Network packet.
  *
@@ -237,6 +256,7 @@ struct net_pkt {
 	uint8_t chksum_done : 1; /* Checksum has already been computed for
 				  * the packet.
 				  */
+	uint8_t chksum_state : 2; /* enum net_pkt_chksum_state */
 	uint8_t loopback : 1; /* Packet is a loop back packet. */
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
@@ -306,6 +326,13 @@ struct net_pkt {
 	/** IPv4/IPv6 Explicit Congestion Notification value. */
 	uint8_t ip_ecn : 2;
 #endif /* CONFIG_NET_IP_DSCP_ECN */
+
+#if defined(CONFIG_NET_TCP_TSO)
+	/* Segment size the hardware must split the TCP payload into,
+	 * 0 if the packet must be sent as is.
+	 */
+	uint16_t tso_size;
+#endif /* CONFIG_NET_TCP_TSO */
 #endif /* CONFIG_NET_IP */
 
 #if defined(CONFIG_NET_VLAN)
@@ -335,6 +362,19 @@ struct net_pkt {
 	 */
 	uint8_t priority;
 
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+	/* Hash of the flow the packet belongs to, 0 if not known yet */
+	uint32_t flow_hash;
+#endif /* CONFIG_NET_TC_FLOW_STEERING */
+
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	/* Checksum of the data following the transport header, computed
+	 * while it was written, valid if data_chksum_done is set.
+	 */
+	uint16_t data_chksum;
+	uint8_t data_chksum_done : 1;
+#endif /* CONFIG_NET_UDP_CHECKSUM_COPY */
+
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_L2_IPIP)
 	/* Remote address of the received packet. This is only used by
 	 * network interfaces with an offloaded TCP/IP stack, or if we
@@ -576,6 +616,34 @@ static inline void net_pkt_set_chksum_done(struct net_pkt *pkt,
 	pkt->chksum_done = is_chksum_done;
 }
 
+/**
+ * @brief Get the checksum state of a packet
+ *
+ * @param pkt Network packet
+ *
+ * @return Checksum state of the packet
+ */
+static inline enum net_pkt_chksum_state net_pkt_chksum_state(struct net_pkt *pkt)
+{
+	return (enum net_pkt_chksum_state)pkt->chksum_state;
+}
+
+/**
+ * @brief Set the checksum state of a packet
+ *
+ * @details Drivers of interfaces with RX checksum offload can set
+ * NET_PKT_CHKSUM_VERIFIED on the packets the hardware verified, so that the
+ * stack skips the verification packet by packet.
+ *
+ * @param pkt Network packet
+ * @param state Checksum state of the packet
+ */
+static inline void net_pkt_set_chksum_state(struct net_pkt *pkt,
+					    enum net_pkt_chksum_state state)
+{
+	pkt->chksum_state = state;
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -873,6 +941,31 @@ static inline void net_pkt_set_ipv4_pmtu(struct net_pkt *pkt, bool value)
 }
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_TCP_TSO)
+static inline uint16_t net_pkt_tso_size(struct net_pkt *pkt)
+{
+	return pkt->tso_size;
+}
+
+static inline void net_pkt_set_tso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->tso_size = size;
+}
+#else
+static inline uint16_t net_pkt_tso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_tso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_NET_TCP_TSO */
+
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
 static inline uint16_t net_pkt_ipv4_fragment_offset(struct net_pkt *pkt)
 {
@@ -1070,6 +1163,101 @@ static inline void net_pkt_set_priority(struct net_pkt *pkt,
 	pkt->priority = priority;
 }
 
+/**
+ * @brief Get the flow hash of a packet
+ *
+ * @details Packets of the same flow (IP addresses, protocol and ports)
+ * have the same hash. Multi-queue drivers can use it to select a TX queue.
+ *
+ * @param pkt Network packet
+ *
+ * @return Flow hash, 0 if not known
+ */
+static inline uint32_t net_pkt_flow_hash(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+	return pkt->flow_hash;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+/**
+ * @brief Set the flow hash of a packet
+ *
+ * @details Drivers can set the hash computed by the hardware (RSS) for
+ * received packets, the stack then uses it to select the RX queue.
+ *
+ * @param pkt Network packet
+ * @param hash Flow hash
+ */
+static inline void net_pkt_set_flow_hash(struct net_pkt *pkt, uint32_t hash)
+{
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+	pkt->flow_hash = hash;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hash);
+#endif
+}
+
+/**
+ * @brief Check if the checksum of the packet data is known
+ *
+ * @param pkt Network packet
+ *
+ * @return True if the checksum of the data following the transport header
+ *         was computed while it was written, false otherwise
+ */
+static inline bool net_pkt_is_data_chksum_done(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	return !!(pkt->data_chksum_done);
+#else
+	ARG_UNUSED(pkt);
+
+	return false;
+#endif
+}
+
+/**
+ * @brief Get the checksum of the packet data
+ *
+ * @param pkt Network packet
+ *
+ * @return One's complement sum of the data following the transport header,
+ *         valid if net_pkt_is_data_chksum_done() returns true
+ */
+static inline uint16_t net_pkt_data_chksum(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	return pkt->data_chksum;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+/**
+ * @brief Set the checksum of the packet data
+ *
+ * @param pkt Network packet
+ * @param sum One's complement sum of the data following the transport header
+ */
+static inline void net_pkt_set_data_chksum(struct net_pkt *pkt, uint16_t sum)
+{
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+	pkt->data_chksum = sum;
+	pkt->data_chksum_done = 1U;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(sum);
+#endif
+}
+
 #if defined(CONFIG_NET_CAPTURE_COOKED_MODE)
 static inline bool net_pkt_is_cooked_mode(struct net_pkt *pkt)
 {
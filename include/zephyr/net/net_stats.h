@@ -172,6 +172,12 @@ struct net_stats_tcp {
 
 	/** Number of connection attempts for closed ports, triggering a RST. */
 	net_stats_t connrst;
+
+	/** Number of round-trip time samples taken. */
+	net_stats_t rtt_samples;
+
+	/** Sum of the round-trip time samples, in milliseconds. */
+	net_stats_t rtt_total;
 };
 
 /**
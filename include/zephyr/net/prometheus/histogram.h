@@ -21,6 +21,7 @@
 #include <zephyr/net/prometheus/metric.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief Prometheus histogram bucket definition.
@@ -105,6 +106,22 @@ struct prometheus_histogram {
  */
 int prometheus_histogram_observe(struct prometheus_histogram *histogram, double value);
 
+/**
+ * @brief Set the bucket counts of a Prometheus histogram metric
+ *
+ * Replaces the bucket counts, the total count and the sum of the given
+ * histogram metric. This exports histograms maintained elsewhere, such as the
+ * ones in k_thread_runtime_stats_t, without observing every value again.
+ *
+ * @param histogram Pointer to the histogram metric to set.
+ * @param counts Number of observations in each bucket.
+ * @param num_counts Number of entries in counts, must match the number of buckets.
+ * @param sum Sum of all observed values.
+ * @return 0 on success, -EINVAL if the number of counts does not match.
+ */
+int prometheus_histogram_set(struct prometheus_histogram *histogram, const uint32_t *counts,
+			     size_t num_counts, double sum);
+
 /**
  * @}
  */
@@ -78,6 +78,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Turn on ZSOCK_MSG_DONTWAIT after the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -538,6 +540,113 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Send several messages with a single call
+ *
+ * @details
+ * Same as calling zsock_sendmsg() for each element of @p msgvec, but
+ * with a single socket lookup and lock, and a single system call for user
+ * mode threads. The number of bytes sent for each message is stored in its
+ * @c msg_len field. See Linux man 2 sendmmsg for the full description.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Array of messages to send
+ * @param vlen Number of elements in @p msgvec
+ * @param flags Flags, as for zsock_sendmsg()
+ *
+ * @return Number of messages sent, or -1 with errno set if the first one
+ *         could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags);
+
+/**
+ * @brief Receive several messages with a single call
+ *
+ * @details
+ * Same as calling zsock_recvmsg() for each element of @p msgvec, but
+ * with a single socket lookup and lock, and a single system call for user
+ * mode threads. The length of each message is stored in its @c msg_len
+ * field. With ZSOCK_MSG_WAITFORONE in @p flags, only the first message is
+ * waited for. If @p timeout is not NULL, no more messages are received
+ * once it expired, it is only checked after each received message. See
+ * Linux man 2 recvmmsg for the full description.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Array of messages to fill in
+ * @param vlen Number of elements in @p msgvec
+ * @param flags Flags, as for zsock_recvmsg(), plus ZSOCK_MSG_WAITFORONE
+ * @param timeout Maximum duration of the call, or NULL
+ *
+ * @return Number of messages received, or -1 with errno set if the first
+ *         one could not be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags, struct timespec *timeout);
+
+struct net_buf;
+
+/**
+ * @brief Receive a datagram without copying its payload
+ *
+ * @details
+ * Same as zsock_recvfrom() for datagram sockets, except that the payload
+ * is not copied to a user buffer. Instead, the network buffers holding it
+ * are handed to the caller, which must release them with net_buf_unref()
+ * once done with the data. Only ZSOCK_MSG_DONTWAIT is supported in
+ * @p flags. Holding the buffers for long starves the network stack of
+ * receive buffers.
+ *
+ * This API is only available to kernel threads, and requires
+ * @kconfig{CONFIG_NET_SOCKETS_RECV_ZEROCOPY}.
+ *
+ * @param sock Datagram socket
+ * @param frags Set to the fragment chain holding the payload, NULL if the
+ *        datagram is empty
+ * @param flags Flags
+ * @param src_addr Source address of the datagram, can be NULL
+ * @param addrlen Length of src_addr, updated to the actual length
+ *
+ * @return Length of the payload, -1 and errno set on error
+ */
+ssize_t zsock_recv_zerocopy(int sock, struct net_buf **frags, int flags,
+			    struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Send network buffers without copying their data
+ *
+ * @details
+ * Same as zsock_sendto(), except that the data is not copied but sent
+ * from the network buffers given by the caller, which can wrap application
+ * memory with net_buf_alloc_with_data(). A UDP socket sends the whole
+ * chain in one datagram. A TCP socket queues the whole chain once the send
+ * window has room for it, so the chain must not exceed the peer window.
+ *
+ * The stack takes its own references to the buffers, which it keeps
+ * until the data is sent (UDP) or acknowledged (TCP). The caller releases
+ * its reference with net_buf_unref() as usual, and the destroy callback
+ * of the buffer pool tells when the data is not used anymore. The buffers
+ * must not be modified until then. Only ZSOCK_MSG_DONTWAIT is supported
+ * in @p flags.
+ *
+ * This API is only available to kernel threads, and requires
+ * @kconfig{CONFIG_NET_SOCKETS_SEND_ZEROCOPY}.
+ *
+ * @param sock UDP or TCP socket
+ * @param frags Fragment chain holding the data
+ * @param flags Flags
+ * @param dest_addr Destination address, NULL for the connected peer
+ * @param addrlen Length of dest_addr
+ *
+ * @return Number of bytes sent, -1 and errno set on error
+ */
+ssize_t zsock_send_zerocopy(int sock, struct net_buf *frags, int flags,
+			    const struct sockaddr *dest_addr, socklen_t addrlen);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -960,6 +1069,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, as a string such as "reno" or "cubic" */
+#define TCP_CONGESTION 13
 
 /** @} */
 
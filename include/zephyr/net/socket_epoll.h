@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @brief BSD socket event polling API
+ *
+ * An epoll-like interface keeping a persistent set of monitored sockets, so
+ * that waiting for events does not cost more with the number of sockets.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD socket event polling API
+ * @defgroup bsd_socket_epoll BSD socket event polling API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/types.h>
+#include <zephyr/net/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** zsock_epoll: The socket is readable */
+#define ZSOCK_EPOLLIN ZSOCK_POLLIN
+/** zsock_epoll: The socket has urgent data */
+#define ZSOCK_EPOLLPRI ZSOCK_POLLPRI
+/** zsock_epoll: The socket is writable */
+#define ZSOCK_EPOLLOUT ZSOCK_POLLOUT
+/** zsock_epoll: Error on the socket, always reported */
+#define ZSOCK_EPOLLERR ZSOCK_POLLERR
+/** zsock_epoll: The connection was closed, always reported */
+#define ZSOCK_EPOLLHUP ZSOCK_POLLHUP
+/** zsock_epoll: Report events only when new ones occur (edge-triggered) */
+#define ZSOCK_EPOLLET BIT(31)
+/** zsock_epoll: Stop monitoring the socket after the first reported event */
+#define ZSOCK_EPOLLONESHOT BIT(30)
+
+/** zsock_epoll_ctl: Add a socket to the monitored set */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Remove a socket from the monitored set */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl: Change the monitored events of a socket */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** User data reported with the events of a socket */
+union zsock_epoll_data {
+	void *ptr;     /**< Pointer */
+	int fd;        /**< File descriptor */
+	uint32_t u32;  /**< 32-bit value */
+	uint64_t u64;  /**< 64-bit value */
+};
+
+/** Events monitored on, or reported for, a socket */
+struct zsock_epoll_event {
+	uint32_t events;             /**< ZSOCK_EPOLL* event mask and flags */
+	union zsock_epoll_data data; /**< User data */
+};
+
+/**
+ * @brief Create an event polling instance
+ *
+ * The instance is closed with zsock_close().
+ *
+ * @param flags Must be 0.
+ *
+ * @return File descriptor of the instance, or -1 with errno set.
+ */
+int zsock_epoll_create(int flags);
+
+/**
+ * @brief Change the set of sockets monitored by an event polling instance
+ *
+ * Only native network stack sockets can be monitored. Closed sockets are
+ * removed from all the instances monitoring them.
+ *
+ * @param epfd Event polling instance
+ * @param op ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD or ZSOCK_EPOLL_CTL_DEL
+ * @param fd Socket
+ * @param event Events to monitor and user data to report with them, ignored
+ *        by ZSOCK_EPOLL_CTL_DEL.
+ *
+ * @return 0 if ok, -1 with errno set otherwise.
+ */
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on the sockets monitored by an event polling instance
+ *
+ * @param epfd Event polling instance
+ * @param events Where to store the events of the ready sockets
+ * @param maxevents Maximum number of events to store
+ * @param timeout Timeout in milliseconds, -1 to wait forever.
+ *
+ * @return Number of events stored, 0 on timeout, -1 with errno set on error.
+ */
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events, int maxevents,
+		     int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file
+ * @brief BSD socket RTIO backend
+ *
+ * RTIO I/O devices that receive from and send to a socket, so that a single
+ * thread can keep reads and writes outstanding on many sockets and reap
+ * their completions from an RTIO completion queue.
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+
+/**
+ * @brief BSD socket RTIO backend
+ * @defgroup bsd_socket_rtio BSD socket RTIO backend
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Per-socket state of a socket RTIO device. The queues are filled by the
+ * submitters and drained by the socket RTIO thread only.
+ */
+struct zsock_rtio_data {
+	sys_snode_t node;
+	struct mpsc_node new_node;
+	struct mpsc rx_q;
+	struct mpsc tx_q;
+	struct rtio_iodev_sqe *rx;
+	struct rtio_iodev_sqe *tx;
+	atomic_t active;
+	atomic_t kick;
+	int fd;
+};
+
+extern const struct rtio_iodev_api zsock_rtio_iodev_api;
+
+/** @endcond */
+
+/**
+ * @brief Statically define a socket RTIO device
+ *
+ * The device is not usable until a socket is attached to it with
+ * zsock_rtio_iodev_set_fd(). @ref RTIO_OP_RX submissions receive from the
+ * socket as zsock_recv() would, and @ref RTIO_OP_TX or @ref RTIO_OP_TINY_TX
+ * submissions send to it as zsock_send() would, the result of the completion
+ * being the number of bytes received or sent, or a negative errno value.
+ * Receives and sends are each completed in submission order.
+ *
+ * @param name Name of the RTIO device
+ */
+#define ZSOCK_RTIO_IODEV_DEFINE(name)						\
+	static struct zsock_rtio_data _zsock_rtio_data_##name = {		\
+		.rx_q = MPSC_INIT(_zsock_rtio_data_##name.rx_q),		\
+		.tx_q = MPSC_INIT(_zsock_rtio_data_##name.tx_q),		\
+		.fd = -1,							\
+	};									\
+	RTIO_IODEV_DEFINE(name, &zsock_rtio_iodev_api, &_zsock_rtio_data_##name)
+
+/**
+ * @brief Attach a socket to a socket RTIO device
+ *
+ * This must not be called while submissions are pending on the device.
+ *
+ * @param iodev RTIO device defined with @ref ZSOCK_RTIO_IODEV_DEFINE
+ * @param fd Socket to receive from and send to, or -1 to detach the socket.
+ *
+ * @return 0 if ok, -EBUSY if submissions are pending on the device.
+ */
+int zsock_rtio_iodev_set_fd(const struct rtio_iodev *iodev, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_ */
@@ -40,6 +40,9 @@ extern "C" {
 #define WEBSOCKET_FLAG_PING   0x00000010 /**< Ping message       */
 #define WEBSOCKET_FLAG_PONG   0x00000020 /**< Pong message       */
 
+/** Space to reserve in front of the payload given to websocket_send_msg_inplace() */
+#define WEBSOCKET_HEADROOM 14
+
 /** @brief Websocket option codes */
 enum websocket_opcode  {
 	WEBSOCKET_OPCODE_CONTINUE     = 0x00, /**< Message continues */
@@ -154,11 +157,38 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout);
 
+/**
+ * @brief Send websocket msg to peer without copying it.
+ *
+ * @details Same as websocket_send_msg() except that the header is written in
+ * the WEBSOCKET_HEADROOM bytes reserved in front of the payload, and that the
+ * payload is masked in place, so it is neither copied nor allocated. The
+ * payload is left masked when @p mask is set.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param buf Buffer holding WEBSOCKET_HEADROOM bytes followed by the payload.
+ * @param payload_len Length of the payload following the headroom.
+ * @param opcode Operation code (text, binary, ping, pong, close)
+ * @param mask Mask the data, see RFC 6455 for details
+ * @param final Is this final message for this message send, see
+ *        websocket_send_msg().
+ * @param timeout How long to try to send the message. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @return <0 if error, >=0 amount of payload bytes sent
+ */
+int websocket_send_msg_inplace(int ws_sock, uint8_t *buf, size_t payload_len,
+			       enum websocket_opcode opcode, bool mask, bool final,
+			       int32_t timeout);
+
 /**
  * @brief Receive websocket msg from peer.
  *
  * @details The function will automatically remove websocket header from the
- * message.
+ * message. The payload is received directly in @p buf. Fragments of a
+ * message are returned as they arrive, continuation frames being reported
+ * with the type of the first fragment and the last one with
+ * WEBSOCKET_FLAG_FINAL set.
  *
  * @param ws_sock Websocket id returned by websocket_connect().
  * @param buf Buffer where websocket data is read.
@@ -1877,6 +1877,42 @@ void wifi_mgmt_raise_neighbor_rep_recv_event(struct net_if *iface,
 					     char *inbuf, size_t buf_len);
 #endif
 
+#if defined(CONFIG_WIFI_MGMT_BSS_CACHE) || defined(__DOXYGEN__)
+/** Get the BSS cache of an interface
+ *
+ * The cache holds one entry per BSSID reported by the recent scans of
+ * @p iface, updated with the latest result for it. Entries older than
+ * CONFIG_WIFI_MGMT_BSS_CACHE_MAX_AGE are left out.
+ *
+ * @param iface Network interface
+ * @param results Array the entries are copied to, strongest signal first
+ * @param max_results Number of elements of @p results
+ *
+ * @return Number of entries copied to @p results
+ */
+int wifi_mgmt_bss_cache_get(struct net_if *iface, struct wifi_scan_result *results,
+			    size_t max_results);
+
+/** Find the strongest BSS of a network in the BSS cache of an interface
+ *
+ * @param iface Network interface
+ * @param ssid SSID of the network
+ * @param ssid_length Length of @p ssid
+ * @param result Set to the cached entry with the strongest signal
+ *
+ * @retval 0 if an entry was found
+ * @retval -ENOENT if the network is not in the cache
+ */
+int wifi_mgmt_bss_cache_find(struct net_if *iface, const uint8_t *ssid, uint8_t ssid_length,
+			     struct wifi_scan_result *result);
+
+/** Flush the BSS cache
+ *
+ * @param iface Network interface whose entries are removed, NULL for all of them
+ */
+void wifi_mgmt_bss_cache_flush(struct net_if *iface);
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
 /** Wi-Fi management AP mode enable result event
  *
  * @param iface Network interface
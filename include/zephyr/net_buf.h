@@ -1069,6 +1069,14 @@ struct net_buf_data_alloc {
 	size_t alignment;
 };
 
+#if defined(CONFIG_NET_BUF_POOL_PER_CPU_CACHE)
+struct net_buf_pool_cache {
+	struct k_spinlock lock;
+	uint16_t count;
+	struct net_buf *bufs[CONFIG_NET_BUF_POOL_PER_CPU_CACHE_SIZE];
+};
+#endif
+
 /** @endcond */
 
 /**
@@ -1114,6 +1122,13 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_POOL_PER_CPU_CACHE)
+	/** @cond INTERNAL_HIDDEN */
+	atomic_t waiters;
+	struct net_buf_pool_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	/** @endcond */
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1325,6 +1340,94 @@ extern const struct net_buf_data_cb net_buf_var_cb;
 					 _net_buf_##_name, _count, _ud_size,   \
 					 _destroy)
 
+/** @cond INTERNAL_HIDDEN */
+
+struct net_buf_pool_slabs {
+	struct k_mem_slab *const *slabs;
+	uint8_t count;
+};
+
+extern const struct net_buf_data_cb net_buf_slab_cb;
+
+/** @endcond */
+
+/**
+ * @brief Define a size class for buffer pools based on memory slabs
+ *
+ * Defines a memory slab of @p _count blocks, each able to hold @p _data_size
+ * bytes of payload, for use as a size class of a pool defined with
+ * NET_BUF_POOL_SLAB_DEFINE(). The blocks include the space needed by the
+ * pool for reference counting the data.
+ *
+ * @param _name      Name of the size class (memory slab) variable.
+ * @param _data_size Maximum data payload of the size class.
+ * @param _count     Number of data blocks in the size class.
+ */
+#define NET_BUF_SLAB_CLASS_DEFINE(_name, _data_size, _count)                   \
+	K_MEM_SLAB_DEFINE_STATIC(_name,                                        \
+				 ROUND_UP(sizeof(void *) + (_data_size),       \
+					  sizeof(void *)),                     \
+				 _count, sizeof(void *))
+
+/**
+ *
+ * @brief Define a new pool for buffers with payloads from size classes
+ *
+ * Defines a net_buf_pool struct and the necessary memory storage (array of
+ * structs) for the needed amount of buffers. After this, the buffers can be
+ * accessed from the pool through net_buf_alloc. The pool is defined as a
+ * static variable, so if it needs to be exported outside the current module
+ * this needs to happen with the help of a separate pointer rather than an
+ * extern declaration.
+ *
+ * The data payload of the buffers will be allocated from the smallest of the
+ * given size classes that fits the requested size, so that for example small
+ * control packets don't take the memory of a full MTU sized buffer, while
+ * allocation and free remain constant time. A larger class is used when the
+ * best fitting one is exhausted, and only the best fitting one is waited for
+ * when all of them are. The size of the allocated buffer is the size of its
+ * class.
+ *
+ * The size classes are memory slabs defined with NET_BUF_SLAB_CLASS_DEFINE()
+ * and must be given in increasing order of size, for example:
+ *
+ * @code{.c}
+ * NET_BUF_SLAB_CLASS_DEFINE(small, 64, 16);
+ * NET_BUF_SLAB_CLASS_DEFINE(medium, 256, 8);
+ * NET_BUF_SLAB_CLASS_DEFINE(large, 1536, 4);
+ * NET_BUF_POOL_SLAB_DEFINE(pool, 28, 0, NULL, &small, &medium, &large);
+ * @endcode
+ *
+ * If provided with a custom destroy callback, this callback is
+ * responsible for eventually calling net_buf_destroy() to complete the
+ * process of returning the buffer to the pool.
+ *
+ * @param _name      Name of the pool variable.
+ * @param _count     Number of buffers in the pool.
+ * @param _ud_size   User data space to reserve per buffer.
+ * @param _destroy   Optional destroy callback when buffer is freed.
+ * @param ...        Pointers to the size classes, smallest first.
+ */
+#define NET_BUF_POOL_SLAB_DEFINE(_name, _count, _ud_size, _destroy, ...)       \
+	_NET_BUF_ARRAY_DEFINE(_name, _count, _ud_size);                        \
+	static struct k_mem_slab *const net_buf_slabs_##_name[] = {            \
+		__VA_ARGS__                                                    \
+	};                                                                     \
+	BUILD_ASSERT(ARRAY_SIZE(net_buf_slabs_##_name) <= UINT8_MAX);          \
+	static const struct net_buf_pool_slabs net_buf_slab_classes_##_name = { \
+		.slabs = net_buf_slabs_##_name,                                \
+		.count = ARRAY_SIZE(net_buf_slabs_##_name),                    \
+	};                                                                     \
+	static const struct net_buf_data_alloc net_buf_data_alloc_##_name = {  \
+		.cb = &net_buf_slab_cb,                                        \
+		.alloc_data = (void *)&net_buf_slab_classes_##_name,           \
+		.max_alloc_size = 0,                                           \
+	};                                                                     \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                  \
+		NET_BUF_POOL_INITIALIZER(_name, &net_buf_data_alloc_##_name,   \
+					 _net_buf_##_name, _count, _ud_size,   \
+					 _destroy)
+
 /**
  *
  * @brief Define a new pool for buffers
@@ -1469,6 +1572,12 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_NET_BUF_POOL_PER_CPU_CACHE)
+void z_net_buf_pool_put(struct net_buf_pool *pool, struct net_buf *buf);
+#endif
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1489,7 +1598,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_PER_CPU_CACHE)
+	z_net_buf_pool_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
@@ -205,6 +205,10 @@ struct pm_device_base {
 	/** Power Domain it belongs */
 	const struct device *domain;
 #endif /* CONFIG_PM_DEVICE_POWER_DOMAIN */
+#if defined(CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND) || defined(__DOXYGEN__)
+	/** Uptime, in ticks, at which the suspends queued on this domain are due */
+	int64_t group_suspend;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND */
 };
 
 /**
@@ -228,6 +232,12 @@ struct pm_device {
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+#if defined(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD) || defined(__DOXYGEN__)
+	/** Work object for resume ahead hints */
+	struct k_work_delayable resume_work;
+	/** Time the device takes to resume, in ticks */
+	uint32_t resume_ticks;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
 
@@ -144,6 +144,31 @@ int pm_device_runtime_put(const struct device *dev);
  */
 int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay);
 
+/**
+ * @brief Resume a device ahead of its use.
+ *
+ * Hint that the device will be needed in @p needed_in, e.g. by a periodic
+ * user or a scheduled transfer. The device is resumed from the work queue
+ * early enough for the resume to be done by then, given the time it and its
+ * power domains took to resume so far, and is kept active for
+ * @kconfig{CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS} afterwards. A
+ * pm_device_runtime_get() issued in the meantime does not wait for the
+ * resume. If a hint is already pending for the device, it is kept.
+ *
+ * @kconfig_dep{CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD}
+ *
+ * @funcprops \async, \isr_ok
+ *
+ * @param dev Device instance.
+ * @param needed_in Time left until the device is used.
+ *
+ * @retval 0 If it succeeds. In case device runtime PM is not enabled or not
+ * available this function will be a no-op and will also return 0.
+ * @retval -ENOTSUP If the device uses ISR safe PM, which resumes in place.
+ * @retval -EINVAL If @p needed_in is K_FOREVER.
+ */
+int pm_device_runtime_resume_ahead(const struct device *dev, k_timeout_t needed_in);
+
 /**
  * @brief Check if device runtime is enabled for a given device.
  *
@@ -209,6 +234,14 @@ static inline int pm_device_runtime_put_async(const struct device *dev,
 	return 0;
 }
 
+static inline int pm_device_runtime_resume_ahead(const struct device *dev,
+		k_timeout_t needed_in)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(needed_in);
+	return 0;
+}
+
 static inline bool pm_device_runtime_is_enabled(const struct device *dev)
 {
 	ARG_UNUSED(dev);
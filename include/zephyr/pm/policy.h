@@ -88,6 +88,21 @@ struct pm_policy_event {
  */
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks);
 
+/**
+ * @brief Report how long the CPU stayed in the last PM state
+ *
+ * This function is called by the power subsystem when the CPU wakes up,
+ * with CONFIG_PM_POLICY_DEFAULT_PREDICTIVE enabled.
+ *
+ * @param cpu CPU index.
+ * @param state The power state the CPU was in.
+ * @param ticks The number of ticks to the next scheduled event when the
+ *              state was entered.
+ * @param idle_us Time spent in the state, in microseconds.
+ */
+void pm_policy_idle_update(uint8_t cpu, const struct pm_state_info *state, int32_t ticks,
+			   uint32_t idle_us);
+
 /** @endcond */
 
 /** Special value for 'all substates'. */
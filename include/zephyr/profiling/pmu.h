@@ -0,0 +1,135 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Hardware performance counter API
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROFILING_PMU_H_
+#define ZEPHYR_INCLUDE_PROFILING_PMU_H_
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hardware performance counters
+ * @defgroup profiling_pmu Hardware performance counters
+ * @ingroup os_services
+ *
+ * Counters count events of the CPU they are started on. They are not saved
+ * on context switch, so measurements of a single thread must be done from a
+ * thread that stays on one CPU and that is not preempted by other work of
+ * interest.
+ *
+ * Hardware counters may be narrower than 64 bits, in which case the value
+ * read wraps around at the counter width.
+ *
+ * @{
+ */
+
+/** @brief Architecture independent events */
+enum pmu_event {
+	/** Processor cycles */
+	PMU_EVENT_CPU_CYCLES,
+	/** Instructions retired */
+	PMU_EVENT_INSTRUCTIONS,
+	/** Data cache refills, or last level cache misses where that is all the CPU reports */
+	PMU_EVENT_CACHE_MISSES,
+	/** Mispredicted branches */
+	PMU_EVENT_BRANCH_MISSES,
+	/** Cycles stalled waiting for the backend of the pipeline */
+	PMU_EVENT_STALL_CYCLES,
+	/** Number of architecture independent events */
+	PMU_EVENT_COUNT,
+};
+
+/** @brief Build an event from an implementation defined event number */
+#define PMU_EVENT_RAW(code) (BIT(31) | (code))
+
+/** @brief Check whether an event is implementation defined */
+#define PMU_EVENT_IS_RAW(event) (((event) & BIT(31)) != 0U)
+
+/** @brief Get the implementation defined event number of an event */
+#define PMU_EVENT_RAW_CODE(event) ((event) & ~BIT(31))
+
+/**
+ * @brief Get the number of counters
+ *
+ * @return Number of counters that can be started at the same time.
+ */
+uint8_t pmu_num_counters(void);
+
+/**
+ * @brief Reset a counter and start counting an event
+ *
+ * @param counter Counter index, below pmu_num_counters().
+ * @param event One of @ref pmu_event, or an event built with PMU_EVENT_RAW().
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the counter or event is out of range.
+ * @retval -ENOTSUP if the event is not supported by the counter.
+ */
+int pmu_counter_start(uint8_t counter, uint32_t event);
+
+/**
+ * @brief Stop a counter
+ *
+ * The counter keeps the value it had when it was stopped.
+ *
+ * @param counter Counter index, below pmu_num_counters().
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the counter is out of range.
+ */
+int pmu_counter_stop(uint8_t counter);
+
+/**
+ * @brief Read a counter
+ *
+ * @param counter Counter index, below pmu_num_counters().
+ * @param value Number of events counted since the counter was started.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the counter is out of range.
+ */
+int pmu_counter_read(uint8_t counter, uint64_t *value);
+
+/**
+ * @brief Get the name of an event
+ *
+ * @param event One of @ref pmu_event, or an event built with PMU_EVENT_RAW().
+ *
+ * @return Name of the event, "raw" for implementation defined events.
+ */
+const char *pmu_event_name(uint32_t event);
+
+/**
+ * @}
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ *
+ * Implemented by the architecture backend. Arguments are validated by the
+ * callers.
+ */
+uint8_t arch_pmu_num_counters(void);
+int arch_pmu_counter_start(uint8_t counter, uint32_t event);
+void arch_pmu_counter_stop(uint8_t counter);
+uint64_t arch_pmu_counter_read(uint8_t counter);
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PROFILING_PMU_H_ */
@@ -0,0 +1,135 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for warm boot state snapshots
+ */
+
+#ifndef ZEPHYR_INCLUDE_RETENTION_WARMBOOT_
+#define ZEPHYR_INCLUDE_RETENTION_WARMBOOT_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Warm boot interface
+ * @defgroup warm_boot_interface Warm boot interface
+ * @ingroup retention_api
+ * @{
+ *
+ * Subsystems register a handler which serializes the state they would
+ * otherwise rebuild at boot (e.g. a cache of values read from storage) into a
+ * snapshot, saved to the "zephyr,warm-boot" retention area right before a
+ * reboot. On the next boot, the snapshots still present in the retention area
+ * are given back to their handler, then the retention area is cleared so that
+ * they are only used once.
+ *
+ * Handlers are restored at POST_KERNEL, with
+ * @kconfig{CONFIG_RETENTION_WARM_BOOT_INIT_PRIORITY}, so they should only
+ * stash the snapshot for the subsystem to use once it initializes.
+ */
+
+/**
+ * @brief Serialize the state of a subsystem.
+ *
+ * @param buf	Buffer to serialize the state into.
+ * @param size	Size of the buffer.
+ *
+ * @return Size of the snapshot, or negative to save no snapshot.
+ */
+typedef ssize_t (*warmboot_save_t)(uint8_t *buf, size_t size);
+
+/**
+ * @brief Restore the state of a subsystem.
+ *
+ * @param buf	Snapshot saved before the reboot, only valid during the call.
+ * @param size	Size of the snapshot.
+ */
+typedef void (*warmboot_restore_t)(const uint8_t *buf, size_t size);
+
+/** @brief Warm boot handler. */
+struct warmboot_handler {
+	/** Name of the snapshot, unique among handlers. */
+	const char *name;
+	/** Format version of the snapshot, which must match to be restored. */
+	uint16_t version;
+	/** Serializes the state. */
+	warmboot_save_t save;
+	/** Restores the state. */
+	warmboot_restore_t restore;
+};
+
+/**
+ * @brief Define a warm boot handler.
+ *
+ * @param _name		Name of the handler, also the name of its snapshot.
+ * @param _version	Format version of the snapshot.
+ * @param _save		Function serializing the state, see @ref warmboot_save_t.
+ * @param _restore	Function restoring the state, see @ref warmboot_restore_t.
+ */
+#define WARMBOOT_HANDLER_DEFINE(_name, _version, _save, _restore)                                  \
+	static const STRUCT_SECTION_ITERABLE(warmboot_handler, _name) = {                          \
+		.name = STRINGIFY(_name),                                                          \
+		.version = (_version),                                                             \
+		.save = (_save),                                                                   \
+		.restore = (_restore),                                                             \
+	}
+
+/**
+ * @brief		Save the snapshots of all handlers to the retention area.
+ *
+ * Snapshots which do not fit in the retention area are skipped.
+ *
+ * @retval >=0		Number of snapshots saved.
+ * @retval -errno	Error code code.
+ */
+int warmboot_save(void);
+
+/**
+ * @brief		Restore the snapshots present in the retention area and clear it.
+ *
+ * This is done at boot and only needs to be called directly to restore
+ * snapshots saved without a reboot.
+ *
+ * @retval >=0		Number of snapshots restored.
+ * @retval 0		If the retention area held no valid snapshots.
+ * @retval -errno	Error code code.
+ */
+int warmboot_restore(void);
+
+/**
+ * @brief		Check if snapshots were restored during this boot.
+ *
+ * @retval true		If at least one snapshot was restored.
+ * @retval false	If this is a cold boot, or no snapshot was restored.
+ */
+bool warmboot_is_warm(void);
+
+/**
+ * @brief		Save the snapshots of all handlers, then reboot.
+ *
+ * @param type	Reboot type, as for sys_reboot().
+ */
+FUNC_NORETURN void warmboot_reboot(int type);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RETENTION_WARMBOOT_ */
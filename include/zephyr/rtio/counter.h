@@ -0,0 +1,90 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_RTIO_COUNTER_H_
+#define ZEPHYR_INCLUDE_RTIO_COUNTER_H_
+
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTIO periodic submissions driven by a counter device
+ * @defgroup rtio_counter RTIO counter
+ * @ingroup rtio
+ * @{
+ */
+
+/**
+ * @brief Data of an RTIO counter iodev.
+ *
+ * Use @ref RTIO_COUNTER_IODEV_DEFINE to instantiate it.
+ */
+struct rtio_counter_iodev_data {
+	/** Counter device providing the time base. */
+	const struct device *dev;
+
+	/** Alarm channel of the counter reserved for the iodev. */
+	uint8_t chan;
+
+	/** Period in microseconds. */
+	uint32_t period_us;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct mpsc pending;
+	atomic_t armed;
+	bool started;
+	uint32_t period;
+	uint32_t top;
+	uint32_t last;
+	uint32_t next;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api rtio_counter_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an iodev completing its submissions on a periodic cadence.
+ *
+ * Submissions to the iodev must be @ref RTIO_OP_NOP. Each one completes, from
+ * the counter alarm interrupt, on the next period boundary after it was
+ * submitted. The boundaries stay at a fixed phase of the counter whenever
+ * submissions are made, so a chain of a submission to this iodev followed by
+ * a sensor read runs the read at a fixed cadence, and the next submission of
+ * the chain is started from the interrupt without any thread involved. A
+ * multishot submission completes on every period.
+ *
+ * @param name Name of the iodev.
+ * @param counter_dev Counter device, e.g. from DEVICE_DT_GET().
+ * @param chan_id Alarm channel of the counter used by the iodev.
+ * @param period Period in microseconds.
+ */
+#define RTIO_COUNTER_IODEV_DEFINE(name, counter_dev, chan_id, period)                      \
+	static struct rtio_counter_iodev_data _rtio_counter_##name = {                     \
+		.dev = (counter_dev),                                                      \
+		.chan = (chan_id),                                                         \
+		.period_us = (period),                                                     \
+		.pending = MPSC_INIT(_rtio_counter_##name.pending),                        \
+	};                                                                                 \
+	RTIO_IODEV_DEFINE(name, &rtio_counter_iodev_api, &_rtio_counter_##name)
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RTIO_COUNTER_H_ */
@@ -42,6 +42,11 @@ struct rtio_work_req {
 	 * This is filled inside @ref rtio_work_req_submit.
 	 */
 	rtio_work_submit_t handler;
+
+#if defined(CONFIG_RTIO_WORKQ_PER_IODEV) || defined(__DOXYGEN__)
+	/** Node in the list of pending requests. */
+	sys_snode_t node;
+#endif
 };
 
 /**
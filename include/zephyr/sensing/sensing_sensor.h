@@ -84,6 +84,12 @@ struct sensing_connection {
 	void *data;                 /**< Pointer to sensor sample data of the connection. */
 	/** Next consume time of the connection. Unit is micro seconds. */
 	uint64_t next_consume_time;
+#if defined(CONFIG_SENSING_DISPATCH_DECIMATION) || defined(__DOXYGEN__)
+	/** Number of source samples per sample reported to the connection. */
+	uint16_t decimation;
+	/** Number of source samples left to skip before the next report. */
+	uint16_t countdown;
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
 	struct sensing_callback_list *callback_list; /**< Callback list of the connection. */
 };
 
@@ -229,6 +229,41 @@ struct settings_handler_static {
 	SETTINGS_STATIC_HANDLER_DEFINE_WITH_CPRIO(_hname, _tree, _get, _set, \
 		_commit, _export, 0)
 
+/**
+ * @brief Settings item stored with a fixed ZMS ID
+ *
+ * Defined using @ref SETTINGS_ZMS_FIXED_ID_DEFINE.
+ */
+struct settings_zms_fixed_id {
+	const char *name;
+	/**< Full name of the settings item. */
+
+	uint32_t id;
+	/**< ZMS ID of the value of the settings item. */
+};
+
+/**
+ * Define a settings item stored with a fixed ZMS ID
+ *
+ * The ZMS backend stores the value of the settings item identified by
+ * @p _name directly in the ZMS entry @p _id, without storing its name. It is
+ * then loaded with a single read, instead of finding the name from its hash.
+ * Values saved before the item was defined with a fixed ID are ignored.
+ *
+ * @param _hname name of the definition
+ * @param _name full name of the settings item
+ * @param _id ZMS ID, below 0x80000000 which is used by the hashed names
+ *
+ * @note Only used with @kconfig{CONFIG_SETTINGS_ZMS_FIXED_IDS}.
+ */
+#define SETTINGS_ZMS_FIXED_ID_DEFINE(_hname, _name, _id)                                 \
+	BUILD_ASSERT((_id) < 0x80000000, "ZMS ID used by the hashed names");                \
+	const STRUCT_SECTION_ITERABLE(settings_zms_fixed_id,                               \
+				      settings_zms_fixed_id_##_hname) = {                  \
+		.name = _name,                                                             \
+		.id = _id,                                                                 \
+	}
+
 /**
  * Initialization of settings and backend
  *
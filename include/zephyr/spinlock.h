@@ -61,6 +61,17 @@ struct k_spinlock {
 	 */
 	atomic_t owner;
 	atomic_t tail;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/*
+	 * MCS spinlocks keep the basic lock variable, but CPUs that find
+	 * the lock taken queue up behind the tail pointer, each spinning
+	 * on its own per-CPU node until its predecessor leaves the queue.
+	 * Only the CPU at the head of the queue polls the lock variable,
+	 * so contention does not bounce a single cache line across all
+	 * waiting CPUs.
+	 */
+	atomic_t locked;
+	atomic_ptr_t tail;
 #else
 	atomic_t locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -116,6 +127,10 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_MCS_SPINLOCKS
+void z_spin_lock_mcs(struct k_spinlock *l);
+#endif /* CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Spinlock key type
  *
@@ -205,6 +220,11 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	while (atomic_get(&l->owner) != ticket) {
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/* Only take the lock directly if no other CPU is queued for it */
+	if ((atomic_ptr_get(&l->tail) != NULL) || !atomic_cas(&l->locked, 0, 1)) {
+		z_spin_lock_mcs(l);
+	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
 		arch_spin_relax();
@@ -442,6 +462,149 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock((lck), __key), __i.key = 1)
 
+/**
+ * @brief Kernel Reader-Writer Spin Lock
+ *
+ * Like @ref k_spinlock, but any number of CPUs may hold the lock for
+ * reading at the same time, while a CPU holding it for writing excludes
+ * all others. A CPU waiting to write keeps new readers out, so that
+ * writers are not starved by a continuous flow of readers.
+ *
+ * Reader-writer spinlocks are not recursive, including for readers: a
+ * CPU that already holds the lock for reading must not take it again,
+ * as this deadlocks if another CPU started waiting to write meanwhile.
+ * They are not covered by the CONFIG_SPIN_VALIDATE checks.
+ */
+struct k_rwspinlock {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_SMP
+	/* Writer and waiting writer flags, plus the number of readers */
+	atomic_t state;
+#endif /* CONFIG_SMP */
+
+#if defined(CONFIG_CPP) && !defined(CONFIG_SMP)
+	/* See struct k_spinlock */
+	char dummy;
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWSPIN_WRITER  BIT(0)
+#define Z_RWSPIN_WAITING BIT(1)
+#define Z_RWSPIN_READER  BIT(2)
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Lock a reader-writer spinlock for reading
+ *
+ * Mask interrupts locally and wait until no CPU holds @p l for writing
+ * or waits to do so. Other CPUs may hold @p l for reading at the same
+ * time.
+ *
+ * @param l A pointer to the reader-writer spinlock to lock
+ * @return A key value that must be passed to k_rwspin_read_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_rwspin_read_lock(struct k_rwspinlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SMP
+	for (;;) {
+		atomic_val_t state = atomic_get(&l->state);
+
+		if (((state & (Z_RWSPIN_WRITER | Z_RWSPIN_WAITING)) == 0) &&
+		    atomic_cas(&l->state, state, state + Z_RWSPIN_READER)) {
+			break;
+		}
+
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a reader-writer spinlock locked for reading
+ *
+ * @param l A pointer to the reader-writer spinlock to release
+ * @param key The value returned from k_rwspin_read_lock()
+ */
+static ALWAYS_INLINE void k_rwspin_read_unlock(struct k_rwspinlock *l,
+					       k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SMP
+	(void)atomic_sub(&l->state, Z_RWSPIN_READER);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
+/**
+ * @brief Lock a reader-writer spinlock for writing
+ *
+ * Mask interrupts locally and wait until no other CPU holds @p l, for
+ * reading or writing. New readers are kept out while waiting.
+ *
+ * @param l A pointer to the reader-writer spinlock to lock
+ * @return A key value that must be passed to k_rwspin_write_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_rwspin_write_lock(struct k_rwspinlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SMP
+	for (;;) {
+		atomic_val_t state = atomic_get(&l->state);
+
+		/* Clears the waiting flag, other waiting writers set it again */
+		if (((state & ~Z_RWSPIN_WAITING) == 0) &&
+		    atomic_cas(&l->state, state, Z_RWSPIN_WRITER)) {
+			break;
+		}
+
+		if ((state & Z_RWSPIN_WAITING) == 0) {
+			(void)atomic_or(&l->state, Z_RWSPIN_WAITING);
+		}
+
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a reader-writer spinlock locked for writing
+ *
+ * @param l A pointer to the reader-writer spinlock to release
+ * @param key The value returned from k_rwspin_write_lock()
+ */
+static ALWAYS_INLINE void k_rwspin_write_unlock(struct k_rwspinlock *l,
+						k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SMP
+	(void)atomic_and(&l->state, ~Z_RWSPIN_WRITER);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -25,6 +25,7 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +73,9 @@ struct stream_flash_ctx {
 					 * preparing Stream Flash designated area
 					 * for write.
 					 */
+#endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	struct k_work erase_ahead_work; /* Erases the pages following the written ones */
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
@@ -84,14 +88,20 @@ struct stream_flash_ctx {
  * @param ctx context to be initialized
  * @param fdev Flash device to operate on
  * @param buf Write buffer
- * @param buf_len Length of write buffer. Can not be larger than the page size.
+ * @param buf_len Length of write buffer. Can not be larger than @p size.
  *                Must be multiple of the flash device write-block-size.
+ *                A buffer spanning several pages is written with a single
+ *                flash write.
  * @param offset Offset within flash device to start writing to
  * @param size Number of bytes available for performing buffered write.
  * @param cb Callback to be invoked on completed flash write operations.
  *           Callback is supported when CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK
  *           is enabled.
  *
+ * @note With CONFIG_STREAM_FLASH_ERASE_AHEAD, pages may still be erased in
+ * the background after a write without @p flush. Such a context must not be
+ * re-initialized before a write with flush set has finished it.
+ *
  * @return non-negative on success, negative errno code on fail
  */
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
@@ -31,6 +31,11 @@ void _isr_wrapper(void);
 /* Spurious interrupt handler. Throws an error if called */
 void z_irq_spurious(const void *unused);
 
+#ifdef CONFIG_GEN_IRQ_TRAMPOLINES
+/* Per-IRQ trampolines, ARCH_IRQ_TRAMPOLINE_SIZE bytes each */
+void _irq_trampolines(void);
+#endif
+
 /*
  * Note the order: arg first, then ISR. This allows a table entry to be
  * loaded arg -> r0, isr -> r3 in _isr_wrapper with one ldmia instruction,
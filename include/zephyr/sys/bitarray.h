@@ -39,6 +39,11 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	/* One bit per bundle, set if all the bits of that bundle are set */
+	uint32_t *summary;
+#endif
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
@@ -58,11 +63,16 @@ typedef struct sys_bitarray sys_bitarray_t;
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
 		[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),		\
 			       sizeof(uint32_t))] = {0};		\
+	IF_ENABLED(CONFIG_SYS_BITARRAY_SUMMARY,				\
+		(sba_mod uint32_t _sys_bitarray_summary_##name		\
+			[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 32), 32)] = {0};)) \
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = (total_bits),				\
 		.num_bundles = DIV_ROUND_UP(				\
 			DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t)),	\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		IF_ENABLED(CONFIG_SYS_BITARRAY_SUMMARY,			\
+			(.summary = _sys_bitarray_summary_##name,))	\
 	}
 
 /**
@@ -168,6 +178,30 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset);
 
+/**
+ * Allocate bits in a bit array, looking from a given offset first
+ *
+ * This is like sys_bitarray_alloc(), except that the search starts at
+ * @p hint and only goes back to the start of the bit array if no region is
+ * found after it. Keeping the offset following the previous allocation as
+ * hint avoids walking over the same allocated bits again.
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits to allocate
+ * @param[in]  hint     Offset to start looking from, wrapped around if
+ *                      beyond the bit array
+ * @param[out] offset   Offset to the start of allocated region if
+ *                      successful
+ *
+ * @retval 0       Allocation successful
+ * @retval -EINVAL Invalid argument (e.g. allocating more bits than
+ *                 the bitarray has, trying to allocate 0 bits, etc.)
+ * @retval -ENOSPC No contiguous region big enough to accommodate
+ *                 the allocation
+ */
+int sys_bitarray_alloc_hint(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t hint, size_t *offset);
+
 /**
  * Calculates the bit-wise XOR of two bitarrays in a region.
  * The result is stored in the first bitarray passed in (@p dst).
@@ -0,0 +1,257 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup btree_apis B+ Tree
+ * @ingroup datastructure_apis
+ *
+ * @brief Sorted container backed by a B+ tree
+ *
+ * This keeps pointers to user items sorted according to a comparison
+ * function. Items are stored several at a time in the nodes of a B+ tree,
+ * so walking down the tree or through the sorted items touches a handful of
+ * contiguous arrays rather than one separately allocated node per item, as
+ * with @ref rbtree_apis.
+ *
+ * All leaves are chained in order, which makes in-order iteration a linear
+ * walk, and the first leaf is always at hand, which makes finding and
+ * extracting the smallest item O(1) most of the time.
+ *
+ * Nodes are taken from a pool given when the tree is defined, no memory is
+ * allocated at runtime. Use SYS_BTREE_NUM_NODES() to size it for a number of
+ * items. Items comparing equal are kept in insertion order.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_BTREE_H_
+#define ZEPHYR_INCLUDE_SYS_BTREE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of items, or keys, a node holds */
+#define SYS_BTREE_NODE_ITEMS CONFIG_SYS_BTREE_NODE_ITEMS
+
+/**
+ * @typedef sys_btree_cmp_t
+ * @brief B+ tree comparison function
+ *
+ * @param a First item
+ * @param b Second item, or a key given to sys_btree_find()
+ *
+ * @return Negative value if @p a sorts before @p b, positive value if @p a
+ *         sorts after @p b, zero if they are equal.
+ */
+typedef int (*sys_btree_cmp_t)(const void *a, const void *b);
+
+/**
+ * @brief B+ tree node
+ */
+struct sys_btree_node {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_btree_node *parent;
+	void *items[SYS_BTREE_NODE_ITEMS];
+	union {
+		/* inner nodes */
+		struct sys_btree_node *children[SYS_BTREE_NODE_ITEMS + 1];
+		/* leaves */
+		struct sys_btree_node *next;
+	};
+	uint8_t count;
+	bool leaf;
+	/** @endcond */
+};
+
+/**
+ * @brief B+ tree
+ */
+struct sys_btree {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_btree_node *root;
+	struct sys_btree_node *first;
+	struct sys_btree_node *free;
+	struct sys_btree_node *nodes;
+	size_t num_nodes;
+	size_t nodes_used;
+	size_t size;
+	sys_btree_cmp_t cmp;
+	/** @endcond */
+};
+
+/**
+ * @brief Iterator over the items of a B+ tree, in order
+ */
+struct sys_btree_iter {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_btree_node *node;
+	size_t index;
+	/** @endcond */
+};
+
+/**
+ * @brief Number of nodes a B+ tree needs to hold a number of items
+ *
+ * @param _items Maximum number of items in the tree
+ */
+#define SYS_BTREE_NUM_NODES(_items)                                                                \
+	(2 * DIV_ROUND_UP(2 * (_items), SYS_BTREE_NODE_ITEMS) + 1)
+
+/**
+ * @brief Statically initialize a B+ tree
+ *
+ * @param _nodes Array of @ref sys_btree_node the tree takes its nodes from
+ * @param _cmp Comparison function of type @ref sys_btree_cmp_t
+ */
+#define SYS_BTREE_INITIALIZER(_nodes, _cmp)                                                        \
+	{                                                                                          \
+		.nodes = (_nodes), .num_nodes = ARRAY_SIZE(_nodes), .cmp = (_cmp),                 \
+	}
+
+/**
+ * @brief Define a B+ tree
+ *
+ * @param _name Name of the tree
+ * @param _max_items Maximum number of items in the tree
+ * @param _cmp Comparison function of type @ref sys_btree_cmp_t
+ */
+#define SYS_BTREE_DEFINE(_name, _max_items, _cmp)                                                  \
+	static struct sys_btree_node _name##_nodes[SYS_BTREE_NUM_NODES(_max_items)];              \
+	struct sys_btree _name = SYS_BTREE_INITIALIZER(_name##_nodes, _cmp)
+
+/**
+ * @brief Initialize a B+ tree
+ *
+ * @param tree Tree to initialize
+ * @param nodes Array of nodes the tree takes its nodes from
+ * @param num_nodes Number of elements in @p nodes
+ * @param cmp Comparison function
+ */
+void sys_btree_init(struct sys_btree *tree, struct sys_btree_node *nodes, size_t num_nodes,
+		    sys_btree_cmp_t cmp);
+
+/**
+ * @brief Insert an item in a B+ tree
+ *
+ * The item is placed after the items that compare equal to it.
+ *
+ * @param tree Tree to insert the item in
+ * @param item Item to insert
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if the node pool of the tree is exhausted
+ */
+int sys_btree_insert(struct sys_btree *tree, void *item);
+
+/**
+ * @brief Remove an item from a B+ tree
+ *
+ * @param tree Tree to remove the item from
+ * @param item Item to remove, compared by address among equal items
+ *
+ * @return true if the item was found and removed, false otherwise
+ */
+bool sys_btree_remove(struct sys_btree *tree, void *item);
+
+/**
+ * @brief Find an item in a B+ tree
+ *
+ * @param tree Tree to look into
+ * @param key Key the items are compared to, passed as the second argument
+ *            of @p cmp
+ * @param cmp Comparison function ordering items against @p key the same way
+ *            the tree orders them, or NULL for the own function of the tree
+ *
+ * @return The first item equal to @p key, or NULL if there is none
+ */
+void *sys_btree_find(const struct sys_btree *tree, const void *key, sys_btree_cmp_t cmp);
+
+/**
+ * @brief Smallest item of a B+ tree
+ *
+ * @param tree Tree to look into
+ *
+ * @return The first item in order, or NULL if the tree is empty
+ */
+static inline void *sys_btree_min(const struct sys_btree *tree)
+{
+	return tree->size == 0 ? NULL : tree->first->items[0];
+}
+
+/**
+ * @brief Remove the smallest item of a B+ tree
+ *
+ * @param tree Tree to remove the item from
+ *
+ * @return The removed item, or NULL if the tree is empty
+ */
+void *sys_btree_pop_min(struct sys_btree *tree);
+
+/**
+ * @brief Number of items in a B+ tree
+ *
+ * @param tree Tree to look into
+ *
+ * @return Number of items in @p tree
+ */
+static inline size_t sys_btree_size(const struct sys_btree *tree)
+{
+	return tree->size;
+}
+
+/** @cond INTERNAL_HIDDEN */
+static inline void *z_btree_iter_item(struct sys_btree_iter *iter)
+{
+	return iter->node != NULL ? iter->node->items[iter->index] : NULL;
+}
+
+static inline void *z_btree_iter_start(const struct sys_btree *tree, struct sys_btree_iter *iter)
+{
+	iter->node = tree->size == 0 ? NULL : tree->first;
+	iter->index = 0;
+
+	return z_btree_iter_item(iter);
+}
+
+static inline void *z_btree_iter_next(struct sys_btree_iter *iter)
+{
+	if (++iter->index == iter->node->count) {
+		iter->node = iter->node->next;
+		iter->index = 0;
+	}
+
+	return z_btree_iter_item(iter);
+}
+/** @endcond */
+
+/**
+ * @brief Walk the items of a B+ tree in order
+ *
+ * The tree must not be modified during the walk.
+ *
+ * @param tree Tree to walk
+ * @param iter Name of a @ref sys_btree_iter used as iterator
+ * @param item Name of a pointer variable set to each item in turn
+ */
+#define SYS_BTREE_FOR_EACH(tree, iter, item)                                                       \
+	for ((item) = z_btree_iter_start((tree), &(iter)); (item) != NULL;                         \
+	     (item) = z_btree_iter_next(&(iter)))
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_SYS_BTREE_H_ */
@@ -88,11 +88,21 @@ static inline int z_cbprintf_cxx_is_pchar(T arg, bool const_as_fixed)
 }
 
 /* C++ version for determining if variable type is numeric and fits in 32 bit word. */
+static inline int z_cbprintf_cxx_is_word_num(bool)
+{
+	return 1;
+}
+
 static inline int z_cbprintf_cxx_is_word_num(char)
 {
 	return 1;
 }
 
+static inline int z_cbprintf_cxx_is_word_num(signed char)
+{
+	return 1;
+}
+
 static inline int z_cbprintf_cxx_is_word_num(unsigned char)
 {
 	return 1;
@@ -128,21 +138,32 @@ static inline int z_cbprintf_cxx_is_word_num(unsigned long)
 	return (sizeof(long) <= sizeof(uint32_t)) ? 1 : 0;
 }
 
+/* Enumerations are promoted like their underlying integer type. */
 template < typename T >
 static inline int z_cbprintf_cxx_is_word_num(T arg)
 {
 	ARG_UNUSED(arg);
 	TOOLCHAIN_DISABLE_GCC_WARNING(TOOLCHAIN_WARNING_POINTER_ARITH);
-	return 0;
+	return (__is_enum(T) && sizeof(T) <= sizeof(uint32_t)) ? 1 : 0;
 	TOOLCHAIN_ENABLE_GCC_WARNING(TOOLCHAIN_WARNING_POINTER_ARITH);
 }
 
 /* C++ version for determining if argument is a none character pointer. */
+static inline int z_cbprintf_cxx_is_none_char_ptr(bool)
+{
+	return 0;
+}
+
 static inline int z_cbprintf_cxx_is_none_char_ptr(char)
 {
 	return 0;
 }
 
+static inline int z_cbprintf_cxx_is_none_char_ptr(signed char)
+{
+	return 0;
+}
+
 static inline int z_cbprintf_cxx_is_none_char_ptr(unsigned char)
 {
 	return 0;
@@ -243,7 +264,7 @@ static inline int z_cbprintf_cxx_is_none_char_ptr(T arg)
 {
 	ARG_UNUSED(arg);
 
-	return 1;
+	return __is_enum(T) ? 0 : 1;
 }
 
 /* C++ version for calculating argument size. */
@@ -263,6 +284,13 @@ static inline size_t z_cbprintf_cxx_arg_size(T arg)
 }
 
 /* C++ version for storing arguments. */
+static inline void z_cbprintf_cxx_store_arg(uint8_t *dst, bool arg)
+{
+	int tmp = arg + 0;
+
+	z_cbprintf_wcpy((int *)dst, &tmp, 1);
+}
+
 static inline void z_cbprintf_cxx_store_arg(uint8_t *dst, float arg)
 {
 	double d = (double)arg;
@@ -311,11 +339,33 @@ static inline void z_cbprintf_cxx_store_arg(uint8_t *dst, unsigned short arg)
 	z_cbprintf_wcpy((int *)dst, &tmp, 1);
 }
 
+/* Enumerations smaller than int are stored promoted, as copying a whole
+ * word from them would read past the argument.
+ */
+template < typename T, bool promote = __is_enum(T) && (sizeof(T) < sizeof(int)) >
+struct z_cbprintf_cxx_promote {
+	typedef T type;
+	static inline T value(T arg)
+	{
+		return arg;
+	}
+};
+
+template < typename T >
+struct z_cbprintf_cxx_promote < T, true > {
+	typedef int type;
+	static inline int value(T arg)
+	{
+		return static_cast < int > (arg);
+	}
+};
+
 template < typename T >
 static inline void z_cbprintf_cxx_store_arg(uint8_t *dst, T arg)
 {
-	size_t wlen = z_cbprintf_cxx_arg_size(arg) / sizeof(int);
-	void *p = &arg;
+	typename z_cbprintf_cxx_promote < T > ::type val = z_cbprintf_cxx_promote < T > ::value(arg);
+	size_t wlen = z_cbprintf_cxx_arg_size(val) / sizeof(int);
+	void *p = &val;
 
 	z_cbprintf_wcpy((int *)dst, (int *)p, wlen);
 }
@@ -374,6 +424,10 @@ static inline size_t z_cbprintf_cxx_alignment(unsigned long long arg)
 template < typename T >
 static inline size_t z_cbprintf_cxx_alignment(T arg)
 {
+	if (__is_enum(T) && (sizeof(T) > sizeof(int))) {
+		return VA_STACK_ALIGN(long long);
+	}
+
 	return MAX(__alignof__(arg), VA_STACK_MIN_ALIGN);
 }
 
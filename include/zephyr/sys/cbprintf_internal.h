@@ -934,6 +934,20 @@ do { \
 	  false) : \
 	 false)
 
+/*
+ * Arguments which are not matched by type: bool and enumerations are passed
+ * as promoted integers, anything else as a pointer.
+ */
+#define Z_CBPRINTF_CXX_ARG_TYPE_OTHER(arg) \
+	((z_cbprintf_cxx_is_same_type < Z_CBPRINTF_ARG_REMOVE_QUAL(arg), \
+	  bool > ::value || \
+	  z_cbprintf_cxx_is_same_type < Z_CBPRINTF_ARG_REMOVE_QUAL(arg), \
+	  signed char > ::value || \
+	  (__is_enum(Z_CBPRINTF_ARG_REMOVE_QUAL(arg)) && sizeof(arg) <= sizeof(int))) ? \
+	 CBPRINTF_PACKAGE_ARG_TYPE_INT : \
+	 (__is_enum(Z_CBPRINTF_ARG_REMOVE_QUAL(arg)) ? \
+	  CBPRINTF_PACKAGE_ARG_TYPE_LONG_LONG : \
+	  CBPRINTF_PACKAGE_ARG_TYPE_PTR_VOID))
 /*
  * Note that qualifiers of char * must be explicitly matched
  * due to type matching in C++, where remove_cv() does not work.
@@ -992,7 +1006,7 @@ do { \
 			  CBPRINTF_PACKAGE_ARG_TYPE_PTR_CHAR : \
 			  (Z_CBPRINTF_CXX_ARG_IS_CHAR_ARRAY(arg) ? \
 			   CBPRINTF_PACKAGE_ARG_TYPE_PTR_CHAR : \
-			   CBPRINTF_PACKAGE_ARG_TYPE_PTR_VOID))))))))))))))))))
+			   Z_CBPRINTF_CXX_ARG_TYPE_OTHER(arg)))))))))))))))))))
 #else
 #define Z_CBPRINTF_ARG_TYPE(arg) \
 	_Generic(arg, \
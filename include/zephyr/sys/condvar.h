@@ -0,0 +1,146 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief public sys_condvar APIs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_CONDVAR_H_
+#define ZEPHYR_INCLUDE_SYS_CONDVAR_H_
+
+/*
+ * sys_condvar exists in user memory working as condition variable for
+ * user mode threads, together with a sys_mutex, when user mode is enabled.
+ * When user mode isn't enabled, sys_condvar behaves like k_condvar.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * sys_condvar structure
+ */
+struct sys_condvar {
+#ifdef CONFIG_USERSPACE
+	/* Incremented by each signal, waiters wait for it to change */
+	struct k_futex futex;
+	atomic_t waiters;
+#else
+	struct k_condvar kernel_condvar;
+#endif
+};
+
+/**
+ * @defgroup user_condvar_apis User mode condition variable APIs
+ * @ingroup usermode_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a sys_condvar
+ *
+ * The condition variable can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct sys_condvar <name>; @endcode
+ *
+ * Route this to memory domains using K_APP_DMEM().
+ *
+ * @param _name Name of the condition variable.
+ */
+#ifdef CONFIG_USERSPACE
+#define SYS_CONDVAR_DEFINE(_name) \
+	struct sys_condvar _name
+#else
+/* Stuff this in the section with the rest of the k_condvar objects, since
+ * they are identical and can be treated as a k_condvar in the boot
+ * initialization code
+ */
+#define SYS_CONDVAR_DEFINE(_name) \
+	STRUCT_SECTION_ITERABLE_ALTERNATE(k_condvar, sys_condvar, _name) = { \
+		.kernel_condvar = Z_CONDVAR_INITIALIZER(_name.kernel_condvar) \
+	}
+#endif
+
+/**
+ * @brief Initialize a condition variable.
+ *
+ * This routine is only necessary to call when the condition variable was
+ * not created with SYS_CONDVAR_DEFINE(). In user mode, the condition
+ * variable must also be known to the kernel, see k_futex_wait().
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 Condition variable initialized.
+ */
+int sys_condvar_init(struct sys_condvar *condvar);
+
+/**
+ * @brief Wake up one thread waiting on a condition variable.
+ *
+ * This does not enter the kernel if no thread is waiting.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL Condition variable not recognized by the kernel.
+ * @retval -EACCES Caller has no access to the condition variable.
+ */
+int sys_condvar_signal(struct sys_condvar *condvar);
+
+/**
+ * @brief Wake up all threads waiting on a condition variable.
+ *
+ * This does not enter the kernel if no thread is waiting.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL Condition variable not recognized by the kernel.
+ * @retval -EACCES Caller has no access to the condition variable.
+ */
+int sys_condvar_broadcast(struct sys_condvar *condvar);
+
+/**
+ * @brief Wait on a condition variable.
+ *
+ * This routine unlocks @a mutex, which must have been locked once by the
+ * calling thread, and waits for @a condvar to be signaled or for the
+ * timeout to expire. The mutex is locked again before returning, in all
+ * cases. As with any condition variable, the caller should check its
+ * condition again after waking up.
+ *
+ * @param condvar Address of the condition variable.
+ * @param mutex Address of the mutex.
+ * @param timeout Waiting period for the condition variable,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 On success.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EPERM Caller does not own the mutex.
+ * @retval -EINVAL Condition variable or mutex not recognized by the kernel.
+ * @retval -EACCES Caller has no access to the condition variable.
+ */
+int sys_condvar_wait(struct sys_condvar *condvar, struct sys_mutex *mutex,
+		     k_timeout_t timeout);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_CONDVAR_H_ */
@@ -100,6 +100,11 @@ struct sys_mem_blocks {
 	/* Bitmap of allocated blocks */
 	sys_bitarray_t *bitmap;
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CPU_HINTS
+	/* Block following the last allocation of each CPU */
+	uint32_t alloc_hint[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 #ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
 	/* Spinlock guarding access to memory block internals */
 	struct k_spinlock  lock;
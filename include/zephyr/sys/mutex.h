@@ -11,9 +11,9 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FUTEX, uncontended sys_mutexes are locked and
+ * unlocked with atomic ops instead of syscalls, and a futex is used to
+ * wait for contended ones, at the cost of priority inheritance.
  */
 
 #ifdef __cplusplus
@@ -25,13 +25,24 @@ extern "C" {
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+#include <zephyr/kernel.h>
+
+struct sys_mutex {
+	/* 0 when unlocked, 1 when locked, 2 when locked and contended */
+	struct k_futex futex;
+	/* Only ever written by the thread holding the mutex */
+	struct k_thread *owner;
+	uint32_t lock_count;
+};
+#else
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* Unused, the state lives in the k_mutex the kernel associates
+	 * with this object
 	 */
 	atomic_t val;
 };
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
@@ -67,11 +78,17 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_set(&mutex->futex.val, 0);
+	mutex->owner = NULL;
+	mutex->lock_count = 0U;
+#else
 	ARG_UNUSED(mutex);
 
 	/* Nothing to do, kernel-side data structures are initialized at
 	 * boot
 	 */
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 __syscall int z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -79,6 +96,10 @@ __syscall int z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 
 __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
 
+int z_sys_mutex_futex_lock(struct sys_mutex *mutex, k_timeout_t timeout);
+
+int z_sys_mutex_futex_unlock(struct sys_mutex *mutex);
+
 /**
  * @brief Lock a mutex.
  *
@@ -101,8 +122,17 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	if (likely(atomic_cas(&mutex->futex.val, 0, 1))) {
+		mutex->owner = k_current_get();
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	return z_sys_mutex_futex_lock(mutex, timeout);
+#else
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 /**
@@ -124,8 +154,11 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	return z_sys_mutex_futex_unlock(mutex);
+#else
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 #include <zephyr/syscalls/mutex.h>
@@ -10,6 +10,10 @@
 #include <zephyr/sys/util.h>
 #include <errno.h>
 
+#ifdef CONFIG_RING_BUFFER_SPSC
+#include <zephyr/sys/barrier.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -55,8 +59,50 @@ struct ring_buf {
 	/** @endcond */
 };
 
+/**
+ * @brief A contiguous area of a ring buffer
+ *
+ * Claimed areas may wrap around the end of the ring buffer, in which case
+ * they are described by two of these.
+ */
+struct ring_buf_vec {
+	/** Start of the area */
+	uint8_t *data;
+	/** Size of the area (in bytes), may be 0 */
+	uint32_t len;
+};
+
 /** @cond INTERNAL_HIDDEN */
 
+/*
+ * The producer only writes the put indexes and the consumer the get ones.
+ * The tail of each is what the other side reads, so with
+ * CONFIG_RING_BUFFER_SPSC it is published after the data it covers was
+ * written or read, and read before that data is accessed.
+ */
+static inline ring_buf_idx_t ring_buf_idx_acquire(const ring_buf_idx_t *idx)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	ring_buf_idx_t value = *(const volatile ring_buf_idx_t *)idx;
+
+	barrier_dmem_fence_full();
+
+	return value;
+#else
+	return *idx;
+#endif
+}
+
+static inline void ring_buf_idx_release(ring_buf_idx_t *idx, ring_buf_idx_t value)
+{
+#ifdef CONFIG_RING_BUFFER_SPSC
+	barrier_dmem_fence_full();
+	*(volatile ring_buf_idx_t *)idx = value;
+#else
+	*idx = value;
+#endif
+}
+
 uint32_t ring_buf_area_claim(struct ring_buf *buf, struct ring_buf_index *ring,
 			     uint8_t **data, uint32_t size);
 int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
@@ -211,12 +257,15 @@ static inline void ring_buf_item_init(struct ring_buf *buf,
  */
 static inline bool ring_buf_is_empty(const struct ring_buf *buf)
 {
-	return buf->get.head == buf->put.tail;
+	return buf->get.head == ring_buf_idx_acquire(&buf->put.tail);
 }
 
 /**
  * @brief Reset ring buffer state.
  *
+ * @warning
+ * This must not be called while the ring buffer is being written or read.
+ *
  * @param buf Address of ring buffer.
  */
 static inline void ring_buf_reset(struct ring_buf *buf)
@@ -233,7 +282,7 @@ static inline void ring_buf_reset(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_space_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t allocated = buf->put.head - buf->get.tail;
+	ring_buf_idx_t allocated = buf->put.head - ring_buf_idx_acquire(&buf->get.tail);
 
 	return buf->size - allocated;
 }
@@ -271,7 +320,7 @@ static inline uint32_t ring_buf_capacity_get(const struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_size_get(const struct ring_buf *buf)
 {
-	ring_buf_idx_t available = buf->put.tail - buf->get.head;
+	ring_buf_idx_t available = ring_buf_idx_acquire(&buf->put.tail) - buf->get.head;
 
 	return available;
 }
@@ -309,6 +358,29 @@ static inline uint32_t ring_buf_put_claim(struct ring_buf *buf,
 				   MIN(size, space));
 }
 
+/**
+ * @brief Allocate buffers for writing data to a ring buffer, across its end.
+ *
+ * This is like @ref ring_buf_put_claim, except that when the free space
+ * wraps around the end of the ring buffer, both parts of it are claimed at
+ * once. Data written to them is committed with @ref ring_buf_put_finish.
+ *
+ * @warning
+ * Use cases involving multiple writers to the ring buffer must prevent
+ * concurrent write operations, either by preventing all writers from
+ * being preempted or by using a mutex to govern writes to the ring buffer.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Allocated areas, in order. The second one is empty if
+ *		    the first one did not reach the end of the ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Total size of the allocated areas which can be smaller than
+ *	   requested if there is not enough free space.
+ */
+uint32_t ring_buf_put_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2],
+				uint32_t size);
+
 /**
  * @brief Indicate number of bytes written to allocated buffers.
  *
@@ -391,6 +463,29 @@ static inline uint32_t ring_buf_get_claim(struct ring_buf *buf,
 				   MIN(size, buf_size));
 }
 
+/**
+ * @brief Get addresses of valid data in a ring buffer, across its end.
+ *
+ * This is like @ref ring_buf_get_claim, except that when the valid data
+ * wraps around the end of the ring buffer, both parts of it are claimed at
+ * once. Processed data is freed with @ref ring_buf_get_finish.
+ *
+ * @warning
+ * Use cases involving multiple reads of the ring buffer must prevent
+ * concurrent read operations, either by preventing all readers from
+ * being preempted or by using a mutex to govern reads to the ring buffer.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Areas of valid data, in order. The second one is empty
+ *		    if the first one did not reach the end of the ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Total size of valid data in the provided areas which can be
+ *	   smaller than requested if there is not enough data.
+ */
+uint32_t ring_buf_get_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2],
+				uint32_t size);
+
 /**
  * @brief Indicate number of bytes read from claimed buffer.
  *
@@ -161,6 +161,27 @@ struct spsc_pbuf *spsc_pbuf_init(void *buf, size_t blen, uint32_t flags);
  */
 int spsc_pbuf_write(struct spsc_pbuf *pb, const char *buf, uint16_t len);
 
+/**
+ * @brief Write several packets to the packet buffer.
+ *
+ * This is equivalent to calling @ref spsc_pbuf_write for each packet, except
+ * that the written packets are made available to the reader at once. If cache
+ * is used, they are written back with a single cache operation (two if they
+ * wrap around the end of the buffer), followed by one for the write index,
+ * instead of two per packet.
+ *
+ * @param pb	A buffer to which to write.
+ * @param bufs	Pointers to the data of each packet.
+ * @param lens	Lengths of each packet. Each must be positive but less than
+ *		@ref SPSC_PBUF_MAX_LEN.
+ * @param count	Number of packets.
+ * @retval int	Number of packets written, which is less than @p count if the
+ *		buffer got full. Negative error code on fail.
+ *		-EINVAL, if one of @p lens is invalid.
+ */
+int spsc_pbuf_write_batch(struct spsc_pbuf *pb, const char *const bufs[], const uint16_t lens[],
+			  size_t count);
+
 /**
  * @brief Allocate space in the packet buffer.
  *
@@ -250,6 +271,31 @@ uint16_t spsc_pbuf_claim(struct spsc_pbuf *pb, char **buf);
  */
 void spsc_pbuf_free(struct spsc_pbuf *pb, uint16_t len);
 
+/**
+ * @brief Callback called for each packet read by @ref spsc_pbuf_read_batch.
+ *
+ * @param data		Packet data, valid until the callback returns.
+ * @param len		Packet length.
+ * @param user_data	User data given to @ref spsc_pbuf_read_batch.
+ */
+typedef void (*spsc_pbuf_batch_cb_t)(const char *data, uint16_t len, void *user_data);
+
+/**
+ * @brief Read all the packets available in the packet buffer.
+ *
+ * Packets are passed in order to @p cb directly from the buffer memory, and
+ * freed together once all of them were processed. If cache is used, all the
+ * stored data is invalidated at once before being read, and the read index is
+ * written back once, instead of several cache operations per packet.
+ *
+ * @param pb		A buffer from which packets will be read.
+ * @param cb		Callback called for each packet.
+ * @param user_data	User data passed to @p cb.
+ *
+ * @retval non-negative Number of packets read.
+ */
+int spsc_pbuf_read_batch(struct spsc_pbuf *pb, spsc_pbuf_batch_cb_t cb, void *user_data);
+
 /**
  * @brief Get maximum utilization of the packet buffer.
  *
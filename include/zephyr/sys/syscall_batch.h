@@ -0,0 +1,82 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Batched system calls
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zephyr/syscall_list.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis Batched System Call APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief One system call of a batch
+ */
+struct k_syscall_batch_entry {
+	/** System call ID, one of the K_SYSCALL_* values */
+	uintptr_t id;
+
+	/** Arguments passed to the system call, in order */
+	uintptr_t args[6];
+
+	/** Value returned by the system call, written by the kernel */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Invoke several system calls with a single trap into the kernel
+ *
+ * The entries are run in order, each one exactly as if its system call had
+ * been invoked directly: the arguments are verified by the system call's own
+ * verification handler, and a verification failure terminates the calling
+ * thread. Only the trap and the check of the entry array itself are shared
+ * by the whole batch, which is what makes sequences of short system calls
+ * like k_sem_give() cheaper.
+ *
+ * The arguments of an entry are laid out as they are passed to the system
+ * call's marshalling function, which for most calls is one argument per
+ * slot. System calls with 64 bit arguments or return values on 32 bit
+ * targets, or with more than 6 arguments, use the same layout as their
+ * generated wrappers.
+ *
+ * Entries with an unknown ID, or with the ID of this function, get
+ * -ENOSYS as return value.
+ *
+ * This is only meaningful for user mode threads, supervisor threads call
+ * the kernel APIs directly.
+ *
+ * @param entries System calls to invoke, with their return values updated
+ * @param count Number of entries, at most CONFIG_SYSCALL_BATCH_MAX
+ *
+ * @return Number of entries that were run
+ * @retval -EINVAL @p count is larger than CONFIG_SYSCALL_BATCH_MAX
+ * @retval -EPERM Called from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
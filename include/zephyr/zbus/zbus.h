@@ -65,6 +65,23 @@ struct zbus_channel_data {
 	struct net_buf_pool *msg_subscriber_pool;
 #endif /* ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION */
 
+#if defined(CONFIG_ZBUS_REF_CHANNEL) || defined(__DOXYGEN__)
+	/** Reference channel flag. Indicates the message is a reference to a shared
+	 * `net_buf` payload, see @ref ZBUS_CHAN_REF_DEFINE.
+	 */
+	bool is_ref;
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Sequence counter of the lock-free read copies, see @ref ZBUS_CHAN_SEQLOCK_DEFINE. */
+	atomic_t seq;
+
+	/** Two copies of the message read without locking the channel, or NULL if the channel
+	 * is not a seqlock channel.
+	 */
+	void *latch;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
 	/** Kernel timestamp of the last publish action on this channel */
 	k_ticks_t publish_timestamp;
@@ -120,6 +137,7 @@ enum __packed zbus_observer_type {
 	ZBUS_OBSERVER_LISTENER_TYPE,
 	ZBUS_OBSERVER_SUBSCRIBER_TYPE,
 	ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_ASYNC_LISTENER_TYPE,
 };
 
 struct zbus_observer_data {
@@ -132,6 +150,26 @@ struct zbus_observer_data {
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 };
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+/**
+ * @brief Async listener state.
+ *
+ * Use @ref ZBUS_ASYNC_LISTENER_DEFINE to instantiate it.
+ */
+struct zbus_async_listener {
+	/** Callback executed by the dispatcher with the channel and a copy of the message. */
+	void (*callback)(const struct zbus_channel *chan, const void *msg);
+
+	/** Thread priority the callback runs at. */
+	int priority;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct k_fifo fifo;
+	struct k_work work;
+	/** @endcond */
+};
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 /**
  * @brief Type used to represent an observer.
  *
@@ -171,6 +209,13 @@ struct zbus_observer {
 		 */
 		struct k_fifo *message_fifo;
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+		/** Async listener state. It turns the observer into an async listener. It only
+		 * exists if the @kconfig{CONFIG_ZBUS_ASYNC_LISTENER} is enabled.
+		 */
+		struct zbus_async_listener *async_listener;
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 	};
 };
 
@@ -275,7 +320,7 @@ struct zbus_channel_observation {
 #define _ZBUS_MESSAGE_NAME(_name) _CONCAT(_zbus_message_, _name)
 
 /* clang-format off */
-#define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data)                               \
+#define _ZBUS_CHAN_DEFINE_EXT(_name, _id, _type, _validator, _user_data, _is_ref, _latch)          \
 	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {                       \
 		.observers_start_idx = -1,                                                         \
 		.observers_end_idx = -1,                                                           \
@@ -285,6 +330,8 @@ struct zbus_channel_observation {
 		 IF_ENABLED(CONFIG_ZBUS_RUNTIME_OBSERVERS,                                         \
 			   (.observers = SYS_SLIST_STATIC_INIT(                                    \
 				&_CONCAT(_zbus_chan_data_, _name).observers),))                    \
+		IF_ENABLED(CONFIG_ZBUS_REF_CHANNEL, (.is_ref = _is_ref,))                          \
+		IF_ENABLED(CONFIG_ZBUS_CHANNEL_SEQLOCK, (.latch = _latch,))                        \
 	};                                                                                         \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                                       \
 	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_channel, _name) = {                    \
@@ -300,6 +347,9 @@ struct zbus_channel_observation {
 	}
 /* clang-format on */
 
+#define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data)                               \
+	_ZBUS_CHAN_DEFINE_EXT(_name, _id, _type, _validator, _user_data, false, NULL)
+
 /** @endcond */
 
 /* clang-format off */
@@ -418,6 +468,66 @@ struct zbus_channel_observation {
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+/**
+ * @brief Zbus seqlock channel definition.
+ *
+ * This macro defines a channel that is read without locking it, for small state messages
+ * read at high rates. Besides the message, the channel keeps two copies of it, updated with a
+ * sequence counter when publishing and when finishing a claim. zbus_chan_read() copies the
+ * message from them without taking the channel semaphore, and retries if a publish updated the
+ * copy during the read. Those reads never wait for the channel, not even when it is claimed, and
+ * can be done from ISRs and any thread priority without priority inversion. A read preempting
+ * the publisher always succeeds at the first attempt.
+ *
+ * It requires @kconfig{CONFIG_ZBUS_CHANNEL_SEQLOCK}. The arguments are the same as for
+ * @ref ZBUS_CHAN_DEFINE.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_SEQLOCK_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)      \
+	static _type _ZBUS_MESSAGE_NAME(_name) = _init_val;                                        \
+	static _type _CONCAT(_zbus_latch_, _name)[2] = {_init_val, _init_val};                     \
+	_ZBUS_CHAN_DEFINE_EXT(_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data, false,   \
+			      _CONCAT(_zbus_latch_, _name));                                       \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
+/**
+ * @brief Zbus reference channel definition.
+ *
+ * This macro defines a channel whose message is a reference to a `net_buf` payload, for big
+ * messages like camera frames or audio blocks that must not be copied. The payload is published
+ * with zbus_chan_pub_ref() and shared read-only by all the observers. It is freed, e.g. returned
+ * to its `net_buf` pool, when the channel and all the observers have released their references.
+ *
+ * Listeners access the payload with zbus_chan_ref_msg(). Subscribers take a reference to it with
+ * zbus_chan_ref_get(). Message subscribers receive their own reference as the message.
+ *
+ * @note zbus_chan_pub() and zbus_chan_read() cannot be used with reference channels.
+ *
+ * @param _name The channel's name.
+ * @param _validator The validator function, called with the data and length of the payload.
+ * @param _user_data A pointer to the user data.
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ */
+#define ZBUS_CHAN_REF_DEFINE(_name, _validator, _user_data, _observers)                            \
+	static struct net_buf *_ZBUS_MESSAGE_NAME(_name);                                          \
+	_ZBUS_CHAN_DEFINE_EXT(_name, ZBUS_CHAN_ID_INVALID, struct net_buf *, _validator,           \
+			      _user_data, true, NULL);                                             \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
 /**
  * @brief Initialize a message.
  *
@@ -555,6 +665,64 @@ struct zbus_channel_observation {
  * @param[in] _name The subscriber's name.
  */
 #define ZBUS_MSG_SUBSCRIBER_DEFINE(_name) ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, true)
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+void z_zbus_async_listener_work(struct k_work *work);
+/** @endcond */
+
+/* clang-format off */
+
+/**
+ * @brief Define and initialize an async listener.
+ *
+ * This macro defines an observer of @ref ZBUS_OBSERVER_ASYNC_LISTENER_TYPE type. Like a message
+ * subscriber, the async listener receives a copy of every message published to the channels it
+ * observes. Its callback is executed for each message, in sequence, by a thread of the zbus
+ * dispatcher pool at the given priority, while the publisher returns as soon as the copy is
+ * queued. The callbacks of different async listeners run in parallel on SMP systems.
+ *
+ * @param[in] _name The listener's name.
+ * @param[in] _cb The callback function, receiving the channel and the message.
+ * @param[in] _prio Thread priority of the callback.
+ * @param[in] _enable The listener's initial state.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _prio, _enable)                        \
+	static struct zbus_async_listener _zbus_async_listener_##_name = {                      \
+		.callback = (_cb),                                                               \
+		.priority = (_prio),                                                             \
+		.fifo = Z_FIFO_INITIALIZER(_zbus_async_listener_##_name.fifo),                   \
+		.work = Z_WORK_INITIALIZER(z_zbus_async_listener_work),                          \
+	};                                                                                       \
+	static struct zbus_observer_data _CONCAT(_zbus_obs_data_, _name) = {                     \
+		.enabled = _enable,                                                              \
+		IF_ENABLED(CONFIG_ZBUS_PRIORITY_BOOST, (                                         \
+			.priority = ZBUS_MIN_THREAD_PRIORITY,                                    \
+		))                                                                               \
+	};                                                                                       \
+	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_observer, _name) = {                 \
+		ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */                                  \
+		.type = ZBUS_OBSERVER_ASYNC_LISTENER_TYPE,                                       \
+		.data = &_CONCAT(_zbus_obs_data_, _name),                                        \
+		.async_listener = &_zbus_async_listener_##_name,                                 \
+	}
+/* clang-format on */
+
+/**
+ * @brief Define and initialize an enabled async listener.
+ *
+ * @see ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE
+ *
+ * @param[in] _name The listener's name.
+ * @param[in] _cb The callback function, receiving the channel and the message.
+ * @param[in] _prio Thread priority of the callback.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE(_name, _cb, _prio)                                             \
+	ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _prio, true)
+
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 /**
  *
  * @brief Publish to a channel
@@ -581,7 +749,8 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 /**
  * @brief Read a channel
  *
- * This routine reads a message from a channel.
+ * This routine reads a message from a channel. Seqlock channels, defined with
+ * @ref ZBUS_CHAN_SEQLOCK_DEFINE, are read without locking them and the timeout is ignored.
  *
  * @param[in] chan The channel's reference.
  * @param[out] msg Reference to the message where the read function copies the channel's
@@ -656,6 +825,75 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_REF_CHANNEL) || defined(__DOXYGEN__)
+
+struct net_buf;
+
+/**
+ * @brief Publish a payload reference to a reference channel
+ *
+ * This routine publishes a `net_buf` payload to a channel defined with
+ * @ref ZBUS_CHAN_REF_DEFINE without copying it. Once published, the channel owns the caller's
+ * reference and releases the one to the previously published payload. The payload must not be
+ * changed after publishing it.
+ *
+ * @param chan The channel's reference.
+ * @param buf The payload. The caller keeps its reference when -ENOMSG, -EBUSY or -EAGAIN is
+ * returned, as the payload is not published then.
+ * @param timeout Waiting period to publish the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The payload is invalid based on the validator function.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOMEM Some message subscribers could not receive the payload.
+ * @retval -EFAULT A parameter is incorrect, or the channel is not a reference channel. The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_ref(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Get a reference to the payload of a reference channel
+ *
+ * This routine takes a new reference to the last payload published to a reference channel. The
+ * caller must release it with net_buf_unref() when done with the payload.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] buf The payload.
+ * @param[in] timeout Waiting period to read the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Reference taken.
+ * @retval -ENODATA Nothing was published to the channel yet.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the channel is not a reference channel. The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_ref_get(const struct zbus_channel *chan, struct net_buf **buf, k_timeout_t timeout);
+
+/**
+ * @brief Get the payload of a reference channel directly.
+ *
+ * @warning This function must only be used directly for already locked channels, like
+ * zbus_chan_const_msg(). The payload can only be used while the channel is locked, unless a
+ * reference is taken to it.
+ *
+ * @param chan The channel's reference.
+ *
+ * @return The payload, or NULL if nothing was published to the channel yet.
+ */
+static inline struct net_buf *zbus_chan_ref_msg(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+	__ASSERT(chan->data->is_ref, "chan must be a reference channel");
+
+	return *(struct net_buf *const *)chan->message;
+}
+
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
@@ -1112,7 +1350,8 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
  *
  * @param[in] sub The subscriber's reference.
  * @param[out] chan The notification channel's reference.
- * @param[out] msg A reference to a copy of the published message.
+ * @param[out] msg A reference to a copy of the published message. For reference channels, the
+ * message is a new reference to the payload, to be released with net_buf_unref().
  * @param[in] timeout Waiting period for a notification arrival,
  *                or one of the special values, K_NO_WAIT and K_FOREVER.
  *
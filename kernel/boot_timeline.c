@@ -0,0 +1,53 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/debug/boot_timeline.h>
+#include <kernel_internal.h>
+
+struct boot_timeline boot_timeline = {
+	.magic = BOOT_TIMELINE_MAGIC,
+	.capacity = CONFIG_BOOT_TIMELINE_ENTRIES,
+};
+
+static uint8_t current_level;
+
+void z_boot_timeline_level_set(uint8_t level)
+{
+	current_level = level;
+}
+
+void z_boot_timeline_record(const struct device *dev, int (*init_fn)(void), uint32_t start,
+			    int result)
+{
+	uint32_t end = k_cycle_get_32();
+	atomic_val_t idx = atomic_inc(&boot_timeline.count);
+	struct boot_timeline_entry *entry;
+
+	if (idx >= ARRAY_SIZE(boot_timeline.entries)) {
+		return;
+	}
+
+	entry = &boot_timeline.entries[idx];
+	entry->dev = dev;
+	entry->init_fn = init_fn;
+	entry->start = start;
+	entry->end = end;
+	entry->result = (int16_t)result;
+	entry->level = current_level;
+}
+
+void z_boot_timeline_main(void)
+{
+	boot_timeline.main_cycles = k_cycle_get_32();
+	boot_timeline.cycles_per_sec = sys_clock_hw_cycles_per_sec();
+	current_level = BOOT_TIMELINE_LEVEL_RUNTIME;
+}
+
+const struct boot_timeline *boot_timeline_get(void)
+{
+	return &boot_timeline;
+}
@@ -14,6 +14,93 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/pm/device_runtime.h>
+#include <kernel_internal.h>
+
+#ifdef CONFIG_DEVICE_NAME_HASH
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DEVICE_NAME_HASH_SIZE),
+	     "CONFIG_DEVICE_NAME_HASH_SIZE must be a power of two");
+
+#define HASH_MASK (CONFIG_DEVICE_NAME_HASH_SIZE - 1U)
+
+/* States of the hash tables, built on the first lookup */
+enum {
+	HASH_EMPTY,
+	HASH_BUILDING,
+	HASH_READY,
+	HASH_OVERFLOW,
+};
+
+static atomic_t hash_state = ATOMIC_INIT(HASH_EMPTY);
+
+/* Open addressing with linear probing, DEVICE_HANDLE_NULL marks free
+ * entries. Devices with the same key are found in section order, like
+ * the linear search does.
+ */
+static device_handle_t name_hash[CONFIG_DEVICE_NAME_HASH_SIZE];
+#ifdef CONFIG_DEVICE_DT_METADATA
+static device_handle_t nodelabel_hash[CONFIG_DEVICE_NAME_HASH_SIZE];
+#endif /* CONFIG_DEVICE_DT_METADATA */
+
+/* FNV-1a, device names are short and this needs no configuration */
+static uint32_t name_hash_get(const char *name)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*name != '\0') {
+		hash = (hash ^ (uint8_t)*name++) * 16777619U;
+	}
+
+	return hash;
+}
+
+static bool hash_insert(device_handle_t *table, const char *key, device_handle_t handle)
+{
+	uint32_t idx = name_hash_get(key);
+
+	for (size_t n = 0; n < CONFIG_DEVICE_NAME_HASH_SIZE; n++, idx++) {
+		if (table[idx & HASH_MASK] == DEVICE_HANDLE_NULL) {
+			table[idx & HASH_MASK] = handle;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void hash_build(void)
+{
+	bool ok = true;
+
+	STRUCT_SECTION_FOREACH(device, dev) {
+		device_handle_t handle = device_handle_get(dev);
+
+		ok = ok && hash_insert(name_hash, dev->name, handle);
+
+#ifdef CONFIG_DEVICE_DT_METADATA
+		const struct device_dt_nodelabels *nl = device_get_dt_nodelabels(dev);
+
+		for (size_t i = 0; (nl != NULL) && (i < nl->num_nodelabels); i++) {
+			ok = ok && hash_insert(nodelabel_hash, nl->nodelabels[i], handle);
+		}
+#endif /* CONFIG_DEVICE_DT_METADATA */
+	}
+
+	atomic_set(&hash_state, ok ? HASH_READY : HASH_OVERFLOW);
+}
+
+/* Returns false if the linear search is to be used instead */
+static bool hash_available(void)
+{
+	atomic_val_t state = atomic_get(&hash_state);
+
+	if ((state == HASH_EMPTY) && atomic_cas(&hash_state, HASH_EMPTY, HASH_BUILDING)) {
+		hash_build();
+		state = atomic_get(&hash_state);
+	}
+
+	return state == HASH_READY;
+}
+#endif /* CONFIG_DEVICE_NAME_HASH */
 
 /**
  * @brief Initialize state for all static devices.
@@ -33,7 +120,15 @@ int do_device_init(const struct device *dev)
 	int rc = 0;
 
 	if (dev->ops.init != NULL) {
+#ifdef CONFIG_BOOT_TIMELINE
+		uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_BOOT_TIMELINE */
+
 		rc = dev->ops.init(dev);
+
+#ifdef CONFIG_BOOT_TIMELINE
+		z_boot_timeline_record(dev, NULL, start, rc);
+#endif /* CONFIG_BOOT_TIMELINE */
 		/* If initialization failed, record in dev->state->init_res
 		 * the POSITIVE value of the resulting errno
 		 */
@@ -102,6 +197,26 @@ const struct device *z_impl_device_get_binding(const char *name)
 		return NULL;
 	}
 
+#ifdef CONFIG_DEVICE_NAME_HASH
+	if (hash_available()) {
+		uint32_t idx = name_hash_get(name);
+
+		for (size_t n = 0; n < CONFIG_DEVICE_NAME_HASH_SIZE; n++, idx++) {
+			const struct device *dev = device_from_handle(name_hash[idx & HASH_MASK]);
+
+			if (dev == NULL) {
+				break;
+			}
+
+			if ((dev->name == name) || (strcmp(name, dev->name) == 0)) {
+				return z_impl_device_is_ready(dev) ? dev : NULL;
+			}
+		}
+
+		return NULL;
+	}
+#endif /* CONFIG_DEVICE_NAME_HASH */
+
 	/* Return NULL if the device matching 'name' is not ready. */
 	STRUCT_SECTION_FOREACH(device, dev) {
 		if ((dev->name == name) || (strcmp(name, dev->name) == 0)) {
@@ -152,6 +267,35 @@ const struct device *z_impl_device_get_by_dt_nodelabel(const char *nodelabel)
 	 * elements. We therefore skip the pointer comparison that
 	 * device_get_binding() does.
 	 */
+#ifdef CONFIG_DEVICE_NAME_HASH
+	if (hash_available()) {
+		uint32_t idx = name_hash_get(nodelabel);
+
+		for (size_t n = 0; n < CONFIG_DEVICE_NAME_HASH_SIZE; n++, idx++) {
+			const struct device *dev =
+				device_from_handle(nodelabel_hash[idx & HASH_MASK]);
+			const struct device_dt_nodelabels *nl;
+
+			if (dev == NULL) {
+				break;
+			}
+
+			nl = device_get_dt_nodelabels(dev);
+			if (!z_impl_device_is_ready(dev) || nl == NULL) {
+				continue;
+			}
+
+			for (size_t i = 0; i < nl->num_nodelabels; i++) {
+				if (strcmp(nodelabel, nl->nodelabels[i]) == 0) {
+					return dev;
+				}
+			}
+		}
+
+		return NULL;
+	}
+#endif /* CONFIG_DEVICE_NAME_HASH */
+
 	STRUCT_SECTION_FOREACH(device, dev) {
 		const struct device_dt_nodelabels *nl = device_get_dt_nodelabels(dev);
 
@@ -31,6 +31,17 @@ static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZ
 				   K_THREAD_STACK_LEN(CONFIG_DYNAMIC_THREAD_STACK_SIZE));
 SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
 
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+/* Heap allocated stacks of the pool stack size, which are kept when freed
+ * so the next allocation does not have to go through the heap again.
+ */
+static struct dyn_stack_cache_entry {
+	k_thread_stack_t *stack;
+	bool in_use;
+} dynamic_stack_cache[CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE];
+static struct k_spinlock dynamic_stack_cache_lock;
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0 */
+
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size, int flags)
 {
 	int rv;
@@ -56,7 +67,7 @@ static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size, int flags)
 	return stack;
 }
 
-static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
+static k_thread_stack_t *z_thread_stack_alloc_heap(size_t size, int flags)
 {
 	if ((flags & K_USER) == K_USER) {
 #ifdef CONFIG_DYNAMIC_OBJECTS
@@ -72,6 +83,87 @@ static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
 	return z_thread_aligned_alloc(Z_KERNEL_STACK_OBJ_ALIGN, K_KERNEL_STACK_LEN(size));
 }
 
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
+{
+	struct dyn_stack_cache_entry *entry = NULL;
+	k_thread_stack_t *stack;
+	k_spinlock_key_t key;
+
+	/* User stacks are kernel objects whose permissions must not be
+	 * inherited by the next owner, so they are never cached.
+	 */
+	if (((flags & K_USER) == K_USER) || (size > CONFIG_DYNAMIC_THREAD_STACK_SIZE)) {
+		return z_thread_stack_alloc_heap(size, flags);
+	}
+
+	key = k_spin_lock(&dynamic_stack_cache_lock);
+
+	/* Prefer a cached stack, else take the first unused entry */
+	for (size_t i = 0; i < ARRAY_SIZE(dynamic_stack_cache); i++) {
+		if (dynamic_stack_cache[i].in_use) {
+			continue;
+		}
+
+		if (dynamic_stack_cache[i].stack != NULL) {
+			entry = &dynamic_stack_cache[i];
+			break;
+		}
+
+		if (entry == NULL) {
+			entry = &dynamic_stack_cache[i];
+		}
+	}
+
+	if (entry != NULL) {
+		entry->in_use = true;
+	}
+
+	k_spin_unlock(&dynamic_stack_cache_lock, key);
+
+	if (entry == NULL) {
+		return z_thread_stack_alloc_heap(size, flags);
+	}
+
+	if (entry->stack != NULL) {
+		return entry->stack;
+	}
+
+	/* Sized for any request the cache serves, so it can be reused */
+	stack = z_thread_stack_alloc_heap(CONFIG_DYNAMIC_THREAD_STACK_SIZE, flags);
+
+	key = k_spin_lock(&dynamic_stack_cache_lock);
+	entry->stack = stack;
+	entry->in_use = (stack != NULL);
+	k_spin_unlock(&dynamic_stack_cache_lock, key);
+
+	return stack;
+}
+
+static bool z_thread_stack_free_cache(k_thread_stack_t *stack)
+{
+	bool cached = false;
+
+	K_SPINLOCK(&dynamic_stack_cache_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(dynamic_stack_cache); i++) {
+			if (dynamic_stack_cache[i].in_use &&
+			    (dynamic_stack_cache[i].stack == stack)) {
+				dynamic_stack_cache[i].in_use = false;
+				cached = true;
+				break;
+			}
+		}
+	}
+
+	return cached;
+}
+#else
+static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t size, int flags)
+{
+	return z_thread_stack_alloc_heap(size, flags);
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0 */
+
 k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
 {
 	k_thread_stack_t *stack = NULL;
@@ -139,6 +231,12 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 		}
 	}
 
+#if CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0
+	if (z_thread_stack_free_cache(stack)) {
+		return 0;
+	}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE > 0 */
+
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_ALLOC)) {
 #ifdef CONFIG_USERSPACE
 		if (k_object_find(stack)) {
@@ -18,6 +18,15 @@
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
  *
+ * With CONFIG_EVENTS_WAITER_INDEX, waiting threads are also kept in lists
+ * indexed by event number, so that only the threads that may match get
+ * processed. A waiting thread never matches the current set of events, so it
+ * can only be woken up once an event it waits for that is not set yet gets
+ * posted. Threads waiting for all of their events are indexed by the first
+ * one still missing, threads waiting for any of them by the list all of them
+ * fall in, if there is one. The remaining threads are kept in a spanning list
+ * processed whenever one of the events they wait for gets posted.
+ *
  * @brief Kernel event object
  */
 
@@ -30,6 +39,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -57,6 +67,10 @@ void z_impl_k_event_init(struct k_event *event)
 
 	event->events = 0;
 	event->lock = (struct k_spinlock) {};
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	event->waiter_lists = 0;
+	event->spanning_events = 0;
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
@@ -104,11 +118,10 @@ static uint32_t are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match;
 }
 
-static int event_walk_op(struct k_thread *thread, void *data)
+static bool event_match(struct k_thread *thread, struct event_walk_data *event_data)
 {
 	uint32_t match;
 	unsigned int wait_condition;
-	struct event_walk_data *event_data = data;
 
 	wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
 
@@ -141,8 +154,123 @@ static int event_walk_op(struct k_thread *thread, void *data)
 #endif /* CONFIG_SYS_CLOCK_EXISTS */
 	}
 
+	return match != 0;
+}
+
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+#define WAITER_LISTS   CONFIG_EVENTS_WAITER_INDEX_BUCKETS
+#define SPANNING_LIST  (-1)
+
+/* Set of lists the given events are indexed in */
+static uint32_t events_to_lists(uint32_t events)
+{
+	for (unsigned int shift = WAITER_LISTS; shift < 32U; shift += WAITER_LISTS) {
+		events |= events >> shift;
+	}
+
+	return events & GENMASK(WAITER_LISTS - 1, 0);
+}
+
+/* List a waiting thread belongs in, given the current set of events */
+static int waiter_list(struct k_thread *thread, uint32_t current)
+{
+	uint32_t watched = thread->events;
+	uint32_t lists;
+
+	if ((thread->event_options & K_EVENT_WAIT_MASK) == K_EVENT_WAIT_ALL) {
+		/* Cannot match before its first missing event gets posted */
+		watched = BIT(u32_count_trailing_zeros(watched & ~current));
+	}
+
+	lists = events_to_lists(watched);
+
+	return IS_POWER_OF_TWO(lists) ? (int)u32_count_trailing_zeros(lists) : SPANNING_LIST;
+}
+
+/* sched_spinlock must be held */
+static void waiter_index_add(struct k_event *event, struct k_thread *thread, int list)
+{
+	sys_dlist_t *waiters;
+
+	if (list == SPANNING_LIST) {
+		if (event->spanning_events == 0U) {
+			sys_dlist_init(&event->spanning_waiters);
+		}
+		event->spanning_events |= thread->events;
+		waiters = &event->spanning_waiters;
+	} else {
+		if ((event->waiter_lists & BIT(list)) == 0U) {
+			sys_dlist_init(&event->waiters[list]);
+			event->waiter_lists |= BIT(list);
+		}
+		waiters = &event->waiters[list];
+	}
+
+	sys_dlist_append(waiters, &thread->event_node);
+}
+
+/*
+ * Process the threads that may match now that the given events got posted.
+ * Matching threads stay indexed until they get unpended. sched_spinlock must
+ * be held.
+ */
+static void waiter_index_walk(struct k_event *event, uint32_t posted,
+			      struct event_walk_data *event_data)
+{
+	uint32_t lists = events_to_lists(posted) & event->waiter_lists;
+	struct k_thread *thread;
+	struct k_thread *next;
+
+	while (lists != 0U) {
+		int list = (int)u32_count_trailing_zeros(lists);
+		sys_dlist_t *waiters = &event->waiters[list];
+		int moved_to;
+
+		lists &= ~BIT(list);
+
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(waiters, thread, next, event_node) {
+			if (event_match(thread, event_data)) {
+				continue;
+			}
+
+			/* Got some of its events, now watch a missing one */
+			moved_to = waiter_list(thread, event_data->events);
+			if (moved_to != list) {
+				sys_dlist_remove(&thread->event_node);
+				waiter_index_add(event, thread, moved_to);
+			}
+		}
+
+		if (sys_dlist_is_empty(waiters)) {
+			event->waiter_lists &= ~BIT(list);
+		}
+	}
+
+	if ((posted & event->spanning_events) != 0U) {
+		uint32_t spanning_events = 0U;
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&event->spanning_waiters, thread, event_node) {
+			if (!event_match(thread, event_data)) {
+				spanning_events |= thread->events;
+			}
+		}
+
+		/*
+		 * Matching threads still get removed from the list once
+		 * unpended, and no thread can be added meanwhile as the
+		 * event lock is held until then.
+		 */
+		event->spanning_events = spanning_events;
+	}
+}
+#else
+static int event_walk_op(struct k_thread *thread, void *data)
+{
+	(void)event_match(thread, data);
+
 	return 0;
 }
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
@@ -174,7 +302,13 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 
 	data.events = events;
 	data.clear_events = 0;
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	K_SPINLOCK(&_sched_spinlock) {
+		waiter_index_walk(event, events & ~event->events, &data);
+	}
+#else
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -308,6 +442,12 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	K_SPINLOCK(&_sched_spinlock) {
+		waiter_index_add(event, thread, waiter_list(thread, event->events));
+	}
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
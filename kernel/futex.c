@@ -78,12 +78,16 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EINVAL;
 	}
 
+	key = k_spin_lock(&futex_data->lock);
+
+	/* Checked with the lock held, so that a wake up issued by another
+	 * CPU right after changing the value cannot be missed
+	 */
 	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&futex_data->lock, key);
 		return -EAGAIN;
 	}
 
-	key = k_spin_lock(&futex_data->lock);
-
 	ret = z_pend_curr(&futex_data->lock,
 			key, &futex_data->wait_q, timeout);
 	if (ret == -EAGAIN) {
@@ -24,9 +24,20 @@ void z_sched_ipi(void);
 void flag_ipi(uint32_t ipi_mask);
 void signal_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
+
+/* Called with interrupts locked before the current CPU picks the next
+ * thread to run: it no longer needs the IPI it may have been sent.
+ */
+static inline void ipi_inflight_clear(void)
+{
+#ifdef CONFIG_IPI_COALESCE
+	atomic_and(&_kernel.inflight_ipi, ~(atomic_val_t)BIT(_current_cpu->id));
+#endif /* CONFIG_IPI_COALESCE */
+}
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
+#define ipi_inflight_clear() do { } while (false)
 #endif /* CONFIG_SMP */
 
 
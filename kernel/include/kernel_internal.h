@@ -75,6 +75,28 @@ void *z_thread_aligned_alloc(size_t align, size_t size);
  */
 void *z_thread_malloc(size_t size);
 
+#ifdef CONFIG_HEAP_CACHE
+/**
+ * @brief Allocate a small block from the current CPU's cache of a k_heap
+ *
+ * @param heap Heap to allocate from
+ * @param align Required alignment of the block, 0 if none
+ * @param bytes Block size in bytes
+ * @return A previously freed block, or NULL if none is cached
+ */
+void *z_heap_cache_alloc(struct k_heap *heap, size_t align, size_t bytes);
+
+/**
+ * @brief Give all blocks cached by any CPU back to a k_heap
+ *
+ * Must be called with the heap's lock held.
+ *
+ * @param heap Heap to reclaim cached blocks for
+ * @return true if any block was given back
+ */
+bool z_heap_cache_reclaim(struct k_heap *heap);
+#endif /* CONFIG_HEAP_CACHE */
+
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -208,6 +230,39 @@ bool pm_system_suspend(int32_t ticks);
 
 #endif /* CONFIG_PM */
 
+#ifdef CONFIG_BOOT_TIMELINE
+struct device;
+
+/**
+ * Set the initialization level recorded for the following entries.
+ */
+void z_boot_timeline_level_set(uint8_t level);
+
+/**
+ * Record an initialization that started at the given cycle count and
+ * just returned.
+ */
+void z_boot_timeline_record(const struct device *dev, int (*init_fn)(void), uint32_t start,
+			    int result);
+
+/**
+ * Record that main() is about to be called.
+ */
+void z_boot_timeline_main(void);
+#endif /* CONFIG_BOOT_TIMELINE */
+
+#if defined(CONFIG_DEMAND_PAGING_STATS) && defined(CONFIG_EVICTION_SLRU)
+/**
+ * Count a page promoted to the protected queue of the eviction algorithm.
+ */
+void z_paging_stats_eviction_promoted_inc(void);
+
+/**
+ * Count a page demoted to the probation queue of the eviction algorithm.
+ */
+void z_paging_stats_eviction_demoted_inc(void);
+#endif /* CONFIG_DEMAND_PAGING_STATS && CONFIG_EVICTION_SLRU */
+
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 /**
  * Initialize the timing histograms for demand paging.
@@ -65,10 +65,13 @@ void z_reschedule_irqlock(uint32_t key);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
+bool z_thread_is_active_elsewhere(struct k_thread *thread);
 void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
 void z_reset_time_slice(struct k_thread *curr);
+void z_time_slice_expired(int cpu);
+void z_time_slice_contend(void);
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
 void z_requeue_current(struct k_thread *curr);
@@ -153,6 +156,13 @@ static inline void unpend_thread_no_timeout(struct k_thread *thread)
 	_priq_wait_remove(&pended_on_thread(thread)->waitq, thread);
 	z_mark_thread_as_not_pending(thread);
 	thread->base.pended_on = NULL;
+
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/* Whatever woke it, the thread no longer waits on its event object */
+	if (sys_dnode_is_linked(&thread->event_node)) {
+		sys_dlist_remove(&thread->event_node);
+	}
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 }
 
 /*
@@ -319,6 +329,11 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+/**
+ * @brief Record when a thread is made ready, for the wakeup latency histogram
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -330,6 +345,30 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Charge the time the current thread ran so far, as a switch would
+ */
+void z_sched_usage_cbs_sync(void);
+
+/**
+ * @brief Start enforcing the server budget of a thread being switched in
+ */
+void z_sched_cbs_start(struct k_thread *thread);
+
+/**
+ * @brief Charge a server thread for cycles it ran, and stop enforcement
+ */
+void z_sched_cbs_stop(struct k_thread *thread, uint32_t cycles);
+
+/**
+ * @brief Apply the server rules on budget exhaustion of the current thread
+ *
+ * Called out of each timer interrupt and scheduler IPI.
+ */
+void z_sched_cbs_check(void);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -339,6 +378,23 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
 
+/*
+ * Count a context switch as an RCU quiescent state of the current CPU,
+ * unless it leaves or resumes a thread holding the scheduler lock. Only a
+ * MetaIRQ thread can preempt such a thread, whose read-side section is
+ * then not over.
+ */
+static inline void z_rcu_qs_switch(struct k_thread *old_thread, struct k_thread *new_thread)
+{
+	ARG_UNUSED(old_thread);
+	ARG_UNUSED(new_thread);
+#if defined(CONFIG_RCU) && defined(CONFIG_SMP)
+	if ((old_thread->base.sched_locked == 0U) && (new_thread->base.sched_locked == 0U)) {
+		arch_curr_cpu()->rcu_qs++;
+	}
+#endif /* CONFIG_RCU && CONFIG_SMP */
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,7 @@
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/barrier.h>
 #include <kernel_arch_func.h>
+#include <ipi.h>
 
 #ifdef CONFIG_STACK_SENTINEL
 extern void z_check_stack_sentinel(void);
@@ -118,6 +119,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 		(void) k_spin_lock(&_sched_spinlock);
 	}
 
+	ipi_inflight_clear();
 	new_thread = z_swap_next_thread();
 
 	if (new_thread != old_thread) {
@@ -125,6 +127,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 #ifdef CONFIG_SMP
 		new_thread->base.cpu = arch_curr_cpu()->id;
+		z_rcu_qs_switch(old_thread, new_thread);
 
 		if (!is_spinlock) {
 			z_smp_release_global_lock(new_thread);
@@ -16,6 +16,7 @@
 #define _priq_run_add		z_priq_simple_add
 #define _priq_run_remove	z_priq_simple_remove
 #define _priq_run_yield         z_priq_simple_yield
+#define _priq_run_has_peer	z_priq_simple_has_peer
 # if defined(CONFIG_SCHED_CPU_MASK)
 #  define _priq_run_best	z_priq_simple_mask_best
 # else
@@ -27,6 +28,7 @@
 #define _priq_run_add		z_priq_rb_add
 #define _priq_run_remove	z_priq_rb_remove
 #define _priq_run_yield         z_priq_rb_yield
+#define _priq_run_has_peer	z_priq_rb_has_peer
 #define _priq_run_best		z_priq_rb_best
  /* Multi Queue Scheduling */
 #elif defined(CONFIG_SCHED_MULTIQ)
@@ -34,6 +36,7 @@
 #define _priq_run_add		z_priq_mq_add
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_yield         z_priq_mq_yield
+#define _priq_run_has_peer	z_priq_mq_has_peer
 #define _priq_run_best		z_priq_mq_best
 #endif
 
@@ -47,6 +50,11 @@
 #define _priq_wait_add		z_priq_simple_add
 #define _priq_wait_remove	z_priq_simple_remove
 #define _priq_wait_best		z_priq_simple_best
+/* Multi Queue Wait Queue */
+#elif defined(CONFIG_WAITQ_MULTIQ)
+#define _priq_wait_add		z_priq_mq_wait_add
+#define _priq_wait_remove	z_priq_mq_wait_remove
+#define _priq_wait_best		z_priq_mq_wait_best
 #endif
 
 #if defined(CONFIG_64BIT)
@@ -155,6 +163,22 @@ static ALWAYS_INLINE void z_priq_simple_yield(sys_dlist_t *pq)
 #endif
 }
 
+/* Whether another queued thread has the same priority as the queued one */
+static ALWAYS_INLINE bool z_priq_simple_has_peer(sys_dlist_t *pq, struct k_thread *thread)
+{
+	sys_dnode_t *n = sys_dlist_peek_prev(pq, &thread->base.qnode_dlist);
+
+	if ((n != NULL) &&
+	    (CONTAINER_OF(n, struct k_thread, base.qnode_dlist)->base.prio == thread->base.prio)) {
+		return true;
+	}
+
+	n = sys_dlist_peek_next(pq, &thread->base.qnode_dlist);
+
+	return (n != NULL) &&
+	       (CONTAINER_OF(n, struct k_thread, base.qnode_dlist)->base.prio == thread->base.prio);
+}
+
 static ALWAYS_INLINE struct k_thread *z_priq_simple_best(sys_dlist_t *pq)
 {
 	struct k_thread *thread = NULL;
@@ -235,6 +259,15 @@ static ALWAYS_INLINE void z_priq_rb_yield(struct _priq_rb *pq)
 #endif
 }
 
+static ALWAYS_INLINE bool z_priq_rb_has_peer(struct _priq_rb *pq, struct k_thread *thread)
+{
+	ARG_UNUSED(pq);
+	ARG_UNUSED(thread);
+
+	/* The tree has no cheap neighbour lookup, assume there is one */
+	return true;
+}
+
 static ALWAYS_INLINE struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 {
 	struct k_thread *thread = NULL;
@@ -329,6 +362,14 @@ static ALWAYS_INLINE void z_priq_mq_yield(struct _priq_mq *pq)
 #endif
 }
 
+static ALWAYS_INLINE bool z_priq_mq_has_peer(struct _priq_mq *pq, struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	return sys_dlist_peek_head(&pq->queues[pos.offset_prio]) !=
+	       sys_dlist_peek_tail(&pq->queues[pos.offset_prio]);
+}
+
 static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
 #ifdef CONFIG_SMP
@@ -346,4 +387,90 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return NULL;
 }
 
+#ifdef CONFIG_WAITQ_MULTIQ
+/*
+ * Wait queues are embedded in every kernel object that threads can pend
+ * on, and many are statically defined, so unlike the ready queue they are
+ * not initialized list by list: the list of a priority is only valid while
+ * its bit is set in the bitmask, and is initialized when its first thread
+ * is added.  This lets a zeroed bitmask stand for an empty wait queue.
+ */
+
+/* Index of the highest priority non-empty list at or after @a from, or -1 */
+static ALWAYS_INLINE int z_priq_mq_wait_index(struct _priq_mq *pq, unsigned int from)
+{
+	for (unsigned int i = from / NBITS; i < PRIQ_BITMAP_SIZE; i++) {
+		unsigned long bits = pq->bitmask[i];
+
+		if (i == (from / NBITS)) {
+			bits &= ~0UL << (from % NBITS);
+		}
+
+		if (bits != 0UL) {
+			return (int)(i * NBITS + TRAILING_ZEROS(bits));
+		}
+	}
+
+	return -1;
+}
+
+static ALWAYS_INLINE void z_priq_mq_wait_add(struct _priq_mq *pq,
+					     struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	if ((pq->bitmask[pos.idx] & BIT(pos.bit)) == 0UL) {
+		sys_dlist_init(&pq->queues[pos.offset_prio]);
+		pq->bitmask[pos.idx] |= BIT(pos.bit);
+	}
+
+	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE void z_priq_mq_wait_remove(struct _priq_mq *pq,
+						struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	sys_dlist_dequeue(&thread->base.qnode_dlist);
+	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio])) {
+		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+	}
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_mq_wait_best(struct _priq_mq *pq)
+{
+	int index = z_priq_mq_wait_index(pq, 0);
+
+	if (index < 0) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(sys_dlist_peek_head_not_empty(&pq->queues[index]),
+			    struct k_thread, base.qnode_dlist);
+}
+
+/* Next thread after @a thread in wait order, for _WAIT_Q_FOR_EACH() */
+static ALWAYS_INLINE struct k_thread *z_priq_mq_wait_next(struct _priq_mq *pq,
+							  struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+	sys_dnode_t *n = sys_dlist_peek_next_no_check(&pq->queues[pos.offset_prio],
+						      &thread->base.qnode_dlist);
+	int index;
+
+	if (n != NULL) {
+		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	}
+
+	index = z_priq_mq_wait_index(pq, pos.offset_prio + 1U);
+	if (index < 0) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(sys_dlist_peek_head_not_empty(&pq->queues[index]),
+			    struct k_thread, base.qnode_dlist);
+}
+#endif /* CONFIG_WAITQ_MULTIQ */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_PRIORITY_Q_H_ */
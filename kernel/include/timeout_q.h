@@ -74,6 +74,16 @@ static inline bool z_is_aborted_thread_timeout(struct k_thread *thread)
 
 int32_t z_get_next_timeout_expiry(void);
 
+#ifdef CONFIG_TIMESLICING
+/* Arms the time slice of the current CPU to end in the given number of
+ * ticks, replacing any slice armed before.
+ */
+void z_set_slice_timeout(int32_t ticks);
+
+/* Disarms the time slice of the current CPU */
+void z_clear_slice_timeout(void);
+#endif /* CONFIG_TIMESLICING */
+
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
 
 #else
@@ -38,7 +38,27 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 	return (struct k_thread *)rb_get_min(&w->waitq.tree);
 }
 
-#else /* !CONFIG_WAITQ_SCALABLE: */
+#elif defined(CONFIG_WAITQ_MULTIQ)
+
+#define _WAIT_Q_FOR_EACH(wq, thread_ptr)					\
+	for ((thread_ptr) = z_priq_mq_wait_best(&(wq)->waitq);			\
+	     (thread_ptr) != NULL;						\
+	     (thread_ptr) = z_priq_mq_wait_next(&(wq)->waitq, (thread_ptr)))
+
+static inline void z_waitq_init(_wait_q_t *w)
+{
+	/* The per-priority lists are initialized on first use */
+	for (size_t i = 0; i < ARRAY_SIZE(w->waitq.bitmask); i++) {
+		w->waitq.bitmask[i] = 0UL;
+	}
+}
+
+static inline struct k_thread *z_waitq_head(_wait_q_t *w)
+{
+	return z_priq_mq_wait_best(&w->waitq);
+}
+
+#else /* !CONFIG_WAITQ_SCALABLE && !CONFIG_WAITQ_MULTIQ: */
 
 #define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
 	SYS_DLIST_FOR_EACH_CONTAINER(&((wq)->waitq), thread_ptr, \
@@ -54,7 +74,7 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 	return (struct k_thread *)sys_dlist_peek_head(&w->waitq);
 }
 
-#endif /* !CONFIG_WAITQ_SCALABLE */
+#endif /* !CONFIG_WAITQ_SCALABLE && !CONFIG_WAITQ_MULTIQ */
 
 #ifdef __cplusplus
 }
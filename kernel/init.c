@@ -206,6 +206,147 @@ static void z_device_state_init(void)
 	}
 }
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define INIT_WORKERS CONFIG_DEVICE_INIT_PARALLEL_THREADS
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_worker_stacks, INIT_WORKERS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+
+static struct init_worker {
+	struct k_thread thread;
+	/* Entry being initialized, NULL when the worker is idle */
+	const struct init_entry *entry;
+	enum init_level level;
+	/* The thread has been created and must be joined before reuse */
+	bool created;
+} init_workers[INIT_WORKERS];
+
+static K_MUTEX_DEFINE(init_lock);
+static K_CONDVAR_DEFINE(init_cond);
+
+static void init_worker_entry(void *p1, void *p2, void *p3)
+{
+	struct init_worker *worker = p1;
+	const struct init_entry *entry = worker->entry;
+	uint32_t start = k_cycle_get_32();
+	int result;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	sys_trace_sys_init_enter(entry, worker->level);
+	result = do_device_init(entry->dev);
+	sys_trace_sys_init_exit(entry, worker->level, result);
+
+	if (IS_ENABLED(CONFIG_DEVICE_INIT_PARALLEL_REPORT)) {
+		LOG_INF("%s: init %s in %u us", entry->dev->name,
+			(result == 0) ? "done" : "failed",
+			k_cyc_to_us_floor32(k_cycle_get_32() - start));
+	}
+
+	k_mutex_lock(&init_lock, K_FOREVER);
+	worker->entry = NULL;
+	k_condvar_broadcast(&init_cond);
+	k_mutex_unlock(&init_lock);
+}
+
+static int init_busy_visitor(const struct device *dev, void *context)
+{
+	ARG_UNUSED(context);
+
+	for (size_t i = 0; i < INIT_WORKERS; i++) {
+		if ((init_workers[i].entry != NULL) && (init_workers[i].entry->dev == dev)) {
+			return -EBUSY;
+		}
+	}
+
+	return 0;
+}
+
+/* Idle worker that can initialize dev, or NULL if one of the devices dev
+ * requires is still being initialized or all workers are busy. Devices
+ * earlier in the run that are not busy anymore are done. Must be called
+ * with init_lock held.
+ */
+static struct init_worker *init_worker_get(const struct device *dev)
+{
+	if (device_required_foreach(dev, init_busy_visitor, NULL) < 0) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < INIT_WORKERS; i++) {
+		if (init_workers[i].entry == NULL) {
+			return &init_workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool init_workers_busy(void)
+{
+	for (size_t i = 0; i < INIT_WORKERS; i++) {
+		if (init_workers[i].entry != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Initialize the run of device entries starting at entry, and return the
+ * first entry after it. All of them are initialized when this returns.
+ */
+static const struct init_entry *init_devices_parallel(const struct init_entry *entry,
+						      const struct init_entry *end,
+						      enum init_level level)
+{
+	/* Workers run at the priority of the init thread, so they get
+	 * to run whenever it waits and take turns when one of them sleeps.
+	 */
+	int prio = k_thread_priority_get(k_current_get());
+
+	k_mutex_lock(&init_lock, K_FOREVER);
+
+	for (; (entry < end) && (entry->dev != NULL); entry++) {
+		const struct device *dev = entry->dev;
+		struct init_worker *worker;
+
+		if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) != 0U) {
+			sys_trace_sys_init_enter(entry, level);
+			sys_trace_sys_init_exit(entry, level, 0);
+			continue;
+		}
+
+		while ((worker = init_worker_get(dev)) == NULL) {
+			k_condvar_wait(&init_cond, &init_lock, K_FOREVER);
+		}
+
+		if (worker->created) {
+			/* Done with its entry, only left to exit */
+			k_thread_join(&worker->thread, K_FOREVER);
+		}
+
+		worker->entry = entry;
+		worker->level = level;
+		worker->created = true;
+
+		k_thread_create(&worker->thread, init_worker_stacks[worker - init_workers],
+				K_THREAD_STACK_SIZEOF(init_worker_stacks[0]), init_worker_entry,
+				worker, NULL, NULL, prio, 0, K_NO_WAIT);
+		k_thread_name_set(&worker->thread, dev->name);
+	}
+
+	while (init_workers_busy()) {
+		k_condvar_wait(&init_cond, &init_lock, K_FOREVER);
+	}
+
+	k_mutex_unlock(&init_lock);
+
+	return entry;
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -233,17 +374,37 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_BOOT_TIMELINE
+	z_boot_timeline_level_set(level);
+#endif /* CONFIG_BOOT_TIMELINE */
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
 		int result = 0;
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		if ((level >= INIT_LEVEL_POST_KERNEL) && (dev != NULL)) {
+			/* Resume the loop on the entry following the run */
+			entry = init_devices_parallel(entry, levels[level + 1], level) - 1;
+			continue;
+		}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 		sys_trace_sys_init_enter(entry, level);
 		if (dev != NULL) {
 			if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
 				result = do_device_init(dev);
 			}
 		} else {
+#ifdef CONFIG_BOOT_TIMELINE
+			uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_BOOT_TIMELINE */
+
 			result = entry->init_fn();
+
+#ifdef CONFIG_BOOT_TIMELINE
+			z_boot_timeline_record(NULL, entry->init_fn, start, result);
+#endif /* CONFIG_BOOT_TIMELINE */
 		}
 		sys_trace_sys_init_exit(entry, level, result);
 	}
@@ -334,6 +495,10 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_BOOT_TIMELINE
+	z_boot_timeline_main();
+#endif /* CONFIG_BOOT_TIMELINE */
+
 #ifdef CONFIG_BOOTARGS
 	extern int main(int, char **);
 	extern char **prepare_main_args(int *argc);
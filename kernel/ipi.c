@@ -82,6 +82,13 @@ void signal_pending_ipi(void)
 		uint32_t  cpu_bitmap;
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+#ifdef CONFIG_IPI_COALESCE
+		/* CPUs with an IPI in flight will reschedule anyway */
+		if (cpu_bitmap != 0) {
+			cpu_bitmap &= ~(uint32_t)atomic_or(&_kernel.inflight_ipi,
+							   (atomic_val_t)cpu_bitmap);
+		}
+#endif /* CONFIG_IPI_COALESCE */
 		if (cpu_bitmap != 0) {
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
 			arch_sched_directed_ipi(cpu_bitmap);
@@ -184,6 +191,9 @@ void z_sched_ipi(void)
 	/* NOTE: When adding code to this, make sure this is called
 	 * at appropriate location when !CONFIG_SCHED_IPI_SUPPORTED.
 	 */
+	/* Must come first, so anything flagged after this gets a new IPI */
+	ipi_inflight_clear();
+
 #ifdef CONFIG_TRACE_SCHED_IPI
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
@@ -194,6 +204,10 @@ void z_sched_ipi(void)
 	}
 #endif /* CONFIG_TIMESLICING */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_check();
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #ifdef CONFIG_ARCH_IPI_LAZY_COPROCESSORS_SAVE
 	arch_ipi_lazy_coprocessors_save();
 #endif
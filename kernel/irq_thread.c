@@ -0,0 +1,169 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Threaded interrupt handlers: one IRQ thread per CPU runs the bottom halves
+ * queued to it, each once however many times it was raised meanwhile.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/irq_thread.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/printk.h>
+
+struct irq_thread_cpu {
+	struct k_thread thread;
+	struct k_sem sem;
+	/* handlers raised and waiting for their bottom half */
+	sys_slist_t pending;
+};
+
+static K_KERNEL_STACK_ARRAY_DEFINE(irq_thread_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   CONFIG_IRQ_THREAD_STACK_SIZE);
+
+static struct irq_thread_cpu irq_thread_cpus[CONFIG_MP_MAX_NUM_CPUS];
+
+/* protects the pending lists and started */
+static struct k_spinlock lock;
+
+/* handlers may be raised before the IRQ threads exist */
+static bool started;
+
+void k_irq_thread_init(struct k_irq_thread *irq_thread, k_irq_thread_top_t top,
+		       k_irq_thread_bottom_t bottom)
+{
+	*irq_thread = (struct k_irq_thread)K_IRQ_THREAD_INITIALIZER(top, bottom);
+}
+
+int k_irq_thread_set_cpu(struct k_irq_thread *irq_thread, int cpu)
+{
+	if (cpu != K_IRQ_THREAD_CPU_ANY && (cpu < 0 || cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	irq_thread->cpu = cpu;
+
+	return 0;
+}
+
+void k_irq_thread_raise(struct k_irq_thread *irq_thread)
+{
+	struct irq_thread_cpu *itc;
+	k_spinlock_key_t key;
+	bool was_empty;
+
+	if (atomic_inc(&irq_thread->count) != 0) {
+		/* still pending, its bottom half will get the new count */
+		return;
+	}
+
+	key = k_spin_lock(&lock);
+
+#ifdef CONFIG_IRQ_THREAD_STATS
+	irq_thread->raised_at = k_cycle_get_32();
+#endif
+
+	itc = &irq_thread_cpus[irq_thread->cpu == K_IRQ_THREAD_CPU_ANY ? _current_cpu->id
+								       : irq_thread->cpu];
+	was_empty = sys_slist_is_empty(&itc->pending);
+	sys_slist_append(&itc->pending, &irq_thread->node);
+
+	if (was_empty && started) {
+		k_sem_give(&itc->sem);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void k_irq_thread_isr(const void *arg)
+{
+	struct k_irq_thread *irq_thread = (struct k_irq_thread *)arg;
+
+	if (irq_thread->top == NULL || irq_thread->top(irq_thread)) {
+		k_irq_thread_raise(irq_thread);
+	}
+}
+
+static void irq_thread_main(void *p1, void *p2, void *p3)
+{
+	struct irq_thread_cpu *itc = p1;
+	struct k_irq_thread *irq_thread;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	uint32_t count;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&itc->sem, K_FOREVER);
+
+		/* handlers raised from now on give the semaphore again */
+		while (true) {
+			key = k_spin_lock(&lock);
+			node = sys_slist_get(&itc->pending);
+			k_spin_unlock(&lock, key);
+
+			if (node == NULL) {
+				break;
+			}
+
+			irq_thread = CONTAINER_OF(node, struct k_irq_thread, node);
+
+#ifdef CONFIG_IRQ_THREAD_STATS
+			irq_thread->max_latency = MAX(irq_thread->max_latency,
+						      k_cycle_get_32() - irq_thread->raised_at);
+#endif
+
+			/* raising it again from now on queues it again */
+			count = atomic_set(&irq_thread->count, 0);
+			irq_thread->bottom(irq_thread, count);
+		}
+	}
+}
+
+static int irq_thread_init(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct irq_thread_cpu *itc;
+	k_spinlock_key_t key;
+	char name[16];
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		itc = &irq_thread_cpus[i];
+
+		k_sem_init(&itc->sem, 0, 1);
+		k_thread_create(&itc->thread, irq_thread_stacks[i],
+				K_KERNEL_STACK_SIZEOF(irq_thread_stacks[i]), irq_thread_main, itc,
+				NULL, NULL, CONFIG_IRQ_THREAD_PRIORITY, 0, K_FOREVER);
+
+		snprintk(name, sizeof(name), "irq_thread%u", i);
+		(void)k_thread_name_set(&itc->thread, name);
+
+#if defined(CONFIG_SCHED_CPU_MASK) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+		(void)k_thread_cpu_pin(&itc->thread, i);
+#endif
+
+		k_thread_start(&itc->thread);
+	}
+
+	key = k_spin_lock(&lock);
+
+	started = true;
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (!sys_slist_is_empty(&irq_thread_cpus[i].pending)) {
+			k_sem_give(&irq_thread_cpus[i].sem);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+SYS_INIT(irq_thread_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
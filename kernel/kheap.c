@@ -11,6 +11,7 @@
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
 
 int k_heap_array_get(struct k_heap **heap)
 {
@@ -29,9 +30,126 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 	heap->lock = (struct k_spinlock) {};
 	sys_heap_init(&heap->heap, mem, bytes);
 
+#ifdef CONFIG_HEAP_CACHE
+	atomic_set(&heap->waiters, 0);
+	(void)memset(heap->cache, 0, sizeof(heap->cache));
+#endif /* CONFIG_HEAP_CACHE */
+
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
 
+#ifdef CONFIG_HEAP_CACHE
+/*
+ * Per-CPU caches of small blocks in front of the sys_heap: freed blocks
+ * of up to 2 * 128 bytes are kept, still allocated as far as the sys_heap
+ * is concerned, in the current CPU's cache according to their usable
+ * size, and handed out again to allocations fitting in their size class
+ * without taking the heap lock nor searching, splitting and merging
+ * chunks.  Coalescing is thus deferred until an allocation fails, which
+ * gives all cached blocks back to the heap.
+ *
+ * As with memory slabs, a thread about to wait for memory raises
+ * heap->waiters before reclaiming the caches, after which frees bypass
+ * them.  Cache locks are taken inside the heap lock, never the other way
+ * around.
+ */
+static int alloc_class(size_t bytes)
+{
+	for (int i = 0; i < Z_HEAP_CACHE_CLASSES; i++) {
+		if (bytes <= (Z_HEAP_CACHE_MIN_BYTES << i)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int free_class(size_t usable)
+{
+	for (int i = Z_HEAP_CACHE_CLASSES - 1; i >= 0; i--) {
+		if (usable >= (Z_HEAP_CACHE_MIN_BYTES << i)) {
+			return (usable < (Z_HEAP_CACHE_MIN_BYTES << (i + 1))) ? i : -1;
+		}
+	}
+
+	return -1;
+}
+
+void *z_heap_cache_alloc(struct k_heap *heap, size_t align, size_t bytes)
+{
+	int cls = alloc_class(bytes);
+	void *mem = NULL;
+
+	if (cls < 0) {
+		return NULL;
+	}
+
+	unsigned int irq_key = arch_irq_lock();
+	struct z_heap_cache *cache = &heap->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	uint8_t count = cache->count[cls];
+
+	if ((count > 0U) &&
+	    ((align == 0U) ||
+	     (((uintptr_t)cache->blocks[cls][count - 1U] & (align - 1U)) == 0U))) {
+		mem = cache->blocks[cls][count - 1U];
+		cache->count[cls] = count - 1U;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return mem;
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	int cls = free_class(sys_heap_usable_size(&heap->heap, mem));
+	bool cached = false;
+
+	if (cls < 0) {
+		return false;
+	}
+
+	unsigned int irq_key = arch_irq_lock();
+	struct z_heap_cache *cache = &heap->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+	if ((atomic_get(&heap->waiters) == 0) &&
+	    (cache->count[cls] < CONFIG_HEAP_CACHE_DEPTH)) {
+		cache->blocks[cls][cache->count[cls]++] = mem;
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return cached;
+}
+
+bool z_heap_cache_reclaim(struct k_heap *heap)
+{
+	bool reclaimed = false;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_heap_cache *cache = &heap->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		for (int cls = 0; cls < Z_HEAP_CACHE_CLASSES; cls++) {
+			while (cache->count[cls] > 0U) {
+				sys_heap_free(&heap->heap,
+					      cache->blocks[cls][--cache->count[cls]]);
+				reclaimed = true;
+			}
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return reclaimed;
+}
+#endif /* CONFIG_HEAP_CACHE */
+
 static int statics_init(void)
 {
 	STRUCT_SECTION_FOREACH(k_heap, heap) {
@@ -83,6 +201,15 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_HEAP_CACHE
+	ret = z_heap_cache_alloc(heap, align, bytes);
+	if (ret != NULL) {
+		return ret;
+	}
+
+	bool waiting = false;
+#endif /* CONFIG_HEAP_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
@@ -92,6 +219,18 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+#ifdef CONFIG_HEAP_CACHE
+		if (ret == NULL) {
+			if (!waiting && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				atomic_inc(&heap->waiters);
+				waiting = true;
+			}
+			if (z_heap_cache_reclaim(heap)) {
+				continue;
+			}
+		}
+#endif /* CONFIG_HEAP_CACHE */
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -112,6 +251,12 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_HEAP_CACHE
+	if (waiting) {
+		atomic_dec(&heap->waiters);
+	}
+#endif /* CONFIG_HEAP_CACHE */
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -184,9 +329,25 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_HEAP_CACHE
+	bool waiting = false;
+#endif /* CONFIG_HEAP_CACHE */
+
 	while (ret == NULL) {
 		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
 
+#ifdef CONFIG_HEAP_CACHE
+		if (ret == NULL) {
+			if (!waiting && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				atomic_inc(&heap->waiters);
+				waiting = true;
+			}
+			if (z_heap_cache_reclaim(heap)) {
+				continue;
+			}
+		}
+#endif /* CONFIG_HEAP_CACHE */
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -197,6 +358,12 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_HEAP_CACHE
+	if (waiting) {
+		atomic_dec(&heap->waiters);
+	}
+#endif /* CONFIG_HEAP_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -205,6 +372,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_HEAP_CACHE
+	if ((mem != NULL) && cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif /* CONFIG_HEAP_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
@@ -21,6 +21,21 @@ static uint8_t max_partitions;
 
 struct k_mem_domain k_mem_domain_default;
 
+/* Let the arch coalesce the TLB maintenance of several updates */
+static inline void batch_begin(void)
+{
+#ifdef CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC
+	arch_mem_domain_batch_begin();
+#endif /* CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC */
+}
+
+static inline void batch_end(void)
+{
+#ifdef CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC
+	arch_mem_domain_batch_end();
+#endif /* CONFIG_ARCH_MEM_DOMAIN_BATCHED_SYNC */
+}
+
 static bool check_add_partition(struct k_mem_domain *domain,
 				struct k_mem_partition *part)
 {
@@ -131,11 +146,13 @@ int k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 	if (num_parts != 0U) {
 		uint32_t i;
 
+		batch_begin();
 		for (i = 0U; i < num_parts; i++) {
 			CHECKIF(!check_add_partition(domain, parts[i])) {
 				LOG_ERR("invalid partition index %d (%p)",
 					i, parts[i]);
 				ret = -EINVAL;
+				batch_end();
 				goto unlock_out;
 			}
 
@@ -150,6 +167,7 @@ int k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 			}
 #endif /* CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API */
 		}
+		batch_end();
 	}
 
 unlock_out:
@@ -337,11 +355,13 @@ int k_mem_domain_add_thread(struct k_mem_domain *domain, k_tid_t thread)
 
 	key = k_spin_lock(&z_mem_domain_lock);
 	if (thread->mem_domain_info.mem_domain != domain) {
+		batch_begin();
 		ret = remove_thread_locked(thread);
 
 		if (ret == 0) {
 			ret = add_thread_locked(domain, thread);
 		}
+		batch_end();
 	}
 	k_spin_unlock(&z_mem_domain_lock, key);
 
@@ -48,9 +48,8 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -184,6 +183,14 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	atomic_set(&slab->waiters, 0);
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		slab->cache[i].lock = (struct k_spinlock) {};
+		slab->cache[i].count = 0U;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -219,13 +226,186 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+/* Give blocks back to the shared free list, or to threads waiting for one */
+static void free_blocks(struct k_mem_slab *slab, char **blocks, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	for (uint32_t i = 0; i < count; i++) {
+		char *mem = blocks[i];
+
+		if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+			if (unlikely(pending_thread != NULL)) {
+				z_thread_return_value_set_with_data(pending_thread, 0, mem);
+				z_ready_thread(pending_thread);
+				resched = true;
+				continue;
+			}
+		}
+		*(char **) mem = slab->free_list;
+		slab->free_list = mem;
+		slab->info.num_used--;
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+/* Number of blocks moved at once between a CPU cache and the free list */
+#define CACHE_BATCH MAX(CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE / 2, 1)
+
+/*
+ * Per-CPU caches (magazines) of free blocks: each CPU allocates from and
+ * frees to its own cache under its own, uncontended, lock, and only takes
+ * the slab lock to refill or flush the cache CACHE_BATCH blocks at a time.
+ * Interrupts are kept locked so that the current CPU doesn't change, and a
+ * cache lock is never taken while holding the slab lock except from
+ * cache_reclaim().
+ *
+ * Cached blocks still count in info.num_used.  A thread about to wait for a
+ * block first raises slab->waiters and then reclaims all caches, after
+ * which frees bypass the caches so that the block reaches the waiter.
+ */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct z_mem_slab_cache *cache = &slab->cache[_current_cpu->id];
+	char *batch[CACHE_BATCH];
+	uint32_t count = 0U;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+	if (cache->count > 0U) {
+		*mem = cache->blocks[--cache->count];
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq_key);
+		return true;
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	key = k_spin_lock(&slab->lock);
+	while ((count < CACHE_BATCH) && (slab->free_list != NULL)) {
+		batch[count++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+	}
+	slab->info.num_used += count;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = max(slab->info.num_used, slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+	k_spin_unlock(&slab->lock, key);
+
+	if (count == 0U) {
+		arch_irq_unlock(irq_key);
+		return false;
+	}
+
+	*mem = batch[--count];
+
+	/* other CPUs may only have emptied the cache meanwhile */
+	key = k_spin_lock(&cache->lock);
+	if (atomic_get(&slab->waiters) == 0) {
+		for (uint32_t i = 0; i < count; i++) {
+			cache->blocks[cache->count++] = batch[i];
+		}
+		count = 0U;
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	arch_irq_unlock(irq_key);
+
+	/* don't hoard blocks some thread is waiting for */
+	if (count > 0U) {
+		free_blocks(slab, batch, count);
+	}
+
+	return true;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct z_mem_slab_cache *cache = &slab->cache[_current_cpu->id];
+	char *batch[CACHE_BATCH];
+	uint32_t count = 0U;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+	if (atomic_get(&slab->waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq_key);
+		return false;
+	}
+
+	if (cache->count == CONFIG_MEM_SLAB_PER_CPU_CACHE_SIZE) {
+		while (count < CACHE_BATCH) {
+			batch[count++] = cache->blocks[--cache->count];
+		}
+	}
+	cache->blocks[cache->count++] = mem;
+	k_spin_unlock(&cache->lock, key);
+
+	arch_irq_unlock(irq_key);
+
+	if (count > 0U) {
+		free_blocks(slab, batch, count);
+	}
+
+	return true;
+}
+
+/* Move all cached blocks back to the free list, with the slab lock held */
+static void cache_reclaim(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_cache *cache = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		while (cache->count > 0U) {
+			char *mem = cache->blocks[--cache->count];
+
+			*(char **) mem = slab->free_list;
+			slab->free_list = mem;
+			slab->info.num_used--;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	bool waiting = false;
+
+	if (slab->free_list == NULL) {
+		/* blocks may still sit in other CPUs' caches */
+		atomic_inc(&slab->waiters);
+		waiting = true;
+		cache_reclaim(slab);
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
@@ -256,11 +436,21 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+		atomic_dec(&slab->waiters);
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (waiting) {
+		atomic_dec(&slab->waiters);
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -276,28 +466,20 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
-
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (unlikely(slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
-
-		if (unlikely(pending_thread != NULL)) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
-		}
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
 
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	char *block = mem;
 
-	k_spin_unlock(&slab->lock, key);
+	free_blocks(slab, &block, 1);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 }
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
@@ -308,9 +490,8 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
 				     slab->info.block_size;
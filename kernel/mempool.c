@@ -8,6 +8,7 @@
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
 
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
@@ -38,9 +39,24 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+	mem = NULL;
+#ifdef CONFIG_HEAP_CACHE
+	/* cached blocks are only handed out again without alignment needs */
+	if (align == 0U) {
+		mem = z_heap_cache_alloc(heap, 0, size);
+	}
+#endif /* CONFIG_HEAP_CACHE */
+
+	if (mem == NULL) {
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+#ifdef CONFIG_HEAP_CACHE
+		if ((mem == NULL) && z_heap_cache_reclaim(heap)) {
+			mem = sys_heap_allocator(&heap->heap, __align, size);
+		}
+#endif /* CONFIG_HEAP_CACHE */
+		k_spin_unlock(&heap->lock, key);
+	}
 
 	if (mem == NULL) {
 		return NULL;
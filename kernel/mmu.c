@@ -436,6 +436,67 @@ static void page_frame_free_locked(struct k_mem_page_frame *pf)
 	free_page_frame_list_put(pf);
 }
 
+/* Find a run of count free page frames. All candidate runs are looked at
+ * and the first one allowing the largest virtual region alignment is
+ * returned, so the arch layer can map it with the biggest granule.
+ */
+static struct k_mem_page_frame *free_page_frame_run_find(size_t count)
+{
+	struct k_mem_page_frame *pf, *run = NULL, *best = NULL;
+	size_t len = 0, align, best_align = 0;
+	uintptr_t phys;
+
+	K_MEM_PAGE_FRAME_FOREACH(phys, pf) {
+		if (!k_mem_page_frame_is_free(pf)) {
+			len = 0;
+			continue;
+		}
+
+		if (len == 0) {
+			run = pf;
+		}
+
+		len++;
+		if (len < count) {
+			continue;
+		}
+
+		align = arch_virt_region_align(k_mem_page_frame_to_phys(run),
+					       count * CONFIG_MMU_PAGE_SIZE);
+		if (align > best_align) {
+			best = run;
+			best_align = align;
+		}
+
+		/* Slide the window to the next candidate run */
+		run++;
+		len--;
+	}
+
+	return best;
+}
+
+/* Take a run of count page frames found by free_page_frame_run_find() off
+ * the free list, in a single pass over it.
+ */
+static void free_page_frame_run_get(struct k_mem_page_frame *run, size_t count)
+{
+	struct k_mem_page_frame *pf;
+	sys_sfnode_t *node, *next, *prev = NULL;
+
+	SYS_SFLIST_FOR_EACH_NODE_SAFE(&free_page_frame_list, node, next) {
+		pf = CONTAINER_OF(node, struct k_mem_page_frame, node);
+		if ((pf < run) || (pf >= (run + count))) {
+			prev = node;
+			continue;
+		}
+
+		sys_sflist_remove(&free_page_frame_list, prev, node);
+		z_free_page_count--;
+		pf->va_and_flags = 0;
+	}
+}
+
 /*
  * Memory Mapping
  */
@@ -567,14 +628,42 @@ static int map_anon_page(void *addr, uint32_t flags)
 	return 0;
 }
 
+/* Allocate a virtual region of size bytes plus a guard page on each side,
+ * returning the address of the "before" guard page. If align is larger than
+ * a page, the region in between the guard pages starts at a multiple of it
+ * so it can be mapped with larger granules. This falls back to page alignment
+ * if the virtual address space is too fragmented.
+ */
+static uint8_t *virt_region_alloc_guarded(size_t size, size_t align)
+{
+	uint8_t *dst;
+	size_t total_size;
+
+	if (align > CONFIG_MMU_PAGE_SIZE &&
+	    !size_add_overflow(size, align + CONFIG_MMU_PAGE_SIZE, &total_size)) {
+		dst = virt_region_alloc(total_size, align);
+		if (dst != NULL) {
+			/* Give back what is below the "before" guard page */
+			virt_region_free(dst, align - CONFIG_MMU_PAGE_SIZE);
+
+			return dst + align - CONFIG_MMU_PAGE_SIZE;
+		}
+	}
+
+	return virt_region_alloc(size + (CONFIG_MMU_PAGE_SIZE * 2), CONFIG_MMU_PAGE_SIZE);
+}
+
 void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_anon)
 {
 	uint8_t *dst;
 	size_t total_size;
+	size_t align = CONFIG_MMU_PAGE_SIZE;
 	int ret;
 	k_spinlock_key_t key;
 	uint8_t *pos;
+	struct k_mem_page_frame *run = NULL;
 	bool uninit = (flags & K_MEM_MAP_UNINIT) != 0U;
+	bool contig = is_anon && ((flags & K_MEM_MAP_CONTIG) != 0U);
 
 	__ASSERT(!is_anon || (is_anon && page_frames_initialized),
 		 "%s called too early", __func__);
@@ -605,7 +694,28 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 
 	key = k_spin_lock(&z_mm_lock);
 
-	dst = virt_region_alloc(total_size, CONFIG_MMU_PAGE_SIZE);
+	if (contig) {
+		/* Contiguous page frames are never paged out */
+		flags |= K_MEM_MAP_LOCK;
+
+		run = free_page_frame_run_find(size / CONFIG_MMU_PAGE_SIZE);
+		if (run == NULL) {
+			LOG_ERR("no contiguous free page frames for %zu bytes", size);
+			dst = NULL;
+			goto out;
+		}
+
+		phys = k_mem_page_frame_to_phys(run);
+	}
+
+	/* Physical memory, anonymous or not, which is known at this point
+	 * may be mapped with larger granules if the arch supports them.
+	 */
+	if ((!is_anon || contig) && ((flags & K_MEM_MAP_UNPAGED) == 0U)) {
+		align = arch_virt_region_align(phys, size);
+	}
+
+	dst = virt_region_alloc_guarded(size, align);
 	if (dst == NULL) {
 		/* Address space has no free region */
 		goto out;
@@ -621,7 +731,20 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 	/* Skip over the "before" guard page in returned address. */
 	dst += CONFIG_MMU_PAGE_SIZE;
 
-	if (is_anon) {
+	if (contig) {
+		/* Mapping contiguous anonymous memory in one go */
+		flags |= K_MEM_CACHE_WB;
+		free_page_frame_run_get(run, size / CONFIG_MMU_PAGE_SIZE);
+		arch_mem_map(dst, phys, size, flags);
+
+		for (size_t i = 0; i < (size / CONFIG_MMU_PAGE_SIZE); i++) {
+			k_mem_page_frame_set(&run[i], K_MEM_PAGE_FRAME_PINNED);
+			frame_mapped_set(&run[i], dst + (i * CONFIG_MMU_PAGE_SIZE));
+		}
+
+		LOG_DBG("memory mapping contiguous anon pages %p -> 0x%lx (align %zu)",
+			dst, phys, align);
+	} else if (is_anon) {
 		/* Mapping from anonymous memory */
 		flags |= K_MEM_CACHE_WB;
 #ifdef CONFIG_DEMAND_MAPPING
@@ -1577,6 +1700,19 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_fault_around_inc(struct k_thread *faulting_thread)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.pagefaults.fault_around++;
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.pagefaults.fault_around++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
 static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 {
 	struct k_mem_page_frame *pf;
@@ -1611,6 +1747,90 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#if CONFIG_DEMAND_PAGING_FAULT_AROUND > 0
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* First page after the pages paged in by the last fault */
+static uint8_t *fault_around_next;
+static size_t fault_around_window = CONFIG_DEMAND_PAGING_FAULT_AROUND;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
+/*
+ * Page in the pages following a faulting page at addr, whose data was paged in
+ * from location, so that accessing them does not fault as well. Only free page
+ * frames are used, and only as long as the data of each page directly follows
+ * the one of the previous page in the backing store, so that this never causes
+ * evictions and the backing store can read the whole cluster sequentially.
+ */
+static void fault_around_locked(uint8_t *addr, uintptr_t location,
+				struct k_thread *faulting_thread,
+				k_spinlock_key_t *key)
+{
+	struct k_mem_page_frame *pf;
+	uintptr_t next_location, unused;
+	uint8_t *next = addr + CONFIG_MMU_PAGE_SIZE;
+	size_t window = CONFIG_DEMAND_PAGING_FAULT_AROUND;
+	bool dirty = false;
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	/* A fault right after the previous window is a sequential access */
+	if (addr == fault_around_next) {
+		fault_around_window = MIN(fault_around_window * 2,
+					  CONFIG_DEMAND_PAGING_READ_AHEAD_MAX);
+	} else {
+		fault_around_window = CONFIG_DEMAND_PAGING_FAULT_AROUND;
+	}
+	window = fault_around_window;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
+#ifdef CONFIG_DEMAND_MAPPING
+	/* Anonymous pages have no backing store data to cluster */
+	if (location == ARCH_UNPAGED_ANON_ZERO || location == ARCH_UNPAGED_ANON_UNINIT) {
+		window = 0;
+	}
+#endif /* CONFIG_DEMAND_MAPPING */
+
+	for (size_t i = 0; i < window; i++, next += CONFIG_MMU_PAGE_SIZE) {
+		if (next >= K_MEM_VIRT_RAM_END ||
+		    arch_page_location_get(next, &next_location) !=
+			    ARCH_PAGE_LOCATION_PAGED_OUT ||
+		    next_location != location + (i + 1) * CONFIG_MMU_PAGE_SIZE) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+
+		/* A free page frame is never dirty nor out of backing store space */
+		(void)page_frame_prepare_locked(pf, &dirty, true, &unused);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(next_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+		frame_mapped_set(pf, next);
+
+		arch_mem_page_in(next, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, next_location);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+
+		paging_stats_fault_around_inc(faulting_thread);
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	fault_around_next = next;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+}
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND > 0 */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1752,6 +1972,9 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+#if CONFIG_DEMAND_PAGING_FAULT_AROUND > 0
+	fault_around_locked(addr, page_in_location, faulting_thread, &key);
+#endif /* CONFIG_DEMAND_PAGING_FAULT_AROUND > 0 */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -24,6 +24,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <kernel_internal.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/barrier.h>
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
 static struct k_obj_type obj_type_msgq;
@@ -66,6 +67,221 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	k_object_init(msgq);
 }
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+void k_msgq_lockfree_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
+			  uint32_t max_msgs)
+{
+	__ASSERT(max_msgs > 0U, "lock-free message queue needs a ring buffer");
+
+	z_waitq_init(&msgq->lf.put_wait_q);
+	atomic_set(&msgq->lf.prod_head, 0);
+	atomic_set(&msgq->lf.prod_tail, 0);
+	atomic_set(&msgq->lf.cons_head, 0);
+	atomic_set(&msgq->lf.cons_tail, 0);
+	atomic_set(&msgq->lf.put_waiters, 0);
+	atomic_set(&msgq->lf.get_waiters, 0);
+	msgq->lf.wrap = (UINT32_MAX / max_msgs) * max_msgs;
+
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+	msgq->flags = K_MSGQ_FLAG_LOCKFREE;
+}
+
+/*
+ * Lock-free ring, in the fashion of DPDK's rte_ring: producers reserve a
+ * slot by advancing prod_head with a CAS, fill it without holding any lock,
+ * then publish it by advancing prod_tail once every earlier reservation has
+ * been published.  Consumers do the same with cons_head and cons_tail.
+ * Ring positions run modulo the largest multiple of max_msgs fitting in 32
+ * bits, so that a position maps to the same slot across wrap-arounds.
+ *
+ * Interrupts are masked locally between reservation and release, so that a
+ * pending reservation can never be preempted by an ISR spinning on it.
+ */
+static inline uint32_t lf_pos(const atomic_t *pos)
+{
+	return (uint32_t)atomic_get(pos);
+}
+
+static inline uint32_t lf_add(const struct k_msgq *msgq, uint32_t pos, uint32_t n)
+{
+	return (pos < (msgq->lf.wrap - n)) ? (pos + n) : (pos - (msgq->lf.wrap - n));
+}
+
+static inline uint32_t lf_diff(const struct k_msgq *msgq, uint32_t a, uint32_t b)
+{
+	return (a >= b) ? (a - b) : ((msgq->lf.wrap - b) + a);
+}
+
+static inline char *lf_slot(const struct k_msgq *msgq, uint32_t pos)
+{
+	return msgq->buffer_start + (pos % msgq->max_msgs) * msgq->msg_size;
+}
+
+uint32_t z_msgq_lockfree_used_get(const struct k_msgq *msgq)
+{
+	return lf_diff(msgq, lf_pos(&msgq->lf.prod_tail), lf_pos(&msgq->lf.cons_head));
+}
+
+static bool lf_put(struct k_msgq *msgq, const void *data)
+{
+	unsigned int key = arch_irq_lock();
+	uint32_t head;
+
+	do {
+		head = lf_pos(&msgq->lf.prod_head);
+		if (lf_diff(msgq, head, lf_pos(&msgq->lf.cons_tail)) >=
+		    msgq->max_msgs) {
+			arch_irq_unlock(key);
+			return false;
+		}
+	} while (!atomic_cas(&msgq->lf.prod_head, head, lf_add(msgq, head, 1)));
+
+	(void)memcpy(lf_slot(msgq, head), data, msgq->msg_size);
+
+	/* publish in reservation order */
+	while (!atomic_cas(&msgq->lf.prod_tail, head, lf_add(msgq, head, 1))) {
+		arch_spin_relax();
+	}
+
+	arch_irq_unlock(key);
+	return true;
+}
+
+/* a NULL data pointer discards the message */
+static bool lf_get(struct k_msgq *msgq, void *data)
+{
+	unsigned int key = arch_irq_lock();
+	uint32_t head;
+
+	do {
+		head = lf_pos(&msgq->lf.cons_head);
+		if (head == lf_pos(&msgq->lf.prod_tail)) {
+			arch_irq_unlock(key);
+			return false;
+		}
+	} while (!atomic_cas(&msgq->lf.cons_head, head, lf_add(msgq, head, 1)));
+
+	if (data != NULL) {
+		(void)memcpy(data, lf_slot(msgq, head), msgq->msg_size);
+	}
+
+	/* release in reservation order */
+	while (!atomic_cas(&msgq->lf.cons_tail, head, lf_add(msgq, head, 1))) {
+		arch_spin_relax();
+	}
+
+	arch_irq_unlock(key);
+	return true;
+}
+
+static bool lf_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
+{
+	uint32_t head;
+
+	do {
+		head = lf_pos(&msgq->lf.cons_head);
+		if (lf_diff(msgq, lf_pos(&msgq->lf.prod_tail), head) <= idx) {
+			return false;
+		}
+		(void)memcpy(data, lf_slot(msgq, lf_add(msgq, head, idx)),
+			     msgq->msg_size);
+		/* the copy is only valid if no consumer got past it meanwhile */
+		barrier_dmem_fence_full();
+	} while (head != lf_pos(&msgq->lf.cons_head));
+
+	return true;
+}
+
+/*
+ * Wake up one thread blocked on the other side of the queue, if any.  The
+ * waiter count is raised under the lock before the blocking thread checks
+ * the ring a last time, so either that check sees our update or we see the
+ * waiter here.
+ */
+static bool lf_wake(struct k_msgq *msgq, _wait_q_t *wait_q, atomic_t *waiters)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	if (atomic_get(waiters) == 0) {
+		return false;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	pending_thread = z_unpend_first_thread(wait_q);
+	if (pending_thread != NULL) {
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+		return true;
+	}
+	k_spin_unlock(&msgq->lock, key);
+
+	return false;
+}
+
+static int lf_transfer(struct k_msgq *msgq, void *data, k_timeout_t timeout,
+		       bool is_put)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	_wait_q_t *wait_q = is_put ? &msgq->lf.put_wait_q : &msgq->wait_q;
+	atomic_t *waiters = is_put ? &msgq->lf.put_waiters : &msgq->lf.get_waiters;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool done;
+	int result;
+
+	while (true) {
+		done = is_put ? lf_put(msgq, data) : lf_get(msgq, data);
+		if (done) {
+			result = 0;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		atomic_inc(waiters);
+
+		done = is_put ? lf_put(msgq, data) : lf_get(msgq, data);
+		if (done || sys_timepoint_expired(end)) {
+			atomic_dec(waiters);
+			k_spin_unlock(&msgq->lock, key);
+			result = done ? 0 : -EAGAIN;
+			break;
+		}
+
+		if (is_put) {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+		}
+
+		result = z_pend_curr(&msgq->lock, key, wait_q,
+				     sys_timepoint_timeout(end));
+		atomic_dec(waiters);
+		if (result != 0) {
+			/* timed out, or purged while waiting for space */
+			return result;
+		}
+	}
+
+	if (is_put) {
+		if (!lf_wake(msgq, &msgq->wait_q, &msgq->lf.get_waiters) &&
+		    handle_poll_events(msgq)) {
+			z_reschedule_unlocked();
+		}
+	} else {
+		(void)lf_wake(msgq, &msgq->lf.put_wait_q, &msgq->lf.put_waiters);
+	}
+
+	return result;
+}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 int z_impl_k_msgq_alloc_init(struct k_msgq *msgq, size_t msg_size,
 			    uint32_t max_msgs)
 {
@@ -113,6 +329,14 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 		goto exit;
 	}
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	CHECKIF(((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) &&
+		(z_waitq_head(&msgq->lf.put_wait_q) != NULL)) {
+		ret = -EBUSY;
+		goto exit;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	if ((msgq->flags & K_MSGQ_FLAG_ALLOC) != 0U) {
 		k_free(msgq->buffer_start);
 		msgq->flags &= ~K_MSGQ_FLAG_ALLOC;
@@ -224,11 +448,29 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 
 int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		int result;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		result = lf_transfer(msgq, (void *)data, timeout, true);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	return put_msg_in_queue(msgq, data, timeout, true);
 }
 
 int z_impl_k_msgq_put_front(struct k_msgq *msgq, const void *data)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	return put_msg_in_queue(msgq, data, K_NO_WAIT, false);
 }
 
@@ -257,7 +499,7 @@ void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
-	attrs->used_msgs = msgq->used_msgs;
+	attrs->used_msgs = z_msgq_used_get(msgq);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -280,6 +522,16 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = lf_transfer(msgq, data, timeout, false);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
@@ -357,6 +609,15 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		result = lf_peek_at(msgq, data, 0) ? 0 : -ENOMSG;
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, peek, msgq, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > 0U) {
@@ -394,6 +655,15 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 	uint32_t byte_offset;
 	char *start_addr;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		result = lf_peek_at(msgq, data, idx) ? 0 : -ENOMSG;
+		SYS_PORT_TRACING_OBJ_FUNC(k_msgq, peek, msgq, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > idx) {
@@ -436,21 +706,36 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
 	struct k_thread *pending_thread;
+	_wait_q_t *put_wait_q = &msgq->wait_q;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		put_wait_q = &msgq->lf.put_wait_q;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	for (pending_thread = z_unpend_first_thread(put_wait_q);
 	     pending_thread != NULL;
-	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+	     pending_thread = z_unpend_first_thread(put_wait_q)) {
 		arch_thread_return_value_set(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 		resched = true;
 	}
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		/* not atomic with respect to concurrent senders */
+		while (lf_get(msgq, NULL)) {
+		}
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
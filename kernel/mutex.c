@@ -102,6 +102,55 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Busy wait for a mutex whose owner is running on another CPU, as long as
+ * it keeps running there and for a bounded time, so that short critical
+ * sections do not cost the waiter a context switch to sleep and another
+ * one to wake up. Called and returns with the lock held, returns true if
+ * the mutex got released meanwhile and can be taken.
+ *
+ * Only a mutex without waiters is ever released, others are handed over
+ * to their first waiter on unlock, so this does not starve pended threads.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_timeout_t timeout,
+		       k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_USEC);
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return false;
+	}
+
+	while (z_thread_is_active_elsewhere(mutex->owner)) {
+		if ((k_cycle_get_32() - start) >= limit) {
+			break;
+		}
+
+		k_spin_unlock(&lock, *key);
+		arch_spin_relax();
+		*key = k_spin_lock(&lock);
+
+		if (mutex->lock_count == 0U) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#else
+static inline bool mutex_spin(struct k_mutex *mutex, k_timeout_t timeout,
+			      k_spinlock_key_t *key)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(timeout);
+	ARG_UNUSED(key);
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -114,7 +163,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current)) ||
+	    mutex_spin(mutex, timeout, &key)) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					_current->base.prio :
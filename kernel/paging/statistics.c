@@ -98,6 +98,23 @@ void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 	memcpy(stats, &paging_stats, sizeof(paging_stats));
 }
 
+#ifdef CONFIG_EVICTION_SLRU
+/*
+ * These are called by the eviction algorithm with its own lock held, and
+ * the kernel paging code never writes these counters, so no extra locking
+ * is needed.
+ */
+void z_paging_stats_eviction_promoted_inc(void)
+{
+	paging_stats.eviction.promoted++;
+}
+
+void z_paging_stats_eviction_demoted_inc(void)
+{
+	paging_stats.eviction.demoted++;
+}
+#endif /* CONFIG_EVICTION_SLRU */
+
 #ifdef CONFIG_USERSPACE
 static inline
 void z_vrfy_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
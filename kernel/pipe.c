@@ -24,6 +24,16 @@ static inline bool pipe_resetting(struct k_pipe *pipe)
 	return (pipe->flags & PIPE_FLAG_RESET) != 0;
 }
 
+static inline bool pipe_write_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_WRITE_CLAIM) != 0;
+}
+
+static inline bool pipe_read_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_READ_CLAIM) != 0;
+}
+
 static inline bool pipe_full(struct k_pipe *pipe)
 {
 	return ring_buf_space_get(&pipe->buf) == 0;
@@ -165,6 +175,11 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
+		if (unlikely(pipe_write_claimed(pipe))) {
+			/* The ring buffer belongs to the claimer until it finishes */
+			goto wait;
+		}
+
 		if (pipe_empty(pipe)) {
 			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
 				/*
@@ -177,7 +192,11 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 				 * Simply wake up all pending readers instead.
 				 */
 				need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
-			} else if (pipe->waiting != 0) {
+			} else if (pipe->waiting != 0 && !pipe_read_claimed(pipe)) {
+				/*
+				 * Claimed data that is not released goes back
+				 * to the pipe: it must be read before this.
+				 */
 				written += copy_to_pending_readers(pipe, &need_resched,
 								   &data[written],
 								   len - written);
@@ -199,6 +218,7 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
+wait:
 		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
@@ -238,13 +258,16 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
-		if (likely(buf.used == len)) {
-			rc = buf.used;
-			break;
+		if (likely(!pipe_read_claimed(pipe))) {
+			buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
+			if (likely(buf.used == len)) {
+				rc = buf.used;
+				break;
+			}
 		}
 
-		if (unlikely(pipe_closed(pipe))) {
+		/* claimed data that is not released can still be read */
+		if (unlikely(pipe_closed(pipe) && !pipe_read_claimed(pipe))) {
 			rc = buf.used ? buf.used : -EPIPE;
 			break;
 		}
@@ -270,11 +293,182 @@ exit:
 	return rc;
 }
 
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (unlikely(ring_buf_capacity_get(&pipe->buf) == 0)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if (!pipe_full(pipe) && !pipe_write_claimed(pipe)) {
+			rc = ring_buf_put_claim(&pipe->buf, data,
+						MIN(len, ring_buf_capacity_get(&pipe->buf)));
+			pipe->flags |= PIPE_FLAG_WRITE_CLAIM;
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(!pipe_write_claimed(pipe))) {
+		rc = pipe_closed(pipe) ? -EPIPE : -ECANCELED;
+		goto exit;
+	}
+
+	rc = ring_buf_put_finish(&pipe->buf, MIN(len, UINT32_MAX));
+	if (rc != 0) {
+		goto exit;
+	}
+
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIM;
+
+	/*
+	 * Readers pending on an empty pipe, and writers pending on the
+	 * claim, now have to retry with the ring buffer.
+	 */
+	if (len != 0) {
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+	need_resched |= z_sched_wake_all(&pipe->space, 0, NULL);
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	/*
+	 * Writers copy directly to pending readers: an empty spec makes them
+	 * wake this thread up instead, so it claims from the ring buffer.
+	 */
+	struct pipe_buf_spec buf = { NULL, 0, 0 };
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (unlikely(ring_buf_capacity_get(&pipe->buf) == 0)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (!pipe_empty(pipe) && !pipe_read_claimed(pipe)) {
+			rc = ring_buf_get_claim(&pipe->buf, data,
+						MIN(len, ring_buf_capacity_get(&pipe->buf)));
+			pipe->flags |= PIPE_FLAG_READ_CLAIM;
+			break;
+		}
+
+		if (unlikely(pipe_closed(pipe) && !pipe_read_claimed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		_current->base.swap_data = &buf;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(!pipe_read_claimed(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	rc = ring_buf_get_finish(&pipe->buf, MIN(len, UINT32_MAX));
+	if (rc != 0) {
+		goto exit;
+	}
+
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIM;
+
+	/*
+	 * Writers pending on a full pipe, and readers pending on the claim,
+	 * now have to retry with the ring buffer.
+	 */
+	if (len != 0) {
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+	need_resched |= z_sched_wake_all(&pipe->data, 0, NULL);
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
 		ring_buf_reset(&pipe->buf);
+		/* Pending claims refer to discarded data or space */
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIM | PIPE_FLAG_READ_CLAIM);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -288,7 +482,8 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		/* Remaining data, including claimed data, can still be read */
+		pipe->flags &= PIPE_FLAG_READ_CLAIM;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -82,7 +83,7 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if (z_msgq_used_get(event->msgq) > 0) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -108,22 +109,30 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own, they come after all polling threads */
+static inline bool is_poll_set(struct z_poller *poller)
+{
+	return poller->mode == MODE_SET;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || is_poll_set(poller) ||
+		(!is_poll_set(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (is_poll_set(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -441,6 +450,8 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			retcode = signal_poll_set(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -808,3 +819,157 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set, poller);
+	struct k_thread *thread;
+
+	ARG_UNUSED(state);
+
+	/* The object already unlinked the event, it can be queued as ready */
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static bool poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	if (is_condition_met(event, &state)) {
+		event->poller = NULL;
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_node);
+		return true;
+	}
+
+	event->state = K_POLL_STATE_NOT_READY;
+	register_event(event, &set->poller);
+	return false;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_thread *thread = NULL;
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY, "only NOTIFY_ONLY mode is supported\n");
+
+	sys_dnode_init(&event->_node);
+	if (poll_set_arm(set, event)) {
+		thread = z_unpend_first_thread(&set->wait_q);
+	}
+
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
+
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	ARG_UNUSED(set);
+
+	K_SPINLOCK(&lock) {
+		/* Linked either to its object or to the ready list */
+		if (sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		event->poller = NULL;
+	}
+}
+
+/* must be called with interrupts locked */
+static int poll_set_collect(struct k_poll_set *set, struct k_poll_event **ready, int max_events)
+{
+	sys_dlist_t still_ready;
+	sys_dnode_t *node;
+	int count = 0;
+
+	sys_dlist_init(&still_ready);
+
+	while ((count < max_events) && ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		struct k_poll_event *event = CONTAINER_OF(node, struct k_poll_event, _node);
+		uint32_t state;
+
+		if ((event->state & K_POLL_STATE_CANCELLED) != 0U) {
+			/* Reported once, then watched again */
+			ready[count++] = event;
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+			event->state = K_POLL_STATE_CANCELLED;
+		} else if (is_condition_met(event, &state)) {
+			ready[count++] = event;
+			event->state = state;
+			sys_dlist_append(&still_ready, &event->_node);
+		} else {
+			/* Consumed meanwhile, watch the object again */
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+		}
+	}
+
+	/* Level-triggered: returned events are checked again on next wait */
+	while ((node = sys_dlist_get(&still_ready)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return count;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready, int max_events,
+		    k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int rc;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(max_events > 0, "no room for ready events\n");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		rc = poll_set_collect(set, ready, max_events);
+		if (rc > 0) {
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			rc = -EAGAIN;
+			break;
+		}
+
+		rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+		if (rc == -EAGAIN) {
+			/* Timed out, still return events that got ready meanwhile */
+			end = sys_timepoint_calc(K_NO_WAIT);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return rc;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/spinlock.h>
+#include <kernel_internal.h>
+#include <kthread.h>
+
+/*
+ * Read-side sections hold the scheduler lock, so a CPU is known to have
+ * left all sections it was in once it context switched, as counted in
+ * _cpu::rcu_qs by the scheduler. Switches to or from a thread holding the
+ * scheduler lock are not counted, as MetaIRQ threads preempt such threads
+ * in the middle of their sections. A CPU seen running its idle thread
+ * outside of any interrupt is not in a section either, while sections in
+ * interrupts end before the CPU can switch context. The CPU waiting for
+ * the grace period must switch context too, as it may run a MetaIRQ thread
+ * that preempted a reader. Without SMP, interrupts cannot overlap the
+ * waiting thread and MetaIRQ threads are not allowed to wait, so grace
+ * periods are empty.
+ */
+struct rcu_gp {
+#ifdef CONFIG_SMP
+	uint32_t qs[CONFIG_MP_MAX_NUM_CPUS];
+	/* CPUs that did not go through a quiescent state yet */
+	uint32_t pending;
+#endif /* CONFIG_SMP */
+};
+
+#ifdef CONFIG_SMP
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32, "Too many CPUs for the pending mask");
+#endif /* CONFIG_SMP */
+
+static struct k_spinlock rcu_lock;
+/* Reclamation requests made since the current grace period started */
+static sys_slist_t rcu_next;
+/* Reclamation requests waiting for the current grace period */
+static sys_slist_t rcu_waiting;
+static struct rcu_gp rcu_waiting_gp;
+
+static void rcu_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(rcu_work, rcu_work_handler);
+
+static void rcu_gp_start(struct rcu_gp *gp)
+{
+#ifdef CONFIG_SMP
+	unsigned int key = arch_irq_lock();
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Order the unlinking of reclaimed elements before the snapshot */
+	barrier_dmem_fence_full();
+
+	gp->pending = 0U;
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		gp->qs[i] = *(volatile uint32_t *)&_kernel.cpus[i].rcu_qs;
+		gp->pending |= BIT(i);
+	}
+
+	arch_irq_unlock(key);
+#else
+	ARG_UNUSED(gp);
+#endif /* CONFIG_SMP */
+}
+
+#ifdef CONFIG_SMP
+static bool rcu_cpu_idle(struct _cpu *cpu)
+{
+	/* An interrupt taken from idle may be in a read-side section */
+	return (*(struct k_thread * volatile *)&cpu->current == cpu->idle_thread) &&
+	       (*(volatile uint32_t *)&cpu->nested == 0U);
+}
+#endif /* CONFIG_SMP */
+
+static bool rcu_gp_done(struct rcu_gp *gp)
+{
+#ifdef CONFIG_SMP
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+
+		if (((gp->pending & BIT(i)) != 0U) &&
+		    ((*(volatile uint32_t *)&cpu->rcu_qs != gp->qs[i]) || rcu_cpu_idle(cpu))) {
+			gp->pending &= ~BIT(i);
+		}
+	}
+
+	if (gp->pending != 0U) {
+		return false;
+	}
+
+	/* Order the end of read-side sections before the reclamation */
+	barrier_dmem_fence_full();
+#else
+	ARG_UNUSED(gp);
+#endif /* CONFIG_SMP */
+
+	return true;
+}
+
+void k_rcu_synchronize(void)
+{
+	struct rcu_gp gp;
+
+	__ASSERT(!k_is_in_isr(), "RCU grace periods cannot be awaited from ISRs");
+	__ASSERT(IS_ENABLED(CONFIG_SMP) || !thread_is_metairq(_current),
+		 "MetaIRQ threads may preempt read-side sections");
+
+	rcu_gp_start(&gp);
+
+	while (!rcu_gp_done(&gp)) {
+		k_sleep(K_TICKS(1));
+	}
+}
+
+void k_rcu_call(struct k_rcu_head *head, void (*func)(struct k_rcu_head *head))
+{
+	head->func = func;
+
+	K_SPINLOCK(&rcu_lock) {
+		sys_slist_append(&rcu_next, &head->node);
+	}
+
+	(void)k_work_schedule(&rcu_work, K_NO_WAIT);
+}
+
+static void rcu_work_handler(struct k_work *work)
+{
+	struct k_rcu_head *head, *next;
+	sys_slist_t done;
+	bool busy;
+
+	sys_slist_init(&done);
+
+	K_SPINLOCK(&rcu_lock) {
+		if (!sys_slist_is_empty(&rcu_waiting) && rcu_gp_done(&rcu_waiting_gp)) {
+			done = rcu_waiting;
+			sys_slist_init(&rcu_waiting);
+		}
+
+		/* Requests made meanwhile wait for the next grace period */
+		if (sys_slist_is_empty(&rcu_waiting) && !sys_slist_is_empty(&rcu_next)) {
+			rcu_waiting = rcu_next;
+			sys_slist_init(&rcu_next);
+			rcu_gp_start(&rcu_waiting_gp);
+		}
+
+		busy = !sys_slist_is_empty(&rcu_waiting);
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&done, head, next, node) {
+		head->func(head);
+	}
+
+	if (busy) {
+		(void)k_work_schedule(k_work_delayable_from_work(work),
+				      IS_ENABLED(CONFIG_SMP) ? K_TICKS(1) : K_NO_WAIT);
+	}
+}
@@ -58,6 +58,23 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	 */
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
+	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_STEALING)
+	/* Queue on the CPU the thread last ran on, which it can't leave
+	 * while queued: stealing it dequeues it first. Threads that never
+	 * ran (or got their mask changed) start from their first allowed
+	 * CPU.
+	 */
+	int cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	int m = thread->base.cpu_mask;
+
+	if ((m & BIT(cpu)) == 0) {
+		cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	return &_kernel.cpus[cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
@@ -67,11 +84,11 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
@@ -95,9 +112,42 @@ static ALWAYS_INLINE void runq_yield(void)
 	_priq_run_yield(curr_cpu_runq());
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_STEALING
+/* Best thread this CPU may run: the head of the local queue, unless the
+ * queue of another CPU holds a higher priority thread runnable here, in
+ * which case it gets stolen.
+ */
+static struct k_thread *runq_steal_best(void)
+{
+	struct _cpu *cpu = arch_curr_cpu();
+	struct k_thread *best = _priq_run_best(&cpu->ready_q.runq);
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *thread;
+
+		if (i == cpu->id) {
+			continue;
+		}
+
+		thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_PER_CPU_STEALING */
+
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_STEALING
+	return runq_steal_best();
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_STEALING */
 }
 
 /* _current is never in the run queue until context switch on
@@ -291,6 +341,12 @@ static ALWAYS_INLINE void update_cache(int preempt_ok)
 		_kernel.ready_q.cache = _current;
 	}
 
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+	if (_kernel.ready_q.cache == _current) {
+		z_time_slice_contend();
+	}
+#endif /* CONFIG_TIMESLICE_CONTENDED_ONLY */
+
 #else
 	/* The way this works is that the CPU record keeps its
 	 * "cooperative swapping is OK" flag until the next reschedule
@@ -324,6 +380,193 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
+bool z_thread_is_active_elsewhere(struct k_thread *thread)
+{
+	return thread_active_elsewhere(thread) != NULL;
+}
+
+#ifdef CONFIG_SCHED_DEADLINE
+static void thread_deadline_set(struct k_thread *thread, int deadline)
+{
+	/* The prio_deadline field changes the sorting order, so can't
+	 * change it while the thread is in the run queue (dlists
+	 * actually are benign as long as we requeue it before we
+	 * release the lock, but an rbtree will blow up if we break
+	 * sorting!)
+	 */
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+		thread->base.prio_deadline = deadline;
+		queue_thread(thread);
+	} else {
+		thread->base.prio_deadline = deadline;
+	}
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Server bandwidths are budget to period ratios in this fixed point format */
+#define CBS_BW_SHIFT 20
+#define CBS_BW_MAX                                                                                 \
+	((((uint64_t)CONFIG_SCHED_DEADLINE_CBS_UTILIZATION << CBS_BW_SHIFT) / 100U) *              \
+	 CONFIG_MP_MAX_NUM_CPUS)
+
+static uint64_t cbs_bandwidth;
+static struct _timeout cbs_timeouts[CONFIG_MP_MAX_NUM_CPUS];
+static bool cbs_expired[CONFIG_MP_MAX_NUM_CPUS];
+
+static inline bool thread_is_cbs(struct k_thread *thread)
+{
+	return thread->base.cbs.budget != 0U;
+}
+
+static void cbs_timeout(struct _timeout *timeout)
+{
+	int cpu = ARRAY_INDEX(cbs_timeouts, timeout);
+
+	cbs_expired[cpu] = true;
+
+	/* The budget is checked by the CPU running the server */
+	if (cpu != _current_cpu->id) {
+		flag_ipi(IPI_CPU_MASK(cpu));
+	}
+}
+
+/* A server waking up keeps its deadline only if its remaining budget does
+ * not exceed its bandwidth until then, else it gets a fresh budget and
+ * deadline.
+ */
+static void cbs_wakeup(struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+	int32_t left = thread->base.prio_deadline - (int32_t)now;
+
+	if (!thread_is_cbs(thread)) {
+		return;
+	}
+
+	if ((left <= 0) ||
+	    (((uint64_t)thread->base.cbs.remaining * thread->base.cbs.period) >
+	     ((uint64_t)thread->base.cbs.budget * (uint32_t)left))) {
+		thread->base.cbs.remaining = thread->base.cbs.budget;
+		thread->base.prio_deadline = (int)(now + thread->base.cbs.period);
+	}
+}
+
+void z_sched_cbs_start(struct k_thread *thread)
+{
+	int cpu = _current_cpu->id;
+
+	if (!thread_is_cbs(thread)) {
+		return;
+	}
+
+	z_abort_timeout(&cbs_timeouts[cpu]);
+	cbs_expired[cpu] = false;
+	z_add_timeout(&cbs_timeouts[cpu], cbs_timeout, K_CYC(thread->base.cbs.remaining));
+}
+
+void z_sched_cbs_stop(struct k_thread *thread, uint32_t cycles)
+{
+	if (!thread_is_cbs(thread)) {
+		return;
+	}
+
+	z_abort_timeout(&cbs_timeouts[_current_cpu->id]);
+	thread->base.cbs.remaining -= MIN(cycles, thread->base.cbs.remaining);
+}
+
+void z_sched_cbs_check(void)
+{
+	int cpu = _current_cpu->id;
+	k_thread_cbs_overrun_fn_t overrun = NULL;
+	struct k_thread *curr;
+	k_spinlock_key_t key;
+
+	if (!cbs_expired[cpu]) {
+		return;
+	}
+
+	/* Charge the run time up to now before looking at the budget */
+	z_sched_usage_cbs_sync();
+
+	key = k_spin_lock(&_sched_spinlock);
+	cbs_expired[cpu] = false;
+	curr = _current;
+
+	if (thread_is_cbs(curr)) {
+		if (curr->base.cbs.remaining == 0U) {
+			/* Replenish and postpone the deadline by one period */
+			curr->base.cbs.remaining = curr->base.cbs.budget;
+			thread_deadline_set(curr, curr->base.prio_deadline +
+						  (int)curr->base.cbs.period);
+			update_cache(1);
+			overrun = curr->base.cbs.overrun;
+		}
+
+		z_sched_cbs_start(curr);
+	}
+
+	k_spin_unlock(&_sched_spinlock, key);
+
+	if (overrun != NULL) {
+		overrun(curr, curr->base.cbs.overrun_data);
+	}
+}
+
+int k_thread_cbs_set(k_tid_t thread, uint32_t budget, uint32_t period,
+		     k_thread_cbs_overrun_fn_t overrun, void *data)
+{
+	uint32_t bandwidth = 0U;
+	int ret = 0;
+
+	if (budget != 0U) {
+		if ((period == 0U) || (period > INT_MAX) || (budget > period)) {
+			return -EINVAL;
+		}
+
+		bandwidth = (uint32_t)(((uint64_t)budget << CBS_BW_SHIFT) / period);
+	}
+
+	if (thread == _current) {
+		/* Charge what ran so far to the previous budget */
+		z_sched_usage_cbs_sync();
+	}
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if ((cbs_bandwidth - thread->base.cbs.bandwidth + bandwidth) > CBS_BW_MAX) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_bandwidth = cbs_bandwidth - thread->base.cbs.bandwidth + bandwidth;
+
+		thread->base.cbs.budget = budget;
+		thread->base.cbs.period = period;
+		thread->base.cbs.remaining = budget;
+		thread->base.cbs.bandwidth = bandwidth;
+		thread->base.cbs.overrun = overrun;
+		thread->base.cbs.overrun_data = data;
+
+		if (budget != 0U) {
+			thread_deadline_set(thread, (int)(k_cycle_get_32() + period));
+		}
+
+		if (thread == _current) {
+			if (budget != 0U) {
+				z_sched_cbs_start(thread);
+			} else {
+				z_abort_timeout(&cbs_timeouts[_current_cpu->id]);
+			}
+
+			update_cache(1);
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -336,6 +579,12 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		z_sched_usage_ready(thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_wakeup(thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 		queue_thread(thread);
 		update_cache(0);
 
@@ -865,6 +1114,7 @@ void *z_get_next_switch_handle(void *interrupted)
 		__ASSERT(old_thread->switch_handle == NULL || is_thread_dummy(old_thread),
 			"old thread handle should be null.");
 
+		ipi_inflight_clear();
 		new_thread = next_up();
 
 		z_sched_usage_switch(new_thread);
@@ -879,6 +1129,7 @@ void *z_get_next_switch_handle(void *interrupted)
 			_current_cpu->swap_ok = 0;
 			cpu_id = arch_curr_cpu()->id;
 			new_thread->base.cpu = cpu_id;
+			z_rcu_qs_switch(old_thread, new_thread);
 			set_current(new_thread);
 
 #ifdef CONFIG_TIMESLICING
@@ -947,13 +1198,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -991,22 +1242,8 @@ static inline void z_vrfy_k_thread_priority_set(k_tid_t thread, int prio)
 #ifdef CONFIG_SCHED_DEADLINE
 void z_impl_k_thread_absolute_deadline_set(k_tid_t tid, int deadline)
 {
-	struct k_thread *thread = tid;
-
-	/* The prio_deadline field changes the sorting order, so can't
-	 * change it while the thread is in the run queue (dlists
-	 * actually are benign as long as we requeue it before we
-	 * release the lock, but an rbtree will blow up if we break
-	 * sorting!)
-	 */
 	K_SPINLOCK(&_sched_spinlock) {
-		if (z_is_thread_queued(thread)) {
-			dequeue_thread(thread);
-			thread->base.prio_deadline = deadline;
-			queue_thread(thread);
-		} else {
-			thread->base.prio_deadline = deadline;
-		}
+		thread_deadline_set(tid, deadline);
 	}
 }
 
@@ -1267,6 +1504,13 @@ static ALWAYS_INLINE void halt_thread(struct k_thread *thread, uint8_t new_state
 			z_abort_thread_timeout(thread);
 			unpend_all(&thread->join_queue);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+			/* Release the server bandwidth */
+			cbs_bandwidth -= thread->base.cbs.bandwidth;
+			thread->base.cbs.bandwidth = 0U;
+			thread->base.cbs.budget = 0U;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 			/* Edge case: aborting _current from within an
 			 * ISR that preempted it requires clearing the
 			 * _current pointer so the upcoming context
@@ -0,0 +1,75 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Contended path of MCS spinlocks.
+ *
+ * A CPU that finds the lock taken appends a node of its own to the queue
+ * of waiters and spins on that node until its predecessor hands over the
+ * head of the queue. The head then spins on the lock variable itself, and
+ * once it took the lock, it passes the head of the queue to its successor.
+ *
+ * Nodes are only used while waiting, not while holding a lock, so a CPU
+ * needs one node per level of nesting of k_spin_lock() calls that can
+ * spin at once. Interrupts are masked while spinning, a few nodes cover
+ * exceptions taken in that window.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/llext/symbol.h>
+#include <kernel_internal.h>
+
+#define MCS_NODES_PER_CPU 4
+
+/* Keep the nodes of different CPUs in separate cache lines of common size */
+#define MCS_NODE_ALIGN 64
+
+struct mcs_node {
+	atomic_ptr_t next;
+	atomic_t wait;
+} __aligned(MCS_NODE_ALIGN);
+
+static struct mcs_node mcs_nodes[CONFIG_MP_MAX_NUM_CPUS][MCS_NODES_PER_CPU];
+static uint8_t mcs_depth[CONFIG_MP_MAX_NUM_CPUS];
+
+void z_spin_lock_mcs(struct k_spinlock *l)
+{
+	unsigned int cpu = _current_cpu->id;
+	struct mcs_node *node, *prev, *next;
+
+	__ASSERT(mcs_depth[cpu] < MCS_NODES_PER_CPU, "Too many nested MCS spinlock waits");
+	node = &mcs_nodes[cpu][mcs_depth[cpu]++];
+
+	(void)atomic_ptr_clear(&node->next);
+	(void)atomic_set(&node->wait, 1);
+
+	prev = atomic_ptr_set(&l->tail, node);
+	if (prev != NULL) {
+		(void)atomic_ptr_set(&prev->next, node);
+
+		while (atomic_get(&node->wait) != 0) {
+			arch_spin_relax();
+		}
+	}
+
+	/* Head of the queue, wait for the owner to release the lock */
+	while ((atomic_get(&l->locked) != 0) || !atomic_cas(&l->locked, 0, 1)) {
+		arch_spin_relax();
+	}
+
+	/* Leave the queue, letting the next waiter become its head */
+	if (!atomic_ptr_cas(&l->tail, node, NULL)) {
+		while ((next = atomic_ptr_get(&node->next)) == NULL) {
+			arch_spin_relax();
+		}
+
+		(void)atomic_clear(&next->wait);
+	}
+
+	mcs_depth[cpu]--;
+}
+EXPORT_SYMBOL(z_spin_lock_mcs);
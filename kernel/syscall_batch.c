@@ -0,0 +1,58 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -EPERM;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	/* The marshalling functions clear the syscall frame when they
+	 * return, keep it so each call of the batch can still oops the
+	 * calling thread.
+	 */
+	void *ssf = _current->syscall_frame;
+
+	if (count > CONFIG_SYSCALL_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		uintptr_t id = entries[i].id;
+		uintptr_t args[ARRAY_SIZE(entries[i].args)];
+		uintptr_t ret;
+
+		/* Take a copy, so other user threads changing the entry
+		 * cannot race with the checks done by the handler.
+		 */
+		memcpy(args, entries[i].args, sizeof(args));
+
+		if ((id >= K_SYSCALL_LIMIT) || (id == K_SYSCALL_K_SYSCALL_BATCH)) {
+			ret = (uintptr_t)-ENOSYS;
+		} else {
+			ret = _k_syscall_table[id](args[0], args[1], args[2], args[3], args[4],
+						   args[5], ssf);
+			_current->syscall_frame = ssf;
+		}
+
+		entries[i].ret = ret;
+	}
+
+	return (int)count;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
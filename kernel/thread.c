@@ -597,6 +597,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	__ASSERT((options & K_USER) == 0U || z_stack_is_user_capable(stack),
 		 "user thread %p with kernel-only stack %p",
 		 new_thread, stack);
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	new_thread->dyn_obj_cache.obj = NULL;
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
 	k_object_init(new_thread);
 	k_object_init(stack);
 	new_thread->stack_obj = stack;
@@ -649,6 +652,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #endif /* CONFIG_THREAD_CUSTOM_DATA */
 #ifdef CONFIG_EVENTS
 	new_thread->no_wake_on_timeout = false;
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	sys_dnode_init(&new_thread->event_node);
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 #endif /* CONFIG_EVENTS */
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
@@ -829,6 +835,11 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif /* CONFIG_TIMESLICE_PER_THREAD */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	thread_base->cbs.budget = 0U;
+	thread_base->cbs.bandwidth = 0U;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1055,6 +1066,12 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->peak_cycles      += tmp_stats.peak_cycles;
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		for (size_t j = 0; j < ARRAY_SIZE(stats->run_histogram); j++) {
+			stats->run_histogram[j]    += tmp_stats.run_histogram[j];
+			stats->wakeup_histogram[j] += tmp_stats.wakeup_histogram[j];
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
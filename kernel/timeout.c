@@ -11,19 +11,76 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+/* See the timing wheel implementation below */
+#define WHEEL_BITS      5U
+#define WHEEL_SLOTS     BIT(WHEEL_BITS)
+#define WHEEL_MASK      (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS    CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+
+BUILD_ASSERT(WHEEL_SLOTS <= 32U, "pending bitmap holds 32 slots");
+
+struct wheel_level {
+	uint32_t pending;
+	sys_dlist_t slot[WHEEL_SLOTS];
+};
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+struct timeout_queue {
+	/*
+	 * The timeout code shall take no locks other than its own (queue
+	 * locks, then clock_lock), nor shall it call any other subsystem
+	 * while holding them.
+	 */
+	struct k_spinlock lock;
 
-static uint64_t curr_tick;
+	/* Tick up to which the queue has been announced, which is also the
+	 * tick of the currently firing timeout while sys_clock_announce()
+	 * processes the queue.
+	 */
+	uint64_t tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+	/* Ticks left to process in the currently-executing sys_clock_announce() */
+	int announce_remaining;
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+	struct wheel_level wheel[WHEEL_LEVELS];
+	sys_dlist_t overflow;
+#else
+	sys_dlist_t list;
+#endif /* CONFIG_TIMEOUT_WHEEL */
+};
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+#define TIMEOUT_QUEUE_INIT(i, _) \
+	{ .overflow = SYS_DLIST_STATIC_INIT(&timeout_queues[i].overflow) }
+#else
+#define TIMEOUT_QUEUE_INIT(i, _) \
+	{ .list = SYS_DLIST_STATIC_INIT(&timeout_queues[i].list) }
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
 /*
- * The timeout code shall take no locks other than its own (timeout_lock), nor
- * shall it call any other subsystem while holding this lock.
+ * Each CPU queues the timeouts it adds and handles their expiry from its own
+ * timer interrupt. curr_tick accumulates the ticks announced by all CPUs, a
+ * queue lagging behind it until its own CPU announces ticks.
  */
-static struct k_spinlock timeout_lock;
+#define NUM_TIMEOUT_QUEUES CONFIG_MP_MAX_NUM_CPUS
+
+static uint64_t curr_tick;
 
-/* Ticks left to process in the currently-executing sys_clock_announce() */
-static int announce_remaining;
+/* Protects curr_tick, nests inside queue locks */
+static struct k_spinlock clock_lock;
+#else
+#define NUM_TIMEOUT_QUEUES 1
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+static struct timeout_queue timeout_queues[NUM_TIMEOUT_QUEUES] = {
+	LISTIFY(NUM_TIMEOUT_QUEUES, TIMEOUT_QUEUE_INIT, (,))
+};
 
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
@@ -37,34 +94,427 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * In this mode the dticks field of a queued timeout holds its absolute
+ * expiry tick instead of a delta to the previous timeout.  Each level has
+ * WHEEL_SLOTS slots, a slot of level N spanning WHEEL_SLOTS^N ticks.  A
+ * timeout is stored at the level of the most significant WHEEL_BITS digit
+ * where its expiry tick differs from the queue tick, in the slot given by
+ * that digit.  Level 0 slots thus only hold timeouts expiring exactly at the
+ * slot tick, and entries of a coarser slot get redistributed ("cascaded")
+ * into the finer levels once the queue tick reaches the start of that slot.
+ * Timeouts not fitting in the wheel are kept in an unsorted overflow list
+ * which is rescanned once per full wheel revolution.
+ *
+ * Slot list heads are only initialized when the slot becomes non-empty, the
+ * per-level pending bitmap being the authoritative emptiness indicator.
+ */
+
+static unsigned int wheel_level(struct timeout_queue *q, uint64_t deadline)
+{
+	uint64_t diff = deadline ^ q->tick;
+
+	if (diff < WHEEL_SLOTS) {
+		return 0U;
+	}
+
+	return (63U - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+}
+
+static unsigned int wheel_slot(uint64_t deadline, unsigned int lvl)
+{
+	return (deadline >> (lvl * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+/* Tick at which the wheel must be serviced for this deadline: the deadline
+ * itself at level 0, the start of the holding slot at coarser levels.
+ */
+static uint64_t wheel_event(struct timeout_queue *q, uint64_t deadline)
+{
+	unsigned int lvl = wheel_level(q, deadline);
+
+	if (lvl >= WHEEL_LEVELS) {
+		return ((q->tick >> WHEEL_SPAN_BITS) + 1U) << WHEEL_SPAN_BITS;
+	}
+
+	return (deadline >> (lvl * WHEEL_BITS)) << (lvl * WHEEL_BITS);
+}
+
+/* Earliest tick at which the wheel needs servicing, UINT64_MAX if empty.
+ *
+ * All entries of a level expire before the first event of the next,
+ * coarser, level, so only the first non-empty level matters.
+ */
+static uint64_t wheel_next_event(struct timeout_queue *q)
+{
+	for (unsigned int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		uint32_t pending = q->wheel[lvl].pending;
+
+		if (pending != 0U) {
+			unsigned int shift = lvl * WHEEL_BITS;
+			uint64_t base = (q->tick >> (shift + WHEEL_BITS)) << (shift + WHEEL_BITS);
+
+			return base | ((uint64_t)(find_lsb_set(pending) - 1U) << shift);
+		}
+	}
+
+	if (!sys_dlist_is_empty(&q->overflow)) {
+		return ((q->tick >> WHEEL_SPAN_BITS) + 1U) << WHEEL_SPAN_BITS;
+	}
+
+	return UINT64_MAX;
+}
+
+static void wheel_insert(struct timeout_queue *q, struct _timeout *to)
+{
+	uint64_t deadline = (uint64_t)to->dticks;
+	unsigned int lvl = wheel_level(q, deadline);
+	struct wheel_level *level;
+	unsigned int idx;
+
+	if (lvl >= WHEEL_LEVELS) {
+		sys_dlist_append(&q->overflow, &to->node);
+		return;
+	}
+
+	level = &q->wheel[lvl];
+	idx = wheel_slot(deadline, lvl);
+	if ((level->pending & BIT(idx)) == 0U) {
+		sys_dlist_init(&level->slot[idx]);
+		level->pending |= BIT(idx);
+	}
+	sys_dlist_append(&level->slot[idx], &to->node);
+}
+
+static void wheel_requeue_list(struct timeout_queue *q, sys_dlist_t *list)
+{
+	sys_dlist_t tmp;
+	sys_dnode_t *node;
+
+	/* Entries may land back in the same list, so move them out first */
+	sys_dlist_init(&tmp);
+	while ((node = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&tmp, node);
+	}
+
+	while ((node = sys_dlist_get(&tmp)) != NULL) {
+		wheel_insert(q, CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Redistribute the coarse slots starting at the queue tick into finer levels */
+static void wheel_cascade(struct timeout_queue *q)
+{
+	if ((q->tick & BIT64_MASK(WHEEL_SPAN_BITS)) == 0U) {
+		wheel_requeue_list(q, &q->overflow);
+	}
+
+	for (unsigned int lvl = WHEEL_LEVELS - 1U; lvl > 0U; lvl--) {
+		struct wheel_level *level = &q->wheel[lvl];
+		unsigned int idx = wheel_slot(q->tick, lvl);
+
+		if (((q->tick & BIT64_MASK(lvl * WHEEL_BITS)) != 0U) ||
+		    ((level->pending & BIT(idx)) == 0U)) {
+			continue;
+		}
+
+		/* Entries now differ from the queue tick in a finer digit
+		 * only, so none of them is queued back into this slot.
+		 */
+		level->pending &= ~BIT(idx);
+		wheel_requeue_list(q, &level->slot[idx]);
+	}
+}
+
+/* Dequeue a timeout expiring at the queue tick, if any */
+static struct _timeout *wheel_pop_expired(struct timeout_queue *q)
+{
+	struct wheel_level *level = &q->wheel[0];
+	unsigned int idx = wheel_slot(q->tick, 0U);
+	sys_dnode_t *node;
+
+	if ((level->pending & BIT(idx)) == 0U) {
+		return NULL;
+	}
+
+	node = sys_dlist_get(&level->slot[idx]);
+	if (sys_dlist_is_empty(&level->slot[idx])) {
+		level->pending &= ~BIT(idx);
+	}
+
+	return CONTAINER_OF(node, struct _timeout, node);
+}
+
+static bool queue_is_empty(struct timeout_queue *q)
+{
+	return wheel_next_event(q) == UINT64_MAX;
+}
+
+static void remove_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	uint64_t deadline = (uint64_t)t->dticks;
+	unsigned int lvl = wheel_level(q, deadline);
+
+	sys_dlist_remove(&t->node);
+
+	if (lvl < WHEEL_LEVELS) {
+		struct wheel_level *level = &q->wheel[lvl];
+		unsigned int idx = wheel_slot(deadline, lvl);
+
+		if (sys_dlist_is_empty(&level->slot[idx])) {
+			level->pending &= ~BIT(idx);
+		}
+	}
+}
+
+/* Queue a timeout expiring to->dticks ticks after the queue tick */
+static void insert_timeout(struct timeout_queue *q, struct _timeout *to)
+{
+	to->dticks += q->tick;
+	wheel_insert(q, to);
+}
+
+static bool is_next_timeout(struct timeout_queue *q, const struct _timeout *to)
+{
+	return wheel_event(q, (uint64_t)to->dticks) == wheel_next_event(q);
+}
+
+/* Delta from the queue tick of the next wheel event, false if there is none */
+static bool next_dticks(struct timeout_queue *q, int64_t *dticks)
+{
+	uint64_t next = wheel_next_event(q);
+
+	if (next == UINT64_MAX) {
+		return false;
+	}
+
+	*dticks = (int64_t)(next - q->tick);
+	return true;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	return (k_ticks_t)((uint64_t)timeout->dticks - q->tick);
+}
+
+#else
+
+static struct _timeout *first(struct timeout_queue *q)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_queue *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static bool queue_is_empty(struct timeout_queue *q)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	return sys_dlist_is_empty(&q->list);
+}
+
+static void remove_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
+/* Queue a timeout expiring to->dticks ticks after the queue tick */
+static void insert_timeout(struct timeout_queue *q, struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+}
+
+static bool is_next_timeout(struct timeout_queue *q, const struct _timeout *to)
+{
+	return to == first(q);
+}
+
+/* Delta from the queue tick of the next timeout, false if there is none */
+static bool next_dticks(struct timeout_queue *q, int64_t *dticks)
+{
+	struct _timeout *to = first(q);
+
+	if (to == NULL) {
+		return false;
+	}
+
+	*dticks = to->dticks;
+	return true;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+
+static uint64_t announced_ticks(void)
+{
+	uint64_t ticks = 0U;
+
+	K_SPINLOCK(&clock_lock) {
+		ticks = curr_tick;
+	}
+
+	return ticks;
+}
+
+/* Lock the timeout queue of the current CPU */
+static struct timeout_queue *lock_curr_queue(k_spinlock_key_t *key)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct timeout_queue *q = &timeout_queues[_current_cpu->id];
+
+	*key = k_spin_lock(&q->lock);
+
+	/* Interrupts got masked before picking the queue, hand their
+	 * original state over so that k_spin_unlock() restores it.
+	 */
+	key->key = irq_key;
+
+	return q;
+}
+
+/* Lock the timeout queue a timeout was last added to */
+static struct timeout_queue *lock_timeout_queue(const struct _timeout *to,
+					       k_spinlock_key_t *key)
+{
+	for (;;) {
+		uint8_t cpu = to->cpu;
+		struct timeout_queue *q = &timeout_queues[cpu];
+
+		*key = k_spin_lock(&q->lock);
+		if (to->cpu == cpu) {
+			return q;
+		}
+
+		/* Requeued on another CPU meanwhile */
+		k_spin_unlock(&q->lock, *key);
+	}
+}
+
+static bool is_local_queue(struct timeout_queue *q)
+{
+	return q == &timeout_queues[_current_cpu->id];
+}
+
+#else
+
+static struct timeout_queue *lock_curr_queue(k_spinlock_key_t *key)
+{
+	*key = k_spin_lock(&timeout_queues[0].lock);
+
+	return &timeout_queues[0];
+}
+
+static struct timeout_queue *lock_timeout_queue(const struct _timeout *to,
+					       k_spinlock_key_t *key)
+{
+	ARG_UNUSED(to);
+
+	return lock_curr_queue(key);
+}
+
+#define announced_ticks() (timeout_queues[0].tick)
+#define is_local_queue(q) true
+
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+#ifdef CONFIG_TIMESLICING
+/* Tick at which the time slice of each CPU ends, 0 when none is armed. The
+ * slice gets reset on about every context switch, so rather than churning
+ * through the timeout queue it is kept here and checked on each announce.
+ * Only the queue lock of the owning CPU protects it with per-CPU queues.
+ */
+static uint64_t slice_deadlines[CONFIG_MP_MAX_NUM_CPUS];
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+#define SLICE_CPUS_FIRST() (_current_cpu->id)
+#define SLICE_CPUS_END()   (_current_cpu->id + 1U)
+#else
+#define SLICE_CPUS_FIRST() 0U
+#define SLICE_CPUS_END()   arch_num_cpus()
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+/* must be locked */
+static bool next_slice_dticks(struct timeout_queue *q, int64_t *dticks)
+{
+	bool found = false;
+
+	for (unsigned int cpu = SLICE_CPUS_FIRST(); cpu < SLICE_CPUS_END(); cpu++) {
+		int64_t d = (int64_t)(slice_deadlines[cpu] - q->tick);
+
+		if ((slice_deadlines[cpu] != 0U) && (!found || (d < *dticks))) {
+			*dticks = d;
+			found = true;
+		}
+	}
+
+	return found;
+}
+
+/* must be locked, returns the mask of CPUs whose slice has ended */
+static uint32_t expire_slices(struct timeout_queue *q)
+{
+	uint32_t expired = 0U;
+
+	for (unsigned int cpu = SLICE_CPUS_FIRST(); cpu < SLICE_CPUS_END(); cpu++) {
+		if ((slice_deadlines[cpu] != 0U) && (slice_deadlines[cpu] <= q->tick)) {
+			slice_deadlines[cpu] = 0U;
+			expired |= BIT(cpu);
+		}
+	}
+
+	return expired;
+}
+#endif /* CONFIG_TIMESLICING */
+
+/* must be locked */
+static int32_t elapsed(struct timeout_queue *q)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
 	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
+	 * value (=q->tick) rather than relative to the current
 	 * sys_clock_elapsed().
 	 *
 	 * This means that timeouts being scheduled from within timeout callbacks
@@ -77,20 +527,37 @@ static int32_t elapsed(void)
 	 * The distinction is implemented by looking at announce_remaining which
 	 * will be non-zero while sys_clock_announce() is executing and zero
 	 * otherwise.
+	 *
+	 * Per-CPU queues may additionally lag behind the ticks announced by
+	 * other CPUs.
 	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+	if (q->announce_remaining != 0) {
+		return 0U;
+	}
+
+	return (int32_t)(announced_ticks() - q->tick) + sys_clock_elapsed();
 }
 
-static int32_t next_timeout(int32_t ticks_elapsed)
+static int32_t next_timeout(struct timeout_queue *q, int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	int64_t dticks;
 	int32_t ret;
+	bool found = next_dticks(q, &dticks);
+
+#ifdef CONFIG_TIMESLICING
+	int64_t slice_dticks;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (next_slice_dticks(q, &slice_dticks) && (!found || (slice_dticks < dticks))) {
+		dticks = slice_dticks;
+		found = true;
+	}
+#endif /* CONFIG_TIMESLICING */
+
+	if (!found ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = SYS_CLOCK_MAX_WAIT;
 	} else {
-		ret = max(0, to->dticks - ticks_elapsed);
+		ret = max(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
@@ -98,6 +565,10 @@ static int32_t next_timeout(int32_t ticks_elapsed)
 
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
+	struct timeout_queue *q;
+	k_spinlock_key_t key;
+	int32_t ticks_elapsed;
+	bool has_elapsed = false;
 	k_ticks_t ticks = 0;
 
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
@@ -111,125 +582,159 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-		int32_t ticks_elapsed;
-		bool has_elapsed = false;
+	q = lock_curr_queue(&key);
 
-		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
-			ticks_elapsed = elapsed();
-			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
-		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	to->cpu = _current_cpu->id;
 
-			to->dticks = max(1, dticks);
-			ticks = timeout.ticks;
-		}
+	/* Nothing is relative to the tick of an idle queue, catch up */
+	if (queue_is_empty(q) && (q->announce_remaining == 0)) {
+		q->tick = announced_ticks();
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+	if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+		ticks_elapsed = elapsed(q);
+		has_elapsed = true;
+		to->dticks = timeout.ticks + 1 + ticks_elapsed;
+		ticks = q->tick + to->dticks;
+	} else {
+		k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - q->tick;
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		to->dticks = max(1, dticks);
+		ticks = timeout.ticks;
+	}
 
-		if (to == first() && announce_remaining == 0) {
-			if (!has_elapsed) {
-				/* In case of absolute timeout that is first to expire
-				 * elapsed need to be read from the system clock.
-				 */
-				ticks_elapsed = elapsed();
-			}
-			sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+	insert_timeout(q, to);
+
+	if (is_next_timeout(q, to) && q->announce_remaining == 0) {
+		if (!has_elapsed) {
+			/* In case of absolute timeout that is first to expire
+			 * elapsed need to be read from the system clock.
+			 */
+			ticks_elapsed = elapsed(q);
 		}
+		sys_clock_set_timeout(next_timeout(q, ticks_elapsed), false);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_timeout_queue(to, &key);
 	int ret = -EINVAL;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+	if (sys_dnode_is_linked(&to->node)) {
+		bool is_first = is_next_timeout(q, to);
 
-			remove_timeout(to);
-			to->dticks = TIMEOUT_DTICKS_ABORTED;
-			ret = 0;
-			if (is_first) {
-				sys_clock_set_timeout(next_timeout(elapsed()), false);
-			}
+		remove_timeout(q, to);
+		to->dticks = TIMEOUT_DTICKS_ABORTED;
+		ret = 0;
+
+		/* The timer of a remote CPU can't be reprogrammed from here,
+		 * it will just fire early and find nothing to expire.
+		 */
+		if (is_first && is_local_queue(q)) {
+			sys_clock_set_timeout(next_timeout(q, elapsed(q)), false);
 		}
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
+k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_timeout_queue(timeout, &key);
 	k_ticks_t ticks = 0;
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = timeout_rem(q, timeout) - elapsed(q);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
-k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
+k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_timeout_queue(timeout, &key);
+	k_ticks_t ticks = q->tick;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks += timeout_rem(q, timeout);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
-k_ticks_t z_timeout_expires(const struct _timeout *timeout)
+#ifdef CONFIG_TIMESLICING
+void z_set_slice_timeout(int32_t ticks)
 {
-	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_curr_queue(&key);
+	int32_t ticks_elapsed = elapsed(q);
+	int32_t next = next_timeout(q, ticks_elapsed);
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
-		}
+	slice_deadlines[_current_cpu->id] = q->tick + ticks_elapsed + ticks;
+
+	/* Only an earlier expiry needs the timer reprogrammed, a later one
+	 * just lets it fire and find nothing to expire yet.
+	 */
+	if ((q->announce_remaining == 0) &&
+	    ((next == K_TICKS_FOREVER) || (ticks < next))) {
+		sys_clock_set_timeout(ticks, false);
 	}
 
-	return ticks;
+	k_spin_unlock(&q->lock, key);
 }
 
+void z_clear_slice_timeout(void)
+{
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_curr_queue(&key);
+
+	slice_deadlines[_current_cpu->id] = 0U;
+
+	/* Left to fire early rather than reprogramming the timer */
+	k_spin_unlock(&q->lock, key);
+}
+#endif /* CONFIG_TIMESLICING */
+
 int32_t z_get_next_timeout_expiry(void)
 {
-	int32_t ret = (int32_t) K_TICKS_FOREVER;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_curr_queue(&key);
+	int32_t ret = next_timeout(q, elapsed(q));
+
+	k_spin_unlock(&q->lock, key);
 
-	K_SPINLOCK(&timeout_lock) {
-		ret = next_timeout(elapsed());
-	}
 	return ret;
 }
 
 void sys_clock_announce(int32_t ticks)
 {
-	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_curr_queue(&key);
+	int queued_ticks = ticks;
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	K_SPINLOCK(&clock_lock) {
+		curr_tick += ticks;
+		/* Also catch up with what other CPUs announced */
+		queued_ticks = (int)(curr_tick - q->tick);
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 
 	/* We release the lock around the callbacks below, so on SMP
 	 * systems someone might be already running the loop.  Don't
@@ -237,54 +742,92 @@ void sys_clock_announce(int32_t ticks)
 	 * timeouts and confuse apps), just increment the tick count
 	 * and return.
 	 */
-	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
-		announce_remaining += ticks;
-		k_spin_unlock(&timeout_lock, key);
+	if (IS_ENABLED(CONFIG_SMP) && (q->announce_remaining != 0)) {
+		q->announce_remaining += ticks;
+		k_spin_unlock(&q->lock, key);
 		return;
 	}
 
-	announce_remaining = ticks;
+	q->announce_remaining = queued_ticks;
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+	uint64_t next;
 
+	while ((next = wheel_next_event(q)) - q->tick <= (uint64_t)q->announce_remaining) {
+		int dt = next - q->tick;
+		struct _timeout *t;
+
+		q->tick = next;
+		wheel_cascade(q);
+
+		/* The event may only have been a cascade point */
+		t = wheel_pop_expired(q);
+		if (t != NULL) {
+			t->dticks = 0;
+
+			k_spin_unlock(&q->lock, key);
+			t->fn(t);
+			key = k_spin_lock(&q->lock);
+		}
+		q->announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
+	for (t = first(q);
+	     (t != NULL) && (t->dticks <= q->announce_remaining);
+	     t = first(q)) {
 		int dt = t->dticks;
 
-		curr_tick += dt;
+		q->tick += dt;
 		t->dticks = 0;
-		remove_timeout(t);
+		remove_timeout(q, t);
 
-		k_spin_unlock(&timeout_lock, key);
+		k_spin_unlock(&q->lock, key);
 		t->fn(t);
-		key = k_spin_lock(&timeout_lock);
-		announce_remaining -= dt;
+		key = k_spin_lock(&q->lock);
+		q->announce_remaining -= dt;
 	}
 
 	if (t != NULL) {
-		t->dticks -= announce_remaining;
+		t->dticks -= q->announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
-	curr_tick += announce_remaining;
-	announce_remaining = 0;
+	q->tick += q->announce_remaining;
+	q->announce_remaining = 0;
 
-	sys_clock_set_timeout(next_timeout(0), false);
+#ifdef CONFIG_TIMESLICING
+	uint32_t slices = expire_slices(q);
+#endif /* CONFIG_TIMESLICING */
 
-	k_spin_unlock(&timeout_lock, key);
+	sys_clock_set_timeout(next_timeout(q, 0), false);
+
+	k_spin_unlock(&q->lock, key);
 
 #ifdef CONFIG_TIMESLICING
+	for (unsigned int cpu = 0; slices != 0U; cpu++, slices >>= 1) {
+		if ((slices & BIT(0)) != 0U) {
+			z_time_slice_expired(cpu);
+		}
+	}
+
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_check();
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 }
 
 int64_t sys_clock_tick_get(void)
 {
-	uint64_t t = 0U;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_curr_queue(&key);
+	uint64_t t = q->tick + elapsed(q);
+
+	k_spin_unlock(&q->lock, key);
 
-	K_SPINLOCK(&timeout_lock) {
-		t = curr_tick + elapsed();
-	}
 	return t;
 }
 
@@ -293,7 +836,7 @@ uint32_t sys_clock_tick_get_32(void)
 #ifdef CONFIG_TICKLESS_KERNEL
 	return (uint32_t)sys_clock_tick_get();
 #else
-	return (uint32_t)curr_tick;
+	return (uint32_t)announced_ticks();
 #endif /* CONFIG_TICKLESS_KERNEL */
 }
 
@@ -350,7 +893,53 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
-	curr_tick = tick;
+	int64_t delta = (int64_t)(tick - announced_ticks());
+
+	for (unsigned int i = 0; i < NUM_TIMEOUT_QUEUES; i++) {
+		struct timeout_queue *q = &timeout_queues[i];
+
+		K_SPINLOCK(&q->lock) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+			/* Queued deadlines are absolute, shift them as well */
+			sys_dlist_t tmp;
+			sys_dnode_t *node;
+			struct _timeout *t;
+
+			sys_dlist_init(&tmp);
+			for (unsigned int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+				struct wheel_level *level = &q->wheel[lvl];
+
+				for (unsigned int idx = 0; idx < WHEEL_SLOTS; idx++) {
+					if ((level->pending & BIT(idx)) == 0U) {
+						continue;
+					}
+					while ((node = sys_dlist_get(&level->slot[idx])) != NULL) {
+						sys_dlist_append(&tmp, node);
+					}
+				}
+				level->pending = 0U;
+			}
+			while ((node = sys_dlist_get(&q->overflow)) != NULL) {
+				sys_dlist_append(&tmp, node);
+			}
+
+			SYS_DLIST_FOR_EACH_CONTAINER(&tmp, t, node) {
+				t->dticks += delta;
+			}
+
+			q->tick += delta;
+			wheel_requeue_list(q, &tmp);
+#else
+			q->tick += delta;
+#endif /* CONFIG_TIMEOUT_WHEEL */
+		}
+	}
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	K_SPINLOCK(&clock_lock) {
+		curr_tick = tick;
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
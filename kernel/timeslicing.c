@@ -7,12 +7,16 @@
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <timeout_q.h>
 
 static int slice_ticks = DIV_ROUND_UP(CONFIG_TIMESLICE_SIZE * Z_HZ_ticks, Z_HZ_ms);
 static int slice_max_prio = CONFIG_TIMESLICE_PRIORITY;
-static struct _timeout slice_timeouts[CONFIG_MP_MAX_NUM_CPUS];
 static bool slice_expired[CONFIG_MP_MAX_NUM_CPUS];
 
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+static bool slice_armed;
+#endif
+
 #ifdef CONFIG_SWAP_NONATOMIC
 /* If z_swap() isn't atomic, then it's possible for a timer interrupt
  * to try to timeslice away _current after it has already pended
@@ -51,12 +55,34 @@ bool thread_is_sliceable(struct k_thread *thread)
 	return ret;
 }
 
-static void slice_timeout(struct _timeout *timeout)
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+/* Whether the thread has to share its CPU with another of the same
+ * priority. Threads with their own slice are sliced regardless, their
+ * expiry callback having to be invoked.
+ */
+static bool slice_contended(struct k_thread *thread)
 {
-	int cpu = ARRAY_INDEX(slice_timeouts, timeout);
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+	if (thread->base.slice_ticks != 0) {
+		return true;
+	}
+#endif
+	return z_is_thread_queued(thread) &&
+	       _priq_run_has_peer(&_kernel.ready_q.runq, thread);
+}
+#else
+#define slice_contended(thread) true
+#endif /* CONFIG_TIMESLICE_CONTENDED_ONLY */
 
+/* Called by the timeout code once the slice of the CPU has ended */
+void z_time_slice_expired(int cpu)
+{
 	slice_expired[cpu] = true;
 
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+	slice_armed = false;
+#endif
+
 	/* We need an IPI if we just handled a timeslice expiration
 	 * for a different CPU.
 	 */
@@ -67,15 +93,32 @@ static void slice_timeout(struct _timeout *timeout)
 
 void z_reset_time_slice(struct k_thread *thread)
 {
-	int cpu = _current_cpu->id;
+	bool arm = thread_is_sliceable(thread) && slice_contended(thread);
 
-	z_abort_timeout(&slice_timeouts[cpu]);
-	slice_expired[cpu] = false;
-	if (thread_is_sliceable(thread)) {
-		z_add_timeout(&slice_timeouts[cpu], slice_timeout,
-			      K_TICKS(slice_time(thread) - 1));
+	slice_expired[_current_cpu->id] = false;
+	if (arm) {
+		z_set_slice_timeout(slice_time(thread));
+	} else {
+		z_clear_slice_timeout();
+	}
+
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+	slice_armed = arm;
+#endif
+}
+
+#ifdef CONFIG_TIMESLICE_CONTENDED_ONLY
+/* Called when the scheduler keeps running _current, which may have got a
+ * peer of the same priority meanwhile
+ */
+void z_time_slice_contend(void)
+{
+	if (!slice_armed && thread_is_sliceable(_current) && slice_contended(_current)) {
+		z_set_slice_timeout(slice_time(_current));
+		slice_armed = true;
 	}
 }
+#endif /* CONFIG_TIMESLICE_CONTENDED_ONLY */
 
 void k_sched_time_slice_set(int32_t slice, int prio)
 {
@@ -32,6 +32,18 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+static void usage_histogram_add(uint32_t *histogram, uint64_t cycles)
+{
+	uint32_t bucket;
+
+	cycles >>= CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_SHIFT;
+	bucket = find_msb_set((uint32_t)MIN(cycles, UINT32_MAX));
+
+	histogram[MIN(bucket, CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS - 1)]++;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -49,6 +61,11 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 			cpu->usage->longest = cpu->usage->current;
 		}
 	} else {
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+		if (cpu->usage->current != 0) {
+			usage_histogram_add(cpu->usage->run_histogram, cpu->usage->current);
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 		cpu->usage->current = 0;
 		cpu->usage->num_windows++;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
@@ -71,6 +88,38 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* The thread isn't running anywhere, so nothing races with this
+	 * write until z_sched_usage_start() consumes it.
+	 */
+	thread->base.usage.ready = usage_now();
+}
+
+static void sched_usage_wakeup(struct _cpu *cpu, struct k_thread *thread)
+{
+	uint32_t latency;
+
+	if (thread->base.usage.ready == 0) {
+		return;
+	}
+
+	latency = cpu->usage0 - thread->base.usage.ready;
+	thread->base.usage.ready = 0;
+
+	if (thread->base.usage.track_usage) {
+		usage_histogram_add(thread->base.usage.wakeup_histogram, latency);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage) {
+		usage_histogram_add(cpu->usage->wakeup_histogram, latency);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -80,6 +129,10 @@ void z_sched_usage_start(struct k_thread *thread)
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	sched_usage_wakeup(_current_cpu, thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
@@ -94,6 +147,10 @@ void z_sched_usage_start(struct k_thread *thread)
 
 	_current_cpu->usage0 = usage_now();
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_start(thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 }
 
 void z_sched_usage_stop(void)
@@ -109,15 +166,50 @@ void z_sched_usage_stop(void)
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+			usage_histogram_add(cpu->current->base.usage.run_histogram,
+					    cpu->current->base.usage.current);
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		z_sched_cbs_stop(cpu->current, cycles);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 	}
 
 	cpu->usage0 = 0;
 	k_spin_unlock(&usage_lock, k);
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+void z_sched_usage_cbs_sync(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&usage_lock);
+	struct _cpu *cpu = _current_cpu;
+
+	if (cpu->usage0 != 0) {
+		uint32_t now = usage_now();
+		uint32_t cycles = now - cpu->usage0;
+
+		/* Same bookkeeping as z_sched_cpu_usage(), so the thread
+		 * and CPU statistics stay consistent.
+		 */
+		if (cpu->current->base.usage.track_usage) {
+			sched_thread_update_usage(cpu->current, cycles);
+		}
+
+		sched_cpu_update_usage(cpu, cycles);
+		z_sched_cbs_stop(cpu->current, cycles);
+
+		cpu->usage0 = now;
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 {
@@ -160,6 +252,13 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	memcpy(stats->run_histogram, cpu->usage->run_histogram,
+	       sizeof(stats->run_histogram));
+	memcpy(stats->wakeup_histogram, cpu->usage->wakeup_histogram,
+	       sizeof(stats->wakeup_histogram));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -216,6 +315,13 @@ void z_sched_thread_usage(struct k_thread *thread,
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	memcpy(stats->run_histogram, thread->base.usage.run_histogram,
+	       sizeof(stats->run_histogram));
+	memcpy(stats->wakeup_histogram, thread->base.usage.wakeup_histogram,
+	       sizeof(stats->wakeup_histogram));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -381,6 +487,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+	memset(stats->run_histogram, 0, sizeof(stats->run_histogram));
+	memset(stats->wakeup_histogram, 0, sizeof(stats->wakeup_histogram));
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
 
 	if (thread != _current_cpu->current) {
 
@@ -169,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	struct rbnode node;
 
 	/* The object itself */
 	void *data;
@@ -184,9 +185,23 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+static bool node_lessthan(struct rbnode *a, struct rbnode *b);
+
+/*
+ * Red/black tree of allocated kernel objects, keyed by object address,
+ * for fast lookups.
+ */
+static struct rbtree obj_rb_tree = {
+	.lessthan_fn = node_lessthan
+};
+
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Bumped whenever a dynamic object is released, which invalidates the
+ * lookup caches of all threads at once.
  */
+static atomic_t obj_cache_gen;
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -222,31 +237,70 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
+static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct dyn_obj *dyn_a = CONTAINER_OF(a, struct dyn_obj, node);
+	struct dyn_obj *dyn_b = CONTAINER_OF(b, struct dyn_obj, node);
+
+	return (uintptr_t)dyn_a->kobj.name < (uintptr_t)dyn_b->kobj.name;
+}
+
+/* Remove a dynamic object from the list and the lookup tree */
+static void dyn_object_unlink(struct dyn_obj *dyn)
+{
+	rb_remove(&obj_rb_tree, &dyn->node);
+	sys_dlist_remove(&dyn->dobj_list);
+
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	atomic_inc(&obj_cache_gen);
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
+}
+
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
-	struct dyn_obj *node;
+	struct rbnode *node;
+	struct dyn_obj *dyn = NULL;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
-		if (node->kobj.name == obj) {
-			goto end;
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	struct k_thread *thread = k_is_pre_kernel() ? NULL : _current;
+
+	if ((thread != NULL) && (thread->dyn_obj_cache.obj == obj) &&
+	    (thread->dyn_obj_cache.gen == (uint32_t)atomic_get(&obj_cache_gen))) {
+		dyn = thread->dyn_obj_cache.dyn;
+		goto end;
+	}
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
+
+	/* Objects are ordered by address, walk down the tree the same way
+	 * rb_contains() does but comparing against the looked up address.
+	 */
+	node = obj_rb_tree.root;
+	while (node != NULL) {
+		struct dyn_obj *cur = CONTAINER_OF(node, struct dyn_obj, node);
+
+		if (cur->kobj.name == obj) {
+			dyn = cur;
+			break;
 		}
+
+		node = z_rb_child(node, ((uintptr_t)cur->kobj.name < (uintptr_t)obj) ? 1U : 0U);
 	}
 
-	/* No object found */
-	node = NULL;
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	if ((thread != NULL) && (dyn != NULL)) {
+		thread->dyn_obj_cache.obj = obj;
+		thread->dyn_obj_cache.dyn = dyn;
+		thread->dyn_obj_cache.gen = (uint32_t)atomic_get(&obj_cache_gen);
+	}
 
- end:
+end:
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
 	k_spin_unlock(&lists_lock, key);
 
-	return node;
+	return dyn;
 }
 
 /**
@@ -377,6 +431,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	rb_insert(&obj_rb_tree, &dyn->node);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -470,7 +525,10 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		sys_dlist_remove(&dyn->dobj_list);
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+		dyn_object_unlink(dyn);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -561,7 +619,10 @@ static unsigned int thread_index_get(struct k_thread *thread)
 	return ko->data.thread_id;
 }
 
-static void unref_check(struct k_object *ko, uintptr_t index)
+/* Dynamic objects are unlinked from the lists, so the caller must hold
+ * lists_lock, which is always taken before obj_lock.
+ */
+static void unref_check_locked(struct k_object *ko, uintptr_t index)
 {
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
@@ -602,7 +663,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
-	sys_dlist_remove(&dyn->dobj_list);
+	dyn_object_unlink(dyn);
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -610,6 +671,18 @@ out:
 	k_spin_unlock(&obj_lock, key);
 }
 
+static void unref_check(struct k_object *ko, uintptr_t index)
+{
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
+
+	unref_check_locked(ko, index);
+	k_spin_unlock(&lists_lock, key);
+#else
+	unref_check_locked(ko, index);
+#endif /* CONFIG_DYNAMIC_OBJECTS */
+}
+
 static void wordlist_cb(struct k_object *ko, void *ctx_ptr)
 {
 	struct perm_ctx *ctx = (struct perm_ctx *)ctx_ptr;
@@ -652,11 +725,14 @@ void k_thread_perms_clear(struct k_object *ko, struct k_thread *thread)
 	}
 }
 
+/* Called by k_object_wordlist_foreach(), with lists_lock held for the
+ * dynamic objects. Static objects are never unlinked.
+ */
 static void clear_perms_cb(struct k_object *ko, void *ctx_ptr)
 {
 	uintptr_t id = (uintptr_t)ctx_ptr;
 
-	unref_check(ko, id);
+	unref_check_locked(ko, id);
 }
 
 void k_thread_perms_all_clear(struct k_thread *thread)
@@ -192,6 +192,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->flushed = work;
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -238,6 +241,49 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+static inline struct k_work_pool *queue_pool(struct k_work_q *queue)
+{
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_POOL_BIT)) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(queue, struct k_work_pool, queue);
+}
+
+static inline struct k_thread *pool_thread(struct k_work_pool *pool,
+					   unsigned int i)
+{
+	return (i == 0U) ? &pool->queue.thread : &pool->threads[i - 1U];
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+/* Test whether the current thread animates a queue.
+ *
+ * @param queue the queue to be tested.
+ *
+ * @return true if and only if the current thread is the queue thread, or
+ * one of the worker threads if the queue belongs to a pool.
+ */
+static bool queue_thread_is_current(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_pool *pool = queue_pool(queue);
+
+	if (pool != NULL) {
+		for (unsigned int i = 0; i < pool->num_threads; i++) {
+			if (_current == pool_thread(pool, i)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return _current == queue->thread_id;
+}
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -252,20 +298,24 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
  *
  * @param work to be submitted
  *
+ * @param notify whether the queue should be notified of the new work.  If
+ * false the caller is responsible for notifying the queue.
+ *
  * @retval 1 if successfully queued
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  * @retval -EBUSY if the submission was rejected (draining, plugged)
  */
 static inline int queue_submit_locked(struct k_work_q *queue,
-				      struct k_work *work)
+				      struct k_work *work,
+				      bool notify)
 {
 	if (queue == NULL) {
 		return -EINVAL;
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_thread_is_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -285,7 +335,9 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
 		ret = 1;
-		(void)notify_queue_locked(queue);
+		if (notify) {
+			(void)notify_queue_locked(queue);
+		}
 	}
 
 	return ret;
@@ -317,8 +369,9 @@ static inline int queue_submit_locked(struct k_work_q *queue,
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  */
-static int submit_to_queue_locked(struct k_work *work,
-				  struct k_work_q **queuep)
+static int submit_to_queue_notify_locked(struct k_work *work,
+					 struct k_work_q **queuep,
+					 bool notify)
 {
 	int ret = 0;
 
@@ -345,7 +398,7 @@ static int submit_to_queue_locked(struct k_work *work,
 			ret = 2;
 		}
 
-		int rc = queue_submit_locked(*queuep, work);
+		int rc = queue_submit_locked(*queuep, work, notify);
 
 		if (rc < 0) {
 			ret = rc;
@@ -364,6 +417,18 @@ static int submit_to_queue_locked(struct k_work *work,
 	return ret;
 }
 
+/* Attempt to submit work to a queue, notifying the queue on success.
+ *
+ * Invoked with work lock held.
+ *
+ * See submit_to_queue_notify_locked().
+ */
+static inline int submit_to_queue_locked(struct k_work *work,
+					 struct k_work_q **queuep)
+{
+	return submit_to_queue_notify_locked(work, queuep, true);
+}
+
 /* Submit work to a queue but do not yield the current thread.
  *
  * Intended for internal use.
@@ -422,6 +487,61 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+int k_work_submit_batch_to_queue(struct k_work_q *queue,
+				 struct k_work *const *works, size_t count)
+{
+	__ASSERT_NO_MSG((works != NULL) || (count == 0U));
+
+	bool notify = false;
+	int queued = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_work *work = works[i];
+		struct k_work_q *wq = queue;
+
+		__ASSERT_NO_MSG(work != NULL);
+		__ASSERT_NO_MSG(work->handler != NULL);
+
+		if (submit_to_queue_notify_locked(work, &wq, false) <= 0) {
+			continue;
+		}
+
+		queued++;
+
+		/* Items running on, or last submitted to, another queue
+		 * are rare: notify that queue right away, and the
+		 * requested one only once all items are linked.
+		 */
+		if (wq != queue) {
+			(void)notify_queue_locked(wq);
+		} else if (IS_ENABLED(CONFIG_WORKQUEUE_POOL) &&
+			   flag_test(&queue->flags, K_WORK_QUEUE_POOL_BIT)) {
+			/* Wake up one idle worker per item */
+			(void)notify_queue_locked(queue);
+		} else {
+			notify = true;
+		}
+	}
+
+	if (notify) {
+		(void)notify_queue_locked(queue);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return queued;
+}
+
+int k_work_submit_batch(struct k_work *const *works, size_t count)
+{
+	return k_work_submit_batch_to_queue(&k_sys_work_q, works, count);
+}
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -648,6 +768,84 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+/* Take the next work item to be processed off a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * In a pool, work items that are running on another worker, and flushers
+ * of such items, are left on the queue: they are picked up by that worker
+ * once the item completes.
+ *
+ * @param queue the queue from which work should be taken
+ *
+ * @return the work item to be processed, or NULL if none is available.
+ */
+static struct k_work *queue_get_locked(struct k_work_q *queue)
+{
+	sys_snode_t *node;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_pool(queue) != NULL) {
+		sys_snode_t *prev = NULL;
+
+		SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+			struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+			struct k_work *busy = work;
+
+			if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+				busy = CONTAINER_OF(work, struct z_work_flusher,
+						    work)->flushed;
+			}
+
+			if (!flag_test(&busy->flags, K_WORK_RUNNING_BIT)) {
+				sys_slist_remove(&queue->pending, prev, node);
+				return work;
+			}
+
+			prev = node;
+		}
+
+		return NULL;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	node = sys_slist_get(&queue->pending);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct k_work, node) : NULL;
+}
+
+/* Account for a queue thread starting or completing a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * The queue is busy as long as at least one of its threads is running a
+ * work item.
+ *
+ * @param queue the queue of the thread
+ * @param busy true if a work item is starting, false if it completed
+ */
+static inline void queue_busy_update_locked(struct k_work_q *queue, bool busy)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_pool *pool = queue_pool(queue);
+
+	if (pool != NULL) {
+		if (busy) {
+			pool->num_busy++;
+		} else {
+			pool->num_busy--;
+		}
+		busy = (pool->num_busy != 0U);
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	if (busy) {
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -658,44 +856,34 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	ARG_UNUSED(p3);
 
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+	unsigned int batch = 0U;
+	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
-		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_get_locked(queue);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
+			queue_busy_update_locked(queue, true);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
 
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
-			 * drain to ready state.  The held spinlock inhibits
-			 * immediate reschedule; released threads get their
-			 * chance when this invokes z_sched_wait() below.
+			 * drain to ready state.  Only pools can be busy here,
+			 * when other workers are running items.  The held
+			 * spinlock inhibits immediate reschedule; released
+			 * threads get their chance when this invokes
+			 * z_sched_wait() below.
 			 *
 			 * We don't touch K_WORK_QUEUE_PLUGGABLE, so getting
 			 * here doesn't mean that the queue will allow new
@@ -724,6 +912,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 			(void)z_sched_wait(&lock, key, &queue->notifyq,
 					   K_FOREVER, NULL);
+			batch = 0U;
+			key = k_spin_lock(&lock);
 			continue;
 		}
 
@@ -755,7 +945,19 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_busy_update_locked(queue, false);
+
+		/* Keep the lock and pick up the next pending item right
+		 * away, until CONFIG_WORKQUEUE_BATCH_SIZE items have been
+		 * handled in a row.
+		 */
+		batch++;
+		if ((batch < CONFIG_WORKQUEUE_BATCH_SIZE) &&
+		    !sys_slist_is_empty(&queue->pending)) {
+			continue;
+		}
+
+		batch = 0U;
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -765,6 +967,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		if (yield) {
 			k_yield();
 		}
+
+		key = k_spin_lock(&lock);
 	}
 }
 
@@ -863,6 +1067,70 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_pool_start(struct k_work_pool *pool, int prio,
+		       const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(pool->stacks);
+	__ASSERT_NO_MSG(pool->num_threads > 0U);
+
+	struct k_work_q *queue = &pool->queue;
+	uintptr_t stack_len = K_THREAD_STACK_LEN(pool->stack_size);
+	uint32_t flags = K_WORK_QUEUE_STARTED | K_WORK_QUEUE_POOL;
+
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	sys_slist_init(&queue->pending);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+	pool->num_busy = 0U;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+	flags_set(&queue->flags, flags);
+
+#if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
+	/* A single timeout record can't track several workers */
+	queue->work_timeout = K_FOREVER;
+#endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+	for (unsigned int i = 0; i < pool->num_threads; i++) {
+		struct k_thread *thread = pool_thread(pool, i);
+
+		(void)k_thread_create(thread, &pool->stacks[stack_len * i],
+				      pool->stack_size, work_queue_main,
+				      queue, NULL, NULL, prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(thread, cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			thread->base.user_options |= K_ESSENTIAL;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((cfg != NULL) && cfg->pin_cpus) {
+			(void)k_thread_cpu_pin(thread, i % arch_num_cpus());
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+	}
+
+	queue->thread_id = &queue->thread;
+
+	for (unsigned int i = 0; i < pool->num_threads; i++) {
+		k_thread_start(pool_thread(pool, i));
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -921,7 +1189,8 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, stop, queue, timeout);
 
-	if (z_is_thread_essential(&queue->thread)) {
+	if (z_is_thread_essential(&queue->thread) ||
+	    flag_test(&queue->flags, K_WORK_QUEUE_POOL_BIT)) {
 		return -ENOTSUP;
 	}
 
@@ -0,0 +1,391 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Swiss Table style Open-Addressing Hashmap.
+ *
+ * Buckets are gathered in groups of GROUP_WIDTH slots that are probed
+ * together. Each group starts with one control byte per slot, holding
+ * either CONTROL_EMPTY or the 7 low bits of the hash of the key stored in
+ * the slot. All control bytes of a group are compared against a key at once
+ * with SIMD-within-a-register arithmetic, so only the slots which are likely
+ * to match have their key loaded.
+ *
+ * Rather than leaving tombstones behind on removal, each group counts the
+ * entries which were stored further along their probe sequence because it
+ * was full at the time. A lookup stops at the first group not overflowed,
+ * and removing an entry walks its probe sequence again to drop these counts,
+ * so removed slots become empty right away and never need purging.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#define GROUP_WIDTH   8
+#define CONTROL_EMPTY 0x80
+#define CONTROL_BITS  7
+
+#define BYTES_LSB 0x0101010101010101ULL
+#define BYTES_MSB 0x8080808080808080ULL
+
+struct swiss_slot {
+	uint64_t key;
+	uint64_t value;
+};
+
+struct swiss_group {
+	/* control byte of slot i in bits [8 * i, 8 * i + 7] */
+	uint64_t control;
+	/* number of entries whose probe sequence went past this group */
+	uint32_t overflow;
+	struct swiss_slot slots[GROUP_WIDTH];
+};
+
+/* Triangular probing, which visits every group since their number is a power of 2 */
+struct swiss_probe {
+	size_t group;
+	size_t step;
+	size_t mask;
+};
+
+static inline void swiss_probe_start(struct swiss_probe *probe, uint32_t hash, size_t n_groups)
+{
+	probe->mask = n_groups - 1;
+	probe->group = (hash >> CONTROL_BITS) & probe->mask;
+	probe->step = 0;
+}
+
+static inline void swiss_probe_next(struct swiss_probe *probe)
+{
+	++probe->step;
+	probe->group = (probe->group + probe->step) & probe->mask;
+}
+
+static inline uint8_t swiss_control(uint32_t hash)
+{
+	return hash & BIT_MASK(CONTROL_BITS);
+}
+
+/*
+ * Flag the slots whose control byte equals @p control. A byte right above a
+ * match may be flagged as well, which is harmless as keys are compared anyway.
+ */
+static inline uint64_t swiss_match(uint64_t group_control, uint8_t control)
+{
+	uint64_t x = group_control ^ (BYTES_LSB * control);
+
+	return (x - BYTES_LSB) & ~x & BYTES_MSB;
+}
+
+static inline uint64_t swiss_match_empty(uint64_t group_control)
+{
+	return group_control & BYTES_MSB;
+}
+
+static inline unsigned int swiss_first(uint64_t match)
+{
+	return u64_count_trailing_zeros(match) / BITS_PER_BYTE;
+}
+
+static inline size_t swiss_n_groups(const struct sys_hashmap *map)
+{
+	return map->data->n_buckets / GROUP_WIDTH;
+}
+
+static struct swiss_group *sys_hashmap_swiss_find(const struct sys_hashmap *map, uint64_t key,
+						  uint32_t hash, unsigned int *slot)
+{
+	struct swiss_probe probe;
+	const size_t n_groups = swiss_n_groups(map);
+	struct swiss_group *const groups = map->data->buckets;
+
+	if (n_groups == 0) {
+		return NULL;
+	}
+
+	for (swiss_probe_start(&probe, hash, n_groups); probe.step < n_groups;
+	     swiss_probe_next(&probe)) {
+		struct swiss_group *group = &groups[probe.group];
+		uint64_t match = swiss_match(group->control, swiss_control(hash));
+
+		for (; match != 0; match &= match - 1) {
+			unsigned int i = swiss_first(match);
+
+			if (group->slots[i].key == key) {
+				*slot = i;
+				return group;
+			}
+		}
+
+		if (group->overflow == 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static int sys_hashmap_swiss_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					      uint64_t value, uint64_t *old_value)
+{
+	uint64_t empty;
+	unsigned int i;
+	struct swiss_probe probe;
+	struct swiss_group *group;
+	const size_t n_groups = swiss_n_groups(map);
+	struct swiss_group *const groups = map->data->buckets;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	group = sys_hashmap_swiss_find(map, key, hash, &i);
+	if (group != NULL) {
+		if (old_value != NULL) {
+			*old_value = group->slots[i].value;
+		}
+
+		group->slots[i].value = value;
+
+		return 0;
+	}
+
+	for (swiss_probe_start(&probe, hash, n_groups);; swiss_probe_next(&probe)) {
+		__ASSERT(probe.step < n_groups, "No empty slot left");
+
+		group = &groups[probe.group];
+		empty = swiss_match_empty(group->control);
+		if (empty != 0) {
+			break;
+		}
+
+		++group->overflow;
+	}
+
+	i = swiss_first(empty);
+	group->control &= ~((uint64_t)BIT_MASK(BITS_PER_BYTE) << (i * BITS_PER_BYTE));
+	group->control |= (uint64_t)swiss_control(hash) << (i * BITS_PER_BYTE);
+	group->slots[i].key = key;
+	group->slots[i].value = value;
+	++map->data->size;
+
+	return 1;
+}
+
+static int sys_hashmap_swiss_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_groups;
+	size_t new_n_buckets = 0;
+	struct swiss_group *group;
+	struct swiss_group *old_groups;
+	struct swiss_group *new_groups;
+	struct sys_hashmap_data *data = map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
+		return 0;
+	}
+
+	/* groups are never split, so do not shrink below one */
+	if (new_n_buckets != 0) {
+		new_n_buckets = MAX(new_n_buckets, GROUP_WIDTH);
+	}
+
+	if (new_n_buckets == data->n_buckets) {
+		return 0;
+	}
+
+	if (data->size != SIZE_MAX && data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* extract all entries from the hashmap */
+	old_size = data->size;
+	old_n_groups = swiss_n_groups(map);
+	old_groups = (struct swiss_group *)data->buckets;
+
+	new_groups = (struct swiss_group *)map->alloc_func(
+		NULL, (new_n_buckets / GROUP_WIDTH) * sizeof(*group));
+	if (new_groups == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	/* ensure all slots are empty and no group is overflowed */
+	for (size_t i = 0; i < new_n_buckets / GROUP_WIDTH; ++i) {
+		new_groups[i].control = BYTES_MSB;
+		new_groups[i].overflow = 0;
+	}
+
+	data->size = 0;
+	data->buckets = new_groups;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_groups && j < old_size; ++i) {
+		group = &old_groups[i];
+
+		for (uint64_t used = ~group->control & BYTES_MSB; used != 0; used &= used - 1) {
+			struct swiss_slot *slot = &group->slots[swiss_first(used)];
+
+			sys_hashmap_swiss_insert_no_rehash(map, slot->key, slot->value, NULL);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_groups, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct swiss_group *group;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct swiss_group *groups = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = NULL;
+	}
+
+	/* the state is the index of the next slot to look at */
+	i = POINTER_TO_UINT(it->state);
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		group = &groups[i / GROUP_WIDTH];
+		if ((group->control & BIT64((i % GROUP_WIDTH) * BITS_PER_BYTE + CONTROL_BITS)) ==
+		    0) {
+			it->state = UINT_TO_POINTER(i + 1);
+			it->key = group->slots[i % GROUP_WIDTH].key;
+			it->value = group->slots[i % GROUP_WIDTH].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss Table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct swiss_group *group;
+	struct sys_hashmap_data *data = map->data;
+	struct swiss_group *groups = data->buckets;
+
+	for (size_t i = 0; cb != NULL && i < swiss_n_groups(map); ++i) {
+		group = &groups[i];
+
+		for (uint64_t used = ~group->control & BYTES_MSB; used != 0; used &= used - 1) {
+			struct swiss_slot *slot = &group->slots[swiss_first(used)];
+
+			cb(slot->key, slot->value, cookie);
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static inline int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					   uint64_t *old_value)
+{
+	int ret;
+
+	ret = sys_hashmap_swiss_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sys_hashmap_swiss_insert_no_rehash(map, key, value, old_value);
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	unsigned int i;
+	struct swiss_probe probe;
+	struct swiss_group *group;
+	struct swiss_group *const groups = map->data->buckets;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	group = sys_hashmap_swiss_find(map, key, hash, &i);
+	if (group == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = group->slots[i].value;
+	}
+
+	/* the groups the entry went past are no longer overflowed by it */
+	for (swiss_probe_start(&probe, hash, swiss_n_groups(map)); &groups[probe.group] != group;
+	     swiss_probe_next(&probe)) {
+		__ASSERT_NO_MSG(groups[probe.group].overflow > 0);
+		--groups[probe.group].overflow;
+	}
+
+	group->control |= (uint64_t)CONTROL_EMPTY << (i * BITS_PER_BYTE);
+	--map->data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_swiss_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	unsigned int i;
+	struct swiss_group *group;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	group = sys_hashmap_swiss_find(map, key, hash, &i);
+	if (group == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = group->slots[i].value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
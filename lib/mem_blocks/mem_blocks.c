@@ -24,7 +24,19 @@ static void *alloc_blocks(sys_mem_blocks_t *mem_block, size_t num_blocks)
 #endif
 
 	/* Find an unallocated block */
+#ifdef CONFIG_SYS_MEM_BLOCKS_CPU_HINTS
+	/* Each CPU carries on from where it allocated last, the pointer is
+	 * only used as a hint so being moved to another CPU does not matter.
+	 */
+	uint32_t *hint = &mem_block->alloc_hint[arch_curr_cpu()->id];
+
+	r = sys_bitarray_alloc_hint(mem_block->bitmap, num_blocks, *hint, &offset);
+	if (r == 0) {
+		*hint = (uint32_t)(offset + num_blocks);
+	}
+#else
 	r = sys_bitarray_alloc(mem_block->bitmap, num_blocks, &offset);
+#endif
 	if (r != 0) {
 #ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
 		k_spin_unlock(&mem_block->lock, key);
@@ -183,6 +183,81 @@ const struct net_buf_data_cb net_buf_fixed_cb = {
 	.unref = fixed_data_unref,
 };
 
+/* The data of slab pools is preceded by its ref-count, and by the index of
+ * its size class.
+ */
+static uint8_t *slab_data_alloc(struct net_buf *buf, size_t *size,
+				k_timeout_t timeout)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	const struct net_buf_pool_slabs *classes = buf_pool->alloc->alloc_data;
+	size_t needed = GET_ALIGN(buf_pool) + *size;
+	struct k_mem_slab *slab;
+	int best = -1;
+	uint8_t *hdr;
+	void *b = NULL;
+	int i;
+
+	/* Take the smallest fitting class with a free block */
+	for (i = 0; i < classes->count; i++) {
+		slab = classes->slabs[i];
+		if (slab->info.block_size < needed) {
+			continue;
+		}
+
+		if (best < 0) {
+			best = i;
+		}
+
+		if (k_mem_slab_alloc(slab, &b, K_NO_WAIT) == 0) {
+			break;
+		}
+	}
+
+	if (b == NULL) {
+		if (best < 0) {
+			NET_BUF_DBG("Requested size %zu is larger than any class",
+				    *size);
+			return NULL;
+		}
+
+		i = best;
+		slab = classes->slabs[i];
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    k_mem_slab_alloc(slab, &b, timeout) != 0) {
+			return NULL;
+		}
+	}
+
+	hdr = b;
+	hdr[0] = 1U;
+	hdr[1] = (uint8_t)i;
+
+	*size = slab->info.block_size - GET_ALIGN(buf_pool);
+
+	return hdr + GET_ALIGN(buf_pool);
+}
+
+static void slab_data_unref(struct net_buf *buf, uint8_t *data)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	const struct net_buf_pool_slabs *classes = buf_pool->alloc->alloc_data;
+	uint8_t *hdr;
+
+	hdr = data - GET_ALIGN(buf_pool);
+	if (--hdr[0]) {
+		return;
+	}
+
+	k_mem_slab_free(classes->slabs[hdr[1]], hdr);
+}
+
+const struct net_buf_data_cb net_buf_slab_cb = {
+	.alloc = slab_data_alloc,
+	.ref   = generic_data_ref,
+	.unref = slab_data_unref,
+};
+
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 
 static uint8_t *heap_data_alloc(struct net_buf *buf, size_t *size,
@@ -241,6 +316,135 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+#if defined(CONFIG_NET_BUF_POOL_PER_CPU_CACHE)
+/* Number of buffers flushed at once from a full CPU cache to the pool */
+#define CACHE_BATCH MAX(CONFIG_NET_BUF_POOL_PER_CPU_CACHE_SIZE / 2, 1)
+
+/*
+ * Per-CPU caches of free buffers: buffers freed on a CPU are kept in its
+ * cache, under its own uncontended lock, and the next allocations on that
+ * CPU are served from there. Interrupts are kept locked so that the current
+ * CPU doesn't change. A full cache is flushed CACHE_BATCH buffers at a time
+ * to the free LIFO.
+ *
+ * A thread about to wait for a buffer first raises pool->waiters and then
+ * reclaims all caches, after which frees bypass the caches so that the
+ * buffer reaches the waiter.
+ */
+static struct net_buf *cache_get(struct net_buf_pool *pool)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct net_buf_pool_cache *cache = &pool->cache[arch_curr_cpu()->id];
+	struct net_buf *buf = NULL;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+	if (cache->count > 0U) {
+		buf = cache->bufs[--cache->count];
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	arch_irq_unlock(irq_key);
+
+	return buf;
+}
+
+/* Put a list of buffers back to the free LIFO with a single operation */
+static void cache_flush(struct net_buf_pool *pool, struct net_buf **bufs,
+			uint16_t count)
+{
+	for (uint16_t i = 0; i < count; i++) {
+		bufs[i]->node.next = (i + 1 < count) ? &bufs[i + 1]->node : NULL;
+	}
+
+	(void)k_queue_append_list(&pool->free._queue, bufs[0], bufs[count - 1]);
+}
+
+void z_net_buf_pool_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct net_buf_pool_cache *cache = &pool->cache[arch_curr_cpu()->id];
+	struct net_buf *batch[CACHE_BATCH];
+	uint16_t count = 0U;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+	if (atomic_get(&pool->waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		arch_irq_unlock(irq_key);
+		k_lifo_put(&pool->free, buf);
+		return;
+	}
+
+	if (cache->count == CONFIG_NET_BUF_POOL_PER_CPU_CACHE_SIZE) {
+		while (count < CACHE_BATCH) {
+			batch[count++] = cache->bufs[--cache->count];
+		}
+	}
+	cache->bufs[cache->count++] = buf;
+	k_spin_unlock(&cache->lock, key);
+
+	arch_irq_unlock(irq_key);
+
+	if (count > 0U) {
+		cache_flush(pool, batch, count);
+	}
+}
+
+/* Move all cached buffers back to the free LIFO */
+static void cache_reclaim(struct net_buf_pool *pool)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct net_buf_pool_cache *cache = &pool->cache[i];
+		struct net_buf *batch[CONFIG_NET_BUF_POOL_PER_CPU_CACHE_SIZE];
+		uint16_t count;
+		k_spinlock_key_t key;
+
+		key = k_spin_lock(&cache->lock);
+		count = cache->count;
+		memcpy(batch, cache->bufs, count * sizeof(batch[0]));
+		cache->count = 0U;
+		k_spin_unlock(&cache->lock, key);
+
+		if (count > 0U) {
+			cache_flush(pool, batch, count);
+		}
+	}
+}
+
+/* Get a buffer from the free LIFO, reclaiming the buffers cached by all CPUs
+ * before waiting.
+ */
+static struct net_buf *pool_get(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	buf = k_lifo_get(&pool->free, K_NO_WAIT);
+	if (buf != NULL) {
+		return buf;
+	}
+
+	atomic_inc(&pool->waiters);
+	cache_reclaim(pool);
+	buf = k_lifo_get(&pool->free, timeout);
+	atomic_dec(&pool->waiters);
+
+	return buf;
+}
+#else
+static inline struct net_buf *cache_get(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+
+	return NULL;
+}
+
+static inline struct net_buf *pool_get(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+	return k_lifo_get(&pool->free, timeout);
+}
+#endif /* CONFIG_NET_BUF_POOL_PER_CPU_CACHE */
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -258,6 +462,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+	buf = cache_get(pool);
+	if (buf) {
+		goto success;
+	}
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -293,7 +502,7 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
-		buf = k_lifo_get(&pool->free, K_NO_WAIT);
+		buf = pool_get(pool, K_NO_WAIT);
 		while (!buf) {
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 			NET_BUF_WARN("%s():%d: Pool %s low on buffers.",
@@ -302,7 +511,7 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 			NET_BUF_WARN("%s():%d: Pool %p low on buffers.",
 				     func, line, pool);
 #endif
-			buf = k_lifo_get(&pool->free, WARN_ALLOC_INTERVAL);
+			buf = pool_get(pool, WARN_ALLOC_INTERVAL);
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 			NET_BUF_WARN("%s():%d: Pool %s blocked for %u secs",
 				     func, line, pool->name,
@@ -314,10 +523,10 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #endif
 		}
 	} else {
-		buf = k_lifo_get(&pool->free, timeout);
+		buf = pool_get(pool, timeout);
 	}
 #else
-	buf = k_lifo_get(&pool->free, timeout);
+	buf = pool_get(pool, timeout);
 #endif
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/cache.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#define OP_NUM (SYS_CACHE_BATCH_INVD + 1)
+
+void sys_cache_batch_init(struct sys_cache_batch *batch, struct sys_cache_batch_range *ranges,
+			  size_t max_ranges)
+{
+	batch->ranges = ranges;
+	batch->max = max_ranges;
+	batch->num = 0;
+}
+
+int sys_cache_batch_add(struct sys_cache_batch *batch, enum sys_cache_batch_op op, void *addr,
+			size_t size)
+{
+	uintptr_t start = (uintptr_t)addr;
+	uintptr_t end = start + size;
+	struct sys_cache_batch_range *range;
+	size_t gap;
+	int ret;
+
+	if (op >= OP_NUM) {
+		return -EINVAL;
+	}
+
+	if (size == 0) {
+		return 0;
+	}
+
+	/* flushing the lines in between is harmless, invalidating them is not */
+	gap = (op == SYS_CACHE_BATCH_INVD) ? 0 : sys_cache_data_line_size_get();
+
+	for (size_t i = 0; i < batch->num; i++) {
+		range = &batch->ranges[i];
+
+		if (range->op != op || start > range->end + gap || range->start > end + gap) {
+			continue;
+		}
+
+		range->start = MIN(range->start, start);
+		range->end = MAX(range->end, end);
+
+		return 0;
+	}
+
+	if (batch->num == batch->max) {
+		ret = sys_cache_batch_commit(batch);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	batch->ranges[batch->num++] = (struct sys_cache_batch_range){
+		.start = start,
+		.end = end,
+		.op = op,
+	};
+
+	return 0;
+}
+
+static int range_op(const struct sys_cache_batch_range *range)
+{
+	void *addr = (void *)range->start;
+	size_t size = range->end - range->start;
+
+	switch (range->op) {
+	case SYS_CACHE_BATCH_FLUSH:
+		return sys_cache_data_flush_range(addr, size);
+	case SYS_CACHE_BATCH_FLUSH_AND_INVD:
+		return sys_cache_data_flush_and_invd_range(addr, size);
+	default:
+		return sys_cache_data_invd_range(addr, size);
+	}
+}
+
+int sys_cache_batch_commit(struct sys_cache_batch *batch)
+{
+	bool done[OP_NUM] = {false};
+	int ret = 0;
+	int err;
+
+#if CONFIG_CACHE_BATCH_WHOLE_CACHE_THRESHOLD > 0
+	size_t bytes[OP_NUM] = {0};
+
+	for (size_t i = 0; i < batch->num; i++) {
+		bytes[batch->ranges[i].op] += batch->ranges[i].end - batch->ranges[i].start;
+	}
+
+	/*
+	 * Invalidations stay line by line: writing back the whole cache could
+	 * overwrite data a DMA transfer just stored with stale dirty lines.
+	 */
+	if (bytes[SYS_CACHE_BATCH_FLUSH_AND_INVD] >= CONFIG_CACHE_BATCH_WHOLE_CACHE_THRESHOLD) {
+		ret = sys_cache_data_flush_and_invd_all();
+		done[SYS_CACHE_BATCH_FLUSH] = (ret == 0);
+		done[SYS_CACHE_BATCH_FLUSH_AND_INVD] = (ret == 0);
+	} else if (bytes[SYS_CACHE_BATCH_FLUSH] + bytes[SYS_CACHE_BATCH_FLUSH_AND_INVD] >=
+		   CONFIG_CACHE_BATCH_WHOLE_CACHE_THRESHOLD) {
+		ret = sys_cache_data_flush_all();
+		done[SYS_CACHE_BATCH_FLUSH] = (ret == 0);
+	}
+
+	/* fall back to the ranges if the whole cache cannot be maintained */
+	ret = 0;
+#endif
+
+	for (int op = 0; op < OP_NUM; op++) {
+		if (done[op]) {
+			continue;
+		}
+
+		for (size_t i = 0; i < batch->num; i++) {
+			if (batch->ranges[i].op != op) {
+				continue;
+			}
+
+			err = range_op(&batch->ranges[i]);
+			if (ret == 0) {
+				ret = err;
+			}
+		}
+	}
+
+	batch->num = 0;
+
+	return ret;
+}
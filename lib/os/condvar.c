@@ -0,0 +1,96 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/condvar.h>
+
+#ifdef CONFIG_USERSPACE
+int sys_condvar_init(struct sys_condvar *condvar)
+{
+	(void)atomic_set(&condvar->futex.val, 0);
+	(void)atomic_set(&condvar->waiters, 0);
+
+	return 0;
+}
+
+static int condvar_wake(struct sys_condvar *condvar, bool wake_all)
+{
+	int ret;
+
+	(void)atomic_inc(&condvar->futex.val);
+
+	/* Waiters are counted before they read the futex value, so either
+	 * they are seen here or they see the new value and do not wait.
+	 */
+	if (atomic_get(&condvar->waiters) == 0) {
+		return 0;
+	}
+
+	ret = k_futex_wake(&condvar->futex, wake_all);
+
+	return (ret < 0) ? ret : 0;
+}
+
+int sys_condvar_signal(struct sys_condvar *condvar)
+{
+	return condvar_wake(condvar, false);
+}
+
+int sys_condvar_broadcast(struct sys_condvar *condvar)
+{
+	return condvar_wake(condvar, true);
+}
+
+int sys_condvar_wait(struct sys_condvar *condvar, struct sys_mutex *mutex,
+		     k_timeout_t timeout)
+{
+	atomic_val_t seq;
+	int ret;
+
+	(void)atomic_inc(&condvar->waiters);
+	seq = atomic_get(&condvar->futex.val);
+
+	ret = sys_mutex_unlock(mutex);
+	if (ret == 0) {
+		ret = k_futex_wait(&condvar->futex, (int)seq, timeout);
+		(void)sys_mutex_lock(mutex, K_FOREVER);
+	}
+
+	(void)atomic_dec(&condvar->waiters);
+
+	if (ret == -ETIMEDOUT) {
+		return -EAGAIN;
+	} else if (ret == -EAGAIN) {
+		/* Signaled between the mutex unlock and the wait */
+		return 0;
+	}
+
+	return ret;
+}
+#else
+int sys_condvar_init(struct sys_condvar *condvar)
+{
+	return k_condvar_init(&condvar->kernel_condvar);
+}
+
+int sys_condvar_signal(struct sys_condvar *condvar)
+{
+	return k_condvar_signal(&condvar->kernel_condvar);
+}
+
+int sys_condvar_broadcast(struct sys_condvar *condvar)
+{
+	int ret = k_condvar_broadcast(&condvar->kernel_condvar);
+
+	return (ret < 0) ? ret : 0;
+}
+
+int sys_condvar_wait(struct sys_condvar *condvar, struct sys_mutex *mutex,
+		     k_timeout_t timeout)
+{
+	return k_condvar_wait(&condvar->kernel_condvar, &mutex->kernel_mutex,
+			      timeout);
+}
+#endif
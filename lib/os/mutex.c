@@ -9,6 +9,82 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+#define SYS_MUTEX_UNLOCKED	0
+#define SYS_MUTEX_LOCKED	1
+#define SYS_MUTEX_CONTENDED	2
+
+/*
+ * Slow path of sys_mutex_lock(), taken when the atomic op of the fast path
+ * found the mutex locked. Once a thread had to wait, the mutex is taken in
+ * the contended state, since it cannot know whether more threads are still
+ * waiting, so the unlock wakes them up in turn.
+ */
+int z_sys_mutex_futex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
+{
+	k_timepoint_t end;
+	atomic_val_t val;
+	int ret;
+
+	if (mutex->owner == k_current_get()) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		if (!atomic_cas(&mutex->futex.val, SYS_MUTEX_UNLOCKED,
+				SYS_MUTEX_LOCKED)) {
+			return -EBUSY;
+		}
+
+		goto locked;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	val = atomic_set(&mutex->futex.val, SYS_MUTEX_CONTENDED);
+	while (val != SYS_MUTEX_UNLOCKED) {
+		ret = k_futex_wait(&mutex->futex, SYS_MUTEX_CONTENDED,
+				   sys_timepoint_timeout(end));
+		if (ret == -ETIMEDOUT) {
+			return -EAGAIN;
+		} else if ((ret < 0) && (ret != -EAGAIN)) {
+			return ret;
+		}
+
+		val = atomic_set(&mutex->futex.val, SYS_MUTEX_CONTENDED);
+	}
+
+locked:
+	mutex->owner = k_current_get();
+	mutex->lock_count = 1U;
+
+	return 0;
+}
+
+int z_sys_mutex_futex_unlock(struct sys_mutex *mutex)
+{
+	if (atomic_get(&mutex->futex.val) == SYS_MUTEX_UNLOCKED) {
+		return -EINVAL;
+	}
+
+	if (mutex->owner != k_current_get()) {
+		return -EPERM;
+	}
+
+	if (--mutex->lock_count > 0U) {
+		return 0;
+	}
+
+	mutex->owner = NULL;
+
+	if (atomic_set(&mutex->futex.val, SYS_MUTEX_UNLOCKED) == SYS_MUTEX_CONTENDED) {
+		(void)k_futex_wake(&mutex->futex, false);
+	}
+
+	return 0;
+}
+#else
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
 	struct k_object *obj;
@@ -72,3 +148,4 @@ static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 	return z_impl_z_sys_mutex_kernel_unlock(mutex);
 }
 #include <zephyr/syscalls/z_sys_mutex_kernel_unlock_mrsh.c>
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
@@ -133,27 +133,21 @@ struct spsc_pbuf *spsc_pbuf_init(void *buf, size_t blen, uint32_t flags)
 	return pb;
 }
 
-int spsc_pbuf_alloc(struct spsc_pbuf *pb, uint16_t len, char **buf)
+/*
+ * Find room for a packet from write index @p wr_idx, which is moved to the
+ * beginning of the buffer if a padding had to be added. The padding is written
+ * back right away unless @p defer_wb is set.
+ */
+static int alloc_from(struct spsc_pbuf *pb, uint16_t len, uint32_t *wr_idx_p, uint32_t rd_idx,
+		      bool defer_wb)
 {
 	/* Length of the buffer and flags are immutable - avoid reloading. */
 	const uint32_t pblen = pb->common.len;
 	const uint32_t flags = pb->common.flags;
-	uint32_t *rd_idx_loc = get_rd_idx_loc(pb, flags);
-	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
 	uint8_t *data_loc = get_data_loc(pb, flags);
 
 	uint32_t space = len + LEN_SZ; /* data + length field */
-
-	if (len == 0 || len > SPSC_PBUF_MAX_LEN) {
-		/* Incorrect call. */
-		return -EINVAL;
-	}
-
-	cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
-	__sync_synchronize();
-
-	uint32_t wr_idx = *wr_idx_loc;
-	uint32_t rd_idx = *rd_idx_loc;
+	uint32_t wr_idx = *wr_idx_p;
 	int32_t free_space;
 
 	if (wr_idx >= rd_idx) {
@@ -178,11 +172,13 @@ int spsc_pbuf_alloc(struct spsc_pbuf *pb, uint16_t len, char **buf)
 		} else {
 			/* Padding must be added. */
 			data_loc[wr_idx] = PADDING_MARK;
-			__sync_synchronize();
-			cache_wb(&data_loc[wr_idx], sizeof(uint8_t), flags);
+			if (!defer_wb) {
+				__sync_synchronize();
+				cache_wb(&data_loc[wr_idx], sizeof(uint8_t), flags);
+			}
 
 			wr_idx = 0;
-			*wr_idx_loc = wr_idx;
+			*wr_idx_p = wr_idx;
 
 			/* Obligatory one word empty space. */
 			free_space = rd_idx - FREE_SPACE_DISTANCE;
@@ -193,11 +189,53 @@ int spsc_pbuf_alloc(struct spsc_pbuf *pb, uint16_t len, char **buf)
 	}
 
 	len = min(len, max(free_space - (int32_t)LEN_SZ, 0));
-	*buf = &data_loc[wr_idx + LEN_SZ];
 
 	return len;
 }
 
+int spsc_pbuf_alloc(struct spsc_pbuf *pb, uint16_t len, char **buf)
+{
+	const uint32_t flags = pb->common.flags;
+	uint32_t *rd_idx_loc = get_rd_idx_loc(pb, flags);
+	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
+	uint8_t *data_loc = get_data_loc(pb, flags);
+	uint32_t wr_idx;
+	int ret;
+
+	if (len == 0 || len > SPSC_PBUF_MAX_LEN) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+	__sync_synchronize();
+
+	wr_idx = *wr_idx_loc;
+	ret = alloc_from(pb, len, &wr_idx, *rd_idx_loc, false);
+	if (wr_idx != *wr_idx_loc) {
+		/* A padding was added. */
+		*wr_idx_loc = wr_idx;
+	}
+
+	*buf = &data_loc[wr_idx + LEN_SZ];
+
+	return ret;
+}
+
+/* Set the length header of a packet, returns the write index following it. */
+static uint32_t commit_at(struct spsc_pbuf *pb, uint32_t wr_idx, uint16_t len)
+{
+	const uint32_t pblen = pb->common.len;
+	uint8_t *data_loc = get_data_loc(pb, pb->common.flags);
+
+	sys_put_be16(len, &data_loc[wr_idx]);
+
+	wr_idx += len + LEN_SZ;
+	wr_idx = ROUND_UP(wr_idx, sizeof(uint32_t));
+
+	return wr_idx == pblen ? 0 : wr_idx;
+}
+
 void spsc_pbuf_commit(struct spsc_pbuf *pb, uint16_t len)
 {
 	if (len == 0) {
@@ -205,24 +243,105 @@ void spsc_pbuf_commit(struct spsc_pbuf *pb, uint16_t len)
 	}
 
 	/* Length of the buffer and flags are immutable - avoid reloading. */
-	const uint32_t pblen = pb->common.len;
 	const uint32_t flags = pb->common.flags;
 	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
 	uint8_t *data_loc = get_data_loc(pb, flags);
 
 	uint32_t wr_idx = *wr_idx_loc;
+	uint32_t next_wr_idx = commit_at(pb, wr_idx, len);
 
-	sys_put_be16(len, &data_loc[wr_idx]);
 	__sync_synchronize();
 	cache_wb(&data_loc[wr_idx], len + LEN_SZ, flags);
 
-	wr_idx += len + LEN_SZ;
-	wr_idx = ROUND_UP(wr_idx, sizeof(uint32_t));
-	wr_idx = wr_idx == pblen ? 0 : wr_idx;
+	*wr_idx_loc = next_wr_idx;
+	__sync_synchronize();
+	cache_wb(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+}
+
+/* Write back the data between two indexes, which may wrap around the end. */
+static void cache_wb_range(struct spsc_pbuf *pb, uint32_t from, uint32_t to)
+{
+	const uint32_t flags = pb->common.flags;
+	uint8_t *data_loc = get_data_loc(pb, flags);
+
+	if (to >= from) {
+		cache_wb(&data_loc[from], to - from, flags);
+		return;
+	}
+
+	cache_wb(&data_loc[from], pb->common.len - from, flags);
+	if (to > 0) {
+		cache_wb(data_loc, to, flags);
+	}
+}
+
+static void cache_inv_range(struct spsc_pbuf *pb, uint32_t from, uint32_t to)
+{
+	const uint32_t flags = pb->common.flags;
+	uint8_t *data_loc = get_data_loc(pb, flags);
+
+	if (to >= from) {
+		cache_inv(&data_loc[from], to - from, flags);
+		return;
+	}
+
+	cache_inv(&data_loc[from], pb->common.len - from, flags);
+	if (to > 0) {
+		cache_inv(data_loc, to, flags);
+	}
+}
+
+int spsc_pbuf_write_batch(struct spsc_pbuf *pb, const char *const bufs[], const uint16_t lens[],
+			  size_t count)
+{
+	const uint32_t flags = pb->common.flags;
+	uint32_t *rd_idx_loc = get_rd_idx_loc(pb, flags);
+	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
+	uint8_t *data_loc = get_data_loc(pb, flags);
+	uint32_t start_wr_idx, wr_idx, rd_idx;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		if (lens[i] == 0 || lens[i] >= SPSC_PBUF_MAX_LEN) {
+			return -EINVAL;
+		}
+	}
+
+	cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+	__sync_synchronize();
+
+	rd_idx = *rd_idx_loc;
+	start_wr_idx = *wr_idx_loc;
+	wr_idx = start_wr_idx;
+
+	/* Packets and paddings are written back together, then the write index. */
+	for (i = 0; i < count; i++) {
+		uint32_t pkt_wr_idx = wr_idx;
+
+		if (alloc_from(pb, lens[i], &pkt_wr_idx, rd_idx, true) != lens[i]) {
+			if (pkt_wr_idx != wr_idx) {
+				/* The padding is part of the batch. */
+				wr_idx = pkt_wr_idx;
+			}
+			break;
+		}
+
+		memcpy(&data_loc[pkt_wr_idx + LEN_SZ], bufs[i], lens[i]);
+		wr_idx = commit_at(pb, pkt_wr_idx, lens[i]);
+	}
+
+	if (wr_idx == start_wr_idx) {
+		return 0;
+	}
+
+	__sync_synchronize();
+	cache_wb_range(pb, start_wr_idx, wr_idx);
 
 	*wr_idx_loc = wr_idx;
 	__sync_synchronize();
 	cache_wb(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+
+	return i;
 }
 
 int spsc_pbuf_write(struct spsc_pbuf *pb, const char *buf, uint16_t len)
@@ -373,6 +492,64 @@ int spsc_pbuf_read(struct spsc_pbuf *pb, char *buf, uint16_t len)
 	return plen;
 }
 
+int spsc_pbuf_read_batch(struct spsc_pbuf *pb, spsc_pbuf_batch_cb_t cb, void *user_data)
+{
+	/* Length of the buffer and flags are immutable - avoid reloading. */
+	const uint32_t pblen = pb->common.len;
+	const uint32_t flags = pb->common.flags;
+	uint32_t *rd_idx_loc = get_rd_idx_loc(pb, flags);
+	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
+	uint8_t *data_loc = get_data_loc(pb, flags);
+	int count = 0;
+
+	cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+	__sync_synchronize();
+
+	uint32_t wr_idx = *wr_idx_loc;
+	uint32_t rd_idx = *rd_idx_loc;
+
+	if (rd_idx == wr_idx) {
+		return 0;
+	}
+
+	uint32_t bytes_stored = idx_occupied(pblen, wr_idx, rd_idx);
+
+	if (IS_ENABLED(CONFIG_SPSC_PBUF_UTILIZATION) && (bytes_stored > GET_UTILIZATION(flags))) {
+		__ASSERT_NO_MSG(bytes_stored <= BIT_MASK(SPSC_PBUF_UTILIZATION_BITS));
+		pb->common.flags = SET_UTILIZATION(flags, bytes_stored);
+		__sync_synchronize();
+		cache_wb(&pb->common.flags, sizeof(pb->common.flags), flags);
+	}
+
+	/* Everything up to the write index was written back before it, so the
+	 * whole stored data is invalidated at once and then read in order.
+	 * If the producer is in the middle of adding a padding the write index
+	 * still points at it, which ends the loop before it is consumed.
+	 */
+	cache_inv_range(pb, rd_idx, wr_idx);
+
+	while (rd_idx != wr_idx) {
+		if (data_loc[rd_idx] == PADDING_MARK) {
+			rd_idx = 0;
+			continue;
+		}
+
+		uint16_t len = sys_get_be16(&data_loc[rd_idx]);
+
+		cb((const char *)&data_loc[rd_idx + LEN_SZ], len, user_data);
+		count++;
+
+		rd_idx = ROUND_UP(rd_idx + len + LEN_SZ, sizeof(uint32_t));
+		rd_idx = rd_idx == pblen ? 0 : rd_idx;
+	}
+
+	*rd_idx_loc = rd_idx;
+	__sync_synchronize();
+	cache_wb(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+
+	return count;
+}
+
 int spsc_pbuf_get_utilization(struct spsc_pbuf *pb)
 {
 	if (!IS_ENABLED(CONFIG_SPSC_PBUF_UTILIZATION)) {
@@ -19,7 +19,6 @@
 typedef struct mqueue_object {
 	sys_snode_t snode;
 	char *mem_buffer;
-	char *mem_obj;
 	struct k_msgq queue;
 	atomic_t ref_count;
 	char *name;
@@ -27,7 +26,6 @@ typedef struct mqueue_object {
 } mqueue_object;
 
 typedef struct mqueue_desc {
-	char *mem_desc;
 	mqueue_object *mqueue;
 	uint32_t  flags;
 } mqueue_desc;
@@ -46,11 +44,121 @@ static void remove_notification(mqueue_object *msg_queue);
 static void remove_mq(mqueue_object *msg_queue);
 static void *mq_notify_thread(void *arg);
 
+#ifdef CONFIG_POSIX_MQ_PREALLOC
+struct mqueue_slot {
+	mqueue_object obj;
+	char name[CONFIG_MQUEUE_NAMELEN_MAX];
+	char buffer[CONFIG_MSG_SIZE_MAX * CONFIG_POSIX_MQ_OPEN_MAX] __aligned(8);
+};
+
+static struct mqueue_slot mq_slots[CONFIG_POSIX_MQ_PREALLOC_QUEUES];
+static ATOMIC_DEFINE(mq_slots_used, CONFIG_POSIX_MQ_PREALLOC_QUEUES);
+
+static mqueue_desc mq_descs[CONFIG_POSIX_MQ_PREALLOC_DESCS];
+static ATOMIC_DEFINE(mq_descs_used, CONFIG_POSIX_MQ_PREALLOC_DESCS);
+
+static mqueue_desc *mq_desc_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(mq_descs); i++) {
+		if (!atomic_test_and_set_bit(mq_descs_used, i)) {
+			(void)memset(&mq_descs[i], 0, sizeof(mq_descs[i]));
+			return &mq_descs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void mq_desc_free(mqueue_desc *mqd)
+{
+	atomic_clear_bit(mq_descs_used, mqd - mq_descs);
+}
+
+static mqueue_object *mq_obj_alloc(const char *name, size_t buf_size)
+{
+	struct mqueue_slot *slot;
+
+	if (buf_size > sizeof(slot->buffer)) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(mq_slots); i++) {
+		if (!atomic_test_and_set_bit(mq_slots_used, i)) {
+			slot = &mq_slots[i];
+			(void)memset(&slot->obj, 0, sizeof(slot->obj));
+			strcpy(slot->name, name);
+			slot->obj.name = slot->name;
+			slot->obj.mem_buffer = slot->buffer;
+			return &slot->obj;
+		}
+	}
+
+	return NULL;
+}
+
+static void mq_obj_free(mqueue_object *msg_queue)
+{
+	struct mqueue_slot *slot = CONTAINER_OF(msg_queue, struct mqueue_slot, obj);
+
+	atomic_clear_bit(mq_slots_used, slot - mq_slots);
+}
+
+static void mq_name_free(mqueue_object *msg_queue)
+{
+	ARG_UNUSED(msg_queue);
+}
+#else
+static mqueue_desc *mq_desc_alloc(void)
+{
+	return k_calloc(1, sizeof(mqueue_desc));
+}
+
+static void mq_desc_free(mqueue_desc *mqd)
+{
+	k_free(mqd);
+}
+
+static mqueue_object *mq_obj_alloc(const char *name, size_t buf_size)
+{
+	mqueue_object *msg_queue = k_calloc(1, sizeof(mqueue_object));
+
+	if (msg_queue == NULL) {
+		return NULL;
+	}
+
+	msg_queue->name = k_malloc(strlen(name) + 1);
+	msg_queue->mem_buffer = k_calloc(1, buf_size);
+	if ((msg_queue->name == NULL) || (msg_queue->mem_buffer == NULL)) {
+		k_free(msg_queue->mem_buffer);
+		k_free(msg_queue->name);
+		k_free(msg_queue);
+		return NULL;
+	}
+
+	strcpy(msg_queue->name, name);
+
+	return msg_queue;
+}
+
+static void mq_obj_free(mqueue_object *msg_queue)
+{
+	k_free(msg_queue->mem_buffer);
+	k_free(msg_queue);
+}
+
+static void mq_name_free(mqueue_object *msg_queue)
+{
+	k_free(msg_queue->name);
+}
+#endif /* CONFIG_POSIX_MQ_PREALLOC */
+
 /**
  * @brief Open a message queue.
  *
  * Number of message queue and descriptor to message queue are limited by
- * heap size. increase the size through CONFIG_HEAP_MEM_POOL_SIZE.
+ * heap size. increase the size through CONFIG_HEAP_MEM_POOL_SIZE, or by
+ * CONFIG_POSIX_MQ_PREALLOC_QUEUES and CONFIG_POSIX_MQ_PREALLOC_DESCS with
+ * CONFIG_POSIX_MQ_PREALLOC.
  *
  * See IEEE 1003.1
  */
@@ -62,7 +170,6 @@ mqd_t mq_open(const char *name, int oflags, ...)
 	long msg_size = 0U, max_msgs = 0U;
 	mqueue_object *msg_queue;
 	mqueue_desc *msg_queue_desc = NULL, *mqd = (mqueue_desc *)(-1);
-	char *mq_desc_ptr, *mq_obj_ptr, *mq_buf_ptr, *mq_name_ptr;
 
 	va_start(va, oflags);
 	if ((oflags & O_CREAT) != 0) {
@@ -105,16 +212,12 @@ mqd_t mq_open(const char *name, int oflags, ...)
 		return (mqd_t)mqd;
 	}
 
-	mq_desc_ptr = k_malloc(sizeof(struct mqueue_desc));
-	if (mq_desc_ptr != NULL) {
-		(void)memset(mq_desc_ptr, 0, sizeof(struct mqueue_desc));
-		msg_queue_desc = (struct mqueue_desc *)mq_desc_ptr;
-		msg_queue_desc->mem_desc = mq_desc_ptr;
-	} else {
-		goto free_mq_desc;
+	msg_queue_desc = mq_desc_alloc();
+	if (msg_queue_desc == NULL) {
+		errno = ENOSPC;
+		return (mqd_t)mqd;
 	}
 
-
 	/* Allocate mqueue object for new message queue */
 	if (msg_queue == NULL) {
 
@@ -124,34 +227,9 @@ mqd_t mq_open(const char *name, int oflags, ...)
 			goto free_mq_desc;
 		}
 
-		mq_obj_ptr = k_malloc(sizeof(mqueue_object));
-		if (mq_obj_ptr != NULL) {
-			(void)memset(mq_obj_ptr, 0, sizeof(mqueue_object));
-			msg_queue = (mqueue_object *)mq_obj_ptr;
-			msg_queue->mem_obj = mq_obj_ptr;
-
-		} else {
-			goto free_mq_object;
-		}
-
-		mq_name_ptr = k_malloc(strlen(name) + 1);
-		if (mq_name_ptr != NULL) {
-			(void)memset(mq_name_ptr, 0, strlen(name) + 1);
-			msg_queue->name = mq_name_ptr;
-
-		} else {
-			goto free_mq_name;
-		}
-
-		strcpy(msg_queue->name, name);
-
-		mq_buf_ptr = k_malloc(msg_size * max_msgs * sizeof(uint8_t));
-		if (mq_buf_ptr != NULL) {
-			(void)memset(mq_buf_ptr, 0,
-				     msg_size * max_msgs * sizeof(uint8_t));
-			msg_queue->mem_buffer = mq_buf_ptr;
-		} else {
-			goto free_mq_buffer;
+		msg_queue = mq_obj_alloc(name, msg_size * max_msgs * sizeof(uint8_t));
+		if (msg_queue == NULL) {
+			goto free_mq_desc;
 		}
 
 		(void)atomic_set(&msg_queue->ref_count, 1);
@@ -170,13 +248,8 @@ mqd_t mq_open(const char *name, int oflags, ...)
 	msg_queue_desc->flags = (oflags & O_NONBLOCK) != 0 ? O_NONBLOCK : 0;
 	return (mqd_t)msg_queue_desc;
 
-free_mq_buffer:
-	k_free(mq_name_ptr);
-free_mq_name:
-	k_free(mq_obj_ptr);
-free_mq_object:
-	k_free(mq_desc_ptr);
 free_mq_desc:
+	mq_desc_free(msg_queue_desc);
 	errno = ENOSPC;
 	return (mqd_t)mqd;
 }
@@ -202,7 +275,7 @@ int mq_close(mqd_t mqdes)
 		remove_mq(mqd->mqueue);
 	}
 
-	k_free(mqd->mem_desc);
+	mq_desc_free(mqd);
 	return 0;
 }
 
@@ -224,7 +297,7 @@ int mq_unlink(const char *name)
 		return -1;
 	}
 
-	k_free(msg_queue->name);
+	mq_name_free(msg_queue);
 	msg_queue->name = NULL;
 	k_sem_give(&mq_sem);
 	remove_mq(msg_queue);
@@ -465,15 +538,17 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 		return ret;
 	}
 
-	uint32_t msgq_num = k_msgq_num_used_get(&mqd->mqueue->queue);
+	struct sigevent *sevp = &mqd->mqueue->not;
+	/* only look at the fill level when someone waits for a notification */
+	bool notify = (sevp->sigev_notify & SIGEV_MASK) != 0;
+	uint32_t msgq_num = notify ? k_msgq_num_used_get(&mqd->mqueue->queue) : 0;
 
 	if (k_msgq_put(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
 		return ret;
 	}
 
-	if (k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
-		struct sigevent *sevp = &mqd->mqueue->not;
+	if (notify && k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
 
 		if (sevp->sigev_notify == SIGEV_NONE) {
 			sevp->sigev_notify_function(sevp->sigev_value);
@@ -526,8 +601,7 @@ static void remove_mq(mqueue_object *msg_queue)
 		k_sem_give(&mq_sem);
 
 		/* Free mq buffer and pbject */
-		k_free(msg_queue->mem_buffer);
-		k_free(msg_queue->mem_obj);
+		mq_obj_free(msg_queue);
 	}
 }
 
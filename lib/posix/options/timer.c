@@ -14,6 +14,7 @@
 #include <signal.h>
 #include <time.h>
 
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/posix/pthread.h>
@@ -28,23 +29,33 @@ static void zephyr_timer_wrapper(struct k_timer *ztimer);
 struct timer_obj {
 	struct k_timer ztimer;
 	struct sigevent evp;
+#ifdef CONFIG_POSIX_TIMER_NOTIFY_WORKQ
+	struct k_work work;
+#else
 	struct k_sem sem_cond;
 	pthread_t thread;
+#endif
 	struct timespec interval;	/* Reload value */
-	uint32_t reload;			/* Reload value in ms */
+	k_timeout_t reload;		/* Reload value in ticks */
+	clockid_t clock_id;
 	uint32_t status;
 };
 
 K_MEM_SLAB_DEFINE(posix_timer_slab, sizeof(struct timer_obj), CONFIG_POSIX_TIMER_MAX,
 		  __alignof__(struct timer_obj));
 
+#ifdef CONFIG_POSIX_TIMER_NOTIFY_WORKQ
+static K_THREAD_STACK_DEFINE(posix_timer_workq_stack, CONFIG_POSIX_TIMER_NOTIFY_WORKQ_STACK_SIZE);
+static struct k_work_q posix_timer_workq;
+#endif
+
 static void zephyr_timer_wrapper(struct k_timer *ztimer)
 {
 	struct timer_obj *timer;
 
 	timer = (struct timer_obj *)ztimer;
 
-	if (timer->reload == 0U) {
+	if (K_TIMEOUT_EQ(timer->reload, K_NO_WAIT)) {
 		timer->status = NOT_ACTIVE;
 		LOG_DBG("timer %p not active", timer);
 	}
@@ -63,6 +74,49 @@ static void zephyr_timer_wrapper(struct k_timer *ztimer)
 	(timer->evp.sigev_notify_function)(timer->evp.sigev_value);
 }
 
+#ifdef CONFIG_POSIX_TIMER_NOTIFY_WORKQ
+static void zephyr_work_wrapper(struct k_work *work)
+{
+	struct timer_obj *timer = CONTAINER_OF(work, struct timer_obj, work);
+
+	if (timer->evp.sigev_notify_function == NULL) {
+		LOG_DBG("NULL sigev_notify_function");
+		return;
+	}
+
+	LOG_DBG("calling sigev_notify_function %p", timer->evp.sigev_notify_function);
+	(timer->evp.sigev_notify_function)(timer->evp.sigev_value);
+}
+
+static void zephyr_timer_interrupt(struct k_timer *ztimer)
+{
+	struct timer_obj *timer;
+
+	timer = (struct timer_obj *)ztimer;
+
+	if (K_TIMEOUT_EQ(timer->reload, K_NO_WAIT)) {
+		timer->status = NOT_ACTIVE;
+		LOG_DBG("timer %p not active", timer);
+	}
+
+	/* expirations while the notification is pending are overruns */
+	(void)k_work_submit_to_queue(&posix_timer_workq, &timer->work);
+}
+
+static int posix_timer_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "posix_timer",
+	};
+
+	k_work_queue_start(&posix_timer_workq, posix_timer_workq_stack,
+			   K_THREAD_STACK_SIZEOF(posix_timer_workq_stack),
+			   CONFIG_POSIX_TIMER_NOTIFY_WORKQ_PRIORITY, &cfg);
+
+	return 0;
+}
+SYS_INIT(posix_timer_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
 static void *zephyr_thread_wrapper(void *arg)
 {
 	int ret;
@@ -77,7 +131,7 @@ static void *zephyr_thread_wrapper(void *arg)
 	}
 
 	while (1) {
-		if (timer->reload == 0U) {
+		if (K_TIMEOUT_EQ(timer->reload, K_NO_WAIT)) {
 			timer->status = NOT_ACTIVE;
 			LOG_DBG("timer %p not active", timer);
 		}
@@ -104,6 +158,7 @@ static void zephyr_timer_interrupt(struct k_timer *ztimer)
 	timer = (struct timer_obj *)ztimer;
 	k_sem_give(&timer->sem_cond);
 }
+#endif /* CONFIG_POSIX_TIMER_NOTIFY_WORKQ */
 
 /**
  * @brief Create a per-process timer.
@@ -116,7 +171,7 @@ static void zephyr_timer_interrupt(struct k_timer *ztimer)
 int timer_create(clockid_t clockid, struct sigevent *evp, timer_t *timerid)
 {
 	int ret = 0;
-	int detachstate;
+	int detachstate __maybe_unused;
 	struct timer_obj *timer;
 	const k_timeout_t alloc_timeout = K_MSEC(CONFIG_TIMER_CREATE_WAIT);
 
@@ -133,6 +188,7 @@ int timer_create(clockid_t clockid, struct sigevent *evp, timer_t *timerid)
 
 	*timer = (struct timer_obj){0};
 	timer->evp = *evp;
+	timer->clock_id = clockid;
 	evp = &timer->evp;
 
 	switch (evp->sigev_notify) {
@@ -143,6 +199,12 @@ int timer_create(clockid_t clockid, struct sigevent *evp, timer_t *timerid)
 		k_timer_init(&timer->ztimer, zephyr_timer_wrapper, NULL);
 		break;
 	case SIGEV_THREAD:
+#ifdef CONFIG_POSIX_TIMER_NOTIFY_WORKQ
+		/* notifications are run by the shared work queue, attributes do not apply */
+		k_work_init(&timer->work, zephyr_work_wrapper);
+		k_timer_init(&timer->ztimer, zephyr_timer_interrupt, NULL);
+		break;
+#else
 		if (evp->sigev_notify_attributes != NULL) {
 			ret = pthread_attr_getdetachstate(evp->sigev_notify_attributes,
 							  &detachstate);
@@ -184,6 +246,7 @@ int timer_create(clockid_t clockid, struct sigevent *evp, timer_t *timerid)
 
 		k_timer_init(&timer->ztimer, zephyr_timer_interrupt, NULL);
 		break;
+#endif /* CONFIG_POSIX_TIMER_NOTIFY_WORKQ */
 	default:
 		ret = -1;
 		errno = EINVAL;
@@ -208,8 +271,6 @@ out:
 int timer_gettime(timer_t timerid, struct itimerspec *its)
 {
 	struct timer_obj *timer = (struct timer_obj *)timerid;
-	int32_t remaining, leftover;
-	int64_t   nsecs, secs;
 
 	if (timer == NULL) {
 		errno = EINVAL;
@@ -217,12 +278,8 @@ int timer_gettime(timer_t timerid, struct itimerspec *its)
 	}
 
 	if (timer->status == ACTIVE) {
-		remaining = k_timer_remaining_get(&timer->ztimer);
-		secs =  remaining / MSEC_PER_SEC;
-		leftover = remaining - (secs * MSEC_PER_SEC);
-		nsecs = (int64_t)leftover * NSEC_PER_MSEC;
-		its->it_value.tv_sec = (int32_t) secs;
-		its->it_value.tv_nsec = (int32_t) nsecs;
+		timespec_from_timeout(K_TICKS(k_timer_remaining_ticks(&timer->ztimer)),
+				      &its->it_value);
 	} else {
 		/* Timer is disarmed */
 		its->it_value.tv_sec = 0;
@@ -243,7 +300,9 @@ int timer_settime(timer_t timerid, int flags, const struct itimerspec *value,
 		  struct itimerspec *ovalue)
 {
 	struct timer_obj *timer = (struct timer_obj *) timerid;
-	uint32_t duration, current;
+	struct timespec value_rel = value->it_value;
+	struct timespec now;
+	k_timeout_t duration;
 
 	if ((timer == NULL) || !timespec_is_valid(&value->it_interval) ||
 	    !timespec_is_valid(&value->it_value)) {
@@ -266,29 +325,28 @@ int timer_settime(timer_t timerid, int flags, const struct itimerspec *value,
 		return 0;
 	}
 
-	/* Calculate timer period */
-	timer->reload = ts_to_ms(&value->it_interval);
+	/* Calculate timer period, rounded up to the next tick */
+	timer->reload = timespec_to_timeout(&value->it_interval, NULL);
 	timer->interval.tv_sec = value->it_interval.tv_sec;
 	timer->interval.tv_nsec = value->it_interval.tv_nsec;
 
-	/* Calculate timer duration */
-	duration = ts_to_ms(&(value->it_value));
+	/* Calculate timer duration, relative to the clock of the timer if absolute */
 	if ((flags & TIMER_ABSTIME) != 0) {
-		current = k_timer_remaining_get(&timer->ztimer);
-
-		if (current >= duration) {
-			duration = 0U;
-		} else {
-			duration -= current;
+		if (sys_clock_gettime(sys_clock_from_clockid(timer->clock_id), &now) < 0) {
+			errno = EINVAL;
+			return -1;
 		}
+
+		(void)timespec_sub(&value_rel, &now);
 	}
+	duration = timespec_to_timeout(&value_rel, NULL);
 
 	if (timer->status == ACTIVE) {
 		k_timer_stop(&timer->ztimer);
 	}
 
 	timer->status = ACTIVE;
-	k_timer_start(&timer->ztimer, K_MSEC(duration), K_MSEC(timer->reload));
+	k_timer_start(&timer->ztimer, duration, timer->reload);
 	return 0;
 }
 
@@ -335,7 +393,13 @@ int timer_delete(timer_t timerid)
 	}
 
 	if (timer->evp.sigev_notify == SIGEV_THREAD) {
+#ifdef CONFIG_POSIX_TIMER_NOTIFY_WORKQ
+		struct k_work_sync sync;
+
+		(void)k_work_cancel_sync(&timer->work, &sync);
+#else
 		(void)pthread_cancel(timer->thread);
+#endif
 	}
 
 	k_mem_slab_free(&posix_timer_slab, (void *)timer);
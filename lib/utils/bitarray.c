@@ -26,6 +26,84 @@ struct bundle_data {
 	uint32_t smask, emask;
 };
 
+/*
+ * Refresh the summary bits of bundles sidx to eidx included, after they
+ * were modified.
+ */
+static void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	if (bitarray->summary == NULL) {
+		return;
+	}
+
+	for (size_t idx = sidx; idx <= eidx; idx++) {
+		if (~bitarray->bundles[idx] == 0U) {
+			bitarray->summary[idx / 32] |= BIT(idx % 32);
+		} else {
+			bitarray->summary[idx / 32] &= ~BIT(idx % 32);
+		}
+	}
+#else
+	ARG_UNUSED(bitarray);
+	ARG_UNUSED(sidx);
+	ARG_UNUSED(eidx);
+#endif
+}
+
+/* Index of the first bundle from idx on which is not all set */
+static size_t next_free_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	if (bitarray->summary != NULL) {
+		/* Skip 32 full bundles at once */
+		while (idx < bitarray->num_bundles) {
+			uint32_t free = ~bitarray->summary[idx / 32] & ~BIT_MASK(idx % 32);
+
+			if (free != 0U) {
+				idx = ROUND_DOWN(idx, 32) + find_lsb_set(free) - 1;
+				return MIN(idx, bitarray->num_bundles);
+			}
+
+			idx = ROUND_DOWN(idx, 32) + 32;
+		}
+
+		return bitarray->num_bundles;
+	}
+#endif
+
+	while ((idx < bitarray->num_bundles) && (~bitarray->bundles[idx] == 0U)) {
+		idx++;
+	}
+
+	return idx;
+}
+
+/* Offset of the first cleared bit from bit on, num_bits if there is none */
+static size_t next_cleared_bit(sys_bitarray_t *bitarray, size_t bit)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (bit >= bitarray->num_bits) {
+		return bitarray->num_bits;
+	}
+
+	bundle = ~bitarray->bundles[idx] & ~BIT_MASK(bit % bundle_bitness(bitarray));
+	if (bundle == 0U) {
+		idx = next_free_bundle(bitarray, idx + 1);
+		if (idx >= bitarray->num_bundles) {
+			return bitarray->num_bits;
+		}
+
+		bundle = ~bitarray->bundles[idx];
+	}
+
+	bit = idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1;
+
+	return MIN(bit, bitarray->num_bits);
+}
+
 static void setup_bundle_data(sys_bitarray_t *bitarray,
 			      struct bundle_data *bd,
 			      size_t offset, size_t num_bits)
@@ -208,6 +286,8 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+	update_summary(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
@@ -309,6 +389,7 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	update_summary(dst, bd.sidx, bd.eidx);
 	ret = 0;
 
 out:
@@ -337,6 +418,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -365,6 +447,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -441,6 +524,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -480,6 +564,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -488,15 +573,51 @@ out:
 	return ret;
 }
 
+/*
+ * Find and allocate a region of num_bits cleared bits starting between the
+ * offsets start and end included.
+ */
+static bool alloc_region(sys_bitarray_t *bitarray, size_t num_bits,
+			 size_t start, size_t end, size_t *offset)
+{
+	struct bundle_data bd;
+	size_t bit_idx;
+	size_t mismatch;
+
+	/* Only look at offsets of cleared bits, skipping allocated bits a
+	 * bundle at a time, or 32 bundles at a time with the summary.
+	 */
+	bit_idx = next_cleared_bit(bitarray, start);
+	while (bit_idx <= end) {
+		if (match_region(bitarray, bit_idx, num_bits, false,
+				 &bd, &mismatch)) {
+			set_region(bitarray, bit_idx, num_bits, true, &bd);
+			*offset = bit_idx;
+
+			return true;
+		}
+
+		/* The mismatched bit is set, the region cannot start before
+		 * the next cleared bit.
+		 */
+		bit_idx = next_cleared_bit(bitarray, mismatch + 1);
+	}
+
+	return false;
+}
+
 int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
+{
+	return sys_bitarray_alloc_hint(bitarray, num_bits, 0, offset);
+}
+
+int sys_bitarray_alloc_hint(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t hint, size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
+	size_t off_end;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -521,52 +642,24 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 			ret = -ENOSPC;
 		} else {
 			bitarray->bundles[0] |= BIT_MASK(num_bits) << off;
+			update_summary(bitarray, 0, 0);
 			*offset = off;
 			ret = 0;
 		}
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
 	off_end = bitarray->num_bits - num_bits;
-	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
-
-			*offset = bit_idx;
-			ret = 0;
-			break;
-		}
+	if (hint > off_end) {
+		hint = 0;
+	}
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
+	/* Look after the hint first, then before it */
+	if (alloc_region(bitarray, num_bits, hint, off_end, offset) ||
+	    ((hint > 0) && alloc_region(bitarray, num_bits, 0, hint - 1, offset))) {
+		ret = 0;
+	} else {
+		ret = -ENOSPC;
 	}
 
 out:
@@ -681,6 +774,7 @@ int sys_bitarray_free(sys_bitarray_t *bitarray, size_t num_bits,
 			ret = -EFAULT;
 		} else {
 			bitarray->bundles[0] &= ~mask;
+			update_summary(bitarray, 0, 0);
 			ret = 0;
 		}
 	} else if (match_region(bitarray, offset, num_bits, true, &bd, NULL)) {
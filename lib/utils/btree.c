@@ -0,0 +1,499 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * B+ tree of item pointers.
+ *
+ * Leaves hold between MIN_ITEMS and MAX_ITEMS items, in order, and are
+ * chained through their next pointer. Inner nodes hold between MIN_ITEMS and
+ * MAX_ITEMS keys separating their children: items[i] is always the first
+ * item of the leftmost leaf below children[i + 1]. The root may hold fewer.
+ *
+ * Keys are the items themselves rather than copies, so they must be kept
+ * up to date as leaves change: an item removed from the tree would not be a
+ * valid key anymore once its owner reuses it.
+ *
+ * As duplicates are allowed, insertions walk down to the last position an
+ * item could take, and lookups to the first one, then follow the leaves.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/btree.h>
+#include <zephyr/sys/util.h>
+
+#define MAX_ITEMS SYS_BTREE_NODE_ITEMS
+#define MIN_ITEMS (SYS_BTREE_NODE_ITEMS / 2)
+
+BUILD_ASSERT((MAX_ITEMS % 2) == 0 && MAX_ITEMS >= 4 && MAX_ITEMS < UINT8_MAX,
+	     "Node size must be even, at least 4 and fit the item count");
+
+static struct sys_btree_node *node_alloc(struct sys_btree *tree, bool leaf)
+{
+	struct sys_btree_node *node = tree->free;
+
+	if (node != NULL) {
+		tree->free = node->parent;
+	} else if (tree->nodes_used < tree->num_nodes) {
+		node = &tree->nodes[tree->nodes_used++];
+	} else {
+		return NULL;
+	}
+
+	node->parent = NULL;
+	node->count = 0;
+	node->leaf = leaf;
+	if (leaf) {
+		node->next = NULL;
+	}
+
+	return node;
+}
+
+/* Unused nodes are chained through their parent pointer */
+static void node_free(struct sys_btree *tree, struct sys_btree_node *node)
+{
+	node->parent = tree->free;
+	tree->free = node;
+}
+
+static bool nodes_available(const struct sys_btree *tree, size_t needed)
+{
+	size_t available = tree->num_nodes - tree->nodes_used;
+
+	for (struct sys_btree_node *node = tree->free; node != NULL && available < needed;
+	     node = node->parent) {
+		available++;
+	}
+
+	return available >= needed;
+}
+
+/*
+ * Number of the @p count first items sorting before @p key, and also
+ * before or equal to it if @p after_equal is set.
+ */
+static size_t bound(void *const *items, size_t count, const void *key, sys_btree_cmp_t cmp,
+		    bool after_equal)
+{
+	size_t lo = 0;
+	size_t hi = count;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		int ret = cmp(items[mid], key);
+
+		if (ret < 0 || (after_equal && ret == 0)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static struct sys_btree_node *leaf_of(const struct sys_btree *tree, const void *key,
+				      sys_btree_cmp_t cmp, bool after_equal)
+{
+	struct sys_btree_node *node = tree->root;
+
+	while (!node->leaf) {
+		node = node->children[bound(node->items, node->count, key, cmp, after_equal)];
+	}
+
+	return node;
+}
+
+static size_t child_index(const struct sys_btree_node *parent, const struct sys_btree_node *child)
+{
+	size_t i = 0;
+
+	while (parent->children[i] != child) {
+		i++;
+		__ASSERT_NO_MSG(i <= parent->count);
+	}
+
+	return i;
+}
+
+/*
+ * Insert @p val at @p pos in @p left, an array of @p total - 1 elements,
+ * keeping the first @p left_n elements of the result there and moving the
+ * others to @p right.
+ */
+static void split_insert(void **left, void **right, size_t pos, void *val, size_t total,
+			 size_t left_n)
+{
+	for (size_t i = left_n; i < total; i++) {
+		right[i - left_n] = i < pos ? left[i] : (i == pos ? val : left[i - 1]);
+	}
+
+	if (pos < left_n) {
+		memmove(&left[pos + 1], &left[pos], (left_n - 1 - pos) * sizeof(*left));
+		left[pos] = val;
+	}
+}
+
+static void insert_at(void **array, size_t count, size_t pos, void *val)
+{
+	memmove(&array[pos + 1], &array[pos], (count - pos) * sizeof(*array));
+	array[pos] = val;
+}
+
+static void remove_at(void **array, size_t count, size_t pos)
+{
+	memmove(&array[pos], &array[pos + 1], (count - pos - 1) * sizeof(*array));
+}
+
+static void adopt_children(struct sys_btree_node *node, size_t from)
+{
+	for (size_t i = from; i <= node->count; i++) {
+		node->children[i]->parent = node;
+	}
+}
+
+/* Link @p right, split off @p left, with @p key separating them */
+static void inner_insert(struct sys_btree *tree, struct sys_btree_node *left, void *key,
+			 struct sys_btree_node *right)
+{
+	while (true) {
+		struct sys_btree_node *parent = left->parent;
+		struct sys_btree_node *sibling;
+		size_t i;
+
+		if (parent == NULL) {
+			/* reserved by sys_btree_insert() */
+			parent = node_alloc(tree, false);
+			__ASSERT_NO_MSG(parent != NULL);
+
+			parent->items[0] = key;
+			parent->children[0] = left;
+			parent->children[1] = right;
+			parent->count = 1;
+			adopt_children(parent, 0);
+			tree->root = parent;
+			return;
+		}
+
+		i = child_index(parent, left);
+		right->parent = parent;
+
+		if (parent->count < MAX_ITEMS) {
+			insert_at(parent->items, parent->count, i, key);
+			insert_at((void **)parent->children, parent->count + 1, i + 1, right);
+			parent->count++;
+			return;
+		}
+
+		sibling = node_alloc(tree, false);
+		__ASSERT_NO_MSG(sibling != NULL);
+
+		/* the key right after those kept moves up */
+		split_insert(parent->items, sibling->items, i, key, MAX_ITEMS + 1, MIN_ITEMS + 1);
+		split_insert((void **)parent->children, (void **)sibling->children, i + 1, right,
+			     MAX_ITEMS + 2, MIN_ITEMS + 1);
+		parent->count = MIN_ITEMS;
+		sibling->count = MAX_ITEMS - MIN_ITEMS;
+		adopt_children(sibling, 0);
+
+		left = parent;
+		key = parent->items[MIN_ITEMS];
+		right = sibling;
+	}
+}
+
+static void leaf_insert(struct sys_btree *tree, struct sys_btree_node *leaf, size_t pos,
+			void *item)
+{
+	struct sys_btree_node *right;
+
+	if (leaf->count < MAX_ITEMS) {
+		insert_at(leaf->items, leaf->count, pos, item);
+		leaf->count++;
+		return;
+	}
+
+	/* reserved by sys_btree_insert() */
+	right = node_alloc(tree, true);
+	__ASSERT_NO_MSG(right != NULL);
+
+	split_insert(leaf->items, right->items, pos, item, MAX_ITEMS + 1, MIN_ITEMS);
+	leaf->count = MIN_ITEMS;
+	right->count = MAX_ITEMS + 1 - MIN_ITEMS;
+	right->next = leaf->next;
+	leaf->next = right;
+
+	inner_insert(tree, leaf, right->items[0], right);
+}
+
+/* Move the last item or key of the left sibling of children[i] to its front */
+static void borrow_from_left(struct sys_btree_node *parent, size_t i)
+{
+	struct sys_btree_node *node = parent->children[i];
+	struct sys_btree_node *left = parent->children[i - 1];
+
+	if (node->leaf) {
+		insert_at(node->items, node->count, 0, left->items[left->count - 1]);
+		parent->items[i - 1] = node->items[0];
+	} else {
+		insert_at(node->items, node->count, 0, parent->items[i - 1]);
+		insert_at((void **)node->children, node->count + 1, 0, left->children[left->count]);
+		node->children[0]->parent = node;
+		parent->items[i - 1] = left->items[left->count - 1];
+	}
+
+	node->count++;
+	left->count--;
+}
+
+/* Move the first item or key of the right sibling of children[i] to its end */
+static void borrow_from_right(struct sys_btree_node *parent, size_t i)
+{
+	struct sys_btree_node *node = parent->children[i];
+	struct sys_btree_node *right = parent->children[i + 1];
+
+	if (node->leaf) {
+		node->items[node->count] = right->items[0];
+		remove_at(right->items, right->count, 0);
+		parent->items[i] = right->items[0];
+	} else {
+		node->items[node->count] = parent->items[i];
+		node->children[node->count + 1] = right->children[0];
+		node->children[node->count + 1]->parent = node;
+		parent->items[i] = right->items[0];
+		remove_at(right->items, right->count, 0);
+		remove_at((void **)right->children, right->count + 1, 0);
+	}
+
+	node->count++;
+	right->count--;
+}
+
+/* Merge children[i + 1] of @p parent into children[i] */
+static void merge(struct sys_btree *tree, struct sys_btree_node *parent, size_t i)
+{
+	struct sys_btree_node *left = parent->children[i];
+	struct sys_btree_node *right = parent->children[i + 1];
+
+	if (left->leaf) {
+		memcpy(&left->items[left->count], right->items, right->count * sizeof(void *));
+		left->count += right->count;
+		left->next = right->next;
+	} else {
+		size_t from = left->count + 1;
+
+		left->items[left->count] = parent->items[i];
+		memcpy(&left->items[from], right->items, right->count * sizeof(void *));
+		memcpy(&left->children[from], right->children,
+		       (right->count + 1) * sizeof(right->children[0]));
+		left->count += right->count + 1;
+		adopt_children(left, from);
+	}
+
+	remove_at(parent->items, parent->count, i);
+	remove_at((void **)parent->children, parent->count + 1, i + 1);
+	parent->count--;
+
+	node_free(tree, right);
+}
+
+static void rebalance(struct sys_btree *tree, struct sys_btree_node *node)
+{
+	while (true) {
+		struct sys_btree_node *parent = node->parent;
+		size_t i;
+
+		if (parent == NULL) {
+			if (node->count > 0) {
+				return;
+			}
+
+			/* an empty root leaf is the last node, an empty inner root has one child */
+			if (node->leaf) {
+				tree->root = NULL;
+				tree->first = NULL;
+			} else {
+				tree->root = node->children[0];
+				tree->root->parent = NULL;
+			}
+
+			node_free(tree, node);
+			return;
+		}
+
+		if (node->count >= MIN_ITEMS) {
+			return;
+		}
+
+		i = child_index(parent, node);
+
+		if (i > 0 && parent->children[i - 1]->count > MIN_ITEMS) {
+			borrow_from_left(parent, i);
+			return;
+		}
+
+		if (i < parent->count && parent->children[i + 1]->count > MIN_ITEMS) {
+			borrow_from_right(parent, i);
+			return;
+		}
+
+		merge(tree, parent, i > 0 ? i - 1 : i);
+		node = parent;
+	}
+}
+
+/* Make the new first item of @p leaf the key of the subtree it is leftmost in */
+static void update_key(struct sys_btree_node *leaf)
+{
+	for (struct sys_btree_node *node = leaf; node->parent != NULL; node = node->parent) {
+		size_t i = child_index(node->parent, node);
+
+		if (i > 0) {
+			node->parent->items[i - 1] = leaf->items[0];
+			return;
+		}
+	}
+}
+
+static void leaf_remove(struct sys_btree *tree, struct sys_btree_node *leaf, size_t pos)
+{
+	remove_at(leaf->items, leaf->count, pos);
+	leaf->count--;
+	tree->size--;
+
+	if (pos == 0 && leaf->count > 0) {
+		update_key(leaf);
+	}
+
+	rebalance(tree, leaf);
+}
+
+void sys_btree_init(struct sys_btree *tree, struct sys_btree_node *nodes, size_t num_nodes,
+		    sys_btree_cmp_t cmp)
+{
+	*tree = (struct sys_btree) {
+		.nodes = nodes,
+		.num_nodes = num_nodes,
+		.cmp = cmp,
+	};
+}
+
+int sys_btree_insert(struct sys_btree *tree, void *item)
+{
+	struct sys_btree_node *leaf;
+	struct sys_btree_node *node;
+	size_t needed = 0;
+
+	__ASSERT(item != NULL, "NULL items cannot be told from the end of the tree");
+
+	if (tree->root == NULL) {
+		leaf = node_alloc(tree, true);
+		if (leaf == NULL) {
+			return -ENOMEM;
+		}
+
+		tree->root = leaf;
+		tree->first = leaf;
+	}
+
+	leaf = leaf_of(tree, item, tree->cmp, true);
+
+	/* reserve the nodes splits take up front, not to fail half way */
+	for (node = leaf; node != NULL && node->count == MAX_ITEMS; node = node->parent) {
+		needed++;
+	}
+
+	if (node == NULL && needed > 0) {
+		needed++;
+	}
+
+	if (!nodes_available(tree, needed)) {
+		return -ENOMEM;
+	}
+
+	leaf_insert(tree, leaf, bound(leaf->items, leaf->count, item, tree->cmp, true), item);
+	tree->size++;
+
+	return 0;
+}
+
+bool sys_btree_remove(struct sys_btree *tree, void *item)
+{
+	struct sys_btree_node *leaf;
+	size_t i;
+
+	if (tree->root == NULL) {
+		return false;
+	}
+
+	leaf = leaf_of(tree, item, tree->cmp, false);
+	i = bound(leaf->items, leaf->count, item, tree->cmp, false);
+
+	/* the item is among those equal to it, which may span several leaves */
+	while (leaf != NULL) {
+		for (; i < leaf->count; i++) {
+			if (leaf->items[i] == item) {
+				leaf_remove(tree, leaf, i);
+				return true;
+			}
+
+			if (tree->cmp(leaf->items[i], item) > 0) {
+				return false;
+			}
+		}
+
+		leaf = leaf->next;
+		i = 0;
+	}
+
+	return false;
+}
+
+void *sys_btree_find(const struct sys_btree *tree, const void *key, sys_btree_cmp_t cmp)
+{
+	struct sys_btree_node *leaf;
+	size_t i;
+
+	if (tree->root == NULL) {
+		return NULL;
+	}
+
+	if (cmp == NULL) {
+		cmp = tree->cmp;
+	}
+
+	leaf = leaf_of(tree, key, cmp, false);
+	i = bound(leaf->items, leaf->count, key, cmp, false);
+
+	/* all the items of the leaf may sort before the key */
+	if (i == leaf->count) {
+		leaf = leaf->next;
+		i = 0;
+	}
+
+	if (leaf != NULL && cmp(leaf->items[i], key) == 0) {
+		return leaf->items[i];
+	}
+
+	return NULL;
+}
+
+void *sys_btree_pop_min(struct sys_btree *tree)
+{
+	void *item;
+
+	if (tree->size == 0) {
+		return NULL;
+	}
+
+	item = tree->first->items[0];
+	leaf_remove(tree, tree->first, 0);
+
+	return item;
+}
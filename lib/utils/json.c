@@ -90,11 +90,40 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+/* Bytes of a word all set to the given value */
+#define WORD_REPEAT(byte) (((uintptr_t)-1 / 0xFFU) * (uint8_t)(byte))
+
+/* Whether any byte of the word is zero */
+#define WORD_HAS_ZERO(word) \
+	((((word) - WORD_REPEAT(0x01)) & ~(word) & WORD_REPEAT(0x80)) != 0U)
+
+/*
+ * Skip the characters of a string that need no processing a word at a time,
+ * stopping before the word holding a quote, a backslash or a NUL character.
+ */
+static void skip_string_chars(struct json_lexer *lex)
+{
+	uintptr_t word;
+
+	while (lex->pos + sizeof(word) <= lex->end) {
+		memcpy(&word, lex->pos, sizeof(word));
+
+		if (WORD_HAS_ZERO(word) || WORD_HAS_ZERO(word ^ WORD_REPEAT('"')) ||
+		    WORD_HAS_ZERO(word ^ WORD_REPEAT('\\'))) {
+			return;
+		}
+
+		lex->pos += sizeof(word);
+	}
+}
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
+		skip_string_chars(lex);
+
 		int chr = next(lex);
 
 		if (chr == '\0') {
@@ -282,6 +311,11 @@ static void *lexer_json(struct json_lexer *lex)
 			__fallthrough;
 		default:
 			if (isspace(chr) != 0) {
+				/* Skip the whole run of white space at once */
+				while (lex->pos < lex->end && isspace((unsigned char)*lex->pos) != 0) {
+					lex->pos++;
+				}
+
 				ignore(lex);
 				continue;
 			}
@@ -1155,7 +1189,8 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t expected = 0;
+	size_t n, i;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -1163,7 +1198,13 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
+		/*
+		 * Fields mostly come in the order they are described in, so
+		 * start looking for the key after the last one found.
+		 */
+		for (n = 0; n < descr_len; n++) {
+			i = (expected + n < descr_len) ? expected + n : expected + n - descr_len;
+
 			void *decode_field = (char *)val + descr[i].offset;
 
 			/* Field has been decoded already, skip */
@@ -1189,11 +1230,12 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			}
 
 			decoded_fields |= (int64_t)1<<i;
+			expected = i + 1;
 			break;
 		}
 
 		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
+		if (n >= descr_len) {
 			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
@@ -1268,6 +1310,477 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+enum stream_lex_state {
+	STREAM_LEX_TOKEN,
+	STREAM_LEX_STRING,
+	STREAM_LEX_ESCAPE,
+	STREAM_LEX_UNICODE,
+	STREAM_LEX_WORD,
+	STREAM_LEX_DONE,
+};
+
+/* What a frame of the incremental parser expects next */
+enum stream_expect {
+	STREAM_OBJ_KEY_OR_END,
+	STREAM_OBJ_KEY,
+	STREAM_OBJ_COLON,
+	STREAM_OBJ_VALUE,
+	STREAM_OBJ_COMMA_OR_END,
+	STREAM_ARR_VALUE_OR_END,
+	STREAM_ARR_VALUE,
+	STREAM_ARR_COMMA_OR_END,
+};
+
+static bool stream_frame_is_array(const struct json_stream_frame *frame)
+{
+	return frame->expect >= STREAM_ARR_VALUE_OR_END;
+}
+
+static int stream_push_obj(struct json_stream *stream, const struct json_obj_descr *descr,
+			   size_t descr_len, void *val)
+{
+	struct json_stream_frame *frame;
+
+	if (stream->depth == ARRAY_SIZE(stream->frames)) {
+		return -ENOMEM;
+	}
+
+	frame = &stream->frames[stream->depth++];
+	*frame = (struct json_stream_frame) {
+		.descr = descr,
+		.descr_len = descr_len,
+		.base = val,
+		.expect = STREAM_OBJ_KEY_OR_END,
+	};
+
+	return 0;
+}
+
+/* Same layout as handled by arr_parse() */
+static int stream_push_arr(struct json_stream *stream, const struct json_obj_descr *descr,
+			   void *field, void *val)
+{
+	const struct json_obj_descr *elem_descr = descr->array.element_descr;
+	struct json_stream_frame *frame;
+
+	if (stream->depth == ARRAY_SIZE(stream->frames)) {
+		return -ENOMEM;
+	}
+
+	frame = &stream->frames[stream->depth++];
+	*frame = (struct json_stream_frame) {
+		.descr_len = descr->array.n_elements,
+		.base = field,
+		.parent = val,
+		.elements = (size_t *)((char *)val + elem_descr->offset),
+		.expect = STREAM_ARR_VALUE_OR_END,
+	};
+
+	/* For nested arrays, skip parent descriptor to get elements */
+	if (elem_descr->type == JSON_TOK_ARRAY_START) {
+		elem_descr = elem_descr->array.element_descr;
+	}
+
+	frame->descr = elem_descr;
+	*frame->elements = 0;
+
+	return 0;
+}
+
+/* Whether the value starting now is kept, rather than only lexed */
+static bool stream_keeps_value(struct json_stream *stream)
+{
+	struct json_stream_frame *frame;
+
+	if (stream->depth == 0 || stream->skip_depth > 0) {
+		return false;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+
+	return stream_frame_is_array(frame) || frame->expect != STREAM_OBJ_VALUE ||
+	       frame->field != NULL;
+}
+
+static const struct json_obj_descr *stream_find_field(struct json_stream_frame *frame,
+						      const char *key, size_t key_len)
+{
+	for (size_t n = 0; n < frame->descr_len; n++) {
+		size_t i = (frame->next_field + n) % frame->descr_len;
+
+		if ((frame->decoded & ((int64_t)1 << i)) == 0 &&
+		    key_len == frame->descr[i].field_name_len &&
+		    memcmp(key, frame->descr[i].field_name, key_len) == 0) {
+			frame->next_field = i + 1;
+			return &frame->descr[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int stream_value(struct json_stream *stream, struct json_stream_frame *frame,
+			enum json_tokens type)
+{
+	const struct json_obj_descr *descr;
+	void *field;
+	void *val;
+
+	if (stream_frame_is_array(frame)) {
+		ptrdiff_t elem_size = get_elem_size(frame->descr);
+
+		if (*frame->elements == frame->descr_len) {
+			return -ENOSPC;
+		}
+
+		descr = frame->descr;
+		field = (char *)frame->base + elem_size * (*frame->elements)++;
+		/* For nested arrays, value is the current field, matching
+		 * the descriptor's offset to length field
+		 */
+		val = (descr->type == JSON_TOK_ARRAY_START) ? field : frame->parent;
+		frame->expect = STREAM_ARR_COMMA_OR_END;
+	} else {
+		descr = frame->field;
+		val = frame->base;
+		frame->expect = STREAM_OBJ_COMMA_OR_END;
+
+		if (descr == NULL) {
+			/* Skip field, no descriptor was found */
+			if (type == JSON_TOK_OBJECT_START || type == JSON_TOK_ARRAY_START) {
+				stream->skip_depth = 1;
+			}
+
+			return 0;
+		}
+
+		field = (char *)val + descr->offset;
+		frame->decoded |= (int64_t)1 << (descr - frame->descr);
+	}
+
+	if (!equivalent_types(type, descr->type)) {
+		return -EINVAL;
+	}
+
+	switch (descr->type) {
+	case JSON_TOK_OBJECT_START:
+		return stream_push_obj(stream, descr->object.sub_descr,
+				       descr->object.sub_descr_len, field);
+	case JSON_TOK_ARRAY_START:
+		return stream_push_arr(stream, descr, field, val);
+	case JSON_TOK_STRING:
+	case JSON_TOK_OPAQUE:
+	case JSON_TOK_FLOAT:
+	case JSON_TOK_OBJ_ARRAY:
+	case JSON_TOK_ENCODED_OBJ:
+		/* These would point into data that does not stay around */
+		return -ENOTSUP;
+	default: {
+		struct json_token value = {
+			.type = type,
+			.start = stream->buf,
+			.end = stream->buf + stream->len,
+		};
+
+		return decode_value(NULL, descr, &value, field, val) < 0 ? -EINVAL : 0;
+	}
+	}
+}
+
+static int stream_close(struct json_stream *stream, struct json_stream_frame *frame)
+{
+	stream->depth--;
+
+	if (stream->depth == 0) {
+		stream->result = frame->decoded;
+		stream->lex_state = STREAM_LEX_DONE;
+		return 0;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+	frame->expect = stream_frame_is_array(frame) ? STREAM_ARR_COMMA_OR_END
+						     : STREAM_OBJ_COMMA_OR_END;
+
+	return 0;
+}
+
+/* Handle a token, strings and words being held in the stream buffer */
+static int stream_token(struct json_stream *stream, enum json_tokens type)
+{
+	struct json_stream_frame *frame = &stream->frames[0];
+
+	if (stream->skip_depth > 0) {
+		if (type == JSON_TOK_OBJECT_START || type == JSON_TOK_ARRAY_START) {
+			stream->skip_depth++;
+		} else if (type == JSON_TOK_OBJECT_END || type == JSON_TOK_ARRAY_END) {
+			stream->skip_depth--;
+		}
+
+		return 0;
+	}
+
+	if (stream->depth == 0) {
+		return type == JSON_TOK_OBJECT_START ? stream_push_obj(stream, frame->descr,
+								       frame->descr_len,
+								       frame->base)
+						     : -EINVAL;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+
+	switch (frame->expect) {
+	case STREAM_OBJ_KEY_OR_END:
+		if (type == JSON_TOK_OBJECT_END) {
+			return stream_close(stream, frame);
+		}
+
+		__fallthrough;
+	case STREAM_OBJ_KEY:
+		if (type != JSON_TOK_STRING) {
+			return -EINVAL;
+		}
+
+		frame->field = stream_find_field(frame, stream->buf, stream->len);
+		frame->expect = STREAM_OBJ_COLON;
+		return 0;
+	case STREAM_OBJ_COLON:
+		if (type != JSON_TOK_COLON) {
+			return -EINVAL;
+		}
+
+		frame->expect = STREAM_OBJ_VALUE;
+		return 0;
+	case STREAM_OBJ_COMMA_OR_END:
+		if (type == JSON_TOK_OBJECT_END) {
+			return stream_close(stream, frame);
+		}
+
+		if (type != JSON_TOK_COMMA) {
+			return -EINVAL;
+		}
+
+		frame->expect = STREAM_OBJ_KEY;
+		return 0;
+	case STREAM_ARR_VALUE_OR_END:
+		if (type == JSON_TOK_ARRAY_END) {
+			return stream_close(stream, frame);
+		}
+
+		__fallthrough;
+	case STREAM_OBJ_VALUE:
+	case STREAM_ARR_VALUE:
+		if (element_token(type) < 0) {
+			return -EINVAL;
+		}
+
+		return stream_value(stream, frame, type);
+	case STREAM_ARR_COMMA_OR_END:
+		if (type == JSON_TOK_ARRAY_END) {
+			return stream_close(stream, frame);
+		}
+
+		if (type != JSON_TOK_COMMA) {
+			return -EINVAL;
+		}
+
+		frame->expect = STREAM_ARR_VALUE;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+static int stream_append(struct json_stream *stream, char chr)
+{
+	if (stream->discard) {
+		return 0;
+	}
+
+	/* Keep room for the terminating NUL decoding numbers adds */
+	if (stream->len + 1 >= stream->buf_size) {
+		return -ENOSPC;
+	}
+
+	stream->buf[stream->len++] = chr;
+
+	return 0;
+}
+
+static bool stream_is_word_char(char chr)
+{
+	return isalnum((unsigned char)chr) != 0 || chr == '.' || chr == '+' || chr == '-';
+}
+
+/* Token of a number or literal, as lexer_json() would tell them apart */
+static enum json_tokens stream_word_token(struct json_stream *stream)
+{
+	static const struct {
+		const char *word;
+		enum json_tokens token;
+	} literals[] = {
+		{ "true", JSON_TOK_TRUE },
+		{ "false", JSON_TOK_FALSE },
+		{ "null", JSON_TOK_NULL },
+#ifdef CONFIG_JSON_LIBRARY_FP_SUPPORT
+		{ "NaN", JSON_TOK_NUMBER },
+		{ "Infinity", JSON_TOK_NUMBER },
+		{ "-Infinity", JSON_TOK_NUMBER },
+#endif
+	};
+	const char *word = stream->buf;
+	size_t len = stream->len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(literals); i++) {
+		if (len == strlen(literals[i].word) && memcmp(word, literals[i].word, len) == 0) {
+			return literals[i].token;
+		}
+	}
+
+	if (isdigit((unsigned char)word[0]) == 0 &&
+	    (len < 2 || word[0] != '-' || isdigit((unsigned char)word[1]) == 0)) {
+		return JSON_TOK_ERROR;
+	}
+
+	/* Same characters as lexer_number() accepts */
+	for (size_t i = 0; i < len; i++) {
+		if (isdigit((unsigned char)word[i]) == 0 && strchr(".e+-", word[i]) == NULL) {
+			return JSON_TOK_ERROR;
+		}
+	}
+
+	return JSON_TOK_NUMBER;
+}
+
+static int stream_lex(struct json_stream *stream, char chr)
+{
+	switch (stream->lex_state) {
+	case STREAM_LEX_STRING:
+		if (chr == '"') {
+			stream->lex_state = STREAM_LEX_TOKEN;
+			return stream_token(stream, JSON_TOK_STRING);
+		}
+
+		if (chr == '\0') {
+			return -EINVAL;
+		}
+
+		if (chr == '\\') {
+			stream->lex_state = STREAM_LEX_ESCAPE;
+		}
+
+		return stream_append(stream, chr);
+	case STREAM_LEX_ESCAPE:
+		if (chr == 'u') {
+			stream->hex_left = 4;
+			stream->lex_state = STREAM_LEX_UNICODE;
+		} else if (strchr("\"\\/bfnrt", chr) != NULL && chr != '\0') {
+			stream->lex_state = STREAM_LEX_STRING;
+		} else {
+			return -EINVAL;
+		}
+
+		return stream_append(stream, chr);
+	case STREAM_LEX_UNICODE:
+		if (isxdigit((unsigned char)chr) == 0) {
+			return -EINVAL;
+		}
+
+		if (--stream->hex_left == 0) {
+			stream->lex_state = STREAM_LEX_STRING;
+		}
+
+		return stream_append(stream, chr);
+	case STREAM_LEX_WORD: {
+		enum json_tokens type;
+		int ret;
+
+		if (stream_is_word_char(chr)) {
+			return stream_append(stream, chr);
+		}
+
+		type = stream_word_token(stream);
+		if (type == JSON_TOK_ERROR) {
+			return -EINVAL;
+		}
+
+		ret = stream_token(stream, type);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* The character ending the word starts the next token */
+		stream->lex_state = STREAM_LEX_TOKEN;
+		return stream_lex(stream, chr);
+	}
+	default:
+		break;
+	}
+
+	switch (chr) {
+	case '{':
+	case '}':
+	case '[':
+	case ']':
+	case ',':
+	case ':':
+		return stream_token(stream, (enum json_tokens)chr);
+	case '"':
+		/* Values of fields that are skipped need not fit */
+		stream->discard = !stream_keeps_value(stream);
+		stream->len = 0;
+		stream->lex_state = STREAM_LEX_STRING;
+		return 0;
+	default:
+		if (isspace((unsigned char)chr) != 0) {
+			return 0;
+		}
+
+		if (!stream_is_word_char(chr)) {
+			return -EINVAL;
+		}
+
+		/* Words are always kept, to tell them apart */
+		stream->discard = false;
+		stream->len = 0;
+		stream->lex_state = STREAM_LEX_WORD;
+		return stream_append(stream, chr);
+	}
+}
+
+void json_stream_obj_parse_init(struct json_stream *stream, char *buf, size_t buf_size,
+				const struct json_obj_descr *descr, size_t descr_len,
+				void *val)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->result) * CHAR_BIT - 1));
+
+	*stream = (struct json_stream) {
+		.buf = buf,
+		.buf_size = buf_size,
+		.result = -EAGAIN,
+		.lex_state = STREAM_LEX_TOKEN,
+	};
+
+	/* The top-level object, only pushed once its start is found */
+	stream->frames[0].descr = descr;
+	stream->frames[0].descr_len = descr_len;
+	stream->frames[0].base = val;
+}
+
+int64_t json_stream_obj_parse(struct json_stream *stream, const char *data, size_t len)
+{
+	for (size_t i = 0; i < len && stream->result == -EAGAIN; i++) {
+		int ret = stream_lex(stream, data[i]);
+
+		if (ret < 0) {
+			stream->result = ret;
+		}
+	}
+
+	return stream->result;
+}
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
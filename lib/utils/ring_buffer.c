@@ -38,8 +38,8 @@ int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
 		return -EINVAL;
 	}
 
-	ring->tail += size;
-	ring->head = ring->tail;
+	ring->head = ring->tail + size;
+	ring_buf_idx_release(&ring->tail, ring->head);
 
 	tail_offset = ring->tail - ring->base;
 	if (unlikely(tail_offset >= buf->size)) {
@@ -50,23 +50,37 @@ int ring_buf_area_finish(struct ring_buf *buf, struct ring_buf_index *ring,
 	return 0;
 }
 
+static uint32_t ring_buf_area_claim_vec(struct ring_buf *buf, struct ring_buf_index *ring,
+					struct ring_buf_vec vec[2], uint32_t size)
+{
+	/* the second claim starts at the beginning of the buffer if the first wrapped */
+	vec[0].len = ring_buf_area_claim(buf, ring, &vec[0].data, size);
+	vec[1].len = ring_buf_area_claim(buf, ring, &vec[1].data, size - vec[0].len);
+
+	return vec[0].len + vec[1].len;
+}
+
+uint32_t ring_buf_put_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2],
+				uint32_t size)
+{
+	return ring_buf_area_claim_vec(buf, &buf->put, vec, MIN(size, ring_buf_space_get(buf)));
+}
+
+uint32_t ring_buf_get_claim_vec(struct ring_buf *buf, struct ring_buf_vec vec[2],
+				uint32_t size)
+{
+	return ring_buf_area_claim_vec(buf, &buf->get, vec, MIN(size, ring_buf_size_get(buf)));
+}
+
 uint32_t ring_buf_put(struct ring_buf *buf, const uint8_t *data, uint32_t size)
 {
-	uint8_t *dst;
-	uint32_t partial_size;
-	uint32_t total_size = 0U;
+	struct ring_buf_vec vec[2];
+	uint32_t total_size;
 	int err;
 
-	do {
-		partial_size = ring_buf_put_claim(buf, &dst, size);
-		if (partial_size == 0) {
-			break;
-		}
-		memcpy(dst, data, partial_size);
-		total_size += partial_size;
-		size -= partial_size;
-		data += partial_size;
-	} while (size != 0);
+	total_size = ring_buf_put_claim_vec(buf, vec, size);
+	memcpy(vec[0].data, data, vec[0].len);
+	memcpy(vec[1].data, data + vec[0].len, vec[1].len);
 
 	err = ring_buf_put_finish(buf, total_size);
 	__ASSERT_NO_MSG(err == 0);
@@ -77,23 +91,15 @@ uint32_t ring_buf_put(struct ring_buf *buf, const uint8_t *data, uint32_t size)
 
 uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size)
 {
-	uint8_t *src;
-	uint32_t partial_size;
-	uint32_t total_size = 0U;
+	struct ring_buf_vec vec[2];
+	uint32_t total_size;
 	int err;
 
-	do {
-		partial_size = ring_buf_get_claim(buf, &src, size);
-		if (partial_size == 0) {
-			break;
-		}
-		if (data) {
-			memcpy(data, src, partial_size);
-			data += partial_size;
-		}
-		total_size += partial_size;
-		size -= partial_size;
-	} while (size != 0);
+	total_size = ring_buf_get_claim_vec(buf, vec, size);
+	if (data) {
+		memcpy(data, vec[0].data, vec[0].len);
+		memcpy(data + vec[0].len, vec[1].data, vec[1].len);
+	}
 
 	err = ring_buf_get_finish(buf, total_size);
 	__ASSERT_NO_MSG(err == 0);
@@ -104,22 +110,15 @@ uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size)
 
 uint32_t ring_buf_peek(struct ring_buf *buf, uint8_t *data, uint32_t size)
 {
-	uint8_t *src;
-	uint32_t partial_size;
-	uint32_t total_size = 0U;
+	struct ring_buf_vec vec[2];
+	uint32_t total_size;
 	int err;
 
-	do {
-		partial_size = ring_buf_get_claim(buf, &src, size);
-		if (partial_size == 0) {
-			break;
-		}
-		__ASSERT_NO_MSG(data != NULL);
-		memcpy(data, src, partial_size);
-		data += partial_size;
-		total_size += partial_size;
-		size -= partial_size;
-	} while (size != 0);
+	__ASSERT_NO_MSG(data != NULL || size == 0);
+
+	total_size = ring_buf_get_claim_vec(buf, vec, size);
+	memcpy(data, vec[0].data, vec[0].len);
+	memcpy(data + vec[0].len, vec[1].data, vec[1].len);
 
 	/* effectively unclaim total_size bytes */
 	err = ring_buf_get_finish(buf, 0);
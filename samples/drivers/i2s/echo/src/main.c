@@ -131,10 +131,13 @@ static bool init_buttons(void)
 	return true;
 }
 
-static void process_block_data(void *mem_block, uint32_t number_of_samples)
+static void process_block_data(void *mem_block, size_t size, void *user_data)
 {
+	const size_t number_of_samples = MIN(size / sizeof(int16_t), SAMPLES_PER_BLOCK);
 	static bool clear_echo_block;
 
+	ARG_UNUSED(user_data);
+
 	if (echo_enabled) {
 		for (int i = 0; i < number_of_samples; ++i) {
 			int16_t *sample = &((int16_t *)mem_block)[i];
@@ -316,21 +319,11 @@ int main(void)
 		printk("Streams started\n");
 
 		while (k_sem_take(&toggle_transfer, K_NO_WAIT) != 0) {
-			void *mem_block;
-			uint32_t block_size;
 			int ret;
 
-			ret = i2s_read(i2s_dev_rx, &mem_block, &block_size);
-			if (ret < 0) {
-				printk("Failed to read data: %d\n", ret);
-				break;
-			}
-
-			process_block_data(mem_block, SAMPLES_PER_BLOCK);
-
-			ret = i2s_write(i2s_dev_tx, mem_block, block_size);
+			ret = i2s_relay(i2s_dev_rx, i2s_dev_tx, process_block_data, NULL);
 			if (ret < 0) {
-				printk("Failed to write data: %d\n", ret);
+				printk("Failed to relay data: %d\n", ret);
 				break;
 			}
 		}
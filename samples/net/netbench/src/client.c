@@ -0,0 +1,313 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+
+#include "netbench.h"
+
+static uint8_t tx_buf[CONFIG_NETBENCH_BUF_SIZE];
+static uint8_t rx_buf[CONFIG_NETBENCH_BUF_SIZE];
+
+static int parse_count(const struct shell *sh, const char *str, unsigned long max,
+		       uint32_t *value)
+{
+	char *end;
+	unsigned long res = strtoul(str, &end, 10);
+
+	if (*end != '\0' || res == 0 || res > max) {
+		PR_ERROR("Invalid value %s, expected 1..%lu\n", str, max);
+		return -EINVAL;
+	}
+
+	*value = res;
+
+	return 0;
+}
+
+static int set_timeout(int sock)
+{
+	struct zsock_timeval tv = {
+		.tv_sec = CONFIG_NETBENCH_RECV_TIMEOUT / MSEC_PER_SEC,
+		.tv_usec = (CONFIG_NETBENCH_RECV_TIMEOUT % MSEC_PER_SEC) * USEC_PER_MSEC,
+	};
+
+	return zsock_setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+static int tcp_connect(const struct shell *sh, const struct sockaddr *peer)
+{
+	int one = 1;
+	int sock;
+
+	sock = zsock_socket(peer->sa_family, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		int err = -errno;
+
+		PR_ERROR("Cannot create TCP socket (%d)\n", err);
+		return err;
+	}
+
+	/* Requests are small and latency bound, do not wait to coalesce them */
+	(void)zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	(void)set_timeout(sock);
+
+	if (zsock_connect(sock, peer, sizeof(struct sockaddr)) < 0) {
+		int err = -errno;
+
+		PR_ERROR("Cannot connect (%d)\n", err);
+		zsock_close(sock);
+		return err;
+	}
+
+	return sock;
+}
+
+/* One request and its echoed response, returns the round trip time in microseconds */
+static int tcp_transaction(int sock, size_t size, uint32_t *usec)
+{
+	uint32_t start = k_cycle_get_32();
+	size_t received = 0;
+	ssize_t ret;
+
+	ret = zsock_send(sock, tx_buf, size, 0);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	while (received < size) {
+		ret = zsock_recv(sock, rx_buf + received, size - received, 0);
+		if (ret < 0) {
+			return -errno;
+		} else if (ret == 0) {
+			return -ECONNRESET;
+		}
+
+		received += ret;
+	}
+
+	*usec = netbench_elapsed_us(start);
+
+	return 0;
+}
+
+static void report_rate(const struct shell *sh, const char *what, uint32_t count,
+			uint32_t elapsed_us)
+{
+	uint64_t rate = ((uint64_t)count * USEC_PER_SEC) / MAX(elapsed_us, 1U);
+
+	PR("%u %s in %u ms, %u/s\n", count, what, elapsed_us / USEC_PER_MSEC, (uint32_t)rate);
+}
+
+int cmd_udp_pps(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct sockaddr peer;
+	uint32_t size, duration, sent = 0, echoed = 0, failed = 0;
+	uint32_t start, elapsed;
+	int sock, ret;
+
+	if (netbench_parse_peer(sh, argv[1], argv[2], &peer) < 0 ||
+	    parse_count(sh, argv[3], sizeof(tx_buf), &size) < 0 ||
+	    parse_count(sh, argv[4], UINT32_MAX / USEC_PER_MSEC, &duration) < 0) {
+		return -EINVAL;
+	}
+
+	sock = zsock_socket(peer.sa_family, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		ret = -errno;
+		PR_ERROR("Cannot create UDP socket (%d)\n", ret);
+		return ret;
+	}
+
+	if (zsock_connect(sock, &peer, sizeof(peer)) < 0) {
+		ret = -errno;
+		PR_ERROR("Cannot connect (%d)\n", ret);
+		zsock_close(sock);
+		return ret;
+	}
+
+	netbench_stats_begin();
+	start = k_cycle_get_32();
+
+	do {
+		if (zsock_send(sock, tx_buf, size, 0) < 0) {
+			failed++;
+		} else {
+			sent++;
+		}
+
+		/* Count the echoes without ever waiting for them */
+		while (zsock_recv(sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT) > 0) {
+			echoed++;
+		}
+
+		elapsed = netbench_elapsed_us(start);
+	} while (elapsed < duration * USEC_PER_MSEC);
+
+	/* Let the echoes that are still in flight arrive */
+	k_msleep(CONFIG_NETBENCH_RECV_TIMEOUT);
+
+	while (zsock_recv(sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT) > 0) {
+		echoed++;
+	}
+
+	zsock_close(sock);
+
+	PR("UDP %u byte datagrams\n", size);
+	report_rate(sh, "sent", sent, elapsed);
+	report_rate(sh, "echoed", echoed, elapsed);
+
+	if (failed > 0) {
+		PR("%u send failures\n", failed);
+	}
+
+	netbench_stats_report(sh);
+
+	return 0;
+}
+
+int cmd_tcp_crr(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct sockaddr peer;
+	uint32_t count, usec, start, done = 0;
+	int sock, ret = 0;
+
+	if (netbench_parse_peer(sh, argv[1], argv[2], &peer) < 0 ||
+	    parse_count(sh, argv[3], UINT32_MAX, &count) < 0) {
+		return -EINVAL;
+	}
+
+	netbench_latency_reset();
+	netbench_stats_begin();
+	start = k_cycle_get_32();
+
+	for (; done < count; done++) {
+		uint32_t conn_start = k_cycle_get_32();
+
+		sock = tcp_connect(sh, &peer);
+		if (sock < 0) {
+			ret = sock;
+			break;
+		}
+
+		ret = tcp_transaction(sock, 1, &usec);
+		zsock_close(sock);
+
+		if (ret < 0) {
+			PR_ERROR("Transaction %u failed (%d)\n", done, ret);
+			break;
+		}
+
+		netbench_latency_add(netbench_elapsed_us(conn_start));
+	}
+
+	report_rate(sh, "connections", done, netbench_elapsed_us(start));
+	netbench_latency_report(sh);
+	netbench_stats_report(sh);
+
+	return ret;
+}
+
+int cmd_tcp_rr(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct sockaddr peer;
+	uint32_t count, size = 1, usec, start, done = 0;
+	int sock, ret = 0;
+
+	if (netbench_parse_peer(sh, argv[1], argv[2], &peer) < 0 ||
+	    parse_count(sh, argv[3], UINT32_MAX, &count) < 0 ||
+	    (argc > 4 && parse_count(sh, argv[4], sizeof(tx_buf), &size) < 0)) {
+		return -EINVAL;
+	}
+
+	sock = tcp_connect(sh, &peer);
+	if (sock < 0) {
+		return sock;
+	}
+
+	netbench_latency_reset();
+	netbench_stats_begin();
+	start = k_cycle_get_32();
+
+	for (; done < count; done++) {
+		ret = tcp_transaction(sock, size, &usec);
+		if (ret < 0) {
+			PR_ERROR("Transaction %u failed (%d)\n", done, ret);
+			break;
+		}
+
+		netbench_latency_add(usec);
+	}
+
+	report_rate(sh, "transactions", done, netbench_elapsed_us(start));
+	zsock_close(sock);
+
+	netbench_latency_report(sh);
+	netbench_stats_report(sh);
+
+	return ret;
+}
+
+int cmd_tcp_scale(const struct shell *sh, size_t argc, char *argv[])
+{
+	int socks[CONFIG_NETBENCH_MAX_SOCKETS];
+	struct sockaddr peer;
+	uint32_t num, rounds, usec, start, open = 0, done = 0;
+	int ret = 0;
+
+	if (netbench_parse_peer(sh, argv[1], argv[2], &peer) < 0 ||
+	    parse_count(sh, argv[3], ARRAY_SIZE(socks), &num) < 0 ||
+	    parse_count(sh, argv[4], UINT32_MAX / ARRAY_SIZE(socks), &rounds) < 0) {
+		return -EINVAL;
+	}
+
+	start = k_cycle_get_32();
+
+	for (; open < num; open++) {
+		socks[open] = tcp_connect(sh, &peer);
+		if (socks[open] < 0) {
+			ret = socks[open];
+			goto out;
+		}
+	}
+
+	report_rate(sh, "connections opened", open, netbench_elapsed_us(start));
+
+	netbench_latency_reset();
+	netbench_stats_begin();
+	start = k_cycle_get_32();
+
+	/* Spread the transactions over all connections so every one is looked up in turn */
+	for (uint32_t round = 0; round < rounds; round++) {
+		for (uint32_t i = 0; i < num; i++) {
+			ret = tcp_transaction(socks[i], 1, &usec);
+			if (ret < 0) {
+				PR_ERROR("Transaction on socket %u failed (%d)\n", i, ret);
+				goto report;
+			}
+
+			netbench_latency_add(usec);
+			done++;
+		}
+	}
+
+report:
+	PR("%u sockets\n", num);
+	report_rate(sh, "transactions", done, netbench_elapsed_us(start));
+	netbench_latency_report(sh);
+	netbench_stats_report(sh);
+
+out:
+	while (open > 0) {
+		zsock_close(socks[--open]);
+	}
+
+	return ret;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_netbench_sample, LOG_LEVEL_DBG);
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_stats.h>
+
+#include "netbench.h"
+
+static struct {
+	uint32_t samples[CONFIG_NETBENCH_MAX_SAMPLES];
+	size_t count;
+	uint32_t total;
+	uint64_t sum;
+	uint32_t max;
+} latency;
+
+void netbench_latency_reset(void)
+{
+	latency.count = 0;
+	latency.total = 0;
+	latency.sum = 0;
+	latency.max = 0;
+}
+
+void netbench_latency_add(uint32_t usec)
+{
+	if (latency.count < ARRAY_SIZE(latency.samples)) {
+		latency.samples[latency.count++] = usec;
+	}
+
+	latency.total++;
+	latency.sum += usec;
+	latency.max = MAX(latency.max, usec);
+}
+
+static int latency_compare(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t latency_percentile(unsigned int per10k)
+{
+	return latency.samples[MIN((latency.count * per10k) / 10000U, latency.count - 1)];
+}
+
+void netbench_latency_report(const struct shell *sh)
+{
+	if (latency.count == 0) {
+		PR("Latency: no samples\n");
+		return;
+	}
+
+	qsort(latency.samples, latency.count, sizeof(latency.samples[0]), latency_compare);
+
+	PR("Latency (us): min %u avg %u p50 %u p90 %u p99 %u p99.9 %u max %u\n",
+	   latency.samples[0], (uint32_t)(latency.sum / latency.total),
+	   latency_percentile(5000), latency_percentile(9000), latency_percentile(9900),
+	   latency_percentile(9990), latency.max);
+
+	if (latency.total > latency.count) {
+		PR("Percentiles taken from the first %zu of %u transactions\n",
+		   latency.count, latency.total);
+	}
+}
+
+#if defined(CONFIG_NET_STATISTICS_USER_API) &&                                                     \
+	(defined(CONFIG_NET_PKT_RXTIME_STATS) || defined(CONFIG_NET_PKT_TXTIME_STATS))
+static struct net_stats stats_start;
+
+void netbench_stats_begin(void)
+{
+	(void)net_mgmt(NET_REQUEST_STATS_GET_ALL, NULL, &stats_start, sizeof(stats_start));
+}
+
+#define STATS_DIFF(field) (stats.field - stats_start.field)
+
+static void stats_print(const struct shell *sh, const char *dir, uint64_t sum,
+			net_stats_t count)
+{
+	PR("%s: %u packets, avg %u us in the stack", dir, count,
+	   count == 0 ? 0 : (uint32_t)(sum / count));
+}
+
+/* Time between consecutive timestamping points of the detail statistics */
+static void stats_print_detail(const struct shell *sh, int stage, uint64_t sum,
+			       net_stats_t count)
+{
+	if (stage == 0) {
+		PR(", per stage (us):");
+	}
+
+	PR(" %u", count == 0 ? 0 : (uint32_t)(sum / count));
+}
+
+void netbench_stats_report(const struct shell *sh)
+{
+	static struct net_stats stats;
+
+	if (net_mgmt(NET_REQUEST_STATS_GET_ALL, NULL, &stats, sizeof(stats)) < 0) {
+		return;
+	}
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+	stats_print(sh, "RX", STATS_DIFF(rx_time.sum), STATS_DIFF(rx_time.count));
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats_print_detail(sh, i, STATS_DIFF(rx_time_detail[i].sum),
+				   STATS_DIFF(rx_time_detail[i].count));
+	}
+#endif
+	PR("\n");
+#endif
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+	stats_print(sh, "TX", STATS_DIFF(tx_time.sum), STATS_DIFF(tx_time.count));
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats_print_detail(sh, i, STATS_DIFF(tx_time_detail[i].sum),
+				   STATS_DIFF(tx_time_detail[i].count));
+	}
+#endif
+	PR("\n");
+#endif
+}
+#else
+void netbench_stats_begin(void)
+{
+}
+
+void netbench_stats_report(const struct shell *sh)
+{
+	ARG_UNUSED(sh);
+}
+#endif
+
+int netbench_parse_peer(const struct shell *sh, const char *addr, const char *port,
+			struct sockaddr *peer)
+{
+	char *end;
+	unsigned long value = CONFIG_NETBENCH_PORT;
+
+	memset(peer, 0, sizeof(*peer));
+
+	if (!net_ipaddr_parse(addr, strlen(addr), peer)) {
+		PR_ERROR("Invalid address %s\n", addr);
+		return -EINVAL;
+	}
+
+	if (port != NULL) {
+		value = strtoul(port, &end, 10);
+		if (*end != '\0' || value == 0 || value > UINT16_MAX) {
+			PR_ERROR("Invalid port %s\n", port);
+			return -EINVAL;
+		}
+	}
+
+	if (peer->sa_family == AF_INET6) {
+		net_sin6(peer)->sin6_port = htons(value);
+	} else {
+		net_sin(peer)->sin_port = htons(value);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(netbench_server_commands,
+	SHELL_CMD_ARG(start, NULL,
+		      "Start the UDP and TCP echo server\n"
+		      "[<port>]",
+		      cmd_server_start, 1, 1),
+	SHELL_CMD_ARG(stop, NULL,
+		      "Stop the echo server",
+		      cmd_server_stop, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(netbench_commands,
+	SHELL_CMD_ARG(udp_pps, NULL,
+		      "Send small UDP datagrams as fast as possible\n"
+		      "<address> <port> <size> <duration ms>",
+		      cmd_udp_pps, 5, 0),
+	SHELL_CMD_ARG(tcp_crr, NULL,
+		      "Connect, do one transaction and close, repeatedly\n"
+		      "<address> <port> <count>",
+		      cmd_tcp_crr, 4, 0),
+	SHELL_CMD_ARG(tcp_rr, NULL,
+		      "Request and response over one TCP connection\n"
+		      "<address> <port> <count> [<size>]",
+		      cmd_tcp_rr, 4, 1),
+	SHELL_CMD_ARG(tcp_scale, NULL,
+		      "Request and response over many TCP connections in turn\n"
+		      "<address> <port> <sockets> <rounds>",
+		      cmd_tcp_scale, 5, 0),
+	SHELL_CMD(server, &netbench_server_commands, "Echo server commands", NULL),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(netbench, &netbench_commands, "Network benchmarks", NULL);
+
+int main(void)
+{
+	LOG_INF("Run the benchmarks with the \"netbench\" shell commands");
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __NETBENCH_H
+#define __NETBENCH_H
+
+#include <zephyr/net/socket.h>
+#include <zephyr/shell/shell.h>
+
+#define PR(fmt, ...) shell_fprintf(sh, SHELL_NORMAL, fmt, ##__VA_ARGS__)
+#define PR_ERROR(fmt, ...) shell_fprintf(sh, SHELL_ERROR, fmt, ##__VA_ARGS__)
+
+/* Latency distribution of the transactions of a benchmark run */
+void netbench_latency_reset(void);
+void netbench_latency_add(uint32_t usec);
+void netbench_latency_report(const struct shell *sh);
+
+/* Network stack RX and TX processing time over a benchmark run */
+void netbench_stats_begin(void);
+void netbench_stats_report(const struct shell *sh);
+
+int netbench_parse_peer(const struct shell *sh, const char *addr, const char *port,
+			struct sockaddr *peer);
+
+static inline uint32_t netbench_elapsed_us(uint32_t start)
+{
+	return (uint32_t)k_cyc_to_us_floor64(k_cycle_get_32() - start);
+}
+
+int cmd_udp_pps(const struct shell *sh, size_t argc, char *argv[]);
+int cmd_tcp_crr(const struct shell *sh, size_t argc, char *argv[]);
+int cmd_tcp_rr(const struct shell *sh, size_t argc, char *argv[]);
+int cmd_tcp_scale(const struct shell *sh, size_t argc, char *argv[]);
+int cmd_server_start(const struct shell *sh, size_t argc, char *argv[]);
+int cmd_server_stop(const struct shell *sh, size_t argc, char *argv[]);
+
+#endif /* __NETBENCH_H */
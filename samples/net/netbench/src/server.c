@@ -0,0 +1,221 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_netbench_sample, LOG_LEVEL_DBG);
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+
+#include "netbench.h"
+
+#define STACK_SIZE 2048
+#define THREAD_PRIORITY K_PRIO_PREEMPT(8)
+
+/* How often the server thread checks whether it has been stopped */
+#define POLL_TIMEOUT_MS 250
+
+/* The UDP socket, the TCP listening socket and the accepted connections */
+#define FD_UDP		0
+#define FD_LISTEN	1
+#define FD_CLIENT	2
+#define NUM_FDS		(FD_CLIENT + CONFIG_NETBENCH_MAX_SOCKETS)
+
+BUILD_ASSERT(NUM_FDS <= CONFIG_ZVFS_POLL_MAX, "Increase CONFIG_ZVFS_POLL_MAX");
+
+static K_THREAD_STACK_DEFINE(server_stack, STACK_SIZE);
+static struct k_thread server_thread;
+static struct zsock_pollfd fds[NUM_FDS];
+static uint8_t buf[CONFIG_NETBENCH_BUF_SIZE];
+static atomic_t running;
+
+static int server_socket(int type, uint16_t port)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_addr = IN6ADDR_ANY_INIT,
+		.sin6_port = htons(port),
+	};
+	int one = 1;
+	int sock;
+
+	/* A dual stack socket serves both IPv4 and IPv6 peers */
+	sock = zsock_socket(AF_INET6, type, type == SOCK_STREAM ? IPPROTO_TCP : IPPROTO_UDP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	(void)zsock_setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+	if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    (type == SOCK_STREAM && zsock_listen(sock, CONFIG_NETBENCH_MAX_SOCKETS) < 0)) {
+		int err = -errno;
+
+		zsock_close(sock);
+		return err;
+	}
+
+	return sock;
+}
+
+static void close_fd(struct zsock_pollfd *pfd)
+{
+	if (pfd->fd >= 0) {
+		zsock_close(pfd->fd);
+		pfd->fd = -1;
+	}
+}
+
+static void accept_client(void)
+{
+	int one = 1;
+	int sock;
+
+	sock = zsock_accept(fds[FD_LISTEN].fd, NULL, NULL);
+	if (sock < 0) {
+		return;
+	}
+
+	for (int i = FD_CLIENT; i < NUM_FDS; i++) {
+		if (fds[i].fd < 0) {
+			(void)zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+			fds[i].fd = sock;
+			return;
+		}
+	}
+
+	LOG_WRN("Too many connections, increase CONFIG_NETBENCH_MAX_SOCKETS");
+	zsock_close(sock);
+}
+
+static void echo_udp(void)
+{
+	struct sockaddr peer;
+	socklen_t peer_len = sizeof(peer);
+	ssize_t len;
+
+	len = zsock_recvfrom(fds[FD_UDP].fd, buf, sizeof(buf), 0, &peer, &peer_len);
+	if (len > 0) {
+		(void)zsock_sendto(fds[FD_UDP].fd, buf, len, 0, &peer, peer_len);
+	}
+}
+
+static void echo_tcp(struct zsock_pollfd *pfd)
+{
+	ssize_t len, sent;
+
+	len = zsock_recv(pfd->fd, buf, sizeof(buf), 0);
+	if (len <= 0) {
+		close_fd(pfd);
+		return;
+	}
+
+	for (ssize_t pos = 0; pos < len; pos += sent) {
+		sent = zsock_send(pfd->fd, buf + pos, len - pos, 0);
+		if (sent < 0) {
+			close_fd(pfd);
+			return;
+		}
+	}
+}
+
+static void server_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&running) != 0) {
+		if (zsock_poll(fds, ARRAY_SIZE(fds), POLL_TIMEOUT_MS) <= 0) {
+			continue;
+		}
+
+		if (fds[FD_UDP].revents & ZSOCK_POLLIN) {
+			echo_udp();
+		}
+
+		if (fds[FD_LISTEN].revents & ZSOCK_POLLIN) {
+			accept_client();
+		}
+
+		for (int i = FD_CLIENT; i < NUM_FDS; i++) {
+			if (fds[i].revents & (ZSOCK_POLLIN | ZSOCK_POLLERR | ZSOCK_POLLHUP)) {
+				echo_tcp(&fds[i]);
+			}
+		}
+	}
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		close_fd(&fds[i]);
+	}
+}
+
+int cmd_server_start(const struct shell *sh, size_t argc, char *argv[])
+{
+	uint16_t port = CONFIG_NETBENCH_PORT;
+	int ret;
+
+	if (argc > 1) {
+		char *end;
+		unsigned long value = strtoul(argv[1], &end, 10);
+
+		if (*end != '\0' || value == 0 || value > UINT16_MAX) {
+			PR_ERROR("Invalid port %s\n", argv[1]);
+			return -EINVAL;
+		}
+
+		port = value;
+	}
+
+	if (!atomic_cas(&running, 0, 1)) {
+		PR_ERROR("Server already running\n");
+		return -EALREADY;
+	}
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		fds[i].fd = -1;
+		fds[i].events = ZSOCK_POLLIN;
+	}
+
+	fds[FD_UDP].fd = server_socket(SOCK_DGRAM, port);
+	fds[FD_LISTEN].fd = server_socket(SOCK_STREAM, port);
+
+	if (fds[FD_UDP].fd < 0 || fds[FD_LISTEN].fd < 0) {
+		ret = fds[FD_UDP].fd < 0 ? fds[FD_UDP].fd : fds[FD_LISTEN].fd;
+		PR_ERROR("Cannot create server sockets (%d)\n", ret);
+		close_fd(&fds[FD_UDP]);
+		close_fd(&fds[FD_LISTEN]);
+		atomic_set(&running, 0);
+		return ret;
+	}
+
+	k_thread_create(&server_thread, server_stack, K_THREAD_STACK_SIZEOF(server_stack),
+			server_entry, NULL, NULL, NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&server_thread, "netbench_server");
+
+	PR("UDP and TCP echo server listening on port %u\n", port);
+
+	return 0;
+}
+
+int cmd_server_stop(const struct shell *sh, size_t argc, char *argv[])
+{
+	if (!atomic_cas(&running, 1, 0)) {
+		PR_ERROR("Server not running\n");
+		return -EALREADY;
+	}
+
+	k_thread_join(&server_thread, K_FOREVER);
+
+	PR("Echo server stopped\n");
+
+	return 0;
+}
@@ -25,14 +25,17 @@ def test_shell_perf(dut: DeviceAdapter, shell: Shell):
     logger.info('send "perf printbuf" command')
     lines = shell.exec_command('perf printbuf')
     lines = lines[1:-1]
-    match = re.match(r"Perf buf length (\d+)", lines[0])
+    match = re.match(r"Perf (folded )?buf length (\d+)", lines[0])
     assert match is not None, 'expected response not found'
-    length = int(match.group(1))
+    # Folded traces are preceded by their sample count
+    header = 2 if match.group(1) else 1
+    length = int(match.group(2))
     lines = lines[1:]
     assert length != 0, '0 length'
     assert length == len(lines), 'length dose not match with count of lines'
 
     i = 0
     while i < length:
-        i += int(lines[i], 16) + 1
+        assert i + header <= length, 'one of the samples is not true to size'
+        i += int(lines[i + header - 1], 16) + header
         assert i <= length, 'one of the samples is not true to size'
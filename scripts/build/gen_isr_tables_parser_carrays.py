@@ -25,6 +25,13 @@ typedef void (* ISR)(const void *);
 #ifndef ARCH_IRQ_VECTOR_JUMP_CODE
 #error "ARCH_IRQ_VECTOR_JUMP_CODE not defined"
 #endif
+"""
+
+    source_trampolines_header = """
+#ifndef ARCH_IRQ_TRAMPOLINE_SIZE
+#error "ARCH_IRQ_TRAMPOLINE_SIZE not defined"
+#endif
+
 """
 
     def __init__(self, intlist_data, config, log):
@@ -198,10 +205,21 @@ typedef void (* ISR)(const void *);
         fp.write("}\n")
 
     def __write_address_irq_vector_table(self, fp):
+        trampolines = self.__config.check_sym("CONFIG_GEN_IRQ_TRAMPOLINES")
+
+        if trampolines:
+            fp.write(self.source_trampolines_header)
+
         fp.write("const uintptr_t __irq_vector_table _irq_vector_table[%d] = {\n" % self.__nv)
         for i in range(self.__nv):
             func = self.__vt[i]
 
+            if func is None and trampolines:
+                # The trampoline of the line calls its _sw_isr_table entry
+                fp.write("\t((uintptr_t)&_irq_trampolines + {} * ARCH_IRQ_TRAMPOLINE_SIZE),\n"
+                         .format(i))
+                continue
+
             if func is None:
                 func = self.__config.vt_default_handler
 
@@ -526,6 +526,11 @@ def find_kobjects(elf, syms):
     if not elf.has_dwarf_info():
         sys.exit("ELF file has no DWARF information")
 
+    # Futex based sys_mutex are not kernel objects themselves, only their
+    # embedded k_futex is
+    if "CONFIG_SYS_MUTEX_FUTEX" in syms:
+        del kobjects["sys_mutex"]
+
     app_smem_start = syms["_app_smem_start"]
     app_smem_end = syms["_app_smem_end"]
 
@@ -27,6 +27,9 @@ COREDUMP_MEM_HDR_VER = 1
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
+COREDUMP_COMPRESSED_MEM_HDR_ID = b'C'
+COREDUMP_COMPRESSED_MEM_HDR_VER = 1
+
 
 logger = logging.getLogger("parser")
 
@@ -99,12 +102,13 @@ class CoredumpLogFile:
 
         return True
 
-    def parse_memory_section(self):
+    def parse_memory_section(self, compressed=False):
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
-            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
+        expected_ver = COREDUMP_COMPRESSED_MEM_HDR_VER if compressed else COREDUMP_MEM_HDR_VER
+        if hdr_ver != expected_ver:
+            logger.error(f"Memory block version: {hdr_ver}, expected {expected_ver}!")
             return False
 
         # Figure out how to read the start and end addresses
@@ -121,7 +125,19 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if compressed:
+            num_bytes, = struct.unpack("<I", self.fd.read(4))
+            data = self.fd.read(num_bytes)
+
+            try:
+                import lz4.block
+            except ImportError:
+                logger.error("Python package 'lz4' needed for compressed memory blocks")
+                return False
+
+            data = lz4.block.decompress(data, uncompressed_size=size)
+        else:
+            data = self.fd.read(size)
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -181,6 +197,10 @@ class CoredumpLogFile:
                 if not self.parse_memory_section():
                     logger.error("Cannot parse memory section")
                     return False
+            elif section_id == COREDUMP_COMPRESSED_MEM_HDR_ID:
+                if not self.parse_memory_section(compressed=True):
+                    logger.error("Cannot parse compressed memory section")
+                    return False
             else:
                 # Unknown section in log file
                 logger.error(f"Unknown section in log file with ID {section_id}")
@@ -996,8 +996,9 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
                 if event.id == 2:
                     callee = event.payload_field.get("callee").real
                     delta_t = event.payload_field.get("delta_t").real
+                    calls = event.payload_field.get("calls").real
 
-                    profiles.append((callee, delta_t))
+                    profiles.append((callee, delta_t, calls))
                     acc_delta_t = acc_delta_t + delta_t
 
         # Sort by delta_t
@@ -1008,7 +1009,7 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
         else:
             N = len(profiles)
 
-        for i, (callee, delta_t) in enumerate(profiles):
+        for i, (callee, delta_t, calls) in enumerate(profiles):
             if i == N:
                 break
             callee = f'{callee:08x}'
@@ -1032,6 +1033,8 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
                 color + (f'{percent_delta_t:.2f}' + "%").rjust(6),
                 callee,
                 callee_symbol.ljust(20),
+                f'{calls} calls'.rjust(14),
+                f'{delta_t // max(calls, 1)} ns/call'.rjust(16),
                 Fore.WHITE,
             )
 
@@ -17,6 +17,7 @@ import contextlib
 import logging
 import os
 import select
+import socket
 import sys
 import time
 
@@ -86,6 +87,31 @@ class FileReader:
         return self.file.read(1024)
 
 
+class UdpReader:
+    """Class to read datagrams from an UDP socket"""
+
+    def __init__(self, address, port):
+        self.address = address
+        self.port = port
+        self.sock = None
+
+    @contextlib.contextmanager
+    def open(self):
+        family = socket.AF_INET6 if ':' in self.address else socket.AF_INET
+        self.sock = socket.socket(family, socket.SOCK_DGRAM)
+        try:
+            self.sock.bind((self.address, self.port))
+            yield
+        finally:
+            self.sock.close()
+
+    def fileno(self):
+        return self.sock.fileno()
+
+    def read_non_blocking(self):
+        return self.sock.recv(65535)
+
+
 class JLinkRTTReader:
     """Class to read data from JLink's RTT"""
 
@@ -154,6 +180,11 @@ def parse_args():
 
     parser.add_argument("dbfile", help="Dictionary Logging Database file")
     parser.add_argument("--debug", action="store_true", help="Print extra debugging information")
+    parser.add_argument(
+        "--framed",
+        action="store_true",
+        help="Input data is framed (net and fs backends), implied by udp mode",
+    )
     parser.add_argument(
         "--polling-interval",
         type=float,
@@ -175,6 +206,11 @@ def parse_args():
         "filepath", nargs="?", default=None, help="Input file path, leave empty for stdin"
     )
 
+    # UDP subparser
+    udp_parser = subparsers.add_parser("udp", help="Receive from the network backend")
+    udp_parser.add_argument("--address", default="0.0.0.0", help="Address to listen on")
+    udp_parser.add_argument("--port", type=int, default=514, help="UDP port to listen on")
+
     # RTT subparser
     jlink_rtt_parser = subparsers.add_parser("jlink-rtt", help="Read from RTT")
     jlink_rtt_parser.add_argument(
@@ -213,6 +249,8 @@ def main():
         reader = SerialReader(args.port, args.baudrate)
     elif args.mode == "file":
         reader = FileReader(args.filepath)
+    elif args.mode == "udp":
+        reader = UdpReader(args.address, args.port)
     elif args.mode == "jlink-rtt":
         reader = JLinkRTTReader(
             args.target_device, args.block_address, args.channel, args.speed, args.lib_path
@@ -220,12 +258,24 @@ def main():
     else:
         raise ValueError("Invalid mode selected. Use 'serial' or 'file'.")
 
+    if args.mode == "udp" or args.framed:
+        decoder = parserlib.FrameDecoder(log_parser, logger)
+
     with reader.open():
         while True:
             if hasattr(reader, 'fileno'):
                 _, _, _ = select.select([reader], [], [])
             else:
                 time.sleep(args.polling_interval)
+
+            if args.mode == "udp":
+                decoder.feed_datagram(reader.read_non_blocking())
+                continue
+
+            if args.framed:
+                decoder.feed(reader.read_non_blocking())
+                continue
+
             data += reader.read_non_blocking()
             parsed_data_offset = parserlib.parser(data, log_parser, logger)
             data = data[parsed_data_offset:]
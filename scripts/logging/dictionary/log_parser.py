@@ -36,6 +36,8 @@ def parse_args():
                            help="Log Data file is in hexadecimal strings")
     argparser.add_argument("--rawhex", action="store_true",
                            help="Log file only contains hexadecimal log data")
+    argparser.add_argument("--framed", action="store_true",
+                           help="Log data is framed (net and fs backends)")
     argparser.add_argument("--debug", action="store_true",
                            help="Print extra debugging information")
 
@@ -127,6 +129,14 @@ def main():
         logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
         sys.exit(1)
 
+    if args.framed:
+        decoder = parserlib.FrameDecoder(log_parser, logger)
+        decoder.feed(logdata)
+        if len(decoder.data) > 1:
+            logger.error('ERROR: Last frame is incomplete')
+            sys.exit(1)
+        return
+
     parsed_data_offset = parserlib.parser(logdata, log_parser, logger)
     if parsed_data_offset != len(logdata):
         logger.error(
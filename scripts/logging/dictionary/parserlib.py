@@ -13,6 +13,7 @@ input binary data to the log using log database.
 """
 
 import logging
+import struct
 
 import dictionary_parser
 from dictionary_parser.log_database import LogDatabase
@@ -56,3 +57,83 @@ def parser(logdata, log_parser, logger):
 
     ret = log_parser.parse_log_data(logdata)
     return ret
+
+
+# Header of a frame holding one log message, see struct log_dict_output_frame_hdr_t
+FRAME_MAGIC = b"ZL"
+FRAME_VERSION = 1
+FRAME_HDR = struct.Struct(">2sBBHI")
+
+
+class FrameDecoder:
+    """Decoder of framed dictionary based log messages
+
+    Frames are received either as a stream, where the decoder resynchronizes
+    on the magic number after corrupted data, or one per datagram.
+    """
+
+    def __init__(self, log_parser, logger):
+        self.log_parser = log_parser
+        self.logger = logger
+        self.next_seq = None
+        self.data = b''
+
+    def _frame(self, hdr, payload):
+        _, _, _, _, seq = hdr
+
+        if self.next_seq is not None and seq != self.next_seq:
+            lost = (seq - self.next_seq) & 0xFFFFFFFF
+            self.logger.warning("--- %d frame(s) lost ---", lost)
+
+        self.next_seq = (seq + 1) & 0xFFFFFFFF
+
+        if self.log_parser.parse_log_data(payload) != len(payload):
+            self.logger.error("ERROR: malformed frame %d", seq)
+
+    def feed(self, data):
+        """Decode the complete frames of a stream, keeping the rest for later"""
+        self.data += data
+
+        while True:
+            start = self.data.find(FRAME_MAGIC)
+            if start < 0:
+                # Keep a byte which may start the magic number
+                self.data = self.data[-1:]
+                return
+
+            if start > 0:
+                self.logger.debug("Skipping %d bytes before frame", start)
+                self.data = self.data[start:]
+
+            if len(self.data) < FRAME_HDR.size:
+                return
+
+            hdr = FRAME_HDR.unpack_from(self.data)
+            if hdr[1] != FRAME_VERSION:
+                self.data = self.data[1:]
+                continue
+
+            end = FRAME_HDR.size + hdr[3]
+            if len(self.data) < end:
+                return
+
+            self._frame(hdr, self.data[FRAME_HDR.size:end])
+            self.data = self.data[end:]
+
+    def feed_datagram(self, data):
+        """Decode a datagram holding one frame"""
+        if len(data) < FRAME_HDR.size:
+            self.logger.error("ERROR: truncated frame header")
+            return
+
+        hdr = FRAME_HDR.unpack_from(data)
+        if hdr[0] != FRAME_MAGIC or hdr[1] != FRAME_VERSION:
+            self.logger.error("ERROR: invalid frame header")
+            return
+
+        if len(data) != FRAME_HDR.size + hdr[3]:
+            self.logger.error("ERROR: frame length mismatch (%d != %d)",
+                              len(data) - FRAME_HDR.size, hdr[3])
+            return
+
+        self._frame(hdr, data[FRAME_HDR.size:])
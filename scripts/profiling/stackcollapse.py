@@ -14,6 +14,9 @@ from addresses
 
 Usage:
     ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+
+Both the plain and the folded (CONFIG_PROFILING_PERF_FOLDED) output
+formats are accepted.
 """
 
 import re
@@ -35,8 +38,12 @@ def addr_to_sym(addr, elf):
     return "[unknown]"
 
 
-def collapse(buf, elf):
+def collapse(buf, elf, folded):
     while buf:
+        samples = 1
+        if folded:
+            samples, = struct.unpack_from(">Q", buf)
+            buf = buf[8:]
         count, = struct.unpack_from(">Q", buf)
         assert count > 0
         addrs = struct.unpack_from(f">{count}Q", buf, 8)
@@ -50,7 +57,7 @@ def collapse(buf, elf):
                 prev_func = func
                 line += ";" + func
 
-        print(line, 1)
+        print(line, samples)
         buf = buf[8 + 8 * count:]
 
 
@@ -60,6 +67,7 @@ if __name__ == "__main__":
         inp = f.read()
 
     lines = inp.splitlines()
-    assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
+    match = re.match(r"Perf (folded )?buf length (\d+)", lines[0])
+    assert int(match.group(2)) == len(lines) - 1
     buf = binascii.unhexlify("".join(lines[1:]))
-    collapse(buf, elf)
+    collapse(buf, elf, match.group(1) is not None)
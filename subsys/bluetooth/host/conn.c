@@ -65,6 +65,11 @@ LOG_MODULE_REGISTER(bt_conn);
 
 K_FIFO_DEFINE(free_tx);
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+/* TX contexts of the ISO channels, so that ACL traffic cannot use all of them */
+K_FIFO_DEFINE(free_iso_tx);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 #if defined(CONFIG_BT_CONN_TX_NOTIFY_WQ)
 static struct k_work_q conn_tx_workq;
 static K_KERNEL_STACK_DEFINE(conn_tx_workq_thread_stack, CONFIG_BT_CONN_TX_NOTIFY_WQ_STACK_SIZE);
@@ -207,7 +212,11 @@ static struct bt_conn_tx iso_tx[CONFIG_BT_ISO_TX_BUF_COUNT];
 int bt_conn_iso_init(void)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(iso_tx); i++) {
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+		k_fifo_put(&free_iso_tx, &iso_tx[i]);
+#else
 		k_fifo_put(&free_tx, &iso_tx[i]);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 	}
 
 	return 0;
@@ -275,6 +284,14 @@ static void tx_free(struct bt_conn_tx *tx)
 	LOG_DBG("%p", tx);
 	tx->cb = NULL;
 	tx->user_data = NULL;
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	if (IS_ARRAY_ELEMENT(iso_tx, tx)) {
+		k_fifo_put(&free_iso_tx, tx);
+		return;
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 	k_fifo_put(&free_tx, tx);
 }
 
@@ -510,14 +527,25 @@ void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 	}
 }
 
+static struct k_fifo *conn_free_tx(struct bt_conn *conn)
+{
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	if (bt_conn_is_iso(conn)) {
+		return &free_iso_tx;
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
+	return &free_tx;
+}
+
 static bool dont_have_tx_context(struct bt_conn *conn)
 {
-	return k_fifo_is_empty(&free_tx);
+	return k_fifo_is_empty(conn_free_tx(conn));
 }
 
-static struct bt_conn_tx *conn_tx_alloc(void)
+static struct bt_conn_tx *conn_tx_alloc(struct bt_conn *conn)
 {
-	struct bt_conn_tx *ret = k_fifo_get(&free_tx, K_NO_WAIT);
+	struct bt_conn_tx *ret = k_fifo_get(conn_free_tx(conn), K_NO_WAIT);
 
 	LOG_DBG("%p", ret);
 
@@ -683,7 +711,7 @@ static int send_buf(struct bt_conn *conn, struct net_buf *buf,
 	}
 
 	/* Allocate and set the TX context */
-	tx = conn_tx_alloc();
+	tx = conn_tx_alloc(conn);
 
 	/* See big comment above */
 	if (!tx) {
@@ -840,6 +868,13 @@ static bool should_stop_tx(struct bt_conn *conn)
 		return true;
 	}
 
+	/* ISO channels queue as many SDUs as their own controller buffers
+	 * allow, so that the SDUs of an interval are sent back to back.
+	 */
+	if (IS_ENABLED(CONFIG_BT_ISO_TX_SCHED) && bt_conn_is_iso(conn)) {
+		return false;
+	}
+
 	/* Queue only 3 buffers per-conn for now */
 	if (atomic_get(&conn->in_ll) < 3) {
 		/* The goal of this heuristic is to allow the link-layer to
@@ -857,8 +892,21 @@ static bool should_stop_tx(struct bt_conn *conn)
 	return true;
 }
 
+/* ISO channels have their own ready list, served before the ACL one */
+static sys_slist_t *conn_ready_list(struct bt_conn *conn)
+{
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	if (bt_conn_is_iso(conn)) {
+		return &bt_dev.le.iso_ready;
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
+	return &bt_dev.le.conn_ready;
+}
+
 void bt_conn_data_ready(struct bt_conn *conn)
 {
+	sys_slist_t *list = conn_ready_list(conn);
 	bool added;
 
 	LOG_DBG("DR");
@@ -871,8 +919,8 @@ void bt_conn_data_ready(struct bt_conn *conn)
 	 */
 	k_sched_lock();
 
-	if (!sys_slist_find(&bt_dev.le.conn_ready, &conn->_conn_ready, NULL)) {
-		sys_slist_append(&bt_dev.le.conn_ready, &conn->_conn_ready);
+	if (!sys_slist_find(list, &conn->_conn_ready, NULL)) {
+		sys_slist_append(list, &conn->_conn_ready);
 
 		added = true;
 	} else {
@@ -922,7 +970,7 @@ __maybe_unused static bool dont_have_methods(struct bt_conn *conn)
 		(conn->has_data == NULL);
 }
 
-static struct bt_conn *get_conn_ready(void)
+static struct bt_conn *get_conn_ready(sys_slist_t *list)
 {
 	struct bt_conn *conn, *tmp;
 	sys_snode_t *prev = NULL;
@@ -935,7 +983,7 @@ static struct bt_conn *get_conn_ready(void)
 		return NULL;
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&bt_dev.le.conn_ready, conn, tmp, _conn_ready) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, conn, tmp, _conn_ready) {
 		__ASSERT_NO_MSG(tmp != conn);
 
 		/* Iterate over the list of connections that have data to send
@@ -966,7 +1014,7 @@ static struct bt_conn *get_conn_ready(void)
 		if (should_stop_tx(conn)) {
 			/* Move reference off the list */
 			__ASSERT_NO_MSG(prev != &conn->_conn_ready);
-			sys_slist_remove(&bt_dev.le.conn_ready, prev, &conn->_conn_ready);
+			sys_slist_remove(list, prev, &conn->_conn_ready);
 
 			/* Append connection to list if it is connected and still has data */
 			if (conn->has_data(conn) && (conn->state == BT_CONN_CONNECTED)) {
@@ -997,6 +1045,12 @@ static void acl_get_and_clear_cb(struct bt_conn *conn, struct net_buf *buf,
 }
 #endif	/* defined(CONFIG_BT_CONN) */
 
+#if defined(CONFIG_BT_CONN_TX_BURST)
+#define CONN_TX_BURST CONFIG_BT_CONN_TX_BURST
+#else
+#define CONN_TX_BURST 1
+#endif /* CONFIG_BT_CONN_TX_BURST */
+
 static volatile bool _suspend_tx;
 
 #if defined(CONFIG_BT_TESTING)
@@ -1010,36 +1064,48 @@ void bt_conn_suspend_tx(bool suspend)
 }
 #endif	/* CONFIG_BT_TESTING */
 
-void bt_conn_tx_processor(void)
+/* Move a connection that was just served to the back of the ready list, so
+ * that the other connections get their turn within a burst.
+ */
+static void conn_ready_rotate(sys_slist_t *list, struct bt_conn *conn)
+{
+	/* The list can be appended to from preemptive threads, see
+	 * bt_conn_data_ready().
+	 */
+	k_sched_lock();
+
+	if (sys_slist_find_and_remove(list, &conn->_conn_ready)) {
+		sys_slist_append(list, &conn->_conn_ready);
+	}
+
+	k_sched_unlock();
+}
+
+/* Send one fragment of the first connection of a ready list which can send,
+ * returns true if the TX processor has to run again.
+ */
+static bool conn_tx_process_one(sys_slist_t *list)
 {
-	LOG_DBG("start");
 	struct bt_conn *conn;
 	struct net_buf *buf;
 	bt_conn_tx_cb_t cb = NULL;
 	size_t buf_len;
 	void *ud = NULL;
+	bool raise = false;
 
-	if (!IS_ENABLED(CONFIG_BT_CONN_TX)) {
-		/* Mom, can we have a real compiler? */
-		return;
-	}
-
-	if (IS_ENABLED(CONFIG_BT_TESTING) && _suspend_tx) {
-		return;
-	}
-
-	conn = get_conn_ready();
+	conn = get_conn_ready(list);
 
 	if (!conn) {
 		LOG_DBG("no connection wants to do stuff");
-		return;
+		return false;
 	}
 
 	LOG_DBG("processing conn %p", conn);
 
 	if (conn->state != BT_CONN_CONNECTED) {
 		LOG_DBG("conn %p: not connected: state %d", conn, conn->state);
-		goto raise_and_exit;
+		raise = true;
+		goto exit;
 	}
 
 	/* now that we are guaranteed resources, we can pull data from the upper
@@ -1078,15 +1144,59 @@ void bt_conn_tx_processor(void)
 		goto exit;
 	}
 
-raise_and_exit:
+	if (CONN_TX_BURST > 1 || list != &bt_dev.le.conn_ready) {
+		conn_ready_rotate(list, conn);
+	}
+
 	/* Always kick the TX work. It will self-suspend if it doesn't get
 	 * resources or there is nothing left to send.
 	 */
-	bt_tx_irq_raise();
+	raise = true;
 
 exit:
 	/* Give back the ref that `get_conn_ready()` gave us */
 	bt_conn_unref(conn);
+
+	return raise;
+}
+
+void bt_conn_tx_processor(void)
+{
+	LOG_DBG("start");
+	bool raise = false;
+
+	if (!IS_ENABLED(CONFIG_BT_CONN_TX)) {
+		/* Mom, can we have a real compiler? */
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_TESTING) && _suspend_tx) {
+		return;
+	}
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	/* Send everything the ISO channels have queued and the controller can
+	 * take, round-robin between the channels, before any ACL data.
+	 */
+	while (conn_tx_process_one(&bt_dev.le.iso_ready)) {
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
+	for (int i = 0; i < CONN_TX_BURST; i++) {
+		raise = conn_tx_process_one(&bt_dev.le.conn_ready);
+		if (!raise) {
+			break;
+		}
+
+		/* Let the TX work send the pending commands first */
+		if (!k_fifo_is_empty(&bt_dev.cmd_tx_queue)) {
+			break;
+		}
+	}
+
+	if (raise) {
+		bt_tx_irq_raise();
+	}
 }
 
 static void process_unack_tx(struct bt_conn *conn)
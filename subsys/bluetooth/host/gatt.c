@@ -65,6 +65,21 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+/* Index of the static services, to start iterating the database at the
+ * service holding the start handle and to skip the services which cannot
+ * have an attribute of the requested UUID.
+ */
+static struct {
+	uint16_t start_handle;
+	/* One bit set per attribute UUID, see uuid_bit() */
+	uint32_t uuids;
+} static_svc_index[CONFIG_BT_GATT_DB_INDEX_STATIC_SERVICES];
+
+/* 0 if there are more static services than the index holds */
+static uint8_t static_svc_indexed;
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -708,6 +723,139 @@ static ssize_t cf_write(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 	return len;
 }
 
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+/* AES-CMAC (RFC 4493) computed block by block, so that the state reached after
+ * the static services can be kept: they always come first in the database and
+ * never change.
+ */
+struct gen_hash_state {
+	psa_key_id_t key;
+	uint8_t x[16];
+	/* Last block, only processed once it is known not to be the final one */
+	uint8_t m[16];
+	uint8_t m_len;
+	int err;
+};
+
+static struct gen_hash_state db_hash_static;
+static bool db_hash_static_valid;
+
+static int db_hash_encrypt(struct gen_hash_state *state, uint8_t block[16])
+{
+	uint8_t out[16];
+	size_t out_len;
+	psa_status_t ret;
+
+	ret = psa_cipher_encrypt(state->key, PSA_ALG_ECB_NO_PADDING, block, 16, out,
+				 sizeof(out), &out_len);
+	if (ret != PSA_SUCCESS || out_len != sizeof(out)) {
+		LOG_ERR("AES encryption failed %d", ret);
+		return -EIO;
+	}
+
+	memcpy(block, out, sizeof(out));
+
+	return 0;
+}
+
+static void db_hash_subkey(uint8_t k[16])
+{
+	uint8_t msb = k[0] & 0x80;
+
+	for (size_t i = 0; i < 15; i++) {
+		k[i] = (k[i] << 1) | (k[i + 1] >> 7);
+	}
+
+	k[15] <<= 1;
+
+	if (msb) {
+		k[15] ^= 0x87;
+	}
+}
+
+static int db_hash_setup(struct gen_hash_state *state, uint8_t *key)
+{
+	psa_key_attributes_t key_attr = PSA_KEY_ATTRIBUTES_INIT;
+	psa_status_t ret;
+
+	psa_set_key_type(&key_attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&key_attr, 128);
+	psa_set_key_usage_flags(&key_attr, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&key_attr, PSA_ALG_ECB_NO_PADDING);
+
+	ret = psa_import_key(&key_attr, key, 16, &(state->key));
+	if (ret != PSA_SUCCESS) {
+		LOG_ERR("Unable to import the key for AES CMAC %d", ret);
+		return -EIO;
+	}
+
+	memset(state->x, 0, sizeof(state->x));
+	state->m_len = 0;
+	state->err = 0;
+
+	return 0;
+}
+
+static int db_hash_update(struct gen_hash_state *state, uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		size_t n;
+
+		if (state->m_len == sizeof(state->m)) {
+			for (size_t i = 0; i < sizeof(state->x); i++) {
+				state->x[i] ^= state->m[i];
+			}
+
+			if (db_hash_encrypt(state, state->x) != 0) {
+				return -EIO;
+			}
+
+			state->m_len = 0;
+		}
+
+		n = MIN(sizeof(state->m) - state->m_len, len);
+		memcpy(&state->m[state->m_len], data, n);
+		state->m_len += n;
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int db_hash_finish(struct gen_hash_state *state)
+{
+	uint8_t k[16] = {};
+	int err;
+
+	err = db_hash_encrypt(state, k);
+	if (err) {
+		goto destroy;
+	}
+
+	db_hash_subkey(k);
+
+	if (state->m_len < sizeof(state->m)) {
+		state->m[state->m_len] = 0x80;
+		memset(&state->m[state->m_len + 1], 0, sizeof(state->m) - state->m_len - 1);
+		db_hash_subkey(k);
+	}
+
+	for (size_t i = 0; i < sizeof(state->x); i++) {
+		state->x[i] ^= state->m[i] ^ k[i];
+	}
+
+	err = db_hash_encrypt(state, state->x);
+	if (!err) {
+		memcpy(db_hash.hash, state->x, sizeof(db_hash.hash));
+	}
+
+destroy:
+	psa_destroy_key(state->key);
+
+	return err;
+}
+#else
 struct gen_hash_state {
 	psa_mac_operation_t operation;
 	psa_key_id_t key;
@@ -763,6 +911,7 @@ static int db_hash_finish(struct gen_hash_state *state)
 	}
 	return 0;
 }
+#endif /* CONFIG_BT_GATT_DB_INDEX */
 
 union hash_attr_value {
 	/* Bluetooth Core Specification Version 5.3 | Vol 3, Part G
@@ -898,7 +1047,25 @@ static void db_hash_gen(void)
 		return;
 	}
 
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+	if (db_hash_static_valid) {
+		memcpy(state.x, db_hash_static.x, sizeof(state.x));
+		memcpy(state.m, db_hash_static.m, sizeof(state.m));
+		state.m_len = db_hash_static.m_len;
+	} else if (last_static_handle > 0) {
+		bt_gatt_foreach_attr(0x0001, last_static_handle, gen_hash_m, &state);
+
+		if (state.err == 0) {
+			db_hash_static = state;
+			db_hash_static_valid = true;
+		}
+	}
+
+	/* Only the dynamic services are left */
+	bt_gatt_foreach_attr(last_static_handle + 1, 0xffff, gen_hash_m, &state);
+#else
 	bt_gatt_foreach_attr(0x0001, 0xffff, gen_hash_m, &state);
+#endif /* CONFIG_BT_GATT_DB_INDEX */
 
 	if (db_hash_finish(&state) != 0) {
 		return;
@@ -1537,6 +1704,61 @@ BT_CONN_CB_DEFINE(gatt_conn_cb) = {
 };
 #endif /* CONFIG_BT_SETTINGS && CONFIG_BT_SMP */
 
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+/* bt_uuid_cmp() matches UUIDs of different sizes, so a 128-bit UUID built on
+ * the Bluetooth Base UUID has to set the same bit as its short form.
+ */
+static uint32_t uuid_bit(const struct bt_uuid *uuid)
+{
+	uint32_t val;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		val = BT_UUID_16(uuid)->val;
+		break;
+	case BT_UUID_TYPE_32:
+		val = BT_UUID_32(uuid)->val;
+		break;
+	default:
+		val = sys_get_le32(&BT_UUID_128(uuid)->val[12]);
+		break;
+	}
+
+	return BIT((val * 2654435761U) >> 27);
+}
+
+static void static_svc_index_init(void)
+{
+	uint16_t handle = 1;
+	size_t i = 0;
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
+		if (i == ARRAY_SIZE(static_svc_index)) {
+			LOG_WRN("Too many static services to index, increase "
+				"CONFIG_BT_GATT_DB_INDEX_STATIC_SERVICES");
+			return;
+		}
+
+		static_svc_index[i].start_handle = handle;
+		static_svc_index[i].uuids = 0;
+
+		for (size_t j = 0; j < svc->attr_count; j++) {
+			static_svc_index[i].uuids |= uuid_bit(svc->attrs[j].uuid);
+		}
+
+		handle += svc->attr_count;
+		i++;
+	}
+
+	static_svc_indexed = i;
+}
+
+#else
+static void static_svc_index_init(void)
+{
+}
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
 static void bt_gatt_service_init(void)
 {
 	if (atomic_test_and_set_bit(gatt_flags, GATT_SERVICE_INITIALIZED)) {
@@ -1546,6 +1768,8 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+	static_svc_index_init();
 }
 
 void bt_gatt_init(void)
@@ -1918,11 +2142,7 @@ uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 			continue;
 		}
 
-		for (size_t i = 0; i < static_svc->attr_count; i++, handle++) {
-			if (attr == &static_svc->attrs[i]) {
-				return handle;
-			}
-		}
+		return handle + (attr - &static_svc->attrs[0]);
 	}
 
 	return 0;
@@ -2096,40 +2316,120 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
-void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
-			       const struct bt_uuid *uuid,
-			       const void *attr_data, uint16_t num_matches,
-			       bt_gatt_attr_func_t func, void *user_data)
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+/* Index of the static service holding handle */
+static size_t static_svc_index_find(uint16_t handle)
 {
-	size_t i;
+	size_t lo = 0;
+	size_t hi = static_svc_indexed;
 
-	if (!num_matches) {
-		num_matches = UINT16_MAX;
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (static_svc_index[mid].start_handle <= handle) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
 	}
 
-	if (start_handle <= last_static_handle) {
-		uint16_t handle = 1;
+	return lo;
+}
 
-		STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
-			/* Skip ahead if start is not within service handles */
-			if (handle + static_svc->attr_count < start_handle) {
-				handle += static_svc->attr_count;
-				continue;
+static bool foreach_attr_type_indexed(uint16_t start_handle, uint16_t end_handle,
+				      const struct bt_uuid *uuid,
+				      const void *attr_data, uint16_t *num_matches,
+				      bt_gatt_attr_func_t func, void *user_data)
+{
+	uint32_t bit = uuid ? uuid_bit(uuid) : 0;
+
+	for (size_t i = static_svc_index_find(start_handle); i < static_svc_indexed; i++) {
+		uint16_t handle = static_svc_index[i].start_handle;
+		struct bt_gatt_service_static *svc;
+		size_t j = 0;
+
+		if (handle > end_handle) {
+			return false;
+		}
+
+		if (uuid && !(static_svc_index[i].uuids & bit)) {
+			continue;
+		}
+
+		STRUCT_SECTION_GET(bt_gatt_service_static, i, &svc);
+
+		if (start_handle > handle) {
+			j = start_handle - handle;
+			handle = start_handle;
+		}
+
+		for (; j < svc->attr_count; j++, handle++) {
+			if (gatt_foreach_iter(&svc->attrs[j], handle, start_handle,
+					      end_handle, uuid, attr_data, num_matches,
+					      func, user_data) == BT_GATT_ITER_STOP) {
+				return false;
 			}
+		}
+	}
 
-			for (i = 0; i < static_svc->attr_count; i++, handle++) {
-				if (gatt_foreach_iter(&static_svc->attrs[i],
-						      handle, start_handle,
-						      end_handle, uuid,
-						      attr_data, &num_matches,
-						      func, user_data) ==
-				    BT_GATT_ITER_STOP) {
-					return;
-				}
+	return true;
+}
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
+/* Returns false if the iteration has been stopped */
+static bool foreach_attr_type_static(uint16_t start_handle, uint16_t end_handle,
+				     const struct bt_uuid *uuid,
+				     const void *attr_data, uint16_t *num_matches,
+				     bt_gatt_attr_func_t func, void *user_data)
+{
+	uint16_t handle = 1;
+	size_t i;
+
+#if defined(CONFIG_BT_GATT_DB_INDEX)
+	if (static_svc_indexed > 0) {
+		return foreach_attr_type_indexed(start_handle, end_handle, uuid,
+						 attr_data, num_matches, func,
+						 user_data);
+	}
+#endif /* CONFIG_BT_GATT_DB_INDEX */
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
+		/* Skip ahead if start is not within service handles */
+		if (handle + static_svc->attr_count < start_handle) {
+			handle += static_svc->attr_count;
+			continue;
+		}
+
+		for (i = 0; i < static_svc->attr_count; i++, handle++) {
+			if (gatt_foreach_iter(&static_svc->attrs[i],
+					      handle, start_handle,
+					      end_handle, uuid,
+					      attr_data, num_matches,
+					      func, user_data) ==
+			    BT_GATT_ITER_STOP) {
+				return false;
 			}
 		}
 	}
 
+	return true;
+}
+
+void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
+			       const struct bt_uuid *uuid,
+			       const void *attr_data, uint16_t num_matches,
+			       bt_gatt_attr_func_t func, void *user_data)
+{
+	if (!num_matches) {
+		num_matches = UINT16_MAX;
+	}
+
+	if (start_handle <= last_static_handle &&
+	    !foreach_attr_type_static(start_handle, end_handle, uuid, attr_data,
+				      &num_matches, func, user_data)) {
+		return;
+	}
+
 	/* Iterate over dynamic db */
 	foreach_attr_type_dyndb(start_handle, end_handle, uuid, attr_data,
 				num_matches, func, user_data);
@@ -2980,17 +3280,15 @@ static int gatt_notify_multiple_verify_args(struct bt_conn *conn,
 		return -EINVAL;
 	}
 
-	CHECKIF(conn == NULL) {
-		/* Use the standard notification API to send to all connected
-		 * peers.
-		 */
-		return -EINVAL;
-	}
-
 	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
 		return -EAGAIN;
 	}
 
+	/* The peers are checked one by one when sending to all of them. */
+	if (conn == NULL) {
+		return 0;
+	}
+
 	if (conn->state != BT_CONN_CONNECTED) {
 		return -ENOTCONN;
 	}
@@ -3073,6 +3371,145 @@ static int gatt_notify_multiple_verify_params(struct bt_conn *conn,
 	return 0;
 }
 
+static uint16_t gatt_notify_multiple_handle(const struct bt_gatt_attr *attr)
+{
+	/* Check if attribute is a characteristic then adjust the handle */
+	if (!bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CHRC)) {
+		return bt_gatt_attr_value_handle(attr);
+	}
+
+	return bt_gatt_attr_get_handle(attr);
+}
+
+struct notify_multiple_all_data {
+	uint16_t num_params;
+	struct bt_gatt_notify_params *params;
+	size_t total_len;
+	/* First PDU built, copied into the PDUs of the other peers */
+	struct net_buf *pdu;
+	struct net_buf *bufs[CONFIG_BT_MAX_CONN];
+	int err;
+};
+
+static void notify_multiple_all_err(struct notify_multiple_all_data *data, int err)
+{
+	if (err < 0) {
+		data->err = err;
+	} else if (data->err == -ENOTCONN) {
+		data->err = 0;
+	}
+}
+
+static void notify_multiple_all_cb(struct bt_conn *conn, void *user_data)
+{
+	struct notify_multiple_all_data *data = user_data;
+	bool subscribed_all = true;
+	size_t total_len = 0;
+	struct net_buf *buf;
+
+	if (conn->state != BT_CONN_CONNECTED) {
+		return;
+	}
+
+	for (uint16_t i = 0; i < data->num_params; i++) {
+		if (!bt_gatt_is_subscribed(conn, data->params[i].attr, BT_GATT_CCC_NOTIFY)) {
+			subscribed_all = false;
+			break;
+		}
+	}
+
+	if (!subscribed_all || !gatt_cf_notify_multi(conn) ||
+#if defined(CONFIG_BT_GATT_ENFORCE_CHANGE_UNAWARE)
+	    !bt_gatt_change_aware(conn, false) ||
+#endif
+	    gatt_notify_multiple_verify_params(conn, data->params, data->num_params,
+					       &total_len)) {
+		/* Fall back to a notification per subscribed characteristic,
+		 * which reports why the peer cannot get any of them.
+		 */
+		for (uint16_t i = 0; i < data->num_params; i++) {
+			struct bt_gatt_notify_params *params = &data->params[i];
+
+			if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
+				continue;
+			}
+
+			notify_multiple_all_err(data,
+						gatt_notify(conn,
+							    gatt_notify_multiple_handle(params->attr),
+							    params));
+		}
+
+		return;
+	}
+
+	/* Send any outstanding notifications first to keep them in order. */
+	gatt_notify_flush(conn);
+
+	buf = bt_att_create_pdu(conn, BT_ATT_OP_NOTIFY_MULT,
+				sizeof(struct bt_att_notify_mult) + data->total_len);
+	if (!buf) {
+		notify_multiple_all_err(data, -ENOMEM);
+		return;
+	}
+
+	/* Register the callback. It will be called num_params times. */
+	bt_att_set_tx_meta_data(buf, data->params->func, data->params->user_data,
+				BT_ATT_CHAN_OPT(data->params));
+	bt_att_increment_tx_meta_data_attr_count(buf, data->num_params - 1);
+
+	if (data->pdu == NULL) {
+		for (uint16_t i = 0; i < data->num_params; i++) {
+			gatt_add_nfy_to_buf(buf, gatt_notify_multiple_handle(data->params[i].attr),
+					    &data->params[i]);
+		}
+
+		data->pdu = buf;
+	} else {
+		/* The PDU is the same for every peer, only copy it after the
+		 * opcode added by bt_att_create_pdu().
+		 */
+		net_buf_add_mem(buf, data->pdu->data + buf->len, data->pdu->len - buf->len);
+	}
+
+	data->bufs[bt_conn_index(conn)] = buf;
+}
+
+/* Send the same notifications to all the subscribed peers. The PDU is encoded
+ * once, other peers get a copy of it as the buffers cannot be shared between
+ * connections. All the PDUs are queued after being built, so that the peers
+ * are served back to back.
+ */
+static int gatt_notify_multiple_all(uint16_t num_params,
+				    struct bt_gatt_notify_params params[])
+{
+	struct notify_multiple_all_data data = {
+		.num_params = num_params,
+		.params = params,
+		.err = -ENOTCONN,
+	};
+
+	for (uint16_t i = 0; i < num_params; i++) {
+		data.total_len += params[i].len;
+	}
+
+	bt_conn_foreach(BT_CONN_TYPE_LE, notify_multiple_all_cb, &data);
+
+	for (size_t i = 0; i < ARRAY_SIZE(data.bufs); i++) {
+		struct bt_conn *conn;
+
+		if (data.bufs[i] == NULL) {
+			continue;
+		}
+
+		conn = bt_conn_lookup_index(i);
+		notify_multiple_all_err(&data, gatt_notify_mult_send(conn, data.bufs[i]));
+		bt_conn_unref(conn);
+	}
+
+	return data.err;
+}
+
 int bt_gatt_notify_multiple(struct bt_conn *conn,
 			    uint16_t num_params,
 			    struct bt_gatt_notify_params params[])
@@ -3087,6 +3524,10 @@ int bt_gatt_notify_multiple(struct bt_conn *conn,
 		return err;
 	}
 
+	if (conn == NULL) {
+		return gatt_notify_multiple_all(num_params, params);
+	}
+
 	/* Validate all the attributes that we want to notify.
 	 * Also gets us the total length of the PDU as a side-effect.
 	 */
@@ -3112,20 +3553,9 @@ int bt_gatt_notify_multiple(struct bt_conn *conn,
 	bt_att_increment_tx_meta_data_attr_count(buf, num_params - 1);
 
 	for (uint16_t i = 0; i < num_params; i++) {
-		struct notify_data data;
-
-		data.attr = params[i].attr;
-		data.handle = bt_gatt_attr_get_handle(data.attr);
-
-		/* Check if attribute is a characteristic then adjust the
-		 * handle
-		 */
-		if (!bt_uuid_cmp(data.attr->uuid, BT_UUID_GATT_CHRC)) {
-			data.handle = bt_gatt_attr_value_handle(data.attr);
-		}
-
 		/* Add handle and data to the command buffer. */
-		gatt_add_nfy_to_buf(buf, data.handle, &params[i]);
+		gatt_add_nfy_to_buf(buf, gatt_notify_multiple_handle(params[i].attr),
+				    &params[i]);
 	}
 
 	/* Send the buffer. */
@@ -319,6 +319,10 @@ struct bt_dev_le {
 	 * Each element in this list contains a reference to its `conn` object.
 	 */
 	sys_slist_t		conn_ready;
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	/* Same as conn_ready, for the ISO channels */
+	sys_slist_t		iso_ready;
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 };
 
 struct bt_dev_br {
@@ -2572,6 +2572,81 @@ static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 	return frag;
 }
 
+#if defined(CONFIG_BT_L2CAP_RX_ZERO_COPY)
+static bool l2cap_chan_rx_zero_copy(struct bt_l2cap_le_chan *chan)
+{
+	return chan->rx_zero_copy;
+}
+
+/* Free buffers in the pool the PDUs are received from, one of them is left
+ * to the other channels and the events sharing it.
+ */
+static uint16_t l2cap_rx_bufs_avail(struct net_buf *buf)
+{
+	atomic_val_t avail = atomic_get(&net_buf_pool_get(buf->pool_id)->avail_count);
+
+	return avail > 1 ? avail - 1 : 0;
+}
+
+/* Credits for the rest of the SDU, as many as there are RX buffers to hold
+ * the segments.
+ */
+static uint16_t l2cap_chan_rx_zero_copy_credits(struct bt_l2cap_le_chan *chan,
+						struct net_buf *buf, uint16_t remaining)
+{
+	uint16_t credits = DIV_ROUND_UP(remaining, chan->rx.mps);
+
+	/* Segments which cannot be held are copied, so one is always fine */
+	return MIN(credits, MAX(l2cap_rx_bufs_avail(buf), 1));
+}
+
+static int l2cap_chan_rx_zero_copy_append(struct bt_l2cap_le_chan *chan,
+					  struct net_buf *buf)
+{
+	struct net_buf *frag;
+
+	if (l2cap_rx_bufs_avail(buf) > 0) {
+		frag = net_buf_ref(buf);
+
+		/* Shares its storage with the RX queue node */
+		frag->frags = NULL;
+	} else {
+		frag = chan->chan.ops->alloc_buf(&chan->chan);
+		if (!frag) {
+			return -ENOMEM;
+		}
+
+		if (net_buf_tailroom(frag) < buf->len) {
+			net_buf_unref(frag);
+			return -ENOMEM;
+		}
+
+		net_buf_add_mem(frag, buf->data, buf->len);
+	}
+
+	net_buf_frag_add(chan->_sdu, frag);
+
+	return 0;
+}
+#else
+static bool l2cap_chan_rx_zero_copy(struct bt_l2cap_le_chan *chan)
+{
+	return false;
+}
+
+static uint16_t l2cap_chan_rx_zero_copy_credits(struct bt_l2cap_le_chan *chan,
+						struct net_buf *buf, uint16_t remaining)
+{
+	return 0;
+}
+
+static int l2cap_chan_rx_zero_copy_append(struct bt_l2cap_le_chan *chan,
+					  struct net_buf *buf)
+{
+	return -ENOTSUP;
+}
+#endif /* CONFIG_BT_L2CAP_RX_ZERO_COPY */
+
 static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf, uint16_t seg)
 {
@@ -2601,10 +2676,12 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf)
 {
+	bool zero_copy = l2cap_chan_rx_zero_copy(chan);
 	uint16_t len;
 	uint16_t seg = 0U;
+	int err;
 
-	len = chan->_sdu->len;
+	len = zero_copy ? net_buf_frags_len(chan->_sdu) : chan->_sdu->len;
 	if (len) {
 		memcpy(&seg, net_buf_user_data(chan->_sdu), sizeof(seg));
 	}
@@ -2622,15 +2699,24 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 	LOG_DBG("chan %p seg %d len %u", chan, seg, buf->len);
 
 	/* Append received segment to SDU */
-	len = net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
-				   l2cap_alloc_frag, chan);
-	if (len != buf->len) {
+	if (zero_copy) {
+		err = l2cap_chan_rx_zero_copy_append(chan, buf);
+	} else if (net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
+					l2cap_alloc_frag, chan) != buf->len) {
+		err = -ENOMEM;
+	} else {
+		err = 0;
+	}
+
+	if (err) {
 		LOG_ERR("Unable to store SDU");
 		bt_l2cap_chan_disconnect(&chan->chan);
 		return;
 	}
 
-	if (chan->_sdu->len < chan->_sdu_len) {
+	len += buf->len;
+
+	if (len < chan->_sdu_len) {
 		/* Give more credits if remote has run out of them, this
 		 * should only happen if the remote cannot fully utilize the
 		 * MPS for some reason.
@@ -2642,7 +2728,10 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 		 */
 		if (atomic_get(&chan->rx.credits) == 0) {
 			LOG_DBG("remote is not fully utilizing MPS");
-			l2cap_chan_send_credits(chan, 1);
+			l2cap_chan_send_credits(chan, zero_copy ?
+				l2cap_chan_rx_zero_copy_credits(chan, buf,
+								chan->_sdu_len - len) :
+				1);
 		}
 
 		return;
@@ -2763,6 +2852,11 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 			MIN(sdu_len - buf->len, net_buf_tailroom(chan->_sdu)),
 			chan->rx.mps);
 
+		if (l2cap_chan_rx_zero_copy(chan)) {
+			credits = l2cap_chan_rx_zero_copy_credits(chan, buf,
+								  sdu_len - buf->len);
+		}
+
 		if (credits) {
 			LOG_DBG("sending %d extra credits (sdu_len %d buf_len %d mps %d)",
 				credits,
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <zephyr/autoconf.h>
@@ -21,6 +22,7 @@
 #include <zephyr/bluetooth/addr.h>
 #include <zephyr/bluetooth/hci.h>
 #include <zephyr/bluetooth/hci_vs.h>
+#include <zephyr/bluetooth/uuid.h>
 #include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/sys/__assert.h>
@@ -624,6 +626,367 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
+#if defined(CONFIG_BT_SCAN_FILTER)
+struct scan_dedup_entry {
+	bt_addr_le_t addr;
+	uint32_t data_hash;
+	uint32_t timestamp;
+	uint8_t sid;
+	uint8_t adv_type;
+	int8_t rssi;
+	bool valid;
+};
+
+/* Number of consecutive cache entries probed for an advertiser */
+#define SCAN_DEDUP_PROBES MIN(4, CONFIG_BT_SCAN_DEDUP_CACHE_SIZE)
+
+static struct {
+	struct k_spinlock lock;
+	bt_addr_le_t addrs[CONFIG_BT_SCAN_FILTER_ADDR_COUNT];
+	struct bt_uuid_128 uuids[CONFIG_BT_SCAN_FILTER_UUID_COUNT];
+	uint16_t manuf_ids[CONFIG_BT_SCAN_FILTER_MANUF_COUNT];
+	uint8_t addr_count;
+	uint8_t uuid_count;
+	uint8_t manuf_count;
+#if CONFIG_BT_SCAN_DEDUP_CACHE_SIZE > 0
+	struct scan_dedup_entry dedup[CONFIG_BT_SCAN_DEDUP_CACHE_SIZE];
+#endif
+} scan_filter;
+
+int bt_le_scan_filter_add_addr(const bt_addr_le_t *addr)
+{
+	k_spinlock_key_t key;
+	int err = 0;
+
+	CHECKIF(addr == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&scan_filter.lock);
+
+	for (uint8_t i = 0; i < scan_filter.addr_count; i++) {
+		if (bt_addr_le_eq(&scan_filter.addrs[i], addr)) {
+			err = -EALREADY;
+			goto unlock;
+		}
+	}
+
+	if (scan_filter.addr_count == ARRAY_SIZE(scan_filter.addrs)) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	bt_addr_le_copy(&scan_filter.addrs[scan_filter.addr_count++], addr);
+
+unlock:
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return err;
+}
+
+int bt_le_scan_filter_add_uuid(const struct bt_uuid *uuid)
+{
+	k_spinlock_key_t key;
+	size_t size;
+	int err = 0;
+
+	CHECKIF(uuid == NULL) {
+		return -EINVAL;
+	}
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		size = sizeof(struct bt_uuid_16);
+		break;
+	case BT_UUID_TYPE_32:
+		size = sizeof(struct bt_uuid_32);
+		break;
+	case BT_UUID_TYPE_128:
+		size = sizeof(struct bt_uuid_128);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&scan_filter.lock);
+
+	for (uint8_t i = 0; i < scan_filter.uuid_count; i++) {
+		if (!bt_uuid_cmp(&scan_filter.uuids[i].uuid, uuid)) {
+			err = -EALREADY;
+			goto unlock;
+		}
+	}
+
+	if (scan_filter.uuid_count == ARRAY_SIZE(scan_filter.uuids)) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	(void)memcpy(&scan_filter.uuids[scan_filter.uuid_count++], uuid, size);
+
+unlock:
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return err;
+}
+
+int bt_le_scan_filter_add_manuf_id(uint16_t company_id)
+{
+	k_spinlock_key_t key;
+	int err = 0;
+
+	key = k_spin_lock(&scan_filter.lock);
+
+	for (uint8_t i = 0; i < scan_filter.manuf_count; i++) {
+		if (scan_filter.manuf_ids[i] == company_id) {
+			err = -EALREADY;
+			goto unlock;
+		}
+	}
+
+	if (scan_filter.manuf_count == ARRAY_SIZE(scan_filter.manuf_ids)) {
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	scan_filter.manuf_ids[scan_filter.manuf_count++] = company_id;
+
+unlock:
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return err;
+}
+
+static void scan_dedup_reset(void)
+{
+#if CONFIG_BT_SCAN_DEDUP_CACHE_SIZE > 0
+	k_spinlock_key_t key = k_spin_lock(&scan_filter.lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(scan_filter.dedup); i++) {
+		scan_filter.dedup[i].valid = false;
+	}
+
+	k_spin_unlock(&scan_filter.lock, key);
+#endif
+}
+
+void bt_le_scan_filter_clear(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&scan_filter.lock);
+
+	scan_filter.addr_count = 0U;
+	scan_filter.uuid_count = 0U;
+	scan_filter.manuf_count = 0U;
+
+	k_spin_unlock(&scan_filter.lock, key);
+
+	scan_dedup_reset();
+}
+
+/* Called with the filter lock held */
+static bool scan_filter_uuid_match(uint8_t type, const uint8_t *data, uint8_t len)
+{
+	struct bt_uuid_128 uuid;
+	uint8_t uuid_len;
+	bool svc_data = false;
+
+	switch (type) {
+	case BT_DATA_SVC_DATA16:
+		svc_data = true;
+		__fallthrough;
+	case BT_DATA_UUID16_SOME:
+	case BT_DATA_UUID16_ALL:
+		uuid_len = BT_UUID_SIZE_16;
+		break;
+	case BT_DATA_SVC_DATA32:
+		svc_data = true;
+		__fallthrough;
+	case BT_DATA_UUID32_SOME:
+	case BT_DATA_UUID32_ALL:
+		uuid_len = BT_UUID_SIZE_32;
+		break;
+	case BT_DATA_SVC_DATA128:
+		svc_data = true;
+		__fallthrough;
+	case BT_DATA_UUID128_SOME:
+	case BT_DATA_UUID128_ALL:
+		uuid_len = BT_UUID_SIZE_128;
+		break;
+	default:
+		return false;
+	}
+
+	/* Service data starts with a single UUID, lists only contain UUIDs */
+	for (uint8_t offset = 0; offset + uuid_len <= len; offset += uuid_len) {
+		if (!bt_uuid_create(&uuid.uuid, &data[offset], uuid_len)) {
+			return false;
+		}
+
+		for (uint8_t i = 0; i < scan_filter.uuid_count; i++) {
+			if (!bt_uuid_cmp(&scan_filter.uuids[i].uuid, &uuid.uuid)) {
+				return true;
+			}
+		}
+
+		if (svc_data) {
+			break;
+		}
+	}
+
+	return false;
+}
+
+/* Called with the filter lock held */
+static bool scan_filter_match(const bt_addr_le_t *addr, const uint8_t *data, uint16_t len)
+{
+	if (scan_filter.addr_count == 0U && scan_filter.uuid_count == 0U &&
+	    scan_filter.manuf_count == 0U) {
+		return true;
+	}
+
+	for (uint8_t i = 0; i < scan_filter.addr_count; i++) {
+		if (bt_addr_le_eq(&scan_filter.addrs[i], addr)) {
+			return true;
+		}
+	}
+
+	if (scan_filter.uuid_count == 0U && scan_filter.manuf_count == 0U) {
+		return false;
+	}
+
+	/* Walk the AD structures in place, the buffer is given as is to the
+	 * callbacks.
+	 */
+	for (uint16_t offset = 0; offset + 1 < len;) {
+		uint8_t ad_len = data[offset];
+		const uint8_t *ad_data = &data[offset + 2];
+
+		if (ad_len == 0U || offset + 1 + ad_len > len) {
+			break;
+		}
+
+		if (data[offset + 1] == BT_DATA_MANUFACTURER_DATA && ad_len >= 3U) {
+			uint16_t company_id = sys_get_le16(ad_data);
+
+			for (uint8_t i = 0; i < scan_filter.manuf_count; i++) {
+				if (scan_filter.manuf_ids[i] == company_id) {
+					return true;
+				}
+			}
+		} else if (scan_filter.uuid_count > 0U &&
+			   scan_filter_uuid_match(data[offset + 1], ad_data, ad_len - 1U)) {
+			return true;
+		}
+
+		offset += 1 + ad_len;
+	}
+
+	return false;
+}
+
+#if CONFIG_BT_SCAN_DEDUP_CACHE_SIZE > 0
+/* FNV-1a */
+static uint32_t scan_dedup_hash(const uint8_t *data, uint16_t len, uint32_t hash)
+{
+	for (uint16_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+/* Called with the filter lock held. Returns true if the report repeats the
+ * last one reported for the advertiser.
+ */
+static bool scan_dedup_is_duplicate(const bt_addr_le_t *addr,
+				    const struct bt_le_scan_recv_info *info,
+				    const uint8_t *data, uint16_t len)
+{
+	uint32_t now = k_uptime_get_32();
+	struct scan_dedup_entry *entry = NULL;
+	uint32_t data_hash;
+	size_t index;
+
+	/* Anonymous advertisers cannot be told apart */
+	if (bt_addr_le_eq(addr, BT_ADDR_LE_ANY)) {
+		return false;
+	}
+
+	index = scan_dedup_hash((const uint8_t *)addr, sizeof(*addr), 2166136261U);
+	index = scan_dedup_hash(&info->sid, sizeof(info->sid), index);
+	index %= ARRAY_SIZE(scan_filter.dedup);
+	data_hash = scan_dedup_hash(data, len, 2166136261U);
+
+	/* Look for the advertiser in a few entries, otherwise replace a free
+	 * entry or the oldest one.
+	 */
+	for (size_t i = 0; i < SCAN_DEDUP_PROBES; i++) {
+		struct scan_dedup_entry *e =
+			&scan_filter.dedup[(index + i) % ARRAY_SIZE(scan_filter.dedup)];
+
+		if (e->valid && e->sid == info->sid && e->adv_type == info->adv_type &&
+		    bt_addr_le_eq(&e->addr, addr)) {
+			if (e->data_hash == data_hash &&
+			    (now - e->timestamp) < CONFIG_BT_SCAN_DEDUP_TIMEOUT_MS &&
+			    abs(e->rssi - info->rssi) < CONFIG_BT_SCAN_DEDUP_RSSI_DELTA) {
+				return true;
+			}
+
+			entry = e;
+			break;
+		}
+
+		if (entry == NULL || !e->valid ||
+		    (entry->valid && (now - e->timestamp) > (now - entry->timestamp))) {
+			entry = e;
+		}
+	}
+
+	bt_addr_le_copy(&entry->addr, addr);
+	entry->data_hash = data_hash;
+	entry->timestamp = now;
+	entry->sid = info->sid;
+	entry->adv_type = info->adv_type;
+	entry->rssi = info->rssi;
+	entry->valid = true;
+
+	return false;
+}
+#endif /* CONFIG_BT_SCAN_DEDUP_CACHE_SIZE > 0 */
+
+/* Returns true if the report should be given to the scan callbacks */
+static bool scan_filter_accept(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			       const struct net_buf_simple *buf, uint16_t len)
+{
+	k_spinlock_key_t key;
+	bool accept;
+
+	key = k_spin_lock(&scan_filter.lock);
+
+	accept = scan_filter_match(addr, buf->data, len);
+
+#if CONFIG_BT_SCAN_DEDUP_CACHE_SIZE > 0
+	if (accept && scan_dedup_is_duplicate(addr, info, buf->data, len)) {
+		accept = false;
+	}
+#endif
+
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return accept;
+}
+#else
+static void scan_dedup_reset(void)
+{
+}
+
+static bool scan_filter_accept(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			       const struct net_buf_simple *buf, uint16_t len)
+{
+	return true;
+}
+#endif /* defined(CONFIG_BT_SCAN_FILTER) */
+
 static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 			struct net_buf_simple *buf, uint16_t len)
 {
@@ -658,6 +1021,10 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 		goto check_pending_conn;
 	}
 
+	if (!scan_filter_accept(&id_addr, info, buf, len)) {
+		goto check_pending_conn;
+	}
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
@@ -1817,6 +2184,7 @@ int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
 	       sizeof(scan_state.explicit_scan_param));
 
 	scan_dev_found_cb = cb;
+	scan_dedup_reset();
 	err = bt_le_scan_user_add(BT_LE_SCAN_USER_EXPLICIT_SCAN);
 	k_mutex_unlock(&scan_state.scan_explicit_params_mutex);
 
@@ -86,6 +86,18 @@ static struct {
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static uint16_t msg_cache_next;
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+#define MSG_CACHE_NONE UINT16_MAX
+
+/* Hash chains of the used message cache entries, the entries being evicted in
+ * the same order as without hashing.
+ */
+static uint16_t msg_cache_heads[CONFIG_BT_MESH_MSG_CACHE_SIZE] = {
+	[0 ... (CONFIG_BT_MESH_MSG_CACHE_SIZE - 1)] = MSG_CACHE_NONE,
+};
+static uint16_t msg_cache_chain[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+#endif
+
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
 	.local_queue = SYS_SLIST_STATIC_INIT(&bt_mesh.local_queue),
@@ -145,23 +157,51 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+static uint16_t *msg_cache_bucket(uint16_t src, uint32_t seq)
+{
+	uint32_t hash = ((seq & BIT_MASK(17)) * 2654435761U) ^ src;
+
+	return &msg_cache_heads[hash % ARRAY_SIZE(msg_cache_heads)];
+}
+
+static void msg_cache_unlink(uint16_t idx)
+{
+	uint16_t *i = msg_cache_bucket(msg_cache[idx].src, msg_cache[idx].seq);
+
+	while (*i != idx) {
+		i = &msg_cache_chain[*i];
+	}
+
+	*i = msg_cache_chain[idx];
+}
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
+
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
+	uint16_t src = SRC(pdu->data);
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
 	uint16_t i;
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+	for (i = *msg_cache_bucket(src, seq); i != MSG_CACHE_NONE; i = msg_cache_chain[i]) {
+		if (msg_cache[i].src == src && msg_cache[i].seq == seq) {
+			return true;
+		}
+	}
+#else
 	for (i = msg_cache_next; i > 0U;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
+		if (msg_cache[--i].src == src && msg_cache[i].seq == seq) {
 			return true;
 		}
 	}
 
 	for (i = ARRAY_SIZE(msg_cache); i > msg_cache_next;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
+		if (msg_cache[--i].src == src && msg_cache[i].seq == seq) {
 			return true;
 		}
 	}
+#endif
 
 	return false;
 }
@@ -169,11 +209,47 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
+
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+	uint16_t *head = msg_cache_bucket(rx->ctx.addr, rx->seq);
+
+	if (msg_cache[msg_cache_next].src != BT_MESH_ADDR_UNASSIGNED) {
+		msg_cache_unlink(msg_cache_next);
+	}
+
+	msg_cache_chain[msg_cache_next] = *head;
+	*head = msg_cache_next;
+#endif
+
 	msg_cache[msg_cache_next].src = rx->ctx.addr;
 	msg_cache[msg_cache_next].seq = rx->seq;
 	msg_cache_next++;
 }
 
+/* Forget the last added message */
+static void msg_cache_remove_last(void)
+{
+	msg_cache_next--;
+
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+	msg_cache_unlink(msg_cache_next);
+#endif
+
+	msg_cache[msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+}
+
+static void msg_cache_reset(void)
+{
+	(void)memset(msg_cache, 0, sizeof(msg_cache));
+	msg_cache_next = 0U;
+
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+	for (size_t i = 0; i < ARRAY_SIZE(msg_cache_heads); i++) {
+		msg_cache_heads[i] = MSG_CACHE_NONE;
+	}
+#endif
+}
+
 static void store_iv(bool only_duration)
 {
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_IV_PENDING);
@@ -215,8 +291,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 		return err;
 	}
 
-	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	msg_cache_reset();
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -912,7 +987,7 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
 		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+		msg_cache_remove_last();
 		dup_cache[--dup_cache_next] = 0;
 		return;
 	} else if (err == -EBADMSG) {
@@ -65,6 +65,56 @@ static struct bt_mesh_subnet subnets[CONFIG_BT_MESH_SUBNET_COUNT] = {
 	},
 };
 
+#if defined(CONFIG_BT_MESH_NET_NID_INDEX)
+/* Network key slots (subnet index * 2 + key index) grouped by NID. The slots
+ * of a NID are nid_slots[nid_start[nid]] to nid_slots[nid_start[nid + 1] - 1].
+ * All the slots are indexed, the subnet and key validity being checked on
+ * lookup, so that only NID changes require rebuilding the index.
+ */
+static uint16_t nid_slots[ARRAY_SIZE(subnets) * ARRAY_SIZE(subnets[0].keys)];
+static uint16_t nid_start[BIT(7) + 1];
+static atomic_t nid_index_dirty = ATOMIC_INIT(1);
+
+static void nid_index_invalidate(void)
+{
+	atomic_set(&nid_index_dirty, 1);
+}
+
+static uint8_t nid_slot_nid(uint16_t slot)
+{
+	return subnets[slot / ARRAY_SIZE(subnets[0].keys)]
+		.keys[slot % ARRAY_SIZE(subnets[0].keys)].msg.nid & BIT_MASK(7);
+}
+
+static void nid_index_build(void)
+{
+	uint16_t sum = 0U;
+
+	(void)memset(nid_start, 0, sizeof(nid_start));
+
+	for (uint16_t slot = 0U; slot < ARRAY_SIZE(nid_slots); slot++) {
+		nid_start[nid_slot_nid(slot)]++;
+	}
+
+	/* Turn the counts into the end of each group... */
+	for (int nid = 0; nid < BIT(7); nid++) {
+		sum += nid_start[nid];
+		nid_start[nid] = sum;
+	}
+
+	nid_start[BIT(7)] = sum;
+
+	/* ...and back into the start of each group while filling it. */
+	for (uint16_t slot = 0U; slot < ARRAY_SIZE(nid_slots); slot++) {
+		nid_slots[--nid_start[nid_slot_nid(slot)]] = slot;
+	}
+}
+#else
+static void nid_index_invalidate(void)
+{
+}
+#endif /* CONFIG_BT_MESH_NET_NID_INDEX */
+
 static void subnet_evt(struct bt_mesh_subnet *sub, enum bt_mesh_key_evt evt)
 {
 	STRUCT_SECTION_FOREACH(bt_mesh_subnet_cb, cb) {
@@ -234,6 +284,7 @@ static void key_refresh(struct bt_mesh_subnet *sub, uint8_t new_phase)
 		subnet_keys_destroy(&sub->keys[0]);
 		memcpy(&sub->keys[0], &sub->keys[1], sizeof(sub->keys[0]));
 		sub->keys[1].valid = 0U;
+		nid_index_invalidate();
 		subnet_evt(sub, BT_MESH_KEY_REVOKED);
 		break;
 	}
@@ -296,6 +347,7 @@ static void subnet_del(struct bt_mesh_subnet *sub)
 	subnet_evt(sub, BT_MESH_KEY_DELETED);
 	(void)memset(sub, 0, sizeof(*sub));
 	sub->net_idx = BT_MESH_KEY_UNUSED;
+	nid_index_invalidate();
 }
 
 static int msg_cred_create(struct bt_mesh_net_cred *cred, const uint8_t *p,
@@ -310,6 +362,7 @@ static int net_keys_create(struct bt_mesh_subnet_keys *keys, bool import, const
 	int err;
 
 	err = msg_cred_create(&keys->msg, &p, 1, key);
+	nid_index_invalidate();
 	if (err) {
 		LOG_ERR("Unable to generate NID, EncKey & PrivacyKey");
 		return err;
@@ -940,6 +993,29 @@ bool bt_mesh_net_cred_find(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 	}
 #endif
 
+#if defined(CONFIG_BT_MESH_NET_NID_INDEX)
+	/* Only try the keys with the NID of the PDU */
+	if (atomic_cas(&nid_index_dirty, 1, 0)) {
+		nid_index_build();
+	}
+
+	for (i = nid_start[in->data[0] & BIT_MASK(7)];
+	     i < nid_start[(in->data[0] & BIT_MASK(7)) + 1]; i++) {
+		rx->sub = &subnets[nid_slots[i] / ARRAY_SIZE(rx->sub->keys)];
+		j = nid_slots[i] % ARRAY_SIZE(rx->sub->keys);
+
+		if (rx->sub->net_idx == BT_MESH_KEY_UNUSED || !rx->sub->keys[j].valid) {
+			continue;
+		}
+
+		if (cb(rx, in, out, &rx->sub->keys[j].msg)) {
+			rx->new_key = (j > 0);
+			rx->friend_cred = 0U;
+			rx->ctx.net_idx = rx->sub->net_idx;
+			return true;
+		}
+	}
+#else
 	for (i = 0; i < ARRAY_SIZE(subnets); i++) {
 		rx->sub = &subnets[i];
 		if (rx->sub->net_idx == BT_MESH_KEY_UNUSED) {
@@ -959,6 +1035,7 @@ bool bt_mesh_net_cred_find(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 			}
 		}
 	}
+#endif /* CONFIG_BT_MESH_NET_NID_INDEX */
 
 	return false;
 }
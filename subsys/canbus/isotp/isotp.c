@@ -105,6 +105,99 @@ static void receive_can_tx(const struct device *dev, int error, void *arg)
 	}
 }
 
+#ifdef CONFIG_ISOTP_RX_DIRECT
+static inline bool receive_direct_active(struct isotp_recv_ctx *rctx)
+{
+	return rctx->direct_active;
+}
+
+/* Hand the user buffer of isotp_recv_direct() back, if there is one */
+static bool receive_direct_finish(struct isotp_recv_ctx *rctx, int ret)
+{
+	k_spinlock_key_t key = k_spin_lock(&rctx->direct_lock);
+	bool armed = rctx->direct_buf != NULL;
+
+	if (armed) {
+		rctx->direct_buf = NULL;
+		rctx->direct_active = false;
+		rctx->direct_ret = ret;
+		k_sem_give(&rctx->direct_sem);
+	}
+
+	k_spin_unlock(&rctx->direct_lock, key);
+
+	return armed;
+}
+
+/*
+ * Claim the user buffer for a message of len bytes, whose beginning is in
+ * rctx->buf. Returns 1 if the message goes to the user buffer, 0 if there is
+ * none and -ENOMEM if the message does not fit in it.
+ */
+static int receive_direct_start(struct isotp_recv_ctx *rctx, uint32_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&rctx->direct_lock);
+	int ret = 0;
+
+	if (rctx->direct_buf != NULL) {
+		if (len > rctx->direct_size) {
+			ret = -ENOMEM;
+		} else {
+			memcpy(rctx->direct_buf, rctx->buf->data, rctx->buf->len);
+			rctx->direct_len = rctx->buf->len;
+			rctx->direct_active = true;
+			net_buf_reset(rctx->buf);
+			ret = 1;
+		}
+	}
+
+	k_spin_unlock(&rctx->direct_lock, key);
+
+	return ret;
+}
+
+static bool receive_direct_cf(struct isotp_recv_ctx *rctx, const uint8_t *data, size_t len)
+{
+	if (!rctx->direct_active) {
+		return false;
+	}
+
+	memcpy(&rctx->direct_buf[rctx->direct_len], data, len);
+	rctx->direct_len += len;
+	rctx->length -= len;
+
+	if (rctx->length == 0) {
+		/* rctx->buf was kept for the next FF or SF */
+		k_timer_stop(&rctx->timer);
+		rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+		receive_direct_finish(rctx, rctx->direct_len);
+	}
+
+	return true;
+}
+#else
+static inline bool receive_direct_active(struct isotp_recv_ctx *rctx)
+{
+	return false;
+}
+
+static inline bool receive_direct_finish(struct isotp_recv_ctx *rctx, int ret)
+{
+	return false;
+}
+
+static inline int receive_direct_start(struct isotp_recv_ctx *rctx, uint32_t len)
+{
+	return 0;
+}
+
+static inline bool receive_direct_cf(struct isotp_recv_ctx *rctx, const uint8_t *data,
+				     size_t len)
+{
+	return false;
+}
+#endif /* CONFIG_ISOTP_RX_DIRECT */
+
 static inline uint32_t receive_get_ff_length(struct net_buf *buf)
 {
 	uint32_t len;
@@ -148,7 +241,8 @@ static void receive_send_fc(struct isotp_recv_ctx *rctx, uint8_t fs)
 	}
 
 	*data++ = ISOTP_PCI_TYPE_FC | fs;
-	*data++ = rctx->opts.bs;
+	/* a user buffer holds the whole message, no need to pause the sender */
+	*data++ = receive_direct_active(rctx) ? 0 : rctx->opts.bs;
 	*data++ = rctx->opts.stmin;
 	payload_len = data - frame.data;
 
@@ -278,6 +372,14 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		ud_rem_len = net_buf_user_data(rctx->buf);
 		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", rctx->length);
+		ret = receive_direct_start(rctx, rctx->length);
+		if (ret != 0) {
+			net_buf_reset(rctx->buf);
+			rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+			receive_direct_finish(rctx, ret > 0 ? rctx->length : ISOTP_N_BUFFER_OVERFLW);
+			break;
+		}
+
 		k_fifo_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_RECYCLE;
 		receive_state_machine(rctx);
@@ -287,6 +389,21 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		rctx->length = receive_get_ff_length(rctx->buf);
 		LOG_DBG("SM process FF. Length: %d", rctx->length);
 		rctx->length -= rctx->buf->len;
+		ret = receive_direct_start(rctx, rctx->length + rctx->buf->len);
+		if (ret > 0) {
+			rctx->state = ISOTP_RX_STATE_SEND_FC;
+			receive_state_machine(rctx);
+			break;
+		}
+
+		if (ret < 0) {
+			LOG_ERR("Pkt length is %d but user buffer is smaller",
+				rctx->length + rctx->buf->len);
+			receive_report_error(rctx, ISOTP_N_BUFFER_OVERFLW);
+			receive_state_machine(rctx);
+			break;
+		}
+
 		if (rctx->opts.bs == 0 &&
 		    rctx->length > CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE) {
 			LOG_ERR("Pkt length is %d but buffer has only %d bytes", rctx->length,
@@ -345,6 +462,10 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 			receive_send_fc(rctx, ISOTP_PCI_FS_OVFLW);
 		}
 
+		if (receive_direct_finish(rctx, rctx->error_nr)) {
+			rctx->error_nr = 0;
+		}
+
 		k_fifo_cancel_wait(&rctx->fifo);
 		net_buf_unref(rctx->buf);
 		rctx->buf = NULL;
@@ -531,6 +652,10 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 
 	LOG_DBG("Got CF irq. Appending data");
 	data_len = MIN(rctx->length, can_dl - index);
+	if (receive_direct_cf(rctx, &frame->data[index], data_len)) {
+		return;
+	}
+
 	receive_add_mem(rctx, &frame->data[index], data_len);
 	rctx->length -= data_len;
 	LOG_DBG("%d bytes remaining", rctx->length);
@@ -665,6 +790,11 @@ int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
 
 	k_work_init(&rctx->work, receive_work_handler);
 	k_timer_init(&rctx->timer, receive_timeout_handler, NULL);
+#ifdef CONFIG_ISOTP_RX_DIRECT
+	k_sem_init(&rctx->direct_sem, 0, 1);
+	rctx->direct_buf = NULL;
+	rctx->direct_active = false;
+#endif
 
 	return ISOTP_N_OK;
 }
@@ -694,6 +824,8 @@ void isotp_unbind(struct isotp_recv_ctx *rctx)
 		net_buf_unref(rctx->buf);
 	}
 
+	receive_direct_finish(rctx, ISOTP_N_ERROR);
+
 	LOG_DBG("Unbound");
 }
 
@@ -750,6 +882,45 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
 	return copied;
 }
 
+#ifdef CONFIG_ISOTP_RX_DIRECT
+int isotp_recv_direct(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rctx->direct_lock);
+
+	/* Data already on its way through the buffer pools comes first */
+	if (rctx->recv_buf || !k_fifo_is_empty(&rctx->fifo) ||
+	    (rctx->state != ISOTP_RX_STATE_WAIT_FF_SF && rctx->state != ISOTP_RX_STATE_RECYCLE)) {
+		k_spin_unlock(&rctx->direct_lock, key);
+		return isotp_recv(rctx, data, len, timeout);
+	}
+
+	__ASSERT(!rctx->direct_buf, "Concurrent isotp_recv_direct calls");
+	rctx->direct_buf = data;
+	rctx->direct_size = len;
+	rctx->direct_active = false;
+	k_sem_reset(&rctx->direct_sem);
+	k_spin_unlock(&rctx->direct_lock, key);
+
+	if (k_sem_take(&rctx->direct_sem, timeout) != 0) {
+		key = k_spin_lock(&rctx->direct_lock);
+		if (rctx->direct_buf && !rctx->direct_active) {
+			rctx->direct_buf = NULL;
+			k_spin_unlock(&rctx->direct_lock, key);
+			return ISOTP_RECV_TIMEOUT;
+		}
+
+		k_spin_unlock(&rctx->direct_lock, key);
+
+		/* The message is being written to data, the Cr timeout bounds the wait */
+		k_sem_take(&rctx->direct_sem, K_FOREVER);
+	}
+
+	return rctx->direct_ret;
+}
+#endif /* CONFIG_ISOTP_RX_DIRECT */
+
 static inline void send_report_error(struct isotp_send_ctx *sctx, uint32_t err)
 {
 	sctx->state = ISOTP_TX_ERR;
@@ -1119,8 +1290,10 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				break;
 			}
 
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
+			/* Bound the number of CFs queued to the controller */
+			while (sctx->tx_backlog >= CONFIG_ISOTP_TX_CF_BATCH) {
+				k_sem_take(&sctx->tx_sem, K_FOREVER);
+			}
 		} while (ret > 0);
 
 		break;
@@ -0,0 +1,254 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/cpu_freq/policy.h>
+#include <zephyr/cpu_freq/cpu_freq.h>
+
+LOG_MODULE_REGISTER(cpu_freq_policy_schedutil, CONFIG_CPU_FREQ_LOG_LEVEL);
+
+const struct pstate *soc_pstates[] = {
+	DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(performance_states), PSTATE_DT_GET, (,))
+};
+
+struct schedutil_cpu {
+	uint64_t execution_cycles;
+	uint64_t total_cycles;
+	/* Decayed utilization, in percent */
+	uint32_t util;
+	int64_t boost_end;
+};
+
+static struct schedutil_cpu cpus[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_spinlock lock;
+
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1) && \
+	!defined(CONFIG_CPU_FREQ_PER_CPU_SCALING)
+
+/*
+ * CPUs sharing a clock are grouped in frequency domains, given by the
+ * zephyr,cpu-freq-domains devicetree node. CPUs not listed there share one
+ * more domain. The last CPU of a domain to call cpu_freq_policy_pstate_set()
+ * sets the best P-state of the domain.
+ */
+
+#define CPU_FREQ_DOMAIN_TRACKING
+
+#define DOMAINS_NODE DT_COMPAT_GET_ANY_STATUS_OKAY(zephyr_cpu_freq_domains)
+
+#define NUM_DOMAINS                                                                                \
+	(COND_CODE_1(DT_NODE_EXISTS(DOMAINS_NODE), (DT_CHILD_NUM_STATUS_OKAY(DOMAINS_NODE)), (0))  \
+	 + 1)
+
+struct schedutil_domain {
+	const struct pstate *pstate_best;
+	unsigned int num_unprocessed_cpus;
+};
+
+static struct schedutil_domain domains[NUM_DOMAINS];
+
+#define DOMAIN_CPU_MATCH(node_id, prop, idx)                                                       \
+	if (cpu_id == DT_REG_ADDR(DT_PHANDLE_BY_IDX(node_id, prop, idx))) {                        \
+		return domain;                                                                     \
+	}
+
+#define DOMAIN_MATCH(node_id)                                                                      \
+	DT_FOREACH_PROP_ELEM(node_id, cpus, DOMAIN_CPU_MATCH)                                      \
+	domain++;
+
+static unsigned int cpu_domain(unsigned int cpu_id)
+{
+	unsigned int domain = 0;
+
+	IF_ENABLED(DT_NODE_EXISTS(DOMAINS_NODE),
+		   (DT_FOREACH_CHILD_STATUS_OKAY(DOMAINS_NODE, DOMAIN_MATCH)))
+
+	return domain;
+}
+
+#endif /* CONFIG_SMP && (CONFIG_MP_MAX_NUM_CPUS > 1) && !CONFIG_CPU_FREQ_PER_CPU_SCALING */
+
+static unsigned int current_cpu_id(void)
+{
+#if defined(CONFIG_SMP)
+	/* The caller has already ensured that the CPU is fixed */
+	return arch_curr_cpu()->id;
+#else
+	return 0;
+#endif
+}
+
+/*
+ * Update the utilization of a CPU from the cycles the scheduler accounted to
+ * non-idle threads since the last call. Increases are followed right away,
+ * decreases only progressively, so that the P-state does not drop between
+ * the bursts of a busy period.
+ */
+static int schedutil_update(unsigned int cpu_id, uint32_t *util_out)
+{
+	struct k_thread_runtime_stats stats;
+	struct schedutil_cpu *cpu = &cpus[cpu_id];
+	uint64_t execution_cycles;
+	uint64_t total_cycles;
+	uint32_t util = 0;
+	int ret;
+
+	ret = k_thread_runtime_stats_cpu_get(cpu_id, &stats);
+	if (ret != 0) {
+		LOG_ERR("Could not retrieve runtime statistics from scheduler");
+		return ret;
+	}
+
+	execution_cycles = stats.execution_cycles - cpu->execution_cycles;
+	total_cycles = stats.total_cycles - cpu->total_cycles;
+	cpu->execution_cycles = stats.execution_cycles;
+	cpu->total_cycles = stats.total_cycles;
+
+	if (execution_cycles != 0) {
+		util = (uint32_t)((100 * total_cycles) / execution_cycles);
+	}
+
+	if (util >= cpu->util) {
+		cpu->util = util;
+	} else {
+		cpu->util -= (cpu->util - util + BIT(CONFIG_CPU_FREQ_SCHEDUTIL_DECAY_SHIFT) - 1) >>
+			     CONFIG_CPU_FREQ_SCHEDUTIL_DECAY_SHIFT;
+	}
+
+	*util_out = cpu->util;
+
+	return 0;
+}
+
+/*
+ * Schedutil policy selects the first P-state whose load threshold is met by
+ * the decayed utilization of the CPU plus some headroom, or the first
+ * P-state while the CPU is boosted.
+ */
+int cpu_freq_policy_select_pstate(const struct pstate **pstate_out)
+{
+	unsigned int cpu_id;
+	uint32_t util;
+	uint32_t target;
+	int ret;
+
+	if (pstate_out == NULL) {
+		LOG_ERR("Schedutil Policy: pstate_out is NULL");
+		return -EINVAL;
+	}
+
+	if (ARRAY_SIZE(soc_pstates) == 0) {
+		return -ENOTSUP;
+	}
+
+	cpu_id = current_cpu_id();
+
+	ret = schedutil_update(cpu_id, &util);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (k_uptime_ticks() < cpus[cpu_id].boost_end) {
+		LOG_DBG("CPU%d boosted", cpu_id);
+		*pstate_out = soc_pstates[0];
+		return 0;
+	}
+
+	target = util * (100 + CONFIG_CPU_FREQ_SCHEDUTIL_HEADROOM) / 100;
+
+	LOG_DBG("CPU%d Utilization: %u%%, target: %u%%", cpu_id, util, target);
+
+	for (int i = 0; i < ARRAY_SIZE(soc_pstates); i++) {
+		const struct pstate *state = soc_pstates[i];
+
+		if (target >= state->load_threshold) {
+			*pstate_out = state;
+			LOG_DBG("Schedutil Policy: Selected P-state "
+				"%d with load_threshold=%d%%", i,
+				state->load_threshold);
+			return 0;
+		}
+	}
+
+	LOG_ERR("Schedutil Policy: No suitable P-state found for utilization %u%%", util);
+
+	return -ENOTSUP;
+}
+
+void cpu_freq_policy_reset(void)
+{
+#ifdef CPU_FREQ_DOMAIN_TRACKING
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (unsigned int d = 0; d < NUM_DOMAINS; d++) {
+		domains[d].pstate_best = NULL;
+		domains[d].num_unprocessed_cpus = 0;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		domains[cpu_domain(i)].num_unprocessed_cpus++;
+	}
+
+	k_spin_unlock(&lock, key);
+#endif
+}
+
+const struct pstate *cpu_freq_policy_pstate_set(const struct pstate *state)
+{
+	int rv;
+
+#ifdef CPU_FREQ_DOMAIN_TRACKING
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct schedutil_domain *domain = &domains[cpu_domain(current_cpu_id())];
+
+	if ((domain->pstate_best == NULL) ||
+	    (state->load_threshold > domain->pstate_best->load_threshold)) {
+		domain->pstate_best = state;
+	}
+
+	__ASSERT(domain->num_unprocessed_cpus != 0U, "cpu_freq: Out of sync");
+
+	domain->num_unprocessed_cpus--;
+	if (domain->num_unprocessed_cpus > 0) {
+		k_spin_unlock(&lock, key);
+		return NULL;
+	}
+	state = domain->pstate_best;
+	k_spin_unlock(&lock, key);
+#endif
+
+	rv = cpu_freq_pstate_set(state);
+	if (rv != 0) {
+		LOG_ERR("Failed to set P-state: %d", rv);
+		return NULL;
+	}
+
+	return state;
+}
+
+void cpu_freq_boost(void)
+{
+	k_spinlock_key_t key;
+	unsigned int cpu_id;
+	int rv;
+
+	if (ARRAY_SIZE(soc_pstates) == 0) {
+		return;
+	}
+
+	/* Holding the lock keeps the current CPU from changing */
+	key = k_spin_lock(&lock);
+	cpu_id = current_cpu_id();
+	cpus[cpu_id].boost_end =
+		k_uptime_ticks() + k_ms_to_ticks_ceil64(CONFIG_CPU_FREQ_SCHEDUTIL_BOOST_MS);
+	rv = cpu_freq_pstate_set(soc_pstates[0]);
+	k_spin_unlock(&lock, key);
+
+	if (rv != 0) {
+		LOG_ERR("Failed to set P-state: %d", rv);
+	}
+}
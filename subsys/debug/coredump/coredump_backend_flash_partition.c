@@ -414,9 +414,15 @@ static void coredump_flash_backend_start(void)
 	ret = partition_open();
 
 	if (ret == 0) {
-		/* Erase whole flash partition */
-		ret = flash_area_flatten(backend_ctx.flash_area, 0,
-					 backend_ctx.flash_area->fa_size);
+		if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_FLASH_ERASE_ON_WRITE)) {
+			/* Invalidate the previous coredump, stream flash erases the rest */
+			ret = flash_area_flatten(backend_ctx.flash_area, 0,
+						 HEADER_SCRAMBLE_SIZE);
+		} else {
+			/* Erase whole flash partition */
+			ret = flash_area_flatten(backend_ctx.flash_area, 0,
+						 backend_ctx.flash_area->fa_size);
+		}
 	}
 
 	if (ret == 0) {
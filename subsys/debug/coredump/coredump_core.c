@@ -12,6 +12,12 @@
 #include <zephyr/sys/util.h>
 
 #include "coredump_internal.h"
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION_LZ4
+#include <string.h>
+#include <lz4.h>
+#endif
+
 #if defined(CONFIG_DEBUG_COREDUMP_BACKEND_LOGGING)
 extern struct coredump_backend_api coredump_backend_logging;
 static struct coredump_backend_api
@@ -56,6 +62,56 @@ __weak void arch_coredump_priv_stack_dump(struct k_thread *thread)
 }
 #endif /* CONFIG_DEBUG_COREDUMP_DUMP_THREAD_PRIV_STACK */
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION_LZ4
+#define CHUNK_SIZE CONFIG_DEBUG_COREDUMP_COMPRESSION_CHUNK_SIZE
+
+/*
+ * Memory keeps changing while being dumped (e.g. the stack of this
+ * thread), so chunks are compressed from a copy.
+ */
+static struct {
+	LZ4_stream_t state;
+	char in[CHUNK_SIZE];
+	char out[LZ4_COMPRESSBOUND(CHUNK_SIZE)];
+} lz4_ctx;
+
+/**
+ * @brief Dump a memory chunk compressed if it makes it smaller.
+ *
+ * @return true if the chunk was dumped compressed
+ */
+static bool dump_compressed(uintptr_t start_addr, size_t len)
+{
+	struct coredump_compressed_mem_hdr_t m = {
+		.id = COREDUMP_COMPRESSED_MEM_HDR_ID,
+		.hdr_version = COREDUMP_COMPRESSED_MEM_HDR_VER,
+	};
+	int out_len;
+
+	(void)memcpy(lz4_ctx.in, UINT_TO_POINTER(start_addr), len);
+
+	out_len = LZ4_compress_fast_extState(&lz4_ctx.state, lz4_ctx.in, lz4_ctx.out, len,
+					     sizeof(lz4_ctx.out), 1);
+	if ((out_len <= 0) || ((size_t)out_len >= len)) {
+		return false;
+	}
+
+	if (sizeof(uintptr_t) == 8) {
+		m.start = sys_cpu_to_le64(start_addr);
+		m.end = sys_cpu_to_le64(start_addr + len);
+	} else if (sizeof(uintptr_t) == 4) {
+		m.start = sys_cpu_to_le32(start_addr);
+		m.end = sys_cpu_to_le32(start_addr + len);
+	}
+	m.num_bytes = sys_cpu_to_le32(out_len);
+
+	coredump_buffer_output((uint8_t *)&m, sizeof(m));
+	coredump_buffer_output((uint8_t *)lz4_ctx.out, out_len);
+
+	return true;
+}
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESSION_LZ4 */
+
 static void dump_header(unsigned int reason)
 {
 	struct coredump_hdr_t hdr = {
@@ -245,9 +301,26 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 	backend_api->buffer_output(buf, buflen);
 }
 
-void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
+static void dump_mem_hdr(uintptr_t start_addr, uintptr_t end_addr)
 {
 	struct coredump_mem_hdr_t m;
+
+	m.id = COREDUMP_MEM_HDR_ID;
+	m.hdr_version = COREDUMP_MEM_HDR_VER;
+
+	if (sizeof(uintptr_t) == 8) {
+		m.start	= sys_cpu_to_le64(start_addr);
+		m.end = sys_cpu_to_le64(end_addr);
+	} else if (sizeof(uintptr_t) == 4) {
+		m.start	= sys_cpu_to_le32(start_addr);
+		m.end = sys_cpu_to_le32(end_addr);
+	}
+
+	coredump_buffer_output((uint8_t *)&m, sizeof(m));
+}
+
+void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
+{
 	size_t len;
 
 	if ((start_addr == POINTER_TO_UINT(NULL)) ||
@@ -259,22 +332,24 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 		return;
 	}
 
-	len = end_addr - start_addr;
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION_LZ4
+	/* Chunks that do not compress are dumped as is */
+	while (start_addr < end_addr) {
+		len = MIN(end_addr - start_addr, CHUNK_SIZE);
 
-	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+		if (!dump_compressed(start_addr, len)) {
+			dump_mem_hdr(start_addr, start_addr + len);
+			coredump_buffer_output((uint8_t *)start_addr, len);
+		}
 
-	if (sizeof(uintptr_t) == 8) {
-		m.start	= sys_cpu_to_le64(start_addr);
-		m.end = sys_cpu_to_le64(end_addr);
-	} else if (sizeof(uintptr_t) == 4) {
-		m.start	= sys_cpu_to_le32(start_addr);
-		m.end = sys_cpu_to_le32(end_addr);
+		start_addr += len;
 	}
+#else
+	len = end_addr - start_addr;
 
-	coredump_buffer_output((uint8_t *)&m, sizeof(m));
-
+	dump_mem_hdr(start_addr, end_addr);
 	coredump_buffer_output((uint8_t *)start_addr, len);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
@@ -0,0 +1,241 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Segmented Least Recently Used (SLRU) eviction algorithm for demand paging.
+ *
+ * Like the LRU algorithm, this relies on MMUs that need manual tracking of
+ * their "accessed" page flag, so re-references can be observed.
+ *
+ * Theory of Operation:
+ *
+ * - Page frames are kept on one of two queues. The probation queue holds
+ *   pages that have been used once since they were paged in, the protected
+ *   queue holds pages that have been used again afterwards.
+ *
+ * - Page frames made evictable are appended to the end of the probation
+ *   queue with k_mem_paging_eviction_add().
+ *
+ * - The page at the head of each queue is made unaccessible. When accessed,
+ *   it causes a fault and k_mem_paging_eviction_accessed() moves it to the
+ *   end of the protected queue, so a re-referenced probation page gets
+ *   promoted and a protected page goes back to the end of its queue.
+ *
+ * - The protected queue is limited to a share of all tracked pages given by
+ *   CONFIG_EVICTION_SLRU_PROTECTED_PERCENT. When a promotion makes it grow
+ *   beyond that, its head page is demoted to the end of the probation queue
+ *   and stays unaccessible, so it is promoted again as soon as it is used.
+ *
+ * - On page reclamation, the head of the probation queue is selected. The
+ *   head of the protected queue is only selected if there is no page on
+ *   probation.
+ *
+ * Pages that are only touched once, like a large table swept in one go,
+ * therefore go through the probation queue and get evicted from it without
+ * displacing the working set held in the protected queue. All operations
+ * are O(1).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+#include <kernel_internal.h>
+
+/*
+ * Number of bits needed to store a page frame index. Rounded up to a byte
+ * boundary for best compromise between code performance and space saving.
+ * Index 0 means no page frame, actual indexes are offset by 1.
+ */
+#define PF_IDX_BITS ROUND_UP(LOG2CEIL(K_MEM_NUM_PAGE_FRAMES + 1), BITS_PER_BYTE)
+
+/* For each page frame, track the previous and next page frame in its queue. */
+struct slru_pf_idx {
+	uint32_t next : PF_IDX_BITS;
+	uint32_t prev : PF_IDX_BITS;
+} __packed;
+
+enum slru_queue_id {
+	SLRU_NONE,
+	SLRU_PROBATION,
+	SLRU_PROTECTED,
+	SLRU_NUM_QUEUES,
+};
+
+struct slru_queue {
+	uint32_t head;
+	uint32_t tail;
+	uint32_t count;
+};
+
+static struct slru_pf_idx slru_pf_links[K_MEM_NUM_PAGE_FRAMES + 1];
+static uint8_t slru_pf_queue_id[K_MEM_NUM_PAGE_FRAMES + 1];
+static struct slru_queue slru_queues[SLRU_NUM_QUEUES];
+static struct k_spinlock slru_lock;
+
+static inline uint32_t pf_to_idx(struct k_mem_page_frame *pf)
+{
+	return (pf - k_mem_page_frames) + 1;
+}
+
+static inline struct k_mem_page_frame *idx_to_pf(uint32_t idx)
+{
+	return &k_mem_page_frames[idx - 1];
+}
+
+static void slru_pf_clear_accessed(uint32_t pf_idx)
+{
+	struct k_mem_page_frame *pf = idx_to_pf(pf_idx);
+	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, true);
+
+	/* clearing the accessed flag expected only on loaded pages */
+	__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0, "");
+	ARG_UNUSED(flags);
+}
+
+static void slru_pf_append(enum slru_queue_id id, uint32_t pf_idx)
+{
+	struct slru_queue *queue = &slru_queues[id];
+
+	slru_pf_links[pf_idx].next = 0;
+	slru_pf_links[pf_idx].prev = queue->tail;
+
+	if (queue->tail != 0) {
+		slru_pf_links[queue->tail].next = pf_idx;
+	} else {
+		queue->head = pf_idx;
+	}
+
+	queue->tail = pf_idx;
+	queue->count++;
+	slru_pf_queue_id[pf_idx] = id;
+}
+
+static void slru_pf_remove(uint32_t pf_idx)
+{
+	struct slru_queue *queue = &slru_queues[slru_pf_queue_id[pf_idx]];
+	uint32_t next = slru_pf_links[pf_idx].next;
+	uint32_t prev = slru_pf_links[pf_idx].prev;
+
+	if (prev != 0) {
+		slru_pf_links[prev].next = next;
+	} else {
+		queue->head = next;
+	}
+
+	if (next != 0) {
+		slru_pf_links[next].prev = prev;
+	} else {
+		queue->tail = prev;
+	}
+
+	slru_pf_links[pf_idx].next = 0;
+	slru_pf_links[pf_idx].prev = 0;
+	slru_pf_queue_id[pf_idx] = SLRU_NONE;
+	queue->count--;
+
+	/* make new head PF unaccessible if it exists and it is not alone */
+	if ((prev == 0) && (queue->head != 0) && (queue->count > 1)) {
+		slru_pf_clear_accessed(queue->head);
+	}
+}
+
+static inline bool slru_pf_in_queue(uint32_t pf_idx)
+{
+	return slru_pf_queue_id[pf_idx] != SLRU_NONE;
+}
+
+static inline bool slru_protected_full(void)
+{
+	uint32_t total = slru_queues[SLRU_PROBATION].count + slru_queues[SLRU_PROTECTED].count;
+
+	return slru_queues[SLRU_PROTECTED].count >
+	       (total * CONFIG_EVICTION_SLRU_PROTECTED_PERCENT) / 100U;
+}
+
+static void slru_pf_promote(uint32_t pf_idx)
+{
+	slru_pf_remove(pf_idx);
+	slru_pf_append(SLRU_PROTECTED, pf_idx);
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	z_paging_stats_eviction_promoted_inc();
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
+	while (slru_protected_full()) {
+		uint32_t demoted_idx = slru_queues[SLRU_PROTECTED].head;
+
+		slru_pf_remove(demoted_idx);
+		slru_pf_append(SLRU_PROBATION, demoted_idx);
+
+		/* stays unaccessible so the next use promotes it again */
+		slru_pf_clear_accessed(demoted_idx);
+
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		z_paging_stats_eviction_demoted_inc();
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+	}
+}
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&slru_lock);
+
+	__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+	__ASSERT(!slru_pf_in_queue(pf_idx), "");
+	slru_pf_append(SLRU_PROBATION, pf_idx);
+	k_spin_unlock(&slru_lock, key);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&slru_lock);
+
+	__ASSERT(slru_pf_in_queue(pf_idx), "");
+	slru_pf_remove(pf_idx);
+	k_spin_unlock(&slru_lock, key);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	struct k_mem_page_frame *pf = k_mem_phys_to_page_frame(phys);
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&slru_lock);
+
+	if (slru_pf_queue_id[pf_idx] == SLRU_PROBATION) {
+		slru_pf_promote(pf_idx);
+	} else if (slru_pf_queue_id[pf_idx] == SLRU_PROTECTED) {
+		slru_pf_remove(pf_idx);
+		slru_pf_append(SLRU_PROTECTED, pf_idx);
+	}
+	k_spin_unlock(&slru_lock, key);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	uint32_t head_pf_idx = slru_queues[SLRU_PROBATION].head;
+
+	if (head_pf_idx == 0) {
+		head_pf_idx = slru_queues[SLRU_PROTECTED].head;
+	}
+
+	if (head_pf_idx == 0) {
+		return NULL;
+	}
+
+	struct k_mem_page_frame *pf = idx_to_pf(head_pf_idx);
+	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+
+	__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+	*dirty_ptr = ((flags & ARCH_DATA_PAGE_DIRTY) != 0);
+	return pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
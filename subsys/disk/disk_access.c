@@ -24,6 +24,372 @@ static sys_dlist_t disk_access_list = SYS_DLIST_STATIC_INIT(&disk_access_list);
 /* lock to protect storage layer registration */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_DISK_ACCESS_CACHE
+#define CACHE_SECTOR_SIZE CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE
+#define CACHE_COALESCE CONFIG_DISK_ACCESS_CACHE_COALESCE_SECTORS
+
+/* Values of disk_info.cache_state */
+#define DISK_CACHE_UNKNOWN 0U
+#define DISK_CACHE_ON 1U
+#define DISK_CACHE_OFF 2U
+
+struct disk_cache_entry {
+	/* Node in disk_cache_lru, least recently used first */
+	sys_dnode_t node;
+	/* NULL when the entry is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t data[CACHE_SECTOR_SIZE] __aligned(4);
+};
+
+static struct disk_cache_entry disk_cache_entries[CONFIG_DISK_ACCESS_CACHE_SECTORS];
+static size_t disk_cache_used;
+static sys_dlist_t disk_cache_lru = SYS_DLIST_STATIC_INIT(&disk_cache_lru);
+/* Consecutive dirty sectors are gathered here to be written at once */
+static uint8_t disk_cache_coalesce_buf[CACHE_COALESCE * CACHE_SECTOR_SIZE] __aligned(4);
+/* Protects the cache, held while calling the drivers of cached disks */
+static K_MUTEX_DEFINE(disk_cache_lock);
+
+static K_KERNEL_STACK_DEFINE(disk_cache_stack, CONFIG_DISK_ACCESS_CACHE_WRITEBACK_STACK_SIZE);
+static struct k_work_q disk_cache_work_q;
+
+static void disk_cache_writeback(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(disk_cache_writeback_work, disk_cache_writeback);
+
+static bool disk_cache_enabled(struct disk_info *disk)
+{
+	uint32_t sector_size = 0U;
+
+	if ((disk->cache_state == DISK_CACHE_UNKNOWN) && (disk->refcnt > 0U)) {
+		if ((disk->ops->ioctl != NULL) &&
+		    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) == 0) &&
+		    (sector_size == CACHE_SECTOR_SIZE)) {
+			disk->cache_state = DISK_CACHE_ON;
+		} else {
+			disk->cache_state = DISK_CACHE_OFF;
+		}
+	}
+
+	return disk->cache_state == DISK_CACHE_ON;
+}
+
+static struct disk_cache_entry *disk_cache_find(struct disk_info *disk, uint32_t sector)
+{
+	for (size_t i = 0; i < disk_cache_used; i++) {
+		struct disk_cache_entry *entry = &disk_cache_entries[i];
+
+		if ((entry->disk == disk) && (entry->sector == sector)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void disk_cache_touch(struct disk_cache_entry *entry)
+{
+	sys_dlist_remove(&entry->node);
+	sys_dlist_append(&disk_cache_lru, &entry->node);
+}
+
+/* Writes back the run of consecutive dirty sectors containing entry */
+static int disk_cache_write_run(struct disk_cache_entry *entry)
+{
+	struct disk_info *disk = entry->disk;
+	struct disk_cache_entry *run[CACHE_COALESCE];
+	struct disk_cache_entry *other;
+	uint32_t first = entry->sector;
+	uint32_t count;
+	int rc;
+
+	while ((first > 0U) && (entry->sector - first + 1U < CACHE_COALESCE)) {
+		other = disk_cache_find(disk, first - 1U);
+		if ((other == NULL) || !other->dirty) {
+			break;
+		}
+		first--;
+	}
+
+	for (count = 0U; count < CACHE_COALESCE; count++) {
+		other = disk_cache_find(disk, first + count);
+		if ((other == NULL) || !other->dirty) {
+			break;
+		}
+		run[count] = other;
+		memcpy(&disk_cache_coalesce_buf[count * CACHE_SECTOR_SIZE], other->data,
+		       CACHE_SECTOR_SIZE);
+	}
+
+	rc = disk->ops->write(disk, disk_cache_coalesce_buf, first, count);
+	if (rc != 0) {
+		return rc;
+	}
+
+	for (uint32_t i = 0U; i < count; i++) {
+		run[i]->dirty = false;
+	}
+
+	return 0;
+}
+
+/* Writes back the cached writes of disk, or of all the disks if NULL */
+static int disk_cache_flush(struct disk_info *disk)
+{
+	int rc = 0;
+
+	for (size_t i = 0; i < disk_cache_used; i++) {
+		struct disk_cache_entry *entry = &disk_cache_entries[i];
+		int ret;
+
+		if (!entry->dirty || ((disk != NULL) && (entry->disk != disk))) {
+			continue;
+		}
+
+		ret = disk_cache_write_run(entry);
+		if (ret != 0) {
+			LOG_ERR("disk %s: writeback of sector %u failed (%d)", entry->disk->name,
+				entry->sector, ret);
+			rc = ret;
+		}
+	}
+
+	return rc;
+}
+
+static void disk_cache_writeback(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+	(void)disk_cache_flush(NULL);
+	k_mutex_unlock(&disk_cache_lock);
+}
+
+/* Gets an entry for sector, evicting the least recently used one if needed */
+static int disk_cache_alloc(struct disk_info *disk, uint32_t sector,
+			    struct disk_cache_entry **entry)
+{
+	struct disk_cache_entry *victim;
+	int rc;
+
+	if (disk_cache_used < ARRAY_SIZE(disk_cache_entries)) {
+		victim = &disk_cache_entries[disk_cache_used++];
+		sys_dlist_append(&disk_cache_lru, &victim->node);
+	} else {
+		victim = CONTAINER_OF(sys_dlist_peek_head(&disk_cache_lru),
+				      struct disk_cache_entry, node);
+		if (victim->dirty) {
+			rc = disk_cache_write_run(victim);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+	}
+
+	victim->disk = disk;
+	victim->sector = sector;
+	victim->dirty = false;
+	disk_cache_touch(victim);
+	*entry = victim;
+
+	return 0;
+}
+
+static int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_entry *entry;
+	uint32_t i = 0U;
+	int rc = 0;
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	if (!disk_cache_enabled(disk)) {
+		k_mutex_unlock(&disk_cache_lock);
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	while (i < num_sector) {
+		uint8_t *buf = &data_buf[i * CACHE_SECTOR_SIZE];
+		uint32_t count = 1U;
+
+		entry = disk_cache_find(disk, start_sector + i);
+		if (entry != NULL) {
+			memcpy(buf, entry->data, CACHE_SECTOR_SIZE);
+			disk_cache_touch(entry);
+			i++;
+			continue;
+		}
+
+		/* Read up to the next cached sector at once */
+		while ((i + count < num_sector) &&
+		       (disk_cache_find(disk, start_sector + i + count) == NULL)) {
+			count++;
+		}
+
+		rc = disk->ops->read(disk, buf, start_sector + i, count);
+		if (rc != 0) {
+			break;
+		}
+
+		/* Large reads would evict the sectors that are accessed often */
+		for (uint32_t j = 0U; (num_sector <= CACHE_COALESCE) && (j < count); j++) {
+			if (disk_cache_alloc(disk, start_sector + i + j, &entry) != 0) {
+				break;
+			}
+			memcpy(entry->data, &buf[j * CACHE_SECTOR_SIZE], CACHE_SECTOR_SIZE);
+		}
+
+		i += count;
+	}
+
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
+
+static int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+			    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_entry *entry;
+	int rc = 0;
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	if (!disk_cache_enabled(disk)) {
+		k_mutex_unlock(&disk_cache_lock);
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (num_sector > CACHE_COALESCE) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		if (rc == 0) {
+			/* The cached copies of the written sectors are clean now */
+			for (size_t i = 0; i < disk_cache_used; i++) {
+				uint32_t index;
+
+				entry = &disk_cache_entries[i];
+				index = entry->sector - start_sector;
+				if ((entry->disk == disk) && (index < num_sector)) {
+					memcpy(entry->data, &data_buf[index * CACHE_SECTOR_SIZE],
+					       CACHE_SECTOR_SIZE);
+					entry->dirty = false;
+				}
+			}
+		}
+
+		k_mutex_unlock(&disk_cache_lock);
+		return rc;
+	}
+
+	for (uint32_t i = 0U; i < num_sector; i++) {
+		entry = disk_cache_find(disk, start_sector + i);
+		if (entry == NULL) {
+			rc = disk_cache_alloc(disk, start_sector + i, &entry);
+			if (rc != 0) {
+				break;
+			}
+		} else {
+			disk_cache_touch(entry);
+		}
+
+		memcpy(entry->data, &data_buf[i * CACHE_SECTOR_SIZE], CACHE_SECTOR_SIZE);
+		entry->dirty = true;
+	}
+
+	(void)k_work_schedule_for_queue(&disk_cache_work_q, &disk_cache_writeback_work,
+					K_MSEC(CONFIG_DISK_ACCESS_CACHE_WRITEBACK_DELAY_MS));
+
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
+
+static int disk_cache_sync(struct disk_info *disk)
+{
+	int rc;
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+	rc = disk_cache_flush(disk);
+	k_mutex_unlock(&disk_cache_lock);
+
+	return rc;
+}
+
+/* Writes back and drops the cached sectors of a disk going away. Unless forced,
+ * they are kept if the writeback fails.
+ */
+static int disk_cache_detach(struct disk_info *disk, bool force)
+{
+	int rc;
+
+	k_mutex_lock(&disk_cache_lock, K_FOREVER);
+
+	rc = disk_cache_flush(disk);
+	if ((rc == 0) || force) {
+		for (size_t i = 0; i < disk_cache_used; i++) {
+			struct disk_cache_entry *entry = &disk_cache_entries[i];
+
+			if (entry->disk == disk) {
+				/* Free entries are reused first */
+				entry->disk = NULL;
+				entry->dirty = false;
+				sys_dlist_remove(&entry->node);
+				sys_dlist_prepend(&disk_cache_lru, &entry->node);
+			}
+		}
+		disk->cache_state = DISK_CACHE_UNKNOWN;
+	}
+
+	k_mutex_unlock(&disk_cache_lock);
+
+	return force ? 0 : rc;
+}
+
+static int disk_cache_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "disk_cache",
+	};
+
+	k_work_queue_start(&disk_cache_work_q, disk_cache_stack,
+			   K_KERNEL_STACK_SIZEOF(disk_cache_stack),
+			   CONFIG_DISK_ACCESS_CACHE_WRITEBACK_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+				  uint32_t start_sector, uint32_t num_sector)
+{
+	return disk->ops->read(disk, data_buf, start_sector, num_sector);
+}
+
+static inline int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+				   uint32_t start_sector, uint32_t num_sector)
+{
+	return disk->ops->write(disk, data_buf, start_sector, num_sector);
+}
+
+static inline int disk_cache_sync(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+
+	return 0;
+}
+
+static inline int disk_cache_detach(struct disk_info *disk, bool force)
+{
+	ARG_UNUSED(disk);
+	ARG_UNUSED(force);
+
+	return 0;
+}
+#endif /* CONFIG_DISK_ACCESS_CACHE */
+
 struct disk_info *disk_access_get_di(const char *name)
 {
 	struct disk_info *disk = NULL, *itr;
@@ -98,7 +464,7 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
-		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
 	}
 
 	return rc;
@@ -112,7 +478,7 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
-		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
 	}
 
 	return rc;
@@ -142,11 +508,15 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 		case DISK_IOCTL_CTRL_DEINIT:
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
+				(void)disk_cache_detach(disk, true);
 				disk->refcnt = 0U;
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
-				rc = disk->ops->ioctl(disk, cmd, buf);
+				rc = disk_cache_detach(disk, false);
+				if (rc == 0) {
+					rc = disk->ops->ioctl(disk, cmd, buf);
+				}
 				if (rc == 0) {
 					disk->refcnt--;
 				}
@@ -157,6 +527,13 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			/* Write back the cached writes first */
+			rc = disk_cache_sync(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -181,6 +558,9 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	disk->cache_state = DISK_CACHE_UNKNOWN;
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -204,6 +584,8 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	(void)disk_cache_detach(disk, true);
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
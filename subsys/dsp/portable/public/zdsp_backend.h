@@ -0,0 +1,13 @@
+/* Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_DSP_PORTABLE_PUBLIC_ZDSP_BACKEND_H_
+#define SUBSYS_DSP_PORTABLE_PUBLIC_ZDSP_BACKEND_H_
+
+/*
+ * The portable backend implements the zDSP functions out of line, in
+ * subsys/dsp/portable, so there is nothing to map here.
+ */
+
+#endif /* SUBSYS_DSP_PORTABLE_PUBLIC_ZDSP_BACKEND_H_ */
@@ -63,10 +63,42 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE
+	/** First row changed since the last finalize */
+	uint16_t dirty_y0;
+
+	/** Row after the last row changed since the last finalize */
+	uint16_t dirty_y1;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+static inline void mark_dirty(struct char_framebuffer *fb, int16_t y, uint16_t height)
+{
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE
+	const int16_t y0 = CLAMP(y, 0, fb->y_res);
+	const int16_t y1 = CLAMP(y + height, 0, fb->y_res);
+
+	if (y0 >= y1) {
+		return;
+	}
+
+	if (fb->dirty_y0 >= fb->dirty_y1) {
+		fb->dirty_y0 = y0;
+		fb->dirty_y1 = y1;
+	} else {
+		fb->dirty_y0 = MIN(fb->dirty_y0, y0);
+		fb->dirty_y1 = MAX(fb->dirty_y1, y1);
+	}
+#else
+	ARG_UNUSED(fb);
+	ARG_UNUSED(y);
+	ARG_UNUSED(height);
+#endif
+}
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, uint8_t c)
 {
 	return (uint8_t *)fptr->data +
@@ -297,6 +329,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index] |= m;
+	mark_dirty(fb, y, 1);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -332,7 +365,7 @@ static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16
 static int draw_text(const struct device *dev, const char *const str, int16_t x, int16_t y,
 		     bool wrap)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const struct cfb_font *fptr;
 
 	if (!fb->fonts || !fb->buf) {
@@ -353,6 +386,7 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 			x = 0U;
 			y += fptr->height;
 		}
+		mark_dirty(fb, y, fptr->height);
 		if (fb->screen_info & SCREEN_INFO_MONO_VTILED) {
 			x += fb->kerning + draw_char_vtmono(fb, str[i], x, y, wrap);
 		} else {
@@ -437,7 +471,7 @@ int cfb_print(const struct device *dev, const char *const str, uint16_t x, uint1
 int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		    uint16_t width, uint16_t height)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const bool need_reverse = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
 
 	if (x >= fb->x_res || y >= fb->y_res) {
@@ -463,6 +497,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			height = fb->y_res - y;
 		}
 
+		mark_dirty(fb, y, height);
+
 		for (size_t i = x; i < x + width; i++) {
 			for (size_t j = y; j < (y + height); j++) {
 				/*
@@ -532,13 +568,14 @@ static int cfb_invert(const struct char_framebuffer *fb)
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 
 	if (!fb->buf) {
 		return -ENODEV;
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_dirty(fb, 0, fb->y_res);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -552,6 +589,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	struct char_framebuffer *fb = &char_fb;
 
 	fb->inverted = !fb->inverted;
+	mark_dirty(fb, 0, fb->y_res);
 
 	return 0;
 }
@@ -559,7 +597,10 @@ int cfb_framebuffer_invert(const struct device *dev)
 int cfb_framebuffer_finalize(const struct device *dev)
 {
 	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
+	uint16_t y0 = 0;
+	uint16_t y1 = fb->y_res;
+	uint8_t *buf;
 	int err;
 
 	__ASSERT_NO_MSG(DEVICE_API_IS(display, dev));
@@ -568,21 +609,41 @@ int cfb_framebuffer_finalize(const struct device *dev)
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE
+	if (fb->dirty_y0 >= fb->dirty_y1) {
+		return 0;
+	}
+
+	/* Write full width bands of whole tiles, which are contiguous in the buffer */
+	y0 = ROUND_DOWN(fb->dirty_y0, fb->ppt);
+	y1 = MIN(ROUND_UP(fb->dirty_y1, fb->ppt), fb->y_res);
+#endif
+
+	buf = &fb->buf[y0 * fb->x_res / 8U];
+
 	struct display_buffer_descriptor desc = {
-		.buf_size = fb->size,
+		.buf_size = (y1 - y0) * fb->x_res / 8U,
 		.width = fb->x_res,
-		.height = fb->y_res,
+		.height = y1 - y0,
 		.pitch = fb->x_res,
 	};
 
 	if ((fb->pixel_format == PIXEL_FORMAT_MONO10) == fb->inverted) {
 		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
+		err = api->write(dev, 0, y0, &desc, buf);
 		cfb_invert(fb);
-		return err;
+	} else {
+		err = api->write(dev, 0, y0, &desc, buf);
+	}
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE
+	if (err == 0) {
+		fb->dirty_y0 = 0;
+		fb->dirty_y1 = 0;
 	}
+#endif
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	return err;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -690,6 +751,7 @@ int cfb_framebuffer_init(const struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_dirty(fb, 0, fb->y_res);
 
 	return 0;
 }
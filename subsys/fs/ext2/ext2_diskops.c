@@ -374,18 +374,111 @@ static int32_t get_itable_entry(struct ext2_data *fs, uint32_t ino)
 	return block_offset;
 }
 
-int ext2_fetch_inode(struct ext2_data *fs, uint32_t ino, struct ext2_inode *inode)
+#if CONFIG_EXT2_INODE_CACHE_SIZE > 0
+
+struct ext2_cached_inode {
+	sys_dnode_t node;
+	uint32_t ino; /* 0 for unused entries */
+	struct ext2_disk_inode dino;
+};
+
+static struct ext2_cached_inode inode_cache[CONFIG_EXT2_INODE_CACHE_SIZE];
+
+/* Most recently used entries are at the head */
+static sys_dlist_t inode_cache_lru;
+
+void ext2_inode_cache_reset(void)
 {
+	sys_dlist_init(&inode_cache_lru);
+	for (int i = 0; i < CONFIG_EXT2_INODE_CACHE_SIZE; ++i) {
+		inode_cache[i].ino = 0;
+		sys_dlist_append(&inode_cache_lru, &inode_cache[i].node);
+	}
+}
 
-	int32_t itable_offset = get_itable_entry(fs, ino);
+static struct ext2_cached_inode *inode_cache_find(uint32_t ino)
+{
+	struct ext2_cached_inode *ci;
 
-	LOG_DBG("fetch inode: %d", ino);
+	SYS_DLIST_FOR_EACH_CONTAINER(&inode_cache_lru, ci, node) {
+		if (ci->ino == ino) {
+			sys_dlist_remove(&ci->node);
+			sys_dlist_prepend(&inode_cache_lru, &ci->node);
+			return ci;
+		}
+	}
+	return NULL;
+}
 
-	if (itable_offset < 0) {
-		return itable_offset;
+static struct ext2_disk_inode *inode_cache_lookup(uint32_t ino)
+{
+	struct ext2_cached_inode *ci = inode_cache_find(ino);
+
+	return ci != NULL ? &ci->dino : NULL;
+}
+
+static void inode_cache_store(uint32_t ino, const struct ext2_disk_inode *dino)
+{
+	struct ext2_cached_inode *ci = inode_cache_find(ino);
+
+	if (ci == NULL) {
+		ci = CONTAINER_OF(sys_dlist_peek_tail(&inode_cache_lru), struct ext2_cached_inode,
+				  node);
+		ci->ino = ino;
+		sys_dlist_remove(&ci->node);
+		sys_dlist_prepend(&inode_cache_lru, &ci->node);
+	}
+	ci->dino = *dino;
+}
+
+static void inode_cache_remove(uint32_t ino)
+{
+	struct ext2_cached_inode *ci = inode_cache_find(ino);
+
+	if (ci != NULL) {
+		ci->ino = 0;
+		sys_dlist_remove(&ci->node);
+		sys_dlist_append(&inode_cache_lru, &ci->node);
 	}
+}
 
-	struct ext2_disk_inode *dino = &BGROUP_INODE_TABLE(&fs->bgroup)[itable_offset];
+#else
+
+void ext2_inode_cache_reset(void)
+{
+}
+
+static inline struct ext2_disk_inode *inode_cache_lookup(uint32_t ino)
+{
+	return NULL;
+}
+
+static inline void inode_cache_store(uint32_t ino, const struct ext2_disk_inode *dino)
+{
+}
+
+static inline void inode_cache_remove(uint32_t ino)
+{
+}
+
+#endif /* CONFIG_EXT2_INODE_CACHE_SIZE > 0 */
+
+int ext2_fetch_inode(struct ext2_data *fs, uint32_t ino, struct ext2_inode *inode)
+{
+	struct ext2_disk_inode *dino = inode_cache_lookup(ino);
+
+	LOG_DBG("fetch inode: %d", ino);
+
+	if (dino == NULL) {
+		int32_t itable_offset = get_itable_entry(fs, ino);
+
+		if (itable_offset < 0) {
+			return itable_offset;
+		}
+
+		dino = &BGROUP_INODE_TABLE(&fs->bgroup)[itable_offset];
+		inode_cache_store(ino, dino);
+	}
 
 	fill_inode(inode, dino);
 
@@ -834,7 +927,14 @@ int ext2_commit_inode(struct ext2_inode *inode)
 	/* fill dinode */
 	fill_disk_inode(dino, inode);
 
-	return ext2_write_block(fs, fs->bgroup.inode_table);
+	int rc = ext2_write_block(fs, fs->bgroup.inode_table);
+
+	if (rc < 0) {
+		inode_cache_remove(inode->i_id);
+		return rc;
+	}
+	inode_cache_store(inode->i_id, dino);
+	return 0;
 }
 
 int ext2_commit_inode_block(struct ext2_inode *inode)
@@ -864,6 +964,8 @@ int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 		return itable_offset;
 	}
 
+	inode_cache_remove(ino);
+
 	memset(&BGROUP_INODE_TABLE(&fs->bgroup)[itable_offset], 0, sizeof(struct ext2_disk_inode));
 	ret = ext2_write_block(fs, fs->bgroup.inode_table);
 	return ret;
@@ -1158,7 +1260,7 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 		LOG_DBG("block bitmap write returned: %d", rc);
 		return -EIO;
 	}
-	rc = fs->backend_ops->sync(fs);
+	rc = ext2_sync(fs);
 	if (rc < 0) {
 		return -EIO;
 	}
@@ -30,6 +30,11 @@ int ext2_fetch_superblock(struct ext2_data *fs);
  */
 int ext2_fetch_inode(struct ext2_data *fs, uint32_t ino, struct ext2_inode *inode);
 
+/**
+ * @brief Drop all inodes kept in the inode cache.
+ */
+void ext2_inode_cache_reset(void);
+
 /**
  * @brief Fetch block into buffer in the inode structure.
  *
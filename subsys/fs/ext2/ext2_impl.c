@@ -66,6 +66,156 @@ void error_behavior(struct ext2_data *fs, const char *msg)
 
 /* Block operations --------------------------------------------------------- */
 
+#if CONFIG_EXT2_BLOCK_CACHE_SIZE > 0
+
+struct ext2_cached_block {
+	sys_dnode_t node;
+	uint32_t num;
+	bool valid;
+	bool dirty;
+	uint8_t __aligned(sizeof(void *)) data[CONFIG_EXT2_MAX_BLOCK_SIZE];
+};
+
+static struct ext2_cached_block block_cache[CONFIG_EXT2_BLOCK_CACHE_SIZE];
+
+/* Most recently used entries are at the head */
+static sys_dlist_t block_cache_lru;
+
+static void block_cache_reset(void)
+{
+	sys_dlist_init(&block_cache_lru);
+	for (int i = 0; i < CONFIG_EXT2_BLOCK_CACHE_SIZE; ++i) {
+		block_cache[i].valid = false;
+		block_cache[i].dirty = false;
+		sys_dlist_append(&block_cache_lru, &block_cache[i].node);
+	}
+}
+
+static struct ext2_cached_block *block_cache_find(uint32_t num)
+{
+	struct ext2_cached_block *cb;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&block_cache_lru, cb, node) {
+		if (cb->valid && cb->num == num) {
+			sys_dlist_remove(&cb->node);
+			sys_dlist_prepend(&block_cache_lru, &cb->node);
+			return cb;
+		}
+	}
+	return NULL;
+}
+
+static int block_cache_writeback(struct ext2_data *fs, struct ext2_cached_block *cb)
+{
+	int ret;
+
+	if (!cb->dirty) {
+		return 0;
+	}
+
+	ret = fs->backend_ops->write_block(fs, cb->data, cb->num);
+	if (ret < 0) {
+		LOG_ERR("block cache: write back of block %d error %d", cb->num, ret);
+		return ret;
+	}
+	cb->dirty = false;
+	return 0;
+}
+
+/* Take the least recently used entry for the given block. */
+static struct ext2_cached_block *block_cache_alloc(struct ext2_data *fs, uint32_t num)
+{
+	struct ext2_cached_block *cb;
+
+	cb = CONTAINER_OF(sys_dlist_peek_tail(&block_cache_lru), struct ext2_cached_block, node);
+	if (block_cache_writeback(fs, cb) < 0) {
+		return NULL;
+	}
+
+	cb->num = num;
+	cb->valid = true;
+	sys_dlist_remove(&cb->node);
+	sys_dlist_prepend(&block_cache_lru, &cb->node);
+	return cb;
+}
+
+static bool block_cache_read(struct ext2_data *fs, uint32_t num, uint8_t *data)
+{
+	struct ext2_cached_block *cb = block_cache_find(num);
+
+	if (cb == NULL) {
+		return false;
+	}
+	memcpy(data, cb->data, fs->block_size);
+	return true;
+}
+
+static void block_cache_fill(struct ext2_data *fs, uint32_t num, const uint8_t *data)
+{
+	struct ext2_cached_block *cb = block_cache_alloc(fs, num);
+
+	if (cb != NULL) {
+		memcpy(cb->data, data, fs->block_size);
+	}
+}
+
+/* Returns 0 when the block was stored in the cache and has to be written back later. */
+static int block_cache_write(struct ext2_data *fs, uint32_t num, const uint8_t *data)
+{
+	struct ext2_cached_block *cb = block_cache_find(num);
+
+	if (cb == NULL) {
+		cb = block_cache_alloc(fs, num);
+		if (cb == NULL) {
+			return -ENOMEM;
+		}
+	}
+	memcpy(cb->data, data, fs->block_size);
+	cb->dirty = true;
+	return 0;
+}
+
+static int block_cache_flush(struct ext2_data *fs)
+{
+	int ret = 0;
+
+	for (int i = 0; i < CONFIG_EXT2_BLOCK_CACHE_SIZE; ++i) {
+		int rc = block_cache_writeback(fs, &block_cache[i]);
+
+		if (rc < 0 && ret == 0) {
+			ret = rc;
+		}
+	}
+	return ret;
+}
+
+#else
+
+static inline void block_cache_reset(void)
+{
+}
+
+static inline bool block_cache_read(struct ext2_data *fs, uint32_t num, uint8_t *data)
+{
+	return false;
+}
+
+static inline void block_cache_fill(struct ext2_data *fs, uint32_t num, const uint8_t *data)
+{
+}
+
+static inline int block_cache_write(struct ext2_data *fs, uint32_t num, const uint8_t *data)
+{
+	return -ENOTSUP;
+}
+
+static inline int block_cache_flush(struct ext2_data *fs)
+{
+	return 0;
+}
+
+#endif /* CONFIG_EXT2_BLOCK_CACHE_SIZE > 0 */
+
 static struct ext2_block *get_block_struct(void)
 {
 	int ret;
@@ -96,12 +246,17 @@ struct ext2_block *ext2_get_block(struct ext2_data *fs, uint32_t block)
 	}
 	b->num = block;
 	b->flags = EXT2_BLOCK_ASSIGNED;
+	if (block_cache_read(fs, block, b->data)) {
+		return b;
+	}
+
 	ret = fs->backend_ops->read_block(fs, b->data, block);
 	if (ret < 0) {
 		LOG_ERR("get block: read block error %d", ret);
 		ext2_drop_block(b);
 		return NULL;
 	}
+	block_cache_fill(fs, block, b->data);
 	return b;
 }
 
@@ -126,6 +281,10 @@ int ext2_write_block(struct ext2_data *fs, struct ext2_block *b)
 		return -EINVAL;
 	}
 
+	if (block_cache_write(fs, b->num, b->data) == 0) {
+		return 0;
+	}
+
 	ret = fs->backend_ops->write_block(fs, b->data, b->num);
 	if (ret < 0) {
 		return ret;
@@ -157,6 +316,20 @@ void ext2_init_blocks_slab(struct ext2_data *fs)
 
 	k_mem_slab_init(&ext2_block_memory_slab, __ext2_block_memory_buffer, fs->block_size,
 			CONFIG_EXT2_MAX_BLOCK_COUNT);
+
+	block_cache_reset();
+	ext2_inode_cache_reset();
+}
+
+int ext2_sync(struct ext2_data *fs)
+{
+	int ret;
+
+	ret = block_cache_flush(fs);
+	if (ret < 0) {
+		return ret;
+	}
+	return fs->backend_ops->sync(fs);
 }
 
 int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
@@ -384,7 +557,7 @@ int ext2_close_fs(struct ext2_data *fs)
 	ext2_drop_block(fs->bgroup.inode_bitmap);
 	ext2_drop_block(fs->bgroup.block_bitmap);
 
-	if (fs->backend_ops->sync(fs) < 0) {
+	if (ext2_sync(fs) < 0) {
 		return -EIO;
 	}
 	return 0;
@@ -392,6 +565,13 @@ int ext2_close_fs(struct ext2_data *fs)
 
 int ext2_close_struct(struct ext2_data *fs)
 {
+	/* Blocks written on a failed mount or format still reach the storage. */
+	if (fs != NULL) {
+		(void)block_cache_flush(fs);
+		block_cache_reset();
+		ext2_inode_cache_reset();
+	}
+
 	memset(fs, 0, sizeof(struct ext2_data));
 	initialized = false;
 	return 0;
@@ -790,7 +970,7 @@ int ext2_inode_sync(struct ext2_inode *inode)
 		if (ret < 0) {
 			return ret;
 		}
-		ret = fs->backend_ops->sync(fs);
+		ret = ext2_sync(fs);
 		if (ret < 0) {
 			return ret;
 		}
@@ -45,6 +45,11 @@ int ext2_write_block(struct ext2_data *fs, struct ext2_block *b);
 
 void ext2_init_blocks_slab(struct ext2_data *fs);
 
+/**
+ * @brief Write back cached blocks and sync the storage device.
+ */
+int ext2_sync(struct ext2_data *fs);
+
 /**
  * @brief Write block to the disk.
  *
@@ -0,0 +1,101 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/work.h>
+
+/* Runs on a work queue thread, which processes one submission of the device at a time */
+static void fs_rtio_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct fs_rtio_data *data = iodev_sqe->sqe.iodev->data;
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+	ssize_t rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		/* Reads into the memory pool of the context fill one block */
+		rc = rtio_sqe_rx_buf(iodev_sqe, 1, MAX(sqe->rx.buf_len, 1), &buf, &buf_len);
+		if (rc == 0) {
+			rc = fs_read(data->zfp, buf, buf_len);
+		}
+		break;
+	case RTIO_OP_TX:
+		rc = fs_write(data->zfp, sqe->tx.buf, sqe->tx.buf_len);
+		break;
+	case RTIO_OP_TINY_TX:
+		rc = fs_write(data->zfp, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len);
+		break;
+	default:
+		rc = fs_sync(data->zfp);
+		break;
+	}
+
+	atomic_dec(&data->pending);
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, (int)rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, (int)rc);
+	}
+}
+
+static void fs_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct fs_rtio_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_work_req *req;
+
+	if (FIELD_GET(RTIO_SQE_TRANSACTION, iodev_sqe->sqe.flags) == 1) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_NOP:
+	case RTIO_OP_RX:
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+		break;
+	default:
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	if (data->zfp == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBADF);
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	atomic_inc(&data->pending);
+	rtio_work_req_submit(req, iodev_sqe, fs_rtio_submit_sync);
+}
+
+const struct rtio_iodev_api fs_rtio_iodev_api = {
+	.submit = fs_rtio_submit,
+};
+
+int fs_rtio_iodev_set_file(const struct rtio_iodev *iodev, struct fs_file_t *zfp)
+{
+	struct fs_rtio_data *data = iodev->data;
+
+	if (atomic_get(&data->pending) != 0) {
+		return -EBUSY;
+	}
+
+	data->zfp = zfp;
+
+	return 0;
+}
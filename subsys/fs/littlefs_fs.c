@@ -62,9 +62,17 @@ K_MEM_SLAB_DEFINE_STATIC(lfs_dir_pool, sizeof(struct lfs_dir),
 BUILD_ASSERT((CONFIG_FS_LITTLEFS_HEAP_PER_ALLOC_OVERHEAD_SIZE % 8) == 0);
 /* Auto-generate heap size from cache size and number of files */
 #undef CONFIG_FS_LITTLEFS_FC_HEAP_SIZE
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+/* Room for the buffer of one mounted file system */
+#define FC_HEAP_READ_AHEAD_SIZE							\
+	(CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE + CONFIG_FS_LITTLEFS_READ_AHEAD_ALIGN +	\
+	FC_HEAP_PER_ALLOC_OVERHEAD)
+#else
+#define FC_HEAP_READ_AHEAD_SIZE 0
+#endif /* CONFIG_FS_LITTLEFS_READ_AHEAD */
 #define CONFIG_FS_LITTLEFS_FC_HEAP_SIZE						\
 	((CONFIG_FS_LITTLEFS_CACHE_SIZE + FC_HEAP_PER_ALLOC_OVERHEAD) *		\
-	CONFIG_FS_LITTLEFS_NUM_FILES)
+	CONFIG_FS_LITTLEFS_NUM_FILES + FC_HEAP_READ_AHEAD_SIZE)
 #endif /* CONFIG_FS_LITTLEFS_FC_HEAP_SIZE */
 
 static K_HEAP_DEFINE(file_cache_heap, CONFIG_FS_LITTLEFS_FC_HEAP_SIZE);
@@ -171,13 +179,92 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_FS_LITTLEFS_READ_AHEAD_ALIGN));
+
+static void read_ahead_start(struct fs_littlefs *fs)
+{
+	fs->ra_buffer = k_heap_aligned_alloc(&file_cache_heap,
+					     CONFIG_FS_LITTLEFS_READ_AHEAD_ALIGN,
+					     CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE, K_NO_WAIT);
+	if (fs->ra_buffer == NULL) {
+		LOG_WRN("no memory for read-ahead buffer");
+	}
+
+	fs->ra_len = 0;
+	fs->ra_next = 0;
+}
+
+static void read_ahead_stop(struct fs_littlefs *fs)
+{
+	if (fs->ra_buffer != NULL) {
+		fc_release(fs->ra_buffer);
+		fs->ra_buffer = NULL;
+	}
+
+	fs->ra_len = 0;
+}
+
+/* Drop the read-ahead data if it overlaps a modified range */
+static void read_ahead_invalidate(struct fs_littlefs *fs, size_t offset, size_t size)
+{
+	if ((offset < fs->ra_off + fs->ra_len) && (fs->ra_off < offset + size)) {
+		fs->ra_len = 0;
+	}
+}
+
+static int read_ahead_read(struct fs_littlefs *fs, const struct flash_area *fa,
+			   size_t offset, void *buffer, size_t size)
+{
+	bool sequential = (offset == fs->ra_next) || (offset == fs->ra_off + fs->ra_len);
+	size_t len;
+	int rc;
+
+	fs->ra_next = offset + size;
+
+	if (fs->ra_buffer == NULL) {
+		return flash_area_read(fa, offset, buffer, size);
+	}
+
+	if ((offset >= fs->ra_off) && (offset + size <= fs->ra_off + fs->ra_len)) {
+		memcpy(buffer, fs->ra_buffer + (offset - fs->ra_off), size);
+		return 0;
+	}
+
+	if (!sequential || (size >= CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE)) {
+		return flash_area_read(fa, offset, buffer, size);
+	}
+
+	/* Read the following data as well, up to the end of the partition */
+	len = MIN(CONFIG_FS_LITTLEFS_READ_AHEAD_SIZE, fa->fa_size - offset);
+
+	fs->ra_len = 0;
+	rc = flash_area_read(fa, offset, fs->ra_buffer, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	fs->ra_off = offset;
+	fs->ra_len = len;
+	memcpy(buffer, fs->ra_buffer, size);
+
+	return 0;
+}
+#endif /* CONFIG_FS_LITTLEFS_READ_AHEAD */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	int rc = read_ahead_read(fs, fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -188,6 +275,10 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	read_ahead_invalidate(CONTAINER_OF(c, struct fs_littlefs, cfg), offset, size);
+#endif
+
 	int rc = flash_area_write(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -198,6 +289,10 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	read_ahead_invalidate(CONTAINER_OF(c, struct fs_littlefs, cfg), offset, c->block_size);
+#endif
+
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
@@ -954,6 +1049,12 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 		goto out;
 	}
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	if (!littlefs_on_blkdev(mountp->flags)) {
+		read_ahead_start(fs);
+	}
+#endif
+
 	/* Mount it, formatting if needed. */
 	ret = lfs_mount(&fs->lfs, &fs->cfg);
 	if (ret < 0 &&
@@ -987,6 +1088,9 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 
 out:
 	if (ret < 0) {
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+		read_ahead_stop(fs);
+#endif
 		fs->backend = NULL;
 	}
 
@@ -1047,6 +1151,10 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
+#ifdef CONFIG_FS_LITTLEFS_READ_AHEAD
+	read_ahead_stop(fs);
+#endif
+
 	fs->backend = NULL;
 	fs_unlock(fs);
 
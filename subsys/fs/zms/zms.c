@@ -625,10 +625,14 @@ static int zms_recover_last_ate(struct zms_fs *fs, uint64_t *addr, uint64_t *dat
 			return rc;
 		}
 		if (zms_ate_valid(fs, &end_ate)) {
-			/* found a valid ate, update data_end_addr and *addr */
-			data_end_addr &= ADDR_SECT_MASK;
+			/* found a valid ate, update data_end_addr and *addr.
+			 * ATEs are never below the data of an older ATE, the data of a batch
+			 * holding copies of ATEs is not searched.
+			 */
 			if (end_ate.len > ZMS_DATA_IN_ATE_SIZE) {
-				data_end_addr += end_ate.offset + zms_al_size(fs, end_ate.len);
+				data_end_addr = MAX(data_end_addr, (*addr & ADDR_SECT_MASK) +
+									   end_ate.offset +
+									   zms_al_size(fs, end_ate.len));
 				*data_wra = data_end_addr;
 			}
 			*addr = ate_end_addr;
@@ -964,6 +968,367 @@ static int zms_find_ate_with_id(struct zms_fs *fs, zms_id_t id, uint64_t start_a
 	return prev_found;
 }
 
+#if defined(CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT) || defined(CONFIG_ZMS_BATCH)
+/* Tells whether an ATE with id ZMS_HEAD_ID has metadata stored as data, which excludes
+ * the ATEs of the sector header and the gc done ATE
+ */
+static inline bool zms_meta_ate(const struct zms_ate *entry)
+{
+	return (entry->id == ZMS_HEAD_ID) && (entry->len > ZMS_DATA_IN_ATE_SIZE) &&
+	       (entry->len != 0xffff);
+}
+
+/* Reads the metadata header of the ATE at address addr */
+static inline int zms_meta_hdr_rd(struct zms_fs *fs, uint64_t addr, const struct zms_ate *entry,
+				  struct zms_meta_hdr *hdr)
+{
+	return zms_flash_rd(fs, (addr & ADDR_SECT_MASK) + entry->offset, hdr, sizeof(*hdr));
+}
+#endif
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS
+#define ZMS_META_LOOKUP_CACHE ZMS_META_LOOKUP_CACHE_SETTINGS
+#else
+#define ZMS_META_LOOKUP_CACHE ZMS_META_LOOKUP_CACHE_ID
+#endif
+
+BUILD_ASSERT(ZMS_BLOCK_SIZE + CONFIG_ZMS_LOOKUP_CACHE_SIZE * sizeof(uint64_t) < UINT16_MAX,
+	     "ZMS lookup cache too large for its snapshot");
+
+/* Stores a snapshot of the lookup cache in the write sector. It is written
+ * right after the garbage collection, before any other ATE of the sector.
+ * The snapshot is skipped if it doesn't fit, in which case the next mount
+ * rebuilds the cache from all the ATEs.
+ */
+static int zms_lookup_cache_save(struct zms_fs *fs)
+{
+	int rc;
+	size_t len;
+	struct zms_ate entry;
+	struct zms_meta_hdr snapshot = {
+		.crc = crc32_ieee((const uint8_t *)fs->lookup_cache, sizeof(fs->lookup_cache)),
+		.count = CONFIG_ZMS_LOOKUP_CACHE_SIZE,
+		.cycle_cnt = fs->sector_cycle,
+		.type = ZMS_META_LOOKUP_CACHE,
+	};
+
+	len = zms_al_size(fs, sizeof(snapshot)) + sizeof(fs->lookup_cache);
+
+	/* Same conditions as zms_write(), leaving space for a delete ATE */
+	if (!SECTOR_OFFSET(fs->ate_wra) ||
+	    (fs->ate_wra < (fs->data_wra + zms_al_size(fs, len) + fs->ate_size)) ||
+	    !SECTOR_OFFSET(fs->ate_wra - fs->ate_size)) {
+		LOG_DBG("No space for the lookup cache snapshot");
+		return 0;
+	}
+
+	/* Initialize all members to 0 */
+	memset(&entry, 0, sizeof(struct zms_ate));
+
+	entry.id = ZMS_HEAD_ID;
+	entry.len = (uint16_t)len;
+	entry.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+	entry.cycle_cnt = fs->sector_cycle;
+	zms_ate_crc8_update(&entry);
+
+	rc = zms_flash_data_wrt(fs, &snapshot, sizeof(snapshot));
+	if (rc) {
+		return rc;
+	}
+
+	rc = zms_flash_data_wrt(fs, fs->lookup_cache, sizeof(fs->lookup_cache));
+	if (rc) {
+		return rc;
+	}
+
+	return zms_flash_ate_wrt(fs, &entry);
+}
+
+/* Restores the lookup cache from the snapshot of the write sector, replaying
+ * only the ATEs written after it. Falls back to a full rebuild if the write
+ * sector doesn't hold a valid snapshot.
+ */
+static int zms_lookup_cache_restore(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+	uint64_t *cache_entry;
+	uint64_t entries[ZMS_BLOCK_SIZE / sizeof(uint64_t)];
+	uint32_t crc = 0;
+	uint8_t cycle_cnt;
+	bool found = false;
+	struct zms_ate ate;
+	struct zms_meta_hdr snapshot;
+
+	rc = zms_get_sector_cycle(fs, fs->ate_wra, &cycle_cnt);
+	if (rc == -ENOENT) {
+		return zms_lookup_cache_rebuild(fs);
+	} else if (rc) {
+		return rc;
+	}
+
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+
+	/* Walk the ATEs of the write sector, from the newest to the snapshot */
+	for (addr = fs->ate_wra + fs->ate_size;
+	     SECTOR_OFFSET(addr) < (fs->sector_size - 2 * fs->ate_size); addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (!zms_ate_valid_different_sector(fs, &ate, cycle_cnt)) {
+			continue;
+		}
+
+		if (zms_meta_ate(&ate)) {
+			rc = zms_meta_hdr_rd(fs, addr, &ate, &snapshot);
+			if (rc) {
+				return rc;
+			}
+			/* The ATEs of a batch are replayed as any other ATE */
+			if (snapshot.type != ZMS_META_BATCH) {
+				found = true;
+				break;
+			}
+			continue;
+		}
+
+		if (ate.id == ZMS_HEAD_ID) {
+			continue;
+		}
+
+		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
+		if (*cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			*cache_entry = addr;
+		}
+	}
+
+	if (!found) {
+		LOG_DBG("No lookup cache snapshot, rebuilding the cache");
+		return zms_lookup_cache_rebuild(fs);
+	}
+
+	addr &= ADDR_SECT_MASK;
+	addr += ate.offset;
+
+	if ((ate.len != zms_al_size(fs, sizeof(snapshot)) + sizeof(fs->lookup_cache)) ||
+	    (snapshot.count != CONFIG_ZMS_LOOKUP_CACHE_SIZE) || (snapshot.cycle_cnt != cycle_cnt) ||
+	    (snapshot.type != ZMS_META_LOOKUP_CACHE)) {
+		LOG_WRN("Incompatible lookup cache snapshot, rebuilding the cache");
+		return zms_lookup_cache_rebuild(fs);
+	}
+
+	/* Entries not updated after the snapshot come from the snapshot */
+	addr += zms_al_size(fs, sizeof(snapshot));
+	for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i += ARRAY_SIZE(entries)) {
+		size_t num = MIN(ARRAY_SIZE(entries), CONFIG_ZMS_LOOKUP_CACHE_SIZE - i);
+
+		rc = zms_flash_rd(fs, addr + i * sizeof(uint64_t), entries,
+				  num * sizeof(uint64_t));
+		if (rc) {
+			return rc;
+		}
+
+		crc = crc32_ieee_update(crc, (const uint8_t *)entries, num * sizeof(uint64_t));
+
+		for (size_t j = 0; j < num; j++) {
+			cache_entry = &fs->lookup_cache[i + j];
+			if (*cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+				*cache_entry = entries[j];
+			}
+		}
+	}
+
+	if (crc != snapshot.crc) {
+		LOG_WRN("Corrupted lookup cache snapshot, rebuilding the cache");
+		return zms_lookup_cache_rebuild(fs);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT */
+
+#ifdef CONFIG_ZMS_BATCH
+/* Size of the header of a batch stored at data offset offset. It is padded for the copy of
+ * the ATEs following it to be aligned on the ATE size, no ATE read in the copy straddles two
+ * of them.
+ */
+static inline size_t zms_batch_hdr_size(struct zms_fs *fs, uint32_t offset)
+{
+	return ROUND_UP(offset + sizeof(struct zms_meta_hdr), fs->ate_size) - offset;
+}
+
+/* Largest size of the header of a batch */
+static inline size_t zms_batch_hdr_max(struct zms_fs *fs)
+{
+	return fs->ate_size + sizeof(struct zms_meta_hdr);
+}
+
+/* Reads the copy of the ATE at position pos of the batch metadata, stored complemented */
+static int zms_batch_table_rd(struct zms_fs *fs, uint64_t table_addr, uint16_t pos,
+			      struct zms_ate *entry)
+{
+	uint8_t *entry8 = (uint8_t *)entry;
+	int rc;
+
+	rc = zms_flash_rd(fs, table_addr + pos * fs->ate_size, entry, sizeof(*entry));
+
+	for (size_t i = 0; i < sizeof(*entry); i++) {
+		entry8[i] ^= 0xff;
+	}
+
+	return rc;
+}
+
+/* Completes the batch committed by the ATE at address commit_addr, of which only part of
+ * the ATEs are stored after the commit ATE. The batch ATEs following the first missing
+ * one are written again, in order, from the copy of the ATEs saved with the commit.
+ */
+static int zms_batch_replay(struct zms_fs *fs, uint64_t commit_addr,
+			    const struct zms_ate *commit, const struct zms_meta_hdr *hdr)
+{
+	int rc;
+	uint64_t table_addr;
+	uint64_t addr;
+	uint64_t end_addr;
+	uint32_t crc = 0;
+	uint16_t first;
+	uint16_t i;
+	struct zms_ate entry;
+	struct zms_ate stored;
+
+	table_addr = (commit_addr & ADDR_SECT_MASK) + commit->offset +
+		     zms_batch_hdr_size(fs, commit->offset);
+
+	for (i = 0; i < hdr->count; i++) {
+		rc = zms_batch_table_rd(fs, table_addr, i, &entry);
+		if (rc) {
+			return rc;
+		}
+		crc = crc32_ieee_update(crc, (const uint8_t *)&entry, sizeof(entry));
+	}
+
+	if (crc != hdr->crc) {
+		LOG_ERR("Corrupted batch at %llx, not replayed", commit_addr);
+		return 0;
+	}
+
+	/* The ATE of entry i of the batch is stored i + 1 positions after the commit ATE,
+	 * and at table position count - 1 - i.
+	 */
+	end_addr = commit_addr - hdr->count * fs->ate_size;
+	for (first = 0; first < hdr->count; first++) {
+		addr = commit_addr - (first + 1) * fs->ate_size;
+		if (addr <= fs->ate_wra) {
+			break;
+		}
+
+		rc = zms_flash_ate_rd(fs, addr, &stored);
+		if (rc) {
+			return rc;
+		}
+
+		rc = zms_batch_table_rd(fs, table_addr, hdr->count - 1 - first, &entry);
+		if (rc) {
+			return rc;
+		}
+
+		if (memcmp(&stored, &entry, sizeof(entry))) {
+			break;
+		}
+	}
+
+	if (first == hdr->count) {
+		return 0;
+	}
+
+	/* Skip the entries written again by an earlier interrupted replay */
+	i = first;
+	for (addr = end_addr - fs->ate_size; (addr > fs->ate_wra) && (i < hdr->count);
+	     addr -= fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &stored);
+		if (rc) {
+			return rc;
+		}
+
+		rc = zms_batch_table_rd(fs, table_addr, hdr->count - 1 - i, &entry);
+		if (rc) {
+			return rc;
+		}
+
+		if (!memcmp(&stored, &entry, sizeof(entry))) {
+			i++;
+		}
+	}
+
+	LOG_INF("Replaying %u ATEs of an interrupted batch", hdr->count - i);
+
+	for (; i < hdr->count; i++) {
+		if ((fs->ate_wra < fs->data_wra + fs->ate_size) ||
+		    !SECTOR_OFFSET(fs->ate_wra - fs->ate_size)) {
+			return -ENOSPC;
+		}
+
+		rc = zms_batch_table_rd(fs, table_addr, hdr->count - 1 - i, &entry);
+		if (rc) {
+			return rc;
+		}
+
+		rc = zms_flash_ate_wrt(fs, &entry);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Looks for the last batch committed in the write sector and completes it if it was
+ * interrupted. Only a batch written after all the other metadata of the sector can be
+ * incomplete.
+ */
+static int zms_batch_recover(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+	struct zms_ate ate;
+	struct zms_meta_hdr hdr;
+
+	for (addr = fs->ate_wra + fs->ate_size;
+	     SECTOR_OFFSET(addr) < (fs->sector_size - 2 * fs->ate_size); addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (!zms_ate_valid(fs, &ate) || (ate.id != ZMS_HEAD_ID)) {
+			continue;
+		}
+
+		if (!zms_meta_ate(&ate)) {
+			return 0;
+		}
+
+		rc = zms_meta_hdr_rd(fs, addr, &ate, &hdr);
+		if (rc) {
+			return rc;
+		}
+
+		if ((hdr.type != ZMS_META_BATCH) || (hdr.cycle_cnt != fs->sector_cycle)) {
+			return 0;
+		}
+
+		return zms_batch_replay(fs, addr, &ate, &hdr);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ZMS_BATCH */
+
 /* garbage collection: the address ate_wra has been updated to the new sector
  * that has just been started. The data to gc is in the sector after this new
  * sector.
@@ -1043,7 +1408,8 @@ static int zms_gc(struct zms_fs *fs)
 			return rc;
 		}
 
-		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len) {
+		/* Lookup cache snapshots are not moved, a new one is written after the gc */
+		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len || (gc_ate.id == ZMS_HEAD_ID)) {
 			continue;
 		}
 
@@ -1361,6 +1727,25 @@ static int zms_init(struct zms_fs *fs)
 		fs->ate_wra -= fs->ate_size;
 	}
 
+#ifdef CONFIG_ZMS_BATCH
+	/* The data of a batch may be written without the ATE committing it, move the data
+	 * write address after it on devices that need an erase.
+	 */
+	while (ebw_required && (fs->ate_wra > fs->data_wra)) {
+		rc = zms_flash_cmp_const(fs, fs->data_wra, fs->flash_parameters->erase_value,
+					 fs->ate_wra - fs->data_wra);
+		if (rc < 0) {
+			goto end;
+		}
+		if (!rc) {
+			break;
+		}
+
+		fs->data_wra += fs->flash_parameters->write_block_size;
+		rc = 0;
+	}
+#endif
+
 	/* The sector after the write sector is either empty with a valid empty ATE (regular case)
 	 * or it has never been used or it is a closed sector (GC didn't finish)
 	 * If it is a closed sector we must look for a valid GC done ATE in the current write
@@ -1443,7 +1828,16 @@ static int zms_init(struct zms_fs *fs)
 	}
 
 end:
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_BATCH
+	if (!rc) {
+		rc = zms_batch_recover(fs);
+	}
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+	if (!rc) {
+		rc = zms_lookup_cache_restore(fs);
+	}
+#elif defined(CONFIG_ZMS_LOOKUP_CACHE)
 	if (!rc) {
 		rc = zms_lookup_cache_rebuild(fs);
 	}
@@ -1677,6 +2071,18 @@ no_cached_entry:
 			LOG_ERR("Garbage collection failed, returned = %d", rc);
 			goto end;
 		}
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+		/* Further gc runs mean the storage is nearly full, they reclaim
+		 * the space of the snapshots instead of writing new ones.
+		 */
+		if (gc_count == 0) {
+			rc = zms_lookup_cache_save(fs);
+			if (rc) {
+				LOG_ERR("Failed to save the lookup cache, returned = %d", rc);
+				goto end;
+			}
+		}
+#endif
 		gc_count++;
 	}
 	rc = len;
@@ -1690,6 +2096,273 @@ int zms_delete(struct zms_fs *fs, zms_id_t id)
 	return zms_write(fs, id, NULL, 0);
 }
 
+#ifdef CONFIG_ZMS_BATCH
+/* Space needed in a sector to commit count entries with data_len bytes of data, besides the
+ * position of the commit ATE: the data, the metadata holding a copy of the ATEs, the ATEs,
+ * the positions reserved to replay them and a delete ATE.
+ */
+static inline size_t zms_batch_required_space(struct zms_fs *fs, size_t data_len, size_t count)
+{
+	return data_len + zms_batch_hdr_max(fs) + (3 * count + 1) * fs->ate_size;
+}
+
+int zms_batch_begin(struct zms_fs *fs, struct zms_batch *batch, void *buf, size_t size)
+{
+	if (!fs || !batch || !buf) {
+		LOG_ERR("Invalid batch");
+		return -EINVAL;
+	}
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	batch->fs = fs;
+	batch->buf = buf;
+	batch->size = size;
+	batch->data_len = 0;
+	batch->count = 0;
+
+	return 0;
+}
+
+ssize_t zms_batch_write(struct zms_batch *batch, zms_id_t id, const void *data, size_t len)
+{
+	struct zms_fs *fs;
+	struct zms_ate entry;
+	size_t data_size = 0;
+	size_t used;
+
+	if (!batch || !batch->fs) {
+		LOG_ERR("Invalid batch");
+		return -EINVAL;
+	}
+
+	fs = batch->fs;
+
+	/* Same limits as zms_write(), ZMS_HEAD_ID is reserved for the metadata */
+	if ((len > (fs->sector_size - 5 * fs->ate_size)) || (len > UINT16_MAX) ||
+	    ((len > 0) && (data == NULL)) || (id == ZMS_HEAD_ID)) {
+		return -EINVAL;
+	}
+
+	if (len > ZMS_DATA_IN_ATE_SIZE) {
+		data_size = zms_al_size(fs, len);
+	}
+
+	if ((batch->count == UINT16_MAX) ||
+	    (zms_batch_hdr_max(fs) + (batch->count + 1) * fs->ate_size + batch->data_len +
+	     data_size > UINT16_MAX) ||
+	    (zms_batch_required_space(fs, batch->data_len + data_size, batch->count + 1) >
+	     fs->sector_size - 4 * fs->ate_size)) {
+		return -ENOSPC;
+	}
+
+	used = zms_batch_hdr_max(fs) + batch->data_len + data_size +
+	       (batch->count + 1) * fs->ate_size;
+	if (used > batch->size) {
+		return -ENOMEM;
+	}
+
+	/* Initialize all members to 0 */
+	memset(&entry, 0, sizeof(struct zms_ate));
+
+	entry.id = id;
+	entry.len = (uint16_t)len;
+
+	if (len > ZMS_DATA_IN_ATE_SIZE) {
+#ifdef CONFIG_ZMS_DATA_CRC
+		entry.data_crc = crc32_ieee(data, len);
+#endif
+		/* Relative to the data of the batch until it is committed */
+		entry.offset = (uint32_t)batch->data_len;
+		memcpy(batch->buf + batch->data_len, data, len);
+		(void)memset(batch->buf + batch->data_len + len,
+			     fs->flash_parameters->erase_value, data_size - len);
+		batch->data_len += data_size;
+	} else if (len > 0) {
+		memcpy(&entry.data, data, len);
+	}
+
+	/* The ATEs are stored from the end of the buffer, as in a sector */
+	batch->count++;
+	memcpy(batch->buf + batch->size - batch->count * fs->ate_size, &entry, sizeof(entry));
+	(void)memset(batch->buf + batch->size - batch->count * fs->ate_size + sizeof(entry),
+		     fs->flash_parameters->erase_value, fs->ate_size - sizeof(entry));
+
+	return len;
+}
+
+/* Complements count ATEs stored in buf */
+static void zms_batch_table_invert(struct zms_fs *fs, uint8_t *buf, uint16_t count)
+{
+	for (size_t i = 0; i < count * fs->ate_size; i++) {
+		buf[i] ^= 0xff;
+	}
+}
+
+/* Writes the batch in the write sector that has enough space for it. The metadata holding
+ * a copy of the ATEs and the data of the entries are written first, followed by the ATE
+ * committing the batch, and then by all the ATEs at once. The batch is replayed from the
+ * copy at mount if the last write is interrupted.
+ * The data of the commit ATE spans the metadata and the data of the entries, so that the
+ * data write address is found from it at mount whatever ATEs of the batch are stored.
+ */
+static int zms_batch_store(struct zms_batch *batch)
+{
+	struct zms_fs *fs = batch->fs;
+	struct zms_meta_hdr hdr;
+	struct zms_ate entry;
+	struct zms_ate commit;
+	size_t hdr_size = zms_batch_hdr_size(fs, (uint32_t)SECTOR_OFFSET(fs->data_wra));
+	size_t table_size = batch->count * fs->ate_size;
+	uint8_t *table = batch->buf + batch->size - table_size;
+	uint32_t data_offset;
+	uint64_t ate_addr;
+	int rc;
+
+	data_offset = (uint32_t)(SECTOR_OFFSET(fs->data_wra) + hdr_size + table_size);
+
+	hdr.crc = 0;
+	for (uint16_t i = 0; i < batch->count; i++) {
+		memcpy(&entry, table + i * fs->ate_size, sizeof(entry));
+		if (entry.len > ZMS_DATA_IN_ATE_SIZE) {
+			entry.offset += data_offset;
+		}
+		entry.cycle_cnt = fs->sector_cycle;
+		zms_ate_crc8_update(&entry);
+		memcpy(table + i * fs->ate_size, &entry, sizeof(entry));
+
+		hdr.crc = crc32_ieee_update(hdr.crc, (const uint8_t *)&entry, sizeof(entry));
+	}
+	hdr.count = batch->count;
+	hdr.cycle_cnt = fs->sector_cycle;
+	hdr.type = ZMS_META_BATCH;
+
+	/* The copy is stored complemented, its ATEs are never taken for valid ones as their
+	 * cycle counter differs from the one of the sector.
+	 */
+	zms_batch_table_invert(fs, table, batch->count);
+
+	/* The header is stored right before the ATEs */
+	memcpy(table - hdr_size, &hdr, sizeof(hdr));
+	(void)memset(table - hdr_size + sizeof(hdr), fs->flash_parameters->erase_value,
+		     hdr_size - sizeof(hdr));
+
+	/* Initialize all members to 0 */
+	memset(&commit, 0, sizeof(struct zms_ate));
+
+	commit.id = ZMS_HEAD_ID;
+	commit.len = (uint16_t)(hdr_size + table_size + batch->data_len);
+	commit.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+	commit.cycle_cnt = fs->sector_cycle;
+	zms_ate_crc8_update(&commit);
+
+	rc = zms_flash_data_wrt(fs, table - hdr_size, hdr_size + table_size);
+	if (rc) {
+		return rc;
+	}
+
+	rc = zms_flash_data_wrt(fs, batch->buf, batch->data_len);
+	if (rc) {
+		return rc;
+	}
+
+	zms_batch_table_invert(fs, table, batch->count);
+
+	rc = zms_flash_ate_wrt(fs, &commit);
+	if (rc) {
+		return rc;
+	}
+
+	/* The first entry of the batch is the one at the highest address */
+	ate_addr = fs->ate_wra - table_size + fs->ate_size;
+	rc = zms_flash_al_wrt(fs, ate_addr, table, table_size);
+	if (rc) {
+		return rc;
+	}
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	for (uint16_t i = 0; i < batch->count; i++) {
+		memcpy(&entry, table + (batch->count - 1 - i) * fs->ate_size, sizeof(entry));
+		fs->lookup_cache[zms_lookup_cache_pos(entry.id)] = fs->ate_wra - i * fs->ate_size;
+	}
+#endif
+	fs->ate_wra -= table_size;
+
+	return 0;
+}
+
+int zms_batch_commit(struct zms_batch *batch)
+{
+	int rc;
+	uint32_t gc_count;
+	struct zms_fs *fs;
+	size_t required_space;
+
+	if (!batch || !batch->fs) {
+		LOG_ERR("Invalid batch");
+		return -EINVAL;
+	}
+
+	fs = batch->fs;
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	if (!batch->count) {
+		return 0;
+	}
+
+	required_space = zms_batch_required_space(fs, batch->data_len, batch->count);
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	gc_count = 0;
+	while (1) {
+		if (gc_count == fs->sector_count) {
+			rc = -ENOSPC;
+			goto end;
+		}
+
+		/* Same conditions as zms_write() for the lowest position the batch may use */
+		if ((SECTOR_OFFSET(fs->ate_wra)) &&
+		    (fs->ate_wra >= (fs->data_wra + required_space))) {
+			rc = zms_batch_store(batch);
+			batch->data_len = 0;
+			batch->count = 0;
+			break;
+		}
+		rc = zms_sector_close(fs);
+		if (rc) {
+			LOG_ERR("Failed to close the sector, returned = %d", rc);
+			goto end;
+		}
+		rc = zms_gc(fs);
+		if (rc) {
+			LOG_ERR("Garbage collection failed, returned = %d", rc);
+			goto end;
+		}
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+		if (gc_count == 0) {
+			rc = zms_lookup_cache_save(fs);
+			if (rc) {
+				LOG_ERR("Failed to save the lookup cache, returned = %d", rc);
+				goto end;
+			}
+		}
+#endif
+		gc_count++;
+	}
+end:
+	k_mutex_unlock(&fs->zms_lock);
+	return rc;
+}
+#endif /* CONFIG_ZMS_BATCH */
+
 ssize_t zms_read_hist(struct zms_fs *fs, zms_id_t id, void *data, size_t len, uint32_t cnt)
 {
 	int rc;
@@ -1971,6 +2644,11 @@ int zms_sector_use_next(struct zms_fs *fs)
 	}
 
 	ret = zms_gc(fs);
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+	if (ret == 0) {
+		ret = zms_lookup_cache_save(fs);
+	}
+#endif
 
 end:
 	k_mutex_unlock(&fs->zms_lock);
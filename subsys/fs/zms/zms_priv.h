@@ -108,4 +108,24 @@ struct zms_ate {
 
 #define ZMS_DATA_IN_ATE_SIZE SIZEOF_FIELD(struct zms_ate, data)
 
+/**
+ * @ingroup zms_data_structures
+ * ZMS metadata header, stored ahead of the content in the data of an ATE with id
+ * ZMS_HEAD_ID, such as a lookup cache snapshot or the ATEs of a batch
+ */
+struct zms_meta_hdr {
+	/** crc32 of the content */
+	uint32_t crc;
+	/** number of items in the content */
+	uint16_t count;
+	/** cycle counter of the sector holding the content */
+	uint8_t cycle_cnt;
+	/** content type */
+	uint8_t type;
+} __packed;
+
+#define ZMS_META_LOOKUP_CACHE_ID       0
+#define ZMS_META_LOOKUP_CACHE_SETTINGS 1
+#define ZMS_META_BATCH                 2
+
 #endif /* __ZMS_PRIV_H_ */
@@ -8,6 +8,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 
@@ -18,6 +20,110 @@ K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 
 #endif
 
+#ifdef CONFIG_INPUT_FRAME
+
+struct input_frame {
+	const struct device *dev;
+	uint8_t num;
+	struct input_event evts[CONFIG_INPUT_FRAME_MAX_EVENTS];
+};
+
+static struct input_frame input_frames[CONFIG_INPUT_FRAME_DEVICES];
+
+/* events may be reported from several contexts in synchronous mode */
+static struct k_spinlock input_frame_lock;
+
+static struct input_frame *input_frame_get(const struct device *dev)
+{
+	struct input_frame *free_frame = NULL;
+
+	ARRAY_FOR_EACH_PTR(input_frames, frame) {
+		if (frame->num == 0) {
+			if (free_frame == NULL) {
+				free_frame = frame;
+			}
+		} else if (frame->dev == dev) {
+			return frame;
+		}
+	}
+
+	if (free_frame != NULL) {
+		free_frame->dev = dev;
+	}
+
+	return free_frame;
+}
+
+static bool input_frame_coalesce(struct input_frame *frame, const struct input_event *evt)
+{
+	struct input_event *prev;
+
+	if (!IS_ENABLED(CONFIG_INPUT_FRAME_COALESCE) ||
+	    (evt->type != INPUT_EV_ABS && evt->type != INPUT_EV_REL)) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < frame->num; i++) {
+		prev = &frame->evts[i];
+
+		if (prev->type != evt->type || prev->code != evt->code) {
+			continue;
+		}
+
+		if (evt->type == INPUT_EV_ABS) {
+			prev->value = evt->value;
+		} else {
+			prev->value += evt->value;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+static void input_frame_add(const struct input_event *evt)
+{
+	struct input_event evts[CONFIG_INPUT_FRAME_MAX_EVENTS];
+	struct input_frame *frame;
+	k_spinlock_key_t key;
+	size_t num = 0;
+
+	key = k_spin_lock(&input_frame_lock);
+
+	frame = input_frame_get(evt->dev);
+	if (frame == NULL) {
+		/* no frame left, dispatched on its own */
+		evts[0] = *evt;
+		num = 1;
+	} else {
+		if (!input_frame_coalesce(frame, evt)) {
+			frame->evts[frame->num++] = *evt;
+		}
+
+		if (evt->sync || frame->num == CONFIG_INPUT_FRAME_MAX_EVENTS) {
+			num = frame->num;
+			memcpy(evts, frame->evts, num * sizeof(evts[0]));
+			evts[num - 1].sync = evt->sync;
+			frame->num = 0;
+		}
+	}
+
+	k_spin_unlock(&input_frame_lock, key);
+
+	if (num == 0) {
+		return;
+	}
+
+	STRUCT_SECTION_FOREACH(input_frame_callback, callback) {
+		if (callback->dev == NULL || callback->dev == evt->dev) {
+			callback->callback(evts, num, callback->user_data);
+		}
+	}
+}
+
+#endif /* CONFIG_INPUT_FRAME */
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_callback, callback) {
@@ -25,6 +131,10 @@ static void input_process(struct input_event *evt)
 			callback->callback(evt, callback->user_data);
 		}
 	}
+
+#ifdef CONFIG_INPUT_FRAME
+	input_frame_add(evt);
+#endif
 }
 
 bool input_queue_empty(void)
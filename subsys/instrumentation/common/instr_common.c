@@ -53,24 +53,40 @@ static bool _instr_profiling_supported = IS_ENABLED(CONFIG_INSTRUMENTATION_MODE_
  * as they are called in the execution flow, hence "discovered" functions. Once
  * MAX_NUM_DISCO_FUNC is reached, additional new executed functions are ignored and
  * no profiling information is collected for them.
+ *
+ * The array is an open addressing hash table indexed by function address, so
+ * that looking up a function on every entry and exit does not cost a walk over
+ * all the discovered functions. Free slots have a NULL address.
  */
 
 #define MAX_CALL_DEPTH CONFIG_INSTRUMENTATION_MODE_STATISTICAL_MAX_CALL_DEPTH
 struct disco_func_entry {
 	timing_t entry_timestamp;		/* Timestamp at function entry */
-	uint64_t delta_t;			/* Accumulated (per function) delta time */
+	uint64_t delta_t;			/* Accumulated (per function) delta time, in cycles */
 	void *addr;				/* Function address/ID */
+	uint32_t calls;				/* Number of calls */
 	uint16_t call_depth;			/* Call depth */
 };
 
 #define MAX_NUM_DISCO_FUNC CONFIG_INSTRUMENTATION_MODE_STATISTICAL_MAX_NUM_FUNC
-static int num_disco_func;
 struct disco_func_entry disco_func[MAX_NUM_DISCO_FUNC] = { 0 };
 
 /* To track the number of unbalanced/spurious entry/exist pairs, for debugging */
 static int unbalanced;
 #endif
 
+#if CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_SAMPLING_PERIOD > 1
+#define SAMPLING_PERIOD CONFIG_INSTRUMENTATION_MODE_CALLGRAPH_SAMPLING_PERIOD
+
+/* The call being traced in sampling mode, if callee is not NULL */
+static struct {
+	void *callee;		/* Function address of the sampled call */
+	k_tid_t thread;		/* Thread the sampled call was made in */
+	uint16_t depth;		/* Recursion depth of the sampled function */
+	uint16_t countdown;	/* Calls left until the next one is sampled */
+} sampled_call = { .countdown = SAMPLING_PERIOD };
+#endif
+
 #ifdef CONFIG_THREAD_NAME
 #define THREAD_NAME_NONE "thread-none"
 #endif
@@ -314,58 +330,90 @@ void instr_dump_deltas_uart(void)
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
 	static const struct device *const uart_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_console));
+	bool enabled = instr_enabled();
+	uint64_t delta_t;
 
+	/* Profiling is resumed afterwards, so the table can be dumped at any time */
 	instr_disable();
 
 	/* Initiator mark */
 	printk("-*-#");
 
-	for (int i = 0; i < num_disco_func; i++) {
+	for (int i = 0; i < MAX_NUM_DISCO_FUNC; i++) {
+		if (disco_func[i].addr == NULL) {
+			continue;
+		}
+
+		delta_t = timing_cycles_to_ns(disco_func[i].delta_t);
+
 		uart_poll_out(uart_dev, INSTR_EVENT_PROFILE);
 		for (int j = 0; j < sizeof(disco_func[i].addr); j++) {
 			uart_poll_out(uart_dev, *((uint8_t *)&disco_func[i].addr + j));
 		}
-		for (int k = 0; k < sizeof(disco_func[i].delta_t); k++) {
-			uart_poll_out(uart_dev, *((uint8_t *)&disco_func[i].delta_t + k));
+		for (int k = 0; k < sizeof(delta_t); k++) {
+			uart_poll_out(uart_dev, *((uint8_t *)&delta_t + k));
+		}
+		for (int l = 0; l < sizeof(disco_func[i].calls); l++) {
+			uart_poll_out(uart_dev, *((uint8_t *)&disco_func[i].calls + l));
 		}
 	}
 
 	/* Terminator mark */
 	printk("-*-!\n");
+
+	if (enabled) {
+		instr_enable();
+	}
 #endif
 }
 
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
+/*
+ * Find the slot of callee in the discovered function array. Returns the free
+ * slot where it can be added if it is not there yet, or -1 if it is not there
+ * and the array is full.
+ */
 __no_instrumentation__
-void push_callee_timestamp(void *callee)
+static int find_callee(void *callee)
 {
-	bool found = false;
-	int curr_func;
+	/* Fibonacci hashing, function addresses are at least 2 byte aligned */
+	uint32_t hash = (uint32_t)((uintptr_t)callee >> 1) * 2654435769U;
+	int curr_func = hash % MAX_NUM_DISCO_FUNC;
 
-	/* Find callee in the discovered function array */
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			found = 1;
-			break;
+	for (int i = 0; i < MAX_NUM_DISCO_FUNC; i++) {
+		if (disco_func[curr_func].addr == callee || disco_func[curr_func].addr == NULL) {
+			return curr_func;
 		}
+
+		curr_func = (curr_func + 1) % MAX_NUM_DISCO_FUNC;
 	}
 
-	if (!found) { /* New function discovered */
-		if (num_disco_func >= MAX_NUM_DISCO_FUNC) {
-			/* No more space to add another function */
-			return;
-		}
+	return -1;
+}
+
+__no_instrumentation__
+void push_callee_timestamp(void *callee)
+{
+	int curr_func;
+
+	curr_func = find_callee(callee);
+	if (curr_func < 0) {
+		/* No more space to add another function */
+		return;
+	}
 
+	if (disco_func[curr_func].addr == NULL) { /* New function discovered */
 		disco_func[curr_func].delta_t = 0;
+		disco_func[curr_func].calls = 0;
 		disco_func[curr_func].call_depth = 0;
 		disco_func[curr_func].addr = callee;
-
-		num_disco_func++;
 	}
 
+	disco_func[curr_func].calls++;
+
 	/* New function or no other instance of function active (called): record timestamp */
 	if (disco_func[curr_func].call_depth == 0) {
-		disco_func[curr_func].entry_timestamp = instr_timestamp_ns();
+		disco_func[curr_func].entry_timestamp = timing_counter_get();
 	}
 
 	/* Update call depth if not reached out maximum call depth */
@@ -377,30 +425,28 @@ void push_callee_timestamp(void *callee)
 __no_instrumentation__
 void pop_callee_timestamp(void *callee)
 {
-	uint64_t dt_ns;
-	uint64_t entry_timestamp;
-	uint64_t exit_timestamp;
+	timing_t exit_timestamp;
 	int curr_func;
 
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			disco_func[curr_func].call_depth--;
-
-			/* Last active function is returning */
-			if (disco_func[curr_func].call_depth == 0) {
-				entry_timestamp = disco_func[curr_func].entry_timestamp;
-				exit_timestamp = instr_timestamp_ns(); /* Now */
-
-				/* Compute delta T */
-				dt_ns = exit_timestamp - entry_timestamp;
-
-				/* Accumulate delta T */
-				disco_func[curr_func].delta_t += dt_ns;
-
-			}
-
-			return;
+	curr_func = find_callee(callee);
+	if (curr_func >= 0 && disco_func[curr_func].addr == callee &&
+	    disco_func[curr_func].call_depth > 0) {
+		disco_func[curr_func].call_depth--;
+
+		/* Last active function is returning */
+		if (disco_func[curr_func].call_depth == 0) {
+			exit_timestamp = timing_counter_get(); /* Now */
+
+			/*
+			 * Accumulate delta T in cycles, it is only converted to
+			 * nanoseconds when dumped.
+			 */
+			disco_func[curr_func].delta_t +=
+				timing_cycles_get(&disco_func[curr_func].entry_timestamp,
+						  &exit_timestamp);
 		}
+
+		return;
 	}
 
 	/* Track number of unbalanced/spurious function exits */
@@ -429,6 +475,50 @@ void save_context(struct instr_record *record)
 #endif
 }
 
+#if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH) && defined(SAMPLING_PERIOD)
+/*
+ * Tells whether an entry or exit event belongs to a sampled call and must be
+ * traced. Only one call is followed at a time: the entry of every
+ * SAMPLING_PERIOD-th call is traced, and then the exit of that same call,
+ * found by matching the function and thread and skipping over the exits of
+ * recursive calls.
+ */
+__no_instrumentation__
+static bool sample_event(enum instr_event_types type, void *callee)
+{
+	k_tid_t thread = k_current_get();
+
+	if (sampled_call.callee != NULL) {
+		if (callee != sampled_call.callee || thread != sampled_call.thread) {
+			return false;
+		}
+
+		if (type == INSTR_EVENT_ENTRY) {
+			sampled_call.depth++;
+			return false;
+		}
+
+		if (--sampled_call.depth > 0) {
+			return false;
+		}
+
+		sampled_call.callee = NULL;
+		return true;
+	}
+
+	if (type != INSTR_EVENT_ENTRY || --sampled_call.countdown > 0) {
+		return false;
+	}
+
+	sampled_call.countdown = SAMPLING_PERIOD;
+	sampled_call.callee = callee;
+	sampled_call.thread = thread;
+	sampled_call.depth = 1;
+
+	return true;
+}
+#endif
+
 #if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH)
 __no_instrumentation__
 enum instr_event_types promote_event_type(enum instr_event_types type, void *callee,
@@ -564,6 +654,15 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 		return;
 	}
 
+#if defined(SAMPLING_PERIOD)
+	/* Context switches are always traced, function calls only when sampled */
+	if ((type == INSTR_EVENT_ENTRY || type == INSTR_EVENT_EXIT) &&
+	    !sample_event(type, callee)) {
+		instr_enable();
+		return;
+	}
+#endif
+
 	/* Tracing */
 	if (!_instr_tracing_disabled) {
 		struct instr_record record;
@@ -49,6 +49,12 @@ struct backend_data_t {
 	struct k_work mbox_work;
 	struct k_work_q mbox_wq;
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_BATCH)
+	/* Only accessed from the MBOX WQ thread */
+	bool rx_batch;
+	bool kick_pending;
+#endif
+
 	/* General */
 	unsigned int role;
 	atomic_t state;
@@ -296,13 +302,61 @@ static int vr_shm_configure(struct ipc_static_vrings *vr, const struct backend_c
 
 static void virtio_notify_cb(struct virtqueue *vq, void *priv)
 {
-	struct backend_config_t *conf = priv;
+	const struct device *instance = priv;
+	const struct backend_config_t *conf = instance->config;
+
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_BATCH)
+	struct backend_data_t *data = instance->data;
+
+	/* Kicks issued while processing RX are sent once the batch is done */
+	if (data->rx_batch && k_current_get() == k_work_queue_thread_get(&data->mbox_wq)) {
+		data->kick_pending = true;
+		return;
+	}
+#endif
 
 	if (conf->mbox_tx.dev) {
 		mbox_send_dt(&conf->mbox_tx, NULL);
 	}
 }
 
+#if defined(CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_BATCH)
+static void mbox_callback_process(struct k_work *item)
+{
+	struct backend_data_t *data;
+	struct virtqueue *vq;
+	unsigned int passes = 0;
+	bool more;
+
+	data = CONTAINER_OF(item, struct backend_data_t, mbox_work);
+	vq = data->vr.vq[(data->role == ROLE_HOST) ? VIRTQUEUE_ID_HOST : VIRTQUEUE_ID_REMOTE];
+
+	data->rx_batch = true;
+
+	/*
+	 * Ask the remote not to interrupt while the available buffers are
+	 * drained. Re-enabling the notification reports the buffers that
+	 * arrived in the meantime, which are drained as well.
+	 */
+	do {
+		virtqueue_disable_cb(vq);
+		virtqueue_notification(vq);
+		more = (virtqueue_enable_cb(vq) != 0);
+	} while (more && ++passes < CONFIG_IPC_SERVICE_BACKEND_RPMSG_RX_BATCH_PASSES);
+
+	data->rx_batch = false;
+
+	if (data->kick_pending) {
+		data->kick_pending = false;
+		virtio_notify_cb(vq, data->vr.priv);
+	}
+
+	/* Out of budget, let other threads run before processing the rest */
+	if (more) {
+		k_work_submit_to_queue(&data->mbox_wq, &data->mbox_work);
+	}
+}
+#else
 static void mbox_callback_process(struct k_work *item)
 {
 	struct backend_data_t *data;
@@ -313,6 +367,7 @@ static void mbox_callback_process(struct k_work *item)
 
 	virtqueue_notification(data->vr.vq[vq_id]);
 }
+#endif
 
 static void mbox_callback(const struct device *instance, uint32_t channel,
 			  void *user_data, struct mbox_msg *msg_data)
@@ -579,7 +634,7 @@ static int open(const struct device *instance)
 	}
 
 	data->vr.notify_cb = virtio_notify_cb;
-	data->vr.priv = (void *) conf;
+	data->vr.priv = (void *) instance;
 
 	err = ipc_static_vrings_init(&data->vr, conf->role);
 	if (err != 0) {
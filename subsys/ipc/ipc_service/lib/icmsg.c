@@ -47,6 +47,8 @@
 
 #define SHMEM_ACCESS_TO		K_MSEC(CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_TO_MS)
 
+#define RX_BUFFER_SIZE		CONFIG_PBUF_RX_READ_BUF_SIZE
+
 static const uint8_t magic[] = {0x45, 0x6d, 0x31, 0x6c, 0x31, 0x4b,
 				0x30, 0x72, 0x6e, 0x33, 0x6c, 0x69, 0x34};
 
@@ -78,6 +80,9 @@ static int mbox_deinit(const struct icmsg_config_t *conf,
 #ifdef CONFIG_MULTITHREADING
 	(void)k_work_cancel(&dev_data->mbox_work);
 #endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	(void)k_work_cancel_delayable(&dev_data->notify_work);
+#endif
 
 	return 0;
 }
@@ -123,6 +128,34 @@ static void submit_mbox_work(struct icmsg_data_t *dev_data)
 
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+static void notify_work_process(struct k_work *item)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+	struct icmsg_data_t *dev_data = CONTAINER_OF(dwork, struct icmsg_data_t, notify_work);
+
+	/* Messages counted from now on will trigger another notification */
+	atomic_clear(&dev_data->tx_pending);
+	(void)mbox_send_dt(&dev_data->cfg->mbox_tx, NULL);
+}
+
+/* Returns true if the notification for the sent message can be deferred */
+static bool defer_tx_notification(struct icmsg_data_t *dev_data)
+{
+	if (atomic_inc(&dev_data->tx_pending) + 1 < CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE_MAX_MSGS) {
+		(void)k_work_schedule_for_queue(workq, &dev_data->notify_work,
+						K_USEC(CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE_DELAY_US));
+		return true;
+	}
+
+	/* Enough messages are pending, the notification sent now covers them all */
+	(void)k_work_cancel_delayable(&dev_data->notify_work);
+	atomic_clear(&dev_data->tx_pending);
+
+	return false;
+}
+#endif
+
 static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 {
 	int ret;
@@ -149,10 +182,48 @@ static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 	return 0;
 }
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+/* Get the next message, in place unless it wraps around the end of the buffer.
+ * Returns its length, or 0 if there is no message to receive.
+ */
+static uint32_t rx_message_get(struct icmsg_data_t *dev_data, const uint8_t **data,
+			       uint32_t *len)
+{
+	volatile char *buf;
+	uint32_t len_available;
+	int ret = pbuf_get_rx_buf(dev_data->rx_pb, &buf);
+
+	if (ret > 0) {
+		dev_data->rx_in_place = true;
+		*data = (const uint8_t *)buf;
+		*len = ret;
+		return ret;
+	}
+
+	dev_data->rx_in_place = false;
+	*data = dev_data->rx_buffer;
+
+	if (ret != -EFAULT) {
+		return 0;
+	}
+
+	len_available = data_available(dev_data);
+	if (len_available > 0 && RX_BUFFER_SIZE >= len_available) {
+		*len = pbuf_read(dev_data->rx_pb, dev_data->rx_buffer, RX_BUFFER_SIZE);
+	}
+
+	return len_available;
+}
+#endif
+
 static bool callback_process(struct icmsg_data_t *dev_data)
 {
 	int ret;
-	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+	const uint8_t *rx_buffer;
+#else
+	uint8_t rx_buffer[RX_BUFFER_SIZE] __aligned(4);
+#endif
 	uint32_t len = 0;
 	uint32_t len_available;
 	bool rerun = false;
@@ -256,11 +327,20 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 	case ICMSG_STATE_INITIALIZING_SID_DISABLED:
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+		if (atomic_get(&dev_data->rx_held)) {
+			/* Receiving resumes when the held buffer is released. */
+			return false;
+		}
+
+		len_available = rx_message_get(dev_data, &rx_buffer, &len);
+#else
 		len_available = data_available(dev_data);
 
-		if (len_available > 0 && sizeof(rx_buffer) >= len_available) {
-			len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
+		if (len_available > 0 && RX_BUFFER_SIZE >= len_available) {
+			len = pbuf_read(dev_data->rx_pb, rx_buffer, RX_BUFFER_SIZE);
 		}
+#endif
 
 		if (state == ICMSG_STATE_CONNECTED_SID_ENABLED &&
 		    (UNBOUND_ENABLED || UNBOUND_DETECT)) {
@@ -284,16 +364,26 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 			return false;
 		}
 
-		__ASSERT_NO_MSG(len_available <= sizeof(rx_buffer));
+		__ASSERT_NO_MSG(len_available <= RX_BUFFER_SIZE || len == len_available);
 
-		if (sizeof(rx_buffer) < len_available) {
+		if (RX_BUFFER_SIZE < len_available && len != len_available) {
 			return false;
 		}
 
 		if (state != ICMSG_STATE_INITIALIZING_SID_DISABLED || !UNBOUND_DISABLED) {
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+			dev_data->rx_data = rx_buffer;
+#endif
 			if (dev_data->cb->received) {
 				dev_data->cb->received(rx_buffer, len, dev_data->ctx);
 			}
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+			if (atomic_get(&dev_data->rx_held)) {
+				return false;
+			}
+
+			dev_data->rx_data = NULL;
+#endif
 		} else {
 			/* Allow magic number longer than sizeof(magic) for future protocol
 			 * version.
@@ -314,6 +404,13 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 			notify_remote = true;
 		}
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+		if (dev_data->rx_in_place) {
+			(void)pbuf_free_rx_buf(dev_data->rx_pb);
+			dev_data->rx_in_place = false;
+		}
+#endif
+
 		rerun = (data_available(dev_data) > 0);
 		break;
 
@@ -411,6 +508,16 @@ int icmsg_open(const struct icmsg_config_t *conf,
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
 	k_mutex_init(&dev_data->tx_lock);
 #endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+	dev_data->tx_buf = NULL;
+	dev_data->rx_data = NULL;
+	dev_data->rx_in_place = false;
+	atomic_clear(&dev_data->rx_held);
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	k_work_init_delayable(&dev_data->notify_work, notify_work_process);
+	atomic_clear(&dev_data->tx_pending);
+#endif
 
 	ret = pbuf_rx_init(dev_data->rx_pb);
 
@@ -493,6 +600,20 @@ int icmsg_close(const struct icmsg_config_t *conf,
 	return ret;
 }
 
+static int notify_tx(const struct icmsg_config_t *conf,
+		     struct icmsg_data_t *dev_data)
+{
+	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	if (defer_tx_notification(dev_data)) {
+		return 0;
+	}
+#endif
+
+	return mbox_send_dt(&conf->mbox_tx, NULL);
+}
+
 int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len)
@@ -520,21 +641,34 @@ int icmsg_send(const struct icmsg_config_t *conf,
 		return -ENOBUFS;
 	}
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+	if (dev_data->tx_buf != NULL) {
+		/* The claimed buffer would be overwritten. */
+		(void)release_tx_buffer(dev_data);
+		return -ENOBUFS;
+	}
+#endif
+
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
 
 	release_ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!release_ret);
 
 	if (write_ret < 0) {
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+		/* Let the remote side free space used by deferred messages */
+		if (atomic_get(&dev_data->tx_pending) > 0) {
+			(void)k_work_reschedule_for_queue(workq, &dev_data->notify_work,
+							  K_NO_WAIT);
+		}
+#endif
 		return write_ret;
 	} else if (write_ret < len) {
 		return -EBADMSG;
 	}
 	sent_bytes = write_ret;
 
-	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
-
-	ret = mbox_send_dt(&conf->mbox_tx, NULL);
+	ret = notify_tx(conf, dev_data);
 	if (ret) {
 		return ret;
 	}
@@ -542,6 +676,146 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	return sent_bytes;
 }
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, size_t *size)
+{
+	char *buf;
+	int ret;
+
+	if (!is_endpoint_ready(atomic_get(&dev_data->state))) {
+		return -EBUSY;
+	}
+
+	ret = reserve_tx_buffer_if_unused(dev_data);
+	if (ret < 0) {
+		return -ENOBUFS;
+	}
+
+	if (dev_data->tx_buf != NULL) {
+		ret = -EALREADY;
+		goto release;
+	}
+
+	ret = pbuf_get_tx_buf(dev_data->tx_pb, &buf);
+	if (ret <= 0) {
+		ret = (ret == 0) ? -ENOBUFS : ret;
+		goto release;
+	}
+
+	if (*size > ret) {
+		*size = ret;
+		ret = -ENOMEM;
+		goto release;
+	}
+
+	if (*size == 0) {
+		*size = ret;
+	}
+
+	/* Keep the TX buffer reserved until the message is sent or dropped. */
+	dev_data->tx_buf = buf;
+	*data = buf;
+
+	return 0;
+
+release:
+	(void)release_tx_buffer(dev_data);
+	return ret;
+}
+
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data)
+{
+	if (data == NULL || data != dev_data->tx_buf) {
+		return -EINVAL;
+	}
+
+	dev_data->tx_buf = NULL;
+
+	return release_tx_buffer(dev_data);
+}
+
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *data, size_t len)
+{
+	int commit_ret;
+	int release_ret;
+	int ret;
+
+	if (data == NULL || data != dev_data->tx_buf) {
+		return -EINVAL;
+	}
+
+	/* Empty message is not allowed */
+	if (len == 0) {
+		return -ENODATA;
+	}
+
+	commit_ret = (len <= UINT16_MAX) ? pbuf_commit_tx_buf(dev_data->tx_pb, len) : -EINVAL;
+	if (commit_ret < 0) {
+		/* The buffer stays claimed, so it can still be dropped. */
+		return -EBADMSG;
+	}
+
+	dev_data->tx_buf = NULL;
+
+	release_ret = release_tx_buffer(dev_data);
+	__ASSERT_NO_MSG(!release_ret);
+
+	ret = notify_tx(conf, dev_data);
+	if (ret) {
+		return ret;
+	}
+
+	return commit_ret;
+}
+
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data)
+{
+	if (data == NULL || data != dev_data->rx_data) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&dev_data->rx_held, 0, 1)) {
+		return -EALREADY;
+	}
+
+	return 0;
+}
+
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data,
+			    const void *data)
+{
+	if (!atomic_get(&dev_data->rx_held)) {
+		return -EALREADY;
+	}
+
+	if (data == NULL || data != dev_data->rx_data) {
+		return -EINVAL;
+	}
+
+	if (dev_data->rx_in_place) {
+		(void)pbuf_free_rx_buf(dev_data->rx_pb);
+		dev_data->rx_in_place = false;
+	}
+
+	dev_data->rx_data = NULL;
+	atomic_clear(&dev_data->rx_held);
+
+	/* Receive the messages that arrived in the meantime. */
+	submit_mbox_work(dev_data);
+
+	return 0;
+}
+#endif /* CONFIG_IPC_SERVICE_ICMSG_NOCOPY */
+
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICMSG_WQ_ENABLE)
 
 static int work_q_init(void)
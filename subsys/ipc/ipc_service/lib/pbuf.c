@@ -179,6 +179,70 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	return len;
 }
 
+int pbuf_get_tx_buf(struct pbuf *pb, char **buf)
+{
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* Invalidate rd_idx only, local wr_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = *(pb->cfg->rd_idx_loc);
+	uint32_t wr_idx = pb->data.wr_idx;
+
+	if (!IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	uint32_t free_space = blen - idx_occupied(blen, wr_idx, rd_idx) - _PBUF_IDX_SIZE;
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+
+	if (free_space <= PBUF_PACKET_LEN_SZ) {
+		return 0;
+	}
+
+	*buf = (char *)&pb->cfg->data_loc[data_idx];
+
+	/* Data written in place must not wrap. */
+	return MIN(MIN(free_space - PBUF_PACKET_LEN_SZ, blen - data_idx), UINT16_MAX);
+}
+
+int pbuf_commit_tx_buf(struct pbuf *pb, uint16_t len)
+{
+	if (pb == NULL || len == 0) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = pb->data.wr_idx;
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+
+	if (len > blen - data_idx) {
+		return -EINVAL;
+	}
+
+	*((uint32_t *)(&data_loc[wr_idx])) = 0;
+	sys_put_be16(len, &data_loc[wr_idx]);
+	__sync_synchronize();
+	sys_cache_data_flush_range(&data_loc[wr_idx], PBUF_PACKET_LEN_SZ);
+	sys_cache_data_flush_range(&data_loc[data_idx], len);
+
+	wr_idx = idx_wrap(blen, ROUND_UP(data_idx + len, _PBUF_IDX_SIZE));
+	/* Update wr_idx. */
+	pb->data.wr_idx = wr_idx;
+	*(pb->cfg->wr_idx_loc) = wr_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc, sizeof(*(pb->cfg->wr_idx_loc)));
+
+	return len;
+}
+
 int pbuf_get_initial_buf(struct pbuf *pb, volatile char **buf, uint16_t *len)
 {
 	uint32_t wr_idx;
@@ -295,6 +359,95 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 	return len;
 }
 
+/* Get the length and data index of the packet at rd_idx, or 0 if empty. */
+static int rx_packet(struct pbuf *pb, uint32_t *data_idx)
+{
+	/* Invalidate wr_idx only, local rd_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = *(pb->cfg->wr_idx_loc);
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	if (!IS_PTR_ALIGNED_BYTES(wr_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (rd_idx == wr_idx) {
+		/* Buffer is empty. */
+		return 0;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
+	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
+
+	if (idx_occupied(blen, wr_idx, rd_idx) < plen + PBUF_PACKET_LEN_SZ) {
+		/* This should never happen. */
+		return -EAGAIN;
+	}
+
+	*data_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+
+	return plen;
+}
+
+int pbuf_get_rx_buf(struct pbuf *pb, volatile char **buf)
+{
+	uint32_t data_idx;
+	int plen;
+
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	plen = rx_packet(pb, &data_idx);
+	if (plen <= 0) {
+		return plen;
+	}
+
+	if (plen > pb->cfg->len - data_idx) {
+		return -EFAULT;
+	}
+
+	*buf = (volatile char *)&pb->cfg->data_loc[data_idx];
+	sys_cache_data_invd_range((void *)*buf, plen);
+	__sync_synchronize();
+
+	return plen;
+}
+
+int pbuf_free_rx_buf(struct pbuf *pb)
+{
+	uint32_t data_idx;
+	uint32_t rd_idx;
+	int plen;
+
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	plen = rx_packet(pb, &data_idx);
+	if (plen < 0) {
+		return plen;
+	} else if (plen == 0) {
+		return -ENODATA;
+	}
+
+	/* Update rd_idx. */
+	rd_idx = idx_wrap(pb->cfg->len, ROUND_UP(data_idx + plen, _PBUF_IDX_SIZE));
+
+	pb->data.rd_idx = rd_idx;
+	*(pb->cfg->rd_idx_loc) = rd_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+
+	return 0;
+}
+
 uint32_t pbuf_handshake_read(struct pbuf *pb)
 {
 	volatile uint32_t *ptr = pb->cfg->handshake_loc;
@@ -15,6 +15,7 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(llext, CONFIG_LLEXT_LOG_LEVEL);
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "llext_priv.h"
@@ -127,37 +128,97 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
+STRUCT_SECTION_START_EXTERN(llext_const_symbol);
+
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+static int llext_const_sym_slid_cmp(const void *key, const void *entry)
+{
+	uintptr_t slid = (uintptr_t)key;
+	uintptr_t entry_slid = ((const struct llext_const_symbol *)entry)->slid;
+
+	return (slid > entry_slid) - (slid < entry_slid);
+}
+#else
+static int llext_const_sym_name_cmp(const void *key, const void *entry)
+{
+	return strcmp(key, ((const struct llext_const_symbol *)entry)->name);
+}
+
+/*
+ * The linker places the built-in symbols in the order of their section
+ * names, which embed the symbol names. Check that this resulted in a table
+ * sorted by name, which toolchains that do not sort sections may not give.
+ */
+static bool llext_builtins_sorted(void)
+{
+	const struct llext_const_symbol *syms = STRUCT_SECTION_START(llext_const_symbol);
+	static int8_t sorted = -1;
+	size_t count;
+
+	if (sorted < 0) {
+		STRUCT_SECTION_COUNT(llext_const_symbol, &count);
+
+		sorted = 1;
+		for (size_t i = 1; i < count; i++) {
+			if (strcmp(syms[i - 1].name, syms[i].name) >= 0) {
+				sorted = 0;
+				break;
+			}
+		}
+	}
+
+	return sorted == 1;
+}
+#endif
+
+static int llext_sym_name_cmp(const void *key, const void *entry)
+{
+	return strcmp(key, ((const struct llext_symbol *)entry)->name);
+}
+
 const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
 {
 	if (sym_table == NULL) {
 		/* Built-in symbol table */
-#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
-		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
+		const struct llext_const_symbol *sym;
+		size_t count;
+
+		STRUCT_SECTION_COUNT(llext_const_symbol, &count);
+		if (count == 0) {
+			return NULL;
+		}
 
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+		/* 'sym_name' is actually a SLID to search for. The
+		 * llext_const_symbol_area section is sorted in ascending
+		 * SLID order (see scripts/build/llext_prepare_exptab.py).
 		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
-			}
+		sym = bsearch(sym_name, STRUCT_SECTION_START(llext_const_symbol), count,
+			      sizeof(*sym), llext_const_sym_slid_cmp);
+		if (sym != NULL) {
+			return sym->addr;
 		}
 #else
+		if (llext_builtins_sorted()) {
+			sym = bsearch(sym_name, STRUCT_SECTION_START(llext_const_symbol), count,
+				      sizeof(*sym), llext_const_sym_name_cmp);
+			return (sym != NULL) ? sym->addr : NULL;
+		}
+
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
 			if (strcmp(sym->name, sym_name) == 0) {
 				return sym->addr;
 			}
 		}
 #endif
-	} else {
-		/* find symbols in module */
-		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
-			if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
-				return sym_table->syms[i].addr;
-			}
+	} else if (sym_table->sym_cnt > 0) {
+		/* find symbols in module, its tables are sorted by name */
+		const struct llext_symbol *sym;
+
+		sym = bsearch(sym_name, sym_table->syms, sym_table->sym_cnt, sizeof(*sym),
+			      llext_sym_name_cmp);
+		if (sym != NULL) {
+			return sym->addr;
 		}
 	}
 
@@ -241,6 +302,7 @@ int llext_unload(struct llext **ext)
 		llext_free(tmp->sect_hdrs);
 	}
 
+	llext_cache_release(tmp);
 	llext_free_regions(tmp);
 	llext_free(tmp->sym_tab.syms);
 	llext_free(tmp->exp_tab.syms);
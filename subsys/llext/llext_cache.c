@@ -0,0 +1,388 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/llext/loader.h>
+#include <zephyr/llext/llext.h>
+#include <zephyr/llext/symbol.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(llext, CONFIG_LLEXT_LOG_LEVEL);
+
+#include "llext_priv.h"
+
+/*
+ * The cache is a retained RAM area holding the regions of extensions, one
+ * entry after the other. Regions are linked in place when an extension is
+ * first loaded, so a later load of the same ELF file can use them as they
+ * are. Writable regions are followed by a copy of their contents right after
+ * linking, which is used to reset them each time the image is reused.
+ */
+
+#define LLEXT_CACHE_MAGIC 0x48434c4c /* "LLCH" */
+#define LLEXT_CACHE_ALIGN 8
+
+struct llext_cache_region {
+	/* Offsets from the start of the cache area, 0 if not cached */
+	uint32_t offset;
+	uint32_t initial;
+	uint32_t size;
+	bool zeroed;
+};
+
+struct llext_cache_entry {
+	uint32_t size;
+	uint32_t elf_crc;
+	uint32_t image_crc;
+	bool reusable;
+	bool in_use;
+	bool incomplete;
+	struct llext_cache_region regions[LLEXT_MEM_COUNT];
+} __aligned(LLEXT_CACHE_ALIGN);
+
+struct llext_cache_header {
+	uint32_t magic;
+	uint32_t kernel_crc;
+	uint32_t used;
+} __aligned(LLEXT_CACHE_ALIGN);
+
+static uint8_t llext_cache_area[CONFIG_LLEXT_CACHE_SIZE * KB(1)] __noinit
+	__aligned(LLEXT_CACHE_ALIGN);
+
+#define llext_cache ((struct llext_cache_header *)llext_cache_area)
+
+#define LLEXT_CACHE_FOREACH(entry)                                                                 \
+	for (entry = (void *)(llext_cache_area + sizeof(struct llext_cache_header));                \
+	     (uint8_t *)entry < llext_cache_area + llext_cache->used;                               \
+	     entry = (void *)((uint8_t *)entry + entry->size))
+
+static bool llext_cache_ready;
+
+/* Entry being reused or filled by the current load, protected by llext_lock */
+static struct llext_cache_entry *llext_cache_cur;
+static bool llext_cache_hit;
+
+STRUCT_SECTION_START_EXTERN(llext_const_symbol);
+
+/*
+ * Cached images hold the addresses of built-in symbols and of the cache area
+ * itself, so they only remain valid for the same kernel image.
+ */
+static uint32_t llext_cache_kernel_crc(void)
+{
+	const struct llext_const_symbol *syms = STRUCT_SECTION_START(llext_const_symbol);
+	uintptr_t area = (uintptr_t)llext_cache_area;
+	size_t count;
+	uint32_t crc;
+
+	STRUCT_SECTION_COUNT(llext_const_symbol, &count);
+
+	crc = crc32_ieee((const uint8_t *)&area, sizeof(area));
+
+	return crc32_ieee_update(crc, (const uint8_t *)syms, count * sizeof(*syms));
+}
+
+static void llext_cache_init(void)
+{
+	uint32_t kernel_crc = llext_cache_kernel_crc();
+	struct llext_cache_entry *entry;
+
+	if (llext_cache->magic != LLEXT_CACHE_MAGIC || llext_cache->kernel_crc != kernel_crc ||
+	    llext_cache->used < sizeof(*llext_cache) ||
+	    llext_cache->used > sizeof(llext_cache_area) ||
+	    !IS_ALIGNED(llext_cache->used, LLEXT_CACHE_ALIGN)) {
+		LOG_DBG("Resetting linked image cache");
+		llext_cache->magic = LLEXT_CACHE_MAGIC;
+		llext_cache->kernel_crc = kernel_crc;
+		llext_cache->used = sizeof(*llext_cache);
+	}
+
+	/* No extension is loaded yet, and damaged entries end the cache */
+	LLEXT_CACHE_FOREACH(entry) {
+		uint32_t pos = (uint8_t *)entry - llext_cache_area;
+
+		if (entry->size < sizeof(*entry) || entry->size > llext_cache->used - pos ||
+		    !IS_ALIGNED(entry->size, LLEXT_CACHE_ALIGN)) {
+			LOG_WRN("Dropping damaged cache entries at %#x", pos);
+			llext_cache->used = pos;
+			break;
+		}
+
+		entry->in_use = false;
+	}
+
+	llext_cache_ready = true;
+}
+
+/* Identical files at different addresses may be linked differently */
+static int llext_cache_elf_crc(struct llext_loader *ldr, struct llext *ext, uint32_t *crc)
+{
+	size_t end = ldr->hdr.e_shoff + (size_t)ldr->hdr.e_shnum * ldr->hdr.e_shentsize;
+	const void *base = llext_peek(ldr, 0);
+	uint8_t buf[64];
+	int ret;
+
+	for (int i = 0; i < ext->sect_cnt; i++) {
+		const elf_shdr_t *shdr = ext->sect_hdrs + i;
+
+		if (shdr->sh_type != SHT_NOBITS) {
+			end = MAX(end, shdr->sh_offset + shdr->sh_size);
+		}
+	}
+
+	*crc = crc32_ieee((const uint8_t *)&base, sizeof(base));
+
+	if (base != NULL) {
+		*crc = crc32_ieee_update(*crc, base, end);
+		return 0;
+	}
+
+	ret = llext_seek(ldr, 0);
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (size_t pos = 0; pos < end; pos += sizeof(buf)) {
+		size_t len = MIN(sizeof(buf), end - pos);
+
+		ret = llext_read(ldr, buf, len);
+		if (ret != 0) {
+			return ret;
+		}
+
+		*crc = crc32_ieee_update(*crc, buf, len);
+	}
+
+	return 0;
+}
+
+static uint32_t llext_cache_image_crc(const struct llext_cache_entry *entry)
+{
+	uint32_t crc = 0;
+
+	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+		const struct llext_cache_region *r = &entry->regions[i];
+
+		/* BSS has no contents, and writable data changes at runtime */
+		if (r->offset != 0 && !r->zeroed) {
+			uint32_t offset = (r->initial != 0) ? r->initial : r->offset;
+
+			crc = crc32_ieee_update(crc, llext_cache_area + offset, r->size);
+		}
+	}
+
+	return crc;
+}
+
+static bool llext_cache_entry_matches(struct llext_loader *ldr,
+				      const struct llext_cache_entry *entry, uint32_t elf_crc)
+{
+	if (!entry->reusable || entry->in_use || entry->elf_crc != elf_crc) {
+		return false;
+	}
+
+	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+		const struct llext_cache_region *r = &entry->regions[i];
+
+		if (r->offset != 0 && r->size != ldr->sects[i].sh_size) {
+			return false;
+		}
+	}
+
+	if (llext_cache_image_crc(entry) != entry->image_crc) {
+		LOG_WRN("Cached image is corrupted, reloading it");
+		return false;
+	}
+
+	return true;
+}
+
+bool llext_cache_prepare(struct llext_loader *ldr, struct llext *ext,
+			 const struct llext_load_param *ldr_parm)
+{
+	struct llext_cache_entry *entry;
+	uint32_t elf_crc;
+
+	llext_cache_cur = NULL;
+	llext_cache_hit = false;
+
+	/* Only images fully linked by LLEXT from read-only storage are cached */
+	if (!ldr_parm->relocate_local || ldr_parm->pre_located || ldr_parm->section_detached ||
+	    ldr->storage == LLEXT_STORAGE_WRITABLE) {
+		return false;
+	}
+
+	if (!llext_cache_ready) {
+		llext_cache_init();
+	}
+
+	if (llext_cache_elf_crc(ldr, ext, &elf_crc) != 0) {
+		return false;
+	}
+
+	LLEXT_CACHE_FOREACH(entry) {
+		if (llext_cache_entry_matches(ldr, entry, elf_crc)) {
+			LOG_DBG("Reusing cached image at %p", entry);
+			entry->in_use = true;
+			llext_cache_cur = entry;
+			llext_cache_hit = true;
+			return true;
+		}
+	}
+
+	/* Start a new entry, only accounted for if loading succeeds */
+	if (sizeof(llext_cache_area) - llext_cache->used < sizeof(*entry)) {
+		return false;
+	}
+
+	entry = (void *)(llext_cache_area + llext_cache->used);
+	memset(entry, 0, sizeof(*entry));
+	entry->size = sizeof(*entry);
+	entry->elf_crc = elf_crc;
+	llext_cache_cur = entry;
+
+	return false;
+}
+
+void *llext_cache_region(struct llext_loader *ldr, enum llext_mem mem_idx, size_t align,
+			 size_t size, bool *cached)
+{
+	struct llext_cache_entry *entry = llext_cache_cur;
+	const elf_shdr_t *region = ldr->sects + mem_idx;
+	uintptr_t limit = (uintptr_t)llext_cache_area + sizeof(llext_cache_area);
+	struct llext_cache_region *r;
+	uintptr_t start, end;
+	uintptr_t initial = 0;
+
+	*cached = false;
+
+	if (entry == NULL) {
+		return NULL;
+	}
+
+	r = &entry->regions[mem_idx];
+
+	if (llext_cache_hit) {
+		uint8_t *mem = llext_cache_area + r->offset;
+
+		if (r->offset == 0) {
+			return NULL;
+		}
+
+		if (r->zeroed) {
+			memset(mem, 0, r->size);
+		} else if (r->initial != 0) {
+			memcpy(mem, llext_cache_area + r->initial, r->size);
+		}
+
+		*cached = true;
+
+		return mem;
+	}
+
+	start = ROUND_UP((uintptr_t)entry + entry->size, MAX(align, 1));
+	end = start + size;
+
+	if (region->sh_type != SHT_NOBITS && (region->sh_flags & SHF_WRITE)) {
+		initial = ROUND_UP(end, sizeof(uint32_t));
+		end = initial + region->sh_size;
+	}
+
+	if (end > limit) {
+		/* Regions already placed here are in use: keep them, but never reuse them */
+		LOG_DBG("No room left to cache region %d", mem_idx);
+		entry->incomplete = true;
+		return NULL;
+	}
+
+	r->offset = start - (uintptr_t)llext_cache_area;
+	r->initial = (initial != 0) ? initial - (uintptr_t)llext_cache_area : 0;
+	r->size = region->sh_size;
+	r->zeroed = (region->sh_type == SHT_NOBITS);
+	entry->size = end - (uintptr_t)entry;
+
+	return (void *)start;
+}
+
+void llext_cache_finish(struct llext *ext, int ret)
+{
+	struct llext_cache_entry *entry = llext_cache_cur;
+
+	llext_cache_cur = NULL;
+
+	if (entry == NULL) {
+		return;
+	}
+
+	if (llext_cache_hit) {
+		if (ret != 0) {
+			entry->in_use = false;
+			return;
+		}
+
+#ifdef CONFIG_CACHE_MANAGEMENT
+		/* Make sure the restored regions are visible to instruction fetches */
+		for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+			if (entry->regions[i].offset != 0) {
+				sys_cache_data_flush_range(ext->mem[i], ext->mem_size[i]);
+				if (i == LLEXT_MEM_TEXT) {
+					sys_cache_instr_invd_range(ext->mem[i], ext->mem_size[i]);
+				}
+			}
+		}
+#endif
+		return;
+	}
+
+	/* On failure, nothing in the entry was accounted for as used */
+	if (ret != 0 || entry->size == sizeof(*entry)) {
+		return;
+	}
+
+	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+		const struct llext_cache_region *r = &entry->regions[i];
+
+		if (r->initial != 0) {
+			memcpy(llext_cache_area + r->initial, llext_cache_area + r->offset, r->size);
+		}
+	}
+
+	/* Dependencies on other extensions are not tracked across loads */
+	entry->reusable = !entry->incomplete && ext->dependency[0] == NULL;
+	entry->image_crc = llext_cache_image_crc(entry);
+	entry->in_use = true;
+	entry->size = ROUND_UP(entry->size, LLEXT_CACHE_ALIGN);
+	llext_cache->used += entry->size;
+
+	LOG_DBG("Cached image at %p, %u bytes%s", entry, entry->size,
+		entry->reusable ? "" : " (not reusable)");
+}
+
+void llext_cache_release(struct llext *ext)
+{
+	struct llext_cache_entry *entry;
+
+	if (!llext_cache_ready) {
+		return;
+	}
+
+	LLEXT_CACHE_FOREACH(entry) {
+		for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+			uint32_t offset = entry->regions[i].offset;
+
+			if (offset != 0 && ext->mem[i] == llext_cache_area + offset) {
+				entry->in_use = false;
+				return;
+			}
+		}
+	}
+}
@@ -15,6 +15,7 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(llext, CONFIG_LLEXT_LOG_LEVEL);
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "llext_priv.h"
@@ -610,6 +611,18 @@ static int llext_allocate_symtab(struct llext_loader *ldr, struct llext *ext)
 	return 0;
 }
 
+static int llext_symbol_cmp(const void *a, const void *b)
+{
+	return strcmp(((const struct llext_symbol *)a)->name,
+		      ((const struct llext_symbol *)b)->name);
+}
+
+/* Sort a symbol table by name, llext_find_sym() uses a binary search */
+static void llext_sort_symbols(struct llext_symtable *sym_tab)
+{
+	qsort(sym_tab->syms, sym_tab->sym_cnt, sizeof(struct llext_symbol), llext_symbol_cmp);
+}
+
 static int llext_export_symbols(struct llext_loader *ldr, struct llext *ext,
 				const struct llext_load_param *ldr_parm)
 {
@@ -662,6 +675,8 @@ static int llext_export_symbols(struct llext_loader *ldr, struct llext *ext,
 		LOG_DBG("sym %p name %s", sym->addr, sym->name);
 	}
 
+	llext_sort_symbols(exp_tab);
+
 	return 0;
 }
 
@@ -741,6 +756,8 @@ static int llext_copy_symbols(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
+	llext_sort_symbols(sym_tab);
+
 	return 0;
 }
 
@@ -770,12 +787,18 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		  const struct llext_load_param *ldr_parm)
 {
 	const struct llext_load_param default_ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	bool cached = false;
 	int ret;
 
 	if (!ldr_parm) {
 		ldr_parm = &default_ldr_parm;
 	}
 
+	if (ldr_parm->xip && !ldr_parm->pre_located) {
+		LOG_ERR("XIP loading requires a pre-located extension");
+		return -EINVAL;
+	}
+
 	/* Zero all memory that is affected by the loading process
 	 * (see the NOTICE at the top of this file).
 	 */
@@ -822,6 +845,8 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		goto out;
 	}
 
+	cached = llext_cache_prepare(ldr, ext, ldr_parm);
+
 	LOG_DBG("Allocate and copy regions...");
 	ret = llext_copy_regions(ldr, ext, ldr_parm);
 	if (ret != 0) {
@@ -850,7 +875,7 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		goto out;
 	}
 
-	if (ldr_parm->relocate_local) {
+	if (ldr_parm->relocate_local && !ldr_parm->xip && !cached) {
 		LOG_DBG("Linking ELF...");
 		ret = llext_link(ldr, ext, ldr_parm);
 		if (ret != 0) {
@@ -870,6 +895,8 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 	}
 
 out:
+	llext_cache_finish(ext, ret);
+
 	/*
 	 * Free resources only used during loading, unless explicitly requested.
 	 * Note that this exploits the fact that freeing a NULL pointer has no effect.
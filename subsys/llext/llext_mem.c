@@ -77,6 +77,49 @@ static void llext_init_mem_part(struct llext *ext, enum llext_mem mem_idx,
 	LOG_DBG("region %d: start %#zx, size %zd", mem_idx, (size_t)start, len);
 }
 
+/*
+ * Place a writable region of an XIP extension at the RAM address it was
+ * linked for: copy its initial data from the ELF storage, or clear BSS.
+ */
+static int llext_place_xip_region(struct llext_loader *ldr, struct llext *ext,
+				  enum llext_mem mem_idx)
+{
+	elf_shdr_t *region = ldr->sects + mem_idx;
+	size_t prepad = region->sh_info;
+	uintptr_t base = region->sh_addr;
+	int ret;
+
+	/* Only shared files include the prepad in the region address */
+	if (ldr->hdr.e_type == ET_DYN) {
+		base += prepad;
+	}
+
+	if (!base) {
+		LOG_ERR("Region %d has no link address", mem_idx);
+		return -EFAULT;
+	}
+
+	if (region->sh_type == SHT_NOBITS) {
+		memset((void *)base, 0, region->sh_size - prepad);
+	} else {
+		ret = llext_seek(ldr, region->sh_offset + prepad);
+		if (ret != 0) {
+			return ret;
+		}
+
+		ret = llext_read(ldr, (void *)base, region->sh_size - prepad);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	ext->mem[mem_idx] = (void *)(base - prepad);
+	ext->mem_on_heap[mem_idx] = false;
+	llext_init_mem_part(ext, mem_idx, base - prepad, region->sh_size);
+
+	return 0;
+}
+
 static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx, const struct llext_load_param *ldr_parm)
 {
@@ -84,6 +127,8 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 	elf_shdr_t *region = ldr->sects + mem_idx;
 	uintptr_t region_alloc = region->sh_size;
 	uintptr_t region_align = region->sh_addralign;
+	bool in_cache = false;
+	bool cached = false;
 
 	if (!region_alloc) {
 		return 0;
@@ -114,10 +159,16 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
+	if (ldr_parm->xip && (region->sh_flags & SHF_ALLOC) && (region->sh_flags & SHF_WRITE)) {
+		/* Only the writable regions of XIP extensions live in RAM */
+		return llext_place_xip_region(ldr, ext, mem_idx);
+	}
+
 	if (ldr->storage == LLEXT_STORAGE_WRITABLE ||           /* writable storage         */
 	    (ldr->storage == LLEXT_STORAGE_PERSISTENT &&        /* || persistent storage    */
 	     !(region->sh_flags & SHF_WRITE) &&                 /*    && read-only region   */
-	     !(region->sh_flags & SHF_LLEXT_HAS_RELOCS))) {     /*    && no relocs to apply */
+	     (!(region->sh_flags & SHF_LLEXT_HAS_RELOCS) ||     /*    && no relocs to apply */
+	      ldr_parm->xip))) {                                /*       (or pre-applied)   */
 		/*
 		 * Try to reuse data areas from the ELF buffer, if possible.
 		 * If any of the following tests fail, a normal allocation
@@ -172,24 +223,37 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		return -EFAULT;
 	}
 
-	/* Allocate a suitably aligned area for the region. */
-	if (region->sh_flags & SHF_EXECINSTR) {
-		ext->mem[mem_idx] = llext_aligned_alloc_instr(region_align, region_alloc);
-	} else {
-		ext->mem[mem_idx] = llext_aligned_alloc_data(region_align, region_alloc);
+	/* Allocate a suitably aligned area for the region, unless cached. */
+	if (region->sh_flags & SHF_ALLOC) {
+		ext->mem[mem_idx] = llext_cache_region(ldr, mem_idx, region_align, region_alloc,
+						       &cached);
+		in_cache = (ext->mem[mem_idx] != NULL);
 	}
 
-	if (!ext->mem[mem_idx]) {
-		LOG_ERR("Failed allocating %zd bytes %zd-aligned for region %d",
-			(size_t)region_alloc, (size_t)region_align, mem_idx);
-		return -ENOMEM;
-	}
+	if (!in_cache) {
+		if (region->sh_flags & SHF_EXECINSTR) {
+			ext->mem[mem_idx] = llext_aligned_alloc_instr(region_align, region_alloc);
+		} else {
+			ext->mem[mem_idx] = llext_aligned_alloc_data(region_align, region_alloc);
+		}
 
-	ext->alloc_size += region_alloc;
+		if (!ext->mem[mem_idx]) {
+			LOG_ERR("Failed allocating %zd bytes %zd-aligned for region %d",
+				(size_t)region_alloc, (size_t)region_align, mem_idx);
+			return -ENOMEM;
+		}
+
+		ext->alloc_size += region_alloc;
+	}
 
 	llext_init_mem_part(ext, mem_idx, (uintptr_t)ext->mem[mem_idx],
 		region_alloc);
 
+	if (cached) {
+		/* Already linked by a previous load */
+		return 0;
+	}
+
 	if (region->sh_type == SHT_NOBITS) {
 		memset(ext->mem[mem_idx], 0, region->sh_size);
 	} else {
@@ -219,12 +283,14 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
-	ext->mem_on_heap[mem_idx] = true;
+	ext->mem_on_heap[mem_idx] = !in_cache;
 
 	return 0;
 
 err:
-	llext_free(ext->mem[mem_idx]);
+	if (!in_cache) {
+		llext_free(ext->mem[mem_idx]);
+	}
 	ext->mem[mem_idx] = NULL;
 	return ret;
 }
@@ -117,6 +117,35 @@ static inline void llext_free_instr(void *ptr)
 	k_heap_free(&llext_instr_heap, ptr);
 }
 
+/*
+ * Linked image cache (llext_cache.c)
+ */
+
+#ifdef CONFIG_LLEXT_CACHE
+bool llext_cache_prepare(struct llext_loader *ldr, struct llext *ext,
+			 const struct llext_load_param *ldr_parm);
+void *llext_cache_region(struct llext_loader *ldr, enum llext_mem mem_idx, size_t align,
+			 size_t size, bool *cached);
+void llext_cache_finish(struct llext *ext, int ret);
+void llext_cache_release(struct llext *ext);
+#else
+static inline bool llext_cache_prepare(struct llext_loader *ldr, struct llext *ext,
+				       const struct llext_load_param *ldr_parm)
+{
+	return false;
+}
+
+static inline void *llext_cache_region(struct llext_loader *ldr, enum llext_mem mem_idx,
+				       size_t align, size_t size, bool *cached)
+{
+	*cached = false;
+	return NULL;
+}
+
+static inline void llext_cache_finish(struct llext *ext, int ret) {}
+static inline void llext_cache_release(struct llext *ext) {}
+#endif
+
 /*
  * ELF parsing (llext_load.c)
  */
@@ -17,6 +17,15 @@ backend = FS
 backend-str = fs
 source "subsys/logging/Kconfig.template.log_format_config"
 
+config LOG_BACKEND_FS_OUTPUT_DICTIONARY_FRAMED
+	bool "Framed dictionary output"
+	depends on LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	help
+	  Store each dictionary based log message in a frame with a length
+	  and a sequence number, written to the file at once. Messages are
+	  then never split between log files, and lost ones can be detected.
+	  Decode with the --framed option of the dictionary log parsers.
+
 config LOG_BACKEND_FS_AUTOSTART
 	bool "Automatically start fs backend"
 	default y
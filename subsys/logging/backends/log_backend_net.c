@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_net.h>
 #include <zephyr/net/hostname.h>
 #include <zephyr/net/net_if.h>
@@ -35,6 +36,7 @@ static bool net_init_done;
 struct sockaddr server_addr;
 static bool panic_mode;
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_NET_OUTPUT_DEFAULT;
+static uint32_t dict_seq;
 
 static struct log_backend_net_ctx {
 	int sock;
@@ -58,7 +60,8 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 #if defined(CONFIG_NET_TCP)
 	char len[sizeof("123456789")];
 
-	if (ctx->is_tcp) {
+	/* Dictionary frames carry their own length */
+	if (ctx->is_tcp && log_format_current != LOG_OUTPUT_DICT) {
 		(void)snprintk(len, sizeof(len), "%zu ", length);
 		io_vector[pos].iov_base = (void *)len;
 		io_vector[pos].iov_len = strlen(len);
@@ -169,11 +172,31 @@ static void process(const struct log_backend *const backend,
 		net_init_done = true;
 	}
 
+	/* Each frame is sent in one datagram, as long as it fits in the buffer */
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) && log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_framed_msg_process(&log_output_net, &msg->log, dict_seq++);
+		return;
+	}
+
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_net, &msg->log, flags);
 }
 
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (panic_mode || !net_init_done) {
+		return;
+	}
+
+	/* Only dictionary frames report dropped messages */
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) && log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_framed_dropped_process(&log_output_net, cnt, dict_seq++);
+	}
+}
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	log_format_current = log_type;
@@ -309,6 +332,7 @@ const struct log_backend_api log_backend_net_api = {
 	.init = init_net,
 	.is_ready = backend_ready,
 	.process = process,
+	.dropped = dropped,
 	.format_set = format_set,
 };
 
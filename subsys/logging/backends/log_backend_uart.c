@@ -131,6 +131,11 @@ static void process(const struct log_backend *const backend,
 	uint32_t flags = log_backend_std_get_flags();
 	log_format_func_t log_output_func = log_format_func_t_get(data->log_format_current);
 
+	/* Output is flushed once the logging thread has no message left */
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_BATCH) && !data->in_panic) {
+		flags |= LOG_OUTPUT_FLAG_NO_FLUSH;
+	}
+
 	log_output_func(ctx->output, &msg->log, flags);
 }
 
@@ -217,12 +222,25 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 	}
 }
 
+static void notify(const struct log_backend *const backend, enum log_backend_evt event,
+		   union log_backend_evt_arg *arg)
+{
+	const struct lbu_cb_ctx *ctx = backend->cb->ctx;
+
+	ARG_UNUSED(arg);
+
+	if (event == LOG_BACKEND_EVT_PROCESS_THREAD_DONE) {
+		log_output_flush(ctx->output);
+	}
+}
+
 const struct log_backend_api log_backend_uart_api = {
 	.process = process,
 	.panic = panic,
 	.init = log_backend_uart_init,
 	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
 	.format_set = format_set,
+	.notify = IS_ENABLED(CONFIG_LOG_BACKEND_UART_BATCH) ? notify : NULL,
 };
 
 #if defined(CONFIG_LOG_BACKEND_UART_ASYNC) && defined(CONFIG_SOC_FAMILY_STM32) &&                  \
@@ -140,7 +140,32 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
 		  MPSC_PBUF_MAX_UTILIZATION : 0)
 };
-#endif
+
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* Words of buf32 given to each CPU, log_buffer being the one of CPU 0. */
+#define CPU_BUFFER_WLEN ROUND_DOWN(ARRAY_SIZE(buf32) / CONFIG_MP_MAX_NUM_CPUS, \
+				   MAX(1, Z_LOG_MSG_ALIGNMENT / sizeof(int)))
+
+static struct mpsc_pbuf_buffer cpu_log_buffers[CONFIG_MP_MAX_NUM_CPUS - 1];
+/* Oldest message claimed from the buffer of each CPU and not processed yet. */
+static union log_msg_generic *cpu_log_msgs[CONFIG_MP_MAX_NUM_CPUS];
+
+static struct mpsc_pbuf_buffer *cpu_log_buffer(unsigned int cpu)
+{
+	return cpu == 0 ? &log_buffer : &cpu_log_buffers[cpu - 1];
+}
+
+/* Messages are committed to the buffer they were allocated from, which is
+ * not the one of the current CPU if the thread migrated in between.
+ */
+static struct mpsc_pbuf_buffer *msg_log_buffer(const struct log_msg *msg)
+{
+	size_t cpu = ((const uint32_t *)msg - buf32) / CPU_BUFFER_WLEN;
+
+	return cpu_log_buffer(MIN(cpu, CONFIG_MP_MAX_NUM_CPUS - 1));
+}
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+#endif /* CONFIG_MPSC_PBUF */
 
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
@@ -649,7 +674,18 @@ bool z_log_dropped_pending(void)
 void z_log_msg_init(void)
 {
 #ifdef CONFIG_MPSC_PBUF
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = &buf32[cpu * CPU_BUFFER_WLEN];
+		config.size = CPU_BUFFER_WLEN;
+		mpsc_pbuf_init(cpu_log_buffer(cpu), &config);
+		cpu_log_msgs[cpu] = NULL;
+	}
+#else
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
+#endif
 	curr_log_buffer = &log_buffer;
 #endif
 }
@@ -669,7 +705,12 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	/* Migrating right after reading the CPU id only costs some contention. */
+	return msg_alloc(cpu_log_buffer(arch_curr_cpu()->id), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -701,12 +742,54 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	msg_commit(msg_log_buffer(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* Merge the buffers of all the CPUs by claiming the oldest message. */
+static union log_msg_generic *cpu_log_msg_claim(void)
+{
+	union log_msg_generic *msg = NULL;
+	log_timestamp_t t_min = 0;
+	unsigned int chosen = 0;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		log_timestamp_t t;
+
+		if (cpu_log_msgs[cpu] == NULL) {
+			cpu_log_msgs[cpu] =
+				(union log_msg_generic *)mpsc_pbuf_claim(cpu_log_buffer(cpu));
+			if (cpu_log_msgs[cpu] == NULL) {
+				continue;
+			}
+		}
+
+		t = log_msg_get_timestamp(&cpu_log_msgs[cpu]->log);
+		if (msg == NULL || t < t_min) {
+			t_min = t;
+			msg = cpu_log_msgs[cpu];
+			chosen = cpu;
+		}
+	}
+
+	if (msg != NULL) {
+		cpu_log_msgs[chosen] = NULL;
+		curr_log_buffer = cpu_log_buffer(chosen);
+	}
+
+	return msg;
+}
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+
 union log_msg_generic *z_log_msg_local_claim(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	return cpu_log_msg_claim();
+#elif defined(CONFIG_MPSC_PBUF)
 	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
 #else
 	return NULL;
@@ -823,6 +906,16 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if (cpu_log_msgs[cpu] != NULL || msg_pending(cpu_log_buffer(cpu))) {
+			return true;
+		}
+	}
+
+	return false;
+#endif
+
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
@@ -903,7 +996,20 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	*buf_size = 0;
+	*usage = 0;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		uint32_t size, now;
+
+		mpsc_pbuf_get_utilization(cpu_log_buffer(cpu), &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
+#else
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+#endif
 
 	return 0;
 }
@@ -916,7 +1022,25 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	*max = 0;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		uint32_t cpu_max;
+		int err;
+
+		err = mpsc_pbuf_get_max_utilization(cpu_log_buffer(cpu), &cpu_max);
+		if (err < 0) {
+			return err;
+		}
+
+		*max += cpu_max;
+	}
+
+	return 0;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
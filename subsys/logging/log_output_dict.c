@@ -5,28 +5,37 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
 
-void log_dict_output_msg_process(const struct log_output *output,
-				 struct log_msg *msg, uint32_t flags)
+static void normal_hdr_fill(struct log_dict_output_normal_msg_hdr_t *output_hdr,
+			    struct log_msg *msg)
 {
-	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
 	/* Keep sync with header in struct log_msg */
-	output_hdr.type = MSG_NORMAL;
-	output_hdr.domain = msg->hdr.desc.domain;
-	output_hdr.level = msg->hdr.desc.level;
-	output_hdr.package_len = msg->hdr.desc.package_len;
-	output_hdr.data_len = msg->hdr.desc.data_len;
-	output_hdr.timestamp = msg->hdr.timestamp;
+	output_hdr->type = MSG_NORMAL;
+	output_hdr->domain = msg->hdr.desc.domain;
+	output_hdr->level = msg->hdr.desc.level;
+	output_hdr->package_len = msg->hdr.desc.package_len;
+	output_hdr->data_len = msg->hdr.desc.data_len;
+	output_hdr->timestamp = msg->hdr.timestamp;
+
+	output_hdr->source = (source != NULL) ? log_source_id(source) : 0U;
+}
+
+void log_dict_output_msg_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags)
+{
+	struct log_dict_output_normal_msg_hdr_t output_hdr;
 
-	output_hdr.source = (source != NULL) ? log_source_id(source) : 0U;
+	normal_hdr_fill(&output_hdr, msg);
 
 	log_output_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
 			 (void *)output->control_block->ctx);
@@ -56,3 +65,67 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 	log_output_write(output->func, (uint8_t *)&msg, sizeof(msg),
 			 (void *)output->control_block->ctx);
 }
+
+/* Copy to the buffer of the output instance, flushing it when full. */
+static void buffer_write(const struct log_output *output, const void *data, size_t len)
+{
+	const uint8_t *src = data;
+
+	while (len > 0) {
+		size_t offset = output->control_block->offset;
+		size_t n = MIN(len, output->size - offset);
+
+		memcpy(&output->buf[offset], src, n);
+		output->control_block->offset = offset + n;
+		src += n;
+		len -= n;
+
+		if (output->control_block->offset == output->size) {
+			log_output_flush(output);
+		}
+	}
+}
+
+static void frame_hdr_write(const struct log_output *output, size_t len, uint32_t seq)
+{
+	struct log_dict_output_frame_hdr_t frame_hdr = {
+		.magic = sys_cpu_to_be16(LOG_DICT_OUTPUT_FRAME_MAGIC),
+		.version = LOG_DICT_OUTPUT_FRAME_VERSION,
+		.len = sys_cpu_to_be16(len),
+		.seq = sys_cpu_to_be32(seq),
+	};
+
+	buffer_write(output, &frame_hdr, sizeof(frame_hdr));
+}
+
+void log_dict_output_framed_msg_process(const struct log_output *output,
+					struct log_msg *msg, uint32_t seq)
+{
+	struct log_dict_output_normal_msg_hdr_t output_hdr;
+	size_t plen, dlen;
+	uint8_t *package = log_msg_get_package(msg, &plen);
+	uint8_t *data = log_msg_get_data(msg, &dlen);
+
+	normal_hdr_fill(&output_hdr, msg);
+
+	frame_hdr_write(output, sizeof(output_hdr) + plen + dlen, seq);
+	buffer_write(output, &output_hdr, sizeof(output_hdr));
+	buffer_write(output, package, plen);
+	buffer_write(output, data, dlen);
+
+	log_output_flush(output);
+}
+
+void log_dict_output_framed_dropped_process(const struct log_output *output, uint32_t cnt,
+					    uint32_t seq)
+{
+	struct log_dict_output_dropped_msg_t msg;
+
+	msg.type = MSG_DROPPED_MSG;
+	msg.num_dropped_messages = MIN(cnt, 9999);
+
+	frame_hdr_write(output, sizeof(msg), seq);
+	buffer_write(output, &msg, sizeof(msg));
+
+	log_output_flush(output);
+}
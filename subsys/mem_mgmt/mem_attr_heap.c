@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/mem_mgmt/mem_attr.h>
+#include <zephyr/mem_mgmt/mem_attr_heap.h>
 #include <zephyr/sys/multi_heap.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
@@ -15,6 +16,12 @@
 struct ma_heap {
 	struct sys_heap heap;
 	uint32_t attr;
+#ifdef CONFIG_MEM_ATTR_HEAP_AFFINITY
+	const struct mem_attr_region_t *region;
+	struct k_spinlock lock;
+	uint32_t cpu_mask;
+	struct mem_attr_heap_stats stats;
+#endif
 };
 
 struct {
@@ -23,6 +30,111 @@ struct {
 	int nheaps;
 } mah_data;
 
+#ifdef CONFIG_MEM_ATTR_HEAP_AFFINITY
+static void *ma_heap_alloc(struct ma_heap *h, size_t align, size_t size, bool local)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+	void *block = sys_heap_aligned_alloc(&h->heap, align, size);
+
+	if (block != NULL) {
+		if (local) {
+			h->stats.local_allocs++;
+		} else {
+			h->stats.remote_allocs++;
+		}
+	} else if (local) {
+		h->stats.local_misses++;
+	}
+
+	k_spin_unlock(&h->lock, key);
+
+	return block;
+}
+
+/*
+ * Prefer the heaps local to the current CPU, and only fall back to the
+ * other heaps with the requested attribute when all local ones are
+ * exhausted.  The current CPU is only a hint: the caller may migrate
+ * right after the allocation, which is harmless.
+ */
+static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align, size_t size)
+{
+	uint32_t cpu_bit = BIT(arch_curr_cpu()->id);
+	uint32_t attr;
+	void *block;
+
+	if (size == 0) {
+		return NULL;
+	}
+
+	attr = (uint32_t)(long) cfg;
+
+	/* Set in case the user requested a non-existing attr */
+	block = NULL;
+
+	for (int pass = 0; (pass < 2) && (block == NULL); pass++) {
+		bool local = (pass == 0);
+
+		for (size_t hdx = 0; hdx < mah_data.nheaps; hdx++) {
+			struct ma_heap *h;
+
+			h = &mah_data.ma_heaps[hdx];
+
+			if ((h->attr != attr) || (((h->cpu_mask & cpu_bit) != 0U) != local)) {
+				continue;
+			}
+
+			block = ma_heap_alloc(h, align, size, local);
+			if (block != NULL) {
+				break;
+			}
+		}
+	}
+
+	return block;
+}
+
+static struct ma_heap *ma_heap_find(const struct mem_attr_region_t *region)
+{
+	for (size_t hdx = 0; hdx < mah_data.nheaps; hdx++) {
+		if (mah_data.ma_heaps[hdx].region == region) {
+			return &mah_data.ma_heaps[hdx];
+		}
+	}
+
+	return NULL;
+}
+
+int mem_attr_heap_set_cpu_affinity(const struct mem_attr_region_t *region, uint32_t cpu_mask)
+{
+	struct ma_heap *h = ma_heap_find(region);
+
+	if (h == NULL) {
+		return -ENOENT;
+	}
+
+	h->cpu_mask = cpu_mask;
+
+	return 0;
+}
+
+int mem_attr_heap_get_stats(const struct mem_attr_region_t *region,
+			    struct mem_attr_heap_stats *stats)
+{
+	struct ma_heap *h = ma_heap_find(region);
+	k_spinlock_key_t key;
+
+	if (h == NULL) {
+		return -ENOENT;
+	}
+
+	key = k_spin_lock(&h->lock);
+	*stats = h->stats;
+	k_spin_unlock(&h->lock, key);
+
+	return 0;
+}
+#else
 static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align, size_t size)
 {
 	uint32_t attr;
@@ -54,10 +166,28 @@ static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align,
 
 	return block;
 }
+#endif /* CONFIG_MEM_ATTR_HEAP_AFFINITY */
 
 void mem_attr_heap_free(void *block)
 {
+#ifdef CONFIG_MEM_ATTR_HEAP_AFFINITY
+	const struct sys_multi_heap_rec *heap_rec;
+	struct ma_heap *h;
+	k_spinlock_key_t key;
+
+	heap_rec = sys_multi_heap_get_heap(&mah_data.multi_heap, block);
+	if (heap_rec == NULL) {
+		return;
+	}
+
+	h = CONTAINER_OF(heap_rec->heap, struct ma_heap, heap);
+
+	key = k_spin_lock(&h->lock);
+	sys_heap_free(&h->heap, block);
+	k_spin_unlock(&h->lock, key);
+#else
 	sys_multi_heap_free(&mah_data.multi_heap, block);
+#endif /* CONFIG_MEM_ATTR_HEAP_AFFINITY */
 }
 
 void *mem_attr_heap_alloc(uint32_t attr, size_t bytes)
@@ -95,6 +225,11 @@ static int ma_heap_add(const struct mem_attr_region_t *region, uint32_t attr)
 	h = &mh->heap;
 
 	mh->attr = attr;
+#ifdef CONFIG_MEM_ATTR_HEAP_AFFINITY
+	/* local to all CPUs until told otherwise */
+	mh->region = region;
+	mh->cpu_mask = UINT32_MAX;
+#endif
 
 	sys_heap_init(h, (void *) region->dt_addr, region->dt_size);
 	sys_multi_heap_add_heap(&mah_data.multi_heap, h, (void *) region);
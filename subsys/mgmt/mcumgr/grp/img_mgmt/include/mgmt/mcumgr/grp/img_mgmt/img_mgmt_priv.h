@@ -83,6 +83,55 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last);
 
+/**
+ * @brief Returns the size of the image being uploaded, as it will be stored in slot 1.
+ *
+ * This differs from the amount of uploaded data for delta uploads.
+ *
+ * @return Image size in bytes.
+ */
+static inline size_t img_mgmt_upload_image_size(void)
+{
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	if (g_img_mgmt_state.delta) {
+		return g_img_mgmt_state.delta_size;
+	}
+#endif
+
+	return g_img_mgmt_state.size;
+}
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+struct flash_img_context;
+
+/**
+ * @brief Reads the image size from the header of a delta patch.
+ *
+ * @param data		The start of the patch.
+ * @param len		The number of bytes available at @p data.
+ * @param size		On success, the size of the image the patch reconstructs.
+ *
+ * @return 0 on success, IMG_MGMT_ERR_[...] code on failure.
+ */
+int img_mgmt_delta_image_size(const void *data, size_t len, size_t *size);
+
+/**
+ * @brief Applies a chunk of a delta patch, writing the reconstructed image data.
+ *
+ * The patch applies to the image in g_img_mgmt_state.delta_base_area_id.
+ *
+ * @param ctx		The flash image context to write the image to.
+ * @param offset	The offset of the chunk within the patch.
+ * @param data		The patch data.
+ * @param num_bytes	The number of bytes of patch data.
+ * @param last		Whether this chunk is the end of the patch.
+ *
+ * @return 0 on success, IMG_MGMT_ERR_[...] code on failure.
+ */
+int img_mgmt_delta_write(struct flash_img_context *ctx, unsigned int offset, const void *data,
+			 unsigned int num_bytes, bool last);
+#endif
+
 /**
  * @brief Indicates the type of swap operation that will occur on the next
  * reboot, if any, between provided slot and it's pair.
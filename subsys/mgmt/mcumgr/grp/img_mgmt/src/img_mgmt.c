@@ -102,6 +102,18 @@ struct img_mgmt_state g_img_mgmt_state;
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/** Upload chunk received ahead of the expected offset. */
+struct img_mgmt_window_chunk {
+	size_t off;
+	/** Length of the image data; 0 if unused. */
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_window_chunk img_mgmt_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 const char *img_mgmt_err_str_app_reject = "app reject";
 const char *img_mgmt_err_str_hdr_malformed = "header malformed";
@@ -409,6 +421,9 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	memset(img_mgmt_window, 0, sizeof(img_mgmt_window));
+#endif
 	img_mgmt_release_lock();
 }
 
@@ -717,6 +732,115 @@ img_mgmt_upload_log(bool is_first, bool is_last, int status)
 	return 0;
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/**
+ * Holds an upload chunk which is ahead of the expected offset, so that it does not need to be
+ * resent once the data before it arrives. Chunks which cannot be held are silently dropped,
+ * the response tells the client which offset is expected next.
+ *
+ * @param req		The upload request holding the chunk.
+ * @param action	The action determined for the request.
+ */
+static void
+img_mgmt_window_store(struct img_mgmt_upload_req *req, const struct img_mgmt_upload_action *action)
+{
+	struct img_mgmt_window_chunk *chunk = NULL;
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_CHECK_HOOK)
+	struct img_mgmt_upload_action chunk_action = *action;
+	struct img_mgmt_upload_check upload_check_data = {
+		.action = &chunk_action,
+		.req = req,
+	};
+	int32_t err_rc;
+	uint16_t err_group;
+#endif
+
+	if (g_img_mgmt_state.area_id == -1 || req->off <= g_img_mgmt_state.off ||
+	    req->img_data.len == 0 || req->img_data.len > sizeof(chunk->data) ||
+	    (req->off + req->img_data.len) > g_img_mgmt_state.size) {
+		return;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		if (img_mgmt_window[i].len == 0) {
+			if (chunk == NULL) {
+				chunk = &img_mgmt_window[i];
+			}
+		} else if (img_mgmt_window[i].off == req->off) {
+			/* Already held */
+			return;
+		}
+	}
+
+	if (chunk == NULL) {
+		return;
+	}
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_CHECK_HOOK)
+	chunk_action.write_bytes = req->img_data.len;
+	chunk_action.proceed = true;
+
+	if (mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_CHUNK, &upload_check_data,
+				 sizeof(upload_check_data), &err_rc, &err_group) != MGMT_CB_OK) {
+		return;
+	}
+#endif
+
+	chunk->off = req->off;
+	chunk->len = req->img_data.len;
+	memcpy(chunk->data, req->img_data.value, req->img_data.len);
+}
+
+/**
+ * Writes the held chunks which continue the image data written so far.
+ *
+ * @param last	Set to true if the last chunk of the image was written.
+ *
+ * @return 0 on success; nonzero on failure.
+ */
+static int
+img_mgmt_window_flush(bool *last)
+{
+	bool written;
+	int rc;
+
+	do {
+		written = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+			struct img_mgmt_window_chunk *chunk = &img_mgmt_window[i];
+
+			if (chunk->len == 0) {
+				continue;
+			}
+
+			if (chunk->off < g_img_mgmt_state.off) {
+				/* Overtaken by a resent chunk */
+				chunk->len = 0;
+				continue;
+			}
+
+			if (chunk->off != g_img_mgmt_state.off) {
+				continue;
+			}
+
+			*last = (chunk->off + chunk->len) == g_img_mgmt_state.size;
+			rc = img_mgmt_write_image_data(chunk->off, chunk->data, chunk->len, *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += chunk->len;
+			chunk->len = 0;
+			written = true;
+		}
+	} while (written);
+
+	return 0;
+}
+#endif
+
 /**
  * Command handler: image upload
  */
@@ -761,7 +885,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		ZCBOR_MAP_DECODE_KEY_DECODER("len", zcbor_size_decode, &req.size),
 		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &req.off),
 		ZCBOR_MAP_DECODE_KEY_DECODER("sha", zcbor_bstr_decode, &req.data_sha),
-		ZCBOR_MAP_DECODE_KEY_DECODER("upgrade", zcbor_bool_decode, &req.upgrade)
+		ZCBOR_MAP_DECODE_KEY_DECODER("upgrade", zcbor_bool_decode, &req.upgrade),
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+		ZCBOR_MAP_DECODE_KEY_DECODER("delta", zcbor_bool_decode, &req.delta),
+#endif
 	};
 
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
@@ -807,6 +934,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		img_mgmt_window_store(&req, &action);
+#endif
 		rc = img_mgmt_upload_good_rsp(ctxt);
 		img_mgmt_release_lock();
 		return rc;
@@ -848,6 +978,18 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 		g_img_mgmt_state.off = 0;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		memset(img_mgmt_window, 0, sizeof(img_mgmt_window));
+#endif
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+		g_img_mgmt_state.delta = req.delta;
+
+		if (req.delta) {
+			g_img_mgmt_state.delta_size = action.delta_size;
+			g_img_mgmt_state.delta_base_area_id =
+				img_mgmt_flash_area_id(img_mgmt_active_slot(req.image));
+		}
+#endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
@@ -876,7 +1018,7 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		 */
 		if (g_img_mgmt_state.data_sha_len == IMG_MGMT_DATA_SHA_LEN) {
 			fic.match = g_img_mgmt_state.data_sha;
-			fic.clen = g_img_mgmt_state.size;
+			fic.clen = img_mgmt_upload_image_size();
 
 			if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
 				/* Underlying data already matches, no need to upload any more,
@@ -899,7 +1041,7 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #ifndef CONFIG_IMG_ERASE_PROGRESSIVELY
 		/* erase the entire req.size all at once */
 		if (action.erase) {
-			rc = img_mgmt_erase_image_data(0, req.size);
+			rc = img_mgmt_erase_image_data(0, img_mgmt_upload_image_size());
 			if (rc != 0) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(&action,
 					img_mgmt_err_str_flash_erase_failed);
@@ -925,7 +1067,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+			rc = img_mgmt_window_flush(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -953,7 +1100,7 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
 				struct flash_img_check fic = {
 					.match = g_img_mgmt_state.data_sha,
-					.clen = g_img_mgmt_state.size,
+					.clen = img_mgmt_upload_image_size(),
 				};
 
 				if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
@@ -0,0 +1,255 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/dfu/flash_img.h>
+
+#include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt.h>
+
+#include <mgmt/mcumgr/grp/img_mgmt/img_mgmt_priv.h>
+
+LOG_MODULE_DECLARE(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
+
+/* "DELT", followed by the little endian size of the reconstructed image */
+#define DELTA_MAGIC		0x544c4544
+#define DELTA_HEADER_SIZE	8
+
+/* Record header: opcode, little endian length and base image offset */
+#define DELTA_RECORD_SIZE	9
+
+#define DELTA_OP_COPY		'C'
+#define DELTA_OP_ADD		'A'
+#define DELTA_OP_INSERT		'I'
+
+enum delta_state {
+	DELTA_STATE_HEADER,
+	DELTA_STATE_RECORD,
+	DELTA_STATE_DATA,
+};
+
+static struct {
+	const struct flash_area *base;
+	enum delta_state state;
+	/* Patch or record header being received */
+	uint8_t hdr[MAX(DELTA_HEADER_SIZE, DELTA_RECORD_SIZE)];
+	size_t hdr_len;
+	uint8_t op;
+	size_t remaining;
+	size_t base_off;
+	size_t written;
+	size_t size;
+	uint8_t buf[CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD_BUF_SIZE];
+} delta;
+
+int img_mgmt_delta_image_size(const void *data, size_t len, size_t *size)
+{
+	if (len < DELTA_HEADER_SIZE || sys_get_le32(data) != DELTA_MAGIC) {
+		return IMG_MGMT_ERR_INVALID_IMAGE_HEADER_MAGIC;
+	}
+
+	*size = sys_get_le32((const uint8_t *)data + sizeof(uint32_t));
+
+	return IMG_MGMT_ERR_OK;
+}
+
+static int delta_output(struct flash_img_context *ctx, const uint8_t *data, size_t len)
+{
+	if (len > delta.size - delta.written) {
+		LOG_ERR("Patch output overruns image size %zu", delta.size);
+		return IMG_MGMT_ERR_INVALID_IMAGE_DATA_OVERRUN;
+	}
+
+	if (flash_img_buffered_write(ctx, data, len, false) != 0) {
+		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
+	}
+
+	delta.written += len;
+
+	return IMG_MGMT_ERR_OK;
+}
+
+static int delta_read_base(size_t len)
+{
+	if (len > delta.base->fa_size || delta.base_off > delta.base->fa_size - len) {
+		LOG_ERR("Patch reads beyond base image: %zu + %zu", delta.base_off, len);
+		return IMG_MGMT_ERR_INVALID_IMAGE_DATA_OVERRUN;
+	}
+
+	if (flash_area_read(delta.base, delta.base_off, delta.buf, len) != 0) {
+		return IMG_MGMT_ERR_FLASH_READ_FAILED;
+	}
+
+	delta.base_off += len;
+
+	return IMG_MGMT_ERR_OK;
+}
+
+/* Copies base image data; it does not consume patch data */
+static int delta_copy(struct flash_img_context *ctx)
+{
+	int rc = IMG_MGMT_ERR_OK;
+
+	while (delta.remaining > 0 && rc == IMG_MGMT_ERR_OK) {
+		size_t len = MIN(delta.remaining, sizeof(delta.buf));
+
+		rc = delta_read_base(len);
+		if (rc == IMG_MGMT_ERR_OK) {
+			rc = delta_output(ctx, delta.buf, len);
+		}
+
+		delta.remaining -= len;
+	}
+
+	return rc;
+}
+
+/* Returns the number of patch bytes consumed, or a negated IMG_MGMT_ERR_[...] code */
+static int delta_data(struct flash_img_context *ctx, const uint8_t *data, size_t len)
+{
+	int rc;
+
+	len = MIN(len, MIN(delta.remaining, sizeof(delta.buf)));
+
+	if (delta.op == DELTA_OP_ADD) {
+		rc = delta_read_base(len);
+		if (rc != IMG_MGMT_ERR_OK) {
+			return -rc;
+		}
+
+		for (size_t i = 0; i < len; i++) {
+			delta.buf[i] += data[i];
+		}
+
+		data = delta.buf;
+	}
+
+	rc = delta_output(ctx, data, len);
+	if (rc != IMG_MGMT_ERR_OK) {
+		return -rc;
+	}
+
+	delta.remaining -= len;
+
+	return len;
+}
+
+static int delta_record(struct flash_img_context *ctx)
+{
+	delta.op = delta.hdr[0];
+	delta.remaining = sys_get_le32(&delta.hdr[1]);
+	delta.base_off = sys_get_le32(&delta.hdr[5]);
+
+	switch (delta.op) {
+	case DELTA_OP_COPY:
+		delta.state = DELTA_STATE_RECORD;
+		return delta_copy(ctx);
+	case DELTA_OP_ADD:
+	case DELTA_OP_INSERT:
+		delta.state = (delta.remaining > 0) ? DELTA_STATE_DATA : DELTA_STATE_RECORD;
+		return IMG_MGMT_ERR_OK;
+	default:
+		LOG_ERR("Invalid patch record: %02x", delta.op);
+		return IMG_MGMT_ERR_INVALID_IMAGE_HEADER;
+	}
+}
+
+static int delta_finish(struct flash_img_context *ctx)
+{
+	if (delta.state != DELTA_STATE_RECORD || delta.hdr_len != 0 ||
+	    delta.written != delta.size) {
+		LOG_ERR("Patch ended early: %zu of %zu bytes reconstructed", delta.written,
+			delta.size);
+		return IMG_MGMT_ERR_INVALID_LENGTH;
+	}
+
+	if (flash_img_buffered_write(ctx, delta.buf, 0, true) != 0) {
+		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
+	}
+
+	return IMG_MGMT_ERR_OK;
+}
+
+int img_mgmt_delta_write(struct flash_img_context *ctx, unsigned int offset, const void *data,
+			 unsigned int num_bytes, bool last)
+{
+	const uint8_t *pos = data;
+	int rc = IMG_MGMT_ERR_OK;
+
+	if (offset == 0) {
+		if (delta.base != NULL) {
+			flash_area_close(delta.base);
+		}
+
+		memset(&delta, 0, sizeof(delta));
+		delta.size = g_img_mgmt_state.delta_size;
+
+		if (flash_area_open(g_img_mgmt_state.delta_base_area_id, &delta.base) != 0) {
+			delta.base = NULL;
+			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+		}
+	}
+
+	if (delta.base == NULL) {
+		return IMG_MGMT_ERR_FLASH_CONTEXT_NOT_SET;
+	}
+
+	while (num_bytes > 0 && rc == IMG_MGMT_ERR_OK) {
+		size_t need;
+		size_t len;
+
+		if (delta.state == DELTA_STATE_DATA) {
+			int used = delta_data(ctx, pos, num_bytes);
+
+			if (used < 0) {
+				rc = -used;
+				break;
+			}
+
+			if (delta.remaining == 0) {
+				delta.state = DELTA_STATE_RECORD;
+			}
+
+			pos += used;
+			num_bytes -= used;
+			continue;
+		}
+
+		/* Headers may be split across chunks */
+		need = (delta.state == DELTA_STATE_HEADER) ? DELTA_HEADER_SIZE : DELTA_RECORD_SIZE;
+		len = MIN(num_bytes, need - delta.hdr_len);
+		memcpy(&delta.hdr[delta.hdr_len], pos, len);
+		delta.hdr_len += len;
+		pos += len;
+		num_bytes -= len;
+
+		if (delta.hdr_len < need) {
+			continue;
+		}
+
+		delta.hdr_len = 0;
+
+		if (delta.state == DELTA_STATE_HEADER) {
+			delta.state = DELTA_STATE_RECORD;
+		} else {
+			rc = delta_record(ctx);
+		}
+	}
+
+	if (rc == IMG_MGMT_ERR_OK && last) {
+		rc = delta_finish(ctx);
+	}
+
+	if (rc != IMG_MGMT_ERR_OK || last) {
+		flash_area_close(delta.base);
+		delta.base = NULL;
+	}
+
+	return rc;
+}
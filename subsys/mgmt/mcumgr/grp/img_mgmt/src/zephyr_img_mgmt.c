@@ -406,6 +406,13 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		}
 	}
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	if (g_img_mgmt_state.delta) {
+		rc = img_mgmt_delta_write(ctx, offset, data, num_bytes, last);
+		goto out;
+	}
+#endif
+
 	if (flash_img_buffered_write(ctx, data, num_bytes, last) != 0) {
 		rc = IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 		goto out;
@@ -431,6 +438,12 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		}
 	}
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+	if (g_img_mgmt_state.delta) {
+		return img_mgmt_delta_write(&ctx, offset, data, num_bytes, last);
+	}
+#endif
+
 	if (flash_img_buffered_write(&ctx, data, num_bytes, last) != 0) {
 		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 	}
@@ -558,6 +571,7 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 {
 	const struct image_header *hdr;
 	struct image_version cur_ver;
+	size_t image_size;
 	int rc;
 
 	memset(action, 0, sizeof(*action));
@@ -604,9 +618,35 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		}
 
 		action->size = req->size;
+		image_size = req->size;
 
 		hdr = (struct image_header *)req->img_data.value;
-		if (hdr->ih_magic != IMAGE_MAGIC) {
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_DELTA_UPLOAD)
+		if (req->delta) {
+			/* The image header is only known once the patch has been applied */
+			rc = img_mgmt_delta_image_size(req->img_data.value, req->img_data.len,
+						       &action->delta_size);
+			if (rc != IMG_MGMT_ERR_OK) {
+				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+					img_mgmt_err_str_magic_mismatch);
+				LOG_DBG("Invalid patch header");
+				return rc;
+			}
+
+			if (req->upgrade) {
+				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+					img_mgmt_err_str_hdr_malformed);
+				LOG_DBG("Upgrade-only check is not possible for a patch");
+				return IMG_MGMT_ERR_VERSION_GET_FAILED;
+			}
+
+			image_size = action->delta_size;
+			hdr = NULL;
+		}
+#endif
+
+		if (hdr != NULL && hdr->ih_magic != IMAGE_MAGIC) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_magic_mismatch);
 			LOG_DBG("Magic mismatch: %08X != %08X", hdr->ih_magic, IMAGE_MAGIC);
 			return IMG_MGMT_ERR_INVALID_IMAGE_HEADER_MAGIC;
@@ -648,11 +688,11 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		}
 
 		/* Check that the area is of sufficient size to store the new image */
-		if (req->size > fa->fa_size) {
+		if (image_size > fa->fa_size) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
-			LOG_DBG("Upload too large for slot: %u > %u", req->size,
+			LOG_DBG("Upload too large for slot: %u > %u", image_size,
 				fa->fa_size);
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
@@ -701,11 +741,11 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 			goto skip_size_check;
 		}
 
-		if (req->size > (fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE)) {
+		if (image_size > (fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE)) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
-			LOG_DBG("Upload too large for slot (with end offset): %u > %u", req->size,
+			LOG_DBG("Upload too large for slot (with end offset): %u > %u", image_size,
 				(fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE));
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
@@ -716,18 +756,18 @@ skip_size_check:
 				   sizeof(max_image_size));
 
 		if (rc == sizeof(max_image_size) && max_image_size > 0 &&
-		    req->size > max_image_size) {
+		    image_size > max_image_size) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
 			LOG_DBG("Upload too large for slot (with max image size): %u > %u",
-				req->size, max_image_size);
+				image_size, max_image_size);
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
 #endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_REJECT_DIRECT_XIP_MISMATCHED_SLOT)
-		if (hdr->ih_flags & IMAGE_F_ROM_FIXED) {
+		if (hdr != NULL && (hdr->ih_flags & IMAGE_F_ROM_FIXED)) {
 			if (fa->fa_off != hdr->ih_load_addr) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 					img_mgmt_err_str_image_bad_flash_addr);
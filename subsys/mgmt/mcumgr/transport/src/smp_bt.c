@@ -94,6 +94,7 @@ BUILD_ASSERT(sizeof(struct smp_bt_user_data) <= CONFIG_MCUMGR_TRANSPORT_NETBUF_U
 
 enum {
 	CONN_PARAM_SMP_REQUESTED = BIT(0),
+	CONN_PARAM_LINK_REQUESTED = BIT(1),
 };
 
 struct conn_param_data {
@@ -224,6 +225,26 @@ static void conn_param_on_error_retry(struct k_work *work)
 	conn_param_set(cpd->conn, param);
 }
 
+/* Requests a faster link for SMP packet exchange, kept until the connection is terminated. */
+static void conn_link_update(struct bt_conn *conn)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_MCUMGR_TRANSPORT_BT_CONN_PARAM_CONTROL_DATA_LEN)) {
+		ret = bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX);
+		if (ret && (ret != -EALREADY)) {
+			LOG_DBG("Data length update failed: %d", ret);
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_MCUMGR_TRANSPORT_BT_CONN_PARAM_CONTROL_PHY_2M)) {
+		ret = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+		if (ret && (ret != -EALREADY)) {
+			LOG_DBG("PHY update failed: %d", ret);
+		}
+	}
+}
+
 static void conn_param_smp_enable(struct bt_conn *conn)
 {
 	struct conn_param_data *cpd = conn_param_data_get(conn);
@@ -234,6 +255,11 @@ static void conn_param_smp_enable(struct bt_conn *conn)
 			cpd->state |= CONN_PARAM_SMP_REQUESTED;
 		}
 
+		if (!(cpd->state & CONN_PARAM_LINK_REQUESTED)) {
+			conn_link_update(conn);
+			cpd->state |= CONN_PARAM_LINK_REQUESTED;
+		}
+
 		/* SMP characteristic in use; refresh the restore timeout. */
 		(void)k_work_reschedule(&cpd->dwork, K_MSEC(RESTORE_TIME));
 	}
@@ -457,6 +483,7 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 		.data = nb->data,
 	};
 	bool sent = false;
+	uint8_t pending = 0;
 	struct bt_conn_info info;
 	struct conn_param_data *cpd;
 	struct smp_bt_user_data *ud;
@@ -513,6 +540,15 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 			goto cleanup;
 		}
 
+		if (pending == CONFIG_MCUMGR_TRANSPORT_BT_NOTIFY_MAX_PENDING) {
+			/* Wait for the completion (or disconnect) semaphore before
+			 * continuing, allowing other parts of the system to run.
+			 */
+			k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
+			--pending;
+			continue;
+		}
+
 		if ((off + mtu_size) > nb->len) {
 			/* Final packet, limit size */
 			mtu_size = nb->len - off;
@@ -543,16 +579,18 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 			 * available
 			 */
 			rc = MGMT_ERR_EOK;
-			k_yield();
+
+			if (pending > 0) {
+				k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
+				--pending;
+			} else {
+				k_yield();
+			}
 		} else if (rc == 0) {
 			off += mtu_size;
 			notify_param.data = &nb->data[off];
 			sent = true;
-
-			/* Wait for the completion (or disconnect) semaphore before
-			 * continuing, allowing other parts of the system to run.
-			 */
-			k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
+			++pending;
 		} else {
 			/* No connection, cannot continue */
 			rc = MGMT_ERR_EUNKNOWN;
@@ -560,6 +598,12 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 		}
 	}
 
+	/* Wait for the queued notifications to be sent (or disconnect) */
+	while (pending > 0 && cpd->id != 0 && cpd->id == ud->id) {
+		k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
+		--pending;
+	}
+
 cleanup:
 	smp_bt_ud_free(net_buf_user_data(nb));
 	smp_packet_free(nb);
@@ -660,7 +704,8 @@ static void smp_bt_setup(void)
 	}
 
 	while (i < CONFIG_BT_MAX_CONN) {
-		k_sem_init(&conn_data[i].smp_notify_sem, 0, 1);
+		k_sem_init(&conn_data[i].smp_notify_sem, 0,
+			   CONFIG_MCUMGR_TRANSPORT_BT_NOTIFY_MAX_PENDING);
 		++i;
 	}
 
@@ -67,6 +67,14 @@ static void modem_chat_log_received_command(struct modem_chat *chat)
 
 #endif
 
+static void modem_chat_set_matches(struct modem_chat *chat, uint16_t index,
+				   const struct modem_chat_match *matches, uint16_t matches_size)
+{
+	chat->matches[index] = matches;
+	chat->matches_size[index] = matches_size;
+	chat->matches_max_size_valid = false;
+}
+
 static void modem_chat_script_stop(struct modem_chat *chat, enum modem_chat_script_result result)
 {
 	if ((chat == NULL) || (chat->script == NULL)) {
@@ -99,10 +107,8 @@ static void modem_chat_script_stop(struct modem_chat *chat, enum modem_chat_scri
 	chat->script = NULL;
 
 	/* Clear response and abort commands */
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_ABORT] = NULL;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_ABORT] = 0;
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = NULL;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = 0;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_ABORT, NULL, 0);
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_RESPONSE, NULL, 0);
 
 	/* Cancel work */
 	k_work_cancel_delayable(&chat->script_timeout_work);
@@ -137,14 +143,13 @@ static void modem_chat_script_set_response_matches(struct modem_chat *chat)
 	const struct modem_chat_script_chat *script_chat =
 		&chat->script->script_chats[chat->script_chat_it];
 
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = script_chat->response_matches;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = script_chat->response_matches_size;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_RESPONSE,
+			       script_chat->response_matches, script_chat->response_matches_size);
 }
 
 static void modem_chat_script_clear_response_matches(struct modem_chat *chat)
 {
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = NULL;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = 0;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_RESPONSE, NULL, 0);
 }
 
 static bool modem_chat_script_chat_has_request(struct modem_chat *chat)
@@ -225,8 +230,8 @@ static void modem_chat_script_start(struct modem_chat *chat, const struct modem_
 	chat->script = script;
 
 	/* Set abort matches */
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_ABORT] = script->abort_matches;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_ABORT] = script->abort_matches_size;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_ABORT, script->abort_matches,
+			       script->abort_matches_size);
 
 	LOG_DBG("running script: %s", chat->script->name);
 
@@ -387,6 +392,9 @@ static void modem_chat_parse_reset(struct modem_chat *chat)
 	chat->delimiter_match_len = 0;
 	chat->argc = 0;
 	chat->parse_match = NULL;
+
+	/* Matches may have been modified since the previous line */
+	chat->matches_max_size_valid = false;
 }
 
 /* Exact match is stored at end of receive buffer */
@@ -428,10 +436,33 @@ static bool modem_chat_match_matches_received(struct modem_chat *chat,
 	return true;
 }
 
+static void modem_chat_parse_update_matches_max_size(struct modem_chat *chat)
+{
+	for (uint16_t i = 0; i < ARRAY_SIZE(chat->matches); i++) {
+		chat->matches_max_size[i] = 0;
+
+		for (uint16_t u = 0; u < chat->matches_size[i]; u++) {
+			chat->matches_max_size[i] = MAX(chat->matches_max_size[i],
+							chat->matches[i][u].match_size);
+		}
+	}
+
+	chat->matches_max_size_valid = true;
+}
+
 static bool modem_chat_parse_find_match(struct modem_chat *chat)
 {
+	if (!chat->matches_max_size_valid) {
+		modem_chat_parse_update_matches_max_size(chat);
+	}
+
 	/* Find in all matches types */
 	for (uint16_t i = 0; i < ARRAY_SIZE(chat->matches); i++) {
+		/* Skip matches type if received data is longer than all its matches */
+		if (chat->receive_buf_len > chat->matches_max_size[i]) {
+			continue;
+		}
+
 		/* Find in all matches of matches type */
 		for (uint16_t u = 0; u < chat->matches_size[i]; u++) {
 			/* Validate match size matches received data length */
@@ -818,8 +849,8 @@ int modem_chat_init(struct modem_chat *chat, const struct modem_chat_config *con
 	chat->delimiter_size = config->delimiter_size;
 	chat->filter = config->filter;
 	chat->filter_size = config->filter_size;
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_UNSOL] = config->unsol_matches;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_UNSOL] = config->unsol_matches_size;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_UNSOL, config->unsol_matches,
+			       config->unsol_matches_size);
 	atomic_set(&chat->script_state, 0);
 	k_sem_init(&chat->script_stopped_sem, 0, 1);
 	k_work_init(&chat->receive_work, modem_chat_process_handler);
@@ -940,10 +971,8 @@ void modem_chat_release(struct modem_chat *chat)
 	chat->parse_match = NULL;
 	chat->parse_match_len = 0;
 	chat->parse_arg_len = 0;
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_ABORT] = NULL;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_ABORT] = 0;
-	chat->matches[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = NULL;
-	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_RESPONSE] = 0;
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_ABORT, NULL, 0);
+	modem_chat_set_matches(chat, MODEM_CHAT_MATCHES_INDEX_RESPONSE, NULL, 0);
 }
 
 void modem_chat_match_init(struct modem_chat_match *chat_match)
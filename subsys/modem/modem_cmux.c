@@ -1208,6 +1208,62 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/* Consumes a run of bytes in states which do not need per byte processing */
+static size_t modem_cmux_process_received_run(struct modem_cmux *cmux, const uint8_t *data,
+					      size_t len)
+{
+	const uint8_t *sof;
+	size_t copy;
+	size_t run;
+
+	switch (cmux->receive_state) {
+	case MODEM_CMUX_RECEIVE_STATE_SOF:
+		/* Skip everything up to the next flag */
+		sof = memchr(data, MODEM_CMUX_SOF, len);
+		return (sof == NULL) ? len : (size_t)(sof - data);
+
+	case MODEM_CMUX_RECEIVE_STATE_DATA:
+		run = MIN(len, cmux->frame.data_len - cmux->receive_buf_len);
+
+		/* Bytes beyond the receive buffer are counted but dropped, the
+		 * overrun is reported once the FCS is received.
+		 */
+		if (cmux->receive_buf_len < cmux->receive_buf_size) {
+			copy = MIN(run, cmux->receive_buf_size - cmux->receive_buf_len);
+			memcpy(&cmux->receive_buf[cmux->receive_buf_len], data, copy);
+		}
+
+		cmux->receive_buf_len += run;
+
+		if (cmux->frame.data_len == cmux->receive_buf_len) {
+			/* Await FCS */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+		}
+
+		return run;
+
+	default:
+		return 0;
+	}
+}
+
+static void modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					     size_t len)
+{
+	size_t run;
+
+	while (len > 0) {
+		run = modem_cmux_process_received_run(cmux, data, len);
+		if (run == 0) {
+			modem_cmux_process_received_byte(cmux, *data);
+			run = 1;
+		}
+
+		data += run;
+		len -= run;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -1224,9 +1280,7 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
-	}
+	modem_cmux_process_received_data(cmux, cmux->work_buf, ret);
 
 	/* Reschedule received work */
 	modem_work_schedule(&cmux->receive_work, K_NO_WAIT);
@@ -201,6 +201,17 @@ static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 	return false;
 }
 
+static void modem_ppp_drop_rx_pkt(struct modem_ppp *ppp)
+{
+	LOG_WRN("Dropped PPP frame");
+	net_pkt_unref(ppp->rx_pkt);
+	ppp->rx_pkt = NULL;
+	ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+	ppp->stats.drop++;
+#endif
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -285,26 +296,14 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 		}
 
 		if (net_pkt_write_u8(ppp->rx_pkt, byte) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 		}
 
 		break;
 
 	case MODEM_PPP_RECEIVE_STATE_UNESCAPING:
 		if (net_pkt_write_u8(ppp->rx_pkt, (byte ^ MODEM_PPP_VALUE_ESCAPE)) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 			break;
 		}
 
@@ -313,6 +312,58 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/*
+ * Writes a run of frame bytes which need no unescaping in one go, returns the
+ * number of bytes consumed. Delimiters, escapes and buffer allocation are left
+ * to modem_ppp_process_received_byte().
+ */
+static size_t modem_ppp_process_received_run(struct modem_ppp *ppp, const uint8_t *data,
+					     size_t len)
+{
+	size_t available;
+	size_t run;
+
+	if (ppp->receive_state != MODEM_PPP_RECEIVE_STATE_WRITING) {
+		return 0;
+	}
+
+	available = net_pkt_available_buffer(ppp->rx_pkt);
+	if (available <= 1) {
+		return 0;
+	}
+
+	len = MIN(len, available - 1);
+
+	for (run = 0; run < len; run++) {
+		if (data[run] == MODEM_PPP_CODE_DELIMITER || data[run] == MODEM_PPP_CODE_ESCAPE) {
+			break;
+		}
+	}
+
+	if (run > 0 && net_pkt_write(ppp->rx_pkt, data, run) < 0) {
+		modem_ppp_drop_rx_pkt(ppp);
+	}
+
+	return run;
+}
+
+static void modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					    size_t len)
+{
+	size_t run;
+
+	while (len > 0) {
+		run = modem_ppp_process_received_run(ppp, data, len);
+		if (run == 0) {
+			modem_ppp_process_received_byte(ppp, *data);
+			run = 1;
+		}
+
+		data += run;
+		len -= run;
+	}
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -424,9 +475,7 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
-	}
+	modem_ppp_process_received_data(ppp, ppp->receive_buf, ret);
 
 	modem_work_submit(&ppp->process_work);
 }
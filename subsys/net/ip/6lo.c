@@ -1381,7 +1381,13 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		return false;
 	}
 
-	if (net_buf_tailroom(pkt->buffer) >= diff) {
+	if (net_buf_headroom(pkt->buffer) >= diff) {
+		/* Typically left by the link layer and fragment headers */
+		NET_DBG("Enough headroom. Uncompress inplace");
+		frag = pkt->buffer;
+		net_buf_push(frag, diff);
+		cursor = frag->data + diff;
+	} else if (net_buf_tailroom(pkt->buffer) >= diff) {
 		NET_DBG("Enough tailroom. Uncompress inplace");
 		frag = pkt->buffer;
 		net_buf_add(frag, diff);
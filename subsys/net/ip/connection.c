@@ -61,6 +61,20 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+/* Used connections are also put in exactly one of the lookup lists below,
+ * so that an incoming TCP or UDP packet only needs to be checked against
+ * one bucket of conn_connected (local and remote ports and remote address
+ * specified), one bucket of conn_bound (local port specified) and against
+ * conn_wildcard (every other connection).
+ */
+static sys_slist_t conn_connected[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_bound[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_wildcard;
+
+#define NET_CONN_CONNECTED_SPEC (NET_CONN_LOCAL_PORT_SPEC |	\
+				 NET_CONN_REMOTE_PORT_SPEC |	\
+				 NET_CONN_REMOTE_ADDR_SPEC)
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -113,6 +127,103 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+/* FNV-1a, ports are hashed in network byte order */
+static uint32_t conn_hash(uint32_t hash, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static sys_slist_t *conn_bound_bucket(uint16_t proto, uint16_t local_port)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = conn_hash(hash, &proto, sizeof(proto));
+	hash = conn_hash(hash, &local_port, sizeof(local_port));
+
+	return &conn_bound[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+static sys_slist_t *conn_connected_bucket(uint16_t proto, uint16_t local_port,
+					  uint16_t remote_port,
+					  const uint8_t *remote_addr,
+					  size_t addr_len)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = conn_hash(hash, &proto, sizeof(proto));
+	hash = conn_hash(hash, &local_port, sizeof(local_port));
+	hash = conn_hash(hash, &remote_port, sizeof(remote_port));
+	hash = conn_hash(hash, remote_addr, addr_len);
+
+	return &conn_connected[hash % CONFIG_NET_CONN_HASH_BUCKETS];
+}
+
+/* Lookup list of a connection, depends on its current flags and addresses */
+static sys_slist_t *conn_lookup_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+
+	if (!(conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return &conn_wildcard;
+	}
+
+	if ((conn->flags & NET_CONN_CONNECTED_SPEC) == NET_CONN_CONNECTED_SPEC) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    conn->remote_addr.sa_family == AF_INET6) {
+			return conn_connected_bucket(
+				conn->proto, local_port, remote_port,
+				net_sin6(&conn->remote_addr)->sin6_addr.s6_addr,
+				sizeof(struct in6_addr));
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+			   conn->remote_addr.sa_family == AF_INET) {
+			return conn_connected_bucket(
+				conn->proto, local_port, remote_port,
+				net_sin(&conn->remote_addr)->sin_addr.s4_addr,
+				sizeof(struct in_addr));
+		}
+	}
+
+	return conn_bound_bucket(conn->proto, local_port);
+}
+
+/* Bucket of the connected connections that could match an IP packet */
+static sys_slist_t *conn_pkt_connected_bucket(struct net_pkt *pkt,
+					      union net_ip_header *ip_hdr,
+					      uint16_t proto,
+					      uint16_t src_port,
+					      uint16_t dst_port)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		return conn_connected_bucket(proto, dst_port, src_port,
+					     ip_hdr->ipv6->src,
+					     sizeof(struct in6_addr));
+	}
+
+	return conn_connected_bucket(proto, dst_port, src_port,
+				     ip_hdr->ipv4->src, sizeof(struct in_addr));
+}
+
+/* Must be called with conn_lock held */
+static void conn_lookup_add(struct net_conn *conn)
+{
+	sys_slist_prepend(conn_lookup_list(conn), &conn->hash_node);
+}
+
+/* Must be called with conn_lock held, before the flags or addresses
+ * of the connection are changed.
+ */
+static void conn_lookup_remove(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn_lookup_list(conn), &conn->hash_node);
+}
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +249,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_lookup_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -463,6 +575,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_lookup_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,14 +602,21 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	/* The lookup list depends on the addresses and ports */
+	conn_lookup_remove(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_lookup_add(conn);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -907,117 +1027,135 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		is_mcast_pkt = net_ipv6_is_addr_mcast_raw(ip_hdr->ipv6->dst);
 	}
 
-	k_mutex_lock(&conn_lock, K_FOREVER);
+	/* Only these lists can hold connections matching the packet, and as
+	 * connections in different lists have different ranks, going through
+	 * them one after the other gives the same result as going through
+	 * conn_used.
+	 */
+	sys_slist_t *lists[] = {
+		conn_pkt_connected_bucket(pkt, ip_hdr, proto, src_port, dst_port),
+		conn_bound_bucket(proto, dst_port),
+		&conn_wildcard,
+	};
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
+	k_mutex_lock(&conn_lock, K_FOREVER);
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			/* Is the candidate connection matching the packet's interface? */
+			if (!is_iface_matching(conn, pkt)) {
+				continue; /* wrong interface */
 			}
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
-
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
-
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
-			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
+			/* Is the candidate connection matching the packet's protocol family? */
+			if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+					      !conn->v6only && conn->type != SOCK_RAW)) {
+						continue;
+					}
+				} else {
+					continue; /* wrong protocol family */
+				}
 
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
+				/* We might have a match for v4-to-v6 mapping, check more */
 			}
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			/* Is the candidate connection matching the packet's protocol
+			 * within the family?
+			 */
+			if (conn->proto != proto) {
+				continue; /* wrong protocol */
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			/* Apply protocol-specific matching criteria... */
+			uint8_t conn_family = conn->family;
 
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
+			if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+			    (conn_family == AF_INET || conn_family == AF_INET6 ||
+			     conn_family == AF_UNSPEC)) {
+				/* Is the candidate connection matching the packet's TCP/UDP
+				 * address and port?
 				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
+				if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+				    net_sin(&conn->remote_addr)->sin_port != src_port) {
+					continue; /* wrong remote port */
 				}
 
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
-			}
+				if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+				    net_sin(&conn->local_addr)->sin_port != dst_port) {
+					continue; /* wrong local port */
+				}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
+				if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+				    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+					continue; /* wrong remote address */
+				}
 
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
+				if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+				    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+					/* Check if we could do a v4-mapping-to-v6 and the IPv6
+					 * socket has no IPV6_V6ONLY option set and if the local
+					 * IPV6 address is unspecified, then we could accept a
+					 * connection from IPv4 address by mapping it to IPv6
+					 * address.
+					 */
+					if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+						if (!(conn->family == AF_INET6 &&
+						      pkt_family == AF_INET &&
+						      !conn->v6only &&
+						      net_ipv6_is_addr_unspecified(
+							&net_sin6(&conn->local_addr)->sin6_addr))) {
+							continue; /* wrong local address */
+						}
+					} else {
+						continue; /* wrong local address */
+					}
 
-					continue; /* found a match - but maybe not yet the best */
+					/* We might have a match for v4-to-v6 mapping,
+					 * continue with rank checking.
+					 */
 				}
 
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
+				if (best_rank < NET_CONN_RANK(conn->flags)) {
+					struct net_pkt *mcast_pkt;
 
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
+					if (!is_mcast_pkt) {
+						best_rank = NET_CONN_RANK(conn->flags);
+						best_match = conn;
 
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
+						/* found a match - but maybe not yet the best */
+						continue;
+					}
 
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
+					/* If we have a multicast packet, and we found
+					 * a match, then deliver the packet immediately
+					 * to the handler. As there might be several
+					 * sockets interested about these, we need to
+					 * clone the received pkt.
+					 */
+
+					NET_DBG("[%p] mcast match found cb %p ud %p", conn,
+						conn->cb, conn->user_data);
+
+					mcast_pkt = net_pkt_clone(
+						pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+					if (!mcast_pkt) {
+						k_mutex_unlock(&conn_lock);
+						goto drop;
+					}
+
+					if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr,
+						     conn->user_data) == NET_DROP) {
+						net_stats_update_per_proto_drop(pkt_iface, proto);
+						net_pkt_unref(mcast_pkt);
+					} else {
+						net_stats_update_per_proto_recv(pkt_iface, proto);
+					}
 
-				mcast_pkt_delivered = true;
+					mcast_pkt_delivered = true;
+				}
 			}
 		}
 	} /* loop end */
@@ -1090,6 +1228,12 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	sys_slist_init(&conn_wildcard);
+
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_connected[i]);
+		sys_slist_init(&conn_bound[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
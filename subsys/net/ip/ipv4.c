@@ -331,7 +331,7 @@ enum net_verdict net_ipv4_input(struct net_pkt *pkt)
 		goto drop;
 	}
 
-	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV4_HEADER) &&
+	if (net_pkt_need_rx_chksum(pkt, NET_IF_CHECKSUM_IPV4_HEADER) &&
 	    net_calc_chksum_ipv4(pkt) != 0U) {
 		NET_DBG("DROP: invalid chksum");
 		goto drop;
@@ -483,6 +483,11 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
+	/* The hardware splits TSO packets into segments that fit the MTU */
+	if (net_pkt_tso_size(pkt) > 0U) {
+		return NET_OK;
+	}
+
 	return net_ipv4_prepare_for_send_fragment(pkt);
 #else
 	return NET_OK;
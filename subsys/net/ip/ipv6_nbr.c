@@ -26,6 +26,7 @@ LOG_MODULE_REGISTER(net_ipv6_nd, CONFIG_NET_IPV6_ND_LOG_LEVEL);
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/icmp.h>
 #include <zephyr/net/ethernet.h>
+#include <zephyr/sys/barrier.h>
 #include "net_private.h"
 #include "connection.h"
 #include "icmpv6.h"
@@ -135,6 +136,98 @@ static inline struct net_nbr *get_nbr(int idx)
 	return &net_neighbor_pool[idx].nbr;
 }
 
+#if defined(CONFIG_NET_IPV6_NBR_TX_CACHE)
+/* Link layer addresses of reachable neighbors, for the TX path to read
+ * without taking nbr_lock. The entries are written under nbr_lock, each with
+ * a sequence counter that is odd while it is written, so that readers can
+ * detect and discard torn reads. All entries are invalidated at once by
+ * changing the generation, whenever a neighbor changes state or address or
+ * is removed.
+ */
+struct nbr_tx_cache_entry {
+	atomic_t seq;
+	atomic_val_t gen;
+	struct net_if *iface;
+	struct in6_addr addr;
+	struct net_linkaddr lladdr;
+};
+
+static struct nbr_tx_cache_entry nbr_tx_cache[CONFIG_NET_IPV6_NBR_TX_CACHE_SIZE];
+static atomic_t nbr_tx_cache_gen = ATOMIC_INIT(1);
+
+static struct nbr_tx_cache_entry *nbr_tx_cache_slot(struct net_if *iface,
+						    const struct in6_addr *addr)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < sizeof(addr->s6_addr); i++) {
+		hash = (hash ^ addr->s6_addr[i]) * 16777619U;
+	}
+
+	hash = (hash ^ (uint32_t)POINTER_TO_UINT(iface)) * 16777619U;
+
+	return &nbr_tx_cache[hash % CONFIG_NET_IPV6_NBR_TX_CACHE_SIZE];
+}
+
+/* Called with nbr_lock held */
+static void nbr_tx_cache_flush(void)
+{
+	/* Entries of generation 0 are unused */
+	if (atomic_inc(&nbr_tx_cache_gen) == -1) {
+		atomic_inc(&nbr_tx_cache_gen);
+	}
+}
+
+/* Called with nbr_lock held */
+static void nbr_tx_cache_set(struct net_if *iface, const struct in6_addr *addr,
+			     const struct net_linkaddr *lladdr)
+{
+	struct nbr_tx_cache_entry *entry = nbr_tx_cache_slot(iface, addr);
+
+	atomic_inc(&entry->seq);
+	barrier_dmem_fence_full();
+
+	entry->iface = iface;
+	net_ipaddr_copy(&entry->addr, addr);
+	memcpy(&entry->lladdr, lladdr, sizeof(entry->lladdr));
+	entry->gen = atomic_get(&nbr_tx_cache_gen);
+
+	barrier_dmem_fence_full();
+	atomic_inc(&entry->seq);
+}
+
+static bool nbr_tx_cache_get(struct net_if *iface, const struct in6_addr *addr,
+			     struct net_linkaddr *lladdr)
+{
+	struct nbr_tx_cache_entry *entry = nbr_tx_cache_slot(iface, addr);
+	atomic_val_t seq;
+	bool found;
+
+	do {
+		seq = atomic_get(&entry->seq);
+		if (seq & 1) {
+			/* Being written, take the slow path */
+			return false;
+		}
+
+		found = entry->gen == atomic_get(&nbr_tx_cache_gen) &&
+			entry->iface == iface &&
+			net_ipv6_addr_cmp(&entry->addr, addr);
+		if (found) {
+			memcpy(lladdr, &entry->lladdr, sizeof(*lladdr));
+		}
+
+		barrier_dmem_fence_full();
+	} while (atomic_get(&entry->seq) != seq);
+
+	return found;
+}
+#else
+static inline void nbr_tx_cache_flush(void)
+{
+}
+#endif /* CONFIG_NET_IPV6_NBR_TX_CACHE */
+
 static void ipv6_nbr_set_state(struct net_nbr *nbr,
 			       enum net_ipv6_nbr_state new_state)
 {
@@ -147,6 +240,8 @@ static void ipv6_nbr_set_state(struct net_nbr *nbr,
 		net_ipv6_nbr_state2str(net_ipv6_nbr_data(nbr)->state),
 		net_ipv6_nbr_state2str(new_state));
 
+	nbr_tx_cache_flush();
+
 	net_ipv6_nbr_data(nbr)->state = new_state;
 
 	if (net_ipv6_nbr_data(nbr)->state == NET_IPV6_NBR_STATE_STALE) {
@@ -298,6 +393,7 @@ static inline void nbr_free(struct net_nbr *nbr)
 	NET_DBG("nbr %p", nbr);
 
 	nbr_clear_ns_pending(net_ipv6_nbr_data(nbr));
+	nbr_tx_cache_flush();
 
 	net_ipv6_nbr_data(nbr)->reachable = 0;
 	net_ipv6_nbr_data(nbr)->reachable_timeout = 0;
@@ -671,6 +767,7 @@ struct net_nbr *net_ipv6_nbr_add(struct net_if *iface,
 
 			net_linkaddr_set(cached_lladdr, (uint8_t *)lladdr->addr,
 					 lladdr->len);
+			nbr_tx_cache_flush();
 
 			ipv6_nbr_set_state(nbr, NET_IPV6_NBR_STATE_STALE);
 		} else if (net_ipv6_nbr_data(nbr)->state ==
@@ -714,12 +811,14 @@ void net_neighbor_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_tx_cache_flush();
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
 {
 	NET_DBG("Neighbor table %p cleared", table);
+
+	nbr_tx_cache_flush();
 }
 
 struct in6_addr *net_ipv6_nbr_lookup_by_index(struct net_if *iface,
@@ -855,9 +954,10 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TSO packets
+	 * are split into segments that fit the MTU by the hardware.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_tso_size(pkt) == 0U) {
 		size_t pkt_len = net_pkt_get_len(pkt);
 		uint16_t mtu;
 
@@ -989,6 +1089,18 @@ try_send:
 		}
 	}
 
+#if defined(CONFIG_NET_IPV6_NBR_TX_CACHE)
+	{
+		struct net_linkaddr cached;
+
+		if (nbr_tx_cache_get(iface, nexthop, &cached)) {
+			(void)net_linkaddr_set(net_pkt_lladdr_dst(pkt), cached.addr,
+					       cached.len);
+			return NET_OK;
+		}
+	}
+#endif
+
 	net_ipv6_nbr_lock();
 
 	nbr = nbr_lookup(&net_neighbor.table, iface, nexthop);
@@ -1011,6 +1123,15 @@ try_send:
 		NET_DBG("Neighbor %p addr %s", nbr,
 			net_sprint_ll_addr(lladdr->addr, lladdr->len));
 
+#if defined(CONFIG_NET_IPV6_NBR_TX_CACHE)
+		/* Only reachable neighbors can skip the state machine below */
+		if (!IS_ENABLED(CONFIG_NET_IPV6_ND) ||
+		    net_ipv6_nbr_data(nbr)->state == NET_IPV6_NBR_STATE_REACHABLE ||
+		    net_ipv6_nbr_data(nbr)->state == NET_IPV6_NBR_STATE_STATIC) {
+			nbr_tx_cache_set(iface, nexthop, lladdr);
+		}
+#endif
+
 		/* Start the NUD if we are in STALE state.
 		 * See RFC 4861 ch 7.3.3 for details.
 		 */
@@ -1779,6 +1900,7 @@ static inline bool handle_na_neighbor(struct net_pkt *pkt,
 
 			net_linkaddr_set(cached_lladdr, lladdr.addr,
 					 cached_lladdr->len);
+			nbr_tx_cache_flush();
 		}
 
 		if (na_hdr->flags & NET_ICMPV6_NA_FLAG_SOLICITED) {
@@ -1823,6 +1945,7 @@ static inline bool handle_na_neighbor(struct net_pkt *pkt,
 
 			net_linkaddr_set(cached_lladdr, lladdr.addr,
 					 cached_lladdr->len);
+			nbr_tx_cache_flush();
 		}
 
 		if (na_hdr->flags & NET_ICMPV6_NA_FLAG_SOLICITED) {
@@ -2120,12 +2120,30 @@ static int get_context_ipv6_mcast_loop(struct net_context *context,
 #endif
 }
 
+static int context_pkt_write(struct net_pkt *pkt, const void *data, size_t len,
+			     size_t *offset, uint16_t *chksum)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM_COPY) && chksum != NULL) {
+		ret = net_pkt_write_chksum(pkt, data, len, *offset, chksum);
+		*offset += len;
+	} else {
+		ret = net_pkt_write(pkt, data, len);
+	}
+
+	return ret;
+}
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
- * to net_pkt from msghdr.
+ * to net_pkt from msghdr. If chksum is not NULL, the checksum of the data
+ * is computed while it is copied.
  */
-static int context_write_data(struct net_pkt *pkt, const void *buf,
-			      int buf_len, const struct msghdr *msghdr)
+static int context_write_data_chksum(struct net_pkt *pkt, const void *buf,
+				     int buf_len, const struct msghdr *msghdr,
+				     uint16_t *chksum)
 {
+	size_t offset = 0;
 	int ret = 0;
 
 	if (msghdr) {
@@ -2134,8 +2152,8 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 		for (i = 0; i < msghdr->msg_iovlen; i++) {
 			int len = MIN(msghdr->msg_iov[i].iov_len, buf_len);
 
-			ret = net_pkt_write(pkt, msghdr->msg_iov[i].iov_base,
-					    len);
+			ret = context_pkt_write(pkt, msghdr->msg_iov[i].iov_base,
+						len, &offset, chksum);
 			if (ret < 0) {
 				break;
 			}
@@ -2146,12 +2164,18 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 			}
 		}
 	} else {
-		ret = net_pkt_write(pkt, buf, buf_len);
+		ret = context_pkt_write(pkt, buf, buf_len, &offset, chksum);
 	}
 
 	return ret;
 }
 
+static int context_write_data(struct net_pkt *pkt, const void *buf,
+			      int buf_len, const struct msghdr *msghdr)
+{
+	return context_write_data_chksum(pkt, buf, buf_len, msghdr, NULL);
+}
+
 static int context_setup_udp_packet(struct net_context *context,
 				    sa_family_t family,
 				    struct net_pkt *pkt,
@@ -2163,6 +2187,8 @@ static int context_setup_udp_packet(struct net_context *context,
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
+	uint16_t chksum = 0U;
+	uint16_t *data_chksum = NULL;
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)dst_addr;
@@ -2197,11 +2223,27 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+	/* Sum the payload while copying it when the checksum is not offloaded.
+	 * Zero-copy sends append their payload afterwards with len 0, it is
+	 * then summed with the rest of the packet when finalized.
+	 */
+	if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM_COPY) && len > 0U &&
+	    net_if_need_calc_tx_checksum(net_pkt_iface(pkt),
+					 family == AF_INET6 ?
+					 NET_IF_CHECKSUM_IPV6_UDP :
+					 NET_IF_CHECKSUM_IPV4_UDP)) {
+		data_chksum = &chksum;
+	}
+
+	ret = context_write_data_chksum(pkt, buf, len, msg, data_chksum);
 	if (ret) {
 		return ret;
 	}
 
+	if (data_chksum != NULL) {
+		net_pkt_set_data_chksum(pkt, chksum);
+	}
+
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
 	if (context->options.timestamping & SOF_TIMESTAMPING_TX_HARDWARE) {
 		net_pkt_set_tx_timestamping(pkt, true);
@@ -2385,7 +2427,8 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  struct net_buf *frags)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface = NULL;
@@ -2663,6 +2706,18 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
+	/* Buffers can only be sent as is by the native UDP and TCP */
+	if (frags != NULL) {
+		if ((net_context_get_proto(context) != IPPROTO_UDP &&
+		     net_context_get_proto(context) != IPPROTO_TCP) ||
+		    net_context_get_type(context) == SOCK_RAW ||
+		    net_if_is_ip_offloaded(iface)) {
+			return -EOPNOTSUPP;
+		}
+
+		len = net_buf_frags_len(frags);
+	}
+
 	context->send_cb = cb;
 	context->user_data = user_data;
 
@@ -2672,7 +2727,7 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	pkt = context_alloc_pkt(context, family, frags != NULL ? 0 : len, PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2680,7 +2735,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (frags == NULL && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM ||
 		    net_context_get_type(context) == SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2745,19 +2800,29 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
+		ret = context_setup_udp_packet(context, family, pkt, buf,
+					       frags != NULL ? 0 : len, msghdr,
 					       dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (frags != NULL) {
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		}
+
 		context_finalize_packet(context, family, pkt);
 
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
-		ret = net_tcp_queue(context, buf, len, msghdr);
+		if (frags != NULL) {
+			ret = net_tcp_queue_frags(context, frags);
+		} else {
+			ret = net_tcp_queue(context, buf, len, msghdr);
+		}
+
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2939,7 +3004,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2958,7 +3023,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2979,8 +3044,46 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
+
+	k_mutex_unlock(&context->lock);
 
+	return ret;
+}
+
+int net_context_send_frags(struct net_context *context,
+			   struct net_buf *frags,
+			   const struct sockaddr *dst_addr,
+			   socklen_t addrlen,
+			   net_context_send_cb_t cb,
+			   k_timeout_t timeout,
+			   void *user_data)
+{
+	bool sendto = true;
+	int ret;
+
+	if (frags == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (dst_addr == NULL) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    net_sin(&context->remote)->sin_port == 0) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
+
+		dst_addr = &context->remote;
+		addrlen = net_context_get_family(context) == AF_INET6 ?
+			  sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+		sendto = false;
+	}
+
+	ret = context_sendto(context, NULL, 0, dst_addr, addrlen,
+			     cb, timeout, user_data, sendto, frags);
+unlock:
 	k_mutex_unlock(&context->lock);
 
 	return ret;
@@ -598,6 +598,29 @@ err:
 	return ret;
 }
 
+size_t net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	size_t received = 0;
+
+	__ASSERT_NO_MSG(!k_is_in_isr());
+
+	/* Do not switch to the RX threads for each queued packet */
+	k_sched_lock();
+
+	for (size_t i = 0; i < count; i++) {
+		if (net_recv_data(iface, pkts[i]) < 0) {
+			net_pkt_unref(pkts[i]);
+			continue;
+		}
+
+		received++;
+	}
+
+	k_sched_unlock();
+
+	return received;
+}
+
 static inline void l3_init(void)
 {
 	net_pmtu_init();
@@ -638,6 +661,17 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	return -ENOTSUP;
 }
+
+size_t net_recv_data_batch(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	ARG_UNUSED(iface);
+
+	for (size_t i = 0; i < count; i++) {
+		net_pkt_unref(pkts[i]);
+	}
+
+	return 0;
+}
 #endif /* CONFIG_NET_NATIVE */
 
 static void init_rx_queues(void)
@@ -363,6 +363,8 @@ void net_if_try_queue_tx(struct net_if *iface, struct net_pkt *pkt, k_timeout_t
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
 #endif
 
+	net_tc_flow_hash_update(pkt, false);
+
 	/* For highest priority packet, skip the TX queue and push directly to
 	 * the driver. Also if there are no TX queue/thread, push the packet
 	 * directly to the driver.
@@ -5686,6 +5688,28 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface, enum net_if_checksum_typ
 	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD, chksum_type);
 }
 
+bool net_if_support_tx_partial_checksum(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
+		iface = net_eth_get_vlan_main(iface);
+		if (iface == NULL) {
+			return false;
+		}
+	}
+
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		return false;
+	}
+
+	return (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TX_CHKSUM_PARTIAL) != 0;
+#else
+	ARG_UNUSED(iface);
+
+	return false;
+#endif
+}
+
 int net_if_get_by_iface(struct net_if *iface)
 {
 	if (!(iface >= _net_if_list_start && iface < _net_if_list_end)) {
@@ -48,7 +48,20 @@ static struct k_work_q mgmt_work_q_obj;
 #endif
 
 static uint64_t global_event_mask;
-static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
+
+/* Callbacks only receive the events of their layer and layer code, so they
+ * are kept in lists indexed by those, and an event only walks the callbacks
+ * which can match it.
+ */
+static sys_slist_t event_callbacks[CONFIG_NET_MGMT_EVENT_CALLBACK_LISTS];
+
+static inline sys_slist_t *mgmt_event_callbacks(uint64_t mgmt_event)
+{
+	uint32_t key = (NET_MGMT_GET_LAYER(mgmt_event) << 7) |
+		       NET_MGMT_GET_LAYER_CODE(mgmt_event);
+
+	return &event_callbacks[key % ARRAY_SIZE(event_callbacks)];
+}
 
 /* Forward declaration for the actual caller */
 static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event);
@@ -67,6 +80,34 @@ static struct k_work_q *mgmt_work_q = COND_CODE_1(CONFIG_NET_MGMT_EVENT_SYSTEM_W
 static void mgmt_event_work_handler(struct k_work *work);
 static K_WORK_DEFINE(mgmt_work, mgmt_event_work_handler);
 
+/* As the queue is handled in order, the last event put in it is still
+ * there as long as the queue is not empty. new_event holds it, or has its
+ * event cleared if the last push failed or was dropped. Called with
+ * net_mgmt_event_lock held.
+ */
+static inline bool mgmt_event_is_pending(uint64_t mgmt_event, struct net_if *iface,
+					 const void *info, size_t length)
+{
+	if (k_msgq_num_used_get(&event_msgq) == 0 ||
+	    new_event.event != mgmt_event || new_event.iface != iface) {
+		return false;
+	}
+
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (info == NULL || length == 0) {
+		return new_event.info_length == 0;
+	}
+
+	return new_event.info_length == length &&
+	       memcmp(new_event.info, info, length) == 0;
+#else
+	ARG_UNUSED(info);
+	ARG_UNUSED(length);
+
+	return true;
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+}
+
 static inline void mgmt_push_event(uint64_t mgmt_event, struct net_if *iface,
 				   const void *info, size_t length)
 {
@@ -77,6 +118,14 @@ static inline void mgmt_push_event(uint64_t mgmt_event, struct net_if *iface,
 
 	(void)k_mutex_lock(&net_mgmt_event_lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_NET_MGMT_EVENT_COALESCE) &&
+	    mgmt_event_is_pending(mgmt_event, iface, info, length)) {
+		NET_DBG("Event 0x%" PRIx64 " already queued", mgmt_event);
+		(void)k_mutex_unlock(&net_mgmt_event_lock);
+
+		return;
+	}
+
 	memset(&new_event, 0, sizeof(struct mgmt_event_entry));
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
@@ -103,6 +152,9 @@ static inline void mgmt_push_event(uint64_t mgmt_event, struct net_if *iface,
 			 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
 			 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
 			 mgmt_event);
+
+		/* The event was not queued, so it must not be coalesced with */
+		new_event.event = 0;
 	}
 
 	(void)k_mutex_unlock(&net_mgmt_event_lock);
@@ -164,8 +216,10 @@ static inline void mgmt_rebuild_global_event_mask(void)
 		mgmt_add_event_mask(it->event_mask);
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
+	ARRAY_FOR_EACH(event_callbacks, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks[i], cb, tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
 	}
 }
 
@@ -184,6 +238,7 @@ static inline bool mgmt_is_event_handled(uint64_t mgmt_event)
 
 static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
+	sys_slist_t *callbacks = mgmt_event_callbacks(mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -193,7 +248,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(callbacks, cb, tmp, node) {
 		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
 		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
 		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
@@ -230,7 +285,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(callbacks, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -344,10 +399,16 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	/* Remove the callback if it already exists to avoid loop */
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	/* Remove the callback if it already exists to avoid loop. Its
+	 * event mask may have changed since it was added.
+	 */
+	ARRAY_FOR_EACH(event_callbacks, i) {
+		if (sys_slist_find_and_remove(&event_callbacks[i], &cb->node)) {
+			break;
+		}
+	}
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(mgmt_event_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
@@ -360,7 +421,14 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	if (!sys_slist_find_and_remove(mgmt_event_callbacks(cb->event_mask), &cb->node)) {
+		/* The event mask was changed after adding the callback */
+		ARRAY_FOR_EACH(event_callbacks, i) {
+			if (sys_slist_find_and_remove(&event_callbacks[i], &cb->node)) {
+				break;
+			}
+		}
+	}
 
 	mgmt_rebuild_global_event_mask();
 
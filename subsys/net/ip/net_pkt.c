@@ -1116,6 +1116,15 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 		}
 	}
 
+#if defined(CONFIG_NET_TCP_TSO)
+	/* The hardware splits TSO packets into segments that fit the MTU */
+	if (proto == IPPROTO_TCP && net_pkt_iface(pkt) != NULL &&
+	    net_if_l2(net_pkt_iface(pkt)) == &NET_L2_GET_NAME(ETHERNET) &&
+	    (net_eth_get_hw_capabilities(net_pkt_iface(pkt)) & ETHERNET_HW_TCP_TSO)) {
+		max_len = MAX(max_len, size);
+	}
+#endif /* CONFIG_NET_TCP_TSO */
+
 	max_len -= existing;
 
 	return MIN(size, max_len);
@@ -1963,6 +1972,57 @@ int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
+#if defined(CONFIG_NET_UDP_CHECKSUM_COPY)
+/* Write data to the packet, adding its checksum to sum. The offset is the
+ * one of the data in the checksummed area, only its parity matters.
+ */
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data,
+			 size_t length, size_t offset, uint16_t *sum)
+{
+	struct net_pkt_cursor *c_op = &pkt->cursor;
+	const uint8_t *src = data;
+
+	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
+
+	__ASSERT_NO_MSG(!net_pkt_is_being_overwritten(pkt));
+
+	while (c_op->buf && length) {
+		size_t d_len, len;
+
+		pkt_cursor_advance(pkt, true);
+		if (c_op->buf == NULL) {
+			break;
+		}
+
+		d_len = net_buf_max_len(c_op->buf) -
+			(c_op->pos - c_op->buf->data);
+		if (!d_len) {
+			break;
+		}
+
+		len = MIN(length, d_len);
+
+		*sum = calc_chksum_add(*sum,
+				       calc_chksum_copy(0U, c_op->pos, src, len),
+				       (offset & 1U) != 0U);
+
+		net_buf_add(c_op->buf, len);
+		pkt_cursor_update(pkt, len, true);
+
+		src += len;
+		offset += len;
+		length -= len;
+	}
+
+	if (length) {
+		NET_DBG("Still some length to go %zu", length);
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_UDP_CHECKSUM_COPY */
+
 int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length)
@@ -2039,6 +2099,7 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_vlan_tag(clone_pkt, net_pkt_vlan_tag(pkt));
 	net_pkt_set_timestamp(clone_pkt, net_pkt_timestamp(pkt));
 	net_pkt_set_priority(clone_pkt, net_pkt_priority(pkt));
+	net_pkt_set_flow_hash(clone_pkt, net_pkt_flow_hash(pkt));
 	net_pkt_set_orig_iface(clone_pkt, net_pkt_orig_iface(pkt));
 	net_pkt_set_captured(clone_pkt, net_pkt_is_captured(pkt));
 	net_pkt_set_eof(clone_pkt, net_pkt_eof(pkt));
@@ -2050,10 +2111,12 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_rx_timestamping(clone_pkt, net_pkt_is_rx_timestamping(pkt));
 	net_pkt_set_forwarding(clone_pkt, net_pkt_forwarding(pkt));
 	net_pkt_set_chksum_done(clone_pkt, net_pkt_is_chksum_done(pkt));
+	net_pkt_set_chksum_state(clone_pkt, net_pkt_chksum_state(pkt));
 	net_pkt_set_loopback(pkt, net_pkt_is_loopback(pkt));
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 	net_pkt_set_cooked_mode(clone_pkt, net_pkt_is_cooked_mode(pkt));
 	net_pkt_set_ipv4_pmtu(clone_pkt, net_pkt_ipv4_pmtu(pkt));
+	net_pkt_set_tso_size(clone_pkt, net_pkt_tso_size(pkt));
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
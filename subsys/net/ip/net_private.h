@@ -90,6 +90,16 @@ extern void socket_service_init(void);
 static inline void socket_service_init(void) { }
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+/* Tell event polling instances that the events of a socket may have changed */
+extern void net_socket_epoll_notify(struct net_context *context);
+#else
+static inline void net_socket_epoll_notify(struct net_context *context)
+{
+	ARG_UNUSED(context);
+}
+#endif
+
 #if defined(CONFIG_NET_NATIVE) || defined(CONFIG_NET_OFFLOAD)
 extern void net_context_init(void);
 extern const char *net_context_state(struct net_context *context);
@@ -211,6 +221,15 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 extern enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
 extern int net_tc_tx_thread_priority(int tc);
 extern int net_tc_rx_thread_priority(int tc);
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+extern void net_tc_flow_hash_update(struct net_pkt *pkt, bool rx);
+#else
+static inline void net_tc_flow_hash_update(struct net_pkt *pkt, bool rx)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(rx);
+}
+#endif
 static inline bool net_tc_tx_is_immediate(int tc, int prio)
 {
 	ARG_UNUSED(prio);
@@ -302,7 +321,79 @@ extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
+extern uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst,
+				 const uint8_t *src, size_t len);
+extern uint16_t calc_chksum_add(uint16_t sum, uint16_t part, bool odd);
+extern int net_pkt_write_chksum(struct net_pkt *pkt, const void *data,
+				size_t length, size_t offset, uint16_t *sum);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
+extern uint16_t net_calc_chksum_pseudo(struct net_pkt *pkt, uint8_t proto);
+
+/**
+ * @brief Check if the checksums of a received packet must be verified
+ *
+ * @param pkt		Network packet
+ * @param chksum_type	L3 and/or L4 protocol of the checksum
+ *
+ * @return True if the stack must verify the checksum, false if the driver
+ *         already did or if it is not needed.
+ */
+static inline bool net_pkt_need_rx_chksum(struct net_pkt *pkt,
+					  enum net_if_checksum_type chksum_type)
+{
+	switch (net_pkt_chksum_state(pkt)) {
+	case NET_PKT_CHKSUM_VERIFIED:
+	case NET_PKT_CHKSUM_UNNECESSARY:
+		return false;
+	default:
+		return net_if_need_calc_rx_checksum(net_pkt_iface(pkt), chksum_type);
+	}
+}
+
+/**
+ * @brief Compute the transport checksum of a packet to be sent
+ *
+ * @details Computes the checksum unless the interface offloads it or it is
+ * not needed, or returns the pseudo-header sum and marks the packet for the
+ * driver to complete it if the interface supports partial checksums.
+ *
+ * @param pkt		Network packet
+ * @param proto		Transport protocol
+ * @param chksum_type	L4 protocol of the checksum
+ * @param force		Compute the full checksum in any case
+ * @param chksum	Current value of the checksum field
+ *
+ * @return New value of the checksum field.
+ */
+static inline uint16_t net_pkt_calc_tx_chksum(struct net_pkt *pkt, uint8_t proto,
+					      enum net_if_checksum_type chksum_type,
+					      bool force, uint16_t chksum)
+{
+	if (!force && (!net_if_need_calc_tx_checksum(net_pkt_iface(pkt), chksum_type) ||
+		       net_pkt_chksum_state(pkt) == NET_PKT_CHKSUM_UNNECESSARY)) {
+		return chksum;
+	}
+
+	if (!force && net_if_support_tx_partial_checksum(net_pkt_iface(pkt))) {
+		net_pkt_set_chksum_state(pkt, NET_PKT_CHKSUM_PARTIAL);
+
+		return net_calc_chksum_pseudo(pkt, proto);
+	}
+
+	chksum = net_calc_chksum(pkt, proto);
+	if (proto == IPPROTO_UDP && chksum == 0U) {
+		chksum = 0xffff;
+	}
+
+	net_pkt_set_chksum_done(pkt, true);
+
+	/* A previous finalization may have left the checksum to the driver */
+	if (net_pkt_chksum_state(pkt) == NET_PKT_CHKSUM_PARTIAL) {
+		net_pkt_set_chksum_state(pkt, NET_PKT_CHKSUM_NONE);
+	}
+
+	return chksum;
+}
 
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
@@ -170,6 +170,9 @@ static inline void stats(struct net_if *iface)
 		NET_INFO("TCP conn drop  %u\tconnrst\t%u",
 			 GET_STAT(iface, tcp.conndrop),
 			 GET_STAT(iface, tcp.connrst));
+		NET_INFO("TCP RTT samples %u\ttotal\t%u ms",
+			 GET_STAT(iface, tcp.rtt_samples),
+			 GET_STAT(iface, tcp.rtt_total));
 #endif
 
 		NET_INFO("Bytes received %llu", GET_STAT(iface, bytes.received));
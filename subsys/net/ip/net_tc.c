@@ -13,10 +13,13 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "ipv4.h"
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 #define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT)
@@ -38,41 +41,151 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 #define NET_TC_RETRY_CNT 1
 #endif
+/* With flow steering, each traffic class has one queue and thread per CPU */
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+#define NET_TC_QUEUES_PER_CLASS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define NET_TC_QUEUES_PER_CLASS 1
+#endif
+
+#define NET_TC_TX_QUEUES (NET_TC_TX_COUNT * NET_TC_QUEUES_PER_CLASS)
+#define NET_TC_RX_QUEUES (NET_TC_RX_COUNT * NET_TC_QUEUES_PER_CLASS)
+
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * With flow steering, "@c" denotes the CPU the thread is pinned to.
  */
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+#define MAX_NAME_LEN sizeof("xx_q[y]@cc")
+#else
 #define MAX_NAME_LEN sizeof("xx_q[y]")
+#endif
 
 /* Stacks for TX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_QUEUES,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_QUEUES,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
-static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
+static struct net_traffic_class tx_classes[NET_TC_TX_QUEUES];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_QUEUES];
 #endif
 
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+static uint32_t flow_hash(uint32_t hash, const uint8_t *data, size_t len)
+{
+	/* FNV-1a */
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+/* Hash the addresses, protocol and ports of the packet. Only the first
+ * buffer is looked at, the headers are expected to be there. Packets that
+ * cannot be parsed all get the same hash.
+ */
+void net_tc_flow_hash_update(struct net_pkt *pkt, bool rx)
+{
+	const uint8_t *data = pkt->buffer != NULL ? pkt->buffer->data : NULL;
+	size_t len = pkt->buffer != NULL ? pkt->buffer->len : 0;
+	uint32_t hash = 2166136261U;
+	size_t hdr_len;
+	uint8_t proto;
+
+	if (net_pkt_flow_hash(pkt) != 0U || data == NULL) {
+		return;
+	}
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	/* Received packets still have their link layer header */
+	if (rx && net_if_l2(net_pkt_iface(pkt)) == &NET_L2_GET_NAME(ETHERNET)) {
+		hdr_len = sizeof(struct net_eth_hdr);
+
+		if (len >= hdr_len + 4 &&
+		    sys_get_be16(&data[offsetof(struct net_eth_hdr, type)]) ==
+		    NET_ETH_PTYPE_VLAN) {
+			hdr_len += 4;
+		}
+
+		if (len < hdr_len) {
+			goto out;
+		}
+
+		if (sys_get_be16(&data[hdr_len - 2]) != NET_ETH_PTYPE_IP &&
+		    sys_get_be16(&data[hdr_len - 2]) != NET_ETH_PTYPE_IPV6) {
+			goto out;
+		}
+
+		data += hdr_len;
+		len -= hdr_len;
+	}
+#else
+	ARG_UNUSED(rx);
+#endif
+
+	if (len >= sizeof(struct net_ipv4_hdr) && (data[0] >> 4) == 4) {
+		const struct net_ipv4_hdr *hdr = (const struct net_ipv4_hdr *)data;
+
+		hdr_len = (hdr->vhl & NET_IPV4_IHL_MASK) * 4U;
+		proto = hdr->proto;
+		hash = flow_hash(hash, hdr->src, sizeof(hdr->src) + sizeof(hdr->dst));
+
+		/* Keep all the fragments of a datagram together */
+		if ((sys_get_be16(hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) != 0) {
+			goto out;
+		}
+	} else if (len >= sizeof(struct net_ipv6_hdr) && (data[0] >> 4) == 6) {
+		const struct net_ipv6_hdr *hdr = (const struct net_ipv6_hdr *)data;
+
+		hdr_len = sizeof(struct net_ipv6_hdr);
+		proto = hdr->nexthdr;
+		hash = flow_hash(hash, hdr->src, sizeof(hdr->src) + sizeof(hdr->dst));
+	} else {
+		goto out;
+	}
+
+	hash = flow_hash(hash, &proto, sizeof(proto));
+
+	/* Both TCP and UDP start with the source and destination ports */
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) && len >= hdr_len + 4) {
+		hash = flow_hash(hash, &data[hdr_len], 4);
+	}
+
+out:
+	net_pkt_set_flow_hash(pkt, hash);
+}
+
+#define tc_queue(tc, pkt) \
+	((tc) * NET_TC_QUEUES_PER_CLASS + net_pkt_flow_hash(pkt) % arch_num_cpus())
+#else
+#define tc_queue(tc, pkt) (tc)
+#endif /* CONFIG_NET_TC_FLOW_STEERING */
+
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout)
 {
 #if NET_TC_TX_COUNT > 0
+	struct net_traffic_class *queue = &tx_classes[tc_queue(tc, pkt)];
+
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
-	if (k_sem_take(&tx_classes[tc].fifo_slot, timeout) != 0) {
+	if (k_sem_take(&queue->fifo_slot, timeout) != 0) {
 		return NET_DROP;
 	}
 #endif
 
-	k_fifo_put(&tx_classes[tc].fifo, pkt);
+	k_fifo_put(&queue->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -87,10 +200,15 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	uint8_t retry_cnt = NET_TC_RETRY_CNT;
 #endif
+	struct net_traffic_class *queue;
+
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
+	net_tc_flow_hash_update(pkt, true);
+	queue = &rx_classes[tc_queue(tc, pkt)];
+
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
+	while (k_sem_take(&queue->fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
 			return NET_DROP;
 		}
@@ -103,7 +221,7 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 	}
 #endif
 
-	k_fifo_put(&rx_classes[tc].fifo, pkt);
+	k_fifo_put(&queue->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -325,9 +443,15 @@ void net_tc_tx_init(void)
 	net_if_foreach(net_tc_tx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_TX_COUNT; i++) {
+	for (i = 0; i < NET_TC_TX_QUEUES; i++) {
+		int tc = i / NET_TC_QUEUES_PER_CLASS;
+		int cpu = i % NET_TC_QUEUES_PER_CLASS;
 		k_tid_t tid;
-		int priority = net_tc_tx_thread_priority(i);
+		int priority = net_tc_tx_thread_priority(tc);
+
+		if ((unsigned int)cpu >= arch_num_cpus()) {
+			continue;
+		}
 
 		NET_DBG("[%d] Starting TX handler %p stack size %zd prio %d", i,
 			&tx_classes[i].handler,
@@ -359,10 +483,19 @@ void net_tc_tx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "tx_q[%d]", i);
+			if (IS_ENABLED(CONFIG_NET_TC_FLOW_STEERING)) {
+				snprintk(name, sizeof(name), "tx_q[%d]@%d", tc, cpu);
+			} else {
+				snprintk(name, sizeof(name), "tx_q[%d]", tc);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+		k_thread_cpu_pin(tid, cpu);
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -382,9 +515,15 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_QUEUES; i++) {
+		int tc = i / NET_TC_QUEUES_PER_CLASS;
+		int cpu = i % NET_TC_QUEUES_PER_CLASS;
 		k_tid_t tid;
-		int priority = net_tc_rx_thread_priority(i);
+		int priority = net_tc_rx_thread_priority(tc);
+
+		if ((unsigned int)cpu >= arch_num_cpus()) {
+			continue;
+		}
 
 
 		NET_DBG("[%d] Starting RX handler %p stack size %zd prio %d", i,
@@ -417,10 +556,19 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (IS_ENABLED(CONFIG_NET_TC_FLOW_STEERING)) {
+				snprintk(name, sizeof(name), "rx_q[%d]@%d", tc, cpu);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", tc);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_FLOW_STEERING)
+		k_thread_cpu_pin(tid, cpu);
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
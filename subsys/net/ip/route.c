@@ -40,6 +40,70 @@ static sys_slist_t active_route_lifetime_timers;
 /* Timer that manages expired route entries. */
 static struct k_work_delayable route_lifetime_timer;
 
+#if defined(CONFIG_NET_ROUTE_CACHE)
+/* Cache of the latest lookups. The entries are valid if they have the
+ * current generation, which changes whenever the routing table changes, so
+ * that the cached route pointers are never stale. Protected by the IPv6
+ * neighbor lock, as the routing table.
+ */
+struct route_cache_entry {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+	uint32_t gen;
+};
+
+static struct route_cache_entry route_cache[CONFIG_NET_ROUTE_CACHE_SIZE];
+static uint32_t route_cache_gen = 1U;
+
+static void route_cache_flush(void)
+{
+	route_cache_gen++;
+
+	/* Entries of generation 0 are unused */
+	if (route_cache_gen == 0U) {
+		memset(route_cache, 0, sizeof(route_cache));
+		route_cache_gen = 1U;
+	}
+}
+
+/* FNV-1a of the destination and the interface */
+static struct route_cache_entry *route_cache_slot(struct net_if *iface,
+						  const struct in6_addr *dst)
+{
+	const uint8_t *p = dst->s6_addr;
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < sizeof(dst->s6_addr); i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	hash = (hash ^ (uint32_t)POINTER_TO_UINT(iface)) * 16777619U;
+
+	return &route_cache[hash % CONFIG_NET_ROUTE_CACHE_SIZE];
+}
+
+static bool route_cache_match(struct route_cache_entry *entry, struct net_if *iface,
+			    const struct in6_addr *dst)
+{
+	return entry->gen == route_cache_gen && entry->iface == iface &&
+	       net_ipv6_addr_cmp(&entry->dst, dst);
+}
+
+static void route_cache_set(struct route_cache_entry *entry, struct net_if *iface,
+			    const struct in6_addr *dst, struct net_route_entry *route)
+{
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->iface = iface;
+	entry->route = route;
+	entry->gen = route_cache_gen;
+}
+#else
+static inline void route_cache_flush(void)
+{
+}
+#endif /* CONFIG_NET_ROUTE_CACHE */
+
 static void net_route_nexthop_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Nexthop %p removed", nbr);
@@ -97,11 +161,15 @@ static struct net_nbr *get_nexthop_route(void)
 static void net_route_entry_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Route %p removed", nbr);
+
+	route_cache_flush();
 }
 
 static void net_route_entries_table_clear(struct net_nbr_table *table)
 {
 	NET_DBG("Route table %p cleared", table);
+
+	route_cache_flush();
 }
 
 /*
@@ -263,6 +331,10 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
+	if (sys_slist_peek_head(&routes) == &route->node) {
+		return;
+	}
+
 	sys_slist_find_and_remove(&routes, &route->node);
 	sys_slist_prepend(&routes, &route->node);
 }
@@ -273,9 +345,25 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
+#if defined(CONFIG_NET_ROUTE_CACHE)
+	struct route_cache_entry *entry;
+#endif
 
 	net_ipv6_nbr_lock();
 
+#if defined(CONFIG_NET_ROUTE_CACHE)
+	entry = route_cache_slot(iface, dst);
+	if (route_cache_match(entry, iface, dst)) {
+		found = entry->route;
+		if (found) {
+			update_route_access(found);
+		}
+
+		net_ipv6_nbr_unlock();
+		return found;
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -304,6 +392,10 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		update_route_access(found);
 	}
 
+#if defined(CONFIG_NET_ROUTE_CACHE)
+	route_cache_set(entry, iface, dst, found);
+#endif
+
 	net_ipv6_nbr_unlock();
 	return found;
 }
@@ -445,6 +537,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	net_route_update_lifetime(route, lifetime);
 
 	sys_slist_prepend(&routes, &route->node);
+	route_cache_flush();
 
 	tmp = nbr_nexthop_get(iface, nexthop);
 
@@ -587,6 +680,7 @@ int net_route_del(struct net_route_entry *route)
 	}
 
 	sys_slist_find_and_remove(&routes, &route->node);
+	route_cache_flush();
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
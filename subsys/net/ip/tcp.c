@@ -19,6 +19,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/udp.h>
+#include <zephyr/net/ethernet.h>
 #include "ipv4.h"
 #include "ipv6.h"
 #include "connection.h"
@@ -71,8 +72,20 @@ static int tcp_tx_window =
 
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
+/* tcp_lock protects tcp_conns, it is only needed when a connection is
+ * allocated or released, or to go through all the connections. Incoming
+ * segments find their connection in tcp_conn_table instead, which only
+ * takes the lock of one bucket.
+ */
 static K_MUTEX_DEFINE(tcp_lock);
 
+struct tcp_conn_bucket {
+	sys_slist_t conns;
+	struct k_spinlock lock;
+};
+
+static struct tcp_conn_bucket tcp_conn_table[CONFIG_NET_TCP_CONN_HASH_BUCKETS];
+
 K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
@@ -274,6 +287,71 @@ static int tcp_endpoint_set(union tcp_endpoint *ep, struct net_pkt *pkt,
 	return ret;
 }
 
+/* FNV-1a over the port and the address of an endpoint */
+static uint32_t tcp_endpoint_hash(uint32_t hash, const union tcp_endpoint *ep)
+{
+	const uint8_t *p = (const uint8_t *)&ep->sin.sin_port;
+	size_t len = sizeof(ep->sin.sin_port);
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && ep->sa.sa_family == AF_INET6) {
+		p = ep->sin6.sin6_addr.s6_addr;
+		len = sizeof(struct in6_addr);
+	} else {
+		p = ep->sin.sin_addr.s4_addr;
+		len = sizeof(struct in_addr);
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static struct tcp_conn_bucket *tcp_conn_bucket(const union tcp_endpoint *local,
+					       const union tcp_endpoint *remote)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = tcp_endpoint_hash(hash, local);
+	hash = tcp_endpoint_hash(hash, remote);
+
+	return &tcp_conn_table[hash % CONFIG_NET_TCP_CONN_HASH_BUCKETS];
+}
+
+static void tcp_conn_hash_remove(struct tcp *conn)
+{
+	struct tcp_conn_bucket *bucket = conn->bucket;
+	k_spinlock_key_t key;
+
+	if (bucket == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&bucket->lock);
+	sys_slist_find_and_remove(&bucket->conns, &conn->hash_next);
+	conn->bucket = NULL;
+	k_spin_unlock(&bucket->lock, key);
+}
+
+/* Must be called whenever the endpoints of the connection are set */
+static void tcp_conn_hash_add(struct tcp *conn)
+{
+	struct tcp_conn_bucket *bucket = tcp_conn_bucket(&conn->src, &conn->dst);
+	k_spinlock_key_t key;
+
+	tcp_conn_hash_remove(conn);
+
+	key = k_spin_lock(&bucket->lock);
+	sys_slist_append(&bucket->conns, &conn->hash_next);
+	conn->bucket = bucket;
+	k_spin_unlock(&bucket->lock, key);
+}
+
 int net_tcp_endpoint_copy(struct net_context *ctx,
 			  struct sockaddr *local,
 			  struct sockaddr *peer,
@@ -539,55 +617,386 @@ static void tcp_new_reno_dup_ack(struct tcp *conn)
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
+/* Handle the data acknowledged during a fast recovery, returns false if
+ * the connection is not recovering.
+ */
+static bool tcp_ca_recovery_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		return false;
+	}
+
+	/* Check if it is still in fast recovery mode */
+	if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+		conn->ca.pending_fast_retransmit_bytes = 0;
+		conn->ca.cwnd = conn->ca.ssthresh;
+	} else {
+		conn->ca.pending_fast_retransmit_bytes -= acked_len;
+		conn->ca.cwnd -= acked_len;
+	}
+
+	return true;
+}
+
+static void tcp_ca_slow_start(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd + MIN(acked_len, conn_mss(conn));
+
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+}
+
 static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
 	int32_t new_win = conn->ca.cwnd;
 	int32_t win_inc = MIN(acked_len, conn_mss(conn));
 
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+	if (!tcp_ca_recovery_acked(conn, acked_len)) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
+			tcp_ca_slow_start(conn, acked_len);
 		} else {
 			/* Implement a div_ceil	to avoid rounding to 0 */
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+			conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+		}
+	}
+	tcp_new_reno_log(conn, "pkts_acked");
+}
+
+static const struct tcp_congestion_ops tcp_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+
+/* Implementation according to RFC9438, with C = 0.4 and beta = 0.7. Times
+ * are in milliseconds, so that C * t^3 becomes 2 * t^3 / 5e9.
+ */
+#define CUBIC_C_NUM 2LL
+#define CUBIC_C_DEN 5000000000LL
+#define CUBIC_BETA_NUM 7U
+#define CUBIC_BETA_DEN 10U
+/* Keep the cube of the time within 64 bits */
+#define CUBIC_MAX_T_MS 60000LL
+
+static uint32_t cubic_root(uint64_t a)
+{
+	uint32_t root = 0U;
+
+	for (int shift = 63; shift >= 0; shift -= 3) {
+		uint64_t b;
+
+		root <<= 1;
+		b = 3U * (uint64_t)root * (root + 1U) + 1U;
+		if ((a >> shift) >= b) {
+			a -= b << shift;
+			root++;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	}
+
+	return root;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	conn->ca.w_max = 0U;
+	conn->ca.epoch_start = 0U;
+	tcp_new_reno_init(conn);
+}
+
+/* Reduce from the flight size, as cwnd was inflated by the duplicate ACKs */
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	uint16_t mss = conn_mss(conn);
+	uint32_t flight = conn->unacked_len;
+
+	/* Fast convergence */
+	if (flight < conn->ca.w_max) {
+		conn->ca.w_max = flight * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+				 (2U * CUBIC_BETA_DEN);
 	} else {
-		/* Check if it is still in fast recovery mode */
-		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
-			conn->ca.pending_fast_retransmit_bytes = 0;
-			conn->ca.cwnd = conn->ca.ssthresh;
+		conn->ca.w_max = flight;
+	}
+
+	conn->ca.ssthresh = MAX(flight * CUBIC_BETA_NUM / CUBIC_BETA_DEN,
+				mss * 2);
+	conn->ca.epoch_start = 0U;
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_new_reno_log(conn, "cubic fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_new_reno_log(conn, "cubic timeout");
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	int64_t target;
+	int64_t t;
+
+	if (tcp_ca_recovery_acked(conn, acked_len)) {
+		tcp_new_reno_log(conn, "cubic recovery");
+		return;
+	}
+
+	if (cwnd < conn->ca.ssthresh) {
+		tcp_ca_slow_start(conn, acked_len);
+		tcp_new_reno_log(conn, "cubic slow_start");
+		return;
+	}
+
+	if (conn->ca.epoch_start == 0U) {
+		conn->ca.epoch_start = MAX(now, 1U);
+		conn->ca.w_est = cwnd;
+
+		if (conn->ca.w_max > cwnd) {
+			conn->ca.k = cubic_root((uint64_t)(conn->ca.w_max - cwnd) *
+						CUBIC_C_DEN / (CUBIC_C_NUM * mss));
 		} else {
-			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
+			conn->ca.k = 0U;
+			conn->ca.w_max = cwnd;
 		}
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
+
+	t = (int64_t)(now - conn->ca.epoch_start) - conn->ca.k;
+	t = CLAMP(t, -CUBIC_MAX_T_MS, CUBIC_MAX_T_MS);
+	target = conn->ca.w_max + CUBIC_C_NUM * mss * t * t * t / CUBIC_C_DEN;
+
+	/* Reno-friendly region, alpha = 3 * (1 - beta) / (1 + beta) = 9 / 17 */
+	conn->ca.w_est += (uint64_t)9U * mss * MIN(acked_len, mss) / (17U * cwnd);
+	target = MAX(target, (int64_t)conn->ca.w_est);
+
+	/* Grow cwnd by at most half of it per RTT, as RFC9438 advises */
+	target = MIN(target, (int64_t)cwnd * 3 / 2);
+
+	if (target > cwnd) {
+		uint32_t inc = (target - cwnd) * MIN(acked_len, mss) / cwnd;
+
+		conn->ca.cwnd = MIN(cwnd + MAX(inc, 1U), UINT16_MAX);
+	}
+
+	tcp_new_reno_log(conn, "cubic pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static const struct tcp_congestion_ops tcp_cubic = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+};
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_VEGAS)
+
+/* Delay based avoidance in the spirit of TCP Vegas: once per RTT sample,
+ * estimate how many segments are queued in the network from the RTT
+ * increase over the lowest RTT seen, and grow or shrink cwnd by one MSS to
+ * keep between alpha and beta of them. Losses are handled as New Reno does.
+ */
+#define VEGAS_ALPHA 2U
+#define VEGAS_BETA 4U
+#define VEGAS_GAMMA 1U
+
+static void tcp_vegas_init(struct tcp *conn)
 {
+	conn->ca.base_rtt = 0U;
 	tcp_new_reno_init(conn);
 }
 
+static void tcp_vegas_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (tcp_ca_recovery_acked(conn, acked_len)) {
+		tcp_new_reno_log(conn, "vegas recovery");
+		return;
+	}
+
+	/* The congestion avoidance is driven by the RTT samples */
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		tcp_ca_slow_start(conn, acked_len);
+		tcp_new_reno_log(conn, "vegas slow_start");
+	}
+}
+
+static void tcp_vegas_rtt_sample(struct tcp *conn, uint32_t rtt)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t queued;
+
+	rtt = MAX(rtt, 1U);
+	if (conn->ca.base_rtt == 0U || rtt < conn->ca.base_rtt) {
+		conn->ca.base_rtt = rtt;
+	}
+
+	/* Expected minus actual throughput, times the base RTT, in segments */
+	queued = (uint64_t)conn->ca.cwnd * (rtt - conn->ca.base_rtt) / ((uint64_t)rtt * mss);
+
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		return;
+	}
+
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		if (queued > VEGAS_GAMMA) {
+			/* Leave slow start before losing packets */
+			conn->ca.ssthresh = MAX(conn->ca.cwnd, mss * 2);
+		}
+	} else if (queued < VEGAS_ALPHA) {
+		conn->ca.cwnd = MIN(conn->ca.cwnd + mss, UINT16_MAX);
+	} else if (queued > VEGAS_BETA) {
+		conn->ca.cwnd = MAX(conn->ca.cwnd - mss, mss * 2);
+	}
+
+	tcp_new_reno_log(conn, "vegas rtt_sample");
+}
+
+static const struct tcp_congestion_ops tcp_vegas = {
+	.name = "vegas",
+	.init = tcp_vegas_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_vegas_pkts_acked,
+	.rtt_sample = tcp_vegas_rtt_sample,
+};
+#endif /* CONFIG_NET_TCP_CONGESTION_VEGAS */
+
+static const struct tcp_congestion_ops *const tcp_ca_algorithms[] = {
+	&tcp_new_reno,
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+	&tcp_cubic,
+#endif
+#if defined(CONFIG_NET_TCP_CONGESTION_VEGAS)
+	&tcp_vegas,
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_cubic)
+#elif defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_VEGAS)
+#define TCP_CA_DEFAULT (&tcp_vegas)
+#else
+#define TCP_CA_DEFAULT (&tcp_new_reno)
+#endif
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	conn->ca_ops->init(conn);
+}
+
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->pkts_acked(conn, acked_len);
+}
+
+/* Time one segment at a time. Following Karn's algorithm, retransmitted
+ * segments are not timed.
+ */
+static void tcp_rtt_start(struct tcp *conn, uint32_t end_seq)
+{
+	if (!conn->rtt_pending) {
+		conn->rtt_seq = end_seq;
+		conn->rtt_start = k_uptime_get_32();
+		conn->rtt_pending = true;
+	}
+}
+
+static void tcp_rtt_cancel(struct tcp *conn)
+{
+	conn->rtt_pending = false;
+}
+
+static void tcp_rtt_acked(struct tcp *conn, uint32_t ack)
+{
+	uint32_t rtt;
+
+	if (!conn->rtt_pending || net_tcp_seq_cmp(ack, conn->rtt_seq) < 0) {
+		return;
+	}
+
+	rtt = k_uptime_get_32() - conn->rtt_start;
+	conn->rtt_pending = false;
+	conn->srtt = conn->srtt == 0U ? rtt : (7U * conn->srtt + rtt) / 8U;
+
+	net_stats_update_tcp_rtt(conn->iface, rtt);
+
+	if (conn->ca_ops->rtt_sample != NULL) {
+		conn->ca_ops->rtt_sample(conn, rtt);
+	}
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, uint32_t len)
+{
+	size_t name_len = strnlen(value, len);
+
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		const struct tcp_congestion_ops *ops = tcp_ca_algorithms[i];
+
+		if (strlen(ops->name) != name_len ||
+		    memcmp(ops->name, value, name_len) != 0) {
+			continue;
+		}
+
+		conn->ca_ops = ops;
+
+		/* Otherwise initialized when the connection is established */
+		if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+			tcp_ca_init(conn);
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (len == NULL) {
+		return -EINVAL;
+	}
+
+	name_len = MIN(name_len, *len);
+	memcpy(value, conn->ca_ops->name, name_len);
+	*len = name_len;
+
+	return 0;
 }
 #else
 
@@ -601,6 +1010,15 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static void tcp_rtt_start(struct tcp *conn, uint32_t end_seq) { }
+
+static void tcp_rtt_cancel(struct tcp *conn) { }
+
+static void tcp_rtt_acked(struct tcp *conn, uint32_t ack) { }
+
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -907,6 +1325,8 @@ static void tcp_conn_release(struct k_work *work)
 	net_context_unref(conn->context);
 	conn->context = NULL;
 
+	tcp_conn_hash_remove(conn);
+
 	k_mutex_lock(&tcp_lock, K_FOREVER);
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 	k_mutex_unlock(&tcp_lock);
@@ -948,6 +1368,13 @@ static int tcp_conn_unref(struct tcp *conn)
 	return ref_count;
 }
 
+/* Unblock senders, the socket may have become writable */
+static void tcp_tx_sem_give(struct tcp *conn)
+{
+	k_sem_give(&conn->tx_sem);
+	net_socket_epoll_notify(conn->context);
+}
+
 #if CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG
 #define tcp_conn_close(conn, status)				\
 	tcp_conn_close_debug(conn, status, __func__, __LINE__)
@@ -981,7 +1408,7 @@ static int tcp_conn_close(struct tcp *conn, int status)
 				       status, conn->recv_user_data);
 	}
 
-	k_sem_give(&conn->tx_sem);
+	tcp_tx_sem_give(conn);
 
 	return tcp_conn_unref(conn);
 }
@@ -1096,7 +1523,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1106,8 +1533,16 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* The options negotiated in the SYN apply to the whole connection */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+		recv_options->sack_perm_found = false;
+	}
+
+#if defined(CONFIG_NET_TCP_SACK)
+	recv_options->sack_count = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1156,6 +1591,32 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_OPT:
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     recv_options->sack_count < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *block =
+					&recv_options->sack[recv_options->sack_count++];
+
+				block->left = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				block->right = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1345,6 +1806,55 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* A SYN offers SACK, other segments report the out of order data queued,
+ * which is contiguous so that a single block is needed. The options are
+ * preceded by two NOPs to keep them aligned.
+ */
+static size_t tcp_sack_opt_len(struct tcp *conn, uint8_t flags)
+{
+	if (!conn->sack_permitted) {
+		return 0;
+	}
+
+	if (flags & SYN) {
+		return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if ((flags & ACK) && conn->queue_recv_data != NULL) {
+		return 2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return 0;
+}
+
+static int net_tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt, size_t len)
+{
+	uint8_t opt[2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE];
+	uint32_t left;
+
+	opt[0] = NET_TCP_NOP_OPT;
+	opt[1] = NET_TCP_NOP_OPT;
+
+	if (len == 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE) {
+		opt[2] = NET_TCP_SACK_PERM_OPT;
+		opt[3] = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		left = tcp_get_seq(conn->queue_recv_data);
+
+		opt[2] = NET_TCP_SACK_OPT;
+		opt[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		sys_put_be32(left, &opt[4]);
+		sys_put_be32(left + net_buf_frags_len(conn->queue_recv_data), &opt[8]);
+	}
+
+	return net_pkt_write(pkt, opt, len);
+}
+#else
+#define tcp_sack_opt_len(...) 0
+#define net_tcp_set_sack_opt(...) 0
+#endif /* CONFIG_NET_TCP_SACK */
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1366,6 +1876,8 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+	th->th_off += tcp_sack_opt_len(conn, flags) / 4;
+
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
 	UNALIGNED_PUT(htonl(seq), UNALIGNED_MEMBER_ADDR(th, th_seq));
@@ -1557,6 +2069,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	size_t sack_len = tcp_sack_opt_len(conn, flags);
 	struct net_pkt *pkt;
 	int ret = 0;
 
@@ -1564,6 +2077,8 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+	alloc_len += sack_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1571,6 +2086,11 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	}
 
 	if (data) {
+		if (net_pkt_get_len(data) > conn_mss(conn)) {
+			/* Let the hardware split the payload */
+			net_pkt_set_tso_size(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1596,6 +2116,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (sack_len > 0) {
+		ret = net_tcp_set_sack_opt(conn, pkt, sack_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1641,9 +2169,23 @@ static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 		goto out;
 	}
 
+	/* Data is always removed from the head, drop or pull the first
+	 * buffers instead of moving the data left in them, which may also
+	 * be owned by the application.
+	 */
+	while (len > 0 && pkt->buffer != NULL) {
+		struct net_buf *buf = pkt->buffer;
+
+		if (buf->len > len) {
+			net_buf_pull(buf, len);
+			break;
+		}
+
+		len -= buf->len;
+		pkt->buffer = net_buf_frag_del(NULL, buf);
+	}
+
 	net_pkt_cursor_init(pkt);
-	net_pkt_set_overwrite(pkt, true);
-	net_pkt_pull(pkt, len);
 	net_pkt_trim_buffer(pkt);
  out:
 	return ret;
@@ -1717,19 +2259,25 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 	return net_pkt_copy(to, from, len);
 }
 
-static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
+static int tcp_pkt_append(struct tcp *conn, const uint8_t *data, size_t len)
 {
+	struct net_pkt *pkt = &conn->send_data;
 	size_t alloc_len = len;
-	struct net_buf *buf = NULL;
+	struct net_buf *last = NULL;
+	bool in_place = false;
+	struct net_buf *buf;
 	int ret = 0;
 
 	if (pkt->buffer) {
-		buf = net_buf_frag_last(pkt->buffer);
+		last = net_buf_frag_last(pkt->buffer);
 
-		if (len > net_buf_tailroom(buf)) {
-			alloc_len -= net_buf_tailroom(buf);
-		} else {
-			alloc_len = 0;
+		/* Only fill the tailroom of a buffer allocated here, never write
+		 * past the data of a buffer given by the application.
+		 */
+		in_place = !conn->send_data_tail_borrowed &&
+			   !(last->flags & NET_BUF_EXTERNAL_DATA);
+		if (in_place) {
+			alloc_len -= MIN(len, net_buf_tailroom(last));
 		}
 	}
 
@@ -1741,8 +2289,16 @@ static int tcp_pkt_append(struct net_pkt *pkt, const uint8_t *data, size_t len)
 		}
 	}
 
-	if (buf == NULL) {
+	if (last == NULL) {
 		buf = pkt->buffer;
+	} else if (!in_place) {
+		buf = last->frags;
+	} else {
+		buf = last;
+	}
+
+	if (alloc_len > 0) {
+		conn->send_data_tail_borrowed = false;
 	}
 
 	while (buf != NULL && len > 0) {
@@ -1813,13 +2369,34 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+#if defined(CONFIG_NET_TCP_TSO)
+/* Largest payload of a data segment, more than the MSS if the interface
+ * can split the segments itself.
+ */
+static int tcp_send_max_len(struct tcp *conn)
+{
+	struct net_if *iface = conn->iface;
+	int mss = conn_mss(conn);
+
+	if (iface == NULL || net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TCP_TSO)) {
+		return mss;
+	}
+
+	/* Only send full sized segments, except for the last one */
+	return MAX(mss, ROUND_DOWN(CONFIG_NET_TCP_TSO_MAX_SIZE, mss));
+}
+#else
+#define tcp_send_max_len(conn) conn_mss(conn)
+#endif /* CONFIG_NET_TCP_TSO */
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_max_len(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1831,6 +2408,12 @@ static int tcp_send_data(struct tcp *conn)
 	}
 
 	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt && len > conn_mss(conn)) {
+		/* Not enough buffers for a TSO segment, send a regular one */
+		len = conn_mss(conn);
+		pkt = tcp_pkt_alloc(conn, len);
+	}
+
 	if (!pkt) {
 		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -1849,9 +2432,11 @@ static int tcp_send_data(struct tcp *conn)
 		conn->unacked_len += len;
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+			tcp_rtt_cancel(conn);
 			net_stats_update_tcp_resent(conn->iface, len);
 			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
+			tcp_rtt_start(conn, conn->seq + conn->unacked_len);
 			net_stats_update_tcp_sent(conn->iface, len);
 			net_stats_update_tcp_seg_sent(conn->iface);
 		}
@@ -1869,6 +2454,223 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Retransmit len bytes at offset of the unacknowledged data */
+static int tcp_send_range(struct tcp *conn, uint32_t offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, &conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+	if (ret == 0) {
+		tcp_rtt_cancel(conn);
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+	}
+
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
+static void tcp_sack_add(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	struct tcp_sack_block *highest = NULL;
+	int i = 0;
+
+	/* Merge the blocks overlapping or adjacent to the new one */
+	while (i < conn->sack_board_count) {
+		struct tcp_sack_block *block = &conn->sack_board[i];
+
+		if (net_tcp_seq_cmp(block->right, left) < 0 ||
+		    net_tcp_seq_cmp(block->left, right) > 0) {
+			i++;
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(block->left, left) < 0) {
+			left = block->left;
+		}
+
+		if (net_tcp_seq_cmp(block->right, right) > 0) {
+			right = block->right;
+		}
+
+		*block = conn->sack_board[--conn->sack_board_count];
+	}
+
+	if (conn->sack_board_count == NET_TCP_SACK_MAX_BLOCKS) {
+		/* Scoreboard full, forget about the highest block, which is
+		 * the less useful to find the holes to fill first.
+		 */
+		for (i = 0; i < conn->sack_board_count; i++) {
+			if (highest == NULL ||
+			    net_tcp_seq_cmp(conn->sack_board[i].left, highest->left) > 0) {
+				highest = &conn->sack_board[i];
+			}
+		}
+
+		if (net_tcp_seq_cmp(left, highest->left) > 0) {
+			return;
+		}
+
+		*highest = conn->sack_board[--conn->sack_board_count];
+	}
+
+	conn->sack_board[conn->sack_board_count].left = left;
+	conn->sack_board[conn->sack_board_count].right = right;
+	conn->sack_board_count++;
+}
+
+/* Update the scoreboard from the cumulative ACK and the SACK blocks of
+ * an incoming segment.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	int i = 0;
+
+	if (!conn->sack_permitted) {
+		return;
+	}
+
+	while (i < conn->sack_board_count) {
+		struct tcp_sack_block *block = &conn->sack_board[i];
+
+		if (net_tcp_seq_cmp(block->right, ack) <= 0) {
+			*block = conn->sack_board[--conn->sack_board_count];
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(block->left, ack) < 0) {
+			block->left = ack;
+		}
+
+		i++;
+	}
+
+	for (i = 0; i < conn->recv_options.sack_count; i++) {
+		struct tcp_sack_block *block = &conn->recv_options.sack[i];
+
+		/* Ignore D-SACK and bogus blocks */
+		if (net_tcp_seq_cmp(block->left, ack) <= 0 ||
+		    net_tcp_seq_cmp(block->right, block->left) <= 0 ||
+		    net_tcp_seq_cmp(block->right, snd_nxt) > 0) {
+			continue;
+		}
+
+		tcp_sack_add(conn, block->left, block->right);
+	}
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack_board_count = 0;
+	conn->sack_recovery = false;
+}
+
+/* Retransmit the first segment of the lowest hole not retransmitted yet.
+ * Only the data below SACKed data is considered lost.
+ */
+static bool tcp_sack_retransmit(struct tcp *conn)
+{
+	uint32_t pos = conn->seq;
+
+	if (net_tcp_seq_cmp(conn->sack_rexmit_seq, pos) > 0) {
+		pos = conn->sack_rexmit_seq;
+	}
+
+	while (true) {
+		struct tcp_sack_block *next = NULL;
+		int len;
+
+		for (int i = 0; i < conn->sack_board_count; i++) {
+			struct tcp_sack_block *block = &conn->sack_board[i];
+
+			if (net_tcp_seq_cmp(block->right, pos) > 0 &&
+			    (next == NULL || net_tcp_seq_cmp(block->left, next->left) < 0)) {
+				next = block;
+			}
+		}
+
+		if (next == NULL) {
+			return false;
+		}
+
+		if (net_tcp_seq_cmp(next->left, pos) <= 0) {
+			pos = next->right;
+			continue;
+		}
+
+		len = MIN(next->left - pos, conn_mss(conn));
+		if (tcp_send_range(conn, pos - conn->seq, len) < 0) {
+			return false;
+		}
+
+		conn->sack_rexmit_seq = pos + len;
+
+		return true;
+	}
+}
+
+/* Enter the SACK based recovery, returns false if the peer has not
+ * reported any data, for the regular fast retransmit to be used.
+ */
+static bool tcp_sack_fast_retransmit(struct tcp *conn)
+{
+	if (!conn->sack_permitted || conn->sack_board_count == 0) {
+		return false;
+	}
+
+	conn->sack_recovery = true;
+	conn->sack_recovery_seq = conn->seq + conn->unacked_len;
+	conn->sack_rexmit_seq = conn->seq;
+
+	return tcp_sack_retransmit(conn);
+}
+
+/* Each further duplicate ACK tells that a segment left the network */
+static void tcp_sack_dup_ack(struct tcp *conn)
+{
+	if (conn->sack_recovery) {
+		(void)tcp_sack_retransmit(conn);
+	}
+}
+
+/* New data was acknowledged, send the next hole on a partial ACK */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack_recovery_seq) >= 0) {
+		conn->sack_recovery = false;
+		return;
+	}
+
+	(void)tcp_sack_retransmit(conn);
+}
+#else
+#define tcp_sack_update(...)
+#define tcp_sack_reset(...)
+#define tcp_sack_fast_retransmit(...) false
+#define tcp_sack_dup_ack(...)
+#define tcp_sack_acked(...)
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1971,6 +2773,9 @@ static void tcp_resend_data(struct k_work *work)
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
 
+		/* The peer may have dropped the data it reported */
+		tcp_sack_reset(conn);
+
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
 			NET_ERR("TCP exception with no data for retransmission");
@@ -2203,6 +3008,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2251,42 +3057,36 @@ int net_tcp_get(struct net_context *context)
 	return ret;
 }
 
-static bool tcp_endpoint_cmp(union tcp_endpoint *ep, struct net_pkt *pkt,
-			     enum pkt_addr which)
+static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 {
-	union tcp_endpoint ep_tmp;
+	union tcp_endpoint local, remote;
+	struct tcp_conn_bucket *bucket;
+	struct tcp *found = NULL;
+	struct tcp *conn;
+	k_spinlock_key_t key;
+	size_t len;
 
-	if (tcp_endpoint_set(&ep_tmp, pkt, which) < 0) {
-		return false;
+	if (tcp_endpoint_set(&local, pkt, TCP_EP_DST) < 0 ||
+	    tcp_endpoint_set(&remote, pkt, TCP_EP_SRC) < 0) {
+		return NULL;
 	}
 
-	return !memcmp(ep, &ep_tmp, tcp_endpoint_len(ep->sa.sa_family));
-}
-
-static bool tcp_conn_cmp(struct tcp *conn, struct net_pkt *pkt)
-{
-	return tcp_endpoint_cmp(&conn->src, pkt, TCP_EP_DST) &&
-		tcp_endpoint_cmp(&conn->dst, pkt, TCP_EP_SRC);
-}
-
-static struct tcp *tcp_conn_search(struct net_pkt *pkt)
-{
-	bool found = false;
-	struct tcp *conn;
-	struct tcp *tmp;
+	len = tcp_endpoint_len(local.sa.sa_family);
+	bucket = tcp_conn_bucket(&local, &remote);
 
-	k_mutex_lock(&tcp_lock, K_FOREVER);
+	key = k_spin_lock(&bucket->lock);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&tcp_conns, conn, tmp, next) {
-		found = tcp_conn_cmp(conn, pkt);
-		if (found) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&bucket->conns, conn, hash_next) {
+		if (!memcmp(&conn->src, &local, len) &&
+		    !memcmp(&conn->dst, &remote, len)) {
+			found = conn;
 			break;
 		}
 	}
 
-	k_mutex_unlock(&tcp_lock);
+	k_spin_unlock(&bucket->lock, key);
 
-	return found ? conn : NULL;
+	return found;
 }
 
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
@@ -2484,6 +3284,8 @@ static struct tcp *tcp_conn_new(struct net_pkt *pkt)
 		goto err;
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("[%p] src: %s, dst: %s", conn,
 		net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr),
@@ -2999,7 +3801,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len, th_flags(th) & SYN)) {
 		NET_DBG("[%p] DROP: Invalid TCP option list", conn);
 		net_tcp_reply_rst(pkt);
 		do_close = true;
@@ -3077,7 +3879,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	if (tcp_window_full(conn)) {
 		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 	} else {
-		k_sem_give(&conn->tx_sem);
+		tcp_tx_sem_give(conn);
 	}
 
 	switch (conn->state) {
@@ -3091,6 +3893,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				tcp_backlog_dec(conn->accepted_conn);
 			}
 
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_permitted = conn->recv_options.sack_perm_found;
+#endif
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
 			conn->isn_peer = th_seq(th);
@@ -3122,6 +3927,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+				conn->ca_ops = conn->accepted_conn->ca_ops;
+#endif
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3206,6 +4014,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_permitted = conn->recv_options.sack_perm_found;
+#endif
 			conn->isn_peer = th_seq(th);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
@@ -3251,6 +4062,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, th_ack(th));
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3271,20 +4084,30 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				/* Apply a fast retransmit, only of the data not
+				 * reported by the peer if SACK is in use.
+				 */
+				if (!tcp_sack_fast_retransmit(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
+
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+				/* Don't time the retransmitted segments */
+				tcp_rtt_cancel(conn);
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+				   (len == 0)) {
+				tcp_sack_dup_ack(conn);
 			}
 		}
 #endif
@@ -3315,6 +4138,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* New segment, reset duplicate ack counter */
 			conn->dup_ack_cnt = 0;
 #endif
+			tcp_rtt_acked(conn, th_ack(th));
 			tcp_ca_pkts_acked(conn, len_acked);
 
 			conn->send_data_total -= len_acked;
@@ -3325,12 +4149,14 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			}
 
 			if (!tcp_window_full(conn)) {
-				k_sem_give(&conn->tx_sem);
+				tcp_tx_sem_give(conn);
 			}
 
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_sack_acked(conn);
+
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
 			 * makes a "forward progress".
@@ -3436,7 +4262,7 @@ data_recv:
 		if (tcp_window_full(conn)) {
 			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 		} else {
-			k_sem_give(&conn->tx_sem);
+			tcp_tx_sem_give(conn);
 		}
 
 		/* Finally, after all Data/ACK processing, check for FIN flag. */
@@ -3650,6 +4476,7 @@ out:
 			}
 
 			k_sem_give(&conn->connect_sem);
+			net_socket_epoll_notify(conn->context);
 		}
 	}
 
@@ -3849,8 +4676,7 @@ int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 		for (int i = 0; i < msg->msg_iovlen; i++) {
 			int iovlen = MIN(msg->msg_iov[i].iov_len, len);
 
-			ret = tcp_pkt_append(&conn->send_data,
-					     msg->msg_iov[i].iov_base,
+			ret = tcp_pkt_append(conn, msg->msg_iov[i].iov_base,
 					     iovlen);
 			if (ret < 0) {
 				if (queued_len == 0) {
@@ -3868,7 +4694,7 @@ int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 			}
 		}
 	} else {
-		ret = tcp_pkt_append(&conn->send_data, data, len);
+		ret = tcp_pkt_append(conn, data, len);
 		if (ret < 0) {
 			goto out;
 		}
@@ -3899,6 +4725,57 @@ out:
 	return ret;
 }
 
+int net_tcp_queue_frags(struct net_context *context, struct net_buf *frags)
+{
+	struct tcp *conn = context->tcp;
+	size_t len = net_buf_frags_len(frags);
+	int ret;
+
+	if (!conn || conn->state != TCP_ESTABLISHED) {
+		return -ENOTCONN;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (len > conn->send_win_max) {
+		ret = -EMSGSIZE;
+		goto out;
+	}
+
+	/* The buffers cannot be split, wait for the window to have room
+	 * for all of them, the semaphore is given back on the next ACK.
+	 */
+	if (conn->send_data_total + len > conn->send_win) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	net_pkt_append_buffer(&conn->send_data, net_buf_ref(frags));
+	conn->send_data_total += len;
+	conn->send_data_tail_borrowed = true;
+
+	ret = tcp_send_queued_data(conn);
+	if (ret < 0 && ret != -ENOBUFS) {
+		tcp_conn_close(conn, ret);
+		goto out;
+	}
+
+	if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	ret = len;
+out:
+	k_mutex_unlock(&conn->lock);
+
+	return ret;
+}
+
 /* net context is about to send out queued data - inform caller only */
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
 		      void *user_data)
@@ -3918,6 +4795,10 @@ static int tcp_start_handshake(struct tcp *conn)
 	k_mutex_lock(&conn->lock, K_FOREVER);
 	tcp_check_sock_options(conn);
 	conn->send_options.mss_found = true;
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Offer SACK, until the peer answers */
+	conn->sack_permitted = true;
+#endif
 	ret = tcp_out_ext(conn, SYN, NULL /* no data */, conn->seq);
 	if (ret < 0) {
 		k_mutex_unlock(&conn->lock);
@@ -4034,6 +4915,8 @@ int net_tcp_connect(struct net_context *context,
 		conn->seq = tcp_init_isn(&conn->src.sa, &conn->dst.sa);
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("[%p] src: %s, dst: %s", conn,
 		net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr),
@@ -4222,10 +5105,8 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
-		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
-		net_pkt_set_chksum_done(pkt, true);
-	}
+	tcp_hdr->chksum = net_pkt_calc_tx_chksum(pkt, IPPROTO_TCP, type,
+						 force_chksum, tcp_hdr->chksum);
 
 	return net_pkt_set_data(pkt, &tcp_access);
 }
@@ -4238,7 +5119,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
-	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
+	    (net_pkt_need_rx_chksum(pkt, type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
@@ -4276,6 +5157,7 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 			conn = context->tcp;
 			tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 			tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+			tcp_conn_hash_add(conn);
 			/* Make an extra reference, the sanity check suite
 			 * will delete the connection explicitly
 			 */
@@ -4400,6 +5282,7 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 				conn = context->tcp;
 				tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 				tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+				tcp_conn_hash_add(conn);
 				conn->iface = pkt->iface;
 				tcp_conn_ref(conn);
 			}
@@ -4688,6 +5571,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4725,6 +5611,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
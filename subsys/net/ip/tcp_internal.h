@@ -50,6 +50,7 @@ enum tcp_conn_option {
 	TCP_OPT_KEEPIDLE = 3,
 	TCP_OPT_KEEPINTVL = 4,
 	TCP_OPT_KEEPCNT = 5,
+	TCP_OPT_CONGESTION = 6,
 };
 
 /**
@@ -327,6 +328,31 @@ static inline int net_tcp_queue(struct net_context *context, const void *data,
 }
 #endif
 
+/**
+ * @brief Enqueue network buffers for transmission without copying them
+ *
+ * @details The buffers are referenced until the data is acknowledged,
+ * they are queued completely or not at all.
+ *
+ * @param context	Network context
+ * @param frags		Fragment chain holding the data
+ *
+ * @return Number of bytes queued, -EAGAIN if the send window is too
+ *         small, < 0 on other errors
+ */
+#if defined(CONFIG_NET_NATIVE_TCP)
+int net_tcp_queue_frags(struct net_context *context, struct net_buf *frags);
+#else
+static inline int net_tcp_queue_frags(struct net_context *context,
+				      struct net_buf *frags)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(frags);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Update TCP receive window
  *
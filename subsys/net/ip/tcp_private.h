@@ -229,18 +229,36 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Max number of SACK blocks, as fitting in the TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS 4
+
+/* Range of sequence numbers [left, right) */
+struct tcp_sack_block {
+	uint32_t left;
+	uint32_t right;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_count;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
@@ -249,14 +267,39 @@ struct tcp_collision_avoidance_reno {
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+	uint16_t w_max;		/* Flight size at the last reduction */
+	uint32_t w_est;		/* Reno-friendly cwnd estimate */
+	uint32_t epoch_start;	/* Start of the avoidance epoch, ms, 0 if none */
+	uint32_t k;		/* Time to get back to w_max, ms */
+#endif
+#if defined(CONFIG_NET_TCP_CONGESTION_VEGAS)
+	uint32_t base_rtt;	/* Lowest RTT seen, ms, 0 if none */
+#endif
+};
+
+struct tcp;
+
+/* Congestion control algorithm, rtt_sample is optional */
+struct tcp_congestion_ops {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+	void (*rtt_sample)(struct tcp *conn, uint32_t rtt);
 };
 #endif
 
 struct tcp;
+struct tcp_conn_bucket;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
 	sys_snode_t next;
+	sys_snode_t hash_next;
+	struct tcp_conn_bucket *bucket;
 	struct net_context *context;
 	struct net_pkt send_data;
 	struct net_buf *queue_recv_data;
@@ -336,6 +379,17 @@ struct tcp { /* TCP connection */
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_congestion_ops *ca_ops;
+	uint32_t rtt_seq;	/* Sequence number the RTT is measured for */
+	uint32_t rtt_start;	/* When it was sent, ms */
+	uint32_t srtt;		/* Smoothed RTT, ms, 0 if none */
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Scoreboard of the data selectively acknowledged by the peer */
+	struct tcp_sack_block sack_board[NET_TCP_SACK_MAX_BLOCKS];
+	uint32_t sack_rexmit_seq;	/* End of the data retransmitted so far */
+	uint32_t sack_recovery_seq;	/* Recovery ends when this is acked */
+	uint8_t sack_board_count;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -350,6 +404,15 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+	/* The last buffer of send_data was given by the application */
+	bool send_data_tail_borrowed : 1;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	bool rtt_pending : 1;
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_permitted : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
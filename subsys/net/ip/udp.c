@@ -53,10 +53,8 @@ int net_udp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	udp_hdr->len = htons(length);
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
-		udp_hdr->chksum = net_calc_chksum_udp(pkt);
-		net_pkt_set_chksum_done(pkt, true);
-	}
+	udp_hdr->chksum = net_pkt_calc_tx_chksum(pkt, IPPROTO_UDP, type,
+						 force_chksum, udp_hdr->chksum);
 
 	return net_pkt_set_data(pkt, &udp_access);
 }
@@ -168,7 +166,7 @@ struct net_udp_hdr *net_udp_input(struct net_pkt *pkt,
 	}
 
 	if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM) &&
-	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
+	    (net_pkt_need_rx_chksum(pkt, type) ||
 	     net_pkt_is_ip_reassembled(pkt))) {
 		if (!udp_hdr->chksum) {
 			if (IS_ENABLED(CONFIG_NET_UDP_MISSING_CHECKSUM) &&
@@ -569,6 +569,16 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_64BIT)
+/* One's complement addition of 64-bit words, the carry is added back */
+static inline uint64_t add64_with_carry(uint64_t sum, uint64_t word)
+{
+	sum += word;
+
+	return sum + (sum < word);
+}
+#endif
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
@@ -604,6 +614,37 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		sum = sum + *((uint16_t *)data);
 		data += sizeof(uint16_t);
 	}
+
+#if defined(CONFIG_64BIT)
+	/* Use native words on 64-bit targets, halving the number of loads */
+	if ((((uintptr_t)data & 0x04) != 0) && (pending >= sizeof(uint32_t))) {
+		pending -= sizeof(uint32_t);
+		sum = sum + *((uint32_t *)data);
+		data += sizeof(uint32_t);
+	}
+
+	if (pending >= sizeof(uint64_t)) {
+		const uint64_t *q = (const uint64_t *)data;
+		uint64_t sum64 = 0;
+
+		while (pending >= sizeof(uint64_t) * 4) {
+			uint64_t sum_a = add64_with_carry(q[0], q[1]);
+			uint64_t sum_b = add64_with_carry(q[2], q[3]);
+
+			pending -= sizeof(uint64_t) * 4;
+			sum64 = add64_with_carry(sum64, sum_a);
+			sum64 = add64_with_carry(sum64, sum_b);
+			q += 4;
+		}
+		while (pending >= sizeof(uint64_t)) {
+			pending -= sizeof(uint64_t);
+			sum64 = add64_with_carry(sum64, *q++);
+		}
+
+		sum += (sum64 & UINT32_MAX) + (sum64 >> 32);
+		data = (uint8_t *)q;
+	}
+#endif
 	p = (uint32_t *)data;
 
 	/* Do loop unrolling for the very large data sets */
@@ -646,6 +687,46 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 }
 
+uint16_t calc_chksum_add(uint16_t sum, uint16_t part, bool odd)
+{
+	uint32_t total;
+
+	/* Data starting at an odd offset has its bytes in the other halves
+	 * of the 16-bit words.
+	 */
+	if (odd) {
+		part = BSWAP_16(part);
+	}
+
+	total = (uint32_t)sum + part;
+
+	return (uint16_t)((total & 0xffff) + (total >> 16));
+}
+
+/* Size of the chunks copied and summed in turn, so that the data is still
+ * in cache when it is summed. Even, so that the chunks keep the byte order.
+ */
+#define CHKSUM_COPY_CHUNK 256U
+
+uint16_t calc_chksum_copy(uint16_t sum_in, uint8_t *dst, const uint8_t *src,
+			  size_t len)
+{
+	uint16_t sum = sum_in;
+
+	while (len > 0) {
+		size_t chunk = MIN(len, CHKSUM_COPY_CHUNK);
+
+		memcpy(dst, src, chunk);
+		sum = calc_chksum(sum, dst, chunk);
+
+		dst += chunk;
+		src += chunk;
+		len -= chunk;
+	}
+
+	return sum;
+}
+
 #if defined(CONFIG_NET_NATIVE_IP)
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
@@ -684,7 +765,27 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 	return sum;
 }
 
-uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
+/* Sum the UDP header, the payload checksum is already known */
+static uint16_t pkt_calc_udp_chksum(struct net_pkt *pkt, uint16_t sum)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(udp_access, struct net_udp_hdr);
+	struct net_udp_hdr *udp_hdr;
+
+	udp_hdr = (struct net_udp_hdr *)net_pkt_get_data(pkt, &udp_access);
+	if (udp_hdr == NULL) {
+		return pkt_calc_chksum(pkt, sum);
+	}
+
+	sum = calc_chksum(sum, (uint8_t *)udp_hdr, sizeof(*udp_hdr));
+
+	return calc_chksum_add(sum, net_pkt_data_chksum(pkt), false);
+}
+
+/* Sum the pseudo-header, and the transport header and payload unless
+ * pseudo_only is set. Returns false if the family is unknown.
+ */
+static bool pkt_calc_l4_chksum(struct net_pkt *pkt, uint8_t proto,
+			       bool pseudo_only, uint16_t *sum_out)
 {
 	size_t len = 0U;
 	uint16_t sum = 0U;
@@ -707,7 +808,7 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 			net_pkt_ipv6_ext_len(pkt) + proto;
 	} else {
 		NET_DBG("Unknown protocol family %d", net_pkt_family(pkt));
-		return 0;
+		return false;
 	}
 
 	net_pkt_cursor_backup(pkt, &backup);
@@ -721,16 +822,46 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 	sum = calc_chksum(sum, pkt->cursor.pos, len);
 	net_pkt_skip(pkt, len + net_pkt_ip_opts_len(pkt));
 
-	sum = pkt_calc_chksum(pkt, sum);
-
-	sum = (sum == 0U) ? 0xffff : htons(sum);
+	if (pseudo_only) {
+		/* The transport headers and payload are summed by the device */
+	} else if (proto == IPPROTO_UDP && net_pkt_is_data_chksum_done(pkt)) {
+		sum = pkt_calc_udp_chksum(pkt, sum);
+	} else {
+		sum = pkt_calc_chksum(pkt, sum);
+	}
 
 	net_pkt_cursor_restore(pkt, &backup);
 
 	net_pkt_set_overwrite(pkt, ow);
 
+	*sum_out = sum;
+
+	return true;
+}
+
+uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
+{
+	uint16_t sum;
+
+	if (!pkt_calc_l4_chksum(pkt, proto, false, &sum)) {
+		return 0;
+	}
+
+	sum = (sum == 0U) ? 0xffff : htons(sum);
+
 	return ~sum;
 }
+
+uint16_t net_calc_chksum_pseudo(struct net_pkt *pkt, uint8_t proto)
+{
+	uint16_t sum;
+
+	if (!pkt_calc_l4_chksum(pkt, proto, true, &sum)) {
+		return 0;
+	}
+
+	return htons(sum);
+}
 #endif
 
 #if defined(CONFIG_NET_NATIVE_IPV4)
@@ -41,6 +41,106 @@ static void unlock_bridge(struct eth_bridge_iface_context *ctx)
 	k_mutex_unlock(&ctx->lock);
 }
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+
+#define FDB_SIZE CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE
+
+/* Entries of removed ports, skipped by lookups and reused when learning */
+#define FDB_PORT_STALE UINT8_MAX
+
+static size_t fdb_hash(const uint8_t *addr)
+{
+	uint32_t hash = 2166136261U;
+
+	/* FNV-1a */
+	for (size_t i = 0; i < NET_ETH_ADDR_LEN; i++) {
+		hash = (hash ^ addr[i]) * 16777619U;
+	}
+
+	return hash % FDB_SIZE;
+}
+
+static bool fdb_entry_is_valid(const struct eth_bridge_fdb_entry *entry, uint32_t now)
+{
+	return entry->port != 0 && entry->port != FDB_PORT_STALE &&
+	       (now - entry->seen) < CONFIG_NET_ETHERNET_BRIDGE_FDB_AGEING_TIME;
+}
+
+static void fdb_learn(struct eth_bridge_iface_context *ctx, const uint8_t *addr, size_t port)
+{
+	struct eth_bridge_fdb_entry *free_entry = NULL;
+	struct eth_bridge_fdb_entry *entry;
+	uint32_t now = k_uptime_seconds();
+	size_t idx = fdb_hash(addr);
+
+	for (size_t i = 0; i < FDB_SIZE; i++) {
+		entry = &ctx->fdb[(idx + i) % FDB_SIZE];
+
+		if (fdb_entry_is_valid(entry, now)) {
+			if (memcmp(entry->addr, addr, NET_ETH_ADDR_LEN) == 0) {
+				/* Refresh it, the host may have moved */
+				entry->port = port + 1;
+				entry->seen = now;
+				return;
+			}
+
+			continue;
+		}
+
+		if (free_entry == NULL) {
+			free_entry = entry;
+		}
+
+		/* The address would have been stored before a never used entry */
+		if (entry->port == 0) {
+			break;
+		}
+	}
+
+	if (free_entry == NULL) {
+		NET_DBG("FDB full, not learning %s",
+			net_sprint_ll_addr(addr, NET_ETH_ADDR_LEN));
+		return;
+	}
+
+	memcpy(free_entry->addr, addr, NET_ETH_ADDR_LEN);
+	free_entry->port = port + 1;
+	free_entry->seen = now;
+}
+
+static int fdb_lookup(struct eth_bridge_iface_context *ctx, const uint8_t *addr)
+{
+	const struct eth_bridge_fdb_entry *entry;
+	uint32_t now = k_uptime_seconds();
+	size_t idx = fdb_hash(addr);
+
+	for (size_t i = 0; i < FDB_SIZE; i++) {
+		entry = &ctx->fdb[(idx + i) % FDB_SIZE];
+
+		if (entry->port == 0) {
+			break;
+		}
+
+		if (fdb_entry_is_valid(entry, now) &&
+		    memcmp(entry->addr, addr, NET_ETH_ADDR_LEN) == 0) {
+			return entry->port - 1;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static void fdb_flush_port(struct eth_bridge_iface_context *ctx, size_t port)
+{
+	ARRAY_FOR_EACH_PTR(ctx->fdb, entry) {
+		if (entry->port == port + 1) {
+			entry->port = FDB_PORT_STALE;
+		}
+	}
+}
+
+#endif /* CONFIG_NET_ETHERNET_BRIDGE_FDB */
+
 struct ud {
 	eth_bridge_cb_t cb;
 	void *user_data;
@@ -206,6 +306,11 @@ int eth_bridge_iface_remove(struct net_if *br, struct net_if *iface)
 			ctx->eth_iface[i] = NULL;
 			eth_ctx->bridge = NULL;
 			found = true;
+
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+			/* The port may be reused by another interface */
+			fdb_flush_port(ctx, i);
+#endif
 		}
 
 		/* Calculate how many interfaces are added to this bridge */
@@ -352,13 +457,77 @@ static int bridge_iface_stop(const struct device *dev)
 	return 0;
 }
 
+static bool bridge_port_is_fwd(struct net_if *port, struct net_if *orig_iface)
+{
+	/* Skip it if not up */
+	return port != NULL && port != orig_iface && net_if_flag_is_set(port, NET_IF_UP);
+}
+
+static void bridge_fwd(struct net_if *port, struct net_pkt *pkt, bool is_send)
+{
+	net_pkt_set_family(pkt, AF_UNSPEC);
+	net_pkt_set_iface(pkt, port);
+	net_if_queue_tx(port, pkt);
+
+	NET_DBG("%s iface %d pkt %p (ref %d)",
+		is_send ? "Send" : "Recv",
+		net_if_get_by_iface(port),
+		pkt, (int)atomic_get(&pkt->atomic_ref));
+}
+
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+/* Returns true if pkt was consumed by a known destination */
+static bool bridge_fdb_process(struct eth_bridge_iface_context *ctx, struct net_if *orig_iface,
+			       struct net_pkt *pkt, bool is_send)
+{
+	struct net_eth_hdr *hdr = NET_ETH_HDR(pkt);
+	struct net_if *port;
+	int idx;
+
+	if (!net_eth_is_addr_group(&hdr->src)) {
+		ARRAY_FOR_EACH(ctx->eth_iface, i) {
+			if (orig_iface != NULL && ctx->eth_iface[i] == orig_iface) {
+				fdb_learn(ctx, hdr->src.addr, i);
+				break;
+			}
+		}
+	}
+
+	if (net_eth_is_addr_group(&hdr->dst)) {
+		return false;
+	}
+
+	idx = fdb_lookup(ctx, hdr->dst.addr);
+	if (idx < 0) {
+		return false;
+	}
+
+	port = ctx->eth_iface[idx];
+
+	if (port == orig_iface) {
+		/* The destination is on the network the packet came from */
+		NET_DBG("DROP: same port");
+		net_pkt_unref(pkt);
+		return true;
+	}
+
+	if (!bridge_port_is_fwd(port, orig_iface)) {
+		return false;
+	}
+
+	bridge_fwd(port, pkt, is_send);
+
+	return true;
+}
+#endif /* CONFIG_NET_ETHERNET_BRIDGE_FDB */
+
 static enum net_verdict bridge_iface_process(struct net_if *iface,
 					     struct net_pkt *pkt,
 					     bool is_send)
 {
 	struct eth_bridge_iface_context *ctx = net_if_get_device(iface)->data;
 	struct net_if *orig_iface;
-	struct net_pkt *send_pkt = pkt;
+	struct net_pkt *send_pkt = NULL;
 	int fwd_iface_num = 0;
 
 	/* Drop all link-local packets for now. */
@@ -372,48 +541,49 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 
 	orig_iface = net_pkt_orig_iface(pkt);
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	if (bridge_fdb_process(ctx, orig_iface, pkt, is_send)) {
+		unlock_bridge(ctx);
+		return NET_OK;
+	}
+#endif
+
 	/* Get interface number to forward */
 	ARRAY_FOR_EACH(ctx->eth_iface, i) {
-		if (ctx->eth_iface[i] != NULL && ctx->eth_iface[i] != orig_iface) {
-			/* Skip it if not up */
-			if (!net_if_flag_is_set(ctx->eth_iface[i], NET_IF_UP)) {
-				continue;
-			}
+		if (bridge_port_is_fwd(ctx->eth_iface[i], orig_iface)) {
 			fwd_iface_num++;
 		}
 	}
 
 	/* Forward pkt to other interfaces */
 	ARRAY_FOR_EACH(ctx->eth_iface, i) {
-		if (ctx->eth_iface[i] != NULL && ctx->eth_iface[i] != orig_iface) {
-			/* Skip it if not up */
-			if (!net_if_flag_is_set(ctx->eth_iface[i], NET_IF_UP)) {
-				continue;
-			}
+		if (!bridge_port_is_fwd(ctx->eth_iface[i], orig_iface)) {
+			continue;
+		}
 
-			/* Clone the packet if we have more than two interfaces in the bridge
-			 * because the first send might mess the data part of the message.
-			 */
-			if (fwd_iface_num > 1) {
+		/* Clone the packet for all but the last interface, because a send
+		 * might mess the data part of the message. The last one gets the
+		 * original packet once all clones are done.
+		 */
+		if (--fwd_iface_num > 0) {
+			if (IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE_SHARE_BUFFERS)) {
+				send_pkt = net_pkt_shallow_clone(pkt, K_NO_WAIT);
+			} else {
 				send_pkt = net_pkt_clone(pkt, K_NO_WAIT);
-				if (send_pkt == NULL) {
-					NET_DBG("DROP: clone failed");
-					break;
-				}
 			}
 
-			net_pkt_set_family(send_pkt, AF_UNSPEC);
-			net_pkt_set_iface(send_pkt, ctx->eth_iface[i]);
-			net_if_queue_tx(ctx->eth_iface[i], send_pkt);
-
-			NET_DBG("%s iface %d pkt %p (ref %d)",
-				is_send ? "Send" : "Recv",
-				net_if_get_by_iface(ctx->eth_iface[i]),
-				send_pkt, (int)atomic_get(&send_pkt->atomic_ref));
+			if (send_pkt == NULL) {
+				NET_DBG("DROP: clone failed");
+				break;
+			}
+		} else {
+			send_pkt = pkt;
 		}
+
+		bridge_fwd(ctx->eth_iface[i], send_pkt, is_send);
 	}
 
-	/* Free pkt if cloned pkt is used to send */
+	/* Free pkt if it was not sent */
 	if (send_pkt != pkt) {
 		net_pkt_unref(pkt);
 	}
@@ -46,23 +46,32 @@ int dsa_xmit(const struct device *dev, struct net_pkt *pkt)
 	/*
 	 * In case of using TX pkt in other places, pkt should not be changed.
 	 * Here just clone pkt to use for tagging and sending.
-	 * It could be optimized here for performance in the future if some mechanism
-	 * implemented marks whether the pkt data will be accessed or not in other
-	 * places after sending.
+	 * Bridged packets are not accessed any more once sent, so they are tagged
+	 * in place unless their data is shared with packets sent to other ports.
 	 */
-	clone = net_pkt_clone(pkt, K_NO_WAIT);
-	if (clone == NULL) {
-		return -ENOBUFS;
+	if (net_pkt_is_l2_bridged(pkt) && pkt->frags->ref == 1) {
+		clone = NULL;
+	} else {
+		clone = net_pkt_clone(pkt, K_NO_WAIT);
+		if (clone == NULL) {
+			return -ENOBUFS;
+		}
 	}
 
 	/* Tag protocol handles pkt first */
-	dsa_pkt = dsa_tag_xmit(iface, clone);
+	dsa_pkt = dsa_tag_xmit(iface, clone != NULL ? clone : pkt);
 
 	/* Transmit from conduit port */
-	ret = eth_api_conduit->send(dev_conduit, dsa_pkt);
+	if (dsa_pkt != NULL) {
+		ret = eth_api_conduit->send(dev_conduit, dsa_pkt);
+	} else {
+		ret = -ENOBUFS;
+	}
 
 	/* Release the cloned pkt */
-	net_pkt_unref(clone);
+	if (clone != NULL) {
+		net_pkt_unref(clone);
+	}
 
 	return ret;
 }
@@ -99,35 +99,48 @@ struct net_pkt *dsa_tag_netc_xmit(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct device *dev = net_if_get_device(iface);
 	struct dsa_port_config *cfg = (struct dsa_port_config *)dev->config;
-	struct net_buf *header_buf;
+	bool is_ptp = ntohs(NET_ETH_HDR(pkt)->type) == NET_ETH_PTYPE_PTP;
+	struct net_buf *header_buf = NULL;
 	size_t header_len = NET_ETH_ADDR_LEN * 2;
 	netc_swt_tag_common_t *tag_common;
+	size_t tag_len;
+	uint8_t *header;
 	void *tag;
 
 	/* Tag is inserted after DMAC/SMAC fields. Decide header size per tag type. */
-	if (ntohs(NET_ETH_HDR(pkt)->type) == NET_ETH_PTYPE_PTP) {
+	if (is_ptp) {
 		header_len += sizeof(netc_swt_tag_port_two_step_ts_t);
 	} else {
 		header_len += sizeof(netc_swt_tag_port_no_ts_t);
 	}
 
-	/* Allocate net_buf for header */
-	header_buf = net_buf_alloc_len(net_buf_pool_get(pkt->buffer->pool_id),
-				       header_len, K_NO_WAIT);
-	if (!header_buf) {
-		LOG_ERR("Cannot allocate header buffer");
-		return NULL;
-	}
+	tag_len = header_len - NET_ETH_ADDR_LEN * 2;
 
-	header_buf->len = header_len;
+	if (net_buf_headroom(pkt->frags) >= tag_len && pkt->frags->ref == 1) {
+		/* Move DMAC/SMAC into the headroom to make room for the tag */
+		header = net_buf_push(pkt->frags, tag_len);
+		memmove(header, header + tag_len, NET_ETH_ADDR_LEN * 2);
+	} else {
+		/* Allocate net_buf for header */
+		header_buf = net_buf_alloc_len(net_buf_pool_get(pkt->buffer->pool_id),
+					       header_len, K_NO_WAIT);
+		if (!header_buf) {
+			LOG_ERR("Cannot allocate header buffer");
+			return NULL;
+		}
 
-	/* Fill the header */
-	memcpy(header_buf->data, pkt->frags->data, NET_ETH_ADDR_LEN * 2);
-	tag = (void *)((uintptr_t)header_buf->data + NET_ETH_ADDR_LEN * 2);
+		header_buf->len = header_len;
+		header = header_buf->data;
+
+		/* Fill the header */
+		memcpy(header, pkt->frags->data, NET_ETH_ADDR_LEN * 2);
+	}
+
+	tag = header + NET_ETH_ADDR_LEN * 2;
 
 #ifdef CONFIG_NET_L2_PTP
 	/* Enable two-step timestamping for gPTP. */
-	if (ntohs(NET_ETH_HDR(pkt)->type) == NET_ETH_PTYPE_PTP) {
+	if (is_ptp) {
 
 		/* Utilize control block for timestamp request ID */
 		((netc_swt_tag_port_two_step_ts_t *)tag)->tsReqId = pkt->cb.cb[0] & 0xf;
@@ -147,12 +160,14 @@ struct net_pkt *dsa_tag_netc_xmit(struct net_if *iface, struct net_pkt *pkt)
 	tag_common->swtId = 1;
 	tag_common->port = cfg->port_idx;
 
-	/* Drop DMAC/SMAC on original frag */
-	net_buf_pull(pkt->frags, NET_ETH_ADDR_LEN * 2);
+	if (header_buf != NULL) {
+		/* Drop DMAC/SMAC on original frag */
+		net_buf_pull(pkt->frags, NET_ETH_ADDR_LEN * 2);
 
-	/* Insert header */
-	header_buf->frags = pkt->frags;
-	pkt->frags = header_buf;
+		/* Insert header */
+		header_buf->frags = pkt->frags;
+		pkt->frags = header_buf;
+	}
 
 	net_pkt_cursor_init(pkt);
 	return pkt;
@@ -7,6 +7,7 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 
+#include <zephyr/init.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_l2.h>
 #include <zephyr/net/net_if.h>
@@ -1064,6 +1065,69 @@ int net_eth_mac_filter(struct net_if *iface, struct net_eth_addr *mac,
 #endif
 }
 
+#if defined(CONFIG_NET_ETHERNET_NAPI)
+static struct k_work_q napi_work_q;
+static K_KERNEL_STACK_DEFINE(napi_stack, CONFIG_NET_ETHERNET_NAPI_STACK_SIZE);
+
+static void napi_handler(struct k_work *work)
+{
+	struct net_eth_napi *napi = CONTAINER_OF(work, struct net_eth_napi, work);
+
+	if (napi->poll(napi, CONFIG_NET_ETHERNET_NAPI_BUDGET) >=
+	    CONFIG_NET_ETHERNET_NAPI_BUDGET) {
+		/* More frames are pending, let the other drivers run first */
+		k_work_submit_to_queue(&napi_work_q, work);
+		return;
+	}
+
+	/* Clear the flag first, the interrupt may fire again as soon as it
+	 * is unmasked.
+	 */
+	atomic_clear(&napi->scheduled);
+	napi->complete(napi);
+}
+
+void net_eth_napi_init(struct net_eth_napi *napi, net_eth_napi_poll_t poll,
+		       net_eth_napi_complete_t complete)
+{
+	k_work_init(&napi->work, napi_handler);
+	atomic_clear(&napi->scheduled);
+	napi->poll = poll;
+	napi->complete = complete;
+}
+
+void net_eth_napi_schedule(struct net_eth_napi *napi)
+{
+	if (atomic_cas(&napi->scheduled, 0, 1)) {
+		k_work_submit_to_queue(&napi_work_q, &napi->work);
+	}
+}
+
+#if defined(CONFIG_NET_TC_THREAD_COOPERATIVE)
+#define NAPI_THREAD_PRIORITY K_PRIO_COOP(CONFIG_NET_ETHERNET_NAPI_THREAD_PRIO)
+#else
+#define NAPI_THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NET_ETHERNET_NAPI_THREAD_PRIO)
+#endif
+
+/* Started before the drivers, which may schedule a poll from their
+ * interrupt handler as soon as they are initialized.
+ */
+static int napi_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "eth_napi",
+	};
+
+	k_work_queue_start(&napi_work_q, napi_stack,
+			   K_KERNEL_STACK_SIZEOF(napi_stack), NAPI_THREAD_PRIORITY,
+			   &cfg);
+
+	return 0;
+}
+
+SYS_INIT(napi_work_q_init, POST_KERNEL, 0);
+#endif /* CONFIG_NET_ETHERNET_NAPI */
+
 void ethernet_init(struct net_if *iface)
 {
 	struct ethernet_context *ctx = net_if_l2_data(iface);
@@ -120,6 +120,18 @@ static bool gptp_handle_critical_msg(struct net_if *iface, struct net_pkt *pkt)
 
 		handled = true;
 		break;
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+	case GPTP_SYNC_MESSAGE:
+	case GPTP_FOLLOWUP_MESSAGE:
+		port = gptp_get_port_number(iface);
+		if (port == -ENODEV) {
+			NET_DBG("No port found for gPTP buffer");
+			return handled;
+		}
+
+		handled = gptp_md_sync_rx_fast_path(port, pkt);
+		break;
+#endif
 	default:
 		/* Not a critical message, this will be handled later. */
 		break;
@@ -912,18 +924,87 @@ int gptp_get_port_data(struct gptp_domain *domain,
 	return 0;
 }
 
-double gptp_servo_pi(int64_t nanosecond_diff)
+#if CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES > 1
+/* Least squares slope of the offsets against the local time, in ppb */
+static double gptp_servo_freq_estimate(void)
+{
+	const int n = CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES;
+	double mean_t = 0.0, mean_o = 0.0;
+	double num = 0.0, den = 0.0;
+
+	for (int i = 0; i < n; i++) {
+		mean_t += (double)(gptp_clock.freq_est_time[i] - gptp_clock.freq_est_time[0]);
+		mean_o += (double)gptp_clock.freq_est_offset[i];
+	}
+
+	mean_t /= n;
+	mean_o /= n;
+
+	for (int i = 0; i < n; i++) {
+		double t = (double)(gptp_clock.freq_est_time[i] -
+				    gptp_clock.freq_est_time[0]) - mean_t;
+
+		num += t * ((double)gptp_clock.freq_est_offset[i] - mean_o);
+		den += t * t;
+	}
+
+	if (den == 0.0) {
+		return 0.0;
+	}
+
+	return num / den * NSEC_PER_SEC;
+}
+#endif
+
+double gptp_servo_pi(int64_t nanosecond_diff, uint64_t local_time)
 {
-	double kp = 0.7;
-	double ki = 0.3;
+	double kp = CONFIG_NET_GPTP_SERVO_KP / 1000.0;
+	double ki = CONFIG_NET_GPTP_SERVO_KI / 1000.0;
+	double kd = CONFIG_NET_GPTP_SERVO_KD / 1000.0;
 	double ppb;
 
+#if CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES > 1
+	if (gptp_clock.freq_est_count < CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES) {
+		gptp_clock.freq_est_offset[gptp_clock.freq_est_count] = nanosecond_diff;
+		gptp_clock.freq_est_time[gptp_clock.freq_est_count] = local_time;
+
+		if (++gptp_clock.freq_est_count < CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES) {
+			/* Keep the current rate until the estimate is known */
+			return gptp_clock.pi_drift;
+		}
+
+		gptp_clock.pi_drift = gptp_servo_freq_estimate();
+		NET_DBG("Estimated frequency offset %d ppb", (int)gptp_clock.pi_drift);
+	}
+#else
+	ARG_UNUSED(local_time);
+#endif
+
 	gptp_clock.pi_drift += ki * nanosecond_diff;
 	ppb = kp * nanosecond_diff + gptp_clock.pi_drift;
 
+	if (gptp_clock.prev_offset_valid) {
+		ppb += kd * (nanosecond_diff - gptp_clock.prev_offset);
+	}
+
+	gptp_clock.prev_offset = nanosecond_diff;
+	gptp_clock.prev_offset_valid = true;
+
 	return ppb;
 }
 
+void gptp_servo_step(void)
+{
+	gptp_clock.prev_offset_valid = false;
+
+#if CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES > 1
+	/* Start the estimation over if the step happened in the middle of it */
+	if (gptp_clock.freq_est_count < CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES) {
+		gptp_clock.freq_est_count = 0;
+	}
+#endif
+}
+
 static void init_ports(void)
 {
 	net_if_foreach(gptp_add_port, &gptp_domain.default_ds.nb_ports);
@@ -944,6 +1025,10 @@ void net_gptp_init(void)
 
 	gptp_clock.domain = &gptp_domain;
 	gptp_clock.pi_drift = 0.0;
+	gptp_clock.prev_offset_valid = false;
+#if CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES > 1
+	gptp_clock.freq_est_count = 0;
+#endif
 
 	init_ports();
 }
@@ -114,32 +114,15 @@ static void gptp_md_follow_up_prepare(struct net_pkt *pkt,
 		ntohl(fup->tlv.scaled_last_gm_freq_change);
 }
 
-static int gptp_set_md_sync_receive(int port,
+/* Fill all of the MDSyncReceive structure but the upstream transmit time */
+static void gptp_md_sync_info_parse(const struct gptp_port_identity *src_port_id,
+				    const struct gptp_hdr *fup_hdr,
+				    const struct gptp_follow_up *fup,
 				    struct gptp_md_sync_info *sync_rcv)
 {
-	struct gptp_sync_rcv_state *state;
-	struct gptp_port_ds *port_ds;
-	struct gptp_hdr *sync_hdr, *fup_hdr;
-	struct gptp_follow_up *fup;
-	struct net_ptp_time *sync_ts;
-	double prop_delay_rated;
-	double delay_asymmetry_rated;
-
-	state = &GPTP_PORT_STATE(port)->sync_rcv;
-	if (!state->rcvd_sync_ptr || !state->rcvd_follow_up_ptr) {
-		return -EINVAL;
-	}
-
-	port_ds = GPTP_PORT_DS(port);
-
-	sync_hdr = GPTP_HDR(state->rcvd_sync_ptr);
-	fup_hdr = GPTP_HDR(state->rcvd_follow_up_ptr);
-	fup = GPTP_FOLLOW_UP(state->rcvd_follow_up_ptr);
-	sync_ts = &state->rcvd_sync_ptr->timestamp;
-
 	sync_rcv->follow_up_correction_field =
 		(ntohll(fup_hdr->correction_field) >> 16);
-	memcpy(&sync_rcv->src_port_id, &sync_hdr->port_id,
+	memcpy(&sync_rcv->src_port_id, src_port_id,
 	       sizeof(struct gptp_port_identity));
 	sync_rcv->log_msg_interval = fup_hdr->log_msg_interval;
 	sync_rcv->precise_orig_ts._sec.high =
@@ -147,7 +130,31 @@ static int gptp_set_md_sync_receive(int port,
 	sync_rcv->precise_orig_ts._sec.low = ntohl(fup->prec_orig_ts_secs_low);
 	sync_rcv->precise_orig_ts.nanosecond = ntohl(fup->prec_orig_ts_nsecs);
 
-	/* Compute time when sync was sent by the remote. */
+	sync_rcv->rate_ratio = ntohl(fup->tlv.cumulative_scaled_rate_offset);
+	sync_rcv->rate_ratio /= GPTP_POW2_41;
+	sync_rcv->rate_ratio += 1;
+
+	sync_rcv->gm_time_base_indicator =
+		ntohs(fup->tlv.gm_time_base_indicator);
+	sync_rcv->last_gm_phase_change.high =
+		ntohl(fup->tlv.last_gm_phase_change.high);
+	sync_rcv->last_gm_phase_change.low =
+		ntohll(fup->tlv.last_gm_phase_change.low);
+	sync_rcv->last_gm_freq_change =
+		ntohl(fup->tlv.scaled_last_gm_freq_change);
+}
+
+/* Compute time when sync was sent by the remote. */
+static void gptp_md_sync_upstream_tx_time(int port,
+					  const struct net_ptp_time *sync_ts,
+					  struct gptp_md_sync_info *sync_rcv)
+{
+	struct gptp_port_ds *port_ds;
+	double prop_delay_rated;
+	double delay_asymmetry_rated;
+
+	port_ds = GPTP_PORT_DS(port);
+
 	sync_rcv->upstream_tx_time = sync_ts->second;
 	sync_rcv->upstream_tx_time *= NSEC_PER_SEC;
 	sync_rcv->upstream_tx_time += sync_ts->nanosecond;
@@ -161,23 +168,143 @@ static int gptp_set_md_sync_receive(int port,
 	delay_asymmetry_rated /= port_ds->neighbor_rate_ratio;
 
 	sync_rcv->upstream_tx_time -= delay_asymmetry_rated;
+}
 
-	sync_rcv->rate_ratio = ntohl(fup->tlv.cumulative_scaled_rate_offset);
-	sync_rcv->rate_ratio /= GPTP_POW2_41;
-	sync_rcv->rate_ratio += 1;
+static int gptp_set_md_sync_receive(int port,
+				    struct gptp_md_sync_info *sync_rcv)
+{
+	struct gptp_sync_rcv_state *state;
 
-	sync_rcv->gm_time_base_indicator =
-		ntohs(fup->tlv.gm_time_base_indicator);
-	sync_rcv->last_gm_phase_change.high =
-		ntohl(fup->tlv.last_gm_phase_change.high);
-	sync_rcv->last_gm_phase_change.low =
-		ntohll(fup->tlv.last_gm_phase_change.low);
-	sync_rcv->last_gm_freq_change =
-		ntohl(fup->tlv.scaled_last_gm_freq_change);
+	state = &GPTP_PORT_STATE(port)->sync_rcv;
+	if (!state->rcvd_sync_ptr || !state->rcvd_follow_up_ptr) {
+		return -EINVAL;
+	}
+
+	gptp_md_sync_info_parse(&GPTP_HDR(state->rcvd_sync_ptr)->port_id,
+				GPTP_HDR(state->rcvd_follow_up_ptr),
+				GPTP_FOLLOW_UP(state->rcvd_follow_up_ptr),
+				sync_rcv);
+	gptp_md_sync_upstream_tx_time(port, &state->rcvd_sync_ptr->timestamp,
+				      sync_rcv);
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+/* The RX path is the only producer of the tuples of a port and the
+ * SyncReceive state machine their only consumer, so the indices need no lock.
+ */
+static int gptp_md_sync_tuple_put(struct gptp_sync_rcv_state *state,
+				  const struct gptp_hdr *fup_hdr,
+				  const struct gptp_follow_up *fup)
+{
+	atomic_val_t head = atomic_get(&state->tuple_head);
+	struct gptp_sync_tuple *tuple;
+
+	if (head - atomic_get(&state->tuple_tail) >= GPTP_SYNC_TUPLES) {
+		return -ENOBUFS;
+	}
+
+	tuple = &state->tuples[head % GPTP_SYNC_TUPLES];
+	tuple->sync_ts = state->rx_sync.sync_ts;
+	gptp_md_sync_info_parse(&state->rx_sync.info.src_port_id, fup_hdr, fup,
+				&tuple->info);
+
+	/* Publish the tuple only once it is complete */
+	atomic_set(&state->tuple_head, head + 1);
 
 	return 0;
 }
 
+bool gptp_md_sync_rx_fast_path(int port, struct net_pkt *pkt)
+{
+	struct gptp_sync_rcv_state *state;
+	struct gptp_hdr *hdr = GPTP_HDR(pkt);
+	int64_t sync_itv_ms;
+
+	state = &GPTP_PORT_STATE(port)->sync_rcv;
+
+	switch (hdr->message_type) {
+	case GPTP_SYNC_MESSAGE:
+		if (GPTP_CHECK_LEN(pkt, GPTP_SYNC_LEN)) {
+			/* Let the regular path report it */
+			return false;
+		}
+
+		memcpy(&state->rx_sync.info.src_port_id, &hdr->port_id,
+		       sizeof(struct gptp_port_identity));
+		state->rx_sync.sync_ts = pkt->timestamp;
+		state->rx_sync_time = k_uptime_get();
+		state->rx_sync_seq_id = hdr->sequence_id;
+		state->rx_sync_log_itv = hdr->log_msg_interval;
+		state->rx_sync_valid = true;
+
+		GPTP_STATS_INC(port, rx_sync_count);
+		return true;
+
+	case GPTP_FOLLOWUP_MESSAGE:
+		if (GPTP_CHECK_LEN(pkt, GPTP_FOLLOW_UP_LEN)) {
+			return false;
+		}
+
+		if (!state->rx_sync_valid || state->rx_sync_seq_id != hdr->sequence_id) {
+			NET_DBG("%s sequence id %d %s", "FOLLOWUP",
+				ntohs(hdr->sequence_id), "has no matching SYNC");
+			GPTP_STATS_INC(port, rx_ptp_packet_discard_count);
+			return true;
+		}
+
+		state->rx_sync_valid = false;
+
+		/* Same delay as the follow_up_discard_timer of the regular path */
+		sync_itv_ms = MSEC_PER_SEC * GPTP_POW2(state->rx_sync_log_itv);
+		if (k_uptime_get() - state->rx_sync_time > sync_itv_ms) {
+			GPTP_STATS_INC(port, rx_ptp_packet_discard_count);
+			return true;
+		}
+
+		if (gptp_md_sync_tuple_put(state, hdr, GPTP_FOLLOW_UP(pkt)) < 0) {
+			GPTP_STATS_INC(port, rx_ptp_packet_discard_count);
+			return true;
+		}
+
+		GPTP_STATS_INC(port, rx_fup_count);
+		return true;
+
+	default:
+		break;
+	}
+
+	return false;
+}
+
+/* Hand the latest tuple over to PortSyncSyncReceive, older ones are stale */
+static void gptp_md_sync_tuples_process(int port, bool discard)
+{
+	struct gptp_sync_rcv_state *state;
+	struct gptp_pss_rcv_state *pss_state;
+	atomic_val_t head;
+
+	state = &GPTP_PORT_STATE(port)->sync_rcv;
+	pss_state = &GPTP_PORT_STATE(port)->pss_rcv;
+
+	head = atomic_get(&state->tuple_head);
+	if (head == atomic_get(&state->tuple_tail)) {
+		return;
+	}
+
+	if (!discard) {
+		struct gptp_sync_tuple *tuple = &state->tuples[(head - 1) % GPTP_SYNC_TUPLES];
+
+		pss_state->sync_rcv = tuple->info;
+		gptp_md_sync_upstream_tx_time(port, &tuple->sync_ts, &pss_state->sync_rcv);
+		pss_state->rcvd_md_sync = true;
+	}
+
+	atomic_set(&state->tuple_tail, head);
+}
+#endif /* CONFIG_NET_GPTP_RX_FAST_PATH */
+
 static void gptp_md_pdelay_reset(int port)
 {
 	struct gptp_pdelay_req_state *state;
@@ -770,9 +897,19 @@ static void gptp_md_sync_receive_state_machine(int port)
 		state->rcvd_sync = false;
 		state->rcvd_follow_up = false;
 		state->state = GPTP_SYNC_RCV_DISCARD;
+
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+		gptp_md_sync_tuples_process(port, true);
+#endif
 		return;
 	}
 
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+	/* Sync and Follow Up messages were already paired on the RX path. */
+	gptp_md_sync_tuples_process(port, false);
+	return;
+#endif
+
 	switch (state->state) {
 	case GPTP_SYNC_RCV_DISCARD:
 	case GPTP_SYNC_RCV_WAIT_SYNC:
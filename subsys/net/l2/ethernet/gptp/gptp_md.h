@@ -54,6 +54,22 @@ struct gptp_md_sync_info {
 	int8_t log_msg_interval;
 };
 
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+/** Number of Sync and Follow Up pairs the RX path can queue per port. */
+#define GPTP_SYNC_TUPLES 2
+
+/**
+ * @brief Sync and Follow Up pair extracted on the RX path.
+ */
+struct gptp_sync_tuple {
+	/** MDSyncReceive information, but the upstream transmit time. */
+	struct gptp_md_sync_info info;
+
+	/** Ingress timestamp of the Sync message. */
+	struct net_ptp_time sync_ts;
+};
+#endif
+
 /**
  * @brief Initialize all Media Dependent State Machines.
  */
@@ -66,6 +82,23 @@ void gptp_md_init_state_machine(void);
  */
 void gptp_md_state_machines(int port);
 
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+/**
+ * @brief Handle a Sync or Follow Up message in the RX path.
+ *
+ * The timestamps and the Follow Up information are copied out so that the
+ * packet is released right away, and the resulting pair is queued for the
+ * SyncReceive state machine.
+ *
+ * @param port Number of the port the message was received on.
+ * @param pkt Received message.
+ *
+ * @return True if the message was consumed, false if it must go through
+ *         the regular path.
+ */
+bool gptp_md_sync_rx_fast_path(int port, struct net_pkt *pkt);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
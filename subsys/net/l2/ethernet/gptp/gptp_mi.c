@@ -824,11 +824,13 @@ static void gptp_update_local_port_clock(void)
 			NET_INFO("Set local clock %"PRIu64".%09u", tm.second, tm.nanosecond);
 		}
 		ptp_clock_set(clk, &tm);
+		gptp_servo_step();
 
 	skip_clock_set:
 		irq_unlock(key);
 	} else {
-		double ppb = gptp_servo_pi(nanosecond_diff);
+		double ppb = gptp_servo_pi(nanosecond_diff,
+					   global_ds->sync_receipt_local_time);
 
 		ptp_clock_rate_adjust(clk, 1.0 + (ppb / 1000000000.0));
 
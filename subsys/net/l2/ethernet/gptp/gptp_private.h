@@ -38,6 +38,18 @@ struct gptp_clock_data {
 	struct gptp_domain *domain;
 	/** pi control drift value */
 	double pi_drift;
+	/** Offset given to the previous servo run */
+	int64_t prev_offset;
+	/** prev_offset can be used for the derivative term */
+	bool prev_offset_valid;
+#if CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES > 1
+	/** Offsets collected to estimate the frequency offset */
+	int64_t freq_est_offset[CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES];
+	/** Local times at which freq_est_offset were measured */
+	uint64_t freq_est_time[CONFIG_NET_GPTP_SERVO_FREQ_EST_SAMPLES];
+	/** Number of collected offsets */
+	int freq_est_count;
+#endif
 };
 
 extern struct gptp_clock_data gptp_clock;
@@ -133,10 +145,18 @@ static inline uint64_t gptp_timestamp_to_nsec(struct net_ptp_time *ts)
  * @brief gPTP PI servo.
  *
  * @param nanosecond_diff nanosecond offset.
+ * @param local_time local time at which the offset was measured, in ns.
  *
  * @return ppb value to adjust.
  */
-double gptp_servo_pi(int64_t nanosecond_diff);
+double gptp_servo_pi(int64_t nanosecond_diff, uint64_t local_time);
+
+/**
+ * @brief Tell the gPTP servo the local clock was stepped.
+ *
+ * Offsets measured before the step are not used anymore.
+ */
+void gptp_servo_step(void);
 
 /**
  * @brief Change the port state
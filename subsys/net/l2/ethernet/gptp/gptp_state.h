@@ -251,6 +251,32 @@ struct gptp_sync_rcv_state {
 
 	/** A Follow Up Message has been received. */
 	bool follow_up_timeout_expired;
+
+#if defined(CONFIG_NET_GPTP_RX_FAST_PATH)
+	/** Pairs handed over from the RX path. */
+	struct gptp_sync_tuple tuples[GPTP_SYNC_TUPLES];
+
+	/** Number of pairs produced by the RX path. */
+	atomic_t tuple_head;
+
+	/** Number of pairs consumed by the state machine. */
+	atomic_t tuple_tail;
+
+	/** Sync message waiting for its Follow Up in the RX path. */
+	struct gptp_sync_tuple rx_sync;
+
+	/** Uptime at which rx_sync was received, in milliseconds. */
+	int64_t rx_sync_time;
+
+	/** Sequence id of rx_sync, in network byte order. */
+	uint16_t rx_sync_seq_id;
+
+	/** Log Sync Interval of rx_sync. */
+	int8_t rx_sync_log_itv;
+
+	/** rx_sync is waiting for its Follow Up. */
+	bool rx_sync_valid;
+#endif
 };
 
 /* SyncSend state machine variables. */
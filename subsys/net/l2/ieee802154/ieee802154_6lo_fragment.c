@@ -35,13 +35,18 @@ LOG_MODULE_REGISTER(net_ieee802154_6lo_fragment, CONFIG_NET_L2_IEEE802154_LOG_LE
 
 /**
  *  Reassemble cache : Depends on cache size it used for reassemble
- *  IPv6 packets simultaneously.
+ *  IPv6 packets simultaneously. A datagram is identified by its source
+ *  link layer address, size and tag (RFC 4944, section 5.3), those select
+ *  the slot its lookup starts from.
  */
 struct frag_cache {
 	struct k_work_delayable timer; /* Reassemble timer */
 	struct net_pkt *pkt;	       /* Reassemble packet */
 	uint16_t size;		       /* Datagram size */
 	uint16_t tag;		       /* Datagram tag */
+	uint16_t received;	       /* Payload bytes received, w/o frag headers */
+	int16_t hdr_diff;	       /* Uncompressed minus compressed header size */
+	bool first_received;	       /* FRAG1 is in the cache, hdr_diff is valid */
 	bool used;
 };
 
@@ -256,25 +261,17 @@ static void update_protocol_header_lengths(struct net_pkt *pkt, uint16_t size)
 	}
 }
 
-static inline void clear_reass_cache(uint16_t size, uint16_t tag)
+static void clear_reass_cache(struct frag_cache *fcache)
 {
-	uint8_t i;
-
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (!(cache[i].size == size && cache[i].tag == tag)) {
-			continue;
-		}
-
-		if (cache[i].pkt) {
-			net_pkt_unref(cache[i].pkt);
-		}
-
-		cache[i].pkt = NULL;
-		cache[i].size = 0U;
-		cache[i].tag = 0U;
-		cache[i].used = false;
-		k_work_cancel_delayable(&cache[i].timer);
+	if (fcache->pkt) {
+		net_pkt_unref(fcache->pkt);
 	}
+
+	fcache->pkt = NULL;
+	fcache->size = 0U;
+	fcache->tag = 0U;
+	fcache->used = false;
+	k_work_cancel_delayable(&fcache->timer);
 }
 
 /**
@@ -296,6 +293,17 @@ static void reass_timeout(struct k_work *work)
 	fcache->used = false;
 }
 
+static inline uint8_t reass_cache_slot(struct net_linkaddr *src, uint16_t size, uint16_t tag)
+{
+	uint32_t hash = ((uint32_t)tag << 16) ^ size;
+
+	for (uint8_t i = 0U; i < src->len; i++) {
+		hash = (hash * 31U) ^ src->addr[i];
+	}
+
+	return hash % REASS_CACHE_SIZE;
+}
+
 /**
  *  Upon reception of first fragment with respective of size and tag
  *  create a new cache. If number of unused cache are out then
@@ -303,39 +311,47 @@ static void reass_timeout(struct k_work *work)
  */
 static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t size, uint16_t tag)
 {
-	int i;
+	uint8_t slot = reass_cache_slot(net_pkt_lladdr_src(pkt), size, tag);
+
+	for (uint8_t i = 0U; i < REASS_CACHE_SIZE; i++) {
+		struct frag_cache *fcache = &cache[(slot + i) % REASS_CACHE_SIZE];
 
-	for (i = 0; i < REASS_CACHE_SIZE; i++) {
-		if (cache[i].used) {
+		if (fcache->used) {
 			continue;
 		}
 
-		cache[i].pkt = pkt;
-		cache[i].size = size;
-		cache[i].tag = tag;
-		cache[i].used = true;
-
-		k_work_init_delayable(&cache[i].timer, reass_timeout);
-		k_work_reschedule(&cache[i].timer, FRAG_REASSEMBLY_TIMEOUT);
-		return &cache[i];
+		fcache->pkt = pkt;
+		fcache->size = size;
+		fcache->tag = tag;
+		fcache->received = 0U;
+		fcache->hdr_diff = 0;
+		fcache->first_received = false;
+		fcache->used = true;
+
+		k_work_init_delayable(&fcache->timer, reass_timeout);
+		k_work_reschedule(&fcache->timer, FRAG_REASSEMBLY_TIMEOUT);
+		return fcache;
 	}
 
 	return NULL;
 }
 
 /**
- *  Return cache if it matches with size and tag of stored caches,
- *  otherwise return NULL.
+ *  Return cache if it matches with source, size and tag of stored caches,
+ *  otherwise return NULL. Slots freed in the meantime do not end the lookup,
+ *  but the matching cache is normally found in the very first one.
  */
-static inline struct frag_cache *get_reass_cache(uint16_t size, uint16_t tag)
+static inline struct frag_cache *get_reass_cache(struct net_linkaddr *src, uint16_t size,
+						 uint16_t tag)
 {
-	uint8_t i;
+	uint8_t slot = reass_cache_slot(src, size, tag);
 
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (cache[i].used) {
-			if (cache[i].size == size && cache[i].tag == tag) {
-				return &cache[i];
-			}
+	for (uint8_t i = 0U; i < REASS_CACHE_SIZE; i++) {
+		struct frag_cache *fcache = &cache[(slot + i) % REASS_CACHE_SIZE];
+
+		if (fcache->used && fcache->size == size && fcache->tag == tag &&
+		    net_linkaddr_cmp(net_pkt_lladdr_src(fcache->pkt), src)) {
+			return fcache;
 		}
 	}
 
@@ -355,41 +371,36 @@ static inline void fragment_append(struct net_pkt *pkt, struct net_buf *frag)
 	}
 }
 
-static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
+/* Account for a new fragment, returns false if it cannot be part of the datagram */
+static inline bool fragment_account(struct frag_cache *fcache, struct net_buf *frag)
 {
-	size_t len = 0U;
-	struct net_buf *frag;
+	uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
 	int hdr_diff;
-	uint8_t *data;
 
-	frag = pkt->buffer;
-	while (frag) {
-		uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
+	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
+		frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
 
-		if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
-		}
+		/* 6lo assumes that fragment header has been removed */
+		frag->data += NET_6LO_FRAG1_HDR_LEN;
+		hdr_diff = net_6lo_uncompress_hdr_diff(fcache->pkt);
+		frag->data -= NET_6LO_FRAG1_HDR_LEN;
 
-		len += frag->len - frag_hdr_len;
+		if (hdr_diff == INT_MAX || fcache->first_received) {
+			return false;
+		}
 
-		frag = frag->frags;
+		fcache->hdr_diff = hdr_diff;
+		fcache->first_received = true;
 	}
 
-	/* 6lo assumes that fragment header has been removed,
-	 * and in our side we assume first buffer is always the first fragment.
-	 */
-	data = pkt->buffer->data;
-	pkt->buffer->data += NET_6LO_FRAG1_HDR_LEN;
-
-	hdr_diff = net_6lo_uncompress_hdr_diff(pkt);
+	fcache->received += frag->len - frag_hdr_len;
 
-	pkt->buffer->data = data;
-
-	if (hdr_diff == INT_MAX) {
-		return 0;
-	}
+	return true;
+}
 
-	return len + hdr_diff;
+static inline bool fragment_cache_complete(struct frag_cache *fcache)
+{
+	return fcache->first_received && fcache->received + fcache->hdr_diff == fcache->size;
 }
 
 static inline uint16_t fragment_offset(struct net_buf *frag)
@@ -435,8 +446,8 @@ static inline void fragment_remove_headers(struct net_pkt *pkt)
 			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
 		}
 
-		memmove(frag->data, frag->data + frag_hdr_len, frag->len - frag_hdr_len);
-		frag->len -= frag_hdr_len;
+		/* Payloads stay in place, the fragments are only chained */
+		net_buf_pull(frag, frag_hdr_len);
 
 		frag = frag->frags;
 	}
@@ -507,7 +518,7 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 	 */
 	pkt->buffer = NULL;
 
-	fcache = get_reass_cache(size, tag);
+	fcache = get_reass_cache(net_pkt_lladdr_src(pkt), size, tag);
 	if (!fcache) {
 		fcache = set_reass_cache(pkt, size, tag);
 		if (!fcache) {
@@ -523,7 +534,18 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 
 	fragment_append(fcache->pkt, frag);
 
-	if (fragment_cached_pkt_len(fcache->pkt) == fcache->size) {
+	if (!fragment_account(fcache, frag)) {
+		NET_ERR("Invalid first fragment: datagram dropped");
+		if (first_frag) {
+			/* The caller releases pkt, along with frag */
+			fcache->pkt = NULL;
+		}
+
+		clear_reass_cache(fcache);
+		return NET_DROP;
+	}
+
+	if (fragment_cache_complete(fcache)) {
 		/* All fragments received - reassemble packet. */
 
 		if (!first_frag) {
@@ -537,7 +559,7 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 			fcache->pkt = NULL;
 		}
 
-		clear_reass_cache(size, tag);
+		clear_reass_cache(fcache);
 
 		if (!fragment_packet_valid(pkt)) {
 			NET_ERR("Invalid fragment type: packet dropped");
@@ -450,6 +450,155 @@ static int wifi_connect(uint64_t mgmt_request, struct net_if *iface,
 
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_CONNECT, wifi_connect);
 
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+struct wifi_bss_cache_entry {
+	struct net_if *iface;
+	struct wifi_scan_result result;
+	int64_t last_seen;
+	uint32_t scan_gen;
+};
+
+static struct wifi_bss_cache_entry bss_cache[CONFIG_WIFI_MGMT_BSS_CACHE_SIZE];
+static struct k_spinlock bss_cache_lock;
+static uint32_t bss_cache_scan_gen;
+
+static bool bss_cache_entry_expired(const struct wifi_bss_cache_entry *entry, int64_t now)
+{
+	return CONFIG_WIFI_MGMT_BSS_CACHE_MAX_AGE > 0 &&
+	       now - entry->last_seen > CONFIG_WIFI_MGMT_BSS_CACHE_MAX_AGE * MSEC_PER_SEC;
+}
+
+/* Entry to store a result in, NULL if it is weaker than all entries of this scan */
+static struct wifi_bss_cache_entry *bss_cache_slot(struct net_if *iface,
+						   const struct wifi_scan_result *result,
+						   int64_t now)
+{
+	struct wifi_bss_cache_entry *stale = NULL;
+	struct wifi_bss_cache_entry *weakest = NULL;
+
+	ARRAY_FOR_EACH_PTR(bss_cache, entry) {
+		if (entry->iface == NULL) {
+			stale = entry;
+			continue;
+		}
+
+		if (entry->iface == iface && entry->result.mac_length == result->mac_length &&
+		    memcmp(entry->result.mac, result->mac, result->mac_length) == 0) {
+			return entry;
+		}
+
+		if (entry->scan_gen != bss_cache_scan_gen || bss_cache_entry_expired(entry, now)) {
+			if (stale == NULL ||
+			    (stale->iface != NULL && entry->last_seen < stale->last_seen)) {
+				stale = entry;
+			}
+		} else if (weakest == NULL || entry->result.rssi < weakest->result.rssi) {
+			weakest = entry;
+		}
+	}
+
+	if (stale != NULL) {
+		return stale;
+	}
+
+	if (weakest != NULL && weakest->result.rssi < result->rssi) {
+		return weakest;
+	}
+
+	return NULL;
+}
+
+static void bss_cache_update(struct net_if *iface, const struct wifi_scan_result *result)
+{
+	k_spinlock_key_t key = k_spin_lock(&bss_cache_lock);
+	int64_t now = k_uptime_get();
+	struct wifi_bss_cache_entry *entry;
+
+	entry = bss_cache_slot(iface, result, now);
+	if (entry != NULL) {
+		entry->iface = iface;
+		entry->result = *result;
+		entry->last_seen = now;
+		entry->scan_gen = bss_cache_scan_gen;
+	}
+
+	k_spin_unlock(&bss_cache_lock, key);
+}
+
+int wifi_mgmt_bss_cache_get(struct net_if *iface, struct wifi_scan_result *results,
+			    size_t max_results)
+{
+	k_spinlock_key_t key = k_spin_lock(&bss_cache_lock);
+	int64_t now = k_uptime_get();
+	size_t count = 0;
+
+	ARRAY_FOR_EACH_PTR(bss_cache, entry) {
+		size_t i;
+
+		if (entry->iface != iface || bss_cache_entry_expired(entry, now)) {
+			continue;
+		}
+
+		/* Keep the strongest results, sorted */
+		for (i = count; i > 0 && results[i - 1].rssi < entry->result.rssi; i--) {
+			if (i < max_results) {
+				results[i] = results[i - 1];
+			}
+		}
+
+		if (i < max_results) {
+			results[i] = entry->result;
+			count = MIN(count + 1, max_results);
+		}
+	}
+
+	k_spin_unlock(&bss_cache_lock, key);
+
+	return count;
+}
+
+int wifi_mgmt_bss_cache_find(struct net_if *iface, const uint8_t *ssid, uint8_t ssid_length,
+			     struct wifi_scan_result *result)
+{
+	k_spinlock_key_t key = k_spin_lock(&bss_cache_lock);
+	const struct wifi_bss_cache_entry *best = NULL;
+	int64_t now = k_uptime_get();
+
+	ARRAY_FOR_EACH_PTR(bss_cache, entry) {
+		if (entry->iface != iface || bss_cache_entry_expired(entry, now) ||
+		    entry->result.ssid_length != ssid_length ||
+		    memcmp(entry->result.ssid, ssid, ssid_length) != 0) {
+			continue;
+		}
+
+		if (best == NULL || entry->result.rssi > best->result.rssi) {
+			best = entry;
+		}
+	}
+
+	if (best != NULL) {
+		*result = best->result;
+	}
+
+	k_spin_unlock(&bss_cache_lock, key);
+
+	return best != NULL ? 0 : -ENOENT;
+}
+
+void wifi_mgmt_bss_cache_flush(struct net_if *iface)
+{
+	k_spinlock_key_t key = k_spin_lock(&bss_cache_lock);
+
+	ARRAY_FOR_EACH_PTR(bss_cache, entry) {
+		if (iface == NULL || entry->iface == iface) {
+			entry->iface = NULL;
+		}
+	}
+
+	k_spin_unlock(&bss_cache_lock, key);
+}
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
 static void scan_result_cb(struct net_if *iface, int status,
 			    struct wifi_scan_result *entry)
 {
@@ -468,10 +617,14 @@ static void scan_result_cb(struct net_if *iface, int status,
 		return;
 	}
 
-#ifndef CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS_ONLY
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+	bss_cache_update(iface, entry);
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
+#if !defined(CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS_ONLY) && !defined(CONFIG_WIFI_MGMT_BSS_CACHE_ONLY)
 	net_mgmt_event_notify_with_info(NET_EVENT_WIFI_SCAN_RESULT, iface,
 					entry, sizeof(struct wifi_scan_result));
-#endif /* CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS_ONLY */
+#endif
 }
 
 static int wifi_scan(uint64_t mgmt_request, struct net_if *iface,
@@ -498,6 +651,13 @@ static int wifi_scan(uint64_t mgmt_request, struct net_if *iface,
 	params->scan_type = WIFI_SCAN_TYPE_PASSIVE;
 #endif /* CONFIG_WIFI_MGMT_FORCED_PASSIVE_SCAN */
 
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+	/* Results of this scan take precedence over the previous ones */
+	K_SPINLOCK(&bss_cache_lock) {
+		bss_cache_scan_gen++;
+	}
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
 	return wifi_mgmt_api->scan(dev, params, scan_result_cb);
 }
 
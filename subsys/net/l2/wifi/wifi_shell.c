@@ -173,10 +173,8 @@ static bool parse_number(const struct shell *sh, long *param, char *str,
 	return true;
 }
 
-static void handle_wifi_scan_result(struct net_mgmt_event_callback *cb)
+static void print_wifi_scan_result(const struct wifi_scan_result *entry)
 {
-	const struct wifi_scan_result *entry =
-		(const struct wifi_scan_result *)cb->info;
 	uint8_t mac_string_buf[sizeof("xx:xx:xx:xx:xx:xx")];
 	const struct shell *sh = context.sh;
 	uint8_t ssid_print[WIFI_SSID_MAX_LEN + 1];
@@ -206,6 +204,11 @@ static void handle_wifi_scan_result(struct net_mgmt_event_callback *cb)
 	   wifi_mfp_txt(entry->mfp));
 }
 
+static void handle_wifi_scan_result(struct net_mgmt_event_callback *cb)
+{
+	print_wifi_scan_result((const struct wifi_scan_result *)cb->info);
+}
+
 static int wifi_freq_to_channel(int frequency)
 {
 	int channel;
@@ -280,7 +283,7 @@ static void handle_wifi_raw_scan_result(struct net_mgmt_event_callback *cb)
 }
 #endif /* CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS */
 
-static void handle_wifi_scan_done(struct net_mgmt_event_callback *cb)
+static void handle_wifi_scan_done(struct net_mgmt_event_callback *cb, struct net_if *iface)
 {
 	const struct wifi_status *status =
 		(const struct wifi_status *)cb->info;
@@ -289,6 +292,14 @@ static void handle_wifi_scan_done(struct net_mgmt_event_callback *cb)
 	if (status->status) {
 		PR_WARNING("Scan request failed (%d)\n", status->status);
 	} else {
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE_ONLY
+		static struct wifi_scan_result results[CONFIG_WIFI_MGMT_BSS_CACHE_SIZE];
+		int count = wifi_mgmt_bss_cache_get(iface, results, ARRAY_SIZE(results));
+
+		for (int i = 0; i < count; i++) {
+			print_wifi_scan_result(&results[i]);
+		}
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE_ONLY */
 		PR("Scan request done\n");
 	}
 
@@ -565,7 +576,7 @@ static void wifi_mgmt_scan_event_handler(struct net_mgmt_event_callback *cb,
 		handle_wifi_scan_result(cb);
 		break;
 	case NET_EVENT_WIFI_SCAN_DONE:
-		handle_wifi_scan_done(cb);
+		handle_wifi_scan_done(cb, iface);
 		break;
 #ifdef CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS
 	case NET_EVENT_WIFI_RAW_SCAN_RESULT:
@@ -35,6 +35,12 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 			   bool response_truncated);
 static struct coap_client_internal_request *get_request_with_mid(struct coap_client *client,
 								 uint16_t mid);
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+static struct coap_client_block_slot *window_slot_with_mid(
+	struct coap_client_internal_request *internal_req, uint16_t mid);
+static void window_resend(struct coap_client *client,
+			  struct coap_client_internal_request *internal_req);
+#endif
 
 static int send_request(int sock, const void *buf, size_t len, int flags,
 			const struct sockaddr *dest_addr, socklen_t addrlen)
@@ -548,6 +554,22 @@ static void report_callback_error(struct coap_client_internal_request *internal_
 
 static bool timeout_expired(struct coap_client_internal_request *internal_req)
 {
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (internal_req->request_ongoing && internal_req->window.active) {
+		int64_t now = k_uptime_get();
+
+		for (int i = 0; i < COAP_CLIENT_BLOCK2_WINDOW; i++) {
+			struct coap_pending *pending = &internal_req->window.slots[i].pending;
+
+			if (pending->timeout != 0 && pending->timeout <= now - pending->t0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+#endif
+
 	if (internal_req->pending.timeout == 0) {
 		return false;
 	}
@@ -598,6 +620,12 @@ static void coap_client_resend_handler(struct coap_client *client)
 
 	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
 		if (timeout_expired(&client->requests[i])) {
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+			if (client->requests[i].window.active) {
+				window_resend(client, &client->requests[i]);
+				continue;
+			}
+#endif
 			if (!client->requests[i].coap_request.confirmable) {
 				release_internal_request(&client->requests[i]);
 				continue;
@@ -822,6 +850,11 @@ static struct coap_client_internal_request *get_request_with_mid(struct coap_cli
 			if (client->requests[i].last_id == (int)mid) {
 				return &client->requests[i];
 			}
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+			if (window_slot_with_mid(&client->requests[i], mid) != NULL) {
+				return &client->requests[i];
+			}
+#endif
 		}
 	}
 
@@ -833,6 +866,313 @@ static bool find_echo_option(const struct coap_packet *response, struct coap_opt
 	return coap_find_options(response, COAP_OPTION_ECHO, option, 1);
 }
 
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+/* Pipelined block-wise receive: blocks in [next, end) each hold the slot at their number
+ * modulo the window size, either waiting for their response or holding it until all the
+ * blocks before them are given to the application.
+ */
+static bool window_can_start(struct coap_client_internal_request *internal_req)
+{
+	return internal_req->coap_request.method == COAP_METHOD_GET &&
+	       !internal_req->is_observe && internal_req->send_blk_ctx.total_size == 0 &&
+	       !internal_req->window.active;
+}
+
+static struct coap_client_block_slot *window_slot(struct coap_client_internal_request *internal_req,
+						  uint32_t num)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+	struct coap_client_block_slot *slot = &window->slots[num % COAP_CLIENT_BLOCK2_WINDOW];
+
+	if (num < window->next || num >= window->end || slot->num != num) {
+		return NULL;
+	}
+
+	return slot;
+}
+
+static struct coap_client_block_slot *window_slot_with_mid(
+	struct coap_client_internal_request *internal_req, uint16_t mid)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+
+	for (uint32_t num = window->next; window->active && num < window->end; num++) {
+		struct coap_client_block_slot *slot = window_slot(internal_req, num);
+
+		if (slot != NULL && slot->len == 0 && slot->pending.id == mid) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+static int window_send_block(struct coap_client *client,
+			     struct coap_client_internal_request *internal_req,
+			     struct coap_client_block_slot *slot, bool resend)
+{
+	struct coap_block_context blk_ctx = internal_req->recv_blk_ctx;
+	int ret;
+
+	/* Build the request for the block of the slot, with its own message ID */
+	internal_req->recv_blk_ctx.current =
+		slot->num * coap_block_size_to_bytes(blk_ctx.block_size);
+	internal_req->last_id = resend ? slot->pending.id : coap_next_id();
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, true);
+	internal_req->recv_blk_ctx = blk_ctx;
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		return ret;
+	}
+
+	if (!resend) {
+		struct coap_transmission_parameters params = internal_req->pending.params;
+
+		ret = coap_pending_init(&slot->pending, &internal_req->request, &client->address,
+					&params);
+		if (ret < 0) {
+			LOG_ERR("Error creating pending");
+			return ret;
+		}
+
+		if (coap_header_get_type(&internal_req->request) == COAP_TYPE_NON_CON) {
+			slot->pending.retries = 0;
+		}
+		coap_pending_cycle(&slot->pending);
+	}
+
+	/* Keep the exchange alive for as long as blocks are requested */
+	internal_req->pending.t0 = k_uptime_get();
+
+	ret = send_request(client->fd, internal_req->request.data, internal_req->request.offset,
+			   0, &client->address, client->socklen);
+
+	return ret < 0 ? ret : 0;
+}
+
+static int window_fill(struct coap_client *client,
+		       struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+	int ret;
+
+	while (window->end - window->next < COAP_CLIENT_BLOCK2_WINDOW &&
+	       window->end <= window->last) {
+		struct coap_client_block_slot *slot =
+			&window->slots[window->end % COAP_CLIENT_BLOCK2_WINDOW];
+
+		slot->num = window->end;
+		slot->len = 0;
+
+		ret = window_send_block(client, internal_req, slot, false);
+		if (ret < 0) {
+			LOG_ERR("Error sending a CoAP request");
+			return ret;
+		}
+
+		window->end++;
+	}
+
+	return 0;
+}
+
+static int window_start(struct coap_client *client,
+			struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+
+	window->next = internal_req->recv_blk_ctx.current /
+		       coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	window->end = window->next;
+	window->last = UINT32_MAX;
+	window->active = true;
+
+	return window_fill(client, internal_req);
+}
+
+/* Give the application the response of the next block to deliver */
+static void window_deliver(struct coap_client_internal_request *internal_req,
+			   const struct coap_packet *response)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+	int block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	bool last_block = block_option < 0 || !GET_MORE(block_option) ||
+			  coap_header_get_code(response) >= COAP_RESPONSE_CODE_BAD_REQUEST;
+	uint16_t payload_len;
+	const uint8_t *payload = coap_packet_get_payload(response, &payload_len);
+
+	if (!last_block) {
+		payload_len = MIN(payload_len, CONFIG_COAP_CLIENT_BLOCK_SIZE);
+	} else {
+		window->last = window->next;
+	}
+
+	window->slots[window->next % COAP_CLIENT_BLOCK2_WINDOW].len = 0;
+	window->next++;
+
+	if (internal_req->coap_request.cb != NULL && !atomic_set(&internal_req->in_callback, 1)) {
+		const struct coap_client_response_data resp_data = {
+			.result_code = coap_header_get_code(response),
+			.packet = response,
+			.offset = internal_req->offset,
+			.payload = payload,
+			.payload_len = payload_len,
+			.last_block = last_block,
+		};
+
+		internal_req->coap_request.cb(&resp_data, internal_req->coap_request.user_data);
+		atomic_clear(&internal_req->in_callback);
+	}
+
+	internal_req->offset += payload_len;
+}
+
+static void window_finish(struct coap_client_internal_request *internal_req, int error,
+			  bool reset)
+{
+	internal_req->window.active = false;
+
+	if (error < 0) {
+		report_callback_error(internal_req, error);
+	}
+
+	if (reset) {
+		reset_internal_request(internal_req);
+	} else {
+		release_internal_request(internal_req);
+	}
+}
+
+static int window_handle_response(struct coap_client *client,
+				  struct coap_client_internal_request *internal_req,
+				  const struct coap_packet *response)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+	struct coap_client_block_slot *slot = NULL;
+	uint8_t response_type = coap_header_get_type(response);
+	int block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	int ret;
+
+	if (block_option > 0) {
+		slot = window_slot(internal_req, GET_BLOCK_NUM(block_option));
+	} else if (response_type == COAP_TYPE_ACK) {
+		/* Errors do not say which block they are about, unless piggybacked */
+		slot = window_slot_with_mid(internal_req, coap_header_get_id(response));
+	}
+
+	if (slot == NULL || slot->len != 0) {
+		LOG_DBG("Drop block response, not expected");
+		return 0;
+	}
+
+	coap_pending_clear(&slot->pending);
+
+	if (slot->num > window->last) {
+		/* Requested before the end of the transfer was known */
+		return 0;
+	}
+
+	if (block_option > 0 &&
+	    GET_BLOCK_SIZE(block_option) != internal_req->recv_blk_ctx.block_size) {
+		LOG_ERR("Block size changed during transfer");
+		window_finish(internal_req, -EINVAL, false);
+		return -EINVAL;
+	}
+
+	if (slot->num != window->next) {
+		/* Keep it until the blocks before it are received */
+		memcpy(slot->buf, response->data, response->offset);
+		slot->len = response->offset;
+		if (block_option <= 0 || !GET_MORE(block_option) ||
+		    coap_header_get_code(response) >= COAP_RESPONSE_CODE_BAD_REQUEST) {
+			window->last = slot->num;
+		}
+		return 1;
+	}
+
+	window_deliver(internal_req, response);
+
+	/* Then whatever was already received after it */
+	while (internal_req->request_ongoing && window->next <= window->last) {
+		struct coap_packet buffered;
+
+		slot = &window->slots[window->next % COAP_CLIENT_BLOCK2_WINDOW];
+		if (slot->num != window->next || slot->len == 0) {
+			break;
+		}
+
+		ret = coap_packet_parse(&buffered, slot->buf, slot->len, NULL, 0);
+		if (ret < 0) {
+			LOG_ERR("Invalid block response kept");
+			window_finish(internal_req, ret, false);
+			return ret;
+		}
+
+		window_deliver(internal_req, &buffered);
+	}
+
+	if (!internal_req->request_ongoing) {
+		/* User callback must have called coap_client_cancel_requests(). */
+		window_finish(internal_req, 0, false);
+		return 0;
+	}
+
+	if (window->next > window->last) {
+		window_finish(internal_req, 0, response_type == COAP_TYPE_ACK);
+		return 0;
+	}
+
+	ret = window_fill(client, internal_req);
+	if (ret < 0) {
+		window_finish(internal_req, ret, false);
+		return ret;
+	}
+
+	return 1;
+}
+
+static void window_resend(struct coap_client *client,
+			  struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block_window *window = &internal_req->window;
+	int64_t now = k_uptime_get();
+	int ret;
+
+	for (uint32_t num = window->next; num < window->end; num++) {
+		struct coap_client_block_slot *slot = window_slot(internal_req, num);
+		struct coap_pending tmp;
+
+		if (slot == NULL || slot->pending.timeout == 0 ||
+		    slot->pending.timeout > now - slot->pending.t0) {
+			continue;
+		}
+
+		if (!internal_req->coap_request.confirmable) {
+			window_finish(internal_req, 0, false);
+			return;
+		}
+
+		tmp = slot->pending;
+		if (!coap_pending_cycle(&slot->pending)) {
+			LOG_ERR("Timeout, no more retries left");
+			window_finish(internal_req, -ETIMEDOUT, false);
+			return;
+		}
+
+		LOG_ERR("Timeout, retrying send");
+		ret = window_send_block(client, internal_req, slot, true);
+		if (ret == -EAGAIN) {
+			/* Restore the pending structure, retry later */
+			slot->pending = tmp;
+		} else if (ret < 0) {
+			LOG_ERR("Failed to resend request, %d", ret);
+			window_finish(internal_req, ret, false);
+			return;
+		}
+	}
+}
+#endif /* COAP_CLIENT_BLOCK2_WINDOW > 1 */
+
 static int handle_response(struct coap_client *client, const struct coap_packet *response,
 			   bool response_truncated)
 {
@@ -876,6 +1216,17 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 			LOG_WRN("No matching request for ACK");
 			return 0;
 		}
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+		struct coap_client_block_slot *slot =
+			window_slot_with_mid(internal_req, response_id);
+
+		if (slot != NULL) {
+			slot->pending.t0 = k_uptime_get();
+			slot->pending.timeout = COAP_SEPARATE_TIMEOUT;
+			slot->pending.retries = 0;
+			return 1;
+		}
+#endif
 		internal_req->pending.t0 = k_uptime_get();
 		internal_req->pending.timeout = COAP_SEPARATE_TIMEOUT;
 		internal_req->pending.retries = 0;
@@ -967,6 +1318,12 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		return 0;
 	}
 
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (internal_req->window.active) {
+		return window_handle_response(client, internal_req, response);
+	}
+#endif
+
 	if (internal_req->pending.timeout != 0) {
 		coap_pending_clear(&internal_req->pending);
 	}
@@ -1051,6 +1408,18 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 	}
 
 	/* If this wasn't last block, send the next request */
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+	if (blockwise_transfer && !last_block && block_option > 0 &&
+	    window_can_start(internal_req)) {
+		ret = window_start(client, internal_req);
+		if (ret < 0) {
+			internal_req->window.active = false;
+			goto fail;
+		}
+
+		return 1;
+	}
+#endif
 	if (blockwise_transfer && !last_block) {
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
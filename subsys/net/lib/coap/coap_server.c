@@ -16,6 +16,7 @@ LOG_MODULE_DECLARE(net_coap, CONFIG_COAP_LOG_LEVEL);
 #include <zephyr/net/coap_link_format.h>
 #include <zephyr/net/coap_mgmt.h>
 #include <zephyr/net/coap_service.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/zvfs/eventfd.h>
 
@@ -36,6 +37,10 @@ LOG_MODULE_DECLARE(net_coap, CONFIG_COAP_LOG_LEVEL);
 #define MAX_OBSERVERS  CONFIG_COAP_SERVICE_OBSERVERS
 #define MAX_POLL_FD    CONFIG_ZVFS_POLL_MAX
 
+/* Fixed CoAP header, before the token */
+#define HEADER_SIZE    4
+#define TKL_MASK       0x0F
+
 BUILD_ASSERT(CONFIG_ZVFS_POLL_MAX > 0, "CONFIG_ZVFS_POLL_MAX can't be 0");
 
 static K_MUTEX_DEFINE(lock);
@@ -122,6 +127,99 @@ static int coap_service_remove_observer(const struct coap_service *service,
 	return 0;
 }
 
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+#define RES_BUCKETS    CONFIG_COAP_SERVER_RESOURCE_INDEX_BUCKETS
+
+/* FNV-1a over the length and bytes of each path segment */
+#define PATH_HASH_INIT 2166136261U
+
+static uint32_t coap_path_hash(uint32_t hash, const uint8_t *segment, size_t len)
+{
+	hash = (hash ^ (uint8_t)len) * 16777619U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ segment[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static bool coap_path_has_wildcard(const char * const *path)
+{
+	if (!IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		return false;
+	}
+
+	for (; *path != NULL; path++) {
+		if (strcmp(*path, "+") == 0 || strcmp(*path, "#") == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void coap_service_index_resources(const struct coap_service *service)
+{
+	struct coap_service_data *data = service->data;
+	struct coap_resource *res;
+
+	memset(data->res_buckets, 0, sizeof(data->res_buckets));
+	data->res_wildcards = NULL;
+
+	/* Walk backwards so that each list keeps the resources in definition order */
+	for (res = service->res_end; res-- != service->res_begin;) {
+		struct coap_resource **head = &data->res_wildcards;
+
+		if (!coap_path_has_wildcard(res->path)) {
+			res->path_hash = PATH_HASH_INIT;
+			for (const char * const *p = res->path; *p != NULL; p++) {
+				res->path_hash = coap_path_hash(res->path_hash, (const uint8_t *)*p,
+								strlen(*p));
+			}
+
+			head = &data->res_buckets[res->path_hash % RES_BUCKETS];
+		}
+
+		res->index_next = *head;
+		*head = res;
+	}
+}
+
+static struct coap_resource *coap_service_find_resource(const struct coap_service *service,
+							struct coap_option *options,
+							uint8_t opt_num)
+{
+	struct coap_resource *found = NULL;
+	struct coap_resource *res;
+	uint32_t hash = PATH_HASH_INIT;
+
+	for (uint8_t i = 0; i < opt_num; i++) {
+		if (options[i].delta == COAP_OPTION_URI_PATH) {
+			hash = coap_path_hash(hash, options[i].value, options[i].len);
+		}
+	}
+
+	for (res = service->data->res_buckets[hash % RES_BUCKETS]; res != NULL;
+	     res = res->index_next) {
+		if (res->path_hash == hash && coap_uri_path_match(res->path, options, opt_num)) {
+			found = res;
+			break;
+		}
+	}
+
+	/* As without the index, the first matching resource wins, wildcard or not */
+	for (res = service->data->res_wildcards; res != NULL && (found == NULL || res < found);
+	     res = res->index_next) {
+		if (coap_uri_path_match(res->path, options, opt_num)) {
+			return res;
+		}
+	}
+
+	return found;
+}
+#endif /* CONFIG_COAP_SERVER_RESOURCE_INDEX */
+
 static int coap_server_process(int sock_fd)
 {
 	static uint8_t buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
@@ -254,9 +352,18 @@ static int coap_server_process(int sock_fd)
 
 		ret = coap_service_send(service, &response, &client_addr, client_addr_len, NULL);
 	} else {
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+		struct coap_resource *resource = coap_service_find_resource(service, options,
+									    opt_num);
+
+		/* Without a resource, this only checks the request and reports it not found */
+		ret = coap_handle_request_len(&request, resource, resource != NULL ? 1 : 0,
+					      options, opt_num, &client_addr, client_addr_len);
+#else
 		ret = coap_handle_request_len(&request, service->res_begin,
 					      COAP_SERVICE_RESOURCE_COUNT(service),
 					      options, opt_num, &client_addr, client_addr_len);
+#endif
 
 		/* Translate errors to response codes */
 		switch (ret) {
@@ -428,6 +535,10 @@ int coap_service_start(const struct coap_service *service)
 		goto end;
 	}
 
+#if defined(CONFIG_COAP_SERVER_RESOURCE_INDEX)
+	coap_service_index_resources(service);
+#endif
+
 	/* set the default address (in6addr_any / INADDR_ANY are all 0) */
 	addr_storage = (struct sockaddr_storage){0};
 	if (IS_ENABLED(CONFIG_NET_IPV6) && service->host != NULL &&
@@ -665,6 +776,75 @@ int coap_resource_send(const struct coap_resource *resource, const struct coap_p
 	return -ENOENT;
 }
 
+int coap_resource_send_notification(const struct coap_resource *resource,
+				    const struct coap_packet *cpkt,
+				    const struct coap_transmission_parameters *params)
+{
+	const struct coap_service *service = NULL;
+	uint8_t buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
+	const uint8_t *body = cpkt->data + cpkt->hdr_len;
+	uint16_t body_len = cpkt->offset - cpkt->hdr_len;
+	struct coap_observer *o;
+	uint8_t tkl = UINT8_MAX;
+	int first_err = 0;
+	int ret;
+
+	/* Find owning service */
+	COAP_SERVICE_FOREACH(svc) {
+		if (COAP_SERVICE_HAS_RESOURCE(svc, resource)) {
+			service = svc;
+			break;
+		}
+	}
+
+	if (service == NULL) {
+		return -ENOENT;
+	}
+
+	if (HEADER_SIZE + COAP_TOKEN_MAX_LEN + body_len > sizeof(buf)) {
+		return -EMSGSIZE;
+	}
+
+	/* Version, type and code are the same for everyone */
+	buf[0] = cpkt->data[0] & ~TKL_MASK;
+	buf[1] = cpkt->data[1];
+
+	(void)k_mutex_lock(&lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&resource->observers, o, list) {
+		struct coap_packet notification;
+
+		/* Only move the options and payload when the token length changes */
+		if (o->tkl != tkl) {
+			tkl = o->tkl;
+			buf[0] = (buf[0] & ~TKL_MASK) | tkl;
+			memcpy(buf + HEADER_SIZE + tkl, body, body_len);
+		}
+
+		sys_put_be16(coap_next_id(), buf + 2);
+		memcpy(buf + HEADER_SIZE, o->token, tkl);
+
+		notification = (struct coap_packet){
+			.data = buf,
+			.offset = HEADER_SIZE + tkl + body_len,
+			.max_len = sizeof(buf),
+			.hdr_len = HEADER_SIZE + tkl,
+			.opt_len = cpkt->opt_len,
+			.delta = cpkt->delta,
+		};
+
+		ret = coap_service_send(service, &notification, &o->addr, ADDRLEN(&o->addr),
+					params);
+		if (ret < 0 && first_err == 0) {
+			first_err = ret;
+		}
+	}
+
+	(void)k_mutex_unlock(&lock);
+
+	return first_err;
+}
+
 int coap_resource_parse_observe(struct coap_resource *resource, const struct coap_packet *request,
 				const struct sockaddr *addr)
 {
@@ -6,12 +6,38 @@
 
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/sys/crc.h>
 #include "dns_cache.h"
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+static uint16_t dns_cache_hash(char const *query)
+{
+	return crc16_ansi((const uint8_t *)query, strlen(query));
+}
+
+static bool dns_cache_match(struct dns_cache_entry const *entry, char const *query,
+			    uint16_t query_hash)
+{
+	return entry->in_use && entry->query_hash == query_hash &&
+	       strcmp(entry->query, query) == 0;
+}
+
+static int dns_cache_family(enum dns_query_type type, sa_family_t *family)
+{
+	if (type == DNS_QUERY_TYPE_A) {
+		*family = AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		*family = AF_INET6;
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -23,13 +49,55 @@ int dns_cache_flush(struct dns_cache *cache)
 	return 0;
 }
 
-int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
-		  uint32_t ttl)
+/* Needs to be called when lock is already acquired */
+static void dns_cache_store(struct dns_cache *cache, char const *query,
+			    struct dns_addrinfo const *addrinfo, bool negative, uint32_t ttl)
 {
-	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
+	uint16_t query_hash = dns_cache_hash(query);
 	size_t index_to_replace = 0;
 	bool found_empty = false;
 
+	dns_cache_clean(cache);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		struct dns_cache_entry *entry = &cache->entries[i];
+
+		/* An answer of a family replaces the record of it having none */
+		if (entry->negative && dns_cache_match(entry, query, query_hash) &&
+		    entry->data.ai_family == addrinfo->ai_family) {
+			entry->in_use = false;
+		}
+
+		if (found_empty) {
+			continue;
+		}
+
+		if (!entry->in_use) {
+			index_to_replace = i;
+			found_empty = true;
+		} else if ((int32_t)(entry->last_used -
+				     cache->entries[index_to_replace].last_used) < 0) {
+			index_to_replace = i;
+		}
+	}
+
+	if (!found_empty) {
+		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	}
+
+	strncpy(cache->entries[index_to_replace].query, query,
+		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	cache->entries[index_to_replace].query_hash = query_hash;
+	cache->entries[index_to_replace].data = *addrinfo;
+	cache->entries[index_to_replace].negative = negative;
+	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	cache->entries[index_to_replace].last_used = ++cache->use_count;
+	cache->entries[index_to_replace].in_use = true;
+}
+
+int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
+		  uint32_t ttl)
+{
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
 	}
@@ -45,28 +113,38 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
 
-	dns_cache_clean(cache);
+	dns_cache_store(cache, query, addrinfo, false, ttl);
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			index_to_replace = i;
-			found_empty = true;
-			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
-			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
-		}
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl)
+{
+	struct dns_addrinfo addrinfo = {0};
+	sa_family_t family;
+
+	if (cache == NULL || query == NULL || ttl == 0 ||
+	    dns_cache_family(type, &family) < 0) {
+		return -EINVAL;
 	}
 
-	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
 	}
 
-	strncpy(cache->entries[index_to_replace].query, query,
-		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
-	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
-	cache->entries[index_to_replace].in_use = true;
+	addrinfo.ai_family = family;
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" type %d with TTL %" PRIu32, query, type, ttl);
+
+	dns_cache_store(cache, query, &addrinfo, true, ttl);
 
 	k_mutex_unlock(cache->lock);
 
@@ -75,6 +153,8 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
+	uint16_t query_hash;
+
 	if (cache == NULL || query == NULL) {
 		return -EINVAL;
 	}
@@ -87,12 +167,14 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 		return -EINVAL;
 	}
 
+	query_hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
+		if (dns_cache_match(&cache->entries[i], query, query_hash)) {
 			cache->entries[i].in_use = false;
 		}
 	}
@@ -102,21 +184,19 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 	return 0;
 }
 
-int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
+int dns_cache_find(struct dns_cache *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
+	uint16_t query_hash;
 	sa_family_t family;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
 		return -EINVAL;
 	}
-	if (type == DNS_QUERY_TYPE_A) {
-		family = AF_INET;
-	} else if (type == DNS_QUERY_TYPE_AAAA) {
-		family = AF_INET6;
-	} else {
+	if (dns_cache_family(type, &family) < 0) {
 		return -EINVAL;
 	}
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
@@ -126,25 +206,33 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -EINVAL;
 	}
 
+	query_hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
+		struct dns_cache_entry *entry = &cache->entries[i];
+
+		if (!dns_cache_match(entry, query, query_hash)) {
 			continue;
 		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
+		if (entry->data.ai_family != family) {
 			continue;
 		}
-		if (cache->entries[i].data.ai_family != family) {
+
+		entry->last_used = ++cache->use_count;
+
+		if (entry->negative) {
+			negative = true;
 			continue;
 		}
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
 		} else {
-			addrinfo[found] = cache->entries[i].data;
+			addrinfo[found] = entry->data;
 			found++;
 			NET_DBG("Found \"%s\"", query);
 		}
@@ -156,6 +244,11 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -ENOSR;
 	}
 
+	if (found == 0 && negative) {
+		NET_DBG("\"%s\" is known to have no answer", query);
+		return -ENOENT;
+	}
+
 	if (found == 0) {
 		NET_DBG("Could not find \"%s\"", query);
 	}
@@ -22,6 +22,12 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	/* Value of the cache use counter when last added or found */
+	uint32_t last_used;
+	/* Hash of the query, compared before the query itself */
+	uint16_t query_hash;
+	/* The query is known to have no answer of this address family */
+	bool negative;
 	bool in_use;
 };
 
@@ -29,6 +35,7 @@ struct dns_cache {
 	size_t size;
 	struct dns_cache_entry *entries;
 	struct k_mutex *lock;
+	uint32_t use_count;
 };
 
 /**
@@ -56,8 +63,8 @@ struct dns_cache {
 int dns_cache_flush(struct dns_cache *cache);
 
 /**
- * @brief Adds a new entry to the dns cache removing the one closest to expiry
- * if no free space is available.
+ * @brief Adds a new entry to the dns cache removing the least recently used
+ * one if no free space is available.
  *
  * @param cache Cache where the entry should be added.
  * @param query Query which should be persisted in the cache.
@@ -71,6 +78,24 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Records in the dns cache that a query has no answer.
+ *
+ * Until it expires, the entry makes dns_cache_find() report the query as
+ * having no answer of the given type rather than as not cached. It is
+ * dropped as soon as an answer of that type is added.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which got a negative answer.
+ * @param type Query type, either DNS_QUERY_TYPE_A or DNS_QUERY_TYPE_AAAA.
+ * @param ttl Time to live for the entry in seconds, the negative caching TTL
+ * given by the SOA record of the answer.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -94,8 +119,10 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENOENT means the query is known to have no answer of the given type, see
+ * dns_cache_add_negative().
  */
-int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
+int dns_cache_find(struct dns_cache *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len);
 
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
@@ -6,6 +6,7 @@
 
 #include <string.h>
 #include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net_buf.h>
 
@@ -367,6 +368,68 @@ int dns_unpack_response_query(struct dns_msg_t *dns_msg)
 	return 0;
 }
 
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl)
+{
+	int nscount = dns_header_nscount(dns_msg->msg);
+	int offset = dns_msg->answer_offset;
+	uint8_t *rr;
+	int dname_len;
+	int rdata_len;
+
+	for (int i = 0; i < nscount; i++) {
+		rr = dns_msg->msg + offset;
+		dname_len = skip_fqdn(rr, dns_msg->msg_size - offset);
+		if (dname_len < 0) {
+			return dname_len;
+		}
+
+		/* type + class + ttl + rdlength */
+		if (offset + dname_len + 2 + 2 + 4 + 2 > dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		rdata_len = dns_answer_rdlength(dname_len, rr);
+		offset += dname_len + 2 + 2 + 4 + 2;
+		if (offset + rdata_len > dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		if (dns_answer_type(dname_len, rr) == DNS_RR_TYPE_SOA) {
+			uint8_t *rdata = dns_msg->msg + offset;
+			uint32_t minimum;
+			int name_len;
+			int pos;
+
+			/* MNAME and RNAME, then SERIAL, REFRESH, RETRY,
+			 * EXPIRE and MINIMUM, see RFC 1035 3.3.13.
+			 */
+			pos = skip_fqdn(rdata, rdata_len);
+			if (pos < 0) {
+				return pos;
+			}
+
+			name_len = skip_fqdn(rdata + pos, rdata_len - pos);
+			if (name_len < 0) {
+				return name_len;
+			}
+
+			pos += name_len;
+			if (pos + 5 * DNS_TTL_LEN > rdata_len) {
+				return -EINVAL;
+			}
+
+			minimum = sys_get_be32(rdata + pos + 4 * DNS_TTL_LEN);
+			*ttl = MIN((uint32_t)dns_answer_ttl(dname_len, rr), minimum);
+
+			return 0;
+		}
+
+		offset += rdata_len;
+	}
+
+	return -ENOENT;
+}
+
 int dns_copy_qname(uint8_t *buf, uint16_t *len, uint16_t size,
 		   struct dns_msg_t *dns_msg, uint16_t pos)
 {
@@ -89,6 +89,7 @@ enum dns_rr_type {
 	DNS_RR_TYPE_INVALID = 0,
 	DNS_RR_TYPE_A	= 1,		/* IPv4  */
 	DNS_RR_TYPE_CNAME = 5,		/* CNAME */
+	DNS_RR_TYPE_SOA = 6,		/* SOA   */
 	DNS_RR_TYPE_PTR = 12,		/* PTR   */
 	DNS_RR_TYPE_TXT = 16,		/* TXT   */
 	DNS_RR_TYPE_AAAA = 28,		/* IPv6  */
@@ -420,6 +421,22 @@ int dns_msg_pack_query(uint8_t *buf, uint16_t *len, uint16_t size,
  */
 int dns_unpack_response_query(struct dns_msg_t *dns_msg);
 
+/**
+ * @brief Finds the negative caching TTL of a response without answers.
+ *
+ * @details Looks for the SOA record RFC 2308 requires in the authority
+ *          section of a negative response, starting at the answer_offset
+ *          computed by dns_unpack_response_query(). The TTL is the smallest
+ *          of the TTL and of the MINIMUM field of that record.
+ *
+ * @param dns_msg Structure containing the message.
+ * @param ttl Negative caching TTL in seconds.
+ * @retval 0 on success
+ * @retval -ENOENT if the response has no SOA record.
+ * @retval -EINVAL if the authority section is malformed.
+ */
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl);
+
 /**
  * @brief Copies the qname from dns_msg to buf
  *
@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_mdns_responder, CONFIG_MDNS_RESPONDER_LOG_LEVEL);
 #include <stdlib.h>
 
 #include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/net/mld.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_ip.h>
@@ -339,18 +340,383 @@ static int create_answer(int sock,
 	return 0;
 }
 
+/* Compare the possibly compressed name found at @a pos in a message with a
+ * dotted name, ignoring case, see RFC 6762 ch 16. Returns the number of bytes
+ * the name takes at @a pos, or a negative value if it is malformed.
+ */
+static int known_answer_name_match(const uint8_t *msg, uint16_t msg_size, uint16_t pos,
+				   const char *name, bool *match)
+{
+	const uint8_t *label = msg + pos;
+	int name_len = -1;
+	int jumps = 0;
+
+	*match = name != NULL;
+
+	while (label < msg + msg_size) {
+		uint8_t val = *label;
+
+		if (val == 0) {
+			if (name_len < 0) {
+				name_len = label + 1 - (msg + pos);
+			}
+
+			*match = *match && *name == '\0';
+
+			return name_len;
+		}
+
+		if ((val & NS_CMPRSFLGS) == NS_CMPRSFLGS) {
+			if (label + 1 >= msg + msg_size || ++jumps > msg_size / 2) {
+				break;
+			}
+
+			if (name_len < 0) {
+				name_len = label + 2 - (msg + pos);
+			}
+
+			label = msg + (((val & ~NS_CMPRSFLGS) << 8) | label[1]);
+			continue;
+		}
+
+		if (val > DNS_LABEL_MAX_SIZE || label + 1 + val >= msg + msg_size) {
+			break;
+		}
+
+		if (*match) {
+			if (strncasecmp(name, (const char *)label + 1, val) != 0 ||
+			    (name[val] != '.' && name[val] != '\0')) {
+				*match = false;
+			} else {
+				name += name[val] == '.' ? val + 1 : val;
+			}
+		}
+
+		label += 1 + val;
+	}
+
+	return -EMSGSIZE;
+}
+
+/* Known-answer suppression, RFC 6762 ch 7.1: a record listed in the answer
+ * section of a query with at least half of its TTL left is not sent again.
+ * The record data is compared either as raw bytes or, when @a rdata_name is
+ * set, as a domain name.
+ */
+static bool is_known_answer(const struct dns_msg_t *dns_msg, const char *name,
+			    enum dns_rr_type type, uint32_t our_ttl,
+			    const uint8_t *rdata, uint16_t rdlen, const char *rdata_name)
+{
+	uint8_t *msg = dns_msg->msg;
+	uint16_t msg_size = dns_msg->msg_size;
+	uint16_t pos = DNS_MSG_HEADER_SIZE;
+	int questions;
+	int answers;
+	bool match;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_MDNS_RESPONDER_KNOWN_ANSWER_SUPPRESSION)) {
+		return false;
+	}
+
+	questions = dns_unpack_header_qdcount(msg);
+	answers = dns_unpack_header_ancount(msg);
+
+	while (questions-- > 0) {
+		ret = known_answer_name_match(msg, msg_size, pos, NULL, &match);
+		if (ret < 0) {
+			return false;
+		}
+
+		pos += ret + DNS_QTYPE_LEN + DNS_QCLASS_LEN;
+	}
+
+	while (answers-- > 0) {
+		uint16_t rr_type, rr_class, len;
+		uint32_t ttl;
+
+		ret = known_answer_name_match(msg, msg_size, pos, name, &match);
+		if (ret < 0) {
+			return false;
+		}
+
+		pos += ret;
+		if (pos + DNS_QTYPE_LEN + DNS_QCLASS_LEN + DNS_TTL_LEN + DNS_RDLENGTH_LEN >
+		    msg_size) {
+			return false;
+		}
+
+		rr_type = sys_get_be16(msg + pos);
+		rr_class = sys_get_be16(msg + pos + DNS_QTYPE_LEN);
+		ttl = sys_get_be32(msg + pos + DNS_QTYPE_LEN + DNS_QCLASS_LEN);
+		len = sys_get_be16(msg + pos + DNS_QTYPE_LEN + DNS_QCLASS_LEN + DNS_TTL_LEN);
+
+		pos += DNS_QTYPE_LEN + DNS_QCLASS_LEN + DNS_TTL_LEN + DNS_RDLENGTH_LEN;
+		if (pos + len > msg_size) {
+			return false;
+		}
+
+		if (match && rr_type == type && (rr_class & 0x7fff) == DNS_CLASS_IN &&
+		    ttl >= our_ttl / 2) {
+			if (rdata_name != NULL) {
+				ret = known_answer_name_match(msg, msg_size, pos, rdata_name,
+							      &match);
+				if (ret >= 0 && match) {
+					return true;
+				}
+			} else if (len == rdlen && memcmp(msg + pos, rdata, rdlen) == 0) {
+				return true;
+			}
+		}
+
+		pos += len;
+	}
+
+	return false;
+}
+
+static bool is_known_sd_answer(const struct dns_msg_t *dns_msg,
+			       const struct dns_sd_rec *record,
+			       bool service_type_enum)
+{
+	char name[DNS_SD_SERVICE_MAX_SIZE + DNS_SD_PROTO_SIZE + DNS_SD_DOMAIN_MAX_SIZE +
+		  sizeof("_services._dns-sd._udp..")];
+	char target[DNS_SD_INSTANCE_MAX_SIZE + DNS_SD_SERVICE_MAX_SIZE + DNS_SD_PROTO_SIZE +
+		    DNS_SD_DOMAIN_MAX_SIZE + sizeof("...")];
+
+	if (!IS_ENABLED(CONFIG_MDNS_RESPONDER_KNOWN_ANSWER_SUPPRESSION)) {
+		return false;
+	}
+
+	if (service_type_enum) {
+		snprintk(name, sizeof(name), "_services._dns-sd._udp.%s", record->domain);
+		snprintk(target, sizeof(target), "%s.%s.%s", record->service, record->proto,
+			 record->domain);
+	} else {
+		snprintk(name, sizeof(name), "%s.%s.%s", record->service, record->proto,
+			 record->domain);
+		snprintk(target, sizeof(target), "%s.%s.%s.%s", record->instance,
+			 record->service, record->proto, record->domain);
+	}
+
+	return is_known_answer(dns_msg, name, DNS_RR_TYPE_PTR, DNS_SD_PTR_TTL, NULL, 0, target);
+}
+
+static int send_packet(int sock, struct net_if *iface, const uint8_t *data, size_t len,
+		       const struct sockaddr *dst, socklen_t dst_len)
+{
+	int ret;
+
+	ret = zsock_sendto(sock, data, len, 0, dst, dst_len);
+	if (ret < 0) {
+		ret = -errno;
+		NET_DBG("Cannot send %s reply (%d)", "mDNS", ret);
+	} else {
+		net_stats_update_dns_sent(iface);
+	}
+
+	return ret;
+}
+
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+/* What an encoded response depends on, compared with memcmp() */
+struct mdns_response_key {
+	/* Answered DNS-SD record, NULL for our own hostname */
+	const struct dns_sd_rec *record;
+	const char *text;
+	size_t text_size;
+	struct in_addr addr4;
+	struct in6_addr addr6;
+	uint16_t port;
+	uint16_t qtype;
+	bool service_type_enum;
+};
+
+struct mdns_cached_response {
+	struct mdns_response_key key;
+	/* Entries from an older generation are stale */
+	atomic_val_t generation;
+	uint32_t last_used;
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION)
+	struct sockaddr_storage dst;
+	socklen_t dst_len;
+	struct net_if *iface;
+	int sock;
+	bool pending;
+#endif
+	uint16_t len;
+	uint8_t data[MDNS_RESOLVER_BUF_SIZE];
+};
+
+static struct mdns_cached_response response_cache[CONFIG_MDNS_RESPONDER_RESPONSE_CACHE_SIZE];
+static atomic_t response_cache_generation = ATOMIC_INIT(1);
+static uint32_t response_cache_use;
+static K_MUTEX_DEFINE(response_cache_lock);
+
+/* Drop all the cached responses, they are no longer what we would send */
+static void response_cache_flush(void)
+{
+	atomic_inc(&response_cache_generation);
+}
+
+static void response_key_init(struct mdns_response_key *key,
+			      const struct dns_sd_rec *record,
+			      bool service_type_enum,
+			      enum dns_rr_type qtype)
+{
+	/* Zero the padding as well since keys are compared as a whole */
+	(void)memset(key, 0, sizeof(*key));
+
+	key->record = record;
+	key->qtype = qtype;
+	key->service_type_enum = service_type_enum;
+
+	if (record != NULL) {
+		key->text = record->text;
+		key->text_size = record->text_size;
+		key->port = *record->port;
+	}
+}
+
+/* Must be called with response_cache_lock held */
+static struct mdns_cached_response *response_cache_find(const struct mdns_response_key *key)
+{
+	atomic_val_t generation = atomic_get(&response_cache_generation);
+
+	ARRAY_FOR_EACH_PTR(response_cache, entry) {
+		if (entry->generation == generation &&
+		    memcmp(&entry->key, key, sizeof(*key)) == 0) {
+			entry->last_used = ++response_cache_use;
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be called with response_cache_lock held */
+static struct mdns_cached_response *response_cache_store(const struct mdns_response_key *key,
+							 const uint8_t *data, size_t len)
+{
+	atomic_val_t generation = atomic_get(&response_cache_generation);
+	struct mdns_cached_response *victim = NULL;
+
+	if (len > sizeof(victim->data)) {
+		return NULL;
+	}
+
+	/* Replace a stale entry or else the least recently used one */
+	ARRAY_FOR_EACH_PTR(response_cache, entry) {
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION)
+		if (entry->pending) {
+			continue;
+		}
+#endif
+		if (entry->generation != generation) {
+			victim = entry;
+			break;
+		}
+
+		if (victim == NULL || entry->last_used < victim->last_used) {
+			victim = entry;
+		}
+	}
+
+	if (victim == NULL) {
+		return NULL;
+	}
+
+	victim->key = *key;
+	victim->generation = generation;
+	victim->last_used = ++response_cache_use;
+	victim->len = len;
+	memcpy(victim->data, data, len);
+
+	return victim;
+}
+
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION)
+static void deferred_responses_send(struct k_work *work)
+{
+	atomic_val_t generation = atomic_get(&response_cache_generation);
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&response_cache_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(response_cache, entry) {
+		if (!entry->pending) {
+			continue;
+		}
+
+		entry->pending = false;
+
+		/* The records changed meanwhile, the querier will ask again */
+		if (entry->generation != generation) {
+			continue;
+		}
+
+		(void)send_packet(entry->sock, entry->iface, entry->data, entry->len,
+				  (struct sockaddr *)&entry->dst, entry->dst_len);
+	}
+
+	k_mutex_unlock(&response_cache_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(deferred_responses_work, deferred_responses_send);
+
+/* RFC 6762 ch 6: multicast answers with shared records are delayed by 20 to
+ * 120 ms. Queries received meanwhile for the same record are answered by the
+ * single pending response, and all the pending responses go out together.
+ * Must be called with response_cache_lock held.
+ */
+static void response_defer(struct mdns_cached_response *entry, int sock, struct net_if *iface,
+			   const struct sockaddr *dst, socklen_t dst_len)
+{
+	if (!entry->pending) {
+		entry->pending = true;
+		entry->sock = sock;
+		entry->iface = iface;
+		entry->dst_len = dst_len;
+		memcpy(&entry->dst, dst, dst_len);
+	}
+
+	(void)k_work_schedule(&deferred_responses_work, K_MSEC(20 + sys_rand32_get() % 101));
+}
+#endif /* CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION */
+
+static void mdns_hostname_event_handler(struct net_mgmt_event_callback *cb,
+					uint64_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(mgmt_event);
+	ARG_UNUSED(iface);
+
+	response_cache_flush();
+}
+
+static struct net_mgmt_event_callback mgmt_hostname_cb;
+#endif /* CONFIG_MDNS_RESPONDER_RESPONSE_CACHE */
+
 static int send_response(int sock,
 			 sa_family_t family,
 			 struct sockaddr *src_addr,
 			 size_t addrlen,
+			 const struct dns_msg_t *dns_msg,
 			 struct net_buf *query,
 			 enum dns_rr_type qtype)
 {
 	struct net_if *iface;
 	socklen_t dst_len;
+	const void *addr;
+	uint16_t addr_len;
 	int ret;
 	COND_CODE_1(IS_ENABLED(CONFIG_NET_IPV6),
 		    (struct sockaddr_in6), (struct sockaddr_in)) dst;
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	struct mdns_cached_response *entry;
+	struct mdns_response_key key;
+#endif
 
 	ret = setup_dst_addr(sock, family, src_addr, addrlen, (struct sockaddr *)&dst, &dst_len);
 	if (ret < 0) {
@@ -365,8 +731,6 @@ static int send_response(int sock,
 	}
 
 	if (IS_ENABLED(CONFIG_NET_IPV4) && qtype == DNS_RR_TYPE_A) {
-		const struct in_addr *addr;
-
 		if (family == AF_INET) {
 			addr = net_if_ipv4_select_src_addr(iface,
 							   &net_sin(src_addr)->sin_addr);
@@ -377,13 +741,8 @@ static int send_response(int sock,
 			addr = net_if_ipv4_select_src_addr(iface, &tmp_addr.sin_addr);
 		}
 
-		ret = create_answer(sock, query, qtype, sizeof(struct in_addr), (uint8_t *)addr);
-		if (ret != 0) {
-			return ret;
-		}
+		addr_len = sizeof(struct in_addr);
 	} else if (IS_ENABLED(CONFIG_NET_IPV6) && qtype == DNS_RR_TYPE_AAAA) {
-		const struct in6_addr *addr;
-
 		if (family == AF_INET6) {
 			addr = net_if_ipv6_select_src_addr(iface,
 							   &net_sin6(src_addr)->sin6_addr);
@@ -394,24 +753,77 @@ static int send_response(int sock,
 			addr = net_if_ipv6_select_src_addr(iface, &tmp_addr.sin6_addr);
 		}
 
-		ret = create_answer(sock, query, qtype, sizeof(struct in6_addr), (uint8_t *)addr);
-		if (ret != 0) {
-			return -ENOMEM;
-		}
+		addr_len = sizeof(struct in6_addr);
 	} else {
 		/* TODO: support also service PTRs */
 		return -EINVAL;
 	}
 
-	ret = zsock_sendto(sock, query->data, query->len, 0,
+	if (is_known_answer(dns_msg, query->data, qtype, MDNS_TTL, addr, addr_len, NULL)) {
+		NET_DBG("%s answer %s already known", "mDNS", query->data);
+		return 0;
+	}
+
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	response_key_init(&key, NULL, false, qtype);
+	memcpy(qtype == DNS_RR_TYPE_A ? (void *)&key.addr4 : (void *)&key.addr6,
+	       addr, addr_len);
+
+	k_mutex_lock(&response_cache_lock, K_FOREVER);
+
+	entry = response_cache_find(&key);
+	if (entry != NULL) {
+		ret = send_packet(sock, iface, entry->data, entry->len,
+				  (struct sockaddr *)&dst, dst_len);
+		k_mutex_unlock(&response_cache_lock);
+
+		return ret;
+	}
+
+	k_mutex_unlock(&response_cache_lock);
+#endif
+
+	ret = create_answer(sock, query, qtype, addr_len, (uint8_t *)addr);
+	if (ret != 0) {
+		return ret;
+	}
+
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	k_mutex_lock(&response_cache_lock, K_FOREVER);
+	(void)response_cache_store(&key, query->data, query->len);
+	k_mutex_unlock(&response_cache_lock);
+#endif
+
+	return send_packet(sock, iface, query->data, query->len,
 			   (struct sockaddr *)&dst, dst_len);
-	if (ret < 0) {
-		ret = -errno;
-		NET_DBG("Cannot send %s reply (%d)", "mDNS", ret);
+}
+
+static int create_sd_response(const struct dns_sd_rec *record,
+			      bool service_type_enum,
+			      const struct in_addr *addr4,
+			      const struct in6_addr *addr6,
+			      struct net_buf *result)
+{
+	int ret;
+
+	if (service_type_enum) {
+		ret = dns_sd_handle_service_type_enum(record, addr4, addr6,
+				result->data, net_buf_max_len(result));
+		if (ret < 0) {
+			NET_DBG("dns_sd_handle_service_type_enum() failed (%d)", ret);
+			return ret;
+		}
 	} else {
-		net_stats_update_dns_sent(iface);
+		ret = dns_sd_handle_ptr_query(record, addr4, addr6,
+				result->data, net_buf_max_len(result));
+		if (ret < 0) {
+			NET_DBG("dns_sd_handle_ptr_query() failed (%d)", ret);
+			return ret;
+		}
 	}
 
+	result->len = ret;
+
 	return ret;
 }
 
@@ -450,6 +862,15 @@ static void send_sd_response(int sock,
 	size_t ext_rec_num = external_records_count;
 	COND_CODE_1(IS_ENABLED(CONFIG_NET_IPV6),
 		    (struct sockaddr_in6), (struct sockaddr_in)) dst;
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	struct mdns_cached_response *entry;
+	struct mdns_response_key key;
+#endif
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION)
+	/* Replies to the mDNS port go to the multicast group, see setup_dst_addr() */
+	bool multicast = (family == AF_INET6 ? net_sin6(src_addr)->sin6_port :
+			  net_sin(src_addr)->sin_port) == htons(MDNS_LISTEN_PORT);
+#endif
 
 	BUILD_ASSERT(ARRAY_SIZE(label) == ARRAY_SIZE(size), "");
 
@@ -544,35 +965,62 @@ static void send_sd_response(int sock,
 				record->proto, record->domain,
 				ntohs(*(record->port)));
 
-			/* Construct the response */
-			if (service_type_enum) {
-				ret = dns_sd_handle_service_type_enum(record, addr4, addr6,
-						result->data, net_buf_max_len(result));
+			if (is_known_sd_answer(dns_msg, record, service_type_enum)) {
+				NET_DBG("%s answer %s.%s.%s already known", "mDNS",
+					record->service, record->proto, record->domain);
+				continue;
+			}
+
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+			response_key_init(&key, record, service_type_enum, DNS_RR_TYPE_PTR);
+			if (addr4 != NULL) {
+				net_ipv4_addr_copy_raw((uint8_t *)&key.addr4, (uint8_t *)addr4);
+			}
+
+			if (addr6 != NULL) {
+				net_ipv6_addr_copy_raw((uint8_t *)&key.addr6, (uint8_t *)addr6);
+			}
+
+			k_mutex_lock(&response_cache_lock, K_FOREVER);
+
+			entry = response_cache_find(&key);
+			if (entry == NULL) {
+				ret = create_sd_response(record, service_type_enum,
+							 addr4, addr6, result);
 				if (ret < 0) {
-					NET_DBG("dns_sd_handle_service_type_enum() failed (%d)",
-						ret);
+					k_mutex_unlock(&response_cache_lock);
 					continue;
 				}
-			} else {
-				ret = dns_sd_handle_ptr_query(record, addr4, addr6,
-						result->data, net_buf_max_len(result));
-				if (ret < 0) {
-					NET_DBG("dns_sd_handle_ptr_query() failed (%d)", ret);
+
+				entry = response_cache_store(&key, result->data, result->len);
+			}
+
+			if (entry != NULL) {
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_AGGREGATION)
+				if (multicast) {
+					response_defer(entry, sock, iface,
+						       (struct sockaddr *)&dst, dst_len);
+					k_mutex_unlock(&response_cache_lock);
 					continue;
 				}
+#endif
+				(void)send_packet(sock, iface, entry->data, entry->len,
+						  (struct sockaddr *)&dst, dst_len);
+				k_mutex_unlock(&response_cache_lock);
+				continue;
 			}
 
-			result->len = ret;
-
-			/* Send the response */
-			ret = zsock_sendto(sock, result->data, result->len, 0,
-					   (struct sockaddr *)&dst, dst_len);
+			/* No room left in the cache, send what was just built */
+			k_mutex_unlock(&response_cache_lock);
+#else
+			ret = create_sd_response(record, service_type_enum, addr4, addr6, result);
 			if (ret < 0) {
-				NET_DBG("Cannot send %s reply (%d)", "mDNS", ret);
 				continue;
-			} else {
-				net_stats_update_dns_sent(iface);
 			}
+#endif
+
+			(void)send_packet(sock, iface, result->data, result->len,
+					  (struct sockaddr *)&dst, dst_len);
 		}
 	}
 }
@@ -658,7 +1106,7 @@ static int dns_read(int sock,
 				family == AF_INET ? "IPv4" : "IPv6", "query",
 				hostname, ".local");
 			send_response(sock, family, src_addr, addrlen,
-				      result, qtype);
+				      &dns_msg, result, qtype);
 		} else if (IS_ENABLED(CONFIG_MDNS_RESPONDER_DNS_SD)
 			&& qtype == DNS_RR_TYPE_PTR) {
 			send_sd_response(sock, family, src_addr, addrlen,
@@ -1828,6 +2276,12 @@ static int mdns_responder_init(void)
 	net_mgmt_init_event_callback(&mgmt_iface_cb, mdns_iface_event_handler, flags);
 	net_mgmt_add_event_callback(&mgmt_iface_cb);
 
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	net_mgmt_init_event_callback(&mgmt_hostname_cb, mdns_hostname_event_handler,
+				     NET_EVENT_HOSTNAME_CHANGED);
+	net_mgmt_add_event_callback(&mgmt_hostname_cb);
+#endif
+
 #if defined(CONFIG_MDNS_RESPONDER_PROBE)
 	int ret;
 
@@ -1883,6 +2337,10 @@ int mdns_responder_set_ext_records(const struct dns_sd_rec *records, size_t coun
 	external_records = records;
 	external_records_count = count;
 
+#if defined(CONFIG_MDNS_RESPONDER_RESPONSE_CACHE)
+	response_cache_flush();
+#endif
+
 	return 0;
 }
 
@@ -1089,6 +1089,54 @@ quit:
 	return ret;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+/* Cache a response telling that the name does not exist (NXDOMAIN) or has no
+ * record of the type queried (NODATA) for as long as its SOA record allows,
+ * see RFC 2308. Both end the query with DNS_EAI_NONAME.
+ */
+static int dns_validate_negative(struct dns_resolve_context *ctx,
+				 struct dns_msg_t *dns_msg,
+				 uint16_t *dns_id,
+				 int *query_idx,
+				 uint16_t *query_hash,
+				 int rcode)
+{
+	struct dns_pending_query *query;
+	uint32_t ttl;
+	int ret;
+
+	if ((rcode != DNS_HEADER_NOERROR && rcode != DNS_HEADER_NAMEERROR) ||
+	    dns_header_qdcount(dns_msg->msg) < 1) {
+		return DNS_EAI_FAIL;
+	}
+
+	/* Without SOA record the answer must not be cached */
+	if (dns_unpack_response_query(dns_msg) < 0 ||
+	    dns_unpack_negative_ttl(dns_msg, &ttl) < 0) {
+		return DNS_EAI_FAIL;
+	}
+
+	ret = update_query_idx(ctx, dns_msg, dns_id, query_idx, query_hash);
+	if (ret < 0) {
+		return DNS_EAI_FAIL;
+	}
+
+	query = &ctx->queries[*query_idx];
+	if (query->query_type == DNS_QUERY_TYPE_A ||
+	    query->query_type == DNS_QUERY_TYPE_AAAA) {
+		NET_DBG("No %s record for %s, caching for %u s",
+			query->query_type == DNS_QUERY_TYPE_A ? "A" : "AAAA",
+			query->query, ttl);
+
+		(void)dns_cache_add_negative(&dns_cache, query->query,
+					     query->query_type,
+					     MIN(ttl, CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_MAX_TTL));
+	}
+
+	return DNS_EAI_NONAME;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE */
+
 /* Unit test needs to be able to call this function */
 #if !defined(CONFIG_NET_TEST)
 static
@@ -1155,7 +1203,13 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 	if (dns_header_ancount(dns_msg->msg) < 1) {
 		/* there are no useful records in this message */
 		if (*dns_id > 0) {
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+			/* ret holds the RCODE of the response */
+			ret = dns_validate_negative(ctx, dns_msg, dns_id,
+						    query_idx, query_hash, ret);
+#else
 			ret = DNS_EAI_FAIL;
+#endif
 			goto quit;
 		}
 
@@ -1544,7 +1598,8 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto finished;
 	}
 
-	if ((ret < 0 && ret != DNS_EAI_ALLDONE) || query_idx < 0 ||
+	/* A negative answer ends the query as well, see dns_validate_negative() */
+	if ((ret < 0 && ret != DNS_EAI_ALLDONE && ret != DNS_EAI_NONAME) || query_idx < 0 ||
 	    query_idx > CONFIG_DNS_NUM_CONCUR_QUERIES) {
 		goto quit;
 	}
@@ -1959,6 +2014,15 @@ try_resolve:
 
 			return 0;
 		}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+		if (ret == -ENOENT) {
+			/* The query is known to have no answer */
+			cb(DNS_EAI_NONAME, NULL, user_data);
+
+			return 0;
+		}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE */
 	}
 #else
 	ARG_UNUSED(use_cache);
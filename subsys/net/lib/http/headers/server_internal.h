@@ -36,6 +36,19 @@ int enter_http1_request(struct http_client_ctx *client);
 int enter_http2_request(struct http_client_ctx *client);
 int enter_http_done_state(struct http_client_ctx *client);
 
+void http2_init_client_ctx(struct http_client_ctx *client);
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+int http2_tx_flush(struct http_client_ctx *client);
+#else
+static inline int http2_tx_flush(struct http_client_ctx *client)
+{
+	ARG_UNUSED(client);
+
+	return 0;
+}
+#endif
+
 /* HTTP Compression handling */
 #define HTTP_COMPRESSION_MAX_STRING_LEN 8
 void http_compression_parse_accept_encoding(const char *accept_encoding, size_t len,
@@ -53,6 +66,25 @@ void http_server_get_content_type_from_extension(char *url, char *content_type,
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
 			  uint8_t supported_compression, enum http_compression *chosen_compression);
 void http_client_timer_restart(struct http_client_ctx *client);
+
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+int http_server_tx_static(struct http_client_ctx *client, const void *data, size_t len);
+int http_server_tx_file(struct http_client_ctx *client, struct fs_file_t *file, size_t len,
+			const char *trailer);
+int http_server_tx_resume(struct http_client_ctx *client);
+
+static inline bool http_server_tx_pending(struct http_client_ctx *client)
+{
+	return client->tx.active;
+}
+#else
+static inline bool http_server_tx_pending(struct http_client_ctx *client)
+{
+	ARG_UNUSED(client);
+
+	return false;
+}
+#endif
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status);
 bool http_response_is_provided(struct http_response_ctx *rsp);
 
@@ -465,7 +465,7 @@ static int hpack_integer_encode(uint8_t *buf, size_t buflen, int value,
 			return -ENOBUFS;
 		}
 
-		*buf = (uint8_t)((value % 128) + 128);
+		*buf++ = (uint8_t)((value % 128) + 128);
 		len++;
 		value /= 128;
 	}
@@ -626,3 +626,230 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 
 	return len;
 }
+
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+
+/* Per entry overhead of the table size, RFC 7541, ch. 4.1 */
+#define HPACK_TABLE_ENTRY_OVERHEAD 32
+#define HPACK_TABLE_FIRST_INDEX (HTTP_SERVER_HPACK_WWW_AUTHENTICATE + 1)
+
+static size_t hpack_table_entry_size(size_t name_len, size_t value_len)
+{
+	return name_len + value_len + HPACK_TABLE_ENTRY_OVERHEAD;
+}
+
+static void hpack_table_evict(struct http_hpack_table *table, size_t needed)
+{
+	size_t entry_len;
+	size_t offset = 0;
+
+	while (table->count > 0 && table->size + needed > table->max_size) {
+		entry_len = 2 + table->buf[offset] + table->buf[offset + 1];
+
+		table->size -= hpack_table_entry_size(table->buf[offset],
+						      table->buf[offset + 1]);
+		table->count--;
+		offset += entry_len;
+	}
+
+	if (offset > 0) {
+		table->len -= offset;
+		memmove(table->buf, table->buf + offset, table->len);
+	}
+}
+
+void http_hpack_table_init(struct http_hpack_table *table)
+{
+	table->len = 0;
+	table->size = 0;
+	table->count = 0;
+	table->max_size = HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE;
+
+	/* The decoder assumes the default size of the peer settings until
+	 * told otherwise.
+	 */
+	table->size_update = true;
+}
+
+void http_hpack_table_set_max_size(struct http_hpack_table *table, uint32_t max_size)
+{
+	max_size = MIN(max_size, HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+
+	if (max_size == table->max_size) {
+		return;
+	}
+
+	table->max_size = max_size;
+	table->size_update = true;
+
+	hpack_table_evict(table, 0);
+}
+
+int http_hpack_encode_table_size_update(uint8_t *buf, size_t buflen,
+					struct http_hpack_table *table)
+{
+	int ret;
+
+	if (!table->size_update) {
+		return 0;
+	}
+
+	ret = hpack_integer_encode(buf, buflen, table->max_size,
+				   HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+				   HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+	if (ret > 0) {
+		table->size_update = false;
+	}
+
+	return ret;
+}
+
+/* Returns the index of the newest entry matching the header, or -ENOENT */
+static int hpack_table_find_index(struct http_hpack_table *table,
+				  struct http_hpack_header_buf *header,
+				  bool *name_only)
+{
+	const uint8_t *entry = table->buf;
+	int candidate = -ENOENT;
+	int index;
+
+	for (int i = 0; i < table->count; i++) {
+		uint8_t name_len = entry[0];
+		uint8_t value_len = entry[1];
+
+		/* The newest entry, stored last, has the lowest index */
+		index = HPACK_TABLE_FIRST_INDEX + table->count - 1 - i;
+
+		if (name_len == header->name_len &&
+		    memcmp(&entry[2], header->name, name_len) == 0) {
+			if (value_len == header->value_len &&
+			    memcmp(&entry[2 + name_len], header->value, value_len) == 0) {
+				candidate = index;
+				*name_only = false;
+			} else if (candidate < 0 || *name_only) {
+				candidate = index;
+				*name_only = true;
+			}
+		}
+
+		entry += 2 + name_len + value_len;
+	}
+
+	return candidate;
+}
+
+static bool hpack_table_add(struct http_hpack_table *table,
+			    struct http_hpack_header_buf *header)
+{
+	size_t size = hpack_table_entry_size(header->name_len, header->value_len);
+	uint8_t *entry;
+
+	if (header->name_len > UINT8_MAX || header->value_len > UINT8_MAX ||
+	    size > table->max_size) {
+		return false;
+	}
+
+	hpack_table_evict(table, size);
+
+	entry = &table->buf[table->len];
+	entry[0] = header->name_len;
+	entry[1] = header->value_len;
+	memcpy(&entry[2], header->name, header->name_len);
+	memcpy(&entry[2 + header->name_len], header->value, header->value_len);
+
+	table->len += 2 + header->name_len + header->value_len;
+	table->size += size;
+	table->count++;
+
+	return true;
+}
+
+static int hpack_encode_literal_index(uint8_t *buf, size_t buflen, int index,
+				      struct http_hpack_header_buf *header)
+{
+	int ret, len = 0;
+
+	ret = hpack_integer_encode(buf, buflen, index,
+				   HPACK_PREFIX_LITERAL_INDEXING,
+				   HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	if (ret < 0) {
+		return ret;
+	}
+
+	buf += ret;
+	buflen -= ret;
+	len += ret;
+
+	if (index == 0) {
+		ret = hpack_string_encode(buf, buflen, HPACK_HEADER_NAME, header);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_VALUE, header);
+	if (ret < 0) {
+		return ret;
+	}
+
+	len += ret;
+
+	return len;
+}
+
+int http_hpack_encode_header_table(uint8_t *buf, size_t buflen,
+				   struct http_hpack_header_buf *header,
+				   struct http_hpack_table *table)
+{
+	bool static_name_only = false;
+	bool name_only = false;
+	int static_index;
+	int index;
+	int ret;
+
+	if (buf == NULL || header == NULL || table == NULL ||
+	    header->name == NULL || header->name_len == 0 ||
+	    header->value == NULL || header->value_len == 0) {
+		return -EINVAL;
+	}
+
+	if (buflen == 0) {
+		return -ENOBUFS;
+	}
+
+	static_index = http_hpack_find_index(header, &static_name_only);
+	if (static_index > 0 && !static_name_only) {
+		return hpack_encode_indexed(buf, buflen, static_index);
+	}
+
+	index = hpack_table_find_index(table, header, &name_only);
+	if (index > 0 && !name_only) {
+		return hpack_encode_indexed(buf, buflen, index);
+	}
+
+	/* Prefer the static table for the name, its index does not change */
+	if (static_index > 0) {
+		index = static_index;
+	} else if (index < 0) {
+		index = 0;
+	}
+
+	if (header->name_len > UINT8_MAX || header->value_len > UINT8_MAX ||
+	    hpack_table_entry_size(header->name_len, header->value_len) > table->max_size) {
+		return http_hpack_encode_header(buf, buflen, header);
+	}
+
+	ret = hpack_encode_literal_index(buf, buflen, index, header);
+	if (ret > 0) {
+		/* The name index was computed before the insertion */
+		(void)hpack_table_add(table, header);
+	}
+
+	return ret;
+}
+
+#endif /* HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0 */
@@ -311,6 +311,10 @@ static void close_all_sockets(struct http_server_ctx *ctx)
 	}
 }
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+static void http_server_tx_finish(struct http_client_ctx *client);
+#endif
+
 static void client_release_resources(struct http_client_ctx *client)
 {
 	struct http_resource_detail *detail;
@@ -318,6 +322,12 @@ static void client_release_resources(struct http_client_ctx *client)
 	struct http_request_ctx request_ctx;
 	struct http_response_ctx response_ctx;
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+	if (http_server_tx_pending(client)) {
+		http_server_tx_finish(client);
+	}
+#endif
+
 	HTTP_SERVICE_FOREACH(service) {
 		HTTP_SERVICE_FOREACH_RESOURCE(service, resource) {
 			detail = resource->detail;
@@ -444,6 +454,8 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	}
 
 	client->current_stream = NULL;
+
+	http2_init_client_ctx(client);
 }
 
 static int handle_http_preface(struct http_client_ctx *client)
@@ -479,6 +491,18 @@ static int handle_http_done(struct http_client_ctx *client)
 
 int enter_http_done_state(struct http_client_ctx *client)
 {
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+	/* Closed by the server loop once the response was sent */
+	if (http_server_tx_pending(client)) {
+		client->tx.close = true;
+		client->server_state = HTTP_SERVER_DONE_STATE;
+
+		return -EAGAIN;
+	}
+#endif
+
+	(void)http2_tx_flush(client);
+
 	close_client_connection(client);
 
 	client->server_state = HTTP_SERVER_DONE_STATE;
@@ -537,12 +561,18 @@ static int handle_http_request(struct http_client_ctx *client)
 			ret = handle_http_done(client);
 			break;
 		}
-	} while (ret >= 0 && client->data_len > 0);
+	} while (ret >= 0 && client->data_len > 0 && !http_server_tx_pending(client));
 
 	if (ret < 0 && ret != -EAGAIN) {
 		return ret;
 	}
 
+	/* Write the HTTP/2 frames produced for all the data received */
+	ret = http2_tx_flush(client);
+	if (ret < 0) {
+		return ret;
+	}
+
 	if (client->data_len > 0) {
 		/* Move any remaining data in the buffer. */
 		memmove(client->buffer, client->cursor, client->data_len);
@@ -551,6 +581,33 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static void handle_client_data(struct http_client_ctx *client, struct zsock_pollfd *pollfd)
+{
+	int ret;
+
+	ret = handle_http_request(client);
+	if (ret < 0 && ret != -EAGAIN) {
+		if (ret == -ENOTCONN) {
+			LOG_DBG("Client closed connection while handling request");
+		} else {
+			LOG_ERR("HTTP request handling error (%d)", ret);
+		}
+		close_client_connection(client);
+	} else if (http_server_tx_pending(client)) {
+		/* Wait until the socket can take more of the response, the
+		 * next requests are not read meanwhile.
+		 */
+		pollfd->events = ZSOCK_POLLOUT;
+	} else if (client->data_len == sizeof(client->buffer)) {
+		/* If the RX buffer is still full after parsing,
+		 * it means we won't be able to handle this request
+		 * with the current buffer size.
+		 */
+		LOG_ERR("RX buffer too small to handle request");
+		close_client_connection(client);
+	}
+}
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
@@ -619,6 +676,35 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 			}
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+			if (i >= ctx->listen_fds && (ctx->fds[i].revents & ZSOCK_POLLOUT)) {
+				client = &ctx->clients[i - ctx->listen_fds];
+
+				ret = http_server_tx_resume(client);
+				if (ret == -EAGAIN) {
+					continue;
+				}
+
+				if (ret < 0 || client->tx.close) {
+					if (ret < 0) {
+						LOG_DBG("Cannot write to socket (%d)", ret);
+					}
+
+					close_client_connection(client);
+					continue;
+				}
+
+				ctx->fds[i].events = ZSOCK_POLLIN;
+
+				/* Requests received along with the one just served */
+				if (client->data_len > 0) {
+					handle_client_data(client, &ctx->fds[i]);
+				}
+
+				continue;
+			}
+#endif
+
 			if (!(ctx->fds[i].revents & ZSOCK_POLLIN)) {
 				continue;
 			}
@@ -691,22 +777,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 			http_client_timer_restart(client);
 
-			ret = handle_http_request(client);
-			if (ret < 0 && ret != -EAGAIN) {
-				if (ret == -ENOTCONN) {
-					LOG_DBG("Client closed connection while handling request");
-				} else {
-					LOG_ERR("HTTP request handling error (%d)", ret);
-				}
-				close_client_connection(client);
-			} else if (client->data_len == sizeof(client->buffer)) {
-				/* If the RX buffer is still full after parsing,
-				 * it means we won't be able to handle this request
-				 * with the current buffer size.
-				 */
-				LOG_ERR("RX buffer too small to handle request");
-				close_client_connection(client);
-			}
+			handle_client_data(client, &ctx->fds[i]);
 		}
 	}
 
@@ -904,6 +975,129 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+#if defined(CONFIG_FILE_SYSTEM)
+/* The server thread sends one chunk at a time, so all clients can share it. */
+static uint8_t tx_chunk[CONFIG_HTTP_SERVER_STATIC_STREAMING_CHUNK_SIZE];
+#endif
+
+static void http_server_tx_finish(struct http_client_ctx *client)
+{
+#if defined(CONFIG_FILE_SYSTEM)
+	if (client->tx.data == NULL) {
+		(void)fs_close(&client->tx.file);
+	}
+#endif
+
+	client->tx.active = false;
+}
+
+int http_server_tx_static(struct http_client_ctx *client, const void *data, size_t len)
+{
+	if (len == 0) {
+		return 0;
+	}
+
+	client->tx.data = data;
+	client->tx.remaining = len;
+	client->tx.trailer = NULL;
+	client->tx.close = false;
+	client->tx.active = true;
+
+	return 0;
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+int http_server_tx_file(struct http_client_ctx *client, struct fs_file_t *file, size_t len,
+			const char *trailer)
+{
+	client->tx.data = NULL;
+	client->tx.file = *file;
+	client->tx.remaining = len;
+	client->tx.trailer = trailer;
+	client->tx.close = false;
+	client->tx.active = true;
+
+	if (len == 0) {
+		return http_server_tx_resume(client);
+	}
+
+	return 0;
+}
+#endif
+
+/* Send the next chunk of the body without blocking. Returns -EAGAIN until
+ * the whole body was sent.
+ */
+int http_server_tx_resume(struct http_client_ctx *client)
+{
+	size_t len = MIN(client->tx.remaining, CONFIG_HTTP_SERVER_STATIC_STREAMING_CHUNK_SIZE);
+	const void *buf = client->tx.data;
+	ssize_t out_len;
+	int ret = 0;
+
+#if defined(CONFIG_FILE_SYSTEM)
+	if (buf == NULL && len > 0) {
+		out_len = fs_read(&client->tx.file, tx_chunk, len);
+		if (out_len <= 0) {
+			LOG_ERR("Filesystem read error (%d)", (int)out_len);
+			ret = out_len < 0 ? (int)out_len : -EIO;
+			goto out;
+		}
+
+		buf = tx_chunk;
+		len = out_len;
+	}
+#endif
+
+	if (len > 0) {
+		out_len = zsock_send(client->fd, buf, len, ZSOCK_MSG_DONTWAIT);
+		if (out_len < 0) {
+			if (errno != EAGAIN && errno != EWOULDBLOCK) {
+				ret = -errno;
+				goto out;
+			}
+
+			out_len = 0;
+		}
+
+		if (out_len > 0) {
+			http_client_timer_restart(client);
+		}
+
+#if defined(CONFIG_FILE_SYSTEM)
+		/* Read again what the socket did not take */
+		if (client->tx.data == NULL && (size_t)out_len < len) {
+			ret = fs_seek(&client->tx.file, out_len - (off_t)len, FS_SEEK_CUR);
+			if (ret < 0) {
+				goto out;
+			}
+		}
+#endif
+
+		if (client->tx.data != NULL) {
+			client->tx.data += out_len;
+		}
+
+		client->tx.remaining -= out_len;
+
+		if (client->tx.remaining > 0) {
+			return -EAGAIN;
+		}
+	}
+
+	if (client->tx.trailer != NULL) {
+		ret = http_server_sendall(client, client->tx.trailer,
+					  strlen(client->tx.trailer));
+	}
+
+out:
+	http_server_tx_finish(client);
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_STATIC_STREAMING */
+
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status)
 {
 	if (status != HTTP_SERVER_DATA_FINAL) {
@@ -167,12 +167,17 @@ static int handle_http1_static_resource(
 
 	client->http1_headers_sent = true;
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+	/* Sent by the server loop as the socket accepts it */
+	return http_server_tx_static(client, data, len);
+#else
 	ret = http_server_sendall(client, data, len);
 	if (ret < 0) {
 		return ret;
 	}
 
 	return 0;
+#endif
 }
 
 #define RESPONSE_TEMPLATE_DYNAMIC			\
@@ -498,7 +503,7 @@ BUILD_ASSERT(CONFIG_HTTP_SERVER_STATIC_FS_RESPONSE_SIZE >= STATIC_FS_RESPONSE_SI
 
 	enum http_compression chosen_compression = 0;
 	int len;
-	int remaining;
+	int remaining __maybe_unused;
 	int ret;
 	size_t file_size;
 	struct fs_file_t file;
@@ -561,6 +566,10 @@ BUILD_ASSERT(CONFIG_HTTP_SERVER_STATIC_FS_RESPONSE_SIZE >= STATIC_FS_RESPONSE_SI
 
 	client->http1_headers_sent = true;
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_STREAMING)
+	/* The file is read and sent by the server loop as the socket accepts it */
+	return http_server_tx_file(client, &file, file_size, "\r\n\r\n");
+#else
 	/* read and send file */
 	remaining = file_size;
 	while (remaining > 0) {
@@ -577,6 +586,7 @@ BUILD_ASSERT(CONFIG_HTTP_SERVER_STATIC_FS_RESPONSE_SIZE >= STATIC_FS_RESPONSE_SI
 		remaining -= len;
 	}
 	ret = http_server_sendall(client, "\r\n\r\n", 4);
+#endif
 
 close:
 	/* close file */
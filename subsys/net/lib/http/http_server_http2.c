@@ -87,6 +87,11 @@ static struct http2_stream_ctx *allocate_http_stream_context(
 				HTTP_SERVER_INITIAL_WINDOW_SIZE;
 			client->streams[i].headers_sent = false;
 			client->streams[i].end_stream_sent = false;
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+			client->streams[i].tx_window = client->http2_peer_window_size;
+			client->streams[i].tx_remaining = 0;
+			client->streams[i].weight = HTTP2_DEFAULT_WEIGHT;
+#endif
 			return &client->streams[i];
 		}
 	}
@@ -99,6 +104,13 @@ static void release_http_stream_context(struct http_client_ctx *client,
 {
 	ARRAY_FOR_EACH(client->streams, i) {
 		if (client->streams[i].stream_id == stream_id) {
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+			/* Released by the scheduler once the body was sent */
+			if (client->streams[i].tx_remaining > 0) {
+				client->streams[i].stream_state = HTTP2_STREAM_HALF_CLOSED_REMOTE;
+				break;
+			}
+#endif
 			client->streams[i].stream_id = 0;
 			client->streams[i].stream_state = HTTP2_STREAM_IDLE;
 			client->streams[i].current_detail = NULL;
@@ -117,7 +129,12 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+	ret = http_hpack_encode_header_table(*buf, *buflen, &client->header_field,
+					     &client->hpack_table);
+#else
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+#endif
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
@@ -139,6 +156,50 @@ static void encode_frame_header(uint8_t *buf, uint32_t payload_len,
 	sys_put_be32(stream_id, &buf[HTTP2_FRAME_STREAM_ID_OFFSET]);
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+static int http2_tx_buf_flush(struct http_client_ctx *client)
+{
+	int ret;
+
+	if (client->http2_tx_len == 0) {
+		return 0;
+	}
+
+	ret = http_server_sendall(client, client->http2_tx_buf, client->http2_tx_len);
+	client->http2_tx_len = 0;
+
+	return ret;
+}
+#endif
+
+/* Frames are collected in the output buffer of the client, if any, and
+ * written with the next flush.
+ */
+static int http2_send(struct http_client_ctx *client, const void *buf, size_t len)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	int ret;
+
+	if (client->http2_tx_len + len > sizeof(client->http2_tx_buf)) {
+		ret = http2_tx_buf_flush(client);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (len >= sizeof(client->http2_tx_buf)) {
+			return http_server_sendall(client, buf, len);
+		}
+	}
+
+	memcpy(client->http2_tx_buf + client->http2_tx_len, buf, len);
+	client->http2_tx_len += len;
+
+	return 0;
+#else
+	return http_server_sendall(client, buf, len);
+#endif
+}
+
 static int send_headers_frame(struct http_client_ctx *client, enum http_status status,
 			      uint32_t stream_id, struct http_resource_detail *detail_common,
 			      uint8_t flags, const struct http_header *extra_headers,
@@ -158,6 +219,16 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 		return -EINVAL;
 	}
 
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+	ret = http_hpack_encode_table_size_update(buf, buflen, &client->hpack_table);
+	if (ret < 0) {
+		return ret;
+	}
+
+	buf += ret;
+	buflen -= ret;
+#endif
+
 	ret = add_header_field(client, &buf, &buflen, ":status", status_str);
 	if (ret < 0) {
 		return ret;
@@ -202,8 +273,7 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 	encode_frame_header(headers_frame, payload_len, HTTP2_HEADERS_FRAME,
 			    flags, stream_id);
 
-	ret = http_server_sendall(client, headers_frame,
-				  payload_len + HTTP2_FRAME_HEADER_SIZE);
+	ret = http2_send(client, headers_frame, payload_len + HTTP2_FRAME_HEADER_SIZE);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		return ret;
@@ -214,8 +284,8 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 	return 0;
 }
 
-static int send_data_frame(struct http_client_ctx *client, const char *payload,
-			   size_t length, uint32_t stream_id, uint8_t flags)
+static int write_data_frame(struct http_client_ctx *client, const char *payload,
+			    size_t length, uint32_t stream_id, uint8_t flags)
 {
 	uint8_t frame_header[HTTP2_FRAME_HEADER_SIZE];
 	int ret;
@@ -225,12 +295,12 @@ static int send_data_frame(struct http_client_ctx *client, const char *payload,
 			    HTTP2_FLAG_END_STREAM : 0,
 			    stream_id);
 
-	ret = http_server_sendall(client, frame_header, sizeof(frame_header));
+	ret = http2_send(client, frame_header, sizeof(frame_header));
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 	} else {
 		if (payload != NULL && length > 0) {
-			ret = http_server_sendall(client, payload, length);
+			ret = http2_send(client, payload, length);
 			if (ret < 0) {
 				LOG_DBG("Cannot write to socket (%d)", ret);
 			}
@@ -240,6 +310,136 @@ static int send_data_frame(struct http_client_ctx *client, const char *payload,
 	return ret;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+static void http2_tx_consume(struct http_client_ctx *client, uint32_t stream_id, size_t len)
+{
+	struct http2_stream_ctx *stream = find_http_stream_context(client, stream_id);
+
+	client->http2_tx_window -= len;
+
+	if (stream != NULL) {
+		stream->tx_window -= len;
+	}
+}
+#endif
+
+static int send_data_frame(struct http_client_ctx *client, const char *payload,
+			   size_t length, uint32_t stream_id, uint8_t flags)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	size_t max_len = client->http2_peer_max_frame_size;
+	int ret;
+
+	/* Data produced on the fly cannot wait for the windows to open, it is
+	 * only accounted for, delaying the bodies queued to the scheduler.
+	 */
+	while (length > max_len) {
+		ret = write_data_frame(client, payload, max_len, stream_id, 0);
+		if (ret < 0) {
+			return ret;
+		}
+
+		http2_tx_consume(client, stream_id, max_len);
+		payload += max_len;
+		length -= max_len;
+	}
+
+	http2_tx_consume(client, stream_id, length);
+#endif
+
+	return write_data_frame(client, payload, length, stream_id, flags);
+}
+
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+/* Bytes sent by a stream per scheduling round and unit of weight, the
+ * default weight gives 1 KiB per round.
+ */
+#define HTTP2_TX_QUANTUM 64
+
+/* Send the queued bodies of static resources in rounds over the streams,
+ * each stream sending in proportion to its weight, until all of them are
+ * sent or blocked by the flow control windows.
+ */
+static int http2_tx_schedule(struct http_client_ctx *client)
+{
+	struct http2_stream_ctx *stream;
+	bool progress;
+	size_t len;
+	int ret;
+
+	do {
+		progress = false;
+
+		ARRAY_FOR_EACH(client->streams, i) {
+			stream = &client->streams[i];
+
+			if (stream->tx_remaining == 0 || stream->tx_window <= 0) {
+				continue;
+			}
+
+			if (client->http2_tx_window <= 0) {
+				return 0;
+			}
+
+			len = MIN(stream->tx_remaining, stream->weight * HTTP2_TX_QUANTUM);
+			len = MIN(len, client->http2_peer_max_frame_size);
+			len = MIN(len, (size_t)stream->tx_window);
+			len = MIN(len, (size_t)client->http2_tx_window);
+
+			ret = write_data_frame(client, (const char *)stream->tx_data, len,
+					       stream->stream_id,
+					       len == stream->tx_remaining ?
+					       HTTP2_FLAG_END_STREAM : 0);
+			if (ret < 0) {
+				return ret;
+			}
+
+			stream->tx_data += len;
+			stream->tx_remaining -= len;
+			stream->tx_window -= len;
+			client->http2_tx_window -= len;
+			progress = true;
+
+			/* Complete the release deferred while the body was sent */
+			if (stream->tx_remaining == 0 &&
+			    stream->stream_state == HTTP2_STREAM_HALF_CLOSED_REMOTE) {
+				release_http_stream_context(client, stream->stream_id);
+			}
+		}
+	} while (progress);
+
+	return 0;
+}
+
+int http2_tx_flush(struct http_client_ctx *client)
+{
+	int ret;
+
+	ret = http2_tx_schedule(client);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return http2_tx_buf_flush(client);
+}
+#endif /* CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER */
+
+void http2_init_client_ctx(struct http_client_ctx *client)
+{
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	client->http2_tx_len = 0;
+	client->http2_tx_window = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->http2_peer_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->http2_peer_max_frame_size = HTTP2_DEFAULT_MAX_FRAME_SIZE;
+#endif
+
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+	http_hpack_table_init(&client->hpack_table);
+#endif
+
+	ARG_UNUSED(client);
+}
+
 int send_settings_frame(struct http_client_ctx *client, bool ack)
 {
 	uint8_t settings_frame[HTTP2_FRAME_HEADER_SIZE +
@@ -274,7 +474,7 @@ int send_settings_frame(struct http_client_ctx *client, bool ack)
 		      2 * sizeof(struct http2_settings_field);
 	}
 
-	ret = http_server_sendall(client, settings_frame, len);
+	ret = http2_send(client, settings_frame, len);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		return ret;
@@ -308,8 +508,7 @@ int send_window_update_frame(struct http_client_ctx *client,
 	sys_put_be32(window_update,
 		     window_update_frame + HTTP2_FRAME_HEADER_SIZE);
 
-	ret = http_server_sendall(client, window_update_frame,
-				  sizeof(window_update_frame));
+	ret = http2_send(client, window_update_frame, sizeof(window_update_frame));
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		return ret;
@@ -436,6 +635,17 @@ static int handle_http2_static_resource(
 		goto out;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	if (content_len > 0) {
+		/* Sent by the scheduler as the flow control windows allow */
+		client->current_stream->tx_data = (const uint8_t *)content_200;
+		client->current_stream->tx_remaining = content_len;
+		client->current_stream->end_stream_sent = true;
+
+		return 0;
+	}
+#endif
+
 	ret = send_data_frame(client, content_200, content_len,
 			      frame->stream_identifier,
 			      HTTP2_FLAG_END_STREAM);
@@ -1190,6 +1400,16 @@ static int parse_http_frame_padded_field(struct http_client_ctx *client)
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+/* The weight is the last byte of the priority fields */
+static void set_stream_weight(struct http2_stream_ctx *stream, const uint8_t *priority)
+{
+	if (stream != NULL) {
+		stream->weight = priority[HTTP2_PRIORITY_FRAME_LEN - 1] + 1;
+	}
+}
+#endif
+
 static int parse_http_frame_priority_field(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1199,8 +1419,13 @@ static int parse_http_frame_priority_field(struct http_client_ctx *client)
 	}
 
 	/* Priority signalling is deprecated by RFC 9113, however it still
-	 * should be expected to receive, just drop the bytes.
+	 * should be expected to receive. Only the weight is used, by the
+	 * scheduler.
 	 */
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	set_stream_weight(client->current_stream, client->cursor);
+#endif
+
 	client->cursor += HTTP2_HEADERS_FRAME_PRIORITY_LEN;
 	client->data_len -= HTTP2_HEADERS_FRAME_PRIORITY_LEN;
 	frame->length -= HTTP2_HEADERS_FRAME_PRIORITY_LEN;
@@ -1675,8 +1900,14 @@ int handle_http_frame_priority(struct http_client_ctx *client)
 	}
 
 	/* Priority signalling is deprecated by RFC 9113, however it still
-	 * should be expected to receive, just drop the bytes.
+	 * should be expected to receive. Only the weight is used, by the
+	 * scheduler.
 	 */
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	set_stream_weight(find_http_stream_context(client, frame->stream_identifier),
+			  client->cursor);
+#endif
+
 	client->data_len -= HTTP2_PRIORITY_FRAME_LEN;
 	client->cursor += HTTP2_PRIORITY_FRAME_LEN;
 
@@ -1715,6 +1946,10 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	LOG_DBG("Stream %u reset with error code %u", stream_ctx->stream_id,
 		error_code);
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	stream_ctx->tx_remaining = 0;
+#endif
+
 	release_http_stream_context(client, stream_ctx->stream_id);
 
 	client->data_len -= HTTP2_RST_STREAM_FRAME_LEN;
@@ -1725,6 +1960,62 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER) || HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+static int apply_settings(struct http_client_ctx *client, const uint8_t *buf, size_t len)
+{
+	const size_t field_len = sizeof(struct http2_settings_field);
+
+	if (len % field_len != 0) {
+		return -EBADMSG;
+	}
+
+	for (; len > 0; buf += field_len, len -= field_len) {
+		uint16_t id = sys_get_be16(buf);
+		uint32_t value = sys_get_be32(buf + sizeof(uint16_t));
+
+		switch (id) {
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+		case HTTP2_SETTINGS_HEADER_TABLE_SIZE:
+			http_hpack_table_set_max_size(&client->hpack_table, value);
+			break;
+#endif
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+		case HTTP2_SETTINGS_INITIAL_WINDOW_SIZE: {
+			int32_t delta;
+
+			if (value > HTTP2_MAX_WINDOW_SIZE) {
+				return -EBADMSG;
+			}
+
+			/* Applies to the streams already open, RFC 9113, ch. 6.9.2 */
+			delta = (int32_t)value - client->http2_peer_window_size;
+			client->http2_peer_window_size = value;
+
+			ARRAY_FOR_EACH(client->streams, i) {
+				if (client->streams[i].stream_state != HTTP2_STREAM_IDLE) {
+					client->streams[i].tx_window += delta;
+				}
+			}
+
+			break;
+		}
+		case HTTP2_SETTINGS_MAX_FRAME_SIZE:
+			if (value < HTTP2_DEFAULT_MAX_FRAME_SIZE || value > HTTP2_MAX_FRAME_SIZE) {
+				return -EBADMSG;
+			}
+
+			client->http2_peer_max_frame_size = value;
+			break;
+#endif
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1736,6 +2027,17 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER) || HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		int ret;
+
+		ret = apply_settings(client, client->cursor, frame->length);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+#endif
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -1775,6 +2077,40 @@ int handle_http_frame_goaway(struct http_client_ctx *client)
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+static int apply_window_update(struct http_client_ctx *client)
+{
+	struct http2_frame *frame = &client->current_frame;
+	int32_t *window = &client->http2_tx_window;
+	struct http2_stream_ctx *stream;
+	uint32_t increment;
+
+	if (frame->length != HTTP2_WINDOW_UPDATE_FRAME_LEN) {
+		return -EBADMSG;
+	}
+
+	increment = sys_get_be32(client->cursor) & HTTP2_WINDOW_UPDATE_MASK;
+
+	if (frame->stream_identifier != 0) {
+		/* Updates of already closed streams are ignored */
+		stream = find_http_stream_context(client, frame->stream_identifier);
+		if (stream == NULL) {
+			return 0;
+		}
+
+		window = &stream->tx_window;
+	}
+
+	if ((int64_t)*window + increment > HTTP2_MAX_WINDOW_SIZE) {
+		return -EBADMSG;
+	}
+
+	*window += increment;
+
+	return 0;
+}
+#endif
+
 int handle_http_frame_window_update(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1782,12 +2118,18 @@ int handle_http_frame_window_update(struct http_client_ctx *client)
 
 	LOG_DBG("HTTP_SERVER_FRAME_WINDOW_UPDATE");
 
-	/* TODO Implement flow control, for now just ignore. */
-
 	if (client->data_len < frame->length) {
 		return -EAGAIN;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HTTP2_TX_SCHEDULER)
+	int ret = apply_window_update(client);
+
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
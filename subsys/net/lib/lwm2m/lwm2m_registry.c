@@ -94,6 +94,155 @@ sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
 sys_slist_t *lwm2m_engine_obj_inst_list(void) { return &engine_obj_inst_list; }
 
+#if defined(CONFIG_LWM2M_ENGINE_PATH_INDEX)
+/*
+ * Open addressing hash table with linear probing, holding one entry per
+ * object instance and one per resource of each instance. Removed entries are
+ * filled by shifting back the ones that follow them, so no tombstones are
+ * left behind. The table is kept at most 3/4 full; should it get fuller, it
+ * is abandoned and lookups go back to walking the object instance list.
+ */
+#define PATH_INDEX_SIZE	  CONFIG_LWM2M_ENGINE_PATH_INDEX_SIZE
+#define PATH_INDEX_MASK	  (PATH_INDEX_SIZE - 1)
+#define PATH_INDEX_MAX	  (PATH_INDEX_SIZE - PATH_INDEX_SIZE / 4)
+#define PATH_INDEX_NO_RES UINT16_MAX
+
+BUILD_ASSERT(IS_POWER_OF_TWO(PATH_INDEX_SIZE), "Path index size must be a power of two");
+
+struct path_index_entry {
+	/* object instance or resource, NULL if the entry is free */
+	void *ptr;
+	uint16_t obj_id;
+	uint16_t obj_inst_id;
+	/* PATH_INDEX_NO_RES for object instance entries */
+	uint16_t res_id;
+};
+
+static struct path_index_entry path_index[PATH_INDEX_SIZE];
+static uint16_t path_index_count;
+static bool path_index_full;
+
+static inline uint32_t path_index_home(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id)
+{
+	uint32_t h = (((uint32_t)obj_id << 16) | obj_inst_id) * 0x9E3779B1U;
+
+	h ^= res_id * 0x85EBCA6BU;
+	h ^= h >> 16;
+
+	return h & PATH_INDEX_MASK;
+}
+
+static inline bool path_index_match(const struct path_index_entry *e, uint16_t obj_id,
+				    uint16_t obj_inst_id, uint16_t res_id)
+{
+	return e->obj_id == obj_id && e->obj_inst_id == obj_inst_id && e->res_id == res_id;
+}
+
+static int path_index_slot(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id)
+{
+	uint32_t i = path_index_home(obj_id, obj_inst_id, res_id);
+
+	for (; path_index[i].ptr != NULL; i = (i + 1) & PATH_INDEX_MASK) {
+		if (path_index_match(&path_index[i], obj_id, obj_inst_id, res_id)) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static void *path_index_find(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id)
+{
+	int i = path_index_slot(obj_id, obj_inst_id, res_id);
+
+	return i < 0 ? NULL : path_index[i].ptr;
+}
+
+static void path_index_add(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id, void *ptr)
+{
+	uint32_t i;
+
+	if (path_index_full) {
+		return;
+	}
+
+	if (path_index_count == PATH_INDEX_MAX) {
+		LOG_WRN("Path index full, increase CONFIG_LWM2M_ENGINE_PATH_INDEX_SIZE");
+		path_index_full = true;
+		return;
+	}
+
+	i = path_index_home(obj_id, obj_inst_id, res_id);
+	while (path_index[i].ptr != NULL &&
+	       !path_index_match(&path_index[i], obj_id, obj_inst_id, res_id)) {
+		i = (i + 1) & PATH_INDEX_MASK;
+	}
+
+	if (path_index[i].ptr == NULL) {
+		path_index_count++;
+	}
+
+	path_index[i].ptr = ptr;
+	path_index[i].obj_id = obj_id;
+	path_index[i].obj_inst_id = obj_inst_id;
+	path_index[i].res_id = res_id;
+}
+
+static void path_index_remove(uint16_t obj_id, uint16_t obj_inst_id, uint16_t res_id)
+{
+	uint32_t home;
+	int i = path_index_slot(obj_id, obj_inst_id, res_id);
+	int j = i;
+
+	if (i < 0) {
+		return;
+	}
+
+	/* move back the entries that could no longer be reached past the hole */
+	for (;;) {
+		j = (j + 1) & PATH_INDEX_MASK;
+		if (path_index[j].ptr == NULL) {
+			break;
+		}
+
+		home = path_index_home(path_index[j].obj_id, path_index[j].obj_inst_id,
+				       path_index[j].res_id);
+		if (((j - home) & PATH_INDEX_MASK) >= ((j - i) & PATH_INDEX_MASK)) {
+			path_index[i] = path_index[j];
+			i = j;
+		}
+	}
+
+	path_index[i].ptr = NULL;
+	path_index_count--;
+}
+
+static void path_index_add_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	uint16_t obj_id = obj_inst->obj->obj_id;
+
+	path_index_add(obj_id, obj_inst->obj_inst_id, PATH_INDEX_NO_RES, obj_inst);
+	for (int i = 0; i < obj_inst->resource_count; i++) {
+		path_index_add(obj_id, obj_inst->obj_inst_id, obj_inst->resources[i].res_id,
+			       &obj_inst->resources[i]);
+	}
+}
+
+static void path_index_remove_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	uint16_t obj_id = obj_inst->obj->obj_id;
+
+	if (path_index_full) {
+		return;
+	}
+
+	path_index_remove(obj_id, obj_inst->obj_inst_id, PATH_INDEX_NO_RES);
+	for (int i = 0; i < obj_inst->resource_count; i++) {
+		path_index_remove(obj_id, obj_inst->obj_inst_id, obj_inst->resources[i].res_id);
+	}
+}
+#endif /* CONFIG_LWM2M_ENGINE_PATH_INDEX */
+
 #if defined(CONFIG_LWM2M_RESOURCE_DATA_CACHE_SUPPORT)
 static void lwm2m_engine_cache_write(const struct lwm2m_engine_obj_field *obj_field,
 				     const struct lwm2m_obj_path *path, const void *value,
@@ -145,6 +294,11 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* fields are most often declared in the order of their IDs, from 0 */
+		if (res_id >= 0 && res_id < obj->field_count && obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -176,6 +330,9 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_PATH_INDEX)
+	path_index_add_obj_inst(obj_inst);
+#endif
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -185,12 +342,26 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_PATH_INDEX)
+	path_index_remove_obj_inst(obj_inst);
+#endif
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if defined(CONFIG_LWM2M_ENGINE_PATH_INDEX)
+	if (!path_index_full) {
+		if (obj_id < 0 || obj_id > UINT16_MAX || obj_inst_id < 0 ||
+		    obj_inst_id > UINT16_MAX) {
+			return NULL;
+		}
+
+		return path_index_find(obj_id, obj_inst_id, PATH_INDEX_NO_RES);
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
@@ -364,6 +535,30 @@ struct lwm2m_engine_obj_inst *lwm2m_engine_get_obj_inst(const struct lwm2m_obj_p
 	return get_engine_obj_inst(path->obj_id, path->obj_inst_id);
 }
 
+static struct lwm2m_engine_res *engine_obj_inst_res(struct lwm2m_engine_obj_inst *obj_inst,
+						    uint16_t res_id)
+{
+	int i;
+
+#if defined(CONFIG_LWM2M_ENGINE_PATH_INDEX)
+	if (!path_index_full) {
+		if (res_id == PATH_INDEX_NO_RES) {
+			return NULL;
+		}
+
+		return path_index_find(obj_inst->obj->obj_id, obj_inst->obj_inst_id, res_id);
+	}
+#endif
+
+	for (i = 0; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i].res_id == res_id) {
+			return &obj_inst->resources[i];
+		}
+	}
+
+	return NULL;
+}
+
 int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst **obj_inst,
 		 struct lwm2m_engine_obj_field **obj_field, struct lwm2m_engine_res **res,
 		 struct lwm2m_engine_res_inst **res_inst)
@@ -392,13 +587,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
-		}
-	}
-
+	r = engine_obj_inst_res(oi, path->res_id);
 	if (!r) {
 		return -ENOENT;
 	}
@@ -25,8 +25,106 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if CONFIG_MQTT_INFLIGHT_WINDOW > 0
+	client->internal.inflight_count = 0U;
+#endif
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM)
+	client->internal.payload_discard = false;
+#endif
 }
 
+#if CONFIG_MQTT_INFLIGHT_WINDOW > 0
+static int inflight_find(const struct mqtt_client *client, uint16_t message_id)
+{
+	for (int i = 0; i < client->internal.inflight_count; i++) {
+		if (client->internal.inflight[i] == message_id) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/** @brief Check that the QoS 1 and QoS 2 messages fit in the inflight window. */
+static int inflight_check(const struct mqtt_client *client,
+			  const struct mqtt_publish_param *params, size_t count)
+{
+	size_t needed = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		if (params[i].message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+			continue;
+		}
+
+		if (inflight_find(client, params[i].message_id) >= 0) {
+			/* Retransmissions keep the slot they already have. */
+			if (params[i].dup_flag) {
+				continue;
+			}
+
+			NET_ERR("Message id 0x%04x already in flight",
+				params[i].message_id);
+			return -EBUSY;
+		}
+
+		needed++;
+	}
+
+	if (client->internal.inflight_count + needed >
+	    CONFIG_MQTT_INFLIGHT_WINDOW) {
+		NET_DBG("[CID %p]: Inflight window full", client);
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static void inflight_add(struct mqtt_client *client,
+			 const struct mqtt_publish_param *params, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (params[i].message.topic.qos != MQTT_QOS_0_AT_MOST_ONCE &&
+		    inflight_find(client, params[i].message_id) < 0) {
+			client->internal.inflight[client->internal.inflight_count++] =
+				params[i].message_id;
+		}
+	}
+}
+
+void mqtt_inflight_release(struct mqtt_client *client, uint16_t message_id)
+{
+	int i = inflight_find(client, message_id);
+
+	if (i < 0) {
+		return;
+	}
+
+	client->internal.inflight_count--;
+	client->internal.inflight[i] =
+		client->internal.inflight[client->internal.inflight_count];
+}
+#else
+static inline int inflight_check(const struct mqtt_client *client,
+				 const struct mqtt_publish_param *params,
+				 size_t count)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(params);
+	ARG_UNUSED(count);
+
+	return 0;
+}
+
+static inline void inflight_add(struct mqtt_client *client,
+				const struct mqtt_publish_param *params,
+				size_t count)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(params);
+	ARG_UNUSED(count);
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 /** @brief Initialize tx buffer. */
 static void tx_buf_init(struct mqtt_client *client, struct buf_ctx *buf)
 {
@@ -160,11 +258,81 @@ static void disconnect_5_0_notify(struct mqtt_client *client, int err)
 #endif /* CONFIG_MQTT_VERSION_5_0 */
 
 
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM)
+/** @brief Hand the payload received so far to the payload callback. */
+static int payload_stream(struct mqtt_client *client)
+{
+	int ret;
+
+	while (client->internal.remaining_payload > 0) {
+		ret = mqtt_transport_read(client, client->rx_buf,
+					  MIN(client->internal.remaining_payload,
+					      client->rx_buf_size),
+					  false);
+		if (ret == -EAGAIN) {
+			return 0;
+		}
+
+		if (ret <= 0) {
+			if (ret == 0) {
+				ret = -ENOTCONN;
+			}
+
+			mqtt_client_disconnect(client, ret, true);
+			return ret;
+		}
+
+		client->internal.remaining_payload -= ret;
+
+		if (client->internal.payload_discard) {
+			continue;
+		}
+
+		mqtt_mutex_unlock(client);
+		ret = client->payload_cb(client, client->rx_buf, ret,
+					 client->internal.remaining_payload);
+		mqtt_mutex_lock(client);
+
+		if (ret < 0) {
+			NET_DBG("[CID %p]: Dropping payload, err %d", client, ret);
+			client->internal.payload_discard = true;
+		}
+	}
+
+	client->internal.payload_discard = false;
+
+	return 0;
+}
+
+static bool payload_streamed(const struct mqtt_client *client)
+{
+	return client->payload_cb != NULL;
+}
+#else
+static inline int payload_stream(struct mqtt_client *client)
+{
+	ARG_UNUSED(client);
+
+	return 0;
+}
+
+static inline bool payload_streamed(const struct mqtt_client *client)
+{
+	ARG_UNUSED(client);
+
+	return false;
+}
+#endif /* CONFIG_MQTT_PAYLOAD_STREAM */
+
 static int client_read(struct mqtt_client *client)
 {
 	int err_code;
 
 	if (client->internal.remaining_payload > 0) {
+		if (payload_streamed(client)) {
+			return payload_stream(client);
+		}
+
 		return -EBUSY;
 	}
 
@@ -176,6 +344,12 @@ static int client_read(struct mqtt_client *client)
 		}
 
 		mqtt_client_disconnect(client, err_code, true);
+		return err_code;
+	}
+
+	/* Go on with the payload of a PUBLISH message right away. */
+	if ((client->internal.remaining_payload > 0) && payload_streamed(client)) {
+		err_code = payload_stream(client);
 	}
 
 	return err_code;
@@ -318,6 +492,11 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+	err_code = inflight_check(client, param, 1);
+	if (err_code < 0) {
+		goto error;
+	}
+
 	err_code = publish_encode(client, param, &packet);
 	if (err_code < 0) {
 		goto error;
@@ -334,6 +513,9 @@ int mqtt_publish(struct mqtt_client *client,
 	msg.msg_iovlen = ARRAY_SIZE(io_vector);
 
 	err_code = client_write_msg(client, &msg);
+	if (err_code == 0) {
+		inflight_add(client, param, 1);
+	}
 
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
@@ -344,6 +526,79 @@ error:
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_MULTI)
+int mqtt_publish_multi(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count)
+{
+	int err_code;
+	struct buf_ctx packet;
+	struct iovec io_vector[2 * CONFIG_MQTT_PUBLISH_MULTI_MAX];
+	struct msghdr msg;
+	uint8_t *end;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(params);
+
+	if ((count == 0) || (count > CONFIG_MQTT_PUBLISH_MULTI_MAX)) {
+		return -EINVAL;
+	}
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> %zu messages", client,
+		 client->internal.state, count);
+
+	mqtt_mutex_lock(client);
+
+	tx_buf_init(client, &packet);
+	end = packet.end;
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	err_code = inflight_check(client, params, count);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	/* Headers go one after the other in the TX buffer, each followed by
+	 * its payload in the I/O vectors.
+	 */
+	for (size_t i = 0; i < count; i++) {
+		err_code = publish_encode(client, &params[i], &packet);
+		if (err_code < 0) {
+			goto error;
+		}
+
+		io_vector[2 * i].iov_base = packet.cur;
+		io_vector[2 * i].iov_len = packet.end - packet.cur;
+		io_vector[2 * i + 1].iov_base = params[i].message.payload.data;
+		io_vector[2 * i + 1].iov_len = params[i].message.payload.len;
+
+		packet.cur = packet.end;
+		packet.end = end;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 2 * count;
+
+	err_code = client_write_msg(client, &msg);
+	if (err_code == 0) {
+		inflight_add(client, params, count);
+	}
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+		 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+#endif /* CONFIG_MQTT_PUBLISH_MULTI */
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -208,6 +208,22 @@ int mqtt_handle_rx(struct mqtt_client *client);
  */
 void mqtt_client_disconnect(struct mqtt_client *client, int result, bool notify);
 
+#if CONFIG_MQTT_INFLIGHT_WINDOW > 0
+/**@brief Remove an acknowledged message from the inflight window.
+ *
+ * @param[in] client Identifies the client which received the acknowledgment.
+ * @param[in] message_id Message id of the acknowledged PUBLISH message.
+ */
+void mqtt_inflight_release(struct mqtt_client *client, uint16_t message_id);
+#else
+static inline void mqtt_inflight_release(struct mqtt_client *client,
+					 uint16_t message_id)
+{
+	ARG_UNUSED(client);
+	ARG_UNUSED(message_id);
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 /**@brief Constructs/encodes Connect packet.
  *
  * @param[in] client Identifies the client for which the procedure is requested.
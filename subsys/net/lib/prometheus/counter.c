@@ -14,37 +14,46 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_counter, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+/* Counters are updated from any context, a spinlock keeps the 64-bit updates
+ * consistent without the cost of a mutex.
+ */
+static struct k_spinlock lock;
+
 int prometheus_counter_add(struct prometheus_counter *counter, uint64_t value)
 {
 	if (counter == NULL) {
 		return -EINVAL;
 	}
 
-	counter->value += value;
+	K_SPINLOCK(&lock) {
+		counter->value += value;
+	}
 
 	return 0;
 }
 
 int prometheus_counter_set(struct prometheus_counter *counter, uint64_t value)
 {
+	k_spinlock_key_t key;
 	uint64_t old_value;
 
 	if (counter == NULL) {
 		return -EINVAL;
 	}
 
-	if (value == counter->value) {
-		return 0;
-	}
+	key = k_spin_lock(&lock);
 
 	old_value = counter->value;
 	if (value < old_value) {
+		k_spin_unlock(&lock, key);
 		LOG_DBG("Cannot set counter to a lower value (%" PRIu64 " < %" PRIu64 ")",
 			value, old_value);
 		return -EINVAL;
 	}
 
-	counter->value += (value - old_value);
+	counter->value = value;
+
+	k_spin_unlock(&lock, key);
 
 	return 0;
 }
@@ -24,25 +24,26 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_formatter, CONFIG_PROMETHEUS_LOG_LEVEL);
 
-static int write_metric_to_buffer(char *buffer, size_t buffer_size, const char *format, ...)
+static int write_metric_to_buffer(char *buffer, size_t buffer_size, int *written,
+				  const char *format, ...)
 {
-	/* helper function to write formatted metric to buffer */
+	/* helper function to append formatted metric at the end of the buffer */
 	va_list args;
-	size_t len = strlen(buffer);
+	size_t len;
 
-	if (len >= buffer_size) {
+	if ((size_t)*written >= buffer_size) {
 		return -ENOMEM;
 	}
-	buffer += len;
-	buffer_size -= len;
 
 	va_start(args, format);
-	len = vsnprintf(buffer, buffer_size, format, args);
+	len = vsnprintf(buffer + *written, buffer_size - *written, format, args);
 	va_end(args);
-	if (len >= buffer_size) {
+	if (len >= buffer_size - *written) {
 		return -ENOMEM;
 	}
 
+	*written += len;
+
 	return 0;
 }
 
@@ -51,9 +52,17 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 {
 	int ret = 0;
 
+	/* Append to what the buffer already holds. Tracking the end of the
+	 * data avoids rescanning the whole buffer for every line, which made
+	 * formatting large collectors quadratic.
+	 */
+	if ((size_t)*written < buffer_size) {
+		*written += strnlen(buffer + *written, buffer_size - *written);
+	}
+
 	/* write HELP line if available */
 	if (metric->description[0] != '\0') {
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# HELP %s %s\n", metric->name,
 					     metric->description);
 		if (ret < 0) {
@@ -65,7 +74,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 	/* write TYPE line */
 	switch (metric->type) {
 	case PROMETHEUS_COUNTER:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s counter\n", metric->name);
 		if (ret < 0) {
 			LOG_ERR("Error writing counter");
@@ -75,7 +84,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 		break;
 
 	case PROMETHEUS_GAUGE:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s gauge\n", metric->name);
 		if (ret < 0) {
 			LOG_ERR("Error writing gauge");
@@ -85,7 +94,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 		break;
 
 	case PROMETHEUS_HISTOGRAM:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s histogram\n", metric->name);
 		if (ret < 0) {
 			LOG_ERR("Error writing histogram");
@@ -95,7 +104,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 		break;
 
 	case PROMETHEUS_SUMMARY:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s summary\n", metric->name);
 		if (ret < 0) {
 			LOG_ERR("Error writing summary");
@@ -105,7 +114,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 		break;
 
 	default:
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "# TYPE %s untyped\n", metric->name);
 		if (ret < 0) {
 			LOG_ERR("Error writing untyped");
@@ -125,7 +134,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%s\"} %llu\n", metric->name, metric->labels[i].key,
 				metric->labels[i].value, counter->value);
 			if (ret < 0) {
@@ -145,7 +154,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%s\"} %f\n", metric->name, metric->labels[i].key,
 				metric->labels[i].value, gauge->value);
 			if (ret < 0) {
@@ -165,7 +174,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < histogram->num_buckets; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s_bucket{le=\"%f\"} %lu\n", metric->name,
 				histogram->buckets[i].upper_bound,
 				histogram->buckets[i].count);
@@ -175,14 +184,14 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 			}
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_sum %f\n", metric->name, histogram->sum);
 		if (ret < 0) {
 			LOG_ERR("Error writing histogram");
 			goto out;
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_count %lu\n", metric->name,
 					     histogram->count);
 		if (ret < 0) {
@@ -201,7 +210,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		for (int i = 0; i < summary->num_quantiles; ++i) {
 			ret = write_metric_to_buffer(
-				buffer + *written, buffer_size - *written,
+				buffer, buffer_size, written,
 				"%s{%s=\"%f\"} %f\n", metric->name, "quantile",
 				summary->quantiles[i].quantile,
 				summary->quantiles[i].value);
@@ -211,14 +220,14 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 			}
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_sum %f\n", metric->name, summary->sum);
 		if (ret < 0) {
 			LOG_ERR("Error writing summary");
 			goto out;
 		}
 
-		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
+		ret = write_metric_to_buffer(buffer, buffer_size, written,
 					     "%s_count %lu\n", metric->name,
 					     summary->count);
 		if (ret < 0) {
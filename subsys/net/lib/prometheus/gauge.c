@@ -14,6 +14,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_gauge, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+static struct k_spinlock lock;
+
 int prometheus_gauge_set(struct prometheus_gauge *gauge, double value)
 {
 	if (value < 0) {
@@ -22,7 +24,9 @@ int prometheus_gauge_set(struct prometheus_gauge *gauge, double value)
 	}
 
 	if (gauge) {
-		gauge->value = value;
+		K_SPINLOCK(&lock) {
+			gauge->value = value;
+		}
 	}
 
 	return 0;
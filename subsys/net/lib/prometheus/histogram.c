@@ -14,12 +14,18 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_histogram, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+static struct k_spinlock lock;
+
 int prometheus_histogram_observe(struct prometheus_histogram *histogram, double value)
 {
+	k_spinlock_key_t key;
+
 	if (!histogram) {
 		return -EINVAL;
 	}
 
+	key = k_spin_lock(&lock);
+
 	/* increment count */
 	histogram->count++;
 
@@ -32,12 +38,31 @@ int prometheus_histogram_observe(struct prometheus_histogram *histogram, double
 			/* increment count for the bucket */
 			histogram->buckets[i].count++;
 
-			LOG_DBG("value: %f, bucket: %f, count: %lu", value,
-				histogram->buckets[i].upper_bound, histogram->buckets[i].count);
-
 			break;
 		}
 	}
 
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int prometheus_histogram_set(struct prometheus_histogram *histogram, const uint32_t *counts,
+			     size_t num_counts, double sum)
+{
+	if (!histogram || !counts || num_counts != histogram->num_buckets) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&lock) {
+		histogram->count = 0;
+		histogram->sum = sum;
+
+		for (size_t i = 0; i < num_counts; ++i) {
+			histogram->buckets[i].count = counts[i];
+			histogram->count += counts[i];
+		}
+	}
+
 	return 0;
 }
@@ -14,17 +14,21 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_summary, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+static struct k_spinlock lock;
+
 int prometheus_summary_observe(struct prometheus_summary *summary, double value)
 {
 	if (!summary) {
 		return -EINVAL;
 	}
 
-	/* increment count */
-	summary->count++;
+	K_SPINLOCK(&lock) {
+		/* increment count */
+		summary->count++;
 
-	/* update sum */
-	summary->sum += value;
+		/* update sum */
+		summary->sum += value;
+	}
 
 	return 0;
 }
@@ -32,27 +36,24 @@ int prometheus_summary_observe(struct prometheus_summary *summary, double value)
 int prometheus_summary_observe_set(struct prometheus_summary *summary,
 				   double value, unsigned long count)
 {
-	unsigned long old_count;
-	double old_sum;
+	k_spinlock_key_t key;
 
 	if (summary == NULL) {
 		return -EINVAL;
 	}
 
-	if (value == summary->sum && count == summary->count) {
-		return 0;
-	}
+	key = k_spin_lock(&lock);
 
-	old_count = summary->count;
-	if (count < old_count) {
+	if (count < summary->count) {
+		k_spin_unlock(&lock, key);
 		LOG_DBG("Cannot set summary count to a lower value");
 		return -EINVAL;
 	}
 
-	summary->count += (count - old_count);
+	summary->count = count;
+	summary->sum = value;
 
-	old_sum = summary->sum;
-	summary->sum += (value - old_sum);
+	k_spin_unlock(&lock, key);
 
 	return 0;
 }
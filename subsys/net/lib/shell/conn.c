@@ -152,6 +152,10 @@ static void tcp_sent_list_cb(struct tcp *conn, void *user_data)
 		   conn->send_data_total, conn->unacked_len,
 		   conn->data_mode == TCP_DATA_MODE_RESEND ? 1 : 0, conn->in_connect,
 		   conn->in_close, sys_slist_is_empty(&conn->send_queue) ? "empty" : "data");
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+		PR("           %s cwnd %u ssthresh %u srtt %u ms\n",
+		   conn->ca_ops->name, conn->ca.cwnd, conn->ca.ssthresh, conn->srtt);
+#endif
 
 		details->count++;
 	}
@@ -61,6 +61,7 @@ static struct ethernet_capabilities eth_hw_caps[] = {
 	EC(ETHERNET_DSA_CONDUIT_PORT,     "DSA conduit port"),
 	EC(ETHERNET_TXTIME,               "TXTIME supported"),
 	EC(ETHERNET_TXINJECTION_MODE,     "TX-Injection supported"),
+	EC(ETHERNET_HW_TCP_TSO,           "TCP segmentation offload"),
 };
 
 static void print_supported_ethernet_capabilities(
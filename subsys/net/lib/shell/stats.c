@@ -585,6 +585,10 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	PR("TCP conn drop  %u\tconnrst\t%u\n",
 	   GET_STAT(iface, tcp.conndrop),
 	   GET_STAT(iface, tcp.connrst));
+	PR("TCP rtt samples %u\tavg\t%u ms\n",
+	   GET_STAT(iface, tcp.rtt_samples),
+	   GET_STAT(iface, tcp.rtt_samples) ?
+	   GET_STAT(iface, tcp.rtt_total) / GET_STAT(iface, tcp.rtt_samples) : 0);
 	PR("TCP pkt drop   %u\n", GET_STAT(iface, tcp.drop));
 #endif
 #if defined(CONFIG_NET_STATISTICS_DNS)
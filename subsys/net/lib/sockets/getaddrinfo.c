@@ -52,35 +52,52 @@ struct getaddrinfo_state {
 	uint16_t port;
 	uint16_t dns_id;
 	struct zsock_addrinfo *ai_arr;
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+	/* Results of the A and AAAA queries may come in at the same time */
+	struct k_spinlock lock;
+#endif
 };
 
-static void dns_resolve_cb(enum dns_resolve_status status,
-			   struct dns_addrinfo *info, void *user_data)
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+/* One of the A and AAAA queries run side by side, results are gathered in
+ * the shared state.
+ */
+struct getaddrinfo_query {
+	struct getaddrinfo_state *ai_state;
+	const char *host;
+	enum dns_query_type qtype;
+	struct k_sem sem;
+	int status;
+	uint16_t dns_id;
+	k_timepoint_t end;
+	k_timepoint_t wait_end;
+	k_timeout_t timeout;
+};
+#endif /* CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES */
+
+static void add_result(struct getaddrinfo_state *state, struct dns_addrinfo *info)
 {
-	struct getaddrinfo_state *state = user_data;
 	struct zsock_addrinfo *ai;
 	int socktype = SOCK_STREAM;
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+	k_spinlock_key_t key = k_spin_lock(&state->lock);
 
-	NET_DBG("dns status: %d", status);
-
-	if (info == NULL) {
-		if (status == DNS_EAI_ALLDONE) {
-			status = 0;
-		}
-		state->status = status;
-		k_sem_give(&state->sem);
+	if (state->idx >= AI_ARR_MAX) {
+		k_spin_unlock(&state->lock, key);
+		NET_DBG("getaddrinfo entries overflow");
 		return;
 	}
 
+	ai = &state->ai_arr[state->idx++];
+	k_spin_unlock(&state->lock, key);
+#else
 	if (state->idx >= AI_ARR_MAX) {
 		NET_DBG("getaddrinfo entries overflow");
 		return;
 	}
 
-	ai = &state->ai_arr[state->idx];
-	if (state->idx > 0) {
-		state->ai_arr[state->idx - 1].ai_next = ai;
-	}
+	ai = &state->ai_arr[state->idx++];
+#endif
 
 	memcpy(&ai->_ai_addr, &info->ai_addr, info->ai_addrlen);
 	net_sin(&ai->_ai_addr)->sin_port = state->port;
@@ -99,8 +116,25 @@ static void dns_resolve_cb(enum dns_resolve_status status,
 
 	ai->ai_socktype = socktype;
 	ai->ai_protocol = (socktype == SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP;
+}
 
-	state->idx++;
+static void dns_resolve_cb(enum dns_resolve_status status,
+			   struct dns_addrinfo *info, void *user_data)
+{
+	struct getaddrinfo_state *state = user_data;
+
+	NET_DBG("dns status: %d", status);
+
+	if (info == NULL) {
+		if (status == DNS_EAI_ALLDONE) {
+			status = 0;
+		}
+		state->status = status;
+		k_sem_give(&state->sem);
+		return;
+	}
+
+	add_result(state, info);
 }
 
 static k_timeout_t recalc_timeout(k_timepoint_t end, k_timeout_t timeout)
@@ -179,6 +213,142 @@ again:
 	return st;
 }
 
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+static void dns_resolve_query_cb(enum dns_resolve_status status,
+				 struct dns_addrinfo *info, void *user_data)
+{
+	struct getaddrinfo_query *query = user_data;
+
+	NET_DBG("dns status: %d (type %d)", status, query->qtype);
+
+	if (info == NULL) {
+		if (status == DNS_EAI_ALLDONE) {
+			status = 0;
+		}
+		query->status = status;
+		k_sem_give(&query->sem);
+		return;
+	}
+
+	add_result(query->ai_state, info);
+}
+
+/* Send a query, returns 0 if it is on its way */
+static int query_start(struct getaddrinfo_query *query)
+{
+	int timeout_ms = k_ticks_to_ms_ceil32(query->timeout.ticks);
+	int ret;
+
+	NET_DBG("Timeout %d (type %d)", timeout_ms, query->qtype);
+
+	ret = dns_get_addr_info(query->host, query->qtype, &query->dns_id,
+				dns_resolve_query_cb, query, timeout_ms);
+	if (ret == 0) {
+		/* See exec_query() for the extra delay */
+		query->wait_end = sys_timepoint_calc(K_MSEC(timeout_ms + 100));
+		return 0;
+	}
+
+	if (ret == -EPFNOSUPPORT) {
+		return DNS_EAI_ADDRFAMILY;
+	}
+
+	errno = -ret;
+	return DNS_EAI_SYSTEM;
+}
+
+/* Wait for a query sent by query_start(), resending it with the same
+ * backoff as exec_query() until the DNS timeout is reached.
+ */
+static int query_wait(struct getaddrinfo_query *query)
+{
+	int ret;
+
+	while (true) {
+		ret = k_sem_take(&query->sem, sys_timepoint_timeout(query->wait_end));
+		if (ret == -EAGAIN) {
+			if (sys_timepoint_expired(query->end)) {
+				(void)dns_cancel_addr_info(query->dns_id);
+				return DNS_EAI_AGAIN;
+			}
+		} else if (query->status != DNS_EAI_CANCELED ||
+			   sys_timepoint_expired(query->end)) {
+			return query->status;
+		}
+
+		query->timeout = recalc_timeout(query->end, query->timeout);
+
+		ret = query_start(query);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+}
+
+static void query_init(struct getaddrinfo_query *query, const char *host,
+		       enum dns_query_type qtype, struct getaddrinfo_state *ai_state)
+{
+	query->ai_state = ai_state;
+	query->host = host;
+	query->qtype = qtype;
+	query->dns_id = 0;
+	query->end = sys_timepoint_calc(K_MSEC(CONFIG_NET_SOCKETS_DNS_TIMEOUT));
+	query->timeout = K_MSEC(MIN(CONFIG_NET_SOCKETS_DNS_TIMEOUT,
+				    CONFIG_NET_SOCKETS_DNS_BACKOFF_INTERVAL));
+	k_sem_init(&query->sem, 0, K_SEM_MAX_LIMIT);
+}
+
+/* Put the IPv4 results first, as if the queries had been done one after the
+ * other, whatever order the answers came in.
+ */
+static void sort_results(struct getaddrinfo_state *ai_state)
+{
+	struct zsock_addrinfo tmp;
+	uint16_t ipv4 = 0;
+
+	for (uint16_t i = 0; i < ai_state->idx; i++) {
+		if (ai_state->ai_arr[i].ai_family != AF_INET) {
+			continue;
+		}
+
+		if (i != ipv4) {
+			tmp = ai_state->ai_arr[i];
+			memmove(&ai_state->ai_arr[ipv4 + 1], &ai_state->ai_arr[ipv4],
+				(i - ipv4) * sizeof(tmp));
+			ai_state->ai_arr[ipv4] = tmp;
+		}
+
+		ipv4++;
+	}
+}
+
+/* Resolve the A and AAAA records of a host at the same time, so that it takes
+ * as long as the slowest of the two queries rather than both of them.
+ */
+static void exec_queries_parallel(const char *host, struct getaddrinfo_state *ai_state,
+				  int *st4, int *st6)
+{
+	struct getaddrinfo_query query4, query6;
+
+	query_init(&query4, host, DNS_QUERY_TYPE_A, ai_state);
+	query_init(&query6, host, DNS_QUERY_TYPE_AAAA, ai_state);
+
+	*st4 = query_start(&query4);
+	*st6 = query_start(&query6);
+
+	/* Both queries must be over before their state goes out of scope */
+	if (*st4 == 0) {
+		*st4 = query_wait(&query4);
+	}
+
+	if (*st6 == 0) {
+		*st6 = query_wait(&query6);
+	}
+
+	sort_results(ai_state);
+}
+#endif /* CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES */
+
 static int getaddrinfo_null_host(int port, const struct zsock_addrinfo *hints,
 				struct zsock_addrinfo *res)
 {
@@ -266,6 +436,20 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 	ai_state.dns_id = 0;
 	k_sem_init(&ai_state.sem, 0, K_SEM_MAX_LIMIT);
 
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+	if (family == AF_UNSPEC && IS_ENABLED(CONFIG_NET_IPV4) &&
+	    IS_ENABLED(CONFIG_NET_IPV6)) {
+		ai_state.lock = (struct k_spinlock){};
+
+		exec_queries_parallel(host, &ai_state, &st1, &st2);
+		if (st1 == DNS_EAI_AGAIN || st2 == DNS_EAI_AGAIN) {
+			return DNS_EAI_AGAIN;
+		}
+
+		goto done;
+	}
+#endif /* CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES */
+
 	/* If family is AF_UNSPEC, then we query IPv4 address first
 	 * if IPv4 is enabled in the config.
 	 */
@@ -286,9 +470,19 @@ int z_impl_z_zsock_getaddrinfo_internal(const char *host, const char *service,
 		}
 	}
 
+#if defined(CONFIG_NET_SOCKETS_DNS_PARALLEL_QUERIES)
+done:
+#endif
 	for (uint16_t idx = 0; idx < ai_state.idx; idx++) {
-		ai_addr = &ai_state.ai_arr[idx]._ai_addr;
+		struct zsock_addrinfo *ai = &ai_state.ai_arr[idx];
+
+		ai_addr = &ai->_ai_addr;
 		net_sin(ai_addr)->sin_port = htons(port);
+
+		/* Entries may have been moved around, link them again */
+		ai->ai_addr = ai_addr;
+		ai->ai_canonname = ai->_ai_canonname;
+		ai->ai_next = (idx + 1 < ai_state.idx) ? ai + 1 : NULL;
 	}
 
 	/* If both attempts failed, it's error */
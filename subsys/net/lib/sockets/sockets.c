@@ -386,92 +386,200 @@ ssize_t z_impl_zsock_sendmsg(int sock, const struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
-					   const struct msghdr *msg,
-					   int flags)
+static void msghdr_copy_free(struct msghdr *msg_copy, size_t iovlen)
 {
-	struct msghdr msg_copy;
 	size_t i;
-	int ret;
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	k_free(msg_copy->msg_name);
+	k_free(msg_copy->msg_control);
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	if (msg_copy->msg_iov) {
+		for (i = 0; i < iovlen; i++) {
+			k_free(msg_copy->msg_iov[i].iov_base);
+		}
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+		k_free(msg_copy->msg_iov);
+	}
+}
+
+static int msghdr_copy_for_send(struct msghdr *msg_copy, const struct msghdr *msg)
+{
+	size_t i;
+
+	K_OOPS(k_usermode_from_copy(msg_copy, (void *)msg, sizeof(*msg_copy)));
+
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
+
+	msg_copy->msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
+				       msg_copy->msg_iovlen * sizeof(struct iovec));
+	if (!msg_copy->msg_iov) {
 		errno = ENOMEM;
 		goto fail;
 	}
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		msg_copy.msg_iov[i].iov_base =
-			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
-					       msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+	for (i = 0; i < msg_copy->msg_iovlen; i++) {
+		void *base = msg_copy->msg_iov[i].iov_base;
+
+		msg_copy->msg_iov[i].iov_base =
+			k_usermode_alloc_from_copy(base, msg_copy->msg_iov[i].iov_len);
+		if (!msg_copy->msg_iov[i].iov_base) {
+			/* Do not free the remaining user pointers */
+			msg_copy->msg_iovlen = i;
 			errno = ENOMEM;
 			goto fail;
 		}
-
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
 	}
 
-	if (msg->msg_namelen > 0) {
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (!msg_copy.msg_name) {
+	if (msg_copy->msg_namelen > 0) {
+		msg_copy->msg_name = k_usermode_alloc_from_copy(msg->msg_name,
+							    msg_copy->msg_namelen);
+		if (!msg_copy->msg_name) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
-		msg_copy.msg_control = k_usermode_alloc_from_copy(msg->msg_control,
-							  msg->msg_controllen);
-		if (!msg_copy.msg_control) {
+	if (msg_copy->msg_controllen > 0) {
+		msg_copy->msg_control = k_usermode_alloc_from_copy(msg->msg_control,
+							   msg_copy->msg_controllen);
+		if (!msg_copy->msg_control) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
+	return 0;
+
+fail:
+	msghdr_copy_free(msg_copy, msg_copy->msg_iovlen);
+
+	return -1;
+}
+
+static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
+					   const struct msghdr *msg,
+					   int flags)
+{
+	struct msghdr msg_copy;
+	int ret;
+
+	if (msghdr_copy_for_send(&msg_copy, msg) < 0) {
+		return -1;
+	}
+
 	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
 				   flags);
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	msghdr_copy_free(&msg_copy, msg_copy.msg_iovlen);
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	ssize_t bytes_sent = 0;
+	unsigned int count;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
 
-	for (i = 0; i < msg_copy.msg_iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
 	}
 
-	k_free(msg_copy.msg_iov);
+	(void)k_mutex_lock(lock, K_FOREVER);
 
-	return ret;
+	for (count = 0; count < vlen; count++) {
+		struct msghdr *msg = &msgvec[count].msg_hdr;
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock, msg, flags);
+
+		bytes_sent = vtable->sendmsg(obj, msg, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       bytes_sent < 0 ? -errno : bytes_sent);
+
+		sock_obj_core_update_send_stats(sock, bytes_sent);
+
+		if (bytes_sent < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = bytes_sent;
 	}
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	k_mutex_unlock(lock);
+
+	if (count == 0 && bytes_sent < 0) {
+		return -1;
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
+	return count;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Messages copied from user mode at once by zsock_sendmmsg() and
+ * zsock_recvmmsg(), to bound their stack usage.
+ */
+#define MMSG_COPY_BATCH 8
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr msgvec_copy[MMSG_COPY_BATCH];
+	unsigned int count = 0;
+	int ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	while (count < vlen) {
+		unsigned int batch = MIN(vlen - count, MMSG_COPY_BATCH);
+		unsigned int i;
+
+		for (i = 0; i < batch; i++) {
+			if (msghdr_copy_for_send(&msgvec_copy[i].msg_hdr,
+						 &msgvec[count + i].msg_hdr) < 0) {
+				break;
 			}
 		}
 
-		k_free(msg_copy.msg_iov);
+		ret = i < batch ? -1 : z_impl_zsock_sendmmsg(sock, msgvec_copy, batch, flags);
+
+		for (int j = 0; j < ret; j++) {
+			K_OOPS(k_usermode_to_copy(&msgvec[count + j].msg_len,
+						  &msgvec_copy[j].msg_len,
+						  sizeof(msgvec[count + j].msg_len)));
+		}
+
+		while (i-- > 0) {
+			msghdr_copy_free(&msgvec_copy[i].msg_hdr,
+					 msgvec_copy[i].msg_hdr.msg_iovlen);
+		}
+
+		if (ret < 0) {
+			break;
+		}
+
+		count += ret;
+		if ((unsigned int)ret < batch) {
+			break;
+		}
 	}
 
-	return -1;
+	return count > 0 ? (int)count : ret;
 }
-#include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
@@ -541,12 +649,10 @@ ssize_t z_impl_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
+static int msghdr_copy_for_recv(struct msghdr *msg_copy, struct msghdr *msg,
+				size_t *iovlen)
 {
-	struct msghdr msg_copy;
-	size_t iovlen;
 	size_t i;
-	int ret;
 
 	if (msg == NULL) {
 		errno = EINVAL;
@@ -558,16 +664,16 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 		return -1;
 	}
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	K_OOPS(k_usermode_from_copy(msg_copy, (void *)msg, sizeof(*msg_copy)));
 
-	k_usermode_from_copy(&iovlen, &msg->msg_iovlen, sizeof(iovlen));
+	k_usermode_from_copy(iovlen, &msg->msg_iovlen, sizeof(*iovlen));
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
+	msg_copy->msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
 				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+	if (!msg_copy->msg_iov) {
 		errno = ENOMEM;
 		goto fail;
 	}
@@ -576,24 +682,24 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 	 * next loop fails, we do not try to free non allocated memory
 	 * in fail branch.
 	 */
-	memset(msg_copy.msg_iov, 0, msg->msg_iovlen * sizeof(struct iovec));
+	memset(msg_copy->msg_iov, 0, msg->msg_iovlen * sizeof(struct iovec));
 
-	for (i = 0; i < iovlen; i++) {
+	for (i = 0; i < *iovlen; i++) {
 		/* TODO: In practice we do not need to copy the actual data
 		 * in msghdr when receiving data but currently there is no
 		 * ready made function to do just that (unless we want to call
 		 * relevant malloc function here ourselves). So just use
 		 * the copying variant for now.
 		 */
-		msg_copy.msg_iov[i].iov_base =
+		msg_copy->msg_iov[i].iov_base =
 			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
 						   msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+		if (!msg_copy->msg_iov[i].iov_base) {
 			errno = ENOMEM;
 			goto fail;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
+		msg_copy->msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
 	}
 
 	if (msg->msg_namelen > 0) {
@@ -602,9 +708,9 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 			goto fail;
 		}
 
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (msg_copy.msg_name == NULL) {
+		msg_copy->msg_name = k_usermode_alloc_from_copy(msg->msg_name,
+							    msg->msg_namelen);
+		if (msg_copy->msg_name == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
@@ -616,98 +722,257 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 			goto fail;
 		}
 
-		msg_copy.msg_control =
+		msg_copy->msg_control =
 			k_usermode_alloc_from_copy(msg->msg_control,
 						   msg->msg_controllen);
-		if (msg_copy.msg_control == NULL) {
+		if (msg_copy->msg_control == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
+	return 0;
+
+fail:
+	msghdr_copy_free(msg_copy, msg_copy->msg_iovlen);
+
+	return -1;
+}
+
+static void msghdr_copy_to_user(struct msghdr *msg, struct msghdr *msg_copy,
+				size_t iovlen)
+{
+	size_t i;
+
+	if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_name,
+					  msg_copy->msg_name,
+					  msg_copy->msg_namelen));
+	}
+
+	if (msg->msg_controllen > 0 &&
+	    msg->msg_control != NULL) {
+		K_OOPS(k_usermode_to_copy(msg->msg_control,
+					  msg_copy->msg_control,
+					  msg_copy->msg_controllen));
+
+		msg->msg_controllen = msg_copy->msg_controllen;
+	} else {
+		msg->msg_controllen = 0U;
+	}
+
+	k_usermode_to_copy(&msg->msg_iovlen,
+			   &msg_copy->msg_iovlen,
+			   sizeof(msg->msg_iovlen));
+
+	/* The new iovlen cannot be bigger than the original one */
+	NET_ASSERT(msg_copy->msg_iovlen <= iovlen);
+
+	for (i = 0; i < iovlen; i++) {
+		if (i < msg_copy->msg_iovlen) {
+			K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
+						  msg_copy->msg_iov[i].iov_base,
+						  msg_copy->msg_iov[i].iov_len));
+			K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
+						  &msg_copy->msg_iov[i].iov_len,
+						  sizeof(msg->msg_iov[i].iov_len)));
+		} else {
+			/* Clear out those vectors that we could not populate */
+			msg->msg_iov[i].iov_len = 0;
+		}
+	}
+
+	k_usermode_to_copy(&msg->msg_flags,
+			   &msg_copy->msg_flags,
+			   sizeof(msg->msg_flags));
+}
+
+ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
+{
+	struct msghdr msg_copy;
+	size_t iovlen;
+	int ret;
+
+	if (msghdr_copy_for_recv(&msg_copy, msg, &iovlen) < 0) {
+		return -1;
+	}
+
 	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
 
 	/* Do not copy anything back if there was an error or nothing was
 	 * received.
 	 */
 	if (ret > 0) {
-		if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_name,
-						  msg_copy.msg_name,
-						  msg_copy.msg_namelen));
-		}
+		msghdr_copy_to_user(msg, &msg_copy, iovlen);
+	}
 
-		if (msg->msg_controllen > 0 &&
-		    msg->msg_control != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_control,
-						  msg_copy.msg_control,
-						  msg_copy.msg_controllen));
+	/* Note that we need to free according to original iovlen */
+	msghdr_copy_free(&msg_copy, iovlen);
 
-			msg->msg_controllen = msg_copy.msg_controllen;
-		} else {
-			msg->msg_controllen = 0U;
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int mmsg_timepoint(const struct timespec *timeout, k_timepoint_t *end)
+{
+	if (timeout == NULL) {
+		*end = sys_timepoint_calc(K_FOREVER);
+		return 0;
+	}
+
+	if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+	    timeout->tv_nsec >= NSEC_PER_SEC) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*end = sys_timepoint_calc(K_MSEC(timeout->tv_sec * MSEC_PER_SEC +
+					 timeout->tv_nsec / NSEC_PER_MSEC));
+
+	return 0;
+}
+
+static int zsock_recvmmsg_until(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+				int flags, k_timepoint_t end)
+{
+	const struct socket_op_vtable *vtable;
+	ssize_t bytes_received = 0;
+	struct k_mutex *lock;
+	unsigned int count;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (count = 0; count < vlen; count++) {
+		struct msghdr *msg = &msgvec[count].msg_hdr;
+
+		if (count > 0 && sys_timepoint_expired(end)) {
+			break;
 		}
 
-		k_usermode_to_copy(&msg->msg_iovlen,
-				   &msg_copy.msg_iovlen,
-				   sizeof(msg->msg_iovlen));
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock, msg,
+						flags & ~ZSOCK_MSG_WAITFORONE);
 
-		/* The new iovlen cannot be bigger than the original one */
-		NET_ASSERT(msg_copy.msg_iovlen <= iovlen);
+		bytes_received = vtable->recvmsg(obj, msg, flags & ~ZSOCK_MSG_WAITFORONE);
 
-		for (i = 0; i < iovlen; i++) {
-			if (i < msg_copy.msg_iovlen) {
-				K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_len));
-				K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
-							  &msg_copy.msg_iov[i].iov_len,
-							  sizeof(msg->msg_iov[i].iov_len)));
-			} else {
-				/* Clear out those vectors that we could not populate */
-				msg->msg_iov[i].iov_len = 0;
-			}
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, msg,
+					       bytes_received < 0 ? -errno : bytes_received);
+
+		sock_obj_core_update_recv_stats(sock, bytes_received);
+
+		if (bytes_received < 0) {
+			break;
 		}
 
-		k_usermode_to_copy(&msg->msg_flags,
-				   &msg_copy.msg_flags,
-				   sizeof(msg->msg_flags));
+		msgvec[count].msg_len = bytes_received;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
 	}
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	k_mutex_unlock(lock);
 
-	/* Note that we need to free according to original iovlen */
-	for (i = 0; i < iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
+	/* Errors after the first message are not reported, as the messages
+	 * received so far must be returned.
+	 */
+	if (count == 0 && bytes_received < 0) {
+		return -1;
 	}
 
-	k_free(msg_copy.msg_iov);
+	return count;
+}
 
-	return ret;
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	k_timepoint_t end;
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
+	if (mmsg_timepoint(timeout, &end) < 0) {
+		return -1;
 	}
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	return zsock_recvmmsg_until(sock, msgvec, vlen, flags, end);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct timespec *timeout)
+{
+	struct mmsghdr msgvec_copy[MMSG_COPY_BATCH];
+	size_t iovlen[MMSG_COPY_BATCH];
+	struct timespec timeout_copy;
+	unsigned int count = 0;
+	k_timepoint_t end;
+	int ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout, sizeof(timeout_copy)));
+	}
+
+	if (mmsg_timepoint(timeout != NULL ? &timeout_copy : NULL, &end) < 0) {
+		return -1;
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
+	while (count < vlen) {
+		unsigned int batch = MIN(vlen - count, MMSG_COPY_BATCH);
+		unsigned int i;
+
+		for (i = 0; i < batch; i++) {
+			if (msghdr_copy_for_recv(&msgvec_copy[i].msg_hdr,
+						 &msgvec[count + i].msg_hdr,
+						 &iovlen[i]) < 0) {
+				break;
 			}
 		}
 
-		k_free(msg_copy.msg_iov);
+		ret = i < batch ? -1 :
+			zsock_recvmmsg_until(sock, msgvec_copy, batch, flags, end);
+
+		for (int j = 0; j < ret; j++) {
+			msghdr_copy_to_user(&msgvec[count + j].msg_hdr,
+					    &msgvec_copy[j].msg_hdr, iovlen[j]);
+			K_OOPS(k_usermode_to_copy(&msgvec[count + j].msg_len,
+						  &msgvec_copy[j].msg_len,
+						  sizeof(msgvec[count + j].msg_len)));
+		}
+
+		while (i-- > 0) {
+			msghdr_copy_free(&msgvec_copy[i].msg_hdr, iovlen[i]);
+		}
+
+		if (ret < 0) {
+			break;
+		}
+
+		count += ret;
+		if ((unsigned int)ret < batch || sys_timepoint_expired(end)) {
+			break;
+		}
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
 	}
 
-	return -1;
+	return count > 0 ? (int)count : ret;
 }
-#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 /* As this is limited function, we don't follow POSIX signature, with
@@ -0,0 +1,454 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "sockets_internal.h"
+#include "../../ip/tcp_internal.h"
+#include "../../ip/net_private.h"
+
+#define EPOLL_FLAGS (ZSOCK_EPOLLET | ZSOCK_EPOLLONESHOT)
+#define EPOLL_ALWAYS (ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP)
+
+struct epoll_instance;
+
+/* A socket monitored by an instance */
+struct epoll_item {
+	/* In the items of the socket */
+	sys_snode_t ctx_node;
+	/* In the items of the instance */
+	sys_dnode_t ep_node;
+	/* In the ready list of the instance, when ready is set */
+	sys_dnode_t ready_node;
+	struct epoll_instance *ep;
+	struct net_context *ctx;
+	int fd;
+	uint32_t events;
+	union zsock_epoll_data data;
+	bool ready;
+};
+
+struct epoll_instance {
+	sys_dlist_t items;
+	/* Items which events may have changed since the last wait */
+	sys_dlist_t ready;
+	struct k_sem sem;
+	bool in_use;
+};
+
+extern const struct socket_op_vtable sock_fd_op_vtable;
+static const struct fd_op_vtable epoll_fd_op_vtable;
+
+/* Protects all the instances and items, as they are updated from the network
+ * stack callbacks.
+ */
+static struct k_spinlock lock;
+
+static struct epoll_instance instances[CONFIG_NET_SOCKETS_EPOLL_MAX];
+static struct epoll_item items[CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS];
+
+/* Same conditions as zsock_poll_update_ctx(), checked without waiting */
+static uint32_t epoll_revents(struct net_context *ctx)
+{
+	uint32_t revents = 0;
+
+	if (!k_fifo_is_empty(&ctx->recv_q) || sock_is_eof(ctx)) {
+		revents |= ZSOCK_EPOLLIN;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_NATIVE_TCP) &&
+	    net_context_get_type(ctx) == SOCK_STREAM &&
+	    !net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		if (!sock_is_eof(ctx) &&
+		    net_context_get_state(ctx) == NET_CONTEXT_CONNECTED &&
+		    k_sem_count_get(net_tcp_tx_sem_get(ctx)) > 0) {
+			revents |= ZSOCK_EPOLLOUT;
+		}
+	} else {
+		revents |= ZSOCK_EPOLLOUT;
+	}
+
+	if (sock_is_error(ctx)) {
+		revents |= ZSOCK_EPOLLERR;
+	}
+
+	if (sock_is_eof(ctx)) {
+		revents |= ZSOCK_EPOLLHUP;
+	}
+
+	return revents;
+}
+
+/* Called with lock held */
+static void item_set_ready(struct epoll_item *item)
+{
+	if (!item->ready) {
+		item->ready = true;
+		sys_dlist_append(&item->ep->ready, &item->ready_node);
+	}
+
+	k_sem_give(&item->ep->sem);
+}
+
+/* Called with lock held */
+static void item_free(struct epoll_item *item)
+{
+	if (item->ready) {
+		sys_dlist_remove(&item->ready_node);
+	}
+
+	sys_dlist_remove(&item->ep_node);
+	(void)sys_slist_find_and_remove(&item->ctx->epoll_items, &item->ctx_node);
+
+	item->ep = NULL;
+}
+
+void net_socket_epoll_notify(struct net_context *ctx)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+		/* Disarmed one-shot items wait for ZSOCK_EPOLL_CTL_MOD */
+		if ((item->events & ~EPOLL_FLAGS) != 0) {
+			item_set_ready(item);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void net_socket_epoll_close(struct net_context *ctx)
+{
+	struct epoll_item *item, *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx->epoll_items, item, next, ctx_node) {
+		item_free(item);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int zsock_epoll_create(int flags)
+{
+	struct epoll_instance *ep = NULL;
+	k_spinlock_key_t key;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (int i = 0; i < ARRAY_SIZE(instances); i++) {
+		if (!instances[i].in_use) {
+			ep = &instances[i];
+			ep->in_use = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ep == NULL) {
+		zvfs_free_fd(fd);
+		errno = ENFILE;
+		return -1;
+	}
+
+	sys_dlist_init(&ep->items);
+	sys_dlist_init(&ep->ready);
+	k_sem_init(&ep->sem, 0, 1);
+
+	zvfs_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	return fd;
+}
+
+static struct epoll_item *item_find(struct epoll_instance *ep, struct net_context *ctx)
+{
+	struct epoll_item *item;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+		if (item->ep == ep) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static struct epoll_item *item_alloc(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(items); i++) {
+		if (items[i].ep == NULL) {
+			return &items[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Called with lock held */
+static void item_update(struct epoll_item *item, const struct zsock_epoll_event *event)
+{
+	item->events = event->events;
+	item->data = event->data;
+
+	/* Report the current events, even to edge-triggered items */
+	if ((epoll_revents(item->ctx) & (item->events | EPOLL_ALWAYS)) != 0) {
+		item_set_ready(item);
+	}
+}
+
+int zsock_epoll_ctl(int epfd, int op, int fd, struct zsock_epoll_event *event)
+{
+	struct epoll_instance *ep;
+	struct net_context *ctx;
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	/* Only native sockets feed the ready lists */
+	ctx = zvfs_get_fd_obj(fd, (const struct fd_op_vtable *)&sock_fd_op_vtable, EPERM);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	key = k_spin_lock(&lock);
+
+	item = item_find(ep, ctx);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		item = item_alloc();
+		if (item == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		item->ep = ep;
+		item->ctx = ctx;
+		item->fd = fd;
+		item->ready = false;
+		sys_dlist_append(&ep->items, &item->ep_node);
+		sys_slist_append(&ctx->epoll_items, &item->ctx_node);
+
+		item_update(item, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		item_update(item, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		item_free(item);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Called with lock held. Only the items in the ready list are checked, which
+ * makes the cost of a wait independent of the number of monitored sockets.
+ */
+static int collect_events(struct epoll_instance *ep, struct zsock_epoll_event *events,
+			  int maxevents)
+{
+	struct epoll_item *item, *next;
+	sys_dlist_t requeue;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int count = 0;
+
+	sys_dlist_init(&requeue);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->ready, item, next, ready_node) {
+		if (count == maxevents) {
+			break;
+		}
+
+		sys_dlist_remove(&item->ready_node);
+
+		if ((item->events & ~EPOLL_FLAGS) == 0) {
+			item->ready = false;
+			continue;
+		}
+
+		revents = epoll_revents(item->ctx) & (item->events | EPOLL_ALWAYS);
+
+		/* Level-triggered items stay ready as long as they have
+		 * events, behind the other ready items so that all of them
+		 * get reported. Others wait for the next notification.
+		 */
+		if (revents == 0 || (item->events & EPOLL_FLAGS) != 0) {
+			item->ready = false;
+		} else {
+			sys_dlist_append(&requeue, &item->ready_node);
+		}
+
+		if (revents == 0) {
+			continue;
+		}
+
+		events[count].events = revents;
+		events[count].data = item->data;
+		count++;
+
+		if ((item->events & ZSOCK_EPOLLONESHOT) != 0) {
+			item->events &= EPOLL_FLAGS;
+		}
+	}
+
+	while ((node = sys_dlist_get(&requeue)) != NULL) {
+		sys_dlist_append(&ep->ready, node);
+	}
+
+	return count;
+}
+
+int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events, int maxevents,
+		     int timeout)
+{
+	struct epoll_instance *ep;
+	k_spinlock_key_t key;
+	k_timepoint_t end;
+	int count;
+
+	ep = zvfs_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	while (true) {
+		key = k_spin_lock(&lock);
+		count = collect_events(ep, events, maxevents);
+		k_spin_unlock(&lock, key);
+
+		if (count > 0) {
+			return count;
+		}
+
+		/* Notifications since the collection leave the semaphore
+		 * available, so none can be missed.
+		 */
+		if (k_sem_take(&ep->sem, sys_timepoint_timeout(end)) < 0) {
+			return 0;
+		}
+	}
+}
+
+static int epoll_close_op(void *obj)
+{
+	struct epoll_instance *ep = obj;
+	struct epoll_item *item, *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, ep_node) {
+		item_free(item);
+	}
+
+	ep->in_use = false;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static ssize_t epoll_rw_op(void *obj, void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_op(void *obj, const void *buf, size_t sz)
+{
+	return epoll_rw_op(obj, (void *)buf, sz);
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_rw_op,
+	.write = epoll_write_op,
+	.close = epoll_close_op,
+	.ioctl = epoll_ioctl_op,
+};
@@ -89,6 +89,8 @@ static void zsock_flush_queue(struct net_context *ctx)
 
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
+
+	net_socket_epoll_notify(ctx);
 }
 
 static int zsock_socket_internal(int family, int type, int proto)
@@ -175,6 +177,8 @@ int zsock_close_ctx(struct net_context *ctx, int sock)
 
 	zsock_flush_queue(ctx);
 
+	net_socket_epoll_close(ctx);
+
 	ret = net_context_put(ctx);
 	if (ret < 0) {
 		errno = -ret;
@@ -217,6 +221,8 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+
+		net_socket_epoll_notify(parent);
 	}
 
 }
@@ -281,6 +287,8 @@ unlock:
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
 
+	net_socket_epoll_notify(ctx);
+
 	if (ctx->cond.lock) {
 		(void)k_mutex_unlock(ctx->cond.lock);
 	}
@@ -1140,18 +1148,14 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
-static ssize_t zsock_recv_dgram(struct net_context *ctx,
-				struct msghdr *msg,
-				void *buf,
-				size_t max_len,
-				int flags,
-				struct sockaddr *src_addr,
-				socklen_t *addrlen)
+/* Get the next datagram and its source address. On error errno is set and
+ * NULL returned.
+ */
+static struct net_pkt *zsock_recv_dgram_pkt(struct net_context *ctx, int flags,
+					    struct sockaddr *src_addr,
+					    socklen_t *addrlen)
 {
 	k_timeout_t timeout = K_FOREVER;
-	size_t recv_len = 0;
-	size_t read_len;
-	struct net_pkt_cursor backup;
 	struct net_pkt *pkt;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
@@ -1164,7 +1168,7 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 		ret = zsock_wait_data(ctx, &timeout);
 		if (ret < 0) {
 			errno = -ret;
-			return -1;
+			return NULL;
 		}
 	}
 
@@ -1175,7 +1179,7 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 		/* EAGAIN when timeout expired, EINTR when cancelled */
 		if (res && res != -EAGAIN && res != -EINTR) {
 			errno = -res;
-			return -1;
+			return NULL;
 		}
 
 		pkt = k_fifo_peek_head(&ctx->recv_q);
@@ -1185,11 +1189,9 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 
 	if (!pkt) {
 		errno = EAGAIN;
-		return -1;
+		return NULL;
 	}
 
-	net_pkt_cursor_backup(pkt, &backup);
-
 	if (src_addr && addrlen) {
 		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
@@ -1226,6 +1228,36 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 		}
 	}
 
+	return pkt;
+
+fail:
+	if (!(flags & ZSOCK_MSG_PEEK)) {
+		net_pkt_unref(pkt);
+	}
+
+	return NULL;
+}
+
+static ssize_t zsock_recv_dgram(struct net_context *ctx,
+				struct msghdr *msg,
+				void *buf,
+				size_t max_len,
+				int flags,
+				struct sockaddr *src_addr,
+				socklen_t *addrlen)
+{
+	size_t recv_len = 0;
+	size_t read_len;
+	struct net_pkt_cursor backup;
+	struct net_pkt *pkt;
+
+	pkt = zsock_recv_dgram_pkt(ctx, flags, src_addr, addrlen);
+	if (pkt == NULL) {
+		return -1;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+
 	if (msg != NULL) {
 		int iovec = 0;
 		size_t tmp_read_len;
@@ -1600,6 +1632,198 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY) || defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+/* Only native sockets hold their data in network buffers */
+static struct net_context *zsock_zerocopy_ctx_get(int sock, struct k_mutex **lock)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx;
+
+	ctx = zvfs_get_fd_obj_and_vtable(sock, &vtable, lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	if (vtable != (const struct fd_op_vtable *)&sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return NULL;
+	}
+
+	return ctx;
+}
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+static ssize_t zsock_recv_zerocopy_ctx(struct net_context *ctx,
+				       struct net_buf **frags, int flags,
+				       struct sockaddr *src_addr,
+				       socklen_t *addrlen)
+{
+	struct net_pkt *pkt;
+	size_t hdr_len;
+	ssize_t len;
+
+	if (net_context_get_type(ctx) != SOCK_DGRAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (flags & ~ZSOCK_MSG_DONTWAIT) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	pkt = zsock_recv_dgram_pkt(ctx, flags, src_addr, addrlen);
+	if (pkt == NULL) {
+		return -1;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	hdr_len = net_pkt_get_len(pkt) - len;
+
+	/* Strip the protocol headers in front of the payload */
+	while (hdr_len > 0 && pkt->buffer != NULL) {
+		struct net_buf *frag = pkt->buffer;
+
+		if (frag->len > hdr_len) {
+			net_buf_pull(frag, hdr_len);
+			break;
+		}
+
+		hdr_len -= frag->len;
+		pkt->buffer = net_buf_frag_del(NULL, frag);
+	}
+
+	if (len > 0) {
+		/* The caller owns the buffers now */
+		*frags = pkt->buffer;
+		pkt->buffer = NULL;
+	} else {
+		*frags = NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	net_pkt_unref(pkt);
+
+	return len;
+}
+
+ssize_t zsock_recv_zerocopy(int sock, struct net_buf **frags, int flags,
+			    struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = zsock_zerocopy_ctx_get(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zsock_recv_zerocopy_ctx(ctx, frags, flags, src_addr, addrlen);
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
+#if defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+static ssize_t zsock_send_zerocopy_ctx(struct net_context *ctx,
+				       struct net_buf *frags, int flags,
+				       const struct sockaddr *dest_addr,
+				       socklen_t addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (flags & ~ZSOCK_MSG_DONTWAIT) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	if (!sock_is_eof(ctx)) {
+		status = net_context_recv(ctx, zsock_received_cb,
+					  K_NO_WAIT, ctx->user_data);
+		if (status < 0) {
+			errno = -status;
+			return -1;
+		}
+	}
+
+	while (1) {
+		status = net_context_send_frags(ctx, frags, dest_addr, addrlen,
+						NULL, timeout, ctx->user_data);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+
+ssize_t zsock_send_zerocopy(int sock, struct net_buf *frags, int flags,
+			    const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = zsock_zerocopy_ctx_get(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zsock_send_zerocopy_ctx(ctx, frags, flags, dest_addr, addrlen);
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_SEND_ZEROCOPY */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -1967,6 +2191,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -2598,6 +2836,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
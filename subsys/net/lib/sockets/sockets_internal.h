@@ -55,6 +55,15 @@ static inline bool net_socket_is_tls(void *obj)
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+void net_socket_epoll_close(struct net_context *ctx);
+#else
+static inline void net_socket_epoll_close(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_OBJ_CORE)
 int sock_obj_core_alloc(int sock, struct net_socket_register *reg,
 			int family, int type, int proto);
@@ -0,0 +1,316 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_rtio, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_rtio.h>
+#include <zephyr/zvfs/eventfd.h>
+
+/* Sockets with submissions, owned by the socket RTIO thread */
+static sys_slist_t active_list;
+
+/* Sockets getting their first submission, to add to active_list */
+static struct mpsc new_q = MPSC_INIT(new_q);
+
+static int wake_fd = -1;
+static atomic_t wake_pending;
+
+static struct zsock_pollfd fds[CONFIG_ZVFS_POLL_MAX];
+static struct zsock_rtio_data *fds_data[CONFIG_ZVFS_POLL_MAX];
+
+static void zsock_rtio_wake(void)
+{
+	if (wake_fd >= 0 && !atomic_set(&wake_pending, 1)) {
+		(void)zvfs_eventfd_write(wake_fd, 1);
+	}
+}
+
+static void zsock_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct zsock_rtio_data *data = iodev_sqe->sqe.iodev->data;
+
+	if (FIELD_GET(RTIO_SQE_TRANSACTION, iodev_sqe->sqe.flags) == 1) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_RX:
+		mpsc_push(&data->rx_q, &iodev_sqe->q);
+		break;
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+		mpsc_push(&data->tx_q, &iodev_sqe->q);
+		break;
+	default:
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	atomic_set(&data->kick, 1);
+
+	if (!atomic_set(&data->active, 1)) {
+		mpsc_push(&new_q, &data->new_node);
+	}
+
+	zsock_rtio_wake();
+}
+
+const struct rtio_iodev_api zsock_rtio_iodev_api = {
+	.submit = zsock_rtio_submit,
+};
+
+int zsock_rtio_iodev_set_fd(const struct rtio_iodev *iodev, int fd)
+{
+	struct zsock_rtio_data *data = iodev->data;
+
+	if (atomic_get(&data->active) != 0) {
+		return -EBUSY;
+	}
+
+	data->fd = fd;
+
+	return 0;
+}
+
+static struct rtio_iodev_sqe *next_sqe(struct mpsc *q, struct rtio_iodev_sqe **cur)
+{
+	struct mpsc_node *node;
+
+	if (*cur == NULL) {
+		node = mpsc_pop(q);
+		if (node != NULL) {
+			*cur = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		}
+	}
+
+	return *cur;
+}
+
+static int do_rx(struct zsock_rtio_data *data, struct rtio_iodev_sqe *iodev_sqe)
+{
+	uint8_t *buf;
+	uint32_t len;
+	ssize_t ret;
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, 1, CONFIG_NET_SOCKETS_RTIO_MEMPOOL_RX_SIZE,
+			      &buf, &len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = zsock_recv(data->fd, buf, len, ZSOCK_MSG_DONTWAIT);
+
+	return ret < 0 ? -errno : ret;
+}
+
+static int do_tx(struct zsock_rtio_data *data, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	ssize_t ret;
+
+	if (sqe->op == RTIO_OP_TINY_TX) {
+		ret = zsock_send(data->fd, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len,
+				 ZSOCK_MSG_DONTWAIT);
+	} else {
+		ret = zsock_send(data->fd, sqe->tx.buf, sqe->tx.buf_len,
+				 ZSOCK_MSG_DONTWAIT);
+	}
+
+	return ret < 0 ? -errno : ret;
+}
+
+/* Complete the submissions of a queue until one would block, returns true
+ * if one is left pending.
+ */
+static bool pump(struct zsock_rtio_data *data, struct mpsc *q,
+		 struct rtio_iodev_sqe **cur,
+		 int (*op)(struct zsock_rtio_data *data,
+			   struct rtio_iodev_sqe *iodev_sqe))
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	int ret;
+
+	while ((iodev_sqe = next_sqe(q, cur)) != NULL) {
+		if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags) == 1) {
+			ret = -ECANCELED;
+		} else if (data->fd < 0) {
+			ret = -EBADF;
+		} else {
+			ret = op(data, iodev_sqe);
+			if (ret == -EAGAIN || ret == -EWOULDBLOCK) {
+				return true;
+			}
+		}
+
+		/* The completion can submit again to this device */
+		*cur = NULL;
+
+		if (ret < 0) {
+			rtio_iodev_sqe_err(iodev_sqe, ret);
+		} else {
+			rtio_iodev_sqe_ok(iodev_sqe, ret);
+		}
+	}
+
+	return false;
+}
+
+static void fail_all(struct zsock_rtio_data *data, int err)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+
+	while ((iodev_sqe = next_sqe(&data->rx_q, &data->rx)) != NULL) {
+		data->rx = NULL;
+		rtio_iodev_sqe_err(iodev_sqe, err);
+	}
+
+	while ((iodev_sqe = next_sqe(&data->tx_q, &data->tx)) != NULL) {
+		data->tx = NULL;
+		rtio_iodev_sqe_err(iodev_sqe, err);
+	}
+}
+
+/* Run the pending submissions of a socket, returns the poll events to wait
+ * for before trying again, or 0 if the socket has no submission left.
+ */
+static short zsock_rtio_process(struct zsock_rtio_data *data)
+{
+	short events = 0;
+
+	if (pump(data, &data->rx_q, &data->rx, do_rx)) {
+		events |= ZSOCK_POLLIN;
+	}
+
+	if (pump(data, &data->tx_q, &data->tx, do_tx)) {
+		events |= ZSOCK_POLLOUT;
+	}
+
+	return events;
+}
+
+static bool zsock_rtio_idle(struct zsock_rtio_data *data)
+{
+	atomic_clear(&data->active);
+
+	/* Catch submissions racing with the clearing of the active flag */
+	if (next_sqe(&data->rx_q, &data->rx) == NULL &&
+	    next_sqe(&data->tx_q, &data->tx) == NULL) {
+		return true;
+	}
+
+	/* Whoever set the flag again has queued the socket in new_q */
+	if (atomic_set(&data->active, 1) != 0) {
+		return true;
+	}
+
+	atomic_set(&data->kick, 1);
+
+	return false;
+}
+
+static void zsock_rtio_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct zsock_rtio_data *data, *next;
+	struct mpsc_node *node;
+	zvfs_eventfd_t value;
+	bool overflow;
+	int nfds;
+	int ret;
+
+	ret = zvfs_eventfd(0, 0);
+	if (ret < 0) {
+		NET_ERR("zvfs_eventfd failed (%d)", -errno);
+		return;
+	}
+
+	fds[0].fd = ret;
+	fds[0].events = ZSOCK_POLLIN;
+	wake_fd = ret;
+
+	while (true) {
+		while ((node = mpsc_pop(&new_q)) != NULL) {
+			data = CONTAINER_OF(node, struct zsock_rtio_data, new_node);
+			sys_slist_append(&active_list, &data->node);
+		}
+
+		nfds = 1;
+		overflow = false;
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&active_list, data, next, node) {
+			short events = 0;
+
+			/* Only sockets that were polled or got new submissions
+			 * can make progress.
+			 */
+			if (atomic_clear(&data->kick) != 0) {
+				events = zsock_rtio_process(data);
+			} else {
+				events = (data->rx != NULL ? ZSOCK_POLLIN : 0) |
+					 (data->tx != NULL ? ZSOCK_POLLOUT : 0);
+			}
+
+			if (events == 0) {
+				if (zsock_rtio_idle(data)) {
+					sys_slist_find_and_remove(&active_list, &data->node);
+				}
+
+				continue;
+			}
+
+			if (nfds == ARRAY_SIZE(fds)) {
+				/* Try those again after a short wait */
+				atomic_set(&data->kick, 1);
+				overflow = true;
+				continue;
+			}
+
+			fds[nfds].fd = data->fd;
+			fds[nfds].events = events;
+			fds[nfds].revents = 0;
+			fds_data[nfds] = data;
+			nfds++;
+		}
+
+		ret = zsock_poll(fds, nfds,
+				 overflow ? CONFIG_NET_SOCKETS_RTIO_OVERFLOW_POLL_MS : -1);
+		if (ret < 0) {
+			NET_ERR("poll failed (%d)", -errno);
+			k_msleep(CONFIG_NET_SOCKETS_RTIO_OVERFLOW_POLL_MS);
+			continue;
+		}
+
+		for (int i = 1; i < nfds; i++) {
+			if (fds[i].revents == 0) {
+				continue;
+			}
+
+			if (fds[i].revents & ZSOCK_POLLNVAL) {
+				fail_all(fds_data[i], -EBADF);
+			} else {
+				atomic_set(&fds_data[i]->kick, 1);
+			}
+		}
+
+		if (fds[0].revents != 0) {
+			atomic_clear(&wake_pending);
+			(void)zvfs_eventfd_read(fds[0].fd, &value);
+		}
+	}
+}
+
+K_THREAD_DEFINE(net_sock_rtio, CONFIG_NET_SOCKETS_RTIO_STACK_SIZE,
+		zsock_rtio_thread, NULL, NULL, NULL,
+		CLAMP(CONFIG_NET_SOCKETS_RTIO_THREAD_PRIO,
+		      K_HIGHEST_APPLICATION_THREAD_PRIO,
+		      K_LOWEST_APPLICATION_THREAD_PRIO), 0, 0);
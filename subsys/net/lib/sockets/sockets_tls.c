@@ -47,6 +47,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -101,12 +104,15 @@ struct dtls_timing_context {
 
 /** TLS peer address/session ID mapping. */
 struct tls_session_cache {
-	/** Creation time. */
+	/** Last time the session was stored or used. */
 	int64_t timestamp;
 
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Hash of the peer hostname, 0 if none was set. */
+	uint32_t hostname_hash;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -173,6 +179,11 @@ __net_socket struct tls_context {
 		/** Information if hostname was explicitly set on a socket. */
 		bool is_hostname_set;
 
+		/** Hash of the hostname set on a socket, used as session
+		 * cache key, 0 if none.
+		 */
+		uint32_t hostname_hash;
+
 		/** Peer verification level. */
 		int8_t verify_level;
 
@@ -213,6 +224,14 @@ __net_socket struct tls_context {
 #endif /* CONFIG_NET_SOCKETS_TLS_CERT_VERIFY_CALLBACK */
 	} options;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE)
+	/** Application data sent since the connection was (re)started. */
+	size_t tx_bytes;
+
+	/** Time of the last send. */
+	int64_t tx_last;
+#endif /* CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	/** Context information for DTLS timing. */
 	struct dtls_timing_context dtls_timing;
@@ -258,6 +277,20 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+static mbedtls_ssl_ticket_context server_tickets;
+
+#if defined(MBEDTLS_GCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_GCM
+#elif defined(MBEDTLS_CCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_CCM
+#elif defined(MBEDTLS_CHACHAPOLY_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_CHACHA20_POLY1305
+#else
+#error "Session tickets require an AEAD cipher (GCM, CCM or ChaCha20-Poly1305)"
+#endif
+#endif /* CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS */
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -295,6 +328,28 @@ static int tls_ctr_drbg_random(void *ctx, unsigned char *buf, size_t len)
 #endif
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+static bool server_tickets_ready;
+
+/* (Re)generate the key session tickets are encrypted with. */
+static void tls_session_tickets_setup(void)
+{
+	int ret;
+
+	mbedtls_ssl_ticket_init(&server_tickets);
+
+	ret = mbedtls_ssl_ticket_setup(&server_tickets, tls_ctr_drbg_random, NULL,
+				       TLS_TICKET_CIPHER,
+				       CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKET_LIFETIME);
+	if (ret != 0) {
+		NET_ERR("Failed to set up session tickets, err: -0x%x", -ret);
+		mbedtls_ssl_ticket_free(&server_tickets);
+	}
+
+	server_tickets_ready = (ret == 0);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 /* mbedTLS-defined function for setting timer. */
 static void dtls_timing_set_delay(void *data, uint32_t int_ms, uint32_t fin_ms)
@@ -377,6 +432,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	tls_session_tickets_setup();
+#endif
+
 	return 0;
 }
 
@@ -575,7 +634,29 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+/* Sessions of a socket with a hostname set are bound to the hostname and
+ * port, so that they can be resumed whichever address the name resolves to,
+ * other sessions to the peer address.
+ */
+static bool tls_session_match(const struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      uint32_t hostname_hash)
+{
+	if (entry->hostname_hash != hostname_hash) {
+		return false;
+	}
+
+	if (hostname_hash != 0) {
+		return entry->peer_addr.sa_family == peer_addr->sa_family &&
+		       net_sin(&entry->peer_addr)->sin_port ==
+		       net_sin(peer_addr)->sin_port;
+	}
+
+	return peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    uint32_t hostname_hash,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -589,16 +670,19 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
-				/* Reuse old entry for given address. */
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname_hash)) {
+				/* Reuse old entry for given peer. */
 				entry = &client_cache[i];
 				break;
 			}
 
-			/* Remember the oldest entry and reuse if needed. */
+			/* Remember the least recently used entry and reuse
+			 * if needed.
+			 */
 			if (entry == NULL ||
 			    (entry->session != NULL &&
-			     entry->timestamp < client_cache[i].timestamp)) {
+			     client_cache[i].timestamp < entry->timestamp)) {
 				entry = &client_cache[i];
 			}
 		}
@@ -630,12 +714,14 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
+	entry->hostname_hash = hostname_hash;
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
 
 	return 0;
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   uint32_t hostname_hash,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -643,7 +729,8 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_match(&client_cache[i], peer_addr,
+				      hostname_hash)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -663,6 +750,8 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 		return -EIO;
 	}
 
+	entry->timestamp = k_uptime_get();
+
 	return 0;
 }
 
@@ -687,7 +776,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, context->options.hostname_hash,
+			       &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -711,7 +801,8 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, context->options.hostname_hash,
+			      &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -734,6 +825,15 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	/* Tickets issued so far can no longer be decrypted. */
+	if (server_tickets_ready) {
+		mbedtls_ssl_ticket_free(&server_tickets);
+	}
+
+	tls_session_tickets_setup();
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -1174,6 +1274,10 @@ static int tls_mbedtls_reset(struct tls_context *context)
 
 	k_sem_reset(&context->tls_established);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE)
+	context->tx_bytes = 0;
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	/* Server role: reset the address so that a new
 	 *              client can connect w/o a need to reopen a socket
@@ -1425,6 +1529,15 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	if (is_server && context->options.cache_enabled && server_tickets_ready) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &server_tickets);
+	}
+#endif
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 	mbedtls_ssl_conf_early_data(&context->config, MBEDTLS_SSL_EARLY_DATA_ENABLED);
 #endif
@@ -1677,6 +1790,22 @@ static int tls_opt_sec_tag_list_get(struct tls_context *context,
 	return 0;
 }
 
+/* FNV-1a hash of a hostname, never 0 so that 0 can stand for no hostname. */
+static uint32_t tls_hostname_hash(const char *hostname)
+{
+	uint32_t hash = 2166136261U;
+
+	if (hostname == NULL) {
+		return 0;
+	}
+
+	while (*hostname != '\0') {
+		hash = (hash ^ (uint8_t)*hostname++) * 16777619U;
+	}
+
+	return hash != 0 ? hash : 1;
+}
+
 static int tls_opt_hostname_set(struct tls_context *context,
 				const void *optval, socklen_t optlen)
 {
@@ -1691,6 +1820,7 @@ static int tls_opt_hostname_set(struct tls_context *context,
 #endif
 
 	context->options.is_hostname_set = true;
+	context->options.hostname_hash = tls_hostname_hash(optval);
 
 	return 0;
 }
@@ -2493,12 +2623,67 @@ error:
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE)
+/* Keep records small while the connection warms up, so that each of them
+ * fits in a TCP segment and can be decrypted by the peer as soon as it
+ * arrives, and let them grow to full size once enough data was sent.
+ */
+static void tls_record_start(struct tls_context *ctx)
+{
+	int64_t now = k_uptime_get();
+
+	if (now - ctx->tx_last > CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_IDLE_MS) {
+		ctx->tx_bytes = 0;
+	}
+
+	ctx->tx_last = now;
+}
+
+/* Only changes once data was sent, so that a write retried after
+ * MBEDTLS_ERR_SSL_WANT_WRITE is given the same length again.
+ */
+static size_t tls_record_len(struct tls_context *ctx, size_t len)
+{
+	if (ctx->tx_bytes < CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_THRESHOLD) {
+		return MIN(len, CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SMALL_SIZE);
+	}
+
+	return len;
+}
+
+static void tls_record_sent(struct tls_context *ctx, size_t len)
+{
+	if (ctx->tx_bytes < CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_THRESHOLD) {
+		ctx->tx_bytes += len;
+	}
+}
+#else
+static inline void tls_record_start(struct tls_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline size_t tls_record_len(struct tls_context *ctx, size_t len)
+{
+	ARG_UNUSED(ctx);
+
+	return len;
+}
+
+static inline void tls_record_sent(struct tls_context *ctx, size_t len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(len);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE */
+
 static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 			size_t len, int flags)
 {
 	const bool is_block = is_blocking(ctx->sock, flags);
 	k_timeout_t timeout;
 	k_timepoint_t end;
+	size_t sent = 0;
 	int ret;
 
 	if (ctx->error != 0) {
@@ -2518,11 +2703,24 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	}
 
 	end = sys_timepoint_calc(timeout);
+	tls_record_start(ctx);
 
 	do {
-		ret = mbedtls_ssl_write(&ctx->ssl, buf, len);
+		ret = mbedtls_ssl_write(&ctx->ssl, (const uint8_t *)buf + sent,
+					tls_record_len(ctx, len - sent));
 		if (ret >= 0) {
-			return ret;
+			tls_record_sent(ctx, ret);
+			sent += ret;
+
+			/* Records may have been cut short, blocking sockets
+			 * still send everything.
+			 */
+			if (IS_ENABLED(CONFIG_NET_SOCKETS_TLS_DYNAMIC_RECORD_SIZE) &&
+			    is_block && sent < len) {
+				continue;
+			}
+
+			return sent;
 		}
 
 		if (ret == MBEDTLS_ERR_SSL_WANT_READ ||
@@ -2569,6 +2767,11 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 		}
 	} while (true);
 
+	/* Report what was sent before the failure, if anything. */
+	if (sent > 0) {
+		return sent;
+	}
+
 	return -1;
 }
 
@@ -691,15 +691,44 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
-int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
-		       enum websocket_opcode opcode, bool mask, bool final,
-		       int32_t timeout)
+/* XOR data with the masking key, as if it started at byte @p offset of the
+ * payload. Aligned words of the data are masked at once.
+ */
+static void websocket_mask(uint8_t *data, size_t len, uint32_t masking_value,
+			   size_t offset)
 {
-	struct websocket_context *ctx;
-	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
-	int ret;
+	uint8_t key[sizeof(uint32_t)];
+	size_t i = 0;
+
+	sys_put_be32(masking_value, key);
 
+	for (; i < len && !IS_ALIGNED(&data[i], sizeof(uint32_t)); i++) {
+		data[i] ^= key[(offset + i) % sizeof(key)];
+	}
+
+	if (len - i >= sizeof(uint32_t)) {
+		uint8_t rotated[sizeof(key)];
+		uint32_t key_word;
+
+		for (size_t j = 0; j < sizeof(key); j++) {
+			rotated[j] = key[(offset + i + j) % sizeof(key)];
+		}
+
+		memcpy(&key_word, rotated, sizeof(key_word));
+
+		for (; len - i >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+			*(uint32_t *)&data[i] ^= key_word;
+		}
+	}
+
+	for (; i < len; i++) {
+		data[i] ^= key[(offset + i) % sizeof(key)];
+	}
+}
+
+static int websocket_send_ctx(int ws_sock, enum websocket_opcode opcode,
+			      struct websocket_context **ctx)
+{
 	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
 	    opcode != WEBSOCKET_OPCODE_DATA_BINARY &&
 	    opcode != WEBSOCKET_OPCODE_CONTINUE &&
@@ -709,8 +738,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		return -EINVAL;
 	}
 
-	ctx = zvfs_get_fd_obj(ws_sock, NULL, 0);
-	if (ctx == NULL) {
+	*ctx = zvfs_get_fd_obj(ws_sock, NULL, 0);
+	if (*ctx == NULL) {
 		return -EBADF;
 	}
 
@@ -719,15 +748,22 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	 * its own, hence skip the check.
 	 */
 
-	if (!PART_OF_ARRAY(contexts, ctx)) {
+	if (!PART_OF_ARRAY(contexts, *ctx)) {
 		return -ENOENT;
 	}
 #endif /* !defined(CONFIG_NET_TEST) */
 
-	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
-		mask, final ? "final" : "more");
+	return 0;
+}
 
-	memset(header, 0, sizeof(header));
+/* Returns the length of the header written to @p header */
+static uint8_t websocket_build_header(uint8_t *header, size_t payload_len,
+				      enum websocket_opcode opcode, bool mask,
+				      bool final, uint32_t masking_value)
+{
+	uint8_t hdr_len = 2;
+
+	memset(header, 0, MAX_HEADER_LEN);
 
 	/* Is this the last packet? */
 	header[0] = final ? BIT(7) : 0;
@@ -760,14 +796,32 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
+		sys_put_be32(masking_value, &header[hdr_len]);
+		hdr_len += sizeof(uint32_t);
+	}
 
-		ctx->masking_value = sys_rand32_get();
+	return hdr_len;
+}
+
+int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
+		       enum websocket_opcode opcode, bool mask, bool final,
+		       int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN], hdr_len;
+	uint8_t *data_to_send = (uint8_t *)payload;
+	int ret;
+
+	ret = websocket_send_ctx(ws_sock, opcode, &ctx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
 
-		header[hdr_len++] |= ctx->masking_value >> 24;
-		header[hdr_len++] |= ctx->masking_value >> 16;
-		header[hdr_len++] |= ctx->masking_value >> 8;
-		header[hdr_len++] |= ctx->masking_value;
+	if (mask) {
+		ctx->masking_value = sys_rand32_get();
 
 		if ((payload != NULL) && (payload_len > 0)) {
 			data_to_send = k_malloc(payload_len);
@@ -776,13 +830,13 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 			}
 
 			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask(data_to_send, payload_len, ctx->masking_value, 0);
 		}
 	}
 
+	hdr_len = websocket_build_header(header, payload_len, opcode, mask, final,
+					 ctx->masking_value);
+
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
 					 data_to_send, payload_len, timeout);
 	if (ret < 0) {
@@ -803,6 +857,54 @@ quit:
 	return ret - hdr_len;
 }
 
+int websocket_send_msg_inplace(int ws_sock, uint8_t *buf, size_t payload_len,
+			       enum websocket_opcode opcode, bool mask, bool final,
+			       int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t *payload = buf + WEBSOCKET_HEADROOM;
+	uint8_t header[MAX_HEADER_LEN], hdr_len;
+	int ret;
+
+	BUILD_ASSERT(WEBSOCKET_HEADROOM == MAX_HEADER_LEN);
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	ret = websocket_send_ctx(ws_sock, opcode, &ctx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	NET_DBG("[%p] Len %zd %s/%d/%s in place", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	if (mask) {
+		ctx->masking_value = sys_rand32_get();
+		websocket_mask(payload, payload_len, ctx->masking_value, 0);
+	}
+
+	/* The header goes right in front of the payload */
+	hdr_len = websocket_build_header(header, payload_len, opcode, mask, final,
+					 ctx->masking_value);
+	memcpy(payload - hdr_len, header, hdr_len);
+
+	ret = websocket_prepare_and_send(ctx, payload - hdr_len, hdr_len,
+					 payload, payload_len, timeout);
+	if (ret < 0) {
+		NET_DBG("Cannot send ws msg (%d)", -errno);
+		return ret;
+	}
+
+	/* Do no math with 0 and error codes */
+	if (ret == 0) {
+		return ret;
+	}
+
+	return ret - hdr_len;
+}
+
 static uint32_t websocket_opcode2flag(uint8_t data)
 {
 	switch (data & 0x0f) {
@@ -838,6 +940,16 @@ static int websocket_parse(struct websocket_context *ctx, struct websocket_buffe
 			switch (ctx->parser_state) {
 			case WEBSOCKET_PARSER_STATE_OPCODE:
 				ctx->message_type = websocket_opcode2flag(data);
+				if ((data & 0x0f) == WEBSOCKET_OPCODE_CONTINUE) {
+					/* Report the type of the first fragment so that
+					 * fragments can be consumed as they arrive.
+					 */
+					ctx->message_type = ctx->fragment_type;
+				} else if ((ctx->message_type &
+					    (WEBSOCKET_FLAG_TEXT | WEBSOCKET_FLAG_BINARY)) != 0) {
+					ctx->fragment_type = ctx->message_type;
+				}
+
 				if ((data & 0x80) != 0) {
 					ctx->message_type |= WEBSOCKET_FLAG_FINAL;
 				}
@@ -977,6 +1089,43 @@ static int timeout_to_ms(k_timeout_t *timeout)
 
 #endif /* !defined(CONFIG_NET_TEST) */
 
+static int websocket_recv_raw(int ws_sock, struct websocket_context *ctx,
+			      uint8_t *buf, size_t buf_len, k_timepoint_t end)
+{
+#if defined(CONFIG_NET_TEST)
+	struct test_data *test_data = zvfs_get_fd_obj(ws_sock, NULL, 0);
+	size_t input_len = MIN(buf_len, test_data->input_len - test_data->input_pos);
+
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(end);
+
+	if (input_len == 0) {
+		/* emulate timeout */
+		return -EAGAIN;
+	}
+
+	memcpy(buf, &test_data->input_buf[test_data->input_pos], input_len);
+	test_data->input_pos += input_len;
+
+	return input_len;
+#else
+	k_timeout_t tout = sys_timepoint_timeout(end);
+	int ret;
+
+	ARG_UNUSED(ws_sock);
+
+	ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
+	if (ret == 0) {
+		ret = zsock_recv(ctx->real_sock, buf, buf_len, ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			ret = -errno;
+		}
+	}
+
+	return ret;
+#endif /* CONFIG_NET_TEST */
+}
+
 int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining, int32_t timeout)
 {
@@ -1019,31 +1168,21 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		size_t parsed_count;
 
 		if (ctx->recv_buf.count == 0) {
-#if defined(CONFIG_NET_TEST)
-			size_t input_len = MIN(ctx->recv_buf.size,
-					       test_data->input_len - test_data->input_pos);
-
-			if (input_len > 0) {
-				memcpy(ctx->recv_buf.buf,
-				       &test_data->input_buf[test_data->input_pos], input_len);
-				test_data->input_pos += input_len;
-				ret = input_len;
+			/* Payload is received straight into the caller's buffer,
+			 * only headers go through the parser buffer.
+			 */
+			bool direct = (ctx->parser_state == WEBSOCKET_PARSER_STATE_PAYLOAD) &&
+				      (payload.count < payload.size);
+
+			if (direct) {
+				ret = websocket_recv_raw(ws_sock, ctx, &payload.buf[payload.count],
+							 MIN(ctx->parser_remaining,
+							     payload.size - payload.count),
+							 end);
 			} else {
-				/* emulate timeout */
-				ret = -EAGAIN;
+				ret = websocket_recv_raw(ws_sock, ctx, ctx->recv_buf.buf,
+							 ctx->recv_buf.size, end);
 			}
-#else
-			tout = sys_timepoint_timeout(end);
-
-			ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
-			if (ret == 0) {
-				ret = zsock_recv(ctx->real_sock, ctx->recv_buf.buf,
-						 ctx->recv_buf.size, ZSOCK_MSG_DONTWAIT);
-				if (ret < 0) {
-					ret = -errno;
-				}
-			}
-#endif /* CONFIG_NET_TEST */
 
 			if (ret < 0) {
 				if ((ret == -EAGAIN) && (payload.count > 0)) {
@@ -1058,7 +1197,15 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 				return -ENOTCONN;
 			}
 
-			ctx->recv_buf.count = ret;
+			if (direct) {
+				payload.count += ret;
+				ctx->parser_remaining -= ret;
+				if (ctx->parser_remaining == 0) {
+					ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+				}
+			} else {
+				ctx->recv_buf.count = ret;
+			}
 
 			NET_DBG("[%p] Received %d bytes", ctx, ret);
 		}
@@ -1093,15 +1240,9 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.count, ctx->masking_value, data_buf_offset);
 	}
 
 	if (ctx->message_type == WEBSOCKET_FLAG_CLOSE) {
@@ -102,6 +102,9 @@ __net_socket struct websocket_context {
 	/** Message type */
 	uint32_t message_type;
 
+	/** Type of the fragmented message, reported for its continuation frames */
+	uint32_t fragment_type;
+
 	/** Parser remaining length in current state */
 	uint64_t parser_remaining;
 
@@ -32,6 +32,53 @@ static struct k_work_q pm_device_runtime_wq;
 
 #define EVENT_MASK		(EVENT_STATE_ACTIVE | EVENT_STATE_SUSPENDED)
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+static void runtime_schedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ
+	(void)k_work_schedule(dwork, delay);
+#else
+	(void)k_work_schedule_for_queue(&pm_device_runtime_wq, dwork, delay);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ */
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND
+static struct k_spinlock group_lock;
+
+/*
+ * Align the delayed suspend of a device with the suspends already queued on
+ * its power domain, so that the devices are suspended in a row and the domain
+ * is put right after. The delay is extended, never shortened, and the group
+ * is restarted when the device is due after it.
+ */
+static k_timeout_t group_suspend_delay(struct pm_device_base *pm, k_timeout_t delay)
+{
+	const struct device *domain = PM_DOMAIN(pm);
+	k_spinlock_key_t key;
+	int64_t now, due;
+
+	if ((domain == NULL) || (domain->pm_base == NULL) ||
+	    !atomic_test_bit(&pm->flags, PM_DEVICE_FLAG_PD_CLAIMED) ||
+	    K_TIMEOUT_EQ(delay, K_FOREVER) || !Z_IS_TIMEOUT_RELATIVE(delay)) {
+		return delay;
+	}
+
+	key = k_spin_lock(&group_lock);
+	now = k_uptime_ticks();
+	due = now + delay.ticks;
+	if (domain->pm_base->group_suspend < due) {
+		domain->pm_base->group_suspend = due;
+	} else if ((domain->pm_base->group_suspend - due) <=
+		   k_ms_to_ticks_ceil64(CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND_WINDOW_MS)) {
+		due = domain->pm_base->group_suspend;
+	}
+	k_spin_unlock(&group_lock, key);
+
+	return K_TICKS(due - now);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND */
+
 /**
  * @brief Suspend a device
  *
@@ -88,11 +135,10 @@ static int runtime_suspend(const struct device *dev, bool async,
 		/* queue suspend */
 #ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
 		pm->base.state = PM_DEVICE_STATE_SUSPENDING;
-#ifdef CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ
-		(void)k_work_schedule(&pm->work, delay);
-#else
-		(void)k_work_schedule_for_queue(&pm_device_runtime_wq, &pm->work, delay);
-#endif /* CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ */
+#ifdef CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND
+		delay = group_suspend_delay(&pm->base, delay);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_GROUP_SUSPEND */
+		runtime_schedule(&pm->work, delay);
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 	} else {
 		/* suspend now */
@@ -152,6 +198,45 @@ static void runtime_suspend_work(struct k_work *work)
 }
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+static void runtime_resume_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, resume_work);
+
+	/*
+	 * Hold the device for a while, a get coming in the meantime finds it
+	 * active and only has to cancel the pending suspend.
+	 */
+	if (pm_device_runtime_get(pm->dev) == 0) {
+		(void)pm_device_runtime_put_async(pm->dev,
+			K_MSEC(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS));
+	}
+}
+
+/* Keep the longest resume seen lately, slowly forgetting older ones */
+static void resume_ticks_update(struct pm_device *pm, uint32_t cycles)
+{
+	uint32_t ticks = k_cyc_to_ticks_ceil32(cycles);
+
+	pm->resume_ticks = MAX(ticks, pm->resume_ticks - pm->resume_ticks / 4U);
+}
+
+/* Time needed to resume a device along with the domains above it */
+static uint32_t resume_lead_ticks(const struct device *dev)
+{
+	uint32_t lead = 0U;
+
+	while ((dev != NULL) && (dev->pm_base != NULL) &&
+	       !atomic_test_bit(&dev->pm_base->flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		lead += dev->pm->resume_ticks;
+		dev = PM_DOMAIN(dev->pm_base);
+	}
+
+	return lead;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
 static int get_sync_locked(const struct device *dev)
 {
 	int ret;
@@ -280,6 +365,10 @@ int pm_device_runtime_get(const struct device *dev)
 		goto unlock;
 	}
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+	uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
 	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_RESUME);
 	if (ret < 0) {
 		pm->base.usage--;
@@ -289,6 +378,10 @@ int pm_device_runtime_get(const struct device *dev)
 		goto unlock;
 	}
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+	resume_ticks_update(pm, k_cycle_get_32() - start);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
 	pm->base.state = PM_DEVICE_STATE_ACTIVE;
 
 unlock:
@@ -396,6 +489,42 @@ int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay)
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 }
 
+int pm_device_runtime_resume_ahead(const struct device *dev, k_timeout_t needed_in)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+	struct pm_device *pm = dev->pm;
+	k_ticks_t ticks;
+
+	if (pm == NULL) {
+		return 0;
+	}
+
+	if (atomic_test_bit(&pm->base.flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		return -ENOTSUP;
+	}
+
+	if (!atomic_test_bit(&pm->base.flags, PM_DEVICE_FLAG_RUNTIME_ENABLED)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(needed_in, K_FOREVER)) {
+		return -EINVAL;
+	}
+
+	ticks = sys_timepoint_timeout(sys_timepoint_calc(needed_in)).ticks;
+	ticks = MAX(ticks - (k_ticks_t)resume_lead_ticks(dev), 0);
+	runtime_schedule(&pm->resume_work, K_TICKS(ticks));
+
+	return 0;
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(needed_in);
+
+	LOG_WRN("Function not available");
+	return -ENOSYS;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+}
+
 __boot_func
 int pm_device_runtime_auto_enable(const struct device *dev)
 {
@@ -473,6 +602,9 @@ int pm_device_runtime_enable(const struct device *dev)
 #ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
 		k_work_init_delayable(&pm->work, runtime_suspend_work);
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+		k_work_init_delayable(&pm->resume_work, runtime_resume_work);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
 	}
 
 	if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
@@ -228,7 +228,7 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	 */
 	k_sched_lock();
 
-	if (IS_ENABLED(CONFIG_PM_STATS)) {
+	if (IS_ENABLED(CONFIG_PM_STATS) || IS_ENABLED(CONFIG_PM_POLICY_DEFAULT_PREDICTIVE)) {
 		pm_stats_start();
 	}
 	/* Enter power state */
@@ -238,12 +238,20 @@ bool pm_system_suspend(int32_t kernel_ticks)
 
 	/* Wake up sequence starts here */
 
-	if (IS_ENABLED(CONFIG_PM_STATS)) {
+	if (IS_ENABLED(CONFIG_PM_STATS) || IS_ENABLED(CONFIG_PM_POLICY_DEFAULT_PREDICTIVE)) {
 		pm_stats_stop();
+	}
+
+	if (IS_ENABLED(CONFIG_PM_STATS)) {
 		pm_stats_update(z_cpus_pm_state[id] ?
 				z_cpus_pm_state[id]->state : PM_STATE_ACTIVE);
 	}
 
+	if (IS_ENABLED(CONFIG_PM_POLICY_DEFAULT_PREDICTIVE) && z_cpus_pm_state[id]) {
+		pm_policy_idle_update(id, z_cpus_pm_state[id], ticks,
+				      k_cyc_to_us_floor32(pm_stats_last_cycles()));
+	}
+
 	pm_system_resume();
 	k_sched_unlock();
 	SYS_PORT_TRACING_FUNC_EXIT(pm, system_suspend, ticks,
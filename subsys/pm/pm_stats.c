@@ -12,6 +12,10 @@
 #include <zephyr/stats/stats.h>
 #include <zephyr/sys/printk.h>
 
+static uint32_t time_start[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t time_stop[CONFIG_MP_MAX_NUM_CPUS];
+
+#ifdef CONFIG_PM_STATS
 STATS_SECT_START(pm_stats)
 STATS_SECT_ENTRY32(state_count)
 STATS_SECT_ENTRY32(state_last_cycles)
@@ -28,8 +32,6 @@ static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
 
 #define PM_STAT_NAME_LEN sizeof("pm_cpu_XXX_state_X_stats")
 static char names[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT][PM_STAT_NAME_LEN];
-static uint32_t time_start[CONFIG_MP_MAX_NUM_CPUS];
-static uint32_t time_stop[CONFIG_MP_MAX_NUM_CPUS];
 
 static int pm_stats_init(void)
 {
@@ -50,6 +52,7 @@ static int pm_stats_init(void)
 }
 
 SYS_INIT(pm_stats_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_PM_STATS */
 
 void pm_stats_start(void)
 {
@@ -61,12 +64,21 @@ void pm_stats_stop(void)
 	time_stop[CPU_ID] = k_cycle_get_32();
 }
 
+uint32_t pm_stats_last_cycles(void)
+{
+	uint8_t cpu = CPU_ID;
+
+	return time_stop[cpu] - time_start[cpu];
+}
+
+#ifdef CONFIG_PM_STATS
 void pm_stats_update(enum pm_state state)
 {
 	uint8_t cpu = CPU_ID;
-	uint32_t time_total = time_stop[cpu] - time_start[cpu];
+	uint32_t time_total = pm_stats_last_cycles();
 
 	STATS_INC(stats[cpu][state], state_count);
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
 }
+#endif /* CONFIG_PM_STATS */
@@ -13,5 +13,6 @@
 void pm_stats_start(void);
 void pm_stats_stop(void);
 void pm_stats_update(enum pm_state state);
+uint32_t pm_stats_last_cycles(void);
 
 #endif /* ZEPHYR_SUBSYS_PM_PM_STATS_H_ */
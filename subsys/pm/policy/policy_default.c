@@ -9,11 +9,108 @@
 #include <zephyr/sys_clock.h>
 #include <zephyr/pm/device.h>
 
+static inline uint32_t state_threshold_us(const struct pm_state_info *state)
+{
+	return state->min_residency_us + state->exit_latency_us;
+}
+
+#ifdef CONFIG_PM_POLICY_DEFAULT_PREDICTIVE
+/*
+ * Idle durations are sorted in bins: bin 0 is for durations too short for
+ * any state, bin i + 1 for those long enough for state i but not for state
+ * i + 1. Each bin counts, with exponential decay, the idle periods which
+ * ended with the timeout they were bounded by (hits) and those which were
+ * cut short by another wakeup source (intercepts).
+ */
+#define MAX_STATES (DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(cpus), DT_NUM_CPU_POWER_STATES, (+)))
+#define PULSE 1024U
+
+struct idle_bin {
+	uint32_t hits;
+	uint32_t intercepts;
+};
+
+static struct idle_bin idle_bins[CONFIG_MP_MAX_NUM_CPUS][MAX_STATES + 1];
+
+static uint8_t idle_bin_of(const struct pm_state_info *states, uint8_t num_states,
+			   uint32_t idle_us)
+{
+	uint8_t bin = 0;
+
+	while (bin < num_states && idle_us >= state_threshold_us(&states[bin])) {
+		bin++;
+	}
+
+	return bin;
+}
+
+void pm_policy_idle_update(uint8_t cpu, const struct pm_state_info *state, int32_t ticks,
+			   uint32_t idle_us)
+{
+	const struct pm_state_info *cpu_states;
+	struct idle_bin *bins = idle_bins[cpu];
+	uint8_t num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+	uint32_t sleep_us = ticks == K_TICKS_FOREVER ? UINT32_MAX : k_ticks_to_us_floor32(ticks);
+	uint8_t timer_bin = idle_bin_of(cpu_states, num_cpu_states, sleep_us);
+	uint8_t bin = idle_bin_of(cpu_states, num_cpu_states, idle_us);
+	/* The timer fires exit_latency_us early, see pm_system_suspend() */
+	bool timer_wakeup = sleep_us != UINT32_MAX &&
+			    (uint64_t)idle_us + state->exit_latency_us + k_ticks_to_us_ceil32(1) >=
+				    sleep_us;
+
+	for (uint8_t i = 0; i <= num_cpu_states; i++) {
+		bins[i].hits -= bins[i].hits >> CONFIG_PM_POLICY_DEFAULT_PREDICTIVE_DECAY_SHIFT;
+		bins[i].intercepts -=
+			bins[i].intercepts >> CONFIG_PM_POLICY_DEFAULT_PREDICTIVE_DECAY_SHIFT;
+	}
+
+	if (bin < timer_bin && !timer_wakeup) {
+		bins[bin].intercepts += PULSE;
+	} else {
+		bins[timer_bin].hits += PULSE;
+	}
+}
+
+/*
+ * Return the bin of the state to use instead of the deepest one the next
+ * timeout allows, in bin @p bin. If most idle periods ended before they
+ * reached that bin, pick the deepest bin that half of them reached.
+ */
+static uint8_t idle_bin_predict(uint8_t cpu, uint8_t num_cpu_states, uint8_t bin)
+{
+	const struct idle_bin *bins = idle_bins[cpu];
+	uint32_t total = 0;
+	uint32_t early = 0;
+	uint32_t sum = 0;
+
+	for (uint8_t i = 0; i <= num_cpu_states; i++) {
+		total += bins[i].hits + bins[i].intercepts;
+		if (i < bin) {
+			early += bins[i].intercepts;
+		}
+	}
+
+	if (2U * early <= total) {
+		return bin;
+	}
+
+	while (bin > 0) {
+		sum += bins[--bin].intercepts;
+		if (2U * sum > early) {
+			break;
+		}
+	}
+
+	return bin;
+}
+#endif /* CONFIG_PM_POLICY_DEFAULT_PREDICTIVE */
+
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
 	uint8_t num_cpu_states;
 	const struct pm_state_info *cpu_states;
 	const struct pm_state_info *out_state = NULL;
+	uint32_t i;
 
 #ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
 	if (pm_device_is_any_busy()) {
@@ -23,10 +120,10 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 
 	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
 
-	for (uint32_t i = 0; i < num_cpu_states; i++) {
+	for (i = 0; i < num_cpu_states; i++) {
 		const struct pm_state_info *state = &cpu_states[i];
 		uint32_t min_residency_ticks = 0;
-		uint32_t min_residency_us = state->min_residency_us + state->exit_latency_us;
+		uint32_t min_residency_us = state_threshold_us(state);
 
 		/* If the input is zero, avoid 64-bit conversion from microseconds to ticks. */
 		if (min_residency_us > 0) {
@@ -46,5 +143,21 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 		out_state = state;
 	}
 
+#ifdef CONFIG_PM_POLICY_DEFAULT_PREDICTIVE
+	/* i is the bin of the deepest state allowed by the timeout, see idle_bin_of() */
+	uint8_t bin = idle_bin_predict(cpu, num_cpu_states, i);
+
+	if (bin < i) {
+		out_state = NULL;
+		while (bin > 0 && out_state == NULL) {
+			const struct pm_state_info *state = &cpu_states[--bin];
+
+			if (pm_policy_state_is_available(state->state, state->substate_id)) {
+				out_state = state;
+			}
+		}
+	}
+#endif
+
 	return out_state;
 }
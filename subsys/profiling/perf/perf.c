@@ -10,8 +10,10 @@
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_uart.h>
+#include <zephyr/sys/hash_function.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
@@ -25,6 +27,12 @@ struct perf_data_t {
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+
+#ifdef CONFIG_PROFILING_PERF_FOLDED
+	/* Index + 1 in buf of the [count][length][trace] entry, or 0 if free */
+	uint32_t slots[CONFIG_PROFILING_PERF_FOLDED_SLOTS];
+	uintptr_t trace[CONFIG_PROFILING_PERF_FOLDED_MAX_DEPTH];
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,6 +42,46 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+#ifdef CONFIG_PROFILING_PERF_FOLDED
+/* Counts the trace in perf_data_ptr->trace, returns false if it could not be stored */
+static bool perf_folded_add(struct perf_data_t *perf_data_ptr, size_t trace_length)
+{
+	const size_t trace_size = trace_length * sizeof(uintptr_t);
+	uint32_t slot = sys_hash32(perf_data_ptr->trace, trace_size) %
+			CONFIG_PROFILING_PERF_FOLDED_SLOTS;
+
+	for (size_t n = 0; n < CONFIG_PROFILING_PERF_FOLDED_SLOTS; n++) {
+		uintptr_t *entry;
+
+		if (perf_data_ptr->slots[slot] == 0U) {
+			break;
+		}
+
+		entry = &perf_data_ptr->buf[perf_data_ptr->slots[slot] - 1U];
+		if (entry[1] == trace_length &&
+		    memcmp(&entry[2], perf_data_ptr->trace, trace_size) == 0) {
+			entry[0]++;
+			return true;
+		}
+
+		slot = (slot + 1U) % CONFIG_PROFILING_PERF_FOLDED_SLOTS;
+	}
+
+	if (perf_data_ptr->slots[slot] != 0U ||
+	    trace_length + 2U > CONFIG_PROFILING_PERF_BUFFER_SIZE - perf_data_ptr->idx) {
+		return false;
+	}
+
+	perf_data_ptr->slots[slot] = perf_data_ptr->idx + 1U;
+	perf_data_ptr->buf[perf_data_ptr->idx++] = 1U;
+	perf_data_ptr->buf[perf_data_ptr->idx++] = trace_length;
+	memcpy(&perf_data_ptr->buf[perf_data_ptr->idx], perf_data_ptr->trace, trace_size);
+	perf_data_ptr->idx += trace_length;
+
+	return true;
+}
+#endif /* CONFIG_PROFILING_PERF_FOLDED */
+
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
@@ -41,6 +89,16 @@ static void perf_tracer(struct k_timer *timer)
 
 	size_t trace_length = 0;
 
+#ifdef CONFIG_PROFILING_PERF_FOLDED
+	trace_length = arch_perf_current_stack_trace(perf_data_ptr->trace,
+						     ARRAY_SIZE(perf_data_ptr->trace));
+	if (trace_length != 0 && perf_folded_add(perf_data_ptr, trace_length)) {
+		return;
+	}
+
+	perf_data_ptr->buf_full = true;
+	k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
+#else
 	if (++perf_data_ptr->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
 		trace_length = arch_perf_current_stack_trace(
 					perf_data_ptr->buf + perf_data_ptr->idx,
@@ -55,6 +113,7 @@ static void perf_tracer(struct k_timer *timer)
 		perf_data_ptr->buf_full = true;
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
+#endif
 }
 
 static void perf_dwork_handler(struct k_work *work)
@@ -109,6 +168,9 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 
 	perf_data.idx = 0;
 	perf_data.buf_full = false;
+#ifdef CONFIG_PROFILING_PERF_FOLDED
+	memset(perf_data.slots, 0, sizeof(perf_data.slots));
+#endif
 
 	return 0;
 }
@@ -132,7 +194,8 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
-	shell_print(sh, "Perf buf length %zu", perf_data.idx);
+	shell_print(sh, "Perf %sbuf length %zu",
+		    IS_ENABLED(CONFIG_PROFILING_PERF_FOLDED) ? "folded " : "", perf_data.idx);
 	for (size_t i = 0; i < perf_data.idx; i++) {
 		shell_print(sh, "%016lx", perf_data.buf[i]);
 	}
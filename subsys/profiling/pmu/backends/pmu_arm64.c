@@ -0,0 +1,64 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/arch/arm64/lib_helpers.h>
+#include <zephyr/profiling/pmu.h>
+#include <zephyr/sys/barrier.h>
+
+/*
+ * ARMv8-A PMUv3 event counters, counting at EL0 and EL1. A stopped counter
+ * is disabled and keeps its value until it is started again.
+ */
+#define PMCR_E			BIT(0)
+#define PMCR_N_SHIFT		11
+#define PMCR_N_MASK		0x1f
+
+/* Common architectural and microarchitectural event numbers */
+static const uint16_t pmu_arm64_events[PMU_EVENT_COUNT] = {
+	[PMU_EVENT_CPU_CYCLES] = 0x11,		/* CPU_CYCLES */
+	[PMU_EVENT_INSTRUCTIONS] = 0x08,	/* INST_RETIRED */
+	[PMU_EVENT_CACHE_MISSES] = 0x03,	/* L1D_CACHE_REFILL */
+	[PMU_EVENT_BRANCH_MISSES] = 0x10,	/* BR_MIS_PRED */
+	[PMU_EVENT_STALL_CYCLES] = 0x24,	/* STALL_BACKEND */
+};
+
+uint8_t arch_pmu_num_counters(void)
+{
+	return (read_sysreg(pmcr_el0) >> PMCR_N_SHIFT) & PMCR_N_MASK;
+}
+
+int arch_pmu_counter_start(uint8_t counter, uint32_t event)
+{
+	uint32_t type = PMU_EVENT_IS_RAW(event) ? PMU_EVENT_RAW_CODE(event)
+						 : pmu_arm64_events[event];
+
+	write_sysreg(BIT(counter), pmcntenclr_el0);
+	write_sysreg(counter, pmselr_el0);
+	barrier_isync_fence_full();
+	write_sysreg(type, pmxevtyper_el0);
+	write_sysreg(0, pmxevcntr_el0);
+	write_sysreg(read_sysreg(pmcr_el0) | PMCR_E, pmcr_el0);
+	write_sysreg(BIT(counter), pmcntenset_el0);
+	barrier_isync_fence_full();
+
+	return 0;
+}
+
+void arch_pmu_counter_stop(uint8_t counter)
+{
+	write_sysreg(BIT(counter), pmcntenclr_el0);
+	barrier_isync_fence_full();
+}
+
+uint64_t arch_pmu_counter_read(uint8_t counter)
+{
+	write_sysreg(counter, pmselr_el0);
+	barrier_isync_fence_full();
+
+	return (uint32_t)read_sysreg(pmxevcntr_el0);
+}
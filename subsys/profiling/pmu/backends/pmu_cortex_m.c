@@ -0,0 +1,55 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <cmsis_core.h>
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/pmu.h>
+
+/*
+ * Armv8.1-M PMU event counters. They are 16 bits wide, so readings wrap
+ * around every 65536 events. A stopped counter is disabled and keeps its
+ * value until it is started again.
+ */
+static const uint16_t pmu_cortex_m_events[PMU_EVENT_COUNT] = {
+	[PMU_EVENT_CPU_CYCLES] = ARM_PMU_CPU_CYCLES,
+	[PMU_EVENT_INSTRUCTIONS] = ARM_PMU_INST_RETIRED,
+	[PMU_EVENT_CACHE_MISSES] = ARM_PMU_L1D_CACHE_REFILL,
+	[PMU_EVENT_BRANCH_MISSES] = ARM_PMU_BR_MIS_PRED,
+	[PMU_EVENT_STALL_CYCLES] = ARM_PMU_STALL_BACKEND,
+};
+
+uint8_t arch_pmu_num_counters(void)
+{
+	return CONFIG_ARMV8_M_PMU_EVENTCNT;
+}
+
+int arch_pmu_counter_start(uint8_t counter, uint32_t event)
+{
+	uint32_t type = PMU_EVENT_IS_RAW(event) ? PMU_EVENT_RAW_CODE(event)
+						 : pmu_cortex_m_events[event];
+
+	/* The PMU is only clocked while tracing is enabled */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+	ARM_PMU_CNTR_Disable(BIT(counter));
+	ARM_PMU_Set_EVTYPER(counter, type);
+	PMU->EVCNTR[counter] = 0;
+	ARM_PMU_Enable();
+	ARM_PMU_CNTR_Enable(BIT(counter));
+
+	return 0;
+}
+
+void arch_pmu_counter_stop(uint8_t counter)
+{
+	ARM_PMU_CNTR_Disable(BIT(counter));
+}
+
+uint64_t arch_pmu_counter_read(uint8_t counter)
+{
+	return ARM_PMU_Get_EVCNTR(counter);
+}
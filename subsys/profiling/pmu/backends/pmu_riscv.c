@@ -0,0 +1,168 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/pmu.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * mcycle and minstret are always present and are shared by all counters that
+ * count cycles or instructions by taking a snapshot when started. Counters
+ * from index 2 onwards are additionally backed by mhpmcounter3 and up, which
+ * count implementation defined events selected through mhpmevent3 and up.
+ */
+#define PMU_RISCV_HPM_NUM	CONFIG_PROFILING_PMU_RISCV_HPM_COUNTERS
+#define PMU_RISCV_NUM		(2 + PMU_RISCV_HPM_NUM)
+
+#define CSR_MCYCLE		0xB00
+#define CSR_MINSTRET		0xB02
+#define CSR_MHPMCOUNTER3	0xB03
+#define CSR_MCYCLEH		0xB80
+#define CSR_MINSTRETH		0xB82
+#define CSR_MHPMCOUNTER3H	0xB83
+#define CSR_MHPMEVENT3		0x323
+
+/* CSR numbers are instruction immediates, so they must be compile time constants */
+#define PMU_CSR_READ(csr)                                                                          \
+	({                                                                                         \
+		unsigned long __rv;                                                                \
+		__asm__ volatile("csrr %0, %1" : "=r"(__rv) : "i"(csr));                           \
+		__rv;                                                                              \
+	})
+
+#define PMU_CSR_WRITE(csr, val)                                                                    \
+	__asm__ volatile("csrw %0, %1" : : "i"(csr), "r"((unsigned long)(val)) : "memory")
+
+#ifdef CONFIG_64BIT
+#define PMU_CSR_READ64(csr, csrh) ((uint64_t)PMU_CSR_READ(csr))
+#else
+#define PMU_CSR_READ64(csr, csrh)                                                                  \
+	({                                                                                         \
+		uint32_t __hi, __lo;                                                               \
+                                                                                                   \
+		do {                                                                               \
+			__hi = PMU_CSR_READ(csrh);                                                 \
+			__lo = PMU_CSR_READ(csr);                                                  \
+		} while (__hi != PMU_CSR_READ(csrh));                                              \
+		((uint64_t)__hi << 32) | __lo;                                                     \
+	})
+#endif
+
+enum pmu_riscv_source {
+	PMU_RISCV_SOURCE_CYCLE,
+	PMU_RISCV_SOURCE_INSTRET,
+	PMU_RISCV_SOURCE_HPM,
+};
+
+static struct pmu_riscv_counter {
+	enum pmu_riscv_source source;
+	bool running;
+	uint64_t start;
+	uint64_t value;
+} counters[PMU_RISCV_NUM];
+
+#define HPM_READ_CASE(i, _)                                                                        \
+	case i:                                                                                    \
+		return PMU_CSR_READ64(CSR_MHPMCOUNTER3 + i, CSR_MHPMCOUNTER3H + i);
+
+#define HPM_START_CASE(i, _)                                                                       \
+	case i:                                                                                    \
+		PMU_CSR_WRITE(CSR_MHPMEVENT3 + i, event);                                          \
+		PMU_CSR_WRITE(CSR_MHPMCOUNTER3 + i, 0);                                            \
+		IF_DISABLED(CONFIG_64BIT, (PMU_CSR_WRITE(CSR_MHPMCOUNTER3H + i, 0);))              \
+		break;
+
+static uint64_t hpm_read(uint8_t hpm)
+{
+	switch (hpm) {
+	LISTIFY(PMU_RISCV_HPM_NUM, HPM_READ_CASE, ())
+	default:
+		return 0;
+	}
+}
+
+/* Event 0 counts nothing, which is used to stop a counter */
+static void hpm_start(uint8_t hpm, unsigned long event)
+{
+	switch (hpm) {
+	LISTIFY(PMU_RISCV_HPM_NUM, HPM_START_CASE, ())
+	default:
+		break;
+	}
+}
+
+static uint64_t source_read(const struct pmu_riscv_counter *c, uint8_t counter)
+{
+	switch (c->source) {
+	case PMU_RISCV_SOURCE_CYCLE:
+		return PMU_CSR_READ64(CSR_MCYCLE, CSR_MCYCLEH);
+	case PMU_RISCV_SOURCE_INSTRET:
+		return PMU_CSR_READ64(CSR_MINSTRET, CSR_MINSTRETH);
+	default:
+		return hpm_read(counter - 2);
+	}
+}
+
+uint8_t arch_pmu_num_counters(void)
+{
+	return PMU_RISCV_NUM;
+}
+
+int arch_pmu_counter_start(uint8_t counter, uint32_t event)
+{
+	struct pmu_riscv_counter *c = &counters[counter];
+
+	if (c->running && c->source == PMU_RISCV_SOURCE_HPM) {
+		hpm_start(counter - 2, 0);
+	}
+
+	c->running = false;
+	c->value = 0;
+
+	if (PMU_EVENT_IS_RAW(event)) {
+		if (counter < 2 || PMU_EVENT_RAW_CODE(event) == 0) {
+			return -ENOTSUP;
+		}
+
+		c->source = PMU_RISCV_SOURCE_HPM;
+		hpm_start(counter - 2, PMU_EVENT_RAW_CODE(event));
+	} else if (event == PMU_EVENT_CPU_CYCLES) {
+		c->source = PMU_RISCV_SOURCE_CYCLE;
+	} else if (event == PMU_EVENT_INSTRUCTIONS) {
+		c->source = PMU_RISCV_SOURCE_INSTRET;
+	} else {
+		return -ENOTSUP;
+	}
+
+	c->start = source_read(c, counter);
+	c->running = true;
+
+	return 0;
+}
+
+void arch_pmu_counter_stop(uint8_t counter)
+{
+	struct pmu_riscv_counter *c = &counters[counter];
+
+	if (!c->running) {
+		return;
+	}
+
+	c->value = source_read(c, counter) - c->start;
+	c->running = false;
+
+	if (c->source == PMU_RISCV_SOURCE_HPM) {
+		hpm_start(counter - 2, 0);
+	}
+}
+
+uint64_t arch_pmu_counter_read(uint8_t counter)
+{
+	const struct pmu_riscv_counter *c = &counters[counter];
+
+	return c->running ? source_read(c, counter) - c->start : c->value;
+}
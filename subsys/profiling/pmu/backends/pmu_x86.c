@@ -0,0 +1,110 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cpuid.h> /* Header provided by the toolchain. */
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/arch/x86/cpuid.h>
+#include <zephyr/arch/x86/msr.h>
+#include <zephyr/profiling/pmu.h>
+
+/*
+ * Architectural performance monitoring general purpose counters, counting in
+ * user and kernel mode. Implementation defined events are given as the event
+ * select and unit mask fields of IA32_PERFEVTSELx, that is
+ * PMU_EVENT_RAW((umask << 8) | event).
+ */
+static const struct {
+	uint16_t evtsel;
+	/* Bit in CPUID.0AH:EBX that is set when the event is not available */
+	int8_t unavailable;
+} pmu_x86_events[PMU_EVENT_COUNT] = {
+	[PMU_EVENT_CPU_CYCLES] = {0x003c, 0},		/* UnHalted Core Cycles */
+	[PMU_EVENT_INSTRUCTIONS] = {0x00c0, 1},		/* Instructions Retired */
+	[PMU_EVENT_CACHE_MISSES] = {0x412e, 4},		/* LLC Misses */
+	[PMU_EVENT_BRANCH_MISSES] = {0x00c5, 6},	/* Branch Misses Retired */
+	[PMU_EVENT_STALL_CYCLES] = {0, -1},		/* No architectural event */
+};
+
+static struct {
+	bool init;
+	uint8_t version;
+	uint8_t num;
+	uint8_t width;
+	uint32_t unavailable;
+} pmu_x86;
+
+static void pmu_x86_init(void)
+{
+	uint32_t eax, ebx, ecx, edx;
+
+	if (pmu_x86.init) {
+		return;
+	}
+
+	pmu_x86.init = true;
+
+	if (__get_cpuid(CPUID_ARCH_PERFMON, &eax, &ebx, &ecx, &edx) == 0) {
+		return;
+	}
+
+	pmu_x86.version = eax & 0xff;
+	if (pmu_x86.version == 0) {
+		return;
+	}
+
+	pmu_x86.num = (eax >> 8) & 0xff;
+	pmu_x86.width = (eax >> 16) & 0xff;
+	/* Events beyond the length of the EBX bit vector are not available either */
+	pmu_x86.unavailable = ebx | ~BIT_MASK((eax >> 24) & 0xff);
+}
+
+uint8_t arch_pmu_num_counters(void)
+{
+	pmu_x86_init();
+
+	return pmu_x86.num;
+}
+
+int arch_pmu_counter_start(uint8_t counter, uint32_t event)
+{
+	uint64_t evtsel;
+
+	if (PMU_EVENT_IS_RAW(event)) {
+		evtsel = PMU_EVENT_RAW_CODE(event) & 0xffff;
+	} else if (pmu_x86_events[event].unavailable < 0 ||
+		   (pmu_x86.unavailable & BIT(pmu_x86_events[event].unavailable)) != 0U) {
+		return -ENOTSUP;
+	} else {
+		evtsel = pmu_x86_events[event].evtsel;
+	}
+
+	z_x86_msr_write(X86_PERFEVTSEL0_MSR + counter, 0);
+	z_x86_msr_write(X86_PMC0_MSR + counter, 0);
+	z_x86_msr_write(X86_PERFEVTSEL0_MSR + counter,
+			evtsel | X86_PERFEVTSEL_USR | X86_PERFEVTSEL_OS | X86_PERFEVTSEL_EN);
+
+	/* Counters are also gated by the global control from version 2 onwards */
+	if (pmu_x86.version >= 2) {
+		z_x86_msr_write(X86_PERF_GLOBAL_CTRL_MSR,
+				z_x86_msr_read(X86_PERF_GLOBAL_CTRL_MSR) | BIT(counter));
+	}
+
+	return 0;
+}
+
+void arch_pmu_counter_stop(uint8_t counter)
+{
+	uint64_t evtsel = z_x86_msr_read(X86_PERFEVTSEL0_MSR + counter);
+
+	z_x86_msr_write(X86_PERFEVTSEL0_MSR + counter, evtsel & ~X86_PERFEVTSEL_EN);
+}
+
+uint64_t arch_pmu_counter_read(uint8_t counter)
+{
+	return z_x86_msr_read(X86_PMC0_MSR + counter) & BIT64_MASK(pmu_x86.width);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/pmu.h>
+#include <zephyr/shell/shell.h>
+
+static const char *const pmu_event_names[PMU_EVENT_COUNT] = {
+	[PMU_EVENT_CPU_CYCLES] = "cycles",
+	[PMU_EVENT_INSTRUCTIONS] = "instructions",
+	[PMU_EVENT_CACHE_MISSES] = "cache-misses",
+	[PMU_EVENT_BRANCH_MISSES] = "branch-misses",
+	[PMU_EVENT_STALL_CYCLES] = "stall-cycles",
+};
+
+uint8_t pmu_num_counters(void)
+{
+	return arch_pmu_num_counters();
+}
+
+int pmu_counter_start(uint8_t counter, uint32_t event)
+{
+	if (counter >= arch_pmu_num_counters()) {
+		return -EINVAL;
+	}
+
+	if (!PMU_EVENT_IS_RAW(event) && event >= PMU_EVENT_COUNT) {
+		return -EINVAL;
+	}
+
+	return arch_pmu_counter_start(counter, event);
+}
+
+int pmu_counter_stop(uint8_t counter)
+{
+	if (counter >= arch_pmu_num_counters()) {
+		return -EINVAL;
+	}
+
+	arch_pmu_counter_stop(counter);
+
+	return 0;
+}
+
+int pmu_counter_read(uint8_t counter, uint64_t *value)
+{
+	if (counter >= arch_pmu_num_counters()) {
+		return -EINVAL;
+	}
+
+	*value = arch_pmu_counter_read(counter);
+
+	return 0;
+}
+
+const char *pmu_event_name(uint32_t event)
+{
+	if (PMU_EVENT_IS_RAW(event) || event >= PMU_EVENT_COUNT) {
+		return "raw";
+	}
+
+	return pmu_event_names[event];
+}
+
+#ifdef CONFIG_PROFILING_PMU_SHELL
+
+static uint32_t pmu_shell_events[UINT8_MAX];
+
+static int pmu_shell_parse_event(const char *str, uint32_t *event)
+{
+	char *end;
+	unsigned long code;
+
+	for (uint32_t i = 0; i < PMU_EVENT_COUNT; i++) {
+		if (strcmp(str, pmu_event_names[i]) == 0) {
+			*event = i;
+			return 0;
+		}
+	}
+
+	code = strtoul(str, &end, 16);
+	if (*end != '\0' || PMU_EVENT_IS_RAW(code)) {
+		return -EINVAL;
+	}
+
+	*event = PMU_EVENT_RAW(code);
+
+	return 0;
+}
+
+static int cmd_pmu_start(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned long counter = strtoul(argv[1], NULL, 10);
+	uint32_t event;
+	int ret;
+
+	if (pmu_shell_parse_event(argv[2], &event) != 0) {
+		shell_error(sh, "Unknown event %s", argv[2]);
+		return -EINVAL;
+	}
+
+	ret = counter < UINT8_MAX ? pmu_counter_start(counter, event) : -EINVAL;
+	if (ret != 0) {
+		shell_error(sh, "Cannot count %s on counter %lu (%d)", argv[2], counter, ret);
+		return ret;
+	}
+
+	pmu_shell_events[counter] = event;
+
+	return 0;
+}
+
+static int cmd_pmu_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	unsigned long counter = strtoul(argv[1], NULL, 10);
+	int ret;
+
+	ret = counter < UINT8_MAX ? pmu_counter_stop(counter) : -EINVAL;
+	if (ret != 0) {
+		shell_error(sh, "Invalid counter %lu", counter);
+	}
+
+	return ret;
+}
+
+static int cmd_pmu_read(const struct shell *sh, size_t argc, char **argv)
+{
+	uint8_t num = pmu_num_counters();
+	uint64_t value;
+
+	for (uint8_t i = 0; i < num; i++) {
+		uint32_t event = pmu_shell_events[i];
+
+		(void)pmu_counter_read(i, &value);
+		if (PMU_EVENT_IS_RAW(event)) {
+			shell_print(sh, "%u: %llu raw %x", i, value, PMU_EVENT_RAW_CODE(event));
+		} else {
+			shell_print(sh, "%u: %llu %s", i, value, pmu_event_name(event));
+		}
+	}
+
+	return 0;
+}
+
+#define CMD_HELP_START                                                                             \
+	"Reset <counter> and count <event>\n"                                                      \
+	"Events: cycles, instructions, cache-misses, branch-misses, stall-cycles\n"                \
+	"or an implementation defined event number in hexadecimal\n"                               \
+	"Usage: start <counter> <event>"
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_pmu,
+	SHELL_CMD_ARG(start, NULL, CMD_HELP_START, cmd_pmu_start, 3, 0),
+	SHELL_CMD_ARG(stop, NULL, "Stop <counter>", cmd_pmu_stop, 2, 0),
+	SHELL_CMD_ARG(read, NULL, "Print all counters", cmd_pmu_read, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+SHELL_CMD_ARG_REGISTER(pmu, &sub_pmu, "Hardware performance counters", NULL, 1, 0);
+
+#endif /* CONFIG_PROFILING_PMU_SHELL */
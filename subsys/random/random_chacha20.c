@@ -0,0 +1,238 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Buffered ChaCha20 CSPRNG, one instance per CPU.
+ *
+ * Each instance turns its key into a few ChaCha20 blocks at once. The first
+ * bytes of each batch become the next key and are erased right away, so that
+ * a compromised state does not reveal earlier output (fast key erasure), and
+ * the rest is handed out to readers. Reading never blocks once an instance is
+ * seeded: fresh entropy is drawn by a work item, in one request for all the
+ * instances due for a reseed, and mixed into the key on the next refill.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+
+#define CHACHA20_BLOCK_SIZE 64
+#define CHACHA20_KEY_SIZE 32
+#define CHACHA20_KEY_WORDS (CHACHA20_KEY_SIZE / sizeof(uint32_t))
+
+#define BUF_SIZE (CONFIG_CHACHA20_CSPRNG_BLOCKS * CHACHA20_BLOCK_SIZE)
+
+struct chacha20_csprng {
+	struct k_spinlock lock;
+	uint32_t key[CHACHA20_KEY_WORDS];
+	uint8_t buf[BUF_SIZE];
+	/* next byte of buf to hand out */
+	size_t pos;
+	/* bytes handed out since the last reseed */
+	size_t since_reseed;
+	/* entropy waiting to be mixed into the key */
+	uint8_t seed[CHACHA20_KEY_SIZE];
+	bool seed_ready;
+	bool seeded;
+};
+
+static const struct device *const entropy_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+static struct chacha20_csprng csprng[CONFIG_MP_MAX_NUM_CPUS];
+
+/* CPUs waiting for reseed_work */
+static atomic_t reseed_wanted;
+static uint8_t reseed_buf[CONFIG_MP_MAX_NUM_CPUS][CHACHA20_KEY_SIZE];
+
+#define QR(a, b, c, d)                                                                             \
+	do {                                                                                       \
+		a += b; d ^= a; d = (d << 16) | (d >> 16);                                         \
+		c += d; b ^= c; b = (b << 12) | (b >> 20);                                         \
+		a += b; d ^= a; d = (d << 8) | (d >> 24);                                          \
+		c += d; b ^= c; b = (b << 7) | (b >> 25);                                          \
+	} while (false)
+
+static void chacha20_block(const uint32_t key[CHACHA20_KEY_WORDS], uint32_t counter,
+			   uint8_t out[CHACHA20_BLOCK_SIZE])
+{
+	uint32_t in[16] = {
+		/* "expand 32-byte k" */
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+		key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+		counter, 0, 0, 0,
+	};
+	uint32_t x[16];
+
+	memcpy(x, in, sizeof(x));
+
+	for (int i = 0; i < 10; i++) {
+		QR(x[0], x[4], x[8], x[12]);
+		QR(x[1], x[5], x[9], x[13]);
+		QR(x[2], x[6], x[10], x[14]);
+		QR(x[3], x[7], x[11], x[15]);
+		QR(x[0], x[5], x[10], x[15]);
+		QR(x[1], x[6], x[11], x[12]);
+		QR(x[2], x[7], x[8], x[13]);
+		QR(x[3], x[4], x[9], x[14]);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		sys_put_le32(x[i] + in[i], &out[i * sizeof(uint32_t)]);
+	}
+}
+
+static void mix_seed(struct chacha20_csprng *st, uint8_t seed[CHACHA20_KEY_SIZE])
+{
+	for (size_t i = 0; i < CHACHA20_KEY_WORDS; i++) {
+		st->key[i] ^= sys_get_le32(&seed[i * sizeof(uint32_t)]);
+	}
+
+	memset(seed, 0, CHACHA20_KEY_SIZE);
+	st->since_reseed = 0;
+}
+
+static void refill(struct chacha20_csprng *st)
+{
+	if (st->seed_ready) {
+		mix_seed(st, st->seed);
+		st->seed_ready = false;
+	}
+
+	/* the key changes on every refill, so the counter can restart */
+	for (uint32_t i = 0; i < CONFIG_CHACHA20_CSPRNG_BLOCKS; i++) {
+		chacha20_block(st->key, i, &st->buf[i * CHACHA20_BLOCK_SIZE]);
+	}
+
+	for (size_t i = 0; i < CHACHA20_KEY_WORDS; i++) {
+		st->key[i] = sys_get_le32(&st->buf[i * sizeof(uint32_t)]);
+	}
+
+	memset(st->buf, 0, CHACHA20_KEY_SIZE);
+	st->pos = CHACHA20_KEY_SIZE;
+}
+
+static void reseed_work_handler(struct k_work *work)
+{
+	atomic_val_t wanted = atomic_clear(&reseed_wanted);
+	unsigned int count = 0;
+	unsigned int cpu;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(work);
+
+	if (wanted == 0) {
+		return;
+	}
+
+	/* a single, batched draw for all the CPUs due for a reseed */
+	if (entropy_get_entropy(entropy_dev, reseed_buf[0],
+				POPCOUNT(wanted) * CHACHA20_KEY_SIZE) != 0) {
+		/* keep going on the current keys, try again on the next read */
+		atomic_or(&reseed_wanted, wanted);
+		return;
+	}
+
+	for (cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if ((wanted & BIT(cpu)) == 0) {
+			continue;
+		}
+
+		key = k_spin_lock(&csprng[cpu].lock);
+		memcpy(csprng[cpu].seed, reseed_buf[count], CHACHA20_KEY_SIZE);
+		csprng[cpu].seed_ready = true;
+		k_spin_unlock(&csprng[cpu].lock, key);
+
+		memset(reseed_buf[count], 0, CHACHA20_KEY_SIZE);
+		count++;
+	}
+}
+
+static K_WORK_DEFINE(reseed_work, reseed_work_handler);
+
+/* First seed of an instance, drawn by its first reader */
+static int initial_seed(uint8_t seed[CHACHA20_KEY_SIZE])
+{
+	int ret;
+
+	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready", entropy_dev->name);
+
+	if (!k_is_in_isr()) {
+		return entropy_get_entropy(entropy_dev, seed, CHACHA20_KEY_SIZE);
+	}
+
+	ret = entropy_get_entropy_isr(entropy_dev, seed, CHACHA20_KEY_SIZE, ENTROPY_BUSYWAIT);
+
+	return (ret == CHACHA20_KEY_SIZE) ? 0 : -EIO;
+}
+
+int z_impl_sys_csrand_get(void *dst, size_t outlen)
+{
+	uint8_t seed[CHACHA20_KEY_SIZE];
+	bool seeded = false;
+	struct chacha20_csprng *st;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+	unsigned int cpu;
+	uint8_t *out = dst;
+	size_t len;
+
+	/* Do not migrate between selecting the instance and locking it */
+	irq_key = arch_irq_lock();
+	cpu = arch_curr_cpu()->id;
+	arch_irq_unlock(irq_key);
+
+	if (unlikely(!csprng[cpu].seeded)) {
+		/* possibly drawn for another CPU if migrated meanwhile, see below */
+		if (initial_seed(seed) != 0) {
+			return -EIO;
+		}
+		seeded = true;
+	}
+
+	irq_key = arch_irq_lock();
+	cpu = arch_curr_cpu()->id;
+	st = &csprng[cpu];
+	key = k_spin_lock(&st->lock);
+
+	if (seeded) {
+		/* mixing is harmless even when the instance got seeded meanwhile */
+		mix_seed(st, seed);
+		st->seeded = true;
+		refill(st);
+	} else if (unlikely(!st->seeded)) {
+		k_spin_unlock(&st->lock, key);
+		arch_irq_unlock(irq_key);
+		/* migrated to a CPU that was not seeded yet */
+		return z_impl_sys_csrand_get(dst, outlen);
+	}
+
+	while (outlen > 0) {
+		if (st->pos == BUF_SIZE) {
+			refill(st);
+		}
+
+		len = MIN(outlen, BUF_SIZE - st->pos);
+		memcpy(out, &st->buf[st->pos], len);
+		memset(&st->buf[st->pos], 0, len);
+		st->pos += len;
+		st->since_reseed += len;
+		out += len;
+		outlen -= len;
+	}
+
+	if (st->since_reseed >= CONFIG_CHACHA20_CSPRNG_RESEED_INTERVAL && !st->seed_ready &&
+	    !atomic_test_and_set_bit(&reseed_wanted, cpu)) {
+		(void)k_work_submit(&reseed_work);
+	}
+
+	k_spin_unlock(&st->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return 0;
+}
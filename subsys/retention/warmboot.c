@@ -0,0 +1,207 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/reboot.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/retention/warmboot.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(warmboot, CONFIG_RETENTION_LOG_LEVEL);
+
+/*
+ * The retention area holds snapshot records, each a header followed by the
+ * name of its handler and the snapshot itself. A header with an empty name,
+ * as left by clearing the area, ends the records.
+ */
+struct warmboot_record_hdr {
+	uint16_t size;
+	uint16_t version;
+	uint8_t name_len;
+} __packed;
+
+static const struct device *warm_boot_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_warm_boot));
+
+/* Records are assembled here, so each of them takes a single retention write */
+static uint8_t record_buf[CONFIG_RETENTION_WARM_BOOT_BUFFER_SIZE];
+
+static bool warm;
+
+int warmboot_save(void)
+{
+	struct warmboot_record_hdr hdr;
+	ssize_t area_size;
+	size_t hdr_len;
+	size_t max_len;
+	size_t offset = 0;
+	ssize_t len;
+	int saved = 0;
+	int rc;
+
+	area_size = retention_size(warm_boot_dev);
+	if (area_size < 0) {
+		return (int)area_size;
+	}
+
+	rc = retention_clear(warm_boot_dev);
+	if (rc < 0) {
+		return rc;
+	}
+
+	STRUCT_SECTION_FOREACH(warmboot_handler, handler) {
+		hdr_len = sizeof(hdr) + strlen(handler->name);
+
+		/* Keep room for the header ending the records */
+		if ((hdr_len > UINT8_MAX + sizeof(hdr)) ||
+		    (offset + hdr_len + sizeof(hdr) > (size_t)area_size) ||
+		    (hdr_len > sizeof(record_buf))) {
+			LOG_WRN("No room for %s", handler->name);
+			continue;
+		}
+
+		max_len = MIN(MIN(sizeof(record_buf), area_size - offset - sizeof(hdr)) - hdr_len,
+			      UINT16_MAX);
+
+		len = handler->save(&record_buf[hdr_len], max_len);
+		if (len < 0) {
+			continue;
+		}
+
+		if ((size_t)len > max_len) {
+			LOG_WRN("%s snapshot too large (%zd)", handler->name, len);
+			continue;
+		}
+
+		hdr.size = (uint16_t)len;
+		hdr.version = handler->version;
+		hdr.name_len = (uint8_t)(hdr_len - sizeof(hdr));
+
+		memcpy(record_buf, &hdr, sizeof(hdr));
+		memcpy(&record_buf[sizeof(hdr)], handler->name, hdr.name_len);
+
+		rc = retention_write(warm_boot_dev, (off_t)offset, record_buf, hdr_len + len);
+		if (rc < 0) {
+			/* Drop what was written rather than leaving partial snapshots */
+			(void)retention_clear(warm_boot_dev);
+			return rc;
+		}
+
+		offset += hdr_len + len;
+		saved++;
+	}
+
+	LOG_DBG("Saved %d snapshots, %d bytes", saved, (int)offset);
+
+	return saved;
+}
+
+static const struct warmboot_handler *find_handler(const char *name, size_t name_len,
+						   uint16_t version)
+{
+	STRUCT_SECTION_FOREACH(warmboot_handler, handler) {
+		if ((strlen(handler->name) == name_len) &&
+		    (memcmp(handler->name, name, name_len) == 0)) {
+			return (handler->version == version) ? handler : NULL;
+		}
+	}
+
+	return NULL;
+}
+
+int warmboot_restore(void)
+{
+	const struct warmboot_handler *handler;
+	struct warmboot_record_hdr hdr;
+	ssize_t area_size;
+	size_t rec_len;
+	size_t offset = 0;
+	int restored = 0;
+	int rc;
+
+	rc = retention_is_valid(warm_boot_dev);
+	if (rc == -ENOTSUP) {
+		LOG_ERR("Retention area needs a prefix or checksum to tell warm boots");
+		return rc;
+	} else if (rc <= 0) {
+		return rc;
+	}
+
+	area_size = retention_size(warm_boot_dev);
+	if (area_size < 0) {
+		return (int)area_size;
+	}
+
+	while (offset + sizeof(hdr) <= (size_t)area_size) {
+		rc = retention_read(warm_boot_dev, (off_t)offset, (uint8_t *)&hdr, sizeof(hdr));
+		if ((rc < 0) || (hdr.name_len == 0)) {
+			break;
+		}
+
+		offset += sizeof(hdr);
+		rec_len = hdr.name_len + hdr.size;
+
+		if ((rec_len > sizeof(record_buf)) || (offset + rec_len > (size_t)area_size)) {
+			LOG_WRN("Invalid snapshot record at %d", (int)(offset - sizeof(hdr)));
+			break;
+		}
+
+		rc = retention_read(warm_boot_dev, (off_t)offset, record_buf, rec_len);
+		if (rc < 0) {
+			break;
+		}
+
+		offset += rec_len;
+
+		handler = find_handler((const char *)record_buf, hdr.name_len, hdr.version);
+		if (handler == NULL) {
+			LOG_DBG("Dropping snapshot %.*s", hdr.name_len, (const char *)record_buf);
+			continue;
+		}
+
+		handler->restore(&record_buf[hdr.name_len], hdr.size);
+		restored++;
+	}
+
+	/* Snapshots only describe the state right before the reboot they were saved for */
+	(void)retention_clear(warm_boot_dev);
+
+	warm = (restored > 0);
+
+	return (rc < 0) ? rc : restored;
+}
+
+bool warmboot_is_warm(void)
+{
+	return warm;
+}
+
+FUNC_NORETURN void warmboot_reboot(int type)
+{
+	(void)warmboot_save();
+
+	sys_reboot(type);
+}
+
+static int warmboot_init(void)
+{
+	int rc;
+
+	if (!device_is_ready(warm_boot_dev)) {
+		return -ENODEV;
+	}
+
+	rc = warmboot_restore();
+	if (rc > 0) {
+		LOG_INF("Warm boot, %d snapshots restored", rc);
+	}
+
+	return 0;
+}
+
+SYS_INIT(warmboot_init, POST_KERNEL, CONFIG_RETENTION_WARM_BOOT_INIT_PRIORITY);
@@ -0,0 +1,144 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/rtio/counter.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(rtio_counter, CONFIG_RTIO_LOG_LEVEL);
+
+static uint32_t ticks_add(uint32_t top, uint32_t ticks, uint64_t delta)
+{
+	uint64_t sum = (uint64_t)ticks + delta;
+
+	return (top == UINT32_MAX) ? (uint32_t)sum : (uint32_t)(sum % ((uint64_t)top + 1U));
+}
+
+static uint32_t ticks_sub(uint32_t top, uint32_t a, uint32_t b)
+{
+	return (a >= b) ? (a - b) : ((top - b) + a + 1U);
+}
+
+static void fail_pending(struct rtio_counter_iodev_data *data, int err)
+{
+	struct mpsc_node *node;
+
+	while ((node = mpsc_pop(&data->pending)) != NULL) {
+		rtio_iodev_sqe_err(CONTAINER_OF(node, struct rtio_iodev_sqe, q), err);
+	}
+}
+
+static void rtio_counter_alarm(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+			       void *user_data);
+
+/* Called by whoever set the armed flag */
+static int rtio_counter_arm(struct rtio_counter_iodev_data *data)
+{
+	struct counter_alarm_cfg cfg = {
+		.callback = rtio_counter_alarm,
+		.flags = COUNTER_ALARM_CFG_ABSOLUTE | COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE,
+		.user_data = data,
+	};
+	uint32_t now;
+	uint32_t elapsed;
+	int err;
+
+	if (!data->started) {
+		data->period = counter_us_to_ticks(data->dev, data->period_us);
+		data->top = counter_get_top_value(data->dev);
+		if (data->period == 0U) {
+			return -EINVAL;
+		}
+
+		err = counter_start(data->dev);
+		if (err < 0 && err != -EALREADY) {
+			return err;
+		}
+	}
+
+	err = counter_get_value(data->dev, &now);
+	if (err < 0) {
+		return err;
+	}
+
+	if (!data->started) {
+		data->last = now;
+		data->started = true;
+	}
+
+	/* Next boundary at the phase of the previous ones */
+	elapsed = ticks_sub(data->top, now, data->last);
+	data->next = ticks_add(data->top, data->last,
+			       ((uint64_t)(elapsed / data->period) + 1U) * data->period);
+	cfg.ticks = data->next;
+
+	err = counter_set_channel_alarm(data->dev, data->chan, &cfg);
+
+	/* Late alarms expire immediately */
+	return (err == -ETIME) ? 0 : err;
+}
+
+static void rtio_counter_rearm(struct rtio_counter_iodev_data *data)
+{
+	int err;
+
+	if (atomic_set(&data->armed, 1) != 0) {
+		return;
+	}
+
+	err = rtio_counter_arm(data);
+	if (err < 0) {
+		LOG_ERR("Failed to set alarm (%d)", err);
+		atomic_clear(&data->armed);
+		fail_pending(data, err);
+	}
+}
+
+static void rtio_counter_alarm(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+			       void *user_data)
+{
+	struct rtio_counter_iodev_data *data = user_data;
+	struct mpsc due = MPSC_INIT(due);
+	struct mpsc_node *node;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+
+	data->last = data->next;
+	atomic_clear(&data->armed);
+
+	/* Completions resubmit multishot and chained submissions, which are
+	 * due on the next boundary.
+	 */
+	while ((node = mpsc_pop(&data->pending)) != NULL) {
+		mpsc_push(&due, node);
+	}
+
+	while ((node = mpsc_pop(&due)) != NULL) {
+		rtio_iodev_sqe_ok(CONTAINER_OF(node, struct rtio_iodev_sqe, q), 0);
+	}
+}
+
+static void rtio_counter_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_counter_iodev_data *data = iodev_sqe->sqe.iodev->data;
+
+	if (iodev_sqe->sqe.op != RTIO_OP_NOP ||
+	    FIELD_GET(RTIO_SQE_TRANSACTION, iodev_sqe->sqe.flags) == 1) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	mpsc_push(&data->pending, &iodev_sqe->q);
+
+	rtio_counter_rearm(data);
+}
+
+const struct rtio_iodev_api rtio_counter_iodev_api = {
+	.submit = rtio_counter_submit,
+};
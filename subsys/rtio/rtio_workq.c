@@ -16,7 +16,18 @@ static K_THREAD_STACK_ARRAY_DEFINE(rtio_workq_threads_stack,
 				   CONFIG_RTIO_WORKQ_THREADS_POOL,
 				   CONFIG_RTIO_WORKQ_THREADS_POOL_STACK_SIZE);
 static struct k_thread rtio_work_threads[CONFIG_RTIO_WORKQ_THREADS_POOL];
+
+#ifdef CONFIG_RTIO_WORKQ_PER_IODEV
+/* Requests in submission order, protected by rtio_workq_lock */
+static sys_slist_t rtio_workq_pending = SYS_SLIST_STATIC_INIT(&rtio_workq_pending);
+static struct k_spinlock rtio_workq_lock;
+/* Iodev each thread is processing, protected by rtio_workq_lock */
+static const struct rtio_iodev *rtio_workq_busy[CONFIG_RTIO_WORKQ_THREADS_POOL];
+/* Given for each request which may have become runnable */
+static K_SEM_DEFINE(rtio_workq_sem, 0, K_SEM_MAX_LIMIT);
+#else
 static K_QUEUE_DEFINE(rtio_workq);
+#endif
 
 struct rtio_work_req *rtio_work_req_alloc(void)
 {
@@ -51,7 +62,15 @@ void rtio_work_req_submit(struct rtio_work_req *req,
 	 * desirable to expand this to handle queue ordering based on RTIO
 	 * SQE priority.
 	 */
+#ifdef CONFIG_RTIO_WORKQ_PER_IODEV
+	K_SPINLOCK(&rtio_workq_lock) {
+		sys_slist_append(&rtio_workq_pending, &req->node);
+	}
+
+	k_sem_give(&rtio_workq_sem);
+#else
 	k_queue_append(&rtio_workq, req);
+#endif
 }
 
 uint32_t rtio_work_req_used_count_get(void)
@@ -59,6 +78,78 @@ uint32_t rtio_work_req_used_count_get(void)
 	return k_mem_slab_num_used_get(&rtio_work_items_slab);
 }
 
+#ifdef CONFIG_RTIO_WORKQ_PER_IODEV
+static bool rtio_workq_iodev_is_busy(const struct rtio_iodev *iodev)
+{
+	for (size_t i = 0 ; i < ARRAY_SIZE(rtio_workq_busy) ; i++) {
+		if (rtio_workq_busy[i] == iodev) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Take the oldest request of an iodev no other thread is processing */
+static struct rtio_work_req *rtio_workq_get(size_t idx)
+{
+	struct rtio_work_req *req = NULL;
+	struct rtio_work_req *it;
+	sys_snode_t *prev = NULL;
+
+	K_SPINLOCK(&rtio_workq_lock) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&rtio_workq_pending, it, node) {
+			if (!rtio_workq_iodev_is_busy(it->iodev_sqe->sqe.iodev)) {
+				sys_slist_remove(&rtio_workq_pending, prev, &it->node);
+				rtio_workq_busy[idx] = it->iodev_sqe->sqe.iodev;
+				req = it;
+				break;
+			}
+
+			prev = &it->node;
+		}
+	}
+
+	return req;
+}
+
+static void rtio_workq_put(size_t idx)
+{
+	bool pending;
+
+	K_SPINLOCK(&rtio_workq_lock) {
+		rtio_workq_busy[idx] = NULL;
+		pending = !sys_slist_is_empty(&rtio_workq_pending);
+	}
+
+	/* Requests of the same iodev may have been left behind */
+	if (pending) {
+		k_sem_give(&rtio_workq_sem);
+	}
+}
+
+static void rtio_workq_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	size_t idx = (size_t)arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		struct rtio_work_req *req;
+
+		(void)k_sem_take(&rtio_workq_sem, K_FOREVER);
+
+		while ((req = rtio_workq_get(idx)) != NULL) {
+			req->handler(req->iodev_sqe);
+
+			k_mem_slab_free(&rtio_work_items_slab, req);
+
+			rtio_workq_put(idx);
+		}
+	}
+}
+#else
 static void rtio_workq_thread_fn(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -75,6 +166,7 @@ static void rtio_workq_thread_fn(void *arg1, void *arg2, void *arg3)
 		}
 	}
 }
+#endif
 
 static int static_init(void)
 {
@@ -83,10 +175,15 @@ static int static_init(void)
 				rtio_workq_threads_stack[i],
 				CONFIG_RTIO_WORKQ_THREADS_POOL_STACK_SIZE,
 				rtio_workq_thread_fn,
-				NULL, NULL, NULL,
+				(void *)i, NULL, NULL,
 				CONFIG_RTIO_WORKQ_THREADS_POOL_PRIO,
 				0,
-				K_NO_WAIT);
+				K_FOREVER);
+#ifdef CONFIG_RTIO_WORKQ_THREADS_CPU_PIN
+		(void)k_thread_cpu_pin(&rtio_work_threads[i],
+				       i % arch_num_cpus());
+#endif
+		k_thread_start(&rtio_work_threads[i]);
 	}
 
 	return 0;
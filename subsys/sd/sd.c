@@ -238,6 +238,7 @@ int sd_init(const struct device *sdhc_dev, struct sd_card *card)
 		return -ENODEV;
 	}
 	card->sdhc = sdhc_dev;
+	card->write_busy = false;
 	ret = sdhc_get_host_props(card->sdhc, &card->host_props);
 	if (ret) {
 		LOG_ERR("SD host controller returned invalid properties");
@@ -488,12 +488,35 @@ int card_app_command(struct sd_card *card, int relative_card_address)
 	return 0;
 }
 
+/* Waits for the card to program a write that returned before it was done */
+static int card_wait_write(struct sd_card *card)
+{
+	int ret;
+
+	if (!card->write_busy) {
+		return 0;
+	}
+
+	ret = sdmmc_wait_ready(card);
+	if (ret) {
+		LOG_ERR("Card did not return to ready state");
+		return -ETIMEDOUT;
+	}
+	card->write_busy = false;
+	return 0;
+}
+
 static int card_read(struct sd_card *card, uint8_t *rbuf, uint32_t start_block, uint32_t num_blocks)
 {
 	int ret;
 	struct sdhc_command cmd;
 	struct sdhc_data data;
 
+	ret = card_wait_write(card);
+	if (ret) {
+		return ret;
+	}
+
 	/*
 	 * Note: The SD specification allows for CMD23 to be sent before a
 	 * transfer in order to set the block length (often preferable).
@@ -658,6 +681,11 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd;
 	struct sdhc_data data;
 
+	ret = card_wait_write(card);
+	if (ret) {
+		return ret;
+	}
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -696,6 +724,11 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 		LOG_ERR("Only %d blocks of %d were written", blocks, num_blocks);
 		return -EIO;
 	}
+	if (IS_ENABLED(CONFIG_SD_DEFER_WRITE_BUSY_WAIT)) {
+		/* Wait before the next command, the card programs the blocks meanwhile */
+		card->write_busy = true;
+		return 0;
+	}
 	/* Verify card is back in transfer state after write */
 	ret = sdmmc_wait_ready(card);
 	if (ret) {
@@ -794,6 +827,9 @@ int card_ioctl(struct sd_card *card, uint8_t cmd, void *buf)
 		 * cache flush is not required here
 		 */
 		ret = sdmmc_wait_ready(card);
+		if (ret == 0) {
+			card->write_busy = false;
+		}
 		break;
 	case DISK_IOCTL_CTRL_DEINIT:
 		/* Ensure card is not busy with data write */
@@ -801,6 +837,7 @@ int card_ioctl(struct sd_card *card, uint8_t cmd, void *buf)
 		if (ret < 0) {
 			LOG_WRN("Card busy when powering off");
 		}
+		card->write_busy = false;
 		/* Power down the card */
 		card->bus_io.power_mode = SDHC_POWER_OFF;
 		ret = sdhc_set_io(card->sdhc, &card->bus_io);
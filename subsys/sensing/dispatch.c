@@ -23,23 +23,42 @@ static inline bool sensor_test_consume_time(struct sensing_sensor *sensor,
 }
 
 static void update_client_consume_time(struct sensing_sensor *sensor,
-				       struct sensing_connection *conn)
+				       struct sensing_connection *conn,
+				       uint64_t cur_time)
 {
 	uint32_t interval = conn->interval;
 
 	if (conn->next_consume_time == 0) {
-		conn->next_consume_time = get_us();
+		conn->next_consume_time = cur_time;
 	}
 
 	conn->next_consume_time += interval;
 }
 
+#ifdef CONFIG_SENSING_DISPATCH_DECIMATION
+/* check whether this sample is the one out of conn->decimation the client gets */
+static inline bool sensor_test_consume_sample(struct sensing_connection *conn)
+{
+	if (conn->countdown > 0) {
+		conn->countdown--;
+		return false;
+	}
+
+	conn->countdown = conn->decimation - 1;
+
+	return true;
+}
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
+
 /* send data to clients based on interval and sensitivity */
 static int send_data_to_clients(struct sensing_sensor *sensor,
 				void *data)
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
+#ifndef CONFIG_SENSING_DISPATCH_DECIMATION
+	uint64_t cur_time = get_us();
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
 
 	for_each_client_conn(sensor, conn) {
 		client = conn->sink;
@@ -49,15 +68,21 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 			continue;
 		}
 
+#ifdef CONFIG_SENSING_DISPATCH_DECIMATION
+		if (!sensor_test_consume_sample(conn)) {
+			continue;
+		}
+#else
 		/* sensor_test_consume_time(), check whether time is ready or not:
 		 * true: it's time for client consuming the data
 		 * false: client time not arrived yet, not consume the data
 		 */
-		if (!sensor_test_consume_time(sensor, conn, get_us())) {
+		if (!sensor_test_consume_time(sensor, conn, cur_time)) {
 			continue;
 		}
 
-		update_client_consume_time(sensor, conn);
+		update_client_consume_time(sensor, conn, cur_time);
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
 
 		if (!conn->callback_list->on_data_event) {
 			LOG_WRN("sensor:%s event callback not registered",
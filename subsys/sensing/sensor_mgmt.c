@@ -73,6 +73,26 @@ static uint32_t arbitrate_interval(struct sensing_sensor *sensor)
 	return interval;
 }
 
+#ifdef CONFIG_SENSING_DISPATCH_DECIMATION
+/* number of samples at the arbitrated interval per sample each client wants */
+static void update_client_decimation(struct sensing_sensor *sensor, uint32_t interval)
+{
+	struct sensing_connection *conn;
+	uint32_t decimation;
+
+	for_each_client_conn(sensor, conn) {
+		if (interval == 0 || !is_client_request_data(conn)) {
+			decimation = 1;
+		} else {
+			decimation = (conn->interval + interval / 2) / interval;
+		}
+
+		conn->decimation = CLAMP(decimation, 1, UINT16_MAX);
+		conn->countdown = 0;
+	}
+}
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
+
 static int set_arbitrate_interval(struct sensing_sensor *sensor, uint32_t interval)
 {
 	struct sensing_submit_config *config = sensor->iodev->data;
@@ -116,6 +136,10 @@ static int set_arbitrate_interval(struct sensing_sensor *sensor, uint32_t interv
 
 	sensor->interval = interval;
 
+#ifdef CONFIG_SENSING_DISPATCH_DECIMATION
+	update_client_decimation(sensor, interval);
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
+
 	return ret;
 }
 
@@ -275,6 +299,10 @@ static void init_connection(struct sensing_connection *conn,
 
 	conn->interval = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
+#ifdef CONFIG_SENSING_DISPATCH_DECIMATION
+	conn->decimation = 1;
+	conn->countdown = 0;
+#endif /* CONFIG_SENSING_DISPATCH_DECIMATION */
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
 }
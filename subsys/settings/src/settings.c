@@ -16,6 +16,7 @@
 #include "settings_priv.h"
 #include <zephyr/types.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/hash_function.h>
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(settings, CONFIG_SETTINGS_LOG_LEVEL);
 
@@ -27,6 +28,72 @@ sys_slist_t settings_handlers;
 static K_MUTEX_DEFINE(settings_lock);
 #endif
 
+#if defined(CONFIG_SETTINGS_STATIC_HANDLERS_HASH)
+/* Static handlers by hash of their name, with linear probing */
+static struct settings_handler_static
+	*settings_static_handlers[CONFIG_SETTINGS_STATIC_HANDLERS_HASH_SIZE];
+static bool settings_static_handlers_hashed;
+
+static void settings_static_handlers_hash(void)
+{
+	uint32_t pos;
+	size_t count = 0;
+
+	memset(settings_static_handlers, 0, sizeof(settings_static_handlers));
+	settings_static_handlers_hashed = false;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		/* Keep an empty slot to end the searches */
+		if (++count == ARRAY_SIZE(settings_static_handlers)) {
+			LOG_WRN("Too many static handlers to be hashed");
+			return;
+		}
+
+		pos = sys_hash32(ch->name, strlen(ch->name)) % ARRAY_SIZE(settings_static_handlers);
+		while (settings_static_handlers[pos] != NULL) {
+			pos = (pos + 1) % ARRAY_SIZE(settings_static_handlers);
+		}
+		settings_static_handlers[pos] = ch;
+	}
+
+	settings_static_handlers_hashed = true;
+}
+
+/* Looks up the static handler with the longest name matching name, by hashing each
+ * subtree of name instead of comparing name to each handler.
+ */
+static struct settings_handler_static *settings_static_handlers_lookup(const char *name,
+								       const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	uint32_t pos;
+	size_t len = 0;
+
+	do {
+		if ((name[len] != SETTINGS_NAME_SEPARATOR) && (name[len] != SETTINGS_NAME_END) &&
+		    (name[len] != '\0')) {
+			continue;
+		}
+
+		pos = sys_hash32(name, len) % ARRAY_SIZE(settings_static_handlers);
+		while ((ch = settings_static_handlers[pos]) != NULL) {
+			/* The last one of handlers with the same name is used */
+			if ((strncmp(ch->name, name, len) == 0) && (ch->name[len] == '\0')) {
+				bestmatch = ch;
+				if (next) {
+					*next = (name[len] == SETTINGS_NAME_SEPARATOR) ? &name[len + 1]
+										       : NULL;
+				}
+			}
+			pos = (pos + 1) % ARRAY_SIZE(settings_static_handlers);
+		}
+	} while ((name[len] != SETTINGS_NAME_END) && (name[len++] != '\0'));
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_STATIC_HANDLERS_HASH */
+
 void settings_store_init(void);
 
 void settings_init(void)
@@ -34,6 +101,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_STATIC_HANDLERS_HASH)
+	settings_static_handlers_hash();
+#endif /* CONFIG_SETTINGS_STATIC_HANDLERS_HASH */
 	settings_store_init();
 }
 
@@ -154,21 +224,28 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
-	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
-		if (!settings_name_steq(name, ch->name, &tmpnext)) {
-			continue;
-		}
-		if (!bestmatch) {
-			bestmatch = ch;
-			if (next) {
-				*next = tmpnext;
+#if defined(CONFIG_SETTINGS_STATIC_HANDLERS_HASH)
+	if (name && settings_static_handlers_hashed) {
+		bestmatch = settings_static_handlers_lookup(name, next);
+	} else
+#endif /* CONFIG_SETTINGS_STATIC_HANDLERS_HASH */
+	{
+		STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+			if (!settings_name_steq(name, ch->name, &tmpnext)) {
+				continue;
 			}
-			continue;
-		}
-		if (settings_name_steq(ch->name, bestmatch->name, NULL)) {
-			bestmatch = ch;
-			if (next) {
-				*next = tmpnext;
+			if (!bestmatch) {
+				bestmatch = ch;
+				if (next) {
+					*next = tmpnext;
+				}
+				continue;
+			}
+			if (settings_name_steq(ch->name, bestmatch->name, NULL)) {
+				bestmatch = ch;
+				if (next) {
+					*next = tmpnext;
+				}
 			}
 		}
 	}
@@ -160,6 +160,45 @@ static int settings_zms_delete(struct settings_zms *cf, uint32_t name_hash)
 	return rc;
 }
 
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+/* Returns the fixed ID entry of name, or NULL if name is stored with a hashed ID */
+static const struct settings_zms_fixed_id *settings_zms_fixed_id_find(const char *name)
+{
+	STRUCT_SECTION_FOREACH(settings_zms_fixed_id, fixed) {
+		if (strcmp(name, fixed->name) == 0) {
+			return fixed;
+		}
+	}
+
+	return NULL;
+}
+
+static int settings_zms_load_fixed_ids(struct settings_zms *cf, const struct settings_load_arg *arg)
+{
+	struct settings_zms_read_fn_arg read_fn_arg;
+	ssize_t rc;
+	int ret;
+
+	STRUCT_SECTION_FOREACH(settings_zms_fixed_id, fixed) {
+		rc = zms_get_data_length(&cf->cf_zms, fixed->id);
+		if (rc <= 0) {
+			/* Not stored or deleted */
+			continue;
+		}
+
+		read_fn_arg.fs = &cf->cf_zms;
+		read_fn_arg.id = fixed->id;
+		ret = settings_call_set_handler(fixed->name, rc, settings_zms_read_fn, &read_fn_arg,
+						arg);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
 #ifdef CONFIG_SETTINGS_ZMS_LOAD_SUBTREE_PATH
 /* Loads first the key which is defined by the name found in "subtree" root.
  * If the key is not found or further keys under the same subtree are needed
@@ -261,6 +300,19 @@ static ssize_t settings_zms_load_one(struct settings_store *cs, const char *name
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+	const struct settings_zms_fixed_id *fixed = settings_zms_fixed_id_find(name);
+
+	if (fixed) {
+		rc = zms_read(&cf->cf_zms, fixed->id, buf, buf_len);
+		if (rc == -ENOENT) {
+			return 0;
+		}
+
+		return (rc == buf_len) ? zms_get_data_length(&cf->cf_zms, fixed->id) : rc;
+	}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
 	name_hash = settings_zms_find_hash_from_name(cf, name);
 	if (name_hash) {
 		/* we found a name_hash corresponding to name */
@@ -330,6 +382,13 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 	}
 #endif /* CONFIG_SETTINGS_ZMS_LOAD_SUBTREE_PATH */
 
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+	ret = settings_zms_load_fixed_ids(cf, arg);
+	if (ret) {
+		return ret;
+	}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
 #ifdef CONFIG_SETTINGS_ZMS_LL_CACHE
 	if (cf->ll_has_changed) {
 		/* reload the linked list in cache */
@@ -385,6 +444,12 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 
 		/* Found a name, this might not include a trailing \0 */
 		name[rc1] = '\0';
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+		if (settings_zms_fixed_id_find(name)) {
+			/* Saved before the name got a fixed ID, the value is stale */
+			continue;
+		}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
 		read_fn_arg.fs = &cf->cf_zms;
 		read_fn_arg.id = ZMS_DATA_ID_FROM_LL_NODE(prev_ll_hash_id);
 
@@ -422,6 +487,21 @@ static int settings_zms_save(struct settings_store *cs, const char *name, const
 	/* Find out if we are doing a delete */
 	delete = ((value == NULL) || (val_len == 0));
 
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+	const struct settings_zms_fixed_id *fixed = settings_zms_fixed_id_find(name);
+
+	if (fixed) {
+		/* A single entry, without name and linked list node */
+		if (delete) {
+			rc = zms_delete(&cf->cf_zms, fixed->id);
+		} else {
+			rc = zms_write(&cf->cf_zms, fixed->id, value, val_len);
+		}
+
+		return (rc < 0) ? rc : 0;
+	}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
 	name_hash = sys_hash32(name, name_len) & ZMS_HASH_MASK;
 	/* MSB is always 1 */
 	name_hash |= BIT(31);
@@ -569,6 +649,16 @@ static ssize_t settings_zms_get_val_len(struct settings_store *cs, const char *n
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+	const struct settings_zms_fixed_id *fixed = settings_zms_fixed_id_find(name);
+
+	if (fixed) {
+		ssize_t rc = zms_get_data_length(&cf->cf_zms, fixed->id);
+
+		return (rc == -ENOENT) ? 0 : rc;
+	}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
 	name_hash = settings_zms_find_hash_from_name(cf, name);
 	if (name_hash) {
 		return zms_get_data_length(&cf->cf_zms, ZMS_DATA_ID_FROM_HASH(name_hash));
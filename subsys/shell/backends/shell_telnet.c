@@ -428,6 +428,13 @@ static void telnet_accept(struct zsock_pollfd *pollfd)
 		goto error;
 	}
 
+	if (!IS_ENABLED(CONFIG_SHELL_TELNET_SEND_ON_LINE_FEED)) {
+		int one = 1;
+
+		/* Output is already coalesced, do not delay it further. */
+		(void)zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	}
+
 	sh_telnet->fds[SOCK_ID_CLIENT].fd = sock;
 	sh_telnet->fds[SOCK_ID_CLIENT].events = ZSOCK_POLLIN;
 	sh_telnet->rx_len = 0;
@@ -701,7 +708,8 @@ static int telnet_write(const struct shell_transport *transport,
 		/* Send the data immediately if the buffer is full or line feed
 		 * is recognized.
 		 */
-		if (lb->buf[lb->len - 1] == '\n' ||
+		if ((IS_ENABLED(CONFIG_SHELL_TELNET_SEND_ON_LINE_FEED) &&
+		     lb->buf[lb->len - 1] == '\n') ||
 		    lb->len == TELNET_LINE_SIZE) {
 			err = telnet_send(true);
 			if (err != 0) {
@@ -28,13 +28,69 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+#define ASYNC_TX_BUF_SIZE CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_BUFFER_SIZE
+
+/* Returns false, with tx_busy cleared, if no transfer was started. */
+static bool async_tx_start(struct shell_uart_async *sh_uart)
+{
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	len = ring_buf_get_claim(&sh_uart->tx_ringbuf, &data, sh_uart->tx_ringbuf.size);
+	if (len == 0) {
+		atomic_clear(&sh_uart->tx_busy);
+		return false;
+	}
+
+	err = uart_tx(sh_uart->common.dev, data, len, SYS_FOREVER_US);
+	if (err < 0) {
+		/* Drop the data rather than retrying it forever. */
+		err = ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+		__ASSERT_NO_MSG(err == 0);
+		atomic_clear(&sh_uart->tx_busy);
+		return false;
+	}
+
+	return true;
+}
+
+static void async_tx_kick(struct shell_uart_async *sh_uart)
+{
+	/* Data may be added while the last transfer finds the buffer empty. */
+	do {
+		if (atomic_set(&sh_uart->tx_busy, 1) != 0) {
+			return;
+		}
+	} while (!async_tx_start(sh_uart) && !ring_buf_is_empty(&sh_uart->tx_ringbuf));
+}
+
+static void async_tx_done(struct shell_uart_async *sh_uart, size_t len)
+{
+	int err;
+
+	err = ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	atomic_clear(&sh_uart->tx_busy);
+	async_tx_kick(sh_uart);
+
+	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+}
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+	case  UART_TX_ABORTED:
+		if (ASYNC_TX_BUF_SIZE > 0) {
+			async_tx_done(sh_uart, evt->data.tx.len);
+		} else {
+			k_sem_give(&sh_uart->tx_sem);
+		}
 		break;
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
@@ -245,6 +301,11 @@ static void async_init(struct shell_uart_async *sh_uart)
 
 	k_sem_init(&sh_uart->tx_sem, 0, 1);
 
+	if (ASYNC_TX_BUF_SIZE > 0) {
+		ring_buf_init(&sh_uart->tx_ringbuf, ASYNC_TX_BUF_SIZE, sh_uart->tx_data);
+		sh_uart->tx_busy = 0;
+	}
+
 	err = uart_async_rx_init(async_rx, &sh_uart->async_rx_config);
 	(void)err;
 	__ASSERT_NO_MSG(err == 0);
@@ -389,6 +450,13 @@ static int async_write(struct shell_uart_async *sh_uart,
 {
 	int err;
 
+	if (ASYNC_TX_BUF_SIZE > 0) {
+		*cnt = ring_buf_put(&sh_uart->tx_ringbuf, data, length);
+		async_tx_kick(sh_uart);
+
+		return 0;
+	}
+
 	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
 	if (err < 0) {
 		*cnt = 0;
@@ -301,7 +301,9 @@ static int sh_write(const struct shell_transport *transport,
 		/* Send the data immediately if the buffer is full or line feed
 		 * is recognized.
 		 */
-		if (lb->buf[lb->len - 1] == '\n' || lb->len == WEBSOCKET_LINE_SIZE) {
+		if ((IS_ENABLED(CONFIG_SHELL_WEBSOCKET_SEND_ON_LINE_FEED) &&
+		     lb->buf[lb->len - 1] == '\n') ||
+		    lb->len == WEBSOCKET_LINE_SIZE) {
 			ret = ws_send(ws, true);
 			if (ret != 0) {
 				*cnt = length;
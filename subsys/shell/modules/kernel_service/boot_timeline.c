@@ -0,0 +1,62 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/boot_timeline.h>
+
+static const char *const level_names[] = {
+	"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP",
+};
+
+static uint32_t cyc_to_us(const struct boot_timeline *timeline, uint32_t cycles)
+{
+	return (uint32_t)(((uint64_t)cycles * USEC_PER_SEC) / MAX(timeline->cycles_per_sec, 1U));
+}
+
+static int cmd_kernel_boot_timeline(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct boot_timeline *timeline = boot_timeline_get();
+	uint32_t count = (uint32_t)atomic_get(&timeline->count);
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-12s %-24s %10s %10s %6s", "Level", "Name", "Start (us)", "Time (us)",
+		    "Result");
+
+	for (uint32_t i = 0; i < MIN(count, timeline->capacity); i++) {
+		const struct boot_timeline_entry *entry = &timeline->entries[i];
+		const char *level = (entry->level < ARRAY_SIZE(level_names))
+					    ? level_names[entry->level]
+					    : "runtime";
+
+		if (entry->dev != NULL) {
+			shell_print(sh, "%-12s %-24s %10u %10u %6d", level, entry->dev->name,
+				    cyc_to_us(timeline, entry->start),
+				    cyc_to_us(timeline, entry->end - entry->start), entry->result);
+		} else {
+			shell_print(sh, "%-12s %-24p %10u %10u %6d", level, entry->init_fn,
+				    cyc_to_us(timeline, entry->start),
+				    cyc_to_us(timeline, entry->end - entry->start), entry->result);
+		}
+	}
+
+	if (count > timeline->capacity) {
+		shell_print(sh, "%u initializations not recorded, increase "
+			    "CONFIG_BOOT_TIMELINE_ENTRIES", count - timeline->capacity);
+	}
+
+	shell_print(sh, "main() called at %u us", cyc_to_us(timeline, timeline->main_cycles));
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(boot_timeline, NULL, "Duration of each initialization at boot.",
+	       cmd_kernel_boot_timeline);
@@ -28,8 +28,16 @@ static int settings_direct_loader(const char *key, size_t len,
 	/* Handle the subtree if it is an exact key match. */
 	if (settings_name_next(key, NULL) == 0) {
 		size_t bytes_written = 0;
-		ssize_t cb_len = read_cb(cb_arg, &bytes_written,
-				      sizeof(bytes_written));
+		ssize_t cb_len;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+		struct k_work_sync sync;
+
+		/* Erase ahead uses the progress being updated */
+		(void)k_work_flush(&ctx->erase_ahead_work, &sync);
+#endif
+
+		cb_len = read_cb(cb_arg, &bytes_written, sizeof(bytes_written));
 
 		if (cb_len != sizeof(ctx->bytes_written)) {
 			LOG_ERR("Unable to read bytes_written from storage");
@@ -72,6 +80,93 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #endif /* CONFIG_STREAM_FLASH_PROGRESS */
 
+#if defined(CONFIG_STREAM_FLASH_ERASE)
+/* Erases pages, starting from ctx->erased_up_to, until offset @p end relative to
+ * ctx->offset is erased.
+ */
+static int stream_flash_erase_up_to(struct stream_flash_ctx *ctx, size_t end)
+{
+	int rc;
+	struct flash_pages_info page;
+#if defined(CONFIG_STREAM_FLASH_ERASE_ONLY_WHEN_SUPPORTED)
+	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
+
+	/* Stream flash does not rely on erase, it does it when device needs it */
+	if (!(flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT)) {
+		return 0;
+	}
+#endif
+
+	while (ctx->erased_up_to < end) {
+		/* Note that ctx->erased_up_to is offset relative to ctx->offset that
+		 * points to first byte not yet erased.
+		 */
+		rc = flash_get_page_info_by_offs(ctx->fdev, ctx->offset + ctx->erased_up_to,
+						 &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
+			return rc;
+		}
+
+		LOG_DBG("Erasing page at offset 0x%08lx", (long)page.start_offset);
+
+		rc = flash_erase(ctx->fdev, page.start_offset, page.size);
+		if (rc != 0) {
+			LOG_ERR("Error %d while erasing page", rc);
+			return rc;
+		}
+
+		ctx->erased_up_to = page.start_offset + page.size - ctx->offset;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE */
+
+#if defined(CONFIG_STREAM_FLASH_ERASE_AHEAD)
+static void stream_flash_erase_ahead_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx,
+						    erase_ahead_work);
+	struct flash_pages_info page;
+	size_t end = ctx->bytes_written;
+
+	/* The page written next, and the pages following it */
+	for (int i = 0; i <= CONFIG_STREAM_FLASH_ERASE_AHEAD_PAGES && end < ctx->available; i++) {
+		if (flash_get_page_info_by_offs(ctx->fdev, ctx->offset + end, &page) != 0) {
+			return;
+		}
+		end = page.start_offset + page.size - ctx->offset;
+	}
+
+	/* Failures are reported by the erase done again before the write */
+	(void)stream_flash_erase_up_to(ctx, MIN(end, ctx->available));
+}
+
+static void stream_flash_erase_ahead_start(struct stream_flash_ctx *ctx)
+{
+	(void)k_work_submit(&ctx->erase_ahead_work);
+}
+
+/* The context may only be accessed by the caller once this returns */
+static void stream_flash_erase_ahead_wait(struct stream_flash_ctx *ctx)
+{
+	struct k_work_sync sync;
+
+	(void)k_work_flush(&ctx->erase_ahead_work, &sync);
+}
+#else
+static inline void stream_flash_erase_ahead_start(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void stream_flash_erase_ahead_wait(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE_AHEAD */
+
 /* Will erase at most what is required to append given size, If already
  * erased space can accommodate requested size, then no new page will
  * be erased.
@@ -84,11 +179,6 @@ static int stream_flash_erase_to_append(struct stream_flash_ctx *ctx, size_t siz
 {
 	int rc = 0;
 #if defined(CONFIG_STREAM_FLASH_ERASE)
-	struct flash_pages_info page;
-#if defined(CONFIG_STREAM_FLASH_ERASE_ONLY_WHEN_SUPPORTED)
-	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
-#endif
-
 	/* ctx->erased_up_to points to first offset that has not yet been erased,
 	 * relative to ctx->offset.
 	 */
@@ -101,30 +191,8 @@ static int stream_flash_erase_to_append(struct stream_flash_ctx *ctx, size_t siz
 		return -ERANGE;
 	}
 
-#if defined(CONFIG_STREAM_FLASH_ERASE_ONLY_WHEN_SUPPORTED)
-	/* Stream flash does not rely on erase, it does it when device needs it */
-	if (!(flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT)) {
-		return 0;
-	}
-#endif
-	/* Note that ctx->erased_up_to is offset relative to ctx->offset that
-	 * points to first byte not yet erased.
-	 */
-	rc = flash_get_page_info_by_offs(ctx->fdev, ctx->offset + ctx->erased_up_to, &page);
-	if (rc != 0) {
-		LOG_ERR("Error %d while getting page info", rc);
-		return rc;
-	}
-
-	LOG_DBG("Erasing page at offset 0x%08lx", (long)page.start_offset);
-
-	rc = flash_erase(ctx->fdev, page.start_offset, page.size);
-
-	if (rc != 0) {
-		LOG_ERR("Error %d while erasing page", rc);
-	} else {
-		ctx->erased_up_to += page.size;
-	}
+	/* The buffer may span several pages */
+	rc = stream_flash_erase_up_to(ctx, ctx->bytes_written + size);
 #endif
 	return rc;
 }
@@ -142,6 +210,8 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 		return -ERANGE;
 	}
 
+	stream_flash_erase_ahead_wait(ctx);
+
 	/* Do not allow pages that have already been erased */
 	if ((off - ctx->offset) < ctx->erased_up_to) {
 		return -EINVAL;
@@ -198,6 +268,7 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
+		stream_flash_erase_ahead_wait(ctx);
 
 		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
 		if (rc < 0) {
@@ -288,6 +359,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		processed += buf_empty_bytes;
 	}
 
+	/* Prepare the following pages while the buffer is being filled again */
+	if (!flush && processed > 0) {
+		stream_flash_erase_ahead_start(ctx);
+	}
+
 	/* place rest of the data into ctx->buf */
 	if (processed < len) {
 		memcpy(ctx->buf + ctx->buf_bytes,
@@ -299,6 +375,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+	if (flush) {
+		/* Do not leave an erase running once the stream is complete */
+		stream_flash_erase_ahead_wait(ctx);
+	}
+
 	return rc;
 }
 
@@ -314,7 +395,6 @@ size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx)
 
 #ifdef CONFIG_STREAM_FLASH_INSPECT
 struct _inspect_flash {
-	size_t buf_len;
 	size_t total_size;
 };
 
@@ -323,12 +403,6 @@ static bool find_flash_total_size(const struct flash_pages_info *info,
 {
 	struct _inspect_flash *ctx = (struct _inspect_flash *) data;
 
-	if (ctx->buf_len > info->size) {
-		LOG_ERR("Buffer size is bigger than page");
-		ctx->total_size = 0;
-		return false;
-	}
-
 	ctx->total_size += info->size;
 
 	return true;
@@ -338,13 +412,10 @@ static bool find_flash_total_size(const struct flash_pages_info *info,
 static inline int inspect_device(const struct stream_flash_ctx *ctx)
 {
 	struct _inspect_flash inspect_flash_ctx = {
-		.buf_len = ctx->buf_len,
 		.total_size = 0
 	};
 
-	/* Calculate the total size of the flash device, and inspect pages
-	 * while doing so.
-	 */
+	/* Calculate the total size of the flash device */
 	flash_page_foreach(ctx->fdev, find_flash_total_size, &inspect_flash_ctx);
 
 	if (inspect_flash_ctx.total_size == 0) {
@@ -392,6 +463,11 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		return -EFAULT;
 	}
 
+	if (buf_len > size) {
+		LOG_ERR("Buffer size is bigger than write area");
+		return -EFAULT;
+	}
+
 	ctx->fdev = fdev;
 	ctx->buf = buf;
 	ctx->buf_len = buf_len;
@@ -410,6 +486,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->erased_up_to = 0;
+#endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	k_work_init(&ctx->erase_ahead_work, stream_flash_erase_ahead_handler);
 #endif
 	ctx->erase_value = params->erase_value;
 
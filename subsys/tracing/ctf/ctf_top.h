@@ -49,7 +49,17 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));                                 \
 	}
 
-#ifdef CONFIG_TRACING_CTF_TIMESTAMP
+#if defined(CONFIG_TRACING_CTF_TIMESTAMP) && defined(CONFIG_TRACING_BUFFER_PER_CPU)
+/* Events only need to be ordered with respect to other events of the same CPU */
+#define CTF_EVENT(...)                                                                             \
+	{                                                                                          \
+		unsigned int key = arch_irq_lock();                                                \
+		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32());                     \
+                                                                                                   \
+		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                                             \
+		arch_irq_unlock(key);                                                              \
+	}
+#elif defined(CONFIG_TRACING_CTF_TIMESTAMP)
 #define CTF_EVENT(...)                                                                             \
 	{                                                                                          \
 		int key = irq_lock();                                                              \
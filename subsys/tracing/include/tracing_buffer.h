@@ -113,6 +113,14 @@ uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
  */
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Store a packet in the buffer of the current CPU */
+bool tracing_buffer_cpu_put(uint8_t *data, uint32_t size, bool *was_empty);
+
+/* Remove the oldest packet stored in any of the CPU buffers */
+uint32_t tracing_buffer_cpu_get(uint8_t *data, uint32_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,12 +4,101 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#define DISABLE_SYSCALL_TRACING
+
+#include <zephyr/kernel.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
 static struct ring_buf tracing_ring_buf;
 static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Stored in front of each packet, the cycle count orders packets of all CPUs */
+struct tracing_cpu_packet_hdr {
+	uint32_t cycles;
+	uint32_t length;
+};
+
+struct tracing_cpu_buffer {
+	struct k_spinlock lock;
+	struct ring_buf ring_buf;
+	uint8_t buffer[CONFIG_TRACING_BUFFER_SIZE];
+};
+
+static struct tracing_cpu_buffer tracing_cpu_buffers[CONFIG_MP_MAX_NUM_CPUS];
+
+bool tracing_buffer_cpu_put(uint8_t *data, uint32_t size, bool *was_empty)
+{
+	struct tracing_cpu_packet_hdr hdr = {
+		.length = size,
+	};
+	struct tracing_cpu_buffer *cpu_buf;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+	bool stored = false;
+
+	if (size > CONFIG_TRACING_PACKET_MAX_SIZE) {
+		return false;
+	}
+
+	/* Do not migrate between selecting the buffer and locking it */
+	irq_key = arch_irq_lock();
+	cpu_buf = &tracing_cpu_buffers[arch_curr_cpu()->id];
+	key = k_spin_lock(&cpu_buf->lock);
+
+	*was_empty = ring_buf_is_empty(&cpu_buf->ring_buf);
+
+	if (ring_buf_space_get(&cpu_buf->ring_buf) >= sizeof(hdr) + size) {
+		hdr.cycles = k_cycle_get_32();
+		ring_buf_put(&cpu_buf->ring_buf, (uint8_t *)&hdr, sizeof(hdr));
+		ring_buf_put(&cpu_buf->ring_buf, data, size);
+		stored = true;
+	}
+
+	k_spin_unlock(&cpu_buf->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return stored;
+}
+
+uint32_t tracing_buffer_cpu_get(uint8_t *data, uint32_t size)
+{
+	struct tracing_cpu_buffer *oldest = NULL;
+	struct tracing_cpu_packet_hdr hdr;
+	uint32_t oldest_cycles = 0;
+	k_spinlock_key_t key;
+
+	__ASSERT_NO_MSG(size >= CONFIG_TRACING_PACKET_MAX_SIZE);
+
+	/* Only the caller removes packets, so the oldest one stays in place */
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		struct tracing_cpu_buffer *cpu_buf = &tracing_cpu_buffers[i];
+
+		key = k_spin_lock(&cpu_buf->lock);
+		if ((ring_buf_peek(&cpu_buf->ring_buf, (uint8_t *)&hdr, sizeof(hdr)) ==
+		     sizeof(hdr)) &&
+		    ((oldest == NULL) || ((int32_t)(hdr.cycles - oldest_cycles) < 0))) {
+			oldest = cpu_buf;
+			oldest_cycles = hdr.cycles;
+		}
+		k_spin_unlock(&cpu_buf->lock, key);
+	}
+
+	if (oldest == NULL) {
+		return 0;
+	}
+
+	key = k_spin_lock(&oldest->lock);
+	ring_buf_get(&oldest->ring_buf, (uint8_t *)&hdr, sizeof(hdr));
+	ring_buf_get(&oldest->ring_buf, data, hdr.length);
+	k_spin_unlock(&oldest->lock, key);
+
+	return hdr.length;
+}
+#endif /* CONFIG_TRACING_BUFFER_PER_CPU */
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -51,6 +140,14 @@ void tracing_buffer_init(void)
 {
 	ring_buf_init(&tracing_ring_buf,
 		      sizeof(tracing_buffer), tracing_buffer);
+
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		ring_buf_init(&tracing_cpu_buffers[i].ring_buf,
+			      sizeof(tracing_cpu_buffers[i].buffer),
+			      tracing_cpu_buffers[i].buffer);
+	}
+#endif
 }
 
 bool tracing_buffer_is_empty(void)
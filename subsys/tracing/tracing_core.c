@@ -40,19 +40,48 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Maximum number of packets of the CPU buffers output between global buffer checks */
+#define TRACING_CPU_PACKETS_PER_PASS 32
+
+/* Output packets stored in the CPU buffers, oldest first */
+static bool tracing_thread_cpu_output(void)
+{
+	static uint8_t packet[CONFIG_TRACING_PACKET_MAX_SIZE];
+	uint32_t length;
+	int i;
+
+	for (i = 0; i < TRACING_CPU_PACKETS_PER_PASS; i++) {
+		length = tracing_buffer_cpu_get(packet, sizeof(packet));
+		if (length == 0) {
+			break;
+		}
+
+		tracing_buffer_handle(packet, length);
+	}
+
+	return i > 0;
+}
+#endif
+
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
 	uint32_t transferring_length, tracing_buffer_max_length;
+	bool output;
 
 	tracing_thread_tid = k_current_get();
 
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
 
 	while (true) {
-		if (tracing_buffer_is_empty()) {
-			k_sem_take(&tracing_thread_sem, K_FOREVER);
-		} else {
+		output = false;
+
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+		output = tracing_thread_cpu_output();
+#endif
+
+		if (!tracing_buffer_is_empty()) {
 			transferring_length =
 				tracing_buffer_get_claim(
 						&transferring_buf,
@@ -60,6 +89,11 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 			tracing_buffer_handle(transferring_buf,
 					      transferring_length);
 			tracing_buffer_get_finish(transferring_length);
+			output = true;
+		}
+
+		if (!output) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		}
 	}
 }
@@ -35,15 +35,18 @@ enum {
 	CDC_NCM_IFACE_UP,
 	CDC_NCM_DATA_IFACE_ENABLED,
 	CDC_NCM_CLASS_SUSPENDED,
-	CDC_NCM_OUT_ENGAGED,
+	CDC_NCM_IN_ENGAGED,
 };
 
 /* Chapter 6.2.7 table 6-4 */
 #define CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_MAX_DGRAM_PER_NTB
-#define CDC_NCM_RECV_NTB_MAX_SIZE 2048
+#define CDC_NCM_RECV_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_RECV_NTB_MAX_SIZE
 
-#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB 1
-#define CDC_NCM_SEND_NTB_MAX_SIZE 2048
+#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_SEND_MAX_DGRAM_PER_NTB
+#define CDC_NCM_SEND_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_SEND_NTB_MAX_SIZE
+
+/* One NTB is being transferred while the next one is being filled */
+#define CDC_NCM_SEND_NTB_COUNT 2
 
 /* Chapter 6.3 table 6-5 and 6-6 */
 struct cdc_ncm_notification {
@@ -171,11 +174,12 @@ union recv_ntb {
 } __packed;
 
 /*
- * Transfers through two endpoints proceed in a synchronous manner,
- * with maximum block of CDC_NCM_SEND_NTB_MAX_SIZE.
+ * Several OUT transfers are kept queued, and the IN NTB that is being
+ * filled is only submitted once the previous IN transfer has finished.
  */
 UDC_BUF_POOL_DEFINE(cdc_ncm_ep_pool,
-		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) *
+		    (CONFIG_USBD_CDC_NCM_OUT_TRANSFERS + CDC_NCM_SEND_NTB_COUNT),
 		    MAX(CDC_NCM_SEND_NTB_MAX_SIZE, CDC_NCM_RECV_NTB_MAX_SIZE),
 		    sizeof(struct udc_buf_info), NULL);
 
@@ -230,6 +234,15 @@ struct cdc_ncm_eth_data {
 	uint16_t tx_seq;
 	uint16_t rx_seq;
 
+	/* Number of OUT transfers queued to the UDC */
+	atomic_t out_queued;
+
+	/* IN NTB being filled and the number of datagrams in it */
+	struct net_buf *tx_ntb;
+	uint16_t tx_dgrams;
+	struct k_mutex tx_mutex;
+	struct k_work tx_work;
+
 	struct k_sem sync_sem;
 
 	struct k_work_delayable notif_work;
@@ -323,25 +336,28 @@ static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 	uint8_t ep;
 	int ret;
 
-	if (atomic_test_and_set_bit(&data->state, CDC_NCM_OUT_ENGAGED)) {
-		return -EBUSY;
-	}
-
 	ep = cdc_ncm_get_bulk_out(c_data);
-	buf = cdc_ncm_buf_alloc(ep);
-	if (buf == NULL) {
-		return -ENOMEM;
-	}
 
-	ret = usbd_ep_enqueue(c_data, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
-	} else {
+	while (atomic_get(&data->out_queued) < CONFIG_USBD_CDC_NCM_OUT_TRANSFERS) {
+		buf = cdc_ncm_buf_alloc(ep);
+		if (buf == NULL) {
+			return -ENOMEM;
+		}
+
+		atomic_inc(&data->out_queued);
+
+		ret = usbd_ep_enqueue(c_data, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			atomic_dec(&data->out_queued);
+			net_buf_unref(buf);
+			return ret;
+		}
+
 		LOG_DBG("enqueue out %u", buf->size);
 	}
 
-	return  ret;
+	return 0;
 }
 
 static int verify_nth16(struct cdc_ncm_eth_data *const data,
@@ -608,7 +624,7 @@ unref_packet:
 restart_out_transfer:
 	net_buf_unref(buf);
 
-	atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+	atomic_dec(&data->out_queued);
 	if (atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
 		return cdc_ncm_out_start(c_data);
 	}
@@ -654,7 +670,11 @@ static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
+		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_IN_ENGAGED);
 		k_sem_give(&data->sync_sem);
+		/* Submit datagrams queued while the transfer was in progress */
+		k_work_submit(&data->tx_work);
 		return 0;
 	}
 
@@ -840,7 +860,16 @@ static void usbd_cdc_ncm_update(struct usbd_class_data *const c_data,
 
 	if (data_iface == iface && alternate == 0) {
 		atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+
+		k_mutex_lock(&data->tx_mutex, K_FOREVER);
+		if (data->tx_ntb != NULL) {
+			net_buf_unref(data->tx_ntb);
+			data->tx_ntb = NULL;
+		}
+
 		data->tx_seq = 0;
+		k_mutex_unlock(&data->tx_mutex);
+
 		data->rx_seq = 0;
 	}
 
@@ -1023,31 +1052,66 @@ static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
 	return data->fs_desc;
 }
 
-static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
+static bool cdc_ncm_in_fits(struct cdc_ncm_eth_data *const data, const size_t len)
 {
-	struct cdc_ncm_eth_data *const data = dev->data;
-	struct usbd_class_data *c_data = data->c_data;
-	size_t len = net_pkt_get_len(pkt);
-	struct net_buf *buf;
+	return data->tx_dgrams < CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB &&
+	       ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT) + len <= CDC_NCM_SEND_NTB_MAX_SIZE;
+}
+
+static int cdc_ncm_in_append(struct cdc_ncm_eth_data *const data,
+			     struct net_pkt *const pkt, const size_t len)
+{
+	struct net_buf *buf = data->tx_ntb;
 	union send_ntb *ntb;
+	size_t start;
 
-	if (len > NET_ETH_MAX_FRAME_SIZE) {
-		LOG_WRN("Trying to send too large packet, drop");
-		return -ENOMEM;
+	if (buf == NULL) {
+		buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(data->c_data));
+		if (buf == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			return -ENOMEM;
+		}
+
+		/* Headers are completed when the NTB is submitted */
+		ntb = (union send_ntb *)buf->data;
+		memset(ntb, 0, sizeof(ntb->nth) + sizeof(ntb->ndp) + sizeof(ntb->ndp_datagram));
+		net_buf_add(buf, sizeof(ntb->nth) + sizeof(ntb->ndp) + sizeof(ntb->ndp_datagram));
+
+		data->tx_ntb = buf;
+		data->tx_dgrams = 0;
 	}
 
-	if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED) ||
-	    !atomic_test_bit(&data->state, CDC_NCM_IFACE_UP)) {
-		LOG_DBG("Configuration is not enabled or interface not ready (%d / %d)",
-			atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED),
-			atomic_test_bit(&data->state, CDC_NCM_IFACE_UP));
-		return -EACCES;
+	ntb = (union send_ntb *)buf->data;
+	start = ROUND_UP(buf->len, CDC_NCM_ALIGNMENT);
+
+	if (net_pkt_read(pkt, buf->data + start, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		return -ENOBUFS;
 	}
 
-	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
+	net_buf_add(buf, start - buf->len + len);
+
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramIndex = sys_cpu_to_le16(start);
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_dgrams++;
+
+	return 0;
+}
+
+/* Must be called with tx_mutex held */
+static int cdc_ncm_in_flush(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb;
+	int ret;
+
 	if (buf == NULL) {
-		LOG_ERR("Failed to allocate buffer");
-		return -ENOMEM;
+		return 0;
+	}
+
+	if (atomic_test_and_set_bit(&data->state, CDC_NCM_IN_ENGAGED)) {
+		return -EBUSY;
 	}
 
 	ntb = (union send_ntb *)buf->data;
@@ -1055,42 +1119,95 @@ static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
 	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
 	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
+	ntb->nth.wBlockLength = sys_cpu_to_le16(buf->len);
 	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
 	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
 	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
 					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
 					   sizeof(struct ndp16_datagram));
 	ntb->ndp.wNextNdpIndex = 0;
-	ntb->ndp_datagram[0].wDatagramIndex =
-		sys_cpu_to_le16(sys_le16_to_cpu(ntb->nth.wHeaderLength) +
-				sys_le16_to_cpu(ntb->ndp.wLength));
-	ntb->ndp_datagram[0].wDatagramLength = sys_cpu_to_le16(len);
-	ntb->ndp_datagram[1].wDatagramIndex  = 0;
-	ntb->ndp_datagram[1].wDatagramLength = 0;
-	ntb->nth.wBlockLength = sys_cpu_to_le16(
-		sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex) + len);
-
-	net_buf_add(buf, sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex));
-
-	if (net_pkt_read(pkt, buf->data + buf->len, len)) {
-		LOG_ERR("Failed copy net_pkt");
+
+	if (buf->len % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	data->tx_ntb = NULL;
+
+	LOG_DBG("enqueue in %u, %u datagram%s", buf->len, data->tx_dgrams,
+		data->tx_dgrams == 1 ? "" : "s");
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", udc_get_buf_info(buf)->ep);
 		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_IN_ENGAGED);
+	}
 
-		return -ENOBUFS;
+	return ret;
+}
+
+static void cdc_ncm_tx_work(struct k_work *work)
+{
+	struct cdc_ncm_eth_data *data = CONTAINER_OF(work, struct cdc_ncm_eth_data, tx_work);
+
+	k_mutex_lock(&data->tx_mutex, K_FOREVER);
+	(void)cdc_ncm_in_flush(data);
+	k_mutex_unlock(&data->tx_mutex);
+}
+
+static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+	size_t len = net_pkt_get_len(pkt);
+	int ret;
+
+	if (len > NET_ETH_MAX_FRAME_SIZE) {
+		LOG_WRN("Trying to send too large packet, drop");
+		return -ENOMEM;
+	}
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED) ||
+	    !atomic_test_bit(&data->state, CDC_NCM_IFACE_UP)) {
+		LOG_DBG("Configuration is not enabled or interface not ready (%d / %d)",
+			atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED),
+			atomic_test_bit(&data->state, CDC_NCM_IFACE_UP));
+		return -EACCES;
 	}
 
-	net_buf_add(buf, len);
+	k_mutex_lock(&data->tx_mutex, K_FOREVER);
 
-	if (sys_le16_to_cpu(ntb->nth.wBlockLength) % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
-		udc_ep_buf_set_zlp(buf);
+	/*
+	 * An NTB that cannot take this datagram has to be submitted first,
+	 * which requires the previous IN transfer to be finished.
+	 */
+	while (data->tx_ntb != NULL && !cdc_ncm_in_fits(data, len)) {
+		ret = cdc_ncm_in_flush(data);
+		if (ret == -EBUSY) {
+			k_sem_take(&data->sync_sem, K_FOREVER);
+		} else if (ret) {
+			goto out;
+		}
+	}
+
+	ret = cdc_ncm_in_append(data, pkt, len);
+	if (ret) {
+		goto out;
 	}
 
-	usbd_ep_enqueue(c_data, buf);
-	k_sem_take(&data->sync_sem, K_FOREVER);
+	/*
+	 * Send right away if the IN endpoint is idle, otherwise the NTB is
+	 * submitted when the current transfer finishes and may meanwhile
+	 * collect more datagrams.
+	 */
+	ret = cdc_ncm_in_flush(data);
+	if (ret == -EBUSY) {
+		ret = 0;
+	}
 
-	net_buf_unref(buf);
+out:
+	k_mutex_unlock(&data->tx_mutex);
 
-	return 0;
+	return ret;
 }
 
 static int cdc_ncm_set_config(const struct device *dev,
@@ -1168,6 +1285,8 @@ static int usbd_cdc_ncm_preinit(const struct device *dev)
 	struct cdc_ncm_eth_data *data = dev->data;
 
 	k_work_init_delayable(&data->notif_work, send_notification_work);
+	k_work_init(&data->tx_work, cdc_ncm_tx_work);
+	k_mutex_init(&data->tx_mutex);
 
 	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
 		gen_random_mac(data->mac_addr, 0, 0, 0);
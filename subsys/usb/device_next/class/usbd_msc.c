@@ -119,6 +119,11 @@ struct msc_bot_ctx {
 	struct CBW cbw;
 	struct CSW csw;
 	uint8_t *scsi_buf;
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	uint8_t *scsi_buf_alt;
+	/* Received data not yet passed to SCSI layer */
+	size_t out_pending;
+#endif
 	uint32_t transferred_data;
 	size_t scsi_bytes;
 };
@@ -167,6 +172,10 @@ static size_t msc_next_transfer_length(struct usbd_class_data *const c_data)
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 	size_t len = scsi_cmd_remaining_data_len(lun);
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	len -= MIN(len, ctx->out_pending);
+#endif
+
 	len = MIN(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE, len);
 
 	/* Limit transfer to bulk endpoint wMaxPacketSize multiple */
@@ -186,6 +195,16 @@ static size_t msc_next_transfer_length(struct usbd_class_data *const c_data)
 	return len;
 }
 
+static void msc_swap_scsi_buf(struct msc_bot_ctx *const ctx)
+{
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	uint8_t *tmp = ctx->scsi_buf;
+
+	ctx->scsi_buf = ctx->scsi_buf_alt;
+	ctx->scsi_buf_alt = tmp;
+#endif
+}
+
 static uint8_t msc_get_bulk_in(struct usbd_class_data *const c_data)
 {
 	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
@@ -343,6 +362,17 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
 		net_buf_unref(buf);
 		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING)) {
+		size_t len = msc_next_transfer_length(ctx->class_node);
+
+		/* Read next chunk from the disk while this one is sent */
+		if (len > 0) {
+			msc_swap_scsi_buf(ctx);
+			ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf, len);
+		}
 	}
 }
 
@@ -468,6 +498,28 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 	}
 }
 
+/* Receive next chunk from the host while this one is written to the disk */
+static void msc_queue_next_write(struct msc_bot_ctx *ctx, size_t len)
+{
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	if (ctx->transferred_data + len >= ctx->cbw.dCBWDataTransferLength ||
+	    scsi_cmd_remaining_data_len(lun) <= len) {
+		/* This is the last chunk */
+		return;
+	}
+
+	ctx->out_pending = len;
+	if (msc_next_transfer_length(ctx->class_node) > 0) {
+		msc_swap_scsi_buf(ctx);
+		msc_queue_bulk_out_ep(ctx->class_node, true);
+	}
+
+	ctx->out_pending = 0;
+#endif
+}
+
 static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 				uint8_t *buf, size_t len)
 {
@@ -507,6 +559,7 @@ static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 			ctx->state = MSC_BBB_WAIT_FOR_RESET_RECOVERY;
 		}
 	} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+		msc_queue_next_write(ctx, len);
 		msc_process_write(ctx, buf, len);
 	}
 }
@@ -521,7 +574,8 @@ static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
 		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 
 		ctx->transferred_data += len;
-		if (msc_next_transfer_length(ctx->class_node) == 0) {
+		if (ctx->scsi_bytes == 0 &&
+		    msc_next_transfer_length(ctx->class_node) == 0) {
 			if (ctx->csw.dCSWDataResidue > 0) {
 				/* Case (5) Hi > Di
 				 * While we may have sent short packet, device
@@ -579,6 +633,14 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+
+	/* Handlers may queue next transfer on the same endpoint */
+	if (bi->ep == msc_get_bulk_out(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
+	} else if (bi->ep == msc_get_bulk_in(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+	}
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -598,11 +660,6 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	}
 
 ep_request_error:
-	if (bi->ep == msc_get_bulk_out(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
-	} else if (bi->ep == msc_get_bulk_in(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
-	}
 	usbd_ep_buf_free(uds_ctx, buf);
 }
 
@@ -875,12 +932,17 @@ struct usbd_class_api msc_bot_api = {
 
 #define DEFINE_MSC_BOT_CLASS_DATA(x, _)						\
 	UDC_STATIC_BUF_DEFINE(scsi_buf_##x, CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);	\
+	IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING,				\
+		   (UDC_STATIC_BUF_DEFINE(scsi_buf_alt_##x,			\
+					  CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);))	\
 										\
 	static struct msc_bot_ctx msc_bot_ctx_##x = {				\
 		.desc = &msc_bot_desc_##x,					\
 		.fs_desc = msc_bot_fs_desc_##x,					\
 		.hs_desc = msc_bot_hs_desc_##x,					\
-		.scsi_buf = scsi_buf_##x					\
+		.scsi_buf = scsi_buf_##x,					\
+		IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING,			\
+			   (.scsi_buf_alt = scsi_buf_alt_##x,))			\
 	};									\
 										\
 	USBD_DEFINE_CLASS(msc_##x, &msc_bot_api, &msc_bot_ctx_##x,		\
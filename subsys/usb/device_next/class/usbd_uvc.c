@@ -1875,36 +1875,23 @@ static int uvc_request(struct usbd_class_data *const c_data, struct net_buf *con
 }
 
 /*
- * Handling the start of USB transfers marked by 'v' below:
- * v                                       v
- * [hdr:data:::][data::::::::::::::::::::] [hdr:data:::][data::::::::::::::::::::] ...
- *      [vbuf::::::::::::::::::::::::::::]      [vbuf::::::::::::::::::::::::::::] ...
+ * Start a transfer by copying the header and the beginning of the video buffer into a
+ * packet-sized USB buffer, so that the rest can be sent from an aligned position.
  */
-static struct net_buf *uvc_initiate_transfer(const struct device *dev,
-					     struct video_buffer *const vbuf,
-					     size_t *const next_line_offset,
-					     size_t *const next_vbuf_offset)
+static struct net_buf *uvc_copy_transfer(const struct device *dev,
+					 struct video_buffer *const vbuf,
+					 size_t *const next_vbuf_offset)
 {
 	const struct uvc_config *cfg = dev->config;
 	struct uvc_data *data = dev->data;
-	struct video_format *fmt = &data->video_fmt;
 	size_t mps = uvc_get_bulk_mps(cfg->c_data);
 	struct net_buf *buf;
 
 	buf = net_buf_alloc_len(&uvc_buf_pool, mps, K_NO_WAIT);
 	if (buf == NULL) {
-		LOG_DBG("Cannot allocate first USB buffer for now");
 		return NULL;
 	}
 
-	/* If uncompressed and line-based format, update the next position in the frame */
-	if (fmt->pitch > 0) {
-		*next_line_offset = vbuf->line_offset + vbuf->bytesused / fmt->pitch;
-	}
-
-	LOG_INF("Start of transfer, bytes used %u, sending lines %u to %u out of %u",
-		vbuf->bytesused, vbuf->line_offset, vbuf->line_offset, fmt->height);
-
 	/* Copy the header into the buffer */
 	net_buf_add_mem(buf, &data->payload_header, data->payload_header.bHeaderLength);
 
@@ -1923,6 +1910,73 @@ static struct net_buf *uvc_initiate_transfer(const struct device *dev,
 
 	net_buf_add_mem(buf, vbuf->buffer, *next_vbuf_offset);
 
+	return buf;
+}
+
+/*
+ * Start a transfer by writing the header into the headroom of the video buffer, padded up
+ * to the video data, and passing both to the USB with zero-copy.
+ */
+static struct net_buf *uvc_prepend_transfer(const struct device *dev,
+					    struct video_buffer *const vbuf,
+					    size_t *const next_vbuf_offset)
+{
+	struct uvc_data *data = dev->data;
+	uint8_t *hdr = vbuf->buffer - vbuf->headroom;
+	/* Workaround net_buf that uses uint16_t storage for lengths and offsets */
+	const size_t max_len = 0xf000;
+	const size_t buf_len = MIN(max_len, vbuf->headroom + vbuf->bytesused);
+	struct net_buf *buf;
+
+	buf = net_buf_alloc_with_data(&uvc_buf_pool, hdr, buf_len, K_NO_WAIT);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	memset(hdr, 0, vbuf->headroom);
+	memcpy(hdr, &data->payload_header, data->payload_header.bHeaderLength);
+	((struct uvc_payload_header *)hdr)->bHeaderLength = vbuf->headroom;
+
+	*next_vbuf_offset = buf_len - vbuf->headroom;
+
+	return buf;
+}
+
+/*
+ * Handling the start of USB transfers marked by 'v' below:
+ * v                                       v
+ * [hdr:data:::][data::::::::::::::::::::] [hdr:data:::][data::::::::::::::::::::] ...
+ *      [vbuf::::::::::::::::::::::::::::]      [vbuf::::::::::::::::::::::::::::] ...
+ */
+static struct net_buf *uvc_initiate_transfer(const struct device *dev,
+					     struct video_buffer *const vbuf,
+					     size_t *const next_line_offset,
+					     size_t *const next_vbuf_offset)
+{
+	struct uvc_data *data = dev->data;
+	struct video_format *fmt = &data->video_fmt;
+	struct net_buf *buf;
+
+	/* If uncompressed and line-based format, update the next position in the frame */
+	if (fmt->pitch > 0) {
+		*next_line_offset = vbuf->line_offset + vbuf->bytesused / fmt->pitch;
+	}
+
+	if (vbuf->headroom >= data->payload_header.bHeaderLength &&
+	    vbuf->headroom <= UINT8_MAX &&
+	    IS_UDC_ALIGNED((uintptr_t)(vbuf->buffer - vbuf->headroom))) {
+		buf = uvc_prepend_transfer(dev, vbuf, next_vbuf_offset);
+	} else {
+		buf = uvc_copy_transfer(dev, vbuf, next_vbuf_offset);
+	}
+	if (buf == NULL) {
+		LOG_DBG("Cannot allocate first USB buffer for now");
+		return NULL;
+	}
+
+	LOG_INF("Start of transfer, bytes used %u, sending lines %u to %u out of %u",
+		vbuf->bytesused, vbuf->line_offset, vbuf->line_offset, fmt->height);
+
 	/* If this new USB transfer will complete this frame */
 	if (fmt->pitch == 0 || *next_line_offset >= fmt->height) {
 		LOG_DBG("Last USB transfer for this buffer");
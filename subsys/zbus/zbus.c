@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -52,6 +53,58 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+
+K_WORK_POOL_DEFINE(_zbus_async_listener_pool, CONFIG_ZBUS_ASYNC_LISTENER_THREADS,
+		   CONFIG_ZBUS_ASYNC_LISTENER_STACK_SIZE);
+
+void z_zbus_async_listener_work(struct k_work *work)
+{
+	struct zbus_async_listener *listener = CONTAINER_OF(work, struct zbus_async_listener, work);
+	k_tid_t thread = k_current_get();
+	int prio = k_thread_priority_get(thread);
+	struct net_buf *buf;
+
+	k_thread_priority_set(thread, listener->priority);
+
+	/* The pool never runs the work item on two threads at once, which keeps the messages of
+	 * a listener in order. Messages queued meanwhile are handled by this run or the next one.
+	 */
+	while ((buf = k_fifo_get(&listener->fifo, K_NO_WAIT)) != NULL) {
+		const struct zbus_channel *chan = *((struct zbus_channel **)net_buf_user_data(buf));
+
+		listener->callback(chan, buf->data);
+
+#if defined(CONFIG_ZBUS_REF_CHANNEL)
+		if (chan->data->is_ref) {
+			struct net_buf *payload;
+
+			memcpy(&payload, buf->data, sizeof(payload));
+			net_buf_unref(payload);
+		}
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+
+		net_buf_unref(buf);
+	}
+
+	k_thread_priority_set(thread, prio);
+}
+
+static int _zbus_async_listener_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "zbus_async",
+		.pin_cpus = IS_ENABLED(CONFIG_ZBUS_ASYNC_LISTENER_CPU_PIN),
+	};
+
+	k_work_pool_start(&_zbus_async_listener_pool, CONFIG_ZBUS_ASYNC_LISTENER_PRIORITY, &cfg);
+
+	return 0;
+}
+SYS_INIT(_zbus_async_listener_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 int _zbus_init(void)
 {
 
@@ -135,6 +188,9 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 		return k_msgq_put(obs->queue, &chan, sys_timepoint_timeout(end_time));
 	}
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	case ZBUS_OBSERVER_ASYNC_LISTENER_TYPE:
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
 		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
 
@@ -142,6 +198,25 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 			return -ENOMEM;
 		}
 
+#if defined(CONFIG_ZBUS_REF_CHANNEL)
+		/* The message subscriber gets its own reference to the payload */
+		if (chan->data->is_ref) {
+			struct net_buf *payload;
+
+			memcpy(&payload, cloned_buf->data, sizeof(payload));
+			net_buf_ref(payload);
+		}
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+		if (obs->type == ZBUS_OBSERVER_ASYNC_LISTENER_TYPE) {
+			k_fifo_put(&obs->async_listener->fifo, cloned_buf);
+			(void)k_work_submit_to_queue(k_work_pool_queue(&_zbus_async_listener_pool),
+						     &obs->async_listener->work);
+			break;
+		}
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 		k_fifo_put(obs->message_fifo, cloned_buf);
 
 		break;
@@ -374,12 +449,66 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+static inline bool chan_is_ref(const struct zbus_channel *chan)
+{
+#if defined(CONFIG_ZBUS_REF_CHANNEL)
+	return chan->data->is_ref;
+#else
+	return false;
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+}
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+/* Called with the channel locked, so there is a single writer. Each increment of the
+ * sequence switches the readers to the copy that is not updated next.
+ */
+static inline void chan_update_latch(const struct zbus_channel *chan)
+{
+	uint8_t *latch = chan->data->latch;
+
+	if (latch == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < 2; i++) {
+		atomic_val_t seq = atomic_inc(&chan->data->seq) + 1;
+
+		barrier_dmem_fence_full();
+		memcpy(latch + ((seq & 1) ^ 1) * chan->message_size, chan->message,
+		       chan->message_size);
+		barrier_dmem_fence_full();
+	}
+}
+
+static inline void chan_read_latch(const struct zbus_channel *chan, void *msg)
+{
+	const uint8_t *latch = chan->data->latch;
+	atomic_val_t seq;
+
+	do {
+		seq = atomic_get(&chan->data->seq);
+		barrier_dmem_fence_full();
+		memcpy(msg, latch + (seq & 1) * chan->message_size, chan->message_size);
+		barrier_dmem_fence_full();
+	} while (atomic_get(&chan->data->seq) != seq);
+}
+
+#else
+
+static inline void chan_update_latch(const struct zbus_channel *chan)
+{
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
 
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(!chan_is_ref(chan), "reference channels require zbus_chan_pub_ref");
 	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
 		     "inside an ISR, the timeout must be K_NO_WAIT");
 
@@ -407,6 +536,8 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	memcpy(chan->message, msg, chan->message_size);
 
+	chan_update_latch(chan);
+
 	err = _zbus_vded_exec(chan, end_time);
 
 	chan_unlock(chan, context_priority);
@@ -418,9 +549,18 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(!chan_is_ref(chan), "reference channels require zbus_chan_ref_get");
 	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
 		     "inside an ISR, the timeout must be K_NO_WAIT");
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	if (chan->data->latch != NULL) {
+		chan_read_latch(chan, msg);
+
+		return 0;
+	}
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	if (k_is_in_isr()) {
 		timeout = K_NO_WAIT;
 	}
@@ -437,6 +577,89 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	return 0;
 }
 
+#if defined(CONFIG_ZBUS_REF_CHANNEL)
+
+int zbus_chan_pub_ref(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf **msg;
+	struct net_buf *prev;
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+	_ZBUS_ASSERT(chan_is_ref(chan), "chan must be a reference channel");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	if (chan->validator != NULL && !chan->validator(buf->data, buf->len)) {
+		return -ENOMSG;
+	}
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		return err;
+	}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	/* Only the reference is published, the channel keeps the caller's one */
+	msg = chan->message;
+	prev = *msg;
+	*msg = buf;
+
+	err = _zbus_vded_exec(chan, end_time);
+
+	chan_unlock(chan, context_priority);
+
+	if (prev != NULL) {
+		net_buf_unref(prev);
+	}
+
+	return err;
+}
+
+int zbus_chan_ref_get(const struct zbus_channel *chan, struct net_buf **buf, k_timeout_t timeout)
+{
+	struct net_buf *msg;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+	_ZBUS_ASSERT(chan_is_ref(chan), "chan must be a reference channel");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	int err = k_sem_take(&chan->data->sem, timeout);
+	if (err) {
+		return err;
+	}
+
+	msg = *(struct net_buf **)chan->message;
+	if (msg != NULL) {
+		*buf = net_buf_ref(msg);
+	}
+
+	k_sem_give(&chan->data->sem);
+
+	return (msg != NULL) ? 0 : -ENODATA;
+}
+
+#endif /* CONFIG_ZBUS_REF_CHANNEL */
+
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	int err;
@@ -488,6 +711,9 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	/* The message may have been changed while claimed */
+	chan_update_latch(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
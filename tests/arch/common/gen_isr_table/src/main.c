@@ -286,14 +286,24 @@ static int check_sw_isr(void *isr, uintptr_t arg, int offset)
 		TC_PRINT("expected %p got %p\n", (void *)isr, e->isr);
 		return -1;
 	}
-#if defined(CONFIG_GEN_IRQ_VECTOR_TABLE) && !defined(CONFIG_IRQ_VECTOR_TABLE_JUMP_BY_CODE)
+#if defined(CONFIG_GEN_IRQ_TRAMPOLINES)
+	uintptr_t v = _irq_vector_table[TABLE_INDEX(offset)];
+	uintptr_t trampoline = (uintptr_t)&_irq_trampolines +
+			       TABLE_INDEX(offset) * ARCH_IRQ_TRAMPOLINE_SIZE;
+
+	if (v != trampoline) {
+		TC_PRINT("Vector does not point to the IRQ trampoline\n");
+		TC_PRINT("expected %p got %p\n", (void *)trampoline, (void *)v);
+		return -1;
+	}
+#elif defined(CONFIG_GEN_IRQ_VECTOR_TABLE) && !defined(CONFIG_IRQ_VECTOR_TABLE_JUMP_BY_CODE)
 	void *v = (void *)_irq_vector_table[TABLE_INDEX(offset)];
 	if (v != _isr_wrapper) {
 		TC_PRINT("Vector does not point to _isr_wrapper\n");
 		TC_PRINT("expected %p got %p\n", _isr_wrapper, v);
 		return -1;
 	}
-#endif /* CONFIG_GEN_IRQ_VECTOR_TABLE && !CONFIG_IRQ_VECTOR_TABLE_JUMP_BY_CODE */
+#endif /* CONFIG_GEN_IRQ_TRAMPOLINES */
 
 	if (test_irq(offset)) {
 		return -1;
@@ -0,0 +1,70 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/boot_timeline.h>
+
+static const char *const level_names[] = {
+	"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP",
+};
+
+static uint32_t level_time[ARRAY_SIZE(level_names)];
+
+static uint32_t cyc_to_us(const struct boot_timeline *timeline, uint32_t cycles)
+{
+	return (uint32_t)(((uint64_t)cycles * USEC_PER_SEC) / MAX(timeline->cycles_per_sec, 1U));
+}
+
+static void record(const char *level, const char *name, uint32_t start_us, uint32_t time_us,
+		   int result)
+{
+	printk("RECORD: {\"level\":\"%s\", \"name\":\"%s\", \"start_us\":%u, \"time_us\":%u"
+	       ", \"result\":%d}\n", level, name, start_us, time_us, result);
+}
+
+int main(void)
+{
+	const struct boot_timeline *timeline = boot_timeline_get();
+	uint32_t count = MIN((uint32_t)atomic_get(&timeline->count), timeline->capacity);
+	char name[2 + 2 * sizeof(void *) + 1];
+
+	for (uint32_t i = 0; i < count; i++) {
+		const struct boot_timeline_entry *entry = &timeline->entries[i];
+		uint32_t time = entry->end - entry->start;
+
+		if (entry->level >= ARRAY_SIZE(level_names)) {
+			continue;
+		}
+
+		level_time[entry->level] += time;
+
+		if (entry->dev == NULL) {
+			snprintk(name, sizeof(name), "%p", entry->init_fn);
+		}
+
+		record(level_names[entry->level], (entry->dev != NULL) ? entry->dev->name : name,
+		       cyc_to_us(timeline, entry->start), cyc_to_us(timeline, time),
+		       entry->result);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(level_names); i++) {
+		if (level_time[i] != 0) {
+			record("level", level_names[i], 0, cyc_to_us(timeline, level_time[i]), 0);
+		}
+	}
+
+	record("total", "main", 0, cyc_to_us(timeline, timeline->main_cycles), 0);
+
+	if (atomic_get(&timeline->count) > timeline->capacity) {
+		printk("%u initializations not recorded\n",
+		       (uint32_t)atomic_get(&timeline->count) - timeline->capacity);
+	}
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+
+	return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief sys_btree against rbtree benchmark
+ *
+ * Inserts the same items in a red/black tree and in a B+ tree, walks them in
+ * order, looks each of them up, removes them in random order and finally
+ * drains refilled trees from their minimum, reporting the average number of
+ * cycles per operation.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/btree.h>
+#include <zephyr/sys/rb.h>
+#include <zephyr/ztest.h>
+
+#define NUM_ITEMS 1024
+
+struct item {
+	struct rbnode node;
+	uint32_t key;
+};
+
+static struct item items[NUM_ITEMS];
+static uint16_t order[NUM_ITEMS];
+
+/* Keeps the in-order walks from being optimized out */
+static volatile uint32_t walk_sum;
+
+static bool item_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct item *ia = CONTAINER_OF(a, struct item, node);
+	struct item *ib = CONTAINER_OF(b, struct item, node);
+
+	return ia->key < ib->key || (ia->key == ib->key && ia < ib);
+}
+
+static int item_cmp(const void *a, const void *b)
+{
+	const struct item *ia = a;
+	const struct item *ib = b;
+
+	return (ia->key > ib->key) - (ia->key < ib->key);
+}
+
+static struct rbtree rb_tree = {
+	.lessthan_fn = item_lessthan,
+};
+
+SYS_BTREE_DEFINE(bt_tree, NUM_ITEMS, item_cmp);
+
+static uint32_t per_op(uint32_t start, uint32_t ops)
+{
+	return (k_cycle_get_32() - start) / ops;
+}
+
+/* Simple LCG, the same sequence on every run */
+static uint32_t next_random(uint32_t *state)
+{
+	*state = *state * 1103515245U + 12345U;
+
+	return *state >> 8;
+}
+
+static void *perf_setup(void)
+{
+	uint32_t seed = 1;
+
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		items[i].key = next_random(&seed);
+		order[i] = i;
+	}
+
+	/* Fisher-Yates shuffle of the removal order */
+	for (uint32_t i = NUM_ITEMS - 1; i > 0; i--) {
+		uint32_t j = next_random(&seed) % (i + 1);
+		uint16_t tmp = order[i];
+
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+
+	return NULL;
+}
+
+ZTEST(btree_perf, test_rbtree)
+{
+	uint32_t insert, walk, find, remove, pop;
+	uint32_t start;
+	struct rbnode *node;
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		rb_insert(&rb_tree, &items[i].node);
+	}
+	insert = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	RB_FOR_EACH(&rb_tree, node) {
+		walk_sum += CONTAINER_OF(node, struct item, node)->key;
+	}
+	walk = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		zassert_true(rb_contains(&rb_tree, &items[i].node), "item not found");
+	}
+	find = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		rb_remove(&rb_tree, &items[order[i]].node);
+	}
+	remove = per_op(start, NUM_ITEMS);
+
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		rb_insert(&rb_tree, &items[i].node);
+	}
+
+	start = k_cycle_get_32();
+	while ((node = rb_get_min(&rb_tree)) != NULL) {
+		rb_remove(&rb_tree, node);
+	}
+	pop = per_op(start, NUM_ITEMS);
+
+	TC_PRINT("rbtree: %u items, cycles/op: insert %u, walk %u, find %u, remove %u, "
+		 "pop min %u\n",
+		 NUM_ITEMS, insert, walk, find, remove, pop);
+}
+
+ZTEST(btree_perf, test_btree)
+{
+	uint32_t insert, walk, find, remove, pop;
+	uint32_t start;
+	struct sys_btree_iter iter;
+	struct item *item;
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		zassert_ok(sys_btree_insert(&bt_tree, &items[i]), "insertion failed");
+	}
+	insert = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	SYS_BTREE_FOR_EACH(&bt_tree, iter, item) {
+		walk_sum += item->key;
+	}
+	walk = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		zassert_not_null(sys_btree_find(&bt_tree, &items[i], NULL), "item not found");
+	}
+	find = per_op(start, NUM_ITEMS);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		sys_btree_remove(&bt_tree, &items[order[i]]);
+	}
+	remove = per_op(start, NUM_ITEMS);
+
+	for (uint32_t i = 0; i < NUM_ITEMS; i++) {
+		zassert_ok(sys_btree_insert(&bt_tree, &items[i]), "insertion failed");
+	}
+
+	start = k_cycle_get_32();
+	while (sys_btree_pop_min(&bt_tree) != NULL) {
+	}
+	pop = per_op(start, NUM_ITEMS);
+
+	TC_PRINT("btree (%u items/node): %u items, cycles/op: insert %u, walk %u, find %u, "
+		 "remove %u, pop min %u\n",
+		 SYS_BTREE_NODE_ITEMS, NUM_ITEMS, insert, walk, find, remove, pop);
+}
+
+ZTEST_SUITE(btree_perf, NULL, perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,107 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief sys_hashmap throughput benchmark
+ *
+ * Fills each Hashmap implementation with the same keys, then looks up keys
+ * that are present and keys that are not, removes half of the entries and
+ * looks them up again, reporting the average number of cycles per operation.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/ztest.h>
+
+#define NUM_ENTRIES   1024
+#define LOOKUP_ROUNDS 4
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_SWISS_DEFINE_STATIC(swiss_map);
+
+/* Spread the keys, as identifiers and addresses usually are */
+static inline uint64_t key_of(uint32_t i)
+{
+	return (uint64_t)i * 2654435761U;
+}
+
+static uint32_t per_op(uint32_t start, uint32_t ops)
+{
+	return (k_cycle_get_32() - start) / ops;
+}
+
+static void hashmap_perf(const char *name, struct sys_hashmap *map)
+{
+	uint32_t insert, hit, miss, remove, hit_after_remove;
+	uint32_t start;
+	uint64_t value;
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+		zassert_equal(sys_hashmap_insert(map, key_of(i), i, NULL), 1,
+			      "%s: insertion failed", name);
+	}
+	insert = per_op(start, NUM_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (uint32_t round = 0; round < LOOKUP_ROUNDS; round++) {
+		for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+			zassert_true(sys_hashmap_get(map, key_of(i), &value) && value == i,
+				     "%s: key not found", name);
+		}
+	}
+	hit = per_op(start, LOOKUP_ROUNDS * NUM_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (uint32_t round = 0; round < LOOKUP_ROUNDS; round++) {
+		for (uint32_t i = NUM_ENTRIES; i < 2 * NUM_ENTRIES; i++) {
+			zassert_false(sys_hashmap_get(map, key_of(i), NULL),
+				      "%s: unexpected key found", name);
+		}
+	}
+	miss = per_op(start, LOOKUP_ROUNDS * NUM_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < NUM_ENTRIES; i += 2) {
+		zassert_true(sys_hashmap_remove(map, key_of(i), NULL), "%s: removal failed",
+			     name);
+	}
+	remove = per_op(start, NUM_ENTRIES / 2);
+
+	/* Lookups left to go past the removed entries, or their tombstones */
+	start = k_cycle_get_32();
+	for (uint32_t round = 0; round < LOOKUP_ROUNDS; round++) {
+		for (uint32_t i = 1; i < NUM_ENTRIES; i += 2) {
+			zassert_true(sys_hashmap_get(map, key_of(i), NULL), "%s: key not found",
+				     name);
+		}
+	}
+	hit_after_remove = per_op(start, LOOKUP_ROUNDS * NUM_ENTRIES / 2);
+
+	TC_PRINT("%s: %u entries, cycles/op: insert %u, hit %u, miss %u, remove %u, "
+		 "hit after remove %u\n",
+		 name, NUM_ENTRIES, insert, hit, miss, remove, hit_after_remove);
+
+	sys_hashmap_clear(map, NULL, NULL);
+}
+
+ZTEST(hashmap_perf, test_separate_chaining)
+{
+	hashmap_perf("separate chaining", &sc_map);
+}
+
+ZTEST(hashmap_perf, test_open_addressing_linear_probe)
+{
+	hashmap_perf("open addressing / linear probe", &oa_lp_map);
+}
+
+ZTEST(hashmap_perf, test_swiss_table)
+{
+	hashmap_perf("swiss table", &swiss_map);
+}
+
+ZTEST_SUITE(hashmap_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,120 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief k_heap and k_malloc() throughput benchmark
+ *
+ * Runs the sys_heap_stress() rig on a k_heap, as well as small block
+ * k_malloc()/k_free() loops from one thread per CPU, and reports the
+ * average number of cycles per operation, to compare heap configurations
+ * such as CONFIG_HEAP_CACHE.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/ztest.h>
+
+#define HEAP_SIZE 8192
+#define STRESS_OPS 20000
+#define SMALL_ROUNDS 2000
+#define SMALL_BLOCKS 8
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_HEAP_DEFINE(perf_heap, HEAP_SIZE);
+
+static uint8_t scratch[HEAP_SIZE / 2];
+
+/* Typical small object sizes, such as JSON nodes and HTTP headers */
+static const size_t small_sizes[SMALL_BLOCKS] = { 12, 24, 16, 40, 64, 20, 96, 32 };
+
+K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static struct k_thread threads[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t thread_cycles[CONFIG_MP_MAX_NUM_CPUS];
+
+static void *heap_alloc(void *arg, size_t bytes)
+{
+	return k_heap_alloc(arg, bytes, K_NO_WAIT);
+}
+
+static void heap_free(void *arg, void *p)
+{
+	k_heap_free(arg, p);
+}
+
+ZTEST(heap_perf, test_k_heap_stress)
+{
+	struct z_heap_stress_result result;
+	uint32_t start, cycles;
+	uint64_t ops;
+
+	start = k_cycle_get_32();
+	sys_heap_stress(heap_alloc, heap_free, &perf_heap, HEAP_SIZE, STRESS_OPS,
+			scratch, sizeof(scratch), 50, &result);
+	cycles = k_cycle_get_32() - start;
+
+	ops = result.total_allocs + result.total_frees;
+	zassert_true(result.successful_allocs > 0);
+
+	TC_PRINT("k_heap stress: %u allocs (%u ok), %u frees, %llu cycles/op\n",
+		 result.total_allocs, result.successful_allocs, result.total_frees,
+		 (uint64_t)cycles / ops);
+}
+
+static uint32_t small_blocks_loop(void)
+{
+	void *blocks[SMALL_BLOCKS];
+	uint32_t start = k_cycle_get_32();
+
+	for (int round = 0; round < SMALL_ROUNDS; round++) {
+		for (int i = 0; i < SMALL_BLOCKS; i++) {
+			blocks[i] = k_malloc(small_sizes[i]);
+			zassert_not_null(blocks[i], "k_malloc(%zu) failed", small_sizes[i]);
+		}
+		for (int i = SMALL_BLOCKS - 1; i >= 0; i--) {
+			k_free(blocks[i]);
+		}
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static void small_blocks_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	thread_cycles[POINTER_TO_UINT(p1)] = small_blocks_loop();
+}
+
+ZTEST(heap_perf, test_k_malloc_small)
+{
+	uint32_t cycles = small_blocks_loop();
+
+	TC_PRINT("k_malloc small blocks: %u cycles/op\n",
+		 cycles / (SMALL_ROUNDS * SMALL_BLOCKS * 2));
+}
+
+ZTEST(heap_perf, test_k_malloc_small_concurrent)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint64_t cycles = 0;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				small_blocks_entry, UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		cycles += thread_cycles[i];
+	}
+
+	TC_PRINT("k_malloc small blocks, %u threads: %llu cycles/op\n", num_cpus,
+		 cycles / ((uint64_t)num_cpus * SMALL_ROUNDS * SMALL_BLOCKS * 2));
+}
+
+ZTEST_SUITE(heap_perf, NULL, NULL, NULL, NULL, NULL);
@@ -85,6 +85,7 @@ void report(void)
 {
 	unsigned int elapsed_time = IPI_TEST_INTERVAL_DURATION;
 	unsigned long total_preempt;
+	unsigned long total_wakes;
 	unsigned long total_work;
 	unsigned long last_work_counter[NUM_WORK_THREADS] = {};
 	unsigned long last_preempt[NUM_PREEMPTIVE_THREADS] = {};
@@ -92,6 +93,7 @@ void report(void)
 	unsigned long tmp_preempt[NUM_PREEMPTIVE_THREADS] = {};
 	unsigned int i;
 	unsigned int tmp_ipi_counter;
+	unsigned long long ipis_per_wake;
 
 	atomic_set(&ipi_counter, 0);
 
@@ -109,11 +111,18 @@ void report(void)
 			total_work += (tmp_work_counter[i] - last_work_counter[i]);
 		}
 
-		/* Sum the preemptive counters. */
+		/*
+		 * Sum the preemptive counters. Every thread but the last
+		 * one wakes up the next thread once per iteration.
+		 */
 		total_preempt = 0;
+		total_wakes = 0;
 		for (i = 0; i < NUM_PREEMPTIVE_THREADS; i++) {
 			tmp_preempt[i] = preemptive_counter[i];
 			total_preempt += (tmp_preempt[i] - last_preempt[i]);
+			if (i != (NUM_PREEMPTIVE_THREADS - 1)) {
+				total_wakes += (tmp_preempt[i] - last_preempt[i]);
+			}
 		}
 
 		tmp_ipi_counter = (unsigned int)atomic_set(&ipi_counter, 0);
@@ -130,6 +139,12 @@ void report(void)
 
 		printf("  IPI Count: %u\n", tmp_ipi_counter);
 
+		/* In thousandths, to avoid floating point */
+		ipis_per_wake = (tmp_ipi_counter * 1000ULL) / MAX(total_wakes, 1UL);
+		printf("  IPIs per Wake: %u.%03u\n",
+		       (unsigned int)(ipis_per_wake / 1000U),
+		       (unsigned int)(ipis_per_wake % 1000U));
+
 		printf("  Total Work: %lu\n", total_work);
 
 		for (i = 0; i < NUM_WORK_THREADS; i++) {
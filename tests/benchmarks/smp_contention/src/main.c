@@ -0,0 +1,247 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+#error "Test requires a system with more than 1 CPU"
+#endif
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define ITERATIONS  CONFIG_BENCHMARK_CONTENTION_ITERATIONS
+#define STACK_SIZE  2048
+
+#define HEAP_BLOCK_SIZE 32
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+/* Cycles taken by each operation, sorted in place once a scenario is done */
+static uint32_t latency[NUM_THREADS][ITERATIONS];
+
+static atomic_t ready_count;
+static atomic_t done_count;
+static atomic_t go;
+static uint32_t begin_cycles;
+static uint32_t end_cycles;
+
+static atomic_t ipi_counter;
+
+void z_trace_sched_ipi(void)
+{
+	atomic_inc(&ipi_counter);
+}
+
+K_SEM_DEFINE(sem, 1, 1);
+K_MUTEX_DEFINE(mutex);
+K_MSGQ_DEFINE(msgq, sizeof(uint32_t), NUM_THREADS, sizeof(uint32_t));
+K_PIPE_DEFINE(pipe, NUM_THREADS * sizeof(uint32_t), 4);
+K_MEM_SLAB_DEFINE(slab, 32, NUM_THREADS, 4);
+K_HEAP_DEFINE(heap, NUM_THREADS * (HEAP_BLOCK_SIZE + 32) + 256);
+
+static struct k_work work[NUM_THREADS];
+static struct k_work_sync work_sync[NUM_THREADS];
+static struct k_timer timers[NUM_THREADS];
+static struct k_spinlock spinlock;
+static uint32_t spinlock_counter;
+
+static void sem_op(unsigned int id)
+{
+	k_sem_take(&sem, K_FOREVER);
+	k_sem_give(&sem);
+}
+
+static void mutex_op(unsigned int id)
+{
+	k_mutex_lock(&mutex, K_FOREVER);
+	k_mutex_unlock(&mutex);
+}
+
+static void msgq_op(unsigned int id)
+{
+	uint32_t data = id;
+
+	k_msgq_put(&msgq, &data, K_FOREVER);
+	k_msgq_get(&msgq, &data, K_FOREVER);
+}
+
+static void pipe_op(unsigned int id)
+{
+	uint32_t data = id;
+
+	k_pipe_write(&pipe, (const uint8_t *)&data, sizeof(data), K_FOREVER);
+	k_pipe_read(&pipe, (uint8_t *)&data, sizeof(data), K_FOREVER);
+}
+
+static void mem_slab_op(unsigned int id)
+{
+	void *block;
+
+	if (k_mem_slab_alloc(&slab, &block, K_FOREVER) == 0) {
+		k_mem_slab_free(&slab, block);
+	}
+}
+
+static void heap_op(unsigned int id)
+{
+	void *block = k_heap_alloc(&heap, HEAP_BLOCK_SIZE, K_FOREVER);
+
+	k_heap_free(&heap, block);
+}
+
+static void spinlock_op(unsigned int id)
+{
+	K_SPINLOCK(&spinlock) {
+		spinlock_counter++;
+	}
+}
+
+/* Each thread uses its own timer, but they all share the timeout lock */
+static void timer_op(unsigned int id)
+{
+	k_timer_start(&timers[id], K_SECONDS(10), K_NO_WAIT);
+	k_timer_stop(&timers[id]);
+}
+
+static void work_handler(struct k_work *item)
+{
+	ARG_UNUSED(item);
+}
+
+/* Round trip through the system work queue, which is shared by all threads */
+static void work_op(unsigned int id)
+{
+	k_work_submit(&work[id]);
+	k_work_flush(&work[id], &work_sync[id]);
+}
+
+static const struct scenario {
+	const char *name;
+	void (*op)(unsigned int id);
+} scenarios[] = {
+	{"k_sem", sem_op},
+	{"k_mutex", mutex_op},
+	{"k_msgq", msgq_op},
+	{"k_pipe", pipe_op},
+	{"k_mem_slab", mem_slab_op},
+	{"k_heap", heap_op},
+	{"k_work", work_op},
+	{"k_spinlock", spinlock_op},
+	{"k_timer", timer_op},
+};
+
+static void contention_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+	const struct scenario *scenario = p2;
+	timing_t start, end;
+
+	ARG_UNUSED(p3);
+
+	/* The last thread to arrive releases all the others */
+	if (atomic_inc(&ready_count) == NUM_THREADS - 1) {
+		begin_cycles = k_cycle_get_32();
+		atomic_set(&go, 1);
+	}
+
+	while (atomic_get(&go) == 0) {
+		arch_spin_relax();
+	}
+
+	for (unsigned int i = 0; i < ITERATIONS; i++) {
+		start = timing_counter_get();
+		scenario->op(id);
+		end = timing_counter_get();
+
+		latency[id][i] = (uint32_t)timing_cycles_get(&start, &end);
+	}
+
+	if (atomic_inc(&done_count) == NUM_THREADS - 1) {
+		end_cycles = k_cycle_get_32();
+	}
+}
+
+static int latency_compare(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Latency in nanoseconds below which the given share (per 10000) of operations completed */
+static uint32_t percentile_ns(const uint32_t *sorted, size_t count, unsigned int per10k)
+{
+	size_t index = MIN((count * per10k) / 10000U, count - 1);
+
+	return (uint32_t)timing_cycles_to_ns(sorted[index]);
+}
+
+static void run_scenario(const struct scenario *scenario)
+{
+	const size_t count = NUM_THREADS * ITERATIONS;
+	uint32_t *samples = &latency[0][0];
+	uint64_t elapsed_ns;
+	uint64_t ops_per_sec;
+	uint32_t ipis;
+
+	atomic_set(&ready_count, 0);
+	atomic_set(&done_count, 0);
+	atomic_set(&go, 0);
+	atomic_set(&ipi_counter, 0);
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, contention_entry,
+				UINT_TO_POINTER(i), (void *)scenario, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		k_thread_cpu_pin(&threads[i], i);
+		k_thread_start(&threads[i]);
+	}
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	ipis = (uint32_t)atomic_get(&ipi_counter);
+	elapsed_ns = MAX(k_cyc_to_ns_floor64(end_cycles - begin_cycles), 1);
+	ops_per_sec = ((uint64_t)count * NSEC_PER_SEC) / elapsed_ns;
+
+	qsort(samples, count, sizeof(samples[0]), latency_compare);
+
+	printk("RECORD: {\"primitive\":\"%s\", \"threads\":%u, \"operations\":%u"
+	       ", \"ops_per_sec\":%u, \"p50_ns\":%u, \"p99_ns\":%u, \"p999_ns\":%u"
+	       ", \"max_ns\":%u, \"ipis\":%u}\n",
+	       scenario->name, NUM_THREADS, (uint32_t)count, (uint32_t)ops_per_sec,
+	       percentile_ns(samples, count, 5000), percentile_ns(samples, count, 9900),
+	       percentile_ns(samples, count, 9990), percentile_ns(samples, count, 10000),
+	       ipis);
+}
+
+int main(void)
+{
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_work_init(&work[i], work_handler);
+		k_timer_init(&timers[i], NULL, NULL);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("SMP contention benchmark: %u threads, %u operations each\n",
+	       NUM_THREADS, ITERATIONS);
+
+	for (size_t i = 0; i < ARRAY_SIZE(scenarios); i++) {
+		run_scenario(&scenarios[i]);
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+
+	return 0;
+}
@@ -421,6 +421,56 @@ ZTEST(test_gatt, test_gatt_foreach)
 	}
 }
 
+static uint8_t check_attr_handle(const struct bt_gatt_attr *attr, uint16_t handle,
+				 void *user_data)
+{
+	uint16_t *count = user_data;
+
+	zassert_equal(bt_gatt_attr_get_handle(attr), handle, "Attribute handle don't match");
+
+	(*count)++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+ZTEST(test_gatt, test_gatt_foreach_static)
+{
+	uint16_t static_count = 0;
+	uint16_t primary_count = 0;
+	uint16_t num = 0;
+
+	/* Make sure the static services are initialized */
+	(void)bt_gatt_service_register(&test_svc);
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
+		for (size_t i = 0; i < svc->attr_count; i++) {
+			if (!bt_uuid_cmp(svc->attrs[i].uuid, BT_UUID_GATT_PRIMARY)) {
+				primary_count++;
+			}
+		}
+
+		static_count += svc->attr_count;
+	}
+
+	/* Iterate each attribute on its own, starting within the services */
+	for (uint16_t handle = 1; handle <= static_count; handle++) {
+		bt_gatt_foreach_attr(handle, handle, check_attr_handle, &num);
+	}
+	zassert_equal(num, static_count, "Number of attributes don't match");
+
+	/* Find all primary services */
+	num = 0;
+	bt_gatt_foreach_attr_type(0x0001, static_count, BT_UUID_GATT_PRIMARY, NULL, 0,
+				  count_attr, &num);
+	zassert_equal(num, primary_count, "Number of attributes don't match");
+
+	/* Find an attribute type the static services don't have */
+	num = 0;
+	bt_gatt_foreach_attr_type(0x0001, static_count, &test_chrc_uuid.uuid, NULL, 0,
+				  count_attr, &num);
+	zassert_equal(num, 0, "Number of attributes don't match");
+}
+
 ZTEST(test_gatt, test_gatt_read)
 {
 	const struct bt_gatt_attr *attr;
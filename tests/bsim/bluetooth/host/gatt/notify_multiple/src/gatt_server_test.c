@@ -110,6 +110,9 @@ static void notification_sent(struct bt_conn *conn, void *user_data)
 	printk("Sent notification #%u\n", num_notifications_sent++);
 }
 
+/* Notify all the connected clients instead of g_conn */
+static bool notify_all;
+
 static inline void multiple_notify(const struct bt_gatt_attr *attrs[2])
 {
 	int err;
@@ -131,7 +134,8 @@ static inline void multiple_notify(const struct bt_gatt_attr *attrs[2])
 	params[1].attr = attrs[1];
 
 	do {
-		err = bt_gatt_notify_multiple(g_conn, ARRAY_SIZE(params), params);
+		err = bt_gatt_notify_multiple(notify_all ? NULL : g_conn, ARRAY_SIZE(params),
+					      params);
 
 		if (err == -ENOMEM) {
 			k_sleep(K_MSEC(10));
@@ -191,11 +195,21 @@ static void test_main(void)
 	TEST_PASS("GATT server passed");
 }
 
+static void test_main_all(void)
+{
+	notify_all = true;
+	test_main();
+}
+
 static const struct bst_test_instance test_gatt_server[] = {
 	{
 		.test_id = "gatt_server",
 		.test_main_f = test_main,
 	},
+	{
+		.test_id = "gatt_server_all",
+		.test_main_f = test_main_all,
+	},
 	BSTEST_END_MARKER,
 };
 
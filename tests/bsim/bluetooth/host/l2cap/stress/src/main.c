@@ -207,6 +207,25 @@ static void seg_recv_cb(struct bt_l2cap_chan *chan, size_t sdu_len, off_t seg_of
 	}
 }
 #else /* CONFIG_BT_L2CAP_SEG_RECV */
+#ifdef CONFIG_BT_L2CAP_RX_ZERO_COPY
+int recv_cb(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	size_t offset = 0;
+
+	LOG_DBG("len %zu", net_buf_frags_len(buf));
+	sdu_rx_cnt++;
+
+	/* The segments are fragments of the SDU buffer */
+	for (struct net_buf *frag = buf; frag != NULL; frag = frag->frags) {
+		TEST_ASSERT(offset + frag->len <= sizeof(tx_data), "RX data too long");
+		TEST_ASSERT(memcmp(frag->data, &tx_data[offset], frag->len) == 0,
+			    "RX data doesn't match TX at offset %zu", offset);
+		offset += frag->len;
+	}
+
+	return 0;
+}
+#else
 int recv_cb(struct bt_l2cap_chan *chan, struct net_buf *buf)
 {
 	LOG_DBG("len %d", buf->len);
@@ -229,6 +248,7 @@ int recv_cb(struct bt_l2cap_chan *chan, struct net_buf *buf)
 
 	return 0;
 }
+#endif /* CONFIG_BT_L2CAP_RX_ZERO_COPY */
 #endif /* CONFIG_BT_L2CAP_SEG_RECV */
 
 void l2cap_chan_connected_cb(struct bt_l2cap_chan *l2cap_chan)
@@ -323,6 +343,9 @@ int server_accept_cb(struct bt_conn *conn, struct bt_l2cap_server *server,
 #ifdef CONFIG_BT_L2CAP_SEG_RECV
 	le_chan->rx.mps = BT_L2CAP_RX_MTU;
 	le_chan->rx.credits = CONFIG_BT_BUF_ACL_RX_COUNT_EXTRA;
+#endif
+#ifdef CONFIG_BT_L2CAP_RX_ZERO_COPY
+	le_chan->rx_zero_copy = true;
 #endif
 	*chan = &le_chan->chan;
 
@@ -577,6 +600,9 @@ static void connect_l2cap_channel(struct bt_conn *conn, void *data)
 	le_chan->rx.mps = BT_L2CAP_RX_MTU;
 	le_chan->rx.credits = CONFIG_BT_BUF_ACL_RX_COUNT_EXTRA;
 #endif
+#ifdef CONFIG_BT_L2CAP_RX_ZERO_COPY
+	le_chan->rx_zero_copy = true;
+#endif
 
 	UNSET_FLAG(flag_l2cap_connected);
 
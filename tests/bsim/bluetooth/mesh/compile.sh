@@ -18,6 +18,7 @@ app=tests/bsim/bluetooth/mesh conf_overlay=overlay_low_lat.conf compile
 app=tests/bsim/bluetooth/mesh conf_overlay=overlay_workq_sys.conf compile
 app=tests/bsim/bluetooth/mesh conf_overlay=overlay_multi_adv_sets.conf compile
 app=tests/bsim/bluetooth/mesh conf_overlay=overlay_lpn_scan_on.conf compile
+app=tests/bsim/bluetooth/mesh conf_overlay=overlay_net_index.conf compile
 app=tests/bsim/bluetooth/mesh conf_overlay="overlay_gatt.conf;overlay_workq_sys.conf" compile
 app=tests/bsim/bluetooth/mesh conf_overlay="overlay_gatt.conf;overlay_low_lat.conf" compile
 app=tests/bsim/bluetooth/mesh conf_overlay="overlay_pst.conf;overlay_gatt.conf" compile
@@ -0,0 +1,12 @@
+#!/usr/bin/env bash
+# Copyright The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+source $(dirname "${BASH_SOURCE[0]}")/../../_mesh_test.sh
+
+# Same as brg_net_key_refresh.sh, with the network keys indexed by NID and the
+# hashed network message cache, to verify that the index follows the key
+# changes of several subnets.
+overlay=overlay_net_index_conf
+RunTest mesh_brg_net_key_refresh_net_index \
+	brg_tester_key_refresh brg_bridge_simple brg_device_simple
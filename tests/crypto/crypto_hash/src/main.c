@@ -8,6 +8,9 @@
 #include <zephyr/crypto/crypto.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_CRYPTO_RTIO
+#include <zephyr/crypto/rtio.h>
+#endif
 
 #ifdef CONFIG_CRYPTO_MBEDTLS_SHIM
 #define CRYPTO_DRV_NAME CONFIG_CRYPTO_MBEDTLS_SHIM_DRV_NAME
@@ -307,4 +310,62 @@ ZTEST(crypto_hash, test_sha512)
 		       (const uint8_t *const *)sha512_results_ptrs, 7);
 }
 
+#ifdef CONFIG_CRYPTO_RTIO
+CRYPTO_IODEV_DEFINE(hash_iodev);
+RTIO_DEFINE(hash_rtio, 8, 8);
+
+ZTEST(crypto_hash, test_sha256_rtio)
+{
+	const struct device *dev = get_crypto_dev();
+	struct hash_ctx ctx[ARRAY_SIZE(inputs)];
+	struct hash_pkt pkt[ARRAY_SIZE(inputs)];
+	struct crypto_rtio_req req[ARRAY_SIZE(inputs)];
+	uint8_t out[ARRAY_SIZE(inputs)][32];
+	struct rtio_cqe *cqe;
+	int rc;
+
+	zassert_true(dev && device_is_ready(dev), "Crypto device is not ready");
+
+	/* one session per vector, all of them submitted at once */
+	for (size_t i = 0; i < ARRAY_SIZE(inputs); i++) {
+		ctx[i] = (struct hash_ctx){.flags = CAP_SYNC_OPS | CAP_SEPARATE_IO_BUFS};
+		rc = hash_begin_session(dev, &ctx[i], CRYPTO_HASH_ALGO_SHA256);
+		if (rc == -ENOTSUP) {
+			ztest_test_skip();
+			return;
+		}
+		zassert_equal(rc, 0, "begin_session failed");
+
+		pkt[i] = (struct hash_pkt){
+			.in_buf = inputs[i],
+			.in_len = in_lens[i],
+			.out_buf = out[i],
+		};
+		req[i] = (struct crypto_rtio_req){
+			.op = CRYPTO_RTIO_OP_HASH_COMPUTE,
+			.hash = {.ctx = &ctx[i], .pkt = &pkt[i]},
+		};
+		crypto_rtio_prep(rtio_sqe_acquire(&hash_rtio), &hash_iodev, &req[i],
+				 (void *)(uintptr_t)i);
+	}
+
+	zassert_ok(rtio_submit(&hash_rtio, ARRAY_SIZE(inputs)));
+
+	for (size_t i = 0; i < ARRAY_SIZE(inputs); i++) {
+		size_t vec;
+
+		cqe = rtio_cqe_consume_block(&hash_rtio);
+		vec = (uintptr_t)cqe->userdata;
+		zassert_equal(cqe->result, 0, "request failed @vec %d", (int)vec + 1);
+		rtio_cqe_release(&hash_rtio, cqe);
+		zassert_mem_equal(out[vec], sha256_results[vec], 32, "digest mismatch @vec %d",
+				  (int)vec + 1);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(inputs); i++) {
+		hash_free_session(dev, &ctx[i]);
+	}
+}
+#endif /* CONFIG_CRYPTO_RTIO */
+
 ZTEST_SUITE(crypto_hash, NULL, NULL, NULL, NULL, NULL);
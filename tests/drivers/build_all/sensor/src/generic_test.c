@@ -73,6 +73,33 @@ static void before(void *args)
  *        Verifies that the device has a suitable emulator that implements the backend API and
  *        skips the test gracefully if not.
  */
+/* The batch decoding must give the same result as the frame decoding */
+static void check_decode_batch(const struct sensor_decoder_api *decoder, const uint8_t *buf,
+			       const struct sensor_three_axis_data *expected, int ch)
+{
+	struct sensor_chan_spec ch_spec = {.chan_type = ch, .chan_idx = 0};
+	uint32_t timestamp_delta;
+	q31_t x, y, z;
+	struct sensor_three_axis_batch batch = {
+		.timestamp_delta = &timestamp_delta,
+		.x = &x,
+		.y = &y,
+		.z = &z,
+	};
+	uint32_t fit = 0;
+	int rv;
+
+	rv = sensor_decode_batch(decoder, buf, ch_spec, &fit, 1, &batch);
+	zassert_equal(1, rv, "Could not batch decode (error %d, ch %d)", rv, ch);
+
+	zassert_equal(expected->header.base_timestamp_ns + expected->readings[0].timestamp_delta,
+		      batch.base_timestamp_ns + timestamp_delta);
+	zassert_equal(expected->shift, batch.shift);
+	zassert_equal(expected->readings[0].x, x);
+	zassert_equal(expected->readings[0].y, y);
+	zassert_equal(expected->readings[0].z, z);
+}
+
 static void run_generic_test(const struct device *dev)
 {
 	zassert_not_null(dev, "Cannot get device pointer. Is this driver properly instantiated?");
@@ -234,6 +261,12 @@ static void run_generic_test(const struct device *dev)
 				       expected_shifted, actual_shifted, shift, ch, iteration + 1,
 				       CONFIG_GENERIC_SENSOR_TEST_NUM_EXPECTED_VALS,
 				       expected_shifted - actual_shifted, epsilon_shifted);
+
+			if (ch == SENSOR_CHAN_ACCEL_XYZ || ch == SENSOR_CHAN_GYRO_XYZ ||
+			    ch == SENSOR_CHAN_MAGN_XYZ || ch == SENSOR_CHAN_POS_DXYZ) {
+				check_decode_batch(decoder, buf,
+						   &decoded_data.three_axis, ch);
+			}
 		}
 
 		/* Release the memory */
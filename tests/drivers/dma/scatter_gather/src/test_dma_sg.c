@@ -38,6 +38,7 @@ K_SEM_DEFINE(xfer_sem, 0, 1);
 
 static struct dma_config dma_cfg = {0};
 static struct dma_block_config dma_block_cfgs[XFERS];
+static int chan_id;
 
 static void dma_sg_callback(const struct device *dma_dev, void *user_data,
 			    uint32_t channel, int status)
@@ -53,7 +54,6 @@ static void dma_sg_callback(const struct device *dma_dev, void *user_data,
 static int test_sg(void)
 {
 	const struct device *dma;
-	static int chan_id;
 
 	TC_PRINT("DMA memory to memory transfer started\n");
 	TC_PRINT("Preparing DMA Controller\n");
@@ -158,3 +158,47 @@ ZTEST(dma_m2m_sg, test_dma_m2m_sg)
 {
 	zassert_true((test_sg() == TC_PASS));
 }
+
+#ifdef CONFIG_DMA_PREPARED
+/*
+ * Prepare the scatter-gather transfer once, then run it again and again,
+ * rotating the destination buffers of its blocks in between.
+ */
+ZTEST(dma_m2m_sg, test_dma_m2m_sg_prepared)
+{
+	const struct device *dma = DEVICE_DT_GET(DT_ALIAS(dma0));
+	struct dma_prepared *xfer;
+	int ret;
+
+	/* reuses the configuration built by test_sg() */
+	zassert_true((test_sg() == TC_PASS));
+
+	ret = dma_prepare(dma, chan_id, &dma_cfg, &xfer);
+	if (ret == -ENOSYS) {
+		ztest_test_skip();
+	}
+	zassert_ok(ret, "prepare failed");
+
+	for (int round = 1; round <= XFERS; round++) {
+		for (int i = 0; i < XFERS; i++) {
+			memset(rx_data[i], 0, CONFIG_DMA_SG_XFER_SIZE);
+			zassert_ok(dma_prepared_update(dma, xfer, i, (uintptr_t)tx_data,
+						       (uintptr_t)rx_data[(i + round) % XFERS],
+						       CONFIG_DMA_SG_XFER_SIZE / 2));
+		}
+
+		zassert_ok(dma_prepared_start(dma, xfer), "start failed in round %d", round);
+		zassert_ok(k_sem_take(&xfer_sem, K_MSEC(1000)), "timed out in round %d", round);
+
+		for (int i = 0; i < XFERS; i++) {
+			zassert_mem_equal(tx_data, rx_data[i], CONFIG_DMA_SG_XFER_SIZE / 2);
+			zassert_equal(rx_data[i][CONFIG_DMA_SG_XFER_SIZE / 2], 0,
+				      "block %d overran its size", i);
+		}
+	}
+
+	zassert_equal(dma_prepared_update(dma, xfer, XFERS, 0, 0, 0), -EINVAL);
+
+	dma_prepared_release(dma, xfer);
+}
+#endif /* CONFIG_DMA_PREPARED */
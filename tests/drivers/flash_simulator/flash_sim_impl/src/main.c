@@ -556,6 +556,55 @@ ZTEST(flash_sim_api, test_flash_flatten)
 #endif
 }
 
+#ifdef CONFIG_FLASH_ASYNC
+static K_SEM_DEFINE(async_done, 0, 1);
+static int async_result;
+static void *async_user_data;
+
+static void async_callback(struct flash_async_op *op, int result)
+{
+	async_user_data = op->user_data;
+	async_result = result;
+	k_sem_give(&async_done);
+}
+
+static int async_wait(void)
+{
+	zassert_ok(k_sem_take(&async_done, K_SECONDS(1)), "Operation did not complete");
+	zassert_equal_ptr(async_user_data, &async_result, "Unexpected user data");
+	return async_result;
+}
+
+ZTEST(flash_sim_api, test_async)
+{
+	struct flash_async_op op;
+	uint32_t data[4] = {0x01234567, 0x89abcdef, 0x76543210, 0xfedcba98};
+	uint32_t rd[ARRAY_SIZE(data)];
+	int rc;
+
+	flash_async_op_init(&op, async_callback, &async_result);
+
+	rc = flash_erase_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET,
+			       FLASH_SIMULATOR_ERASE_UNIT, &op);
+	zassert_equal(0, rc, "flash_erase_async should succeed");
+	zassert_equal(0, async_wait(), "erase should succeed");
+
+	rc = flash_write_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET, data, sizeof(data), &op);
+	zassert_equal(0, rc, "flash_write_async should succeed");
+	zassert_equal(0, async_wait(), "write should succeed");
+
+	rc = flash_read_async(flash_dev, FLASH_SIMULATOR_BASE_OFFSET, rd, sizeof(rd), &op);
+	zassert_equal(0, rc, "flash_read_async should succeed");
+	zassert_equal(0, async_wait(), "read should succeed");
+	zassert_mem_equal(rd, data, sizeof(data), "Read data differ from written data");
+
+	/* Errors are reported through the callback */
+	rc = flash_read_async(flash_dev, TEST_SIM_FLASH_END, rd, sizeof(rd), &op);
+	zassert_equal(0, rc, "flash_read_async should succeed");
+	zassert_equal(-EINVAL, async_wait(), "read out of bounds should fail");
+}
+#endif
+
 #include <zephyr/drivers/flash/flash_simulator.h>
 
 ZTEST(flash_sim_api, test_get_mock)
@@ -104,6 +104,48 @@ ZTEST(uart_async_rx, test_rx)
 	zassert_true(buf_available);
 }
 
+ZTEST(uart_async_rx, test_rx_large_buf)
+{
+	int err;
+	static const int buf_cnt = 2;
+	/* Exceeds the 7 bit limit of the original buffer state. */
+	static const size_t len = 200;
+	uint8_t buf[2 * (200 + UART_ASYNC_RX_BUF_OVERHEAD)];
+	size_t claim_len;
+	uint8_t *claim_buf;
+	uint8_t *aloc_buf;
+	struct uart_async_rx async_rx;
+	bool buf_available;
+	const struct uart_async_rx_config config = {
+		.buffer = buf,
+		.length = sizeof(buf),
+		.buf_cnt = buf_cnt
+	};
+
+	err = uart_async_rx_init(&async_rx, &config);
+	zassert_equal(err, 0);
+	zassert_equal(uart_async_rx_get_buf_len(&async_rx), len);
+
+	for (int i = 0; i < buf_cnt; i++) {
+		aloc_buf = uart_async_rx_buf_req(&async_rx);
+		zassert_not_null(aloc_buf);
+
+		mem_fill(aloc_buf, i, len);
+		uart_async_rx_on_rdy(&async_rx, aloc_buf, len - 50);
+		uart_async_rx_on_rdy(&async_rx, aloc_buf, 50);
+		uart_async_rx_on_buf_rel(&async_rx, aloc_buf);
+	}
+
+	for (int i = 0; i < buf_cnt; i++) {
+		claim_len = uart_async_rx_data_claim(&async_rx, &claim_buf, SIZE_MAX);
+		zassert_equal(claim_len, len);
+		zassert_true(mem_check(claim_buf, i, len));
+
+		buf_available = uart_async_rx_data_consume(&async_rx, claim_len);
+		zassert_true(buf_available);
+	}
+}
+
 ZTEST(uart_async_rx, test_rx_late_consume)
 {
 	int err;
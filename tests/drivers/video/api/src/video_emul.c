@@ -196,4 +196,48 @@ ZTEST(video_common, test_video_vbuf)
 	video_buffer_release(vbuf);
 }
 
+ZTEST(video_common, test_video_vbuf_import)
+{
+	static uint8_t mem[CONFIG_VIDEO_BUFFER_POOL_SZ_MAX] __aligned(sizeof(void *));
+	struct video_caps caps;
+	struct video_format fmt;
+	struct video_buffer *vbuf = NULL;
+	enum video_buf_type type = VIDEO_BUF_TYPE_OUTPUT;
+
+	caps.type = type;
+	zexpect_ok(video_get_caps(rx_dev, &caps));
+
+	fmt.pixelformat = caps.format_caps[0].pixelformat;
+	fmt.width = caps.format_caps[0].width_max;
+	fmt.height = caps.format_caps[0].height_max;
+	fmt.type = type;
+	zexpect_ok(video_set_format(rx_dev, &fmt));
+	zassert_true(fmt.pitch * fmt.height <= sizeof(mem));
+
+	/* Wrap memory not coming from the video buffer pool */
+	vbuf = video_buffer_import(mem, fmt.pitch * fmt.height);
+	zassert_not_null(vbuf);
+	zexpect_equal_ptr(vbuf->buffer, mem);
+	zexpect_equal(vbuf->size, fmt.pitch * fmt.height);
+
+	zexpect_ok(video_stream_start(rx_dev, type));
+
+	vbuf->type = type;
+	zexpect_ok(video_enqueue(rx_dev, vbuf));
+
+	/* The data is received directly into the imported memory */
+	zexpect_ok(video_dequeue(rx_dev, &vbuf, K_FOREVER));
+	zexpect_equal_ptr(vbuf->buffer, mem);
+	zexpect_equal(vbuf->bytesused, vbuf->size);
+
+	zexpect_ok(video_stream_stop(rx_dev, type));
+
+	/* Releasing makes the video buffer available again without freeing the memory */
+	video_buffer_release(vbuf);
+
+	vbuf = video_buffer_alloc(fmt.pitch * fmt.height, K_NO_WAIT);
+	zexpect_not_null(vbuf);
+	video_buffer_release(vbuf);
+}
+
 ZTEST_SUITE(video_emul, NULL, NULL, NULL, NULL, NULL);
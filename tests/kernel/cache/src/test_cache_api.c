@@ -79,6 +79,55 @@ ZTEST_USER(cache_api, test_data_cache_api_user)
 	zassert_true((ret == 0) || (ret == -ENOTSUP));
 }
 
+#ifdef CONFIG_CACHE_BATCH
+#define BATCH_RANGES 4
+
+SYS_CACHE_BATCH_DEFINE(test_batch, BATCH_RANGES);
+
+ZTEST(cache_api, test_data_cache_batch)
+{
+	int ret;
+
+	/* contiguous flushes merge into a single range */
+	for (int i = 0; i < 8; i++) {
+		zassert_ok(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_FLUSH,
+					       &user_buffer[i * 64], 64));
+	}
+	zassert_equal(test_batch.num, 1, "flushes not merged");
+
+	/* invalidations are only merged when they touch */
+	zassert_ok(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_INVD, &user_buffer[2048], 64));
+	zassert_ok(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_INVD, &user_buffer[2048 + 64],
+				       64));
+	zassert_ok(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_INVD, &user_buffer[3072], 64));
+	zassert_equal(test_batch.num, 3, "unexpected number of ranges");
+
+	zassert_equal(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_INVD + 1, user_buffer, 64),
+		      -EINVAL);
+
+	ret = sys_cache_batch_commit(&test_batch);
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+	zassert_equal(test_batch.num, 0, "batch not emptied");
+
+	/* a full batch is committed to make room */
+	for (int i = 0; i < BATCH_RANGES + 2; i++) {
+		ret = sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_INVD, &user_buffer[i * 512],
+					  64);
+		zassert_true((ret == 0) || (ret == -ENOTSUP));
+		zassert_true(test_batch.num <= BATCH_RANGES, "batch overflow");
+	}
+
+	ret = sys_cache_batch_commit(&test_batch);
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	/* flushes adding up to the whole cache threshold, if any */
+	zassert_ok(sys_cache_batch_add(&test_batch, SYS_CACHE_BATCH_FLUSH_AND_INVD, user_buffer,
+				       SIZE));
+	ret = sys_cache_batch_commit(&test_batch);
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+}
+#endif /* CONFIG_CACHE_BATCH */
+
 static void *cache_api_setup(void)
 {
 	sys_cache_data_enable();
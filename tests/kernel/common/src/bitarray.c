@@ -521,6 +521,44 @@ void alloc_and_free_interval(void)
  * @see sys_bitarray_alloc()
  * @see sys_bitarray_free()
  */
+void alloc_hint_predefined(void)
+{
+	int ret;
+	size_t offset;
+
+	SYS_BITARRAY_DEFINE(ba_128, 128);
+
+	printk("Testing bit array alloc with hint\n");
+
+	/* Region found at the hint */
+	ret = sys_bitarray_alloc_hint(&ba_128, 4, 40, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_hint() failed: %d", ret);
+	zassert_equal(offset, 40, "sys_bitarray_alloc_hint() offset expected %d, got %zu",
+		      40, offset);
+
+	/* Region found after the hint, skipping allocated bits */
+	ret = sys_bitarray_alloc_hint(&ba_128, 80, 40, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_hint() failed: %d", ret);
+	zassert_equal(offset, 44, "sys_bitarray_alloc_hint() offset expected %d, got %zu",
+		      44, offset);
+
+	/* Not enough room after the hint, wraps around */
+	ret = sys_bitarray_alloc_hint(&ba_128, 8, 124, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_hint() failed: %d", ret);
+	zassert_equal(offset, 0, "sys_bitarray_alloc_hint() offset expected %d, got %zu",
+		      0, offset);
+
+	/* Hint beyond the bit array */
+	ret = sys_bitarray_alloc_hint(&ba_128, 4, 1000, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_hint() failed: %d", ret);
+	zassert_equal(offset, 8, "sys_bitarray_alloc_hint() offset expected %d, got %zu",
+		      8, offset);
+
+	/* Only 4 bits at the end and 28 before the first allocation are left */
+	ret = sys_bitarray_alloc_hint(&ba_128, 29, 60, &offset);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc_hint() should fail but not: %d", ret);
+}
+
 ZTEST(bitarray, test_bitarray_alloc_free)
 {
 	int i;
@@ -532,6 +570,7 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 
 	alloc_and_free_predefined();
 	alloc_and_free_32_predefined();
+	alloc_hint_predefined();
 
 	i = 1;
 	while (i < 65) {
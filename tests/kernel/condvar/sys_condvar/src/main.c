@@ -0,0 +1,142 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/condvar.h>
+#include <zephyr/sys/mutex.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WAITERS 3
+
+#ifdef CONFIG_USERSPACE
+#define ZTEST_USER_OR_NOT ZTEST_USER
+#define WAITER_OPTIONS (K_USER | K_INHERIT_PERMS)
+#else
+#define ZTEST_USER_OR_NOT ZTEST
+#define WAITER_OPTIONS 0
+#endif
+
+static ZTEST_BMEM SYS_MUTEX_DEFINE(mutex);
+static ZTEST_BMEM SYS_CONDVAR_DEFINE(condvar);
+
+static ZTEST_BMEM int ready;
+static ZTEST_BMEM int woken;
+static ZTEST_BMEM int generation;
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_WAITERS, STACK_SIZE);
+static struct k_thread threads[NUM_WAITERS];
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	int start;
+	int ret = 0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(sys_mutex_lock(&mutex, K_FOREVER));
+
+	start = generation;
+	ready++;
+
+	while ((generation == start) && (ret == 0)) {
+		ret = sys_condvar_wait(&condvar, &mutex, K_SECONDS(5));
+	}
+
+	if (ret == 0) {
+		woken++;
+	}
+
+	zassert_ok(sys_mutex_unlock(&mutex));
+}
+
+static void start_waiters(int count)
+{
+	for (int i = 0; i < count; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, waiter_entry,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(1), WAITER_OPTIONS,
+				K_NO_WAIT);
+	}
+
+	/* Let them all reach the wait */
+	while (true) {
+		zassert_ok(sys_mutex_lock(&mutex, K_FOREVER));
+		if (ready == count) {
+			break;
+		}
+		zassert_ok(sys_mutex_unlock(&mutex));
+		k_msleep(10);
+	}
+
+	generation++;
+	zassert_ok(sys_mutex_unlock(&mutex));
+}
+
+static void join_waiters(int count)
+{
+	for (int i = 0; i < count; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+}
+
+ZTEST_USER_OR_NOT(sys_condvar, test_signal)
+{
+	start_waiters(1);
+	zassert_ok(sys_condvar_signal(&condvar));
+	join_waiters(1);
+
+	zassert_equal(woken, 1, "waiter not woken up");
+}
+
+ZTEST_USER_OR_NOT(sys_condvar, test_broadcast)
+{
+	start_waiters(NUM_WAITERS);
+	zassert_ok(sys_condvar_broadcast(&condvar));
+	join_waiters(NUM_WAITERS);
+
+	zassert_equal(woken, NUM_WAITERS, "only %d of %d waiters woken up",
+		      woken, NUM_WAITERS);
+}
+
+ZTEST_USER_OR_NOT(sys_condvar, test_no_waiters)
+{
+	zassert_ok(sys_condvar_signal(&condvar));
+	zassert_ok(sys_condvar_broadcast(&condvar));
+}
+
+ZTEST_USER_OR_NOT(sys_condvar, test_timeout)
+{
+	zassert_ok(sys_mutex_lock(&mutex, K_FOREVER));
+	zassert_equal(sys_condvar_wait(&condvar, &mutex, K_MSEC(50)), -EAGAIN,
+		      "wait did not time out");
+
+	/* The mutex is held again after the wait */
+	zassert_ok(sys_mutex_unlock(&mutex));
+	zassert_equal(sys_mutex_unlock(&mutex), -EINVAL, "mutex not unlocked");
+}
+
+static void sys_condvar_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	ready = 0;
+	woken = 0;
+}
+
+static void *sys_condvar_setup(void)
+{
+#ifdef CONFIG_USERSPACE
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		k_thread_access_grant(k_current_get(), &threads[i], &stacks[i]);
+	}
+#endif
+
+	return NULL;
+}
+
+ZTEST_SUITE(sys_condvar, NULL, sys_condvar_setup, sys_condvar_before, NULL, NULL);
@@ -13,6 +13,8 @@
 
 #define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
 
+#define NUM_WAITERS 4
+
 static struct k_thread treceiver;
 static struct k_thread textra1;
 static struct k_thread textra2;
@@ -21,6 +23,9 @@ static K_THREAD_STACK_DEFINE(sreceiver, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra1, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra2, STACK_SIZE);
 
+static struct k_thread twaiters[NUM_WAITERS];
+static K_THREAD_STACK_ARRAY_DEFINE(swaiters, NUM_WAITERS, STACK_SIZE);
+
 static K_EVENT_DEFINE(test_event);
 static K_EVENT_DEFINE(sync_event);
 
@@ -473,6 +478,82 @@ ZTEST(events_api, test_k_event_wait_all_safe)
 	zexpect_equal(events, 0x62, "expected 0x62, got %x", events);
 }
 
+static struct k_event staged_event;
+static volatile uint32_t staged_received[NUM_WAITERS];
+
+static const struct {
+	uint32_t events;
+	bool all;
+	k_timeout_t timeout;
+} staged_waits[NUM_WAITERS] = {
+	{ 0x00010001, true, K_FOREVER },
+	{ 0x00000102, false, K_FOREVER },
+	{ 0x80000004, true, K_FOREVER },
+	{ 0x40000000, false, SHORT_TIMEOUT },
+};
+
+static void staged_waiter(void *p1, void *p2, void *p3)
+{
+	unsigned int i = POINTER_TO_UINT(p1);
+
+	if (staged_waits[i].all) {
+		staged_received[i] = k_event_wait_all(&staged_event, staged_waits[i].events,
+						      false, staged_waits[i].timeout);
+	} else {
+		staged_received[i] = k_event_wait(&staged_event, staged_waits[i].events,
+						  false, staged_waits[i].timeout);
+	}
+}
+
+static void staged_post(uint32_t events, const uint32_t *expected)
+{
+	k_event_post(&staged_event, events);
+	k_sleep(DELAY);
+
+	for (unsigned int i = 0; i < NUM_WAITERS; i++) {
+		zassert_equal(staged_received[i], expected[i],
+			      "waiter %u received 0x%x, expected 0x%x", i,
+			      staged_received[i], expected[i]);
+	}
+}
+
+/**
+ * Test waking threads waiting on different events of one event object.
+ *
+ * Posts the events waited for one at a time, verifying that only the threads
+ * whose wait conditions are met get woken up, including threads waiting for
+ * all of several events that get posted separately, and that a thread that
+ * timed out is no longer considered.
+ */
+ZTEST(events_api, test_event_staged_wake)
+{
+	k_event_init(&staged_event);
+
+	for (unsigned int i = 0; i < NUM_WAITERS; i++) {
+		staged_received[i] = 0;
+		(void)k_thread_create(&twaiters[i], swaiters[i], STACK_SIZE,
+				      staged_waiter, UINT_TO_POINTER(i), NULL, NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	}
+
+	k_sleep(DELAY);
+
+	staged_post(0x00000001, (const uint32_t[]){ 0, 0, 0, 0 });
+	staged_post(0x00000100, (const uint32_t[]){ 0, 0x100, 0, 0 });
+	staged_post(0x80000000, (const uint32_t[]){ 0, 0x100, 0, 0 });
+
+	/* Let the last waiter time out before posting its event */
+	k_sleep(SHORT_TIMEOUT);
+	staged_post(0x40000000, (const uint32_t[]){ 0, 0x100, 0, 0 });
+
+	staged_post(0x00010000, (const uint32_t[]){ 0x10001, 0x100, 0, 0 });
+	staged_post(0x00000004, (const uint32_t[]){ 0x10001, 0x100, 0x80000004, 0 });
+
+	for (unsigned int i = 0; i < NUM_WAITERS; i++) {
+		zassert_ok(k_thread_join(&twaiters[i], LONG_TIMEOUT));
+	}
+}
+
 /**
  * @}
  */
@@ -0,0 +1,147 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/irq_thread.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/ztest.h>
+
+#define BUSY_US 500
+
+static K_SEM_DEFINE(done, 0, 1);
+
+static uint32_t last_count;
+static unsigned int calls;
+static bool ran_in_isr;
+static k_tid_t ran_on;
+static unsigned int ran_cpu;
+static unsigned int top_calls;
+
+static void bottom(struct k_irq_thread *irq_thread, uint32_t count)
+{
+	unsigned int key;
+
+	ARG_UNUSED(irq_thread);
+
+	key = arch_irq_lock();
+	ran_cpu = arch_curr_cpu()->id;
+	arch_irq_unlock(key);
+
+	last_count = count;
+	calls++;
+	ran_in_isr = k_is_in_isr();
+	ran_on = k_current_get();
+	k_sem_give(&done);
+}
+
+/* schedules the bottom half every other interrupt */
+static bool top(struct k_irq_thread *irq_thread)
+{
+	ARG_UNUSED(irq_thread);
+
+	return (++top_calls % 2) == 0;
+}
+
+static K_IRQ_THREAD_DEFINE(plain, NULL, bottom);
+static K_IRQ_THREAD_DEFINE(with_top, top, bottom);
+
+static void raise_once(const void *arg)
+{
+	k_irq_thread_raise((struct k_irq_thread *)arg);
+}
+
+static void raise_thrice(const void *arg)
+{
+	for (int i = 0; i < 3; i++) {
+		k_irq_thread_raise((struct k_irq_thread *)arg);
+	}
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&done);
+	calls = 0;
+	top_calls = 0;
+	(void)k_irq_thread_set_cpu(&plain, K_IRQ_THREAD_CPU_ANY);
+}
+
+ZTEST(irq_thread, test_raise_from_isr)
+{
+	irq_offload(raise_once, &plain);
+
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run");
+	zassert_equal(calls, 1, "bottom half ran %u times", calls);
+	zassert_equal(last_count, 1, "unexpected count %u", last_count);
+	zassert_false(ran_in_isr, "bottom half ran in an ISR");
+	zassert_not_equal(ran_on, k_current_get(), "bottom half ran in the raising thread");
+}
+
+ZTEST(irq_thread, test_coalescing)
+{
+	irq_offload(raise_thrice, &plain);
+
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run");
+	k_msleep(10);
+	zassert_equal(calls, 1, "bottom half ran %u times", calls);
+	zassert_equal(last_count, 3, "triggers not coalesced, count %u", last_count);
+
+	/* raised again once done, it runs again */
+	irq_offload(raise_once, &plain);
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run again");
+	zassert_equal(calls, 2, "bottom half ran %u times", calls);
+	zassert_equal(last_count, 1, "unexpected count %u", last_count);
+}
+
+ZTEST(irq_thread, test_top_half)
+{
+	irq_offload(k_irq_thread_isr, &with_top);
+	zassert_equal(k_sem_take(&done, K_MSEC(10)), -EAGAIN, "bottom half not filtered");
+
+	irq_offload(k_irq_thread_isr, &with_top);
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run");
+	zassert_equal(top_calls, 2, "top half ran %u times", top_calls);
+	zassert_equal(calls, 1, "bottom half ran %u times", calls);
+}
+
+ZTEST(irq_thread, test_affinity)
+{
+	unsigned int cpu = arch_num_cpus() - 1;
+
+	zassert_equal(k_irq_thread_set_cpu(&plain, arch_num_cpus()), -EINVAL,
+		      "invalid CPU accepted");
+	zassert_equal(k_irq_thread_set_cpu(&plain, -2), -EINVAL, "invalid CPU accepted");
+	zassert_ok(k_irq_thread_set_cpu(&plain, cpu), "valid CPU rejected");
+
+	irq_offload(raise_once, &plain);
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run");
+
+	if (IS_ENABLED(CONFIG_SCHED_CPU_MASK)) {
+		zassert_equal(ran_cpu, cpu, "bottom half ran on CPU %u", ran_cpu);
+	}
+}
+
+ZTEST(irq_thread, test_latency_stats)
+{
+	uint32_t latency;
+
+	if (arch_num_cpus() > 1 || k_is_preempt_thread()) {
+		/* the IRQ thread may run right away */
+		ztest_test_skip();
+	}
+
+	/* the cooperative test thread holds the bottom half back */
+	irq_offload(raise_once, &plain);
+	k_busy_wait(BUSY_US);
+	zassert_ok(k_sem_take(&done, K_MSEC(100)), "bottom half did not run");
+
+	latency = k_irq_thread_max_latency_get(&plain);
+	zassert_true(latency >= k_us_to_cyc_floor32(BUSY_US), "latency %u cycles too short",
+		     latency);
+}
+
+ZTEST_SUITE(irq_thread, NULL, NULL, before, NULL, NULL);
@@ -105,6 +105,7 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 #ifndef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	printk("    - in ISR: %lu\n", stats->pagefaults.in_isr);
 #endif
+	printk("    - Paged in ahead: %lu\n", stats->pagefaults.fault_around);
 
 	printk("* Eviction (%s):\n", scope);
 	printk("    - Total pages evicted: %lu\n",
@@ -113,6 +114,10 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+#ifdef CONFIG_EVICTION_SLRU
+	printk("    - Pages promoted: %lu\n", stats->eviction.promoted);
+	printk("    - Pages demoted: %lu\n", stats->eviction.demoted);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
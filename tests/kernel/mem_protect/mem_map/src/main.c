@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/toolchain.h>
 #include <mmu.h>
+#include <kernel_arch_interface.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/cache.h>
 
@@ -503,6 +504,45 @@ ZTEST(mem_map_api, test_k_mem_map_exhaustion)
 #endif /* !CONFIG_DEMAND_PAGING */
 }
 
+/**
+ * Test that K_MEM_MAP_CONTIG gives physically contiguous and pinned memory
+ */
+ZTEST(mem_map_api, test_k_mem_map_contig)
+{
+	const size_t size = CONFIG_MMU_PAGE_SIZE * 4;
+	size_t free_mem;
+	uintptr_t base, phys;
+	uint8_t *mapped;
+	int ret;
+
+	expect_fault = false;
+	free_mem = k_mem_free_get();
+
+	mapped = k_mem_map(size, K_MEM_PERM_RW | K_MEM_MAP_CONTIG);
+	zassert_not_null(mapped, "failed to map contiguous memory");
+	zassert_equal(free_mem, k_mem_free_get() + size,
+		      "incorrect free memory accounting");
+
+	ret = arch_page_phys_get(mapped, &base);
+	zassert_equal(ret, 0, "first page not mapped");
+
+	for (size_t offset = 0; offset < size; offset += CONFIG_MMU_PAGE_SIZE) {
+		ret = arch_page_phys_get(mapped + offset, &phys);
+		zassert_equal(ret, 0, "page at offset %zu not mapped", offset);
+		zassert_equal(phys, base + offset, "page at offset %zu not contiguous",
+			      offset);
+		zassert_true(k_mem_page_frame_is_pinned(k_mem_phys_to_page_frame(phys)),
+			     "page at offset %zu not pinned", offset);
+		zassert_equal(mapped[offset], 0, "page at offset %zu not zeroed", offset);
+	}
+
+	(void)memset(mapped, '\xFF', size);
+
+	k_mem_unmap(mapped, size);
+	zassert_equal(free_mem, k_mem_free_get(),
+		      "k_mem_unmap has not freed physical memory");
+}
+
 #ifdef CONFIG_USERSPACE
 #define USER_STACKSIZE	(128)
 
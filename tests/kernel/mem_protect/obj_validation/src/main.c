@@ -183,6 +183,71 @@ ZTEST(object_validation, test_no_ref_dyn_kobj_release_mem)
 	zassert_true(ret == -EBADF, "Dynamic kernel object not released");
 }
 
+#define STRESS_THREADS		MAX(CONFIG_MP_MAX_NUM_CPUS, 2)
+#define STRESS_ITERATIONS	500
+#define STRESS_KEPT		4
+#define STRESS_STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stress_stacks, STRESS_THREADS, STRESS_STACK_SIZE);
+static struct k_thread stress_threads[STRESS_THREADS];
+
+static void stress_entry(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < STRESS_ITERATIONS; i++) {
+		sem = k_object_alloc(K_OBJ_SEM);
+		zassert_not_null(sem, "Cannot allocate sem k_object");
+
+		k_sem_init(sem, 0, 1);
+		zassert_not_null(k_object_find(sem), "Dynamic kernel object not found");
+
+		/* Last reference dropped, released by k_thread_perms_clear() */
+		k_object_release(sem);
+	}
+
+	/* Left to be released by k_thread_perms_all_clear() when exiting */
+	for (int i = 0; i < STRESS_KEPT; i++) {
+		sem = k_object_alloc(K_OBJ_SEM);
+		zassert_not_null(sem, "Cannot allocate sem k_object");
+	}
+}
+
+/**
+ * @brief Test concurrent allocation, lookup and release of dynamic objects
+ *
+ * @details Several threads allocate and look up dynamic kernel objects
+ * while others release theirs, either explicitly or by exiting, so that
+ * on SMP the object lists are modified from several CPUs at once.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_alloc(), k_object_release()
+ */
+ZTEST(object_validation, test_dyn_kobj_alloc_release_stress)
+{
+	for (int round = 0; round < 4; round++) {
+		for (int i = 0; i < STRESS_THREADS; i++) {
+			k_thread_create(&stress_threads[i], stress_stacks[i],
+					STRESS_STACK_SIZE, stress_entry, NULL, NULL, NULL,
+					K_PRIO_PREEMPT(1), 0, K_FOREVER);
+			k_thread_system_pool_assign(&stress_threads[i]);
+		}
+
+		for (int i = 0; i < STRESS_THREADS; i++) {
+			k_thread_start(&stress_threads[i]);
+		}
+
+		for (int i = 0; i < STRESS_THREADS; i++) {
+			zassert_ok(k_thread_join(&stress_threads[i], K_FOREVER));
+		}
+	}
+}
+
 void *object_validation_setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
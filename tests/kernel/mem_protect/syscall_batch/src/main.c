@@ -0,0 +1,70 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/ztest.h>
+
+K_SEM_DEFINE(batch_sem, 0, 10);
+
+#define SEM_ENTRY(call) {.id = (call), .args = {(uintptr_t)&batch_sem}}
+
+ZTEST_USER(syscall_batch, test_batch)
+{
+	struct k_syscall_batch_entry entries[] = {
+		SEM_ENTRY(K_SYSCALL_K_SEM_RESET),
+		SEM_ENTRY(K_SYSCALL_K_SEM_GIVE),
+		SEM_ENTRY(K_SYSCALL_K_SEM_GIVE),
+		SEM_ENTRY(K_SYSCALL_K_SEM_GIVE),
+		SEM_ENTRY(K_SYSCALL_K_SEM_COUNT_GET),
+	};
+
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), ARRAY_SIZE(entries));
+	zassert_equal(entries[4].ret, 3, "count is %u", (unsigned int)entries[4].ret);
+	zassert_equal(k_sem_count_get(&batch_sem), 3);
+
+	/* An empty batch does nothing */
+	zassert_equal(k_syscall_batch(NULL, 0), 0);
+}
+
+ZTEST_USER(syscall_batch, test_invalid_id)
+{
+	struct k_syscall_batch_entry entries[] = {
+		{.id = K_SYSCALL_LIMIT},
+		{.id = K_SYSCALL_K_SYSCALL_BATCH},
+		SEM_ENTRY(K_SYSCALL_K_SEM_COUNT_GET),
+	};
+
+	/* Unknown calls fail on their own, the rest of the batch still runs */
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), ARRAY_SIZE(entries));
+	zassert_equal((int)entries[0].ret, -ENOSYS);
+	zassert_equal((int)entries[1].ret, -ENOSYS);
+	zassert_equal(entries[2].ret, k_sem_count_get(&batch_sem));
+}
+
+ZTEST_USER(syscall_batch, test_too_many)
+{
+	struct k_syscall_batch_entry entries[CONFIG_SYSCALL_BATCH_MAX + 1] = {0};
+
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), -EINVAL);
+}
+
+ZTEST(syscall_batch, test_supervisor)
+{
+	struct k_syscall_batch_entry entry = SEM_ENTRY(K_SYSCALL_K_SEM_GIVE);
+
+	zassert_equal(k_syscall_batch(&entry, 1), -EPERM);
+}
+
+static void *syscall_batch_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &batch_sem);
+
+	return NULL;
+}
+
+ZTEST_SUITE(syscall_batch, NULL, syscall_batch_setup, NULL, NULL, NULL);
@@ -0,0 +1,253 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MSGQ_LEN 4
+#define TIMEOUT K_MSEC(100)
+#define NUM_PRODUCERS 3
+#define MSGS_PER_PRODUCER 500
+
+K_MSGQ_LOCKFREE_DEFINE(kmsgq, sizeof(uint32_t), MSGQ_LEN, 4);
+static struct k_msgq msgq;
+static char __aligned(4) tbuffer[MSGQ_LEN * sizeof(uint32_t)];
+
+K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_PRODUCERS, STACK_SIZE);
+static struct k_thread tdata[NUM_PRODUCERS];
+
+static void fill(struct k_msgq *q, uint32_t base)
+{
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		uint32_t msg = base + i;
+
+		zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), 0);
+		zassert_equal(k_msgq_num_used_get(q), i + 1);
+		zassert_equal(k_msgq_num_free_get(q), MSGQ_LEN - i - 1);
+	}
+}
+
+static void drain(struct k_msgq *q, uint32_t base)
+{
+	uint32_t msg;
+
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, base + i);
+	}
+	zassert_equal(k_msgq_num_used_get(q), 0);
+}
+
+/**
+ * @brief Test FIFO ordering of lock-free message queues
+ *
+ * @details Fill and drain the queue several times so that the ring
+ * positions wrap around the buffer, checking peeks and counters.
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+ZTEST(msgq_lockfree, test_fifo)
+{
+	struct k_msgq_attrs attrs;
+	uint32_t msg;
+
+	k_msgq_lockfree_init(&msgq, tbuffer, sizeof(uint32_t), MSGQ_LEN);
+
+	for (uint32_t round = 0; round < 3; round++) {
+		fill(&msgq, round * 10);
+
+		zassert_equal(k_msgq_put(&msgq, &msg, K_NO_WAIT), -ENOMSG);
+		zassert_equal(k_msgq_put(&msgq, &msg, TIMEOUT), -EAGAIN);
+
+		k_msgq_get_attrs(&msgq, &attrs);
+		zassert_equal(attrs.used_msgs, MSGQ_LEN);
+
+		zassert_equal(k_msgq_peek(&msgq, &msg), 0);
+		zassert_equal(msg, round * 10);
+		zassert_equal(k_msgq_peek_at(&msgq, &msg, MSGQ_LEN - 1), 0);
+		zassert_equal(msg, round * 10 + MSGQ_LEN - 1);
+		zassert_equal(k_msgq_peek_at(&msgq, &msg, MSGQ_LEN), -ENOMSG);
+
+		drain(&msgq, round * 10);
+
+		zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), -ENOMSG);
+		zassert_equal(k_msgq_get(&msgq, &msg, TIMEOUT), -EAGAIN);
+	}
+
+	/* put_front is not supported on lock-free queues */
+	zassert_equal(k_msgq_put_front(&msgq, &msg), -ENOTSUP);
+}
+
+static void isr_put(const void *p)
+{
+	fill((struct k_msgq *)p, 100);
+}
+
+static void isr_get(const void *p)
+{
+	drain((struct k_msgq *)p, 100);
+}
+
+/**
+ * @brief Test lock-free message queue passing between ISR and thread
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+ZTEST(msgq_lockfree, test_isr)
+{
+	irq_offload(isr_put, &kmsgq);
+	drain(&kmsgq, 100);
+
+	fill(&kmsgq, 100);
+	irq_offload(isr_get, &kmsgq);
+}
+
+static void put_later(void *p1, void *p2, void *p3)
+{
+	uint32_t msg = POINTER_TO_UINT(p2);
+
+	k_msleep(10);
+	zassert_equal(k_msgq_put(p1, &msg, K_NO_WAIT), 0);
+}
+
+static void get_later(void *p1, void *p2, void *p3)
+{
+	uint32_t msg;
+
+	k_msleep(10);
+	zassert_equal(k_msgq_get(p1, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, POINTER_TO_UINT(p2));
+}
+
+static void purge_later(void *p1, void *p2, void *p3)
+{
+	k_msleep(10);
+	k_msgq_purge(p1);
+}
+
+static void run_later(k_thread_entry_t entry, struct k_msgq *q, uint32_t arg)
+{
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, entry,
+			q, UINT_TO_POINTER(arg), NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+}
+
+/**
+ * @brief Test blocking on empty and full lock-free message queues
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+ZTEST(msgq_lockfree, test_blocking)
+{
+	uint32_t msg = 0x55;
+
+	k_msgq_lockfree_init(&msgq, tbuffer, sizeof(uint32_t), MSGQ_LEN);
+
+	/* getter woken up by a put */
+	run_later(put_later, &msgq, 0x1234);
+	zassert_equal(k_msgq_get(&msgq, &msg, K_FOREVER), 0);
+	zassert_equal(msg, 0x1234);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/* putter woken up by a get */
+	fill(&msgq, 200);
+	run_later(get_later, &msgq, 200);
+	msg = 200 + MSGQ_LEN;
+	zassert_equal(k_msgq_put(&msgq, &msg, K_FOREVER), 0);
+	k_thread_join(&tdata[0], K_FOREVER);
+	for (uint32_t i = 1; i <= MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, 200 + i);
+	}
+
+	/* putter released by a purge */
+	fill(&msgq, 300);
+	run_later(purge_later, &msgq, 0);
+	zassert_equal(k_msgq_put(&msgq, &msg, K_FOREVER), -ENOMSG);
+	k_thread_join(&tdata[0], K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_cleanup(&msgq), 0);
+}
+
+/**
+ * @brief Test polling on a lock-free message queue
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+ZTEST(msgq_lockfree, test_poll)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_POLL);
+
+#ifdef CONFIG_POLL
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &msgq);
+	uint32_t msg;
+
+	k_msgq_lockfree_init(&msgq, tbuffer, sizeof(uint32_t), MSGQ_LEN);
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	run_later(put_later, &msgq, 0x4321);
+	zassert_equal(k_poll(&event, 1, K_FOREVER), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, 0x4321);
+	k_thread_join(&tdata[0], K_FOREVER);
+#endif /* CONFIG_POLL */
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uint32_t id = POINTER_TO_UINT(p2);
+
+	for (uint32_t i = 0; i < MSGS_PER_PRODUCER; i++) {
+		uint32_t msg = (id << 16) | i;
+
+		zassert_equal(k_msgq_put(p1, &msg, K_FOREVER), 0);
+	}
+}
+
+/**
+ * @brief Test concurrent producers on a lock-free message queue
+ *
+ * @details Several producers (spread over all CPUs on SMP) feed a small
+ * queue, the consumer checks that no message is lost or duplicated and
+ * that each producer's messages come out in order.
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+ZTEST(msgq_lockfree, test_producers)
+{
+	uint32_t next[NUM_PRODUCERS] = { 0 };
+	uint32_t msg;
+
+	k_msgq_lockfree_init(&msgq, tbuffer, sizeof(uint32_t), MSGQ_LEN);
+
+	for (uint32_t id = 0; id < NUM_PRODUCERS; id++) {
+		k_thread_create(&tdata[id], tstacks[id], STACK_SIZE, producer,
+				&msgq, UINT_TO_POINTER(id), NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (uint32_t n = 0; n < NUM_PRODUCERS * MSGS_PER_PRODUCER; n++) {
+		uint32_t id;
+
+		zassert_equal(k_msgq_get(&msgq, &msg, K_FOREVER), 0);
+		id = msg >> 16;
+		zassert_true(id < NUM_PRODUCERS, "bad message 0x%x", msg);
+		zassert_equal(msg & 0xffff, next[id], "out of order message 0x%x", msg);
+		next[id]++;
+	}
+
+	for (uint32_t id = 0; id < NUM_PRODUCERS; id++) {
+		k_thread_join(&tdata[id], K_FOREVER);
+	}
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+}
+
+ZTEST_SUITE(msgq_lockfree, NULL, NULL, NULL, NULL, NULL);
@@ -16,6 +16,9 @@
  * In addition, recursive locking capabilities and the use of a private mutex
  * are also tested.
  *
+ * Futex based sys_mutex (CONFIG_SYS_MUTEX_FUTEX) do not implement priority
+ * inheritance, the same timeline is then run without checking priorities.
+ *
  * This module tests the following mutex routines:
  *
  *    sys_mutex_lock
@@ -62,7 +65,7 @@ ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_2);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_3);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_4);
 
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FUTEX)
 static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
@@ -318,6 +321,18 @@ void join_participant_threads(void)
 	JOIN_PARTICIPANT_THREAD(11);
 }
 
+static void check_priority(int expected)
+{
+	int rv = k_thread_priority_get(k_current_get());
+
+	if (IS_ENABLED(CONFIG_SYS_MUTEX_FUTEX)) {
+		return;
+	}
+
+	zassert_equal(rv, expected, "expected priority %d, not %d\n",
+		      expected, rv);
+}
+
 /**
  *
  * @brief Main thread to test thread_mutex_xxx interfaces
@@ -360,9 +375,7 @@ ZTEST_USER_OR_NOT(mutex_complex, test_mutex)
 		zassert_equal(rv, 0, "Failed to lock mutex %p\n", mutexes[i]);
 		k_sleep(K_SECONDS(1));
 
-		rv = k_thread_priority_get(k_current_get());
-		zassert_equal(rv, priority[i], "expected priority %d, not %d\n",
-			      priority[i], rv);
+		check_priority(priority[i]);
 
 		/* Catch any errors from other threads */
 		zassert_equal(tc_rc, TC_PASS);
@@ -377,31 +390,25 @@ ZTEST_USER_OR_NOT(mutex_complex, test_mutex)
 
 	/* ~ 5 seconds have passed */
 
-	rv = k_thread_priority_get(k_current_get());
-	zassert_equal(rv, 6, "%s timed out and out priority should drop.\n",
-		      "thread_05");
-	zassert_equal(rv, 6, "Expected priority %d, not %d\n", 6, rv);
+	/* thread_05 timed out and our priority should drop */
+	check_priority(6);
 
+	/* Gave mutex_4 and our priority should drop */
 	sys_mutex_unlock(&mutex_4);
-	rv = k_thread_priority_get(k_current_get());
-	zassert_equal(rv, 7, "Gave %s and priority should drop.\n", "mutex_4");
-	zassert_equal(rv, 7, "Expected priority %d, not %d\n", 7, rv);
+	check_priority(7);
 
 	k_sleep(K_SECONDS(1));       /* thread_07 should time out */
 
 	/* ~ 6 seconds have passed */
 
 	for (i = 0; i < 3; i++) {
-		rv = k_thread_priority_get(k_current_get());
-		zassert_equal(rv, droppri[i], "Expected priority %d, not %d\n",
-			      droppri[i], rv);
+		check_priority(droppri[i]);
 		sys_mutex_unlock(givemutex[i]);
 
 		zassert_equal(tc_rc, TC_PASS);
 	}
 
-	rv = k_thread_priority_get(k_current_get());
-	zassert_equal(rv, 10, "Expected priority %d, not %d\n", 10, rv);
+	check_priority(10);
 
 	k_sleep(K_SECONDS(1));     /* Give thread_11 time to run */
 
@@ -447,7 +454,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FUTEX)
 	/* coverage for get_k_mutex checks */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
@@ -457,7 +464,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_unlock((struct sys_mutex *)k_current_get());
 	zassert_true(rv == -EINVAL, "accepted object that was not a mutex");
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FUTEX */
 
 	rv = sys_mutex_unlock(&not_my_mutex);
 	zassert_true(rv == -EPERM, "unlocked a mutex that wasn't owner");
@@ -467,7 +474,8 @@ ZTEST(mutex_complex, test_supervisor_access)
 
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+	/* Futex based sys_mutex are accessed directly, which faults */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FUTEX)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -476,7 +484,7 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
 #else
 	ztest_test_skip();
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FUTEX */
 }
 
 /*test case main entry*/
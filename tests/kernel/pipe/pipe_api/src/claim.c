@@ -0,0 +1,176 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+ZTEST_SUITE(k_pipe_claim, NULL, NULL, NULL, NULL, NULL);
+
+#define PIPE_SIZE 16
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_pipe pipe;
+static uint8_t buffer[PIPE_SIZE];
+
+K_PIPE_DEFINE_NOCACHE(test_define_nocache, PIPE_SIZE, 4);
+
+ZTEST(k_pipe_claim, test_write_claim)
+{
+	uint8_t res[PIPE_SIZE];
+	uint8_t *data;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), 4);
+	zassert_equal(data, buffer, "Claim should start at the beginning of the buffer");
+	memcpy(data, "abcd", 4);
+
+	/* Nothing visible before the claim is finished */
+	zassert_equal(k_pipe_read(&pipe, res, 1, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_pipe_write(&pipe, res, 1, K_NO_WAIT), -EAGAIN,
+		      "Writes should wait for the pending claim");
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 1, K_NO_WAIT), -EAGAIN,
+		      "Only one write claim may be pending");
+
+	zassert_equal(k_pipe_write_finish(&pipe, 5), -EINVAL);
+	zassert_ok(k_pipe_write_finish(&pipe, 3));
+	zassert_equal(k_pipe_write_finish(&pipe, 0), -ECANCELED, "No claim should be pending");
+
+	zassert_equal(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT), 3);
+	zassert_mem_equal(res, "abc", 3);
+}
+
+ZTEST(k_pipe_claim, test_write_claim_wrap_around)
+{
+	uint8_t res[PIPE_SIZE];
+	uint8_t *data;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write(&pipe, res, 12, K_NO_WAIT), 12);
+	zassert_equal(k_pipe_read(&pipe, res, 12, K_NO_WAIT), 12);
+
+	/* The claimed area is contiguous, it stops at the end of the buffer */
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 8, K_NO_WAIT), 4);
+	zassert_equal(data, &buffer[12]);
+	zassert_ok(k_pipe_write_finish(&pipe, 4));
+
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), 4);
+	zassert_equal(data, &buffer[0]);
+	zassert_ok(k_pipe_write_finish(&pipe, 4));
+
+	zassert_equal(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT), 8);
+}
+
+ZTEST(k_pipe_claim, test_read_claim)
+{
+	uint8_t res[PIPE_SIZE];
+	uint8_t *data;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_pipe_write(&pipe, (const uint8_t *)"abcdef", 6, K_NO_WAIT), 6);
+
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), 4);
+	zassert_mem_equal(data, "abcd", 4);
+	zassert_equal(k_pipe_read(&pipe, res, 1, K_NO_WAIT), -EAGAIN,
+		      "Reads should wait for the pending claim");
+
+	/* Released bytes are freed, the others are read again */
+	zassert_equal(k_pipe_read_finish(&pipe, 5), -EINVAL);
+	zassert_ok(k_pipe_read_finish(&pipe, 2));
+	zassert_equal(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT), 4);
+	zassert_mem_equal(res, "cdef", 4);
+}
+
+ZTEST(k_pipe_claim, test_claim_reset_close)
+{
+	uint8_t *data;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), 4);
+	k_pipe_reset(&pipe);
+	zassert_equal(k_pipe_write_finish(&pipe, 4), -ECANCELED);
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), -EAGAIN,
+		      "Cancelled claim should not have committed data");
+
+	zassert_equal(k_pipe_write(&pipe, (const uint8_t *)"ab", 2, K_NO_WAIT), 2);
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), 2);
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), 4);
+	k_pipe_close(&pipe);
+
+	zassert_equal(k_pipe_write_finish(&pipe, 4), -EPIPE);
+	zassert_ok(k_pipe_read_finish(&pipe, 1), "Read claim should survive closing");
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), 1);
+	zassert_ok(k_pipe_read_finish(&pipe, 1));
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), -EPIPE);
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), -EPIPE);
+}
+
+static void thread_write_claim(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *data;
+
+	zassert_equal(k_pipe_write_claim((struct k_pipe *)arg1, &data, 4, K_FOREVER), 4);
+	memcpy(data, "wxyz", 4);
+	zassert_ok(k_pipe_write_finish((struct k_pipe *)arg1, 4));
+}
+
+ZTEST(k_pipe_claim, test_read_claim_wait)
+{
+	k_tid_t tid;
+	uint8_t *data;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_write_claim, &pipe, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(100));
+
+	zassert_equal(k_pipe_read_claim(&pipe, &data, sizeof(buffer), K_MSEC(1000)), 4);
+	zassert_mem_equal(data, "wxyz", 4);
+	zassert_ok(k_pipe_read_finish(&pipe, 4));
+	k_thread_join(tid, K_FOREVER);
+}
+
+static void thread_write(void *arg1, void *arg2, void *arg3)
+{
+	zassert_equal(k_pipe_write((struct k_pipe *)arg1, (const uint8_t *)"0123", 4, K_FOREVER), 4);
+}
+
+ZTEST(k_pipe_claim, test_read_claim_direct_write)
+{
+	k_tid_t tid;
+	uint8_t *data;
+
+	/* A claimer waiting on an empty pipe is not a direct copy target */
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_write, &pipe, NULL, NULL, K_PRIO_COOP(0), 0, K_MSEC(100));
+
+	zassert_equal(k_pipe_read_claim(&pipe, &data, sizeof(buffer), K_MSEC(1000)), 4);
+	zassert_mem_equal(data, "0123", 4);
+	zassert_ok(k_pipe_read_finish(&pipe, 4));
+	k_thread_join(tid, K_FOREVER);
+}
+
+ZTEST(k_pipe_claim, test_write_claim_nocache)
+{
+	uint8_t res[4];
+	uint8_t *data;
+
+	zassert_equal(k_pipe_write_claim(&test_define_nocache, &data, 4, K_NO_WAIT), 4);
+	memcpy(data, "dma!", 4);
+	zassert_ok(k_pipe_write_finish(&test_define_nocache, 4));
+	zassert_equal(k_pipe_read(&test_define_nocache, res, sizeof(res), K_NO_WAIT), 4);
+	zassert_mem_equal(res, "dma!", 4);
+}
+
+ZTEST(k_pipe_claim, test_claim_no_buffer)
+{
+	uint8_t *data;
+
+	k_pipe_init(&pipe, NULL, 0);
+	zassert_equal(k_pipe_write_claim(&pipe, &data, 4, K_NO_WAIT), -ENOTSUP);
+	zassert_equal(k_pipe_read_claim(&pipe, &data, 4, K_NO_WAIT), -ENOTSUP);
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define NUM_FIFOS   8
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct fifo_msg {
+	void *private;
+	uint32_t id;
+};
+
+static struct k_fifo set_fifos[NUM_FIFOS];
+static struct k_poll_event set_events[NUM_FIFOS + 1];
+static struct k_poll_signal set_signal;
+static struct k_poll_set set;
+static struct fifo_msg msgs[NUM_FIFOS];
+
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+static struct k_thread set_thread;
+
+static void poll_set_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_poll_set_init(&set);
+	k_poll_signal_init(&set_signal);
+
+	for (int i = 0; i < NUM_FIFOS; i++) {
+		k_fifo_init(&set_fifos[i]);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_fifos[i]);
+		set_events[i].tag = i;
+		k_poll_set_add(&set, &set_events[i]);
+	}
+
+	k_poll_event_init(&set_events[NUM_FIFOS], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	set_events[NUM_FIFOS].tag = NUM_FIFOS;
+	k_poll_set_add(&set, &set_events[NUM_FIFOS]);
+}
+
+static void poll_set_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		k_poll_set_remove(&set, &set_events[i]);
+	}
+}
+
+/**
+ * @brief Test that only ready events are returned, for as long as they are
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_set, test_poll_set_level)
+{
+	struct k_poll_event *ready[NUM_FIFOS];
+	int rc;
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	k_fifo_put(&set_fifos[3], &msgs[3]);
+	k_fifo_put(&set_fifos[5], &msgs[5]);
+
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, 2, "expected two ready events, got %d", rc);
+	zassert_equal(ready[0]->tag, 3);
+	zassert_equal(ready[1]->tag, 5);
+	zassert_equal(ready[0]->state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+
+	/* Still ready until emptied */
+	zassert_equal(k_fifo_get(&set_fifos[3], K_NO_WAIT), &msgs[3]);
+	rc = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(rc, 1, "expected one ready event, got %d", rc);
+	zassert_equal(ready[0]->tag, 5);
+
+	zassert_equal(k_fifo_get(&set_fifos[5], K_NO_WAIT), &msgs[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	/* Registrations were kept: new data is noticed again */
+	k_fifo_put(&set_fifos[3], &msgs[3]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 3);
+	zassert_equal(k_fifo_get(&set_fifos[3], K_NO_WAIT), &msgs[3]);
+}
+
+/**
+ * @brief Test that ready events are all returned when there are too many
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_set, test_poll_set_round_robin)
+{
+	struct k_poll_event *ready[2];
+	uint32_t seen = 0;
+
+	for (int i = 0; i < NUM_FIFOS; i++) {
+		k_fifo_put(&set_fifos[i], &msgs[i]);
+	}
+
+	for (int i = 0; i < NUM_FIFOS / 2; i++) {
+		zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 2);
+		seen |= BIT(ready[0]->tag) | BIT(ready[1]->tag);
+	}
+
+	zassert_equal(seen, BIT_MASK(NUM_FIFOS), "all events should have been returned");
+
+	for (int i = 0; i < NUM_FIFOS; i++) {
+		zassert_equal(k_fifo_get(&set_fifos[i], K_NO_WAIT), &msgs[i]);
+	}
+}
+
+static void raise_signal(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_poll_signal_raise(&set_signal, 0x42);
+}
+
+/**
+ * @brief Test that a thread waiting on a poll set is woken up
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_set, test_poll_set_wait)
+{
+	struct k_poll_event *ready[NUM_FIFOS];
+	unsigned int signaled;
+	int result;
+
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, raise_signal, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_MSEC(50));
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_SECONDS(1)), 1);
+	zassert_equal(ready[0]->tag, NUM_FIFOS);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_check(&set_signal, &signaled, &result);
+	zassert_equal(result, 0x42);
+
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10)), -EAGAIN);
+
+	k_thread_join(&set_thread, K_FOREVER);
+}
+
+/**
+ * @brief Test that removed events are not returned anymore
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_remove()
+ */
+ZTEST(poll_set, test_poll_set_remove)
+{
+	struct k_poll_event *ready[NUM_FIFOS];
+
+	/* Once registered with its object */
+	k_poll_set_remove(&set, &set_events[1]);
+	k_fifo_put(&set_fifos[1], &msgs[1]);
+
+	/* Once queued as ready */
+	k_fifo_put(&set_fifos[2], &msgs[2]);
+	k_poll_set_remove(&set, &set_events[2]);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	/* Added back while ready */
+	k_poll_set_add(&set, &set_events[1]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 1);
+
+	zassert_equal(k_fifo_get(&set_fifos[1], K_NO_WAIT), &msgs[1]);
+	zassert_equal(k_fifo_get(&set_fifos[2], K_NO_WAIT), &msgs[2]);
+}
+
+ZTEST_SUITE(poll_set, NULL, NULL, poll_set_before, poll_set_after, NULL);
@@ -0,0 +1,247 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/irq_offload.h>
+
+#define NUM_READERS MAX(CONFIG_MP_MAX_NUM_CPUS - 1, 1)
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_UPDATES 200
+
+struct element {
+	uint32_t value;
+	bool freed;
+	struct k_rcu_head rcu;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_READERS, STACK_SIZE);
+static struct k_thread threads[NUM_READERS];
+
+static struct element elements[2];
+static struct element *shared;
+static atomic_t stop;
+static atomic_t reads;
+static atomic_t bad_reads;
+
+static K_SEM_DEFINE(callback_sem, 0, 2);
+
+static void reader_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&stop) == 0) {
+		struct element *e;
+
+		k_rcu_read_lock();
+
+		e = k_rcu_dereference(shared);
+		for (int i = 0; i < 10; i++) {
+			if (e->freed) {
+				atomic_inc(&bad_reads);
+			}
+		}
+
+		k_rcu_read_unlock();
+
+		atomic_inc(&reads);
+		k_yield();
+	}
+}
+
+static void start_readers(void)
+{
+	atomic_set(&stop, 0);
+	atomic_set(&reads, 0);
+	atomic_set(&bad_reads, 0);
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, reader_fn, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+}
+
+static void stop_readers(void)
+{
+	atomic_set(&stop, 1);
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	zassert_true(atomic_get(&reads) > 0, "readers did not run");
+	zassert_equal(atomic_get(&bad_reads), 0, "element reclaimed while in use");
+}
+
+/**
+ * @brief Test that k_rcu_synchronize() waits for readers
+ *
+ * The writer swaps the shared element and marks the old one as freed
+ * once the grace period is over, readers must never see a freed element.
+ *
+ * @see k_rcu_synchronize()
+ */
+ZTEST(rcu, test_rcu_synchronize)
+{
+	uint32_t start = elements[0].value;
+
+	elements[0].freed = false;
+	shared = &elements[0];
+
+	start_readers();
+
+	for (int i = 0; i < NUM_UPDATES; i++) {
+		struct element *old = shared;
+		struct element *new = &elements[(old - elements) ^ 1];
+
+		new->value = old->value + 1;
+		new->freed = false;
+		k_rcu_assign_pointer(shared, new);
+
+		/* Let readers pick up either element */
+		k_sleep(K_TICKS(1));
+
+		k_rcu_synchronize();
+		old->freed = true;
+	}
+
+	stop_readers();
+	zassert_equal(shared->value - start, NUM_UPDATES, "updates were lost");
+}
+
+static atomic_t isr_in_section;
+
+static void isr_reader_fn(struct k_timer *timer)
+{
+	struct element *e;
+
+	ARG_UNUSED(timer);
+
+	k_rcu_read_lock();
+
+	e = k_rcu_dereference(shared);
+	atomic_set(&isr_in_section, 1);
+
+	/* Stay long enough in the section for the writer to catch up */
+	for (int i = 0; i < 100; i++) {
+		k_busy_wait(50);
+		if (e->freed) {
+			atomic_inc(&bad_reads);
+		}
+	}
+
+	k_rcu_read_unlock();
+
+	atomic_inc(&reads);
+}
+
+static K_TIMER_DEFINE(isr_reader_timer, isr_reader_fn, NULL);
+
+/**
+ * @brief Test that k_rcu_synchronize() waits for readers in interrupts
+ *
+ * The reader runs from a timer interrupt, which on SMP may be taken by a
+ * CPU running its idle thread, while the writer waits for a grace period.
+ *
+ * @see k_rcu_synchronize()
+ */
+ZTEST(rcu, test_rcu_synchronize_isr_reader)
+{
+	elements[0].freed = false;
+	shared = &elements[0];
+	atomic_set(&reads, 0);
+	atomic_set(&bad_reads, 0);
+
+	for (int i = 0; i < 10; i++) {
+		struct element *old = shared;
+		struct element *new = &elements[(old - elements) ^ 1];
+
+		atomic_set(&isr_in_section, 0);
+		k_timer_start(&isr_reader_timer, K_MSEC(1), K_NO_WAIT);
+
+		/* Spin rather than sleep so that the other CPUs stay idle */
+		while (atomic_get(&isr_in_section) == 0) {
+			k_busy_wait(10);
+		}
+
+		new->freed = false;
+		k_rcu_assign_pointer(shared, new);
+
+		k_rcu_synchronize();
+		old->freed = true;
+
+		while (atomic_get(&reads) != i + 1) {
+			k_busy_wait(10);
+		}
+	}
+
+	zassert_equal(atomic_get(&bad_reads), 0, "element reclaimed while in use");
+}
+
+static void reclaim(struct k_rcu_head *head)
+{
+	struct element *e = CONTAINER_OF(head, struct element, rcu);
+
+	e->freed = true;
+	k_sem_give(&callback_sem);
+}
+
+/**
+ * @brief Test that k_rcu_call() defers callbacks past readers
+ *
+ * @see k_rcu_call()
+ */
+ZTEST(rcu, test_rcu_call)
+{
+	elements[0].freed = false;
+	shared = &elements[0];
+
+	start_readers();
+
+	for (int i = 0; i < NUM_UPDATES; i++) {
+		struct element *old = shared;
+		struct element *new = &elements[(old - elements) ^ 1];
+
+		new->freed = false;
+		k_rcu_assign_pointer(shared, new);
+
+		k_rcu_call(&old->rcu, reclaim);
+		zassert_ok(k_sem_take(&callback_sem, K_SECONDS(1)), "callback not called");
+		zassert_true(old->freed);
+	}
+
+	stop_readers();
+}
+
+static void rcu_call_isr(const void *arg)
+{
+	struct element *e = (struct element *)arg;
+
+	k_rcu_call(&e->rcu, reclaim);
+}
+
+/**
+ * @brief Test k_rcu_call() from an interrupt
+ *
+ * @see k_rcu_call()
+ */
+ZTEST(rcu, test_rcu_call_isr)
+{
+	elements[0].freed = false;
+	elements[1].freed = false;
+
+	irq_offload(rcu_call_isr, &elements[0]);
+	irq_offload(rcu_call_isr, &elements[1]);
+
+	zassert_ok(k_sem_take(&callback_sem, K_SECONDS(1)), "callback not called");
+	zassert_ok(k_sem_take(&callback_sem, K_SECONDS(1)), "callback not called");
+	zassert_true(elements[0].freed && elements[1].freed);
+}
+
+ZTEST_SUITE(rcu, NULL, NULL, NULL, NULL, NULL);
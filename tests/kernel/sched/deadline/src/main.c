@@ -220,6 +220,109 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+static atomic_t cbs_overruns;
+static volatile bool cbs_other_ran;
+
+static void cbs_overrun(struct k_thread *thread, void *data)
+{
+	ARG_UNUSED(thread);
+	ARG_UNUSED(data);
+
+	atomic_inc(&cbs_overruns);
+}
+
+static void cbs_spinner(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		arch_nop();
+	}
+}
+
+static void cbs_other(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	cbs_other_ran = true;
+}
+
+/**
+ * @brief Validate the admission test of constant bandwidth servers
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_admission)
+{
+	uint32_t period = MSEC_TO_CYCLES(100);
+
+	for (int i = 0; i < 2; i++) {
+		worker_tids[i] = k_thread_create(&worker_threads[i], worker_stacks[i], STACK_SIZE,
+						 cbs_spinner, NULL, NULL, NULL,
+						 K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+	}
+
+	zassert_equal(k_thread_cbs_set(worker_tids[0], period + 1, period, NULL, NULL), -EINVAL);
+	zassert_equal(k_thread_cbs_set(worker_tids[0], 1, 0, NULL, NULL), -EINVAL);
+
+	zassert_ok(k_thread_cbs_set(worker_tids[0], period / 2, period, NULL, NULL));
+	zassert_equal(k_thread_cbs_set(worker_tids[1], (period / 5) * 3, period, NULL, NULL),
+		      -EBUSY, "server exceeding the utilization bound admitted");
+
+	/* Shrinking the first server makes room for the second one */
+	zassert_ok(k_thread_cbs_set(worker_tids[0], period / 5, period, NULL, NULL));
+	zassert_ok(k_thread_cbs_set(worker_tids[1], (period / 5) * 3, period, NULL, NULL));
+
+	/* An exiting server releases its bandwidth */
+	k_thread_abort(worker_tids[1]);
+	zassert_ok(k_thread_cbs_set(worker_tids[0], (period / 5) * 4, period, NULL, NULL));
+
+	k_thread_abort(worker_tids[0]);
+}
+
+/**
+ * @brief Validate that an overrunning server does not starve other threads
+ *
+ * @details A server spinning forever has an earlier deadline than another
+ * thread at the same priority. Once its budget is consumed, its deadline gets
+ * postponed past the one of the other thread, which must then run.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_overrun)
+{
+	atomic_set(&cbs_overruns, 0);
+	cbs_other_ran = false;
+
+	worker_tids[0] = k_thread_create(&worker_threads[0], worker_stacks[0], STACK_SIZE,
+					 cbs_spinner, NULL, NULL, NULL,
+					 K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+	worker_tids[1] = k_thread_create(&worker_threads[1], worker_stacks[1], STACK_SIZE,
+					 cbs_other, NULL, NULL, NULL,
+					 K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+
+	zassert_ok(k_thread_cbs_set(worker_tids[0], MSEC_TO_CYCLES(10), MSEC_TO_CYCLES(100),
+				    cbs_overrun, NULL));
+	k_thread_deadline_set(worker_tids[1], MSEC_TO_CYCLES(150));
+
+	k_thread_start(worker_tids[0]);
+	k_thread_start(worker_tids[1]);
+
+	k_sleep(K_MSEC(50));
+
+	zassert_true(atomic_get(&cbs_overruns) > 0, "server budget not enforced");
+	zassert_true(cbs_other_ran, "overrunning server starved the other thread");
+
+	k_thread_abort(worker_tids[0]);
+	k_thread_abort(worker_tids[1]);
+}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #if (CONFIG_MP_MAX_NUM_CPUS == 1)
 static void reschedule_wrapper(const void *param)
 {
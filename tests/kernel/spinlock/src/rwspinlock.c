@@ -0,0 +1,145 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#define RW_STACK_SIZE 1024
+#define RW_ITERATIONS 10000
+
+static K_THREAD_STACK_DEFINE(rw_stack, RW_STACK_SIZE);
+static struct k_thread rw_thread;
+
+static struct k_rwspinlock rw_lock;
+static volatile uint32_t rw_first, rw_second;
+static volatile bool rw_done;
+static volatile bool rw_reading;
+
+/**
+ * @brief Test that a reader-writer spinlock masks interrupts
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_read_lock(), k_rwspin_write_lock()
+ */
+ZTEST(spinlock, test_rwspinlock_irq)
+{
+	k_spinlock_key_t key;
+
+	key = k_rwspin_read_lock(&rw_lock);
+	zassert_true(arch_irq_unlocked(key.key), "irq should be first locked!");
+	zassert_false(arch_irq_unlocked(arch_irq_lock()), "irq should be locked!");
+	k_rwspin_read_unlock(&rw_lock, key);
+
+	key = k_rwspin_write_lock(&rw_lock);
+	zassert_true(arch_irq_unlocked(key.key), "irq should be first locked!");
+	zassert_false(arch_irq_unlocked(arch_irq_lock()), "irq should be locked!");
+	k_rwspin_write_unlock(&rw_lock, key);
+
+	zassert_equal(atomic_get(&rw_lock.state), 0, "lock state not released");
+}
+
+static void rw_writer_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!rw_done) {
+		k_spinlock_key_t key = k_rwspin_write_lock(&rw_lock);
+
+		rw_first++;
+		k_busy_wait(1);
+		rw_second++;
+
+		k_rwspin_write_unlock(&rw_lock, key);
+	}
+}
+
+/**
+ * @brief Test that writers exclude readers on other CPUs
+ *
+ * A thread on another CPU keeps on updating two counters under the write
+ * lock, readers must always see them equal.
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_read_lock(), k_rwspin_write_lock()
+ */
+ZTEST(spinlock, test_rwspinlock_exclusion)
+{
+	uint32_t updates;
+
+	rw_first = 0;
+	rw_second = 0;
+	rw_done = false;
+
+	k_thread_create(&rw_thread, rw_stack, RW_STACK_SIZE, rw_writer_fn, NULL, NULL, NULL,
+			0, 0, K_NO_WAIT);
+
+	for (int i = 0; i < RW_ITERATIONS; i++) {
+		k_spinlock_key_t key = k_rwspin_read_lock(&rw_lock);
+
+		zassert_equal(rw_first, rw_second, "reader saw a partial update");
+
+		k_rwspin_read_unlock(&rw_lock, key);
+	}
+
+	rw_done = true;
+	k_thread_join(&rw_thread, K_FOREVER);
+
+	updates = rw_first;
+	zassert_true(updates > 0, "writer never got the lock");
+	zassert_equal(rw_first, rw_second);
+}
+
+static void rw_reader_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_spinlock_key_t key = k_rwspin_read_lock(&rw_lock);
+
+	rw_reading = true;
+
+	while (!rw_done) {
+		arch_spin_relax();
+	}
+
+	k_rwspin_read_unlock(&rw_lock, key);
+}
+
+/**
+ * @brief Test that readers on several CPUs hold the lock together
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_rwspin_read_lock()
+ */
+ZTEST(spinlock, test_rwspinlock_shared)
+{
+	k_spinlock_key_t key;
+
+	rw_reading = false;
+	rw_done = false;
+
+	k_thread_create(&rw_thread, rw_stack, RW_STACK_SIZE, rw_reader_fn, NULL, NULL, NULL,
+			0, 0, K_NO_WAIT);
+
+	while (!rw_reading) {
+		arch_spin_relax();
+	}
+
+	/* Would spin forever if readers excluded each other */
+	key = k_rwspin_read_lock(&rw_lock);
+	zassert_equal(atomic_get(&rw_lock.state), 2 * Z_RWSPIN_READER, "expected two readers");
+	k_rwspin_read_unlock(&rw_lock, key);
+
+	rw_done = true;
+	k_thread_join(&rw_thread, K_FOREVER);
+}
@@ -168,6 +168,41 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 	}
 }
 
+/** @brief Check that freed heap stacks are handed out again */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_cache)
+{
+	static struct k_thread th;
+	k_thread_stack_t *stack;
+	k_thread_stack_t *again;
+	k_tid_t tid;
+
+	if ((CONFIG_DYNAMIC_THREAD_STACK_CACHE_SIZE == 0) ||
+	    !IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_ALLOC) || IS_ENABLED(CONFIG_USERSPACE)) {
+		ztest_test_skip();
+	}
+
+	stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE / 2, 0);
+	zassert_not_null(stack);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, stack, CONFIG_DYNAMIC_THREAD_STACK_SIZE / 2, func, &tflag[0],
+			      NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(stack));
+
+	/* a cached stack serves any request up to the pool stack size */
+	again = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE, 0);
+	zassert_equal_ptr(again, stack);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, again, CONFIG_DYNAMIC_THREAD_STACK_SIZE, func, &tflag[0],
+			      NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(again));
+}
+
 K_SEM_DEFINE(perm_sem, 0, 1);
 ZTEST_BMEM static volatile bool expect_fault;
 ZTEST_BMEM static volatile unsigned int expected_reason;
@@ -550,5 +550,53 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAM
+static uint32_t histogram_sum(const uint32_t *histogram)
+{
+	uint32_t  sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_HISTOGRAM_BUCKETS; i++) {
+		sum += histogram[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the scheduling latency and run time histograms
+ *
+ * Every time the current thread wakes up from a sleep, it is made ready and
+ * switched in, which adds a sample to its wakeup histogram. Every time it
+ * goes back to sleep, its execution window ends, which adds a sample to its
+ * run histogram. The CPU histograms count the same events.
+ */
+ZTEST(usage_api, test_thread_stats_histogram)
+{
+	k_thread_runtime_stats_t  stats1;
+	k_thread_runtime_stats_t  stats2;
+	k_thread_runtime_stats_t  cpu1;
+	k_thread_runtime_stats_t  cpu2;
+
+	k_thread_runtime_stats_get(_current, &stats1);
+	k_thread_runtime_stats_cpu_get(0, &cpu1);
+
+	for (int i = 0; i < 5; i++) {
+		k_sleep(K_TICKS(1));
+	}
+
+	k_thread_runtime_stats_get(_current, &stats2);
+	k_thread_runtime_stats_cpu_get(0, &cpu2);
+
+	zassert_true(histogram_sum(stats2.wakeup_histogram) >=
+		     histogram_sum(stats1.wakeup_histogram) + 5);
+	zassert_true(histogram_sum(stats2.run_histogram) >=
+		     histogram_sum(stats1.run_histogram) + 5);
+	zassert_true(histogram_sum(cpu2.wakeup_histogram) >=
+		     histogram_sum(cpu1.wakeup_histogram) + 5);
+	zassert_true(histogram_sum(cpu2.run_histogram) >=
+		     histogram_sum(cpu1.run_histogram) + 5);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAM */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -328,6 +328,51 @@ ZTEST(work_1cpu, test_1cpu_simple_queue)
 	zassert_equal(rc, 0);
 }
 
+/* Single-CPU check submitting several work items at once. */
+ZTEST(work_1cpu, test_1cpu_batch_queue)
+{
+	static struct k_work batch_work;
+	struct k_work *works[] = { &common_work, &common_work1, &batch_work };
+	int rc;
+
+	/* All three work items give the semaphore */
+	k_sem_init(&sync_sem, 0, ARRAY_SIZE(works));
+	reset_counters();
+	for (size_t i = 0; i < ARRAY_SIZE(works); i++) {
+		k_work_init(works[i], counter_handler);
+	}
+
+	/* An already queued item is not queued again */
+	rc = k_work_submit_to_queue(&coophi_queue, &common_work1);
+	zassert_equal(rc, 1);
+
+	rc = k_work_submit_batch_to_queue(&coophi_queue, works, ARRAY_SIZE(works));
+	zassert_equal(rc, ARRAY_SIZE(works) - 1);
+	for (size_t i = 0; i < ARRAY_SIZE(works); i++) {
+		zassert_equal(k_work_busy_get(works[i]), K_WORK_QUEUED);
+	}
+
+	/* Shouldn't have been started since test thread is
+	 * cooperative.
+	 */
+	zassert_equal(coophi_counter(), 0);
+
+	/* Let them run, then check they all finished. */
+	k_sleep(K_TICKS(1));
+	zassert_equal(coophi_counter(), ARRAY_SIZE(works));
+	for (size_t i = 0; i < ARRAY_SIZE(works); i++) {
+		zassert_equal(k_work_busy_get(works[i]), 0);
+		zassert_equal(k_sem_take(&sync_sem, K_NO_WAIT), 0);
+	}
+
+	/* Nothing is queued to a queue that is not started */
+	rc = k_work_submit_batch_to_queue(&not_start_queue, works, ARRAY_SIZE(works));
+	zassert_equal(rc, 0);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+
+	k_sem_init(&sync_sem, 0, 1);
+}
+
 /* Basic SMP check submitting with a non-blocking handler. */
 ZTEST(work, test_smp_simple_queue)
 {
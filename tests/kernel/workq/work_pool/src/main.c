@@ -0,0 +1,249 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 3
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+#define RELEASE_DELAY K_MSEC(50)
+#define RESUBMITS 20
+
+K_WORK_POOL_DEFINE(pool, NUM_WORKERS, STACK_SIZE);
+
+static struct k_work works[NUM_WORKERS];
+static struct k_work_delayable dwork;
+
+/* Work synchronization objects must be in cache-coherent memory,
+ * which excludes stacks on some architectures.
+ */
+static struct k_work_sync work_sync;
+
+/* Given by the test thread or a timer to release blocking handlers. */
+static K_SEM_DEFINE(release_sem, 0, NUM_WORKERS);
+
+static struct k_timer release_timer;
+
+static atomic_t running;
+static atomic_t handled;
+static atomic_t reentered;
+static atomic_t resubmits_left;
+
+static void reset(void)
+{
+	k_sem_reset(&release_sem);
+	atomic_set(&running, 0);
+	atomic_set(&handled, 0);
+	atomic_set(&reentered, 0);
+	atomic_set(&resubmits_left, 0);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	atomic_inc(&running);
+	k_sem_take(&release_sem, K_FOREVER);
+	atomic_dec(&running);
+	atomic_inc(&handled);
+}
+
+static void counter_handler(struct k_work *work)
+{
+	atomic_inc(&handled);
+}
+
+static void resubmit_handler(struct k_work *work)
+{
+	if (atomic_inc(&running) != 0) {
+		atomic_inc(&reentered);
+	}
+
+	/* Give the other workers a chance to pick the item up again */
+	if (atomic_dec(&resubmits_left) > 0) {
+		zassert_true(k_work_submit_to_queue(k_work_pool_queue(&pool), work) > 0);
+	}
+	k_msleep(1);
+
+	atomic_dec(&running);
+	atomic_inc(&handled);
+}
+
+static void release_cb(struct k_timer *timer)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&release_sem);
+	}
+}
+
+static void wait_running(int count)
+{
+	for (int i = 0; (i < 100) && (atomic_get(&running) != count); i++) {
+		k_msleep(1);
+	}
+
+	zassert_equal(atomic_get(&running), count, "%d handlers running",
+		      (int)atomic_get(&running));
+}
+
+/**
+ * @brief Test that the workers of a pool process work items in parallel
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_parallel)
+{
+	struct k_work_q *queue = k_work_pool_queue(&pool);
+
+	reset();
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&works[i], blocking_handler);
+		zassert_equal(k_work_submit_to_queue(queue, &works[i]), 1);
+	}
+
+	/* Each item blocks its worker, so they must all be running */
+	wait_running(NUM_WORKERS);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_busy_get(&works[i]), K_WORK_RUNNING);
+		k_sem_give(&release_sem);
+	}
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_flush(&works[i], &work_sync);
+		zassert_equal(k_work_busy_get(&works[i]), 0);
+	}
+
+	zassert_equal(atomic_get(&handled), NUM_WORKERS);
+}
+
+/**
+ * @brief Test that a work item never runs on several workers at once
+ *
+ * @details The handler resubmits its own work item while running, so that
+ * idle workers see it queued while it is still running.
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_no_reentrancy)
+{
+	reset();
+	atomic_set(&resubmits_left, RESUBMITS);
+	k_work_init(&works[0], resubmit_handler);
+
+	zassert_equal(k_work_submit_to_queue(k_work_pool_queue(&pool), &works[0]), 1);
+
+	while (k_work_flush(&works[0], &work_sync)) {
+	}
+
+	zassert_equal(atomic_get(&reentered), 0, "handler reentered");
+	zassert_equal(atomic_get(&handled), RESUBMITS + 1);
+}
+
+/**
+ * @brief Test flushing a work item running on a pool
+ *
+ * @details Flushing must wait for the item to complete even though other
+ * workers are idle and could process the flusher right away.
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_flush_running)
+{
+	reset();
+	k_work_init(&works[0], blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(k_work_pool_queue(&pool), &works[0]), 1);
+	wait_running(1);
+
+	k_timer_start(&release_timer, RELEASE_DELAY, K_NO_WAIT);
+	zassert_true(k_work_flush(&works[0], &work_sync));
+	zassert_equal(atomic_get(&handled), 1);
+	zassert_equal(k_work_busy_get(&works[0]), 0);
+}
+
+/**
+ * @brief Test cancelling a work item running on a pool
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_cancel_running)
+{
+	reset();
+	k_work_init(&works[0], blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(k_work_pool_queue(&pool), &works[0]), 1);
+	wait_running(1);
+
+	/* A queued copy of the running item is removed by the cancel */
+	zassert_equal(k_work_submit_to_queue(NULL, &works[0]), 2);
+
+	k_timer_start(&release_timer, RELEASE_DELAY, K_NO_WAIT);
+	zassert_true(k_work_cancel_sync(&works[0], &work_sync));
+	zassert_equal(atomic_get(&handled), 1);
+	zassert_equal(k_work_busy_get(&works[0]), 0);
+}
+
+/**
+ * @brief Test delayable work items scheduled on a pool
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_delayable)
+{
+	reset();
+	k_work_init_delayable(&dwork, counter_handler);
+
+	zassert_equal(k_work_schedule_for_queue(k_work_pool_queue(&pool), &dwork,
+						K_MSEC(10)), 1);
+	zassert_true(k_work_delayable_is_pending(&dwork));
+
+	zassert_true(k_work_flush_delayable(&dwork, &work_sync));
+	zassert_equal(atomic_get(&handled), 1);
+}
+
+/**
+ * @brief Test draining a pool
+ *
+ * @details Draining must wait for all workers, not only the one that
+ * found the queue empty first.
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+ZTEST(work_pool, test_drain)
+{
+	struct k_work_q *queue = k_work_pool_queue(&pool);
+
+	reset();
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&works[i], blocking_handler);
+		zassert_equal(k_work_submit_to_queue(queue, &works[i]), 1);
+	}
+	wait_running(NUM_WORKERS);
+
+	/* Release one handler now, and the others later */
+	k_sem_give(&release_sem);
+	k_timer_start(&release_timer, RELEASE_DELAY, K_NO_WAIT);
+
+	zassert_equal(k_work_queue_drain(queue, false), 1);
+	zassert_equal(atomic_get(&handled), NUM_WORKERS);
+
+	zassert_equal(k_work_queue_stop(queue, K_NO_WAIT), -ENOTSUP);
+}
+
+static void *work_pool_setup(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "pool",
+		.pin_cpus = true,
+	};
+
+	k_timer_init(&release_timer, release_cb, NULL);
+	k_work_pool_start(&pool, WORKER_PRIORITY, &cfg);
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, NULL, NULL, NULL);
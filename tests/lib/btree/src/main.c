@@ -0,0 +1,184 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/btree.h>
+
+#define NUM_ITEMS 256
+
+struct item {
+	int key;
+	int seq;
+};
+
+static struct item items[NUM_ITEMS];
+
+static int item_cmp(const void *a, const void *b)
+{
+	const struct item *ia = a;
+	const struct item *ib = b;
+
+	return (ia->key > ib->key) - (ia->key < ib->key);
+}
+
+static int key_cmp(const void *a, const void *b)
+{
+	const struct item *ia = a;
+	int key = *(const int *)b;
+
+	return (ia->key > key) - (ia->key < key);
+}
+
+SYS_BTREE_DEFINE(tree, NUM_ITEMS, item_cmp);
+
+/* Scatter the keys so that insertions land all over the tree */
+static int key_of(int i)
+{
+	return (i * 97) % NUM_ITEMS;
+}
+
+static void fill(void)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		items[i].key = key_of(i);
+		items[i].seq = i;
+		zassert_ok(sys_btree_insert(&tree, &items[i]), "insertion %d failed", i);
+	}
+}
+
+static void check_order(void)
+{
+	struct sys_btree_iter iter;
+	struct item *item, *prev = NULL;
+	size_t count = 0;
+
+	SYS_BTREE_FOR_EACH(&tree, iter, item) {
+		if (prev != NULL) {
+			zassert_true(prev->key < item->key ||
+					     (prev->key == item->key && prev->seq < item->seq),
+				     "items out of order");
+		}
+		prev = item;
+		count++;
+	}
+
+	zassert_equal(count, sys_btree_size(&tree));
+}
+
+ZTEST(btree, test_insert_iterate)
+{
+	fill();
+	zassert_equal(sys_btree_size(&tree), NUM_ITEMS);
+	check_order();
+	zassert_equal(((struct item *)sys_btree_min(&tree))->key, 0);
+}
+
+ZTEST(btree, test_duplicates)
+{
+	struct sys_btree_iter iter;
+	struct item *item;
+	int seq = 0;
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		items[i].key = 42;
+		items[i].seq = i;
+		zassert_ok(sys_btree_insert(&tree, &items[i]));
+	}
+
+	/* equal items come out the way they went in */
+	SYS_BTREE_FOR_EACH(&tree, iter, item) {
+		zassert_equal(item->seq, seq++);
+	}
+
+	zassert_true(sys_btree_remove(&tree, &items[NUM_ITEMS / 2]));
+	zassert_false(sys_btree_remove(&tree, &items[NUM_ITEMS / 2]));
+	zassert_equal(sys_btree_size(&tree), NUM_ITEMS - 1);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		if (i != NUM_ITEMS / 2) {
+			zassert_equal_ptr(sys_btree_pop_min(&tree), &items[i]);
+		}
+	}
+}
+
+ZTEST(btree, test_remove)
+{
+	fill();
+
+	for (int i = 0; i < NUM_ITEMS; i += 2) {
+		zassert_true(sys_btree_remove(&tree, &items[i]), "item %d not removed", i);
+	}
+
+	zassert_equal(sys_btree_size(&tree), NUM_ITEMS / 2);
+	check_order();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		int key = key_of(i);
+
+		zassert_equal_ptr(sys_btree_find(&tree, &key, key_cmp),
+				  (i % 2) == 0 ? NULL : &items[i]);
+		zassert_equal_ptr(sys_btree_find(&tree, &items[i], NULL),
+				  (i % 2) == 0 ? NULL : &items[i]);
+	}
+
+	for (int i = 1; i < NUM_ITEMS; i += 2) {
+		zassert_true(sys_btree_remove(&tree, &items[i]), "item %d not removed", i);
+	}
+
+	zassert_equal(sys_btree_size(&tree), 0);
+	zassert_is_null(sys_btree_min(&tree));
+}
+
+ZTEST(btree, test_pop_min)
+{
+	struct item *item;
+	int key = -1;
+
+	fill();
+
+	while ((item = sys_btree_pop_min(&tree)) != NULL) {
+		zassert_true(item->key > key, "items popped out of order");
+		key = item->key;
+	}
+
+	zassert_equal(key, NUM_ITEMS - 1);
+	zassert_equal(sys_btree_size(&tree), 0);
+}
+
+ZTEST(btree, test_pool_exhaustion)
+{
+	static struct sys_btree_node nodes[3];
+	struct sys_btree small;
+	int i;
+
+	sys_btree_init(&small, nodes, ARRAY_SIZE(nodes), item_cmp);
+
+	for (i = 0; i < NUM_ITEMS; i++) {
+		items[i].key = i;
+		if (sys_btree_insert(&small, &items[i]) != 0) {
+			break;
+		}
+	}
+
+	/* a root and two leaves hold more than a single leaf does */
+	zassert_true(i > SYS_BTREE_NODE_ITEMS && i < NUM_ITEMS);
+	zassert_equal(sys_btree_insert(&small, &items[i]), -ENOMEM);
+	zassert_equal(sys_btree_size(&small), i);
+
+	/* the failed insertion left the tree intact */
+	for (int j = 0; j < i; j++) {
+		zassert_equal_ptr(sys_btree_pop_min(&small), &items[j]);
+	}
+}
+
+static void btree_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_btree_init(&tree, tree_nodes, ARRAY_SIZE(tree_nodes), item_cmp);
+}
+
+ZTEST_SUITE(btree, NULL, NULL, btree_before, NULL, NULL);
@@ -155,6 +155,31 @@ ZTEST(cbprintf_package, test_cbprintf_package)
 	}
 }
 
+#ifdef __cplusplus
+enum test_enum : uint8_t {
+#else
+enum test_enum {
+#endif
+	TEST_ENUM_A = 1,
+	TEST_ENUM_B = 200,
+};
+
+ZTEST(cbprintf_package, test_cbprintf_package_enum)
+{
+	enum test_enum e = TEST_ENUM_B;
+	bool b = true;
+
+	TEST_PACKAGING(0, "test %d %d %x", e, b, 0x12345678);
+	TEST_PACKAGING(0, "test %x %d %d", 0xb1b2b3b4, TEST_ENUM_A, !b);
+
+#ifdef __cplusplus
+	/* Enumerations and bool are numbers, not pointers. */
+	zassert_true(Z_CBPRINTF_IS_WORD_NUM(e));
+	zassert_true(Z_CBPRINTF_IS_WORD_NUM(b));
+	zassert_equal(Z_CBPRINTF_NONE_CHAR_PTR_COUNT("test %d %d", e, b), 0);
+#endif
+}
+
 ZTEST(cbprintf_package, test_cbprintf_rw_str_indexes)
 {
 	int len0, len1, len2;
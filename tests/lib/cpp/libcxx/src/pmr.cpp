@@ -0,0 +1,141 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#if __has_include(<memory_resource>)
+
+#include <list>
+#include <memory_resource>
+#include <vector>
+#include <zephyr/cpp/memory_resource.hpp>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define SLAB_BLOCK_SIZE 32
+#define SLAB_NUM_BLOCKS 8
+
+K_HEAP_DEFINE(pmr_heap, 2048);
+K_MEM_SLAB_DEFINE_STATIC(pmr_slab, SLAB_BLOCK_SIZE, SLAB_NUM_BLOCKS, 8);
+
+static zephyr::pmr::heap_resource heap_res(&pmr_heap);
+
+static bool in_slab(const void *ptr)
+{
+	const char *p = static_cast<const char *>(ptr);
+
+	return p >= pmr_slab.buffer && p < pmr_slab.buffer + SLAB_BLOCK_SIZE * SLAB_NUM_BLOCKS;
+}
+
+ZTEST(libcxx_pmr, test_heap_resource)
+{
+	std::pmr::vector<int> vec(&heap_res);
+
+	for (int i = 0; i < 100; i++) {
+		vec.push_back(i);
+	}
+
+	zassert_equal(vec.size(), 100, "vector store failed");
+	zassert_equal(vec[99], 99, "vec[99] wrong");
+	zassert_true(heap_res.is_equal(*vec.get_allocator().resource()), "wrong resource");
+}
+
+ZTEST(libcxx_pmr, test_slab_resource)
+{
+	zephyr::pmr::slab_resource res(&pmr_slab, 8, &heap_res);
+	void *small[SLAB_NUM_BLOCKS];
+	void *large;
+	void *extra;
+
+	for (auto &ptr : small) {
+		ptr = res.allocate(SLAB_BLOCK_SIZE, 8);
+		zassert_true(in_slab(ptr), "small request not served by the slab");
+	}
+	zassert_equal(k_mem_slab_num_free_get(&pmr_slab), 0, "slab not used up");
+
+	/* served upstream: slab exhausted, block too small */
+	extra = res.allocate(8, 8);
+	zassert_false(in_slab(extra), "request served by an exhausted slab");
+	res.deallocate(small[0], SLAB_BLOCK_SIZE, 8);
+	large = res.allocate(SLAB_BLOCK_SIZE + 1, 8);
+	zassert_false(in_slab(large), "large request served by the slab");
+	zassert_equal(k_mem_slab_num_free_get(&pmr_slab), 1, "large request took a block");
+
+	res.deallocate(large, SLAB_BLOCK_SIZE + 1, 8);
+	res.deallocate(extra, 8, 8);
+	for (size_t i = 1; i < ARRAY_SIZE(small); i++) {
+		res.deallocate(small[i], SLAB_BLOCK_SIZE, 8);
+	}
+	zassert_equal(k_mem_slab_num_free_get(&pmr_slab), SLAB_NUM_BLOCKS, "block leaked");
+
+	{
+		std::pmr::list<int> list(&res);
+
+		for (int i = 0; i < 16; i++) {
+			list.push_back(i);
+		}
+		zassert_equal(list.back(), 15, "list store failed");
+	}
+	zassert_equal(k_mem_slab_num_free_get(&pmr_slab), SLAB_NUM_BLOCKS, "list node leaked");
+}
+
+#if defined(CONFIG_SYS_MEM_BLOCKS)
+SYS_MEM_BLOCKS_DEFINE_STATIC(pmr_blocks, 16, 16, 16);
+
+ZTEST(libcxx_pmr, test_mem_blocks_resource)
+{
+	zephyr::pmr::mem_blocks_resource res(&pmr_blocks);
+	void *a = res.allocate(40, 8);
+	void *b = res.allocate(16, 16);
+
+	zassert_equal(static_cast<uint8_t *>(b) - static_cast<uint8_t *>(a), 48,
+		      "40 bytes should take 3 contiguous blocks");
+
+	res.deallocate(a, 40, 8);
+	res.deallocate(b, 16, 16);
+
+	/* the whole pool is free again */
+	a = res.allocate(16 * 16, 16);
+	res.deallocate(a, 16 * 16, 16);
+}
+#endif
+
+ZTEST(libcxx_pmr, test_arena_resource)
+{
+	zephyr::pmr::arena_resource<512> arena(&heap_res);
+	std::pmr::vector<int> vec(&arena);
+	uintptr_t start = reinterpret_cast<uintptr_t>(&arena);
+
+	vec.reserve(16);
+	uintptr_t data = reinterpret_cast<uintptr_t>(vec.data());
+
+	zassert_true(data >= start && data < start + sizeof(arena), "not allocated in the arena");
+
+	/* more than the arena holds, goes upstream */
+	vec.reserve(1024);
+	vec.push_back(1);
+	zassert_equal(vec[0], 1, "vector store failed");
+}
+
+#if defined(CONFIG_THREAD_LOCAL_STORAGE)
+ZTEST(libcxx_pmr, test_thread_resource)
+{
+	zassert_equal(zephyr::pmr::get_thread_resource(), std::pmr::get_default_resource(),
+		      "no thread resource should be set");
+
+	{
+		zephyr::pmr::scoped_thread_resource scope(&heap_res);
+		std::pmr::vector<int> vec(zephyr::pmr::get_thread_resource());
+
+		zassert_equal(vec.get_allocator().resource(), &heap_res, "thread resource not used");
+	}
+
+	zassert_equal(zephyr::pmr::get_thread_resource(), std::pmr::get_default_resource(),
+		      "thread resource not restored");
+}
+#endif
+
+ZTEST_SUITE(libcxx_pmr, NULL, NULL, NULL, NULL, NULL);
+
+#endif /* __has_include(<memory_resource>) */
@@ -1874,6 +1874,148 @@ ZTEST(lib_json_test, test_json_key_not_in_descr)
 	zassert_equal(ret, 0, "No items should be decoded");
 }
 
+ZTEST(lib_json_test, test_json_long_strings)
+{
+	struct test_nested ts;
+	char encoded[] = "{\"nested_string\":\"0123456789abcdef0123456789abcdef"
+		"\\\"quoted\\\" and \\u0041 escaped 0123456789abcdef\\\\\","
+		"\"nested_string_buf\":\"012345678\"}";
+	const char *expected = "0123456789abcdef0123456789abcdef"
+		"\\\"quoted\\\" and \\u0041 escaped 0123456789abcdef\\\\";
+	int ret;
+
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, nested_descr,
+			     ARRAY_SIZE(nested_descr), &ts);
+	zassert_equal(ret, BIT(2) | BIT(3), "Strings not decoded (%d)", ret);
+	zassert_str_equal(ts.nested_string, expected, "Long string not decoded correctly");
+	zassert_str_equal(ts.nested_string_buf, "012345678",
+			  "String buffer not decoded correctly");
+
+	/* A string cut short within a word is still incomplete */
+	ret = json_obj_parse(encoded, 30, nested_descr, ARRAY_SIZE(nested_descr), &ts);
+	zassert_equal(ret, -EINVAL, "Decoding has to fail");
+}
+
+ZTEST(lib_json_test, test_json_fields_out_of_order)
+{
+	struct test_nested ts = { 0 };
+	char encoded[] = "{\"nested_uint8\":8,\"nested_int\":-1,"
+		"\"unknown\":[1,{\"nested_int\":2}],\"nested_bool\":true,"
+		"\"nested_int8\":-8,\"nested_int\":3}";
+	int ret;
+
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, nested_descr,
+			     ARRAY_SIZE(nested_descr), &ts);
+	zassert_equal(ret, BIT(0) | BIT(1) | BIT(4) | BIT(5),
+		      "Fields not decoded (%d)", ret);
+	zassert_equal(ts.nested_int, -1, "Field decoded again");
+	zassert_true(ts.nested_bool, "Bool not decoded correctly");
+	zassert_equal(ts.nested_int8, -8, "Int8 not decoded correctly");
+	zassert_equal(ts.nested_uint8, 8, "Uint8 not decoded correctly");
+}
+
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+struct test_stream_item {
+	int id;
+	char name[8];
+};
+
+struct test_stream {
+	char label[12];
+	struct test_stream_item item;
+	int values[4];
+	size_t values_len;
+	bool enabled;
+};
+
+static const struct json_obj_descr stream_item_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream_item, id, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_stream_item, name, JSON_TOK_STRING_BUF),
+};
+
+static const struct json_obj_descr stream_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_stream, label, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_OBJECT(struct test_stream, item, stream_item_descr),
+	JSON_OBJ_DESCR_ARRAY(struct test_stream, values, 4, values_len, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_stream, enabled, JSON_TOK_TRUE),
+};
+
+ZTEST(lib_json_test, test_json_stream_obj_parse)
+{
+	const char encoded[] = "{ \"label\": \"sensor A\", "
+		"\"skipped\": \"a \\\"string\\\" much longer than the token buffer\", "
+		"\"item\": {\"name\": \"temp\", \"id\": 42}, "
+		"\"values\": [1, -2, 3], \"other\": [{\"x\": [false]}], "
+		"\"enabled\": true }";
+	struct json_stream stream;
+	struct test_stream ts;
+	char token[16];
+
+	/* The same document has to decode however it gets split */
+	for (size_t chunk = 1; chunk <= sizeof(encoded); chunk++) {
+		int64_t ret = -EAGAIN;
+
+		memset(&ts, 0, sizeof(ts));
+		json_stream_obj_parse_init(&stream, token, sizeof(token), stream_descr,
+					   ARRAY_SIZE(stream_descr), &ts);
+
+		for (size_t pos = 0; pos < sizeof(encoded) - 1; pos += chunk) {
+			zassert_equal(ret, -EAGAIN, "Object complete too early (%d)", (int)ret);
+			ret = json_stream_obj_parse(&stream, encoded + pos,
+						    MIN(chunk, sizeof(encoded) - 1 - pos));
+		}
+
+		zassert_equal(ret, BIT(0) | BIT(1) | BIT(2) | BIT(3),
+			      "Fields not decoded with %zu byte chunks (%d)", chunk, (int)ret);
+		zassert_str_equal(ts.label, "sensor A", "String not decoded correctly");
+		zassert_equal(ts.item.id, 42, "Nested number not decoded correctly");
+		zassert_str_equal(ts.item.name, "temp", "Nested string not decoded correctly");
+		zassert_equal(ts.values_len, 3, "Array length not decoded correctly");
+		zassert_equal(ts.values[1], -2, "Array element not decoded correctly");
+		zassert_true(ts.enabled, "Bool not decoded correctly");
+
+		/* Data past the end of the object is not looked at */
+		ret = json_stream_obj_parse(&stream, "garbage", 7);
+		zassert_equal(ret, BIT(0) | BIT(1) | BIT(2) | BIT(3), "Result changed");
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_obj_parse_errors)
+{
+	struct json_stream stream;
+	struct test_stream ts = { 0 };
+	char token[8];
+	int64_t ret;
+
+	/* A decoded string has to fit the token buffer */
+	json_stream_obj_parse_init(&stream, token, sizeof(token), stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+	ret = json_stream_obj_parse(&stream, "{\"label\":\"too long\"}", 20);
+	zassert_equal(ret, -ENOSPC, "Decoding has to fail (%d)", (int)ret);
+
+	/* Errors are sticky */
+	ret = json_stream_obj_parse(&stream, "}", 1);
+	zassert_equal(ret, -ENOSPC, "Error not kept (%d)", (int)ret);
+
+	json_stream_obj_parse_init(&stream, token, sizeof(token), stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+	ret = json_stream_obj_parse(&stream, "{\"values\":[1,2,3,4,5]}", 22);
+	zassert_equal(ret, -ENOSPC, "Array overflow not detected (%d)", (int)ret);
+
+	json_stream_obj_parse_init(&stream, token, sizeof(token), stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+	ret = json_stream_obj_parse(&stream, "{\"enabled\":tru", 14);
+	zassert_equal(ret, -EAGAIN, "Incomplete object not detected (%d)", (int)ret);
+	ret = json_stream_obj_parse(&stream, "x}", 2);
+	zassert_equal(ret, -EINVAL, "Invalid literal not detected (%d)", (int)ret);
+
+	json_stream_obj_parse_init(&stream, token, sizeof(token), stream_descr,
+				   ARRAY_SIZE(stream_descr), &ts);
+	ret = json_stream_obj_parse(&stream, "{\"item\":[]}", 11);
+	zassert_equal(ret, -EINVAL, "Wrong type not detected (%d)", (int)ret);
+}
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 ZTEST(lib_json_test, test_json_escape)
 {
 	char buf[42];
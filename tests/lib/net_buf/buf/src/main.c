@@ -69,6 +69,7 @@ static void fixed_destroy(struct net_buf *buf);
 static void var_destroy(struct net_buf *buf);
 static void var_destroy_aligned(struct net_buf *buf);
 static void var_destroy_aligned_small(struct net_buf *buf);
+static void slab_destroy(struct net_buf *buf);
 
 #define VAR_POOL_ALIGN 8
 #define VAR_POOL_ALIGN_SMALL 4
@@ -90,6 +91,11 @@ NET_BUF_POOL_VAR_ALIGN_DEFINE(var_pool_aligned_small, VAR_POOL_DATA_COUNT,
 			      VAR_POOL_DATA_SIZE, USER_DATA_VAR,
 			      var_destroy_aligned_small, VAR_POOL_ALIGN_SMALL);
 
+NET_BUF_SLAB_CLASS_DEFINE(slab_small, 64, 2);
+NET_BUF_SLAB_CLASS_DEFINE(slab_large, 512, 1);
+NET_BUF_POOL_SLAB_DEFINE(slab_pool, 4, USER_DATA_VAR, slab_destroy,
+			 &slab_small, &slab_large);
+
 static void buf_destroy(struct net_buf *buf)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
@@ -135,6 +141,15 @@ static void var_destroy_aligned_small(struct net_buf *buf)
 	net_buf_destroy(buf);
 }
 
+static void slab_destroy(struct net_buf *buf)
+{
+	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+
+	destroy_called++;
+	zassert_equal(pool, &slab_pool, "Invalid free pointer in buffer");
+	net_buf_destroy(buf);
+}
+
 static const char example_data[] = "0123456789"
 				   "abcdefghijklmnopqrstuvxyz"
 				   "!#¤%&/()=?";
@@ -563,6 +578,49 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_slab_pool)
+{
+	struct net_buf *buf1, *buf2, *buf3, *buf4;
+
+	destroy_called = 0;
+
+	/* Small requests are served by the smallest class */
+	buf1 = net_buf_alloc_len(&slab_pool, 20, K_NO_WAIT);
+	zassert_not_null(buf1, "Failed to get buffer");
+	zassert_equal(buf1->size, 64, "Invalid buffer size %u", buf1->size);
+
+	/* Large requests are served by the large class */
+	buf2 = net_buf_alloc_len(&slab_pool, 300, K_NO_WAIT);
+	zassert_not_null(buf2, "Failed to get buffer");
+	zassert_equal(buf2->size, 512, "Invalid buffer size %u", buf2->size);
+
+	/* No class fits, and the large class is exhausted */
+	zassert_is_null(net_buf_alloc_len(&slab_pool, 1024, K_NO_WAIT));
+	zassert_is_null(net_buf_alloc_len(&slab_pool, 300, K_NO_WAIT));
+
+	buf3 = net_buf_clone(buf1, K_NO_WAIT);
+	zassert_not_null(buf3, "Failed to clone buffer");
+	zassert_equal(buf3->data, buf1->data, "Cloned data doesn't match");
+
+	net_buf_unref(buf2);
+
+	/* A larger class is used when the smallest one is exhausted */
+	buf2 = net_buf_alloc_len(&slab_pool, 20, K_NO_WAIT);
+	zassert_not_null(buf2, "Failed to get buffer");
+	buf4 = net_buf_alloc_len(&slab_pool, 20, K_NO_WAIT);
+	zassert_not_null(buf4, "Failed to get buffer");
+	zassert_equal(buf4->size, 512, "Invalid buffer size %u", buf4->size);
+
+	net_buf_unref(buf1);
+	net_buf_unref(buf2);
+	net_buf_unref(buf3);
+	net_buf_unref(buf4);
+
+	zassert_equal(destroy_called, 4, "Incorrect destroy callback count");
+	zassert_equal(k_mem_slab_num_free_get(&slab_small), 2);
+	zassert_equal(k_mem_slab_num_free_get(&slab_large), 1);
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
@@ -253,6 +253,76 @@ static bool consume(void *user_data, uint32_t iter_cnt, bool last, int prio)
 	return true;
 }
 
+static bool produce_vec(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	static int cnt;
+	static int wr = 8;
+	struct ring_buf_vec vec[2];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	len = ring_buf_put_claim_vec(&ringbuf, vec, wr);
+	if (len == 0) {
+		return true;
+	}
+
+	for (int v = 0; v < ARRAY_SIZE(vec); v++) {
+		for (uint32_t i = 0; i < vec[v].len; i++) {
+			vec[v].data[i] = cnt++;
+		}
+	}
+
+	wr++;
+	if (wr == 15) {
+		wr = 8;
+	}
+
+	int err = ring_buf_put_finish(&ringbuf, len);
+
+	zassert_equal(err, 0, "cnt: %d", cnt);
+
+	return true;
+}
+
+static bool consume_vec(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	static int rd = 8;
+	static int cnt;
+	struct ring_buf_vec vec[2];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	len = ring_buf_get_claim_vec(&ringbuf, vec, rd);
+	if (len == 0) {
+		return true;
+	}
+
+	for (int v = 0; v < ARRAY_SIZE(vec); v++) {
+		for (uint32_t i = 0; i < vec[v].len; i++) {
+			zassert_equal(vec[v].data[i], (uint8_t)cnt,
+				      "Got %02x, exp: %02x", vec[v].data[i], (uint8_t)cnt);
+			cnt++;
+		}
+	}
+
+	rd++;
+	if (rd == 15) {
+		rd = 8;
+	}
+
+	int err = ring_buf_get_finish(&ringbuf, len);
+
+	zassert_equal(err, 0);
+
+	return true;
+}
+
 static void test_ztress(ztress_handler high_handler,
 			ztress_handler low_handler,
 			bool item_mode)
@@ -301,6 +371,14 @@ ZTEST(ringbuffer_api, test_ringbuffer_zerocpy_stress)
 	test_ringbuffer_stress(produce, consume, false);
 }
 
+/* Zero-copy API claiming both parts of wrapped areas at once. Test is
+ * validating single producer, single consumer from different priorities.
+ */
+ZTEST(ringbuffer_api, test_ringbuffer_zerocpy_vec_stress)
+{
+	test_ringbuffer_stress(produce_vec, consume_vec, false);
+}
+
 /* Copy API. Test is validating single producer, single consumer from
  * different priorities.
  */
@@ -909,6 +909,47 @@ ZTEST(ringbuffer_api, test_ringbuffer_partial_getting)
 	}
 }
 
+ZTEST(ringbuffer_api, test_ringbuffer_claim_vec)
+{
+	uint8_t indata[RINGBUFFER_SIZE];
+	uint8_t outdata[RINGBUFFER_SIZE];
+	struct ring_buf_vec vec[2];
+	uint32_t len;
+
+	for (int i = 0; i < sizeof(indata); i++) {
+		indata[i] = i;
+	}
+
+	ring_buf_reset(&ringbuf_raw);
+
+	for (int i = 0; i < 100; i++) {
+		/* move the indexes so that claims wrap at different places */
+		len = ring_buf_put(&ringbuf_raw, indata, (i % RINGBUFFER_SIZE) + 1);
+		ring_buf_get(&ringbuf_raw, NULL, len);
+
+		len = ring_buf_put_claim_vec(&ringbuf_raw, vec, RINGBUFFER_SIZE + 1);
+		zassert_equal(len, RINGBUFFER_SIZE);
+		zassert_equal(vec[0].len + vec[1].len, len);
+		zassert_true(vec[1].len == 0 || vec[1].data == ringbuf_raw.buffer);
+		memcpy(vec[0].data, indata, vec[0].len);
+		memcpy(vec[1].data, indata + vec[0].len, vec[1].len);
+		zassert_ok(ring_buf_put_finish(&ringbuf_raw, len));
+
+		len = ring_buf_get_claim_vec(&ringbuf_raw, vec, 2);
+		zassert_equal(len, 2);
+		zassert_ok(ring_buf_get_finish(&ringbuf_raw, 0));
+
+		len = ring_buf_get_claim_vec(&ringbuf_raw, vec, RINGBUFFER_SIZE);
+		zassert_equal(len, RINGBUFFER_SIZE);
+		memcpy(outdata, vec[0].data, vec[0].len);
+		memcpy(outdata + vec[0].len, vec[1].data, vec[1].len);
+		zassert_mem_equal(outdata, indata, RINGBUFFER_SIZE);
+		zassert_ok(ring_buf_get_finish(&ringbuf_raw, len));
+
+		zassert_true(ring_buf_is_empty(&ringbuf_raw));
+	}
+}
+
 ZTEST(ringbuffer_api, test_ringbuffer_equal_bufs)
 {
 	struct ring_buf buf_ii;
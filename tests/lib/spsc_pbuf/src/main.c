@@ -209,6 +209,64 @@ ZTEST(test_spsc_pbuf, test_0cpy)
 	PACKET_CONSUME(pb, 0, 0);
 }
 
+struct batch_check {
+	uint8_t next_id;
+	int count;
+};
+
+static void batch_read_cb(const char *data, uint16_t len, void *user_data)
+{
+	struct batch_check *chk = user_data;
+
+	zassert_equal(len, 10 + chk->next_id);
+	zassert_equal(check_buffer((char *)data, len, chk->next_id), 0);
+	chk->next_id++;
+	chk->count++;
+}
+
+ZTEST(test_spsc_pbuf, test_batch)
+{
+	static uint8_t buffer[128] __aligned(MAX(Z_SPSC_PBUF_DCACHE_LINE, 4));
+	struct spsc_pbuf *pb = spsc_pbuf_init(buffer, sizeof(buffer), 0);
+	static char data[8][32];
+	const char *bufs[8];
+	uint16_t lens[8];
+	struct batch_check chk = {0};
+	uint8_t id = 0;
+	int rv;
+
+	for (int i = 0; i < ARRAY_SIZE(data); i++) {
+		memset(data[i], i, sizeof(data[i]));
+		bufs[i] = data[i];
+		lens[i] = 10 + i;
+	}
+
+	/* Invalid length rejects the whole batch. */
+	lens[1] = 0;
+	zassert_equal(spsc_pbuf_write_batch(pb, bufs, lens, 2), -EINVAL);
+	lens[1] = 11;
+	zassert_equal(spsc_pbuf_read_batch(pb, batch_read_cb, &chk), 0);
+
+	/* Go around the buffer several times, padding included. */
+	for (int round = 0; round < 20; round++) {
+		rv = spsc_pbuf_write_batch(pb, &bufs[id % 8], &lens[id % 8], 1);
+		zassert_equal(rv, 1);
+		id++;
+
+		rv = spsc_pbuf_write_batch(pb, &bufs[id % 8], &lens[id % 8], 8 - id % 8);
+		zassert_true(rv > 0 && rv <= 8 - id % 8);
+		id += rv;
+
+		/* Packets are passed in order and the buffer is then empty. */
+		chk.count = 0;
+		chk.next_id = chk.next_id % 8;
+		zassert_equal(spsc_pbuf_read_batch(pb, batch_read_cb, &chk), rv + 1);
+		zassert_equal(chk.count, rv + 1);
+		zassert_equal(spsc_pbuf_read_batch(pb, batch_read_cb, &chk), 0);
+		id %= 8;
+	}
+}
+
 ZTEST(test_spsc_pbuf, test_0cpy_smaller)
 {
 	static uint8_t buffer[128] __aligned(MAX(Z_SPSC_PBUF_DCACHE_LINE, 4));
@@ -234,7 +234,7 @@ static void test_iface_setup(void)
 /*
  * Simulate a packet reception from the outside world
  */
-static void _recv_data(struct net_if *iface)
+static void _recv_data_to(struct net_if *iface, const uint8_t *dst)
 {
 	struct net_pkt *pkt;
 	struct net_eth_hdr eth_hdr;
@@ -259,6 +259,10 @@ static void _recv_data(struct net_if *iface)
 	eth_hdr.dst.addr[4] = net_if_get_by_iface(iface);
 	eth_hdr.dst.addr[5] = 0x55;
 
+	if (dst != NULL) {
+		memcpy(eth_hdr.dst.addr, dst, sizeof(eth_hdr.dst.addr));
+	}
+
 	eth_hdr.src.addr[0] = 0xa2;
 	eth_hdr.src.addr[1] = 0x11;
 	eth_hdr.src.addr[2] = 0x22;
@@ -279,6 +283,11 @@ static void _recv_data(struct net_if *iface)
 	zassert_equal(ret, 0, "");
 }
 
+static void _recv_data(struct net_if *iface)
+{
+	_recv_data_to(iface, NULL);
+}
+
 static void test_recv_before_bridging(void)
 {
 	/* fake some packet reception */
@@ -364,6 +373,41 @@ static void test_recv_with_bridge(void)
 	check_free_packet_count();
 }
 
+static void test_recv_with_fdb(void)
+{
+	/* source address of the packets received on fake_iface[0] above */
+	uint8_t dst[] = { 0xa2, 0x11, 0x22, net_if_get_by_iface(fake_iface[0]), 0x77, 0x88 };
+	struct net_pkt *pkt;
+
+	ARRAY_FOR_EACH(eth_fake_data, i) {
+		if (eth_fake_data[i].sent_pkt != NULL) {
+			net_pkt_unref(eth_fake_data[i].sent_pkt);
+			eth_fake_data[i].sent_pkt = NULL;
+		}
+	}
+
+	/* a known destination is only forwarded to its interface */
+	_recv_data_to(fake_iface[2], dst);
+	k_sleep(K_MSEC(100));
+
+	pkt = eth_fake_data[0].sent_pkt;
+	zassert_not_null(pkt, "");
+	zassert_is_null(eth_fake_data[1].sent_pkt, "packet flooded");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+	zassert_mem_equal(NET_ETH_HDR(pkt)->dst.addr, dst, sizeof(dst), "");
+
+	net_pkt_unref(pkt);
+	eth_fake_data[0].sent_pkt = NULL;
+
+	/* and not forwarded back to the interface it came from */
+	_recv_data_to(fake_iface[0], dst);
+	k_sleep(K_MSEC(100));
+
+	zassert_is_null(eth_fake_data[0].sent_pkt, "");
+	zassert_is_null(eth_fake_data[1].sent_pkt, "");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+}
+
 static void test_recv_after_bridging(void)
 {
 	int ret;
@@ -407,6 +451,10 @@ ZTEST(net_eth_bridge, test_net_eth_bridge)
 	DBG("With bridging\n");
 	test_setup_bridge();
 	test_recv_with_bridge();
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE_FDB)) {
+		DBG("With learning\n");
+		test_recv_with_fdb();
+	}
 	DBG("After bridging\n");
 	test_recv_after_bridging();
 }
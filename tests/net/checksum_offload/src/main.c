@@ -84,6 +84,9 @@ static int test_proto;
 static bool verify_fragment;
 static bool start_receiving;
 static bool change_chksum;
+static bool mark_verified;
+static bool partial_chksum;
+static bool zerocopy;
 static int fragment_count;
 static int fragment_offset;
 
@@ -92,6 +95,9 @@ static K_SEM_DEFINE(wait_data_nonoff, 0, UINT_MAX);
 
 #define WAIT_TIME K_MSEC(100)
 
+/* Payload of the zero-copy sends, appended to the packet as is */
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_pool, 1, 32, 0, NULL);
+
 struct eth_context {
 	struct net_if *iface;
 	uint8_t mac_addr[6];
@@ -182,6 +188,7 @@ static uint16_t get_icmp_chksum(struct net_pkt *pkt)
 
 static void test_receiving(struct net_pkt *pkt)
 {
+	struct net_pkt *rx_pkt;
 	uint16_t port;
 	uint8_t lladdr[6];
 
@@ -264,8 +271,12 @@ static void test_receiving(struct net_pkt *pkt)
 
 	net_pkt_cursor_init(pkt);
 
-	if (net_recv_data(net_pkt_iface(pkt),
-			  net_pkt_rx_clone(pkt, K_NO_WAIT)) < 0) {
+	rx_pkt = net_pkt_rx_clone(pkt, K_NO_WAIT);
+	if (rx_pkt != NULL && mark_verified) {
+		net_pkt_set_chksum_state(rx_pkt, NET_PKT_CHKSUM_VERIFIED);
+	}
+
+	if (net_recv_data(net_pkt_iface(pkt), rx_pkt) < 0) {
 		test_failed = true;
 		zassert_true(false, "Packet %p receive failed\n", pkt);
 	}
@@ -308,6 +319,8 @@ static void test_fragment(struct net_pkt *pkt, bool offloaded)
 
 	zassert_true(net_pkt_is_chksum_done(pkt),
 		     "Checksum should me marked as ready on net_pkt");
+	zassert_not_equal(net_pkt_chksum_state(pkt), NET_PKT_CHKSUM_PARTIAL,
+			  "Fragment left for the driver to checksum");
 
 	/* Verify that payload has not been altered. */
 	data_len = net_pkt_get_len(pkt) - hdr_offset;
@@ -326,6 +339,44 @@ static void test_fragment(struct net_pkt *pkt, bool offloaded)
 	}
 }
 
+/* Complete a partial UDP checksum like a device would: sum the transport
+ * header and payload, the checksum field holding the pseudo-header sum.
+ */
+static void complete_partial_udp_chksum(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(udp_access, struct net_udp_hdr);
+	struct net_udp_hdr *udp_hdr;
+	struct net_pkt_cursor backup;
+	size_t len;
+	uint16_t sum;
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	zassert_ok(net_pkt_skip(pkt, sizeof(struct net_eth_hdr) +
+				net_pkt_ip_hdr_len(pkt) +
+				net_pkt_ipv6_ext_len(pkt)), "Cannot skip headers");
+
+	len = net_pkt_remaining_data(pkt);
+	zassert_true(len <= sizeof(verify_buf), "Packet too long");
+
+	udp_hdr = (struct net_udp_hdr *)net_pkt_get_data(pkt, &udp_access);
+	zassert_not_null(udp_hdr, "Cannot access UDP header");
+	zassert_not_equal(udp_hdr->chksum, 0, "Pseudo-header sum not set");
+
+	net_pkt_cursor_backup(pkt, &backup);
+	zassert_ok(net_pkt_read(pkt, verify_buf, len), "Cannot read packet");
+	net_pkt_cursor_restore(pkt, &backup);
+
+	sum = calc_chksum(0, verify_buf, len);
+	sum = (sum == 0U) ? 0xffff : htons(sum);
+	udp_hdr->chksum = ~sum;
+	zassert_ok(net_pkt_set_data(pkt, &udp_access), "Cannot write checksum");
+
+	net_pkt_set_chksum_state(pkt, NET_PKT_CHKSUM_NONE);
+	net_pkt_cursor_init(pkt);
+}
+
 static int eth_tx_offloading_disabled(const struct device *dev,
 				      struct net_pkt *pkt)
 {
@@ -345,6 +396,14 @@ static int eth_tx_offloading_disabled(const struct device *dev,
 		return 0;
 	}
 
+	if (net_pkt_chksum_state(pkt) == NET_PKT_CHKSUM_PARTIAL) {
+		zassert_true(partial_chksum, "Partial checksum not supported");
+		complete_partial_udp_chksum(pkt);
+	} else {
+		zassert_false(partial_chksum && test_proto == IPPROTO_UDP,
+			      "Checksum not left to the driver");
+	}
+
 	if (start_receiving) {
 		test_receiving(pkt);
 		return 0;
@@ -421,7 +480,7 @@ static enum ethernet_hw_caps eth_offloading_enabled(const struct device *dev)
 
 static enum ethernet_hw_caps eth_offloading_disabled(const struct device *dev)
 {
-	return 0;
+	return partial_chksum ? ETHERNET_HW_TX_CHKSUM_PARTIAL : 0;
 }
 
 static struct ethernet_api api_funcs_offloading_disabled = {
@@ -1010,8 +1069,22 @@ static void test_rx_chksum(sa_family_t family, bool offloaded)
 	zassert_equal(ret, 0, "Recv UDP failed (%d)\n", ret);
 
 	len = strlen(test_data);
-	ret = net_context_sendto(net_ctx, test_data, len, &dst_addr,
-				 addrlen, NULL, K_FOREVER, NULL);
+
+	if (zerocopy) {
+		struct net_buf *frags;
+
+		frags = net_buf_alloc(&zerocopy_pool, K_NO_WAIT);
+		zassert_not_null(frags, "Cannot allocate payload");
+		net_buf_add_mem(frags, test_data, len);
+
+		ret = net_context_send_frags(net_ctx, frags, &dst_addr,
+					     addrlen, NULL, K_FOREVER, NULL);
+		net_buf_unref(frags);
+	} else {
+		ret = net_context_sendto(net_ctx, test_data, len, &dst_addr,
+					 addrlen, NULL, K_FOREVER, NULL);
+	}
+
 	zassert_equal(ret, len, "Send UDP pkt failed (%d)\n", ret);
 
 	if (k_sem_take(wait_data, WAIT_TIME)) {
@@ -1045,6 +1118,21 @@ ZTEST(net_chksum_offload, test_rx_chksum_offload_enabled_test_v4)
 	test_rx_chksum(AF_INET, true);
 }
 
+/* The payload of zero-copy sends is not in the packet when the UDP header
+ * is written, so it must still be covered by the checksum.
+ */
+ZTEST(net_chksum_offload, test_rx_chksum_offload_disabled_test_v6_zerocopy)
+{
+	zerocopy = true;
+	test_rx_chksum(AF_INET6, false);
+}
+
+ZTEST(net_chksum_offload, test_rx_chksum_offload_disabled_test_v4_zerocopy)
+{
+	zerocopy = true;
+	test_rx_chksum(AF_INET, false);
+}
+
 static void test_rx_chksum_udp_frag(sa_family_t family, bool offloaded)
 {
 	struct k_sem *wait_data = offloaded ? &wait_data_off : &wait_data_nonoff;
@@ -1162,6 +1250,97 @@ ZTEST(net_chksum_offload, test_tx_chksum_offload_enabled_test_v4_udp_frag_bad)
 	test_rx_chksum_udp_frag_bad(AF_INET, true);
 }
 
+static void recv_cb_verified(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	zassert_not_null(proto_hdr->udp, "UDP header missing");
+	zassert_not_equal(net_calc_verify_chksum_udp(pkt), 0, "Checksum not corrupted");
+
+	k_sem_give(&wait_data_nonoff);
+
+	net_pkt_unref(pkt);
+}
+
+/* Packets marked as verified by the driver are accepted without checking
+ * their checksum, even on an interface without RX checksum offload.
+ */
+static void test_rx_chksum_verified(sa_family_t family)
+{
+	socklen_t addrlen = (family == AF_INET6) ? sizeof(struct sockaddr_in6) :
+						   sizeof(struct sockaddr_in);
+	struct net_context *net_ctx;
+	struct sockaddr dst_addr;
+	int ret, len;
+
+	net_ctx = test_udp_context_prepare(family, false, &dst_addr);
+	zassert_not_null(net_ctx, "Failed to obtain net_ctx");
+
+	test_started = true;
+	test_proto = IPPROTO_UDP;
+	start_receiving = true;
+	change_chksum = true;
+	mark_verified = true;
+
+	ret = net_context_recv(net_ctx, recv_cb_verified, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Recv UDP failed (%d)\n", ret);
+
+	len = strlen(test_data);
+	ret = net_context_sendto(net_ctx, test_data, len, &dst_addr,
+				 addrlen, NULL, K_FOREVER, NULL);
+	zassert_equal(ret, len, "Send UDP pkt failed (%d)\n", ret);
+
+	if (k_sem_take(&wait_data_nonoff, WAIT_TIME)) {
+		DBG("Timeout while waiting interface data\n");
+		zassert_false(true, "Timeout");
+	}
+
+	/* Let the receiver to receive the packets */
+	k_sleep(K_MSEC(10));
+
+	net_context_unref(net_ctx);
+}
+
+ZTEST(net_chksum_offload, test_rx_chksum_verified_test_v6)
+{
+	test_rx_chksum_verified(AF_INET6);
+}
+
+ZTEST(net_chksum_offload, test_rx_chksum_verified_test_v4)
+{
+	test_rx_chksum_verified(AF_INET);
+}
+
+/* The interface only completes the checksum of the packets the stack left
+ * partial, fragments must still be fully checksummed by the stack.
+ */
+ZTEST(net_chksum_offload, test_tx_chksum_partial_test_v6)
+{
+	partial_chksum = true;
+	test_rx_chksum(AF_INET6, false);
+}
+
+ZTEST(net_chksum_offload, test_tx_chksum_partial_test_v4)
+{
+	partial_chksum = true;
+	test_rx_chksum(AF_INET, false);
+}
+
+ZTEST(net_chksum_offload, test_tx_chksum_partial_test_v6_udp_frag)
+{
+	partial_chksum = true;
+	test_tx_chksum_udp_frag(AF_INET6, false);
+}
+
+ZTEST(net_chksum_offload, test_tx_chksum_partial_test_v4_udp_frag)
+{
+	partial_chksum = true;
+	test_tx_chksum_udp_frag(AF_INET, false);
+}
+
 static int icmp_handler(struct net_icmp_ctx *ctx,
 			struct net_pkt *pkt,
 			struct net_icmp_ip_hdr *hdr,
@@ -1341,6 +1520,9 @@ static void net_chksum_offload_tests_before(void *fixture)
 	start_receiving = false;
 	verify_fragment = false;
 	change_chksum = false;
+	mark_verified = false;
+	partial_chksum = false;
+	zerocopy = false;
 	fragment_count = 0;
 	fragment_offset = 0;
 	test_proto = 0;
@@ -0,0 +1,259 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define NET_LOG_LEVEL CONFIG_NET_L2_ETHERNET_LOG_LEVEL
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, NET_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+
+#include <zephyr/ztest.h>
+
+#define BUDGET CONFIG_NET_ETHERNET_NAPI_BUDGET
+#define WAIT_TIME K_SECONDS(1)
+
+/* Fake driver receiving frames from a ring filled by the tests */
+struct eth_napi_context {
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+
+	struct net_eth_napi napi;
+	bool irq_masked;
+	int pending;
+
+	int polls;
+	int completions;
+	int received;
+	int max_budget;
+};
+
+static struct eth_napi_context eth_context;
+
+static K_SEM_DEFINE(complete_sem, 0, UINT_MAX);
+
+static const uint8_t frame_payload[] = {
+	/* Unknown EtherType, dropped once received by the stack */
+	0x88, 0xb5, 'n', 'a', 'p', 'i',
+};
+
+static struct net_pkt *fake_rx_frame(struct eth_napi_context *ctx)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(ctx->iface,
+					   2 * sizeof(ctx->mac_addr) + sizeof(frame_payload),
+					   AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate RX packet");
+
+	zassert_ok(net_pkt_write(pkt, ctx->mac_addr, sizeof(ctx->mac_addr)));
+	zassert_ok(net_pkt_write(pkt, ctx->mac_addr, sizeof(ctx->mac_addr)));
+	zassert_ok(net_pkt_write(pkt, frame_payload, sizeof(frame_payload)));
+
+	return pkt;
+}
+
+static int eth_napi_poll(struct net_eth_napi *napi, int budget)
+{
+	struct eth_napi_context *ctx = CONTAINER_OF(napi, struct eth_napi_context, napi);
+	struct net_pkt *pkts[BUDGET];
+	int count = MIN(ctx->pending, budget);
+
+	zassert_true(ctx->irq_masked, "Polled with the RX interrupt unmasked");
+	zassert_true(budget <= BUDGET, "Budget too large");
+
+	ctx->polls++;
+	ctx->max_budget = MAX(ctx->max_budget, budget);
+
+	for (int i = 0; i < count; i++) {
+		pkts[i] = fake_rx_frame(ctx);
+	}
+
+	ctx->received += net_recv_data_batch(ctx->iface, pkts, count);
+	ctx->pending -= count;
+
+	return count;
+}
+
+static void eth_napi_complete(struct net_eth_napi *napi)
+{
+	struct eth_napi_context *ctx = CONTAINER_OF(napi, struct eth_napi_context, napi);
+
+	zassert_true(ctx->irq_masked, "Completed twice");
+
+	ctx->irq_masked = false;
+	ctx->completions++;
+
+	k_sem_give(&complete_sem);
+}
+
+static void eth_napi_rx_isr(const void *arg)
+{
+	struct eth_napi_context *ctx = (struct eth_napi_context *)arg;
+
+	if (ctx->irq_masked) {
+		return;
+	}
+
+	ctx->irq_masked = true;
+	net_eth_napi_schedule(&ctx->napi);
+}
+
+static void eth_napi_raise_rx(int frames)
+{
+	eth_context.pending += frames;
+	irq_offload(eth_napi_rx_isr, &eth_context);
+}
+
+static void eth_napi_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_napi_context *ctx = dev->data;
+
+	ctx->iface = iface;
+
+	net_if_set_link_addr(iface, ctx->mac_addr, sizeof(ctx->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_napi_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_napi_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static struct ethernet_api eth_napi_api = {
+	.iface_api.init = eth_napi_iface_init,
+
+	.get_capabilities = eth_napi_capabilities,
+	.send = eth_napi_send,
+};
+
+static int eth_napi_init(const struct device *dev)
+{
+	struct eth_napi_context *ctx = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	ctx->mac_addr[0] = 0x00;
+	ctx->mac_addr[1] = 0x00;
+	ctx->mac_addr[2] = 0x5E;
+	ctx->mac_addr[3] = 0x00;
+	ctx->mac_addr[4] = 0x53;
+	ctx->mac_addr[5] = 0x01;
+
+	net_eth_napi_init(&ctx->napi, eth_napi_poll, eth_napi_complete);
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_napi_test, "eth_napi_test", eth_napi_init, NULL,
+		    &eth_context, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    &eth_napi_api, NET_ETH_MTU);
+
+static void wait_complete(void)
+{
+	zassert_ok(k_sem_take(&complete_sem, WAIT_TIME), "Poll not completed");
+
+	/* Nothing may run after the completion */
+	zassert_not_ok(k_sem_take(&complete_sem, K_MSEC(50)), "Completed twice");
+}
+
+ZTEST(net_eth_napi, test_napi_under_budget)
+{
+	eth_napi_raise_rx(BUDGET - 1);
+	wait_complete();
+
+	zassert_equal(eth_context.polls, 1, "Polled %d times", eth_context.polls);
+	zassert_equal(eth_context.completions, 1);
+	zassert_equal(eth_context.received, BUDGET - 1);
+	zassert_equal(eth_context.max_budget, BUDGET);
+	zassert_false(eth_context.irq_masked, "RX interrupt left masked");
+}
+
+ZTEST(net_eth_napi, test_napi_budget_exhausted)
+{
+	/* A poll using up its budget is requeued, and only the poll
+	 * receiving less than the budget completes.
+	 */
+	eth_napi_raise_rx(2 * BUDGET + 1);
+	wait_complete();
+
+	zassert_equal(eth_context.polls, 3, "Polled %d times", eth_context.polls);
+	zassert_equal(eth_context.completions, 1);
+	zassert_equal(eth_context.received, 2 * BUDGET + 1);
+	zassert_equal(eth_context.pending, 0);
+	zassert_false(eth_context.irq_masked, "RX interrupt left masked");
+}
+
+ZTEST(net_eth_napi, test_napi_exact_budget)
+{
+	/* The driver cannot tell whether more frames are pending */
+	eth_napi_raise_rx(BUDGET);
+	wait_complete();
+
+	zassert_equal(eth_context.polls, 2, "Polled %d times", eth_context.polls);
+	zassert_equal(eth_context.completions, 1);
+	zassert_equal(eth_context.received, BUDGET);
+}
+
+ZTEST(net_eth_napi, test_napi_schedule_while_scheduled)
+{
+	/* The poll runs after this thread blocks */
+	eth_napi_raise_rx(1);
+	net_eth_napi_schedule(&eth_context.napi);
+	net_eth_napi_schedule(&eth_context.napi);
+	wait_complete();
+
+	zassert_equal(eth_context.polls, 1, "Polled %d times", eth_context.polls);
+	zassert_equal(eth_context.completions, 1);
+	zassert_equal(eth_context.received, 1);
+}
+
+ZTEST(net_eth_napi, test_napi_reschedule_after_complete)
+{
+	eth_napi_raise_rx(1);
+	wait_complete();
+
+	eth_napi_raise_rx(BUDGET + 1);
+	wait_complete();
+
+	zassert_equal(eth_context.polls, 3, "Polled %d times", eth_context.polls);
+	zassert_equal(eth_context.completions, 2);
+	zassert_equal(eth_context.received, BUDGET + 2);
+}
+
+static void net_eth_napi_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	eth_context.irq_masked = false;
+	eth_context.pending = 0;
+	eth_context.polls = 0;
+	eth_context.completions = 0;
+	eth_context.received = 0;
+	eth_context.max_budget = 0;
+
+	k_sem_reset(&complete_sem);
+}
+
+ZTEST_SUITE(net_eth_napi, NULL, NULL, net_eth_napi_before, NULL, NULL);
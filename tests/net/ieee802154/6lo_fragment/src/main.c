@@ -465,11 +465,10 @@ static struct net_buf frame_buf = {
 	.__buf = frame_buffer_data,
 };
 
-static bool test_fragment(struct net_fragment_data *data)
+/* Compress and fragment a packet built from data, one frame per buffer */
+static struct net_pkt *compress_and_fragment(struct net_fragment_data *data)
 {
-	struct net_pkt *rxpkt = NULL;
 	struct net_pkt *f_pkt = NULL;
-	int result = false;
 	struct ieee802154_6lo_fragment_ctx ctx;
 	struct net_buf *buf, *dfrag;
 	struct net_pkt *pkt;
@@ -478,7 +477,7 @@ static bool test_fragment(struct net_fragment_data *data)
 	pkt = create_pkt(data);
 	if (!pkt) {
 		TC_PRINT("%s: failed to create buffer\n", __func__);
-		goto end;
+		return NULL;
 	}
 
 #if DEBUG > 0
@@ -493,10 +492,7 @@ static bool test_fragment(struct net_fragment_data *data)
 	}
 
 	if (!ieee802154_6lo_requires_fragmentation(pkt, 0, 0)) {
-		f_pkt = pkt;
-		pkt = NULL;
-
-		goto reassemble;
+		return pkt;
 	}
 
 	f_pkt = net_pkt_alloc(K_FOREVER);
@@ -513,6 +509,8 @@ static bool test_fragment(struct net_fragment_data *data)
 
 		dfrag = net_pkt_get_frag(f_pkt, frame_buf.len, K_FOREVER);
 		if (!dfrag) {
+			net_pkt_unref(f_pkt);
+			f_pkt = NULL;
 			goto end;
 		}
 
@@ -524,10 +522,53 @@ static bool test_fragment(struct net_fragment_data *data)
 		frame_buf.len = 0U;
 	}
 
+end:
 	net_pkt_unref(pkt);
-	pkt = NULL;
 
-reassemble:
+	return f_pkt;
+}
+
+/* Copy a frame in a new RX packet, as received from src */
+static struct net_pkt *rx_frame(struct net_buf *buf, uint8_t src)
+{
+	struct net_pkt *rxpkt;
+	struct net_buf *dfrag;
+
+	rxpkt = net_pkt_rx_alloc(K_FOREVER);
+	if (!rxpkt) {
+		return NULL;
+	}
+
+	dfrag = net_pkt_get_frag(rxpkt, buf->len, K_FOREVER);
+	if (!dfrag) {
+		net_pkt_unref(rxpkt);
+		return NULL;
+	}
+
+	memcpy(dfrag->data, buf->data, buf->len);
+	dfrag->len = buf->len;
+
+	net_pkt_frag_add(rxpkt, dfrag);
+
+	net_pkt_set_overwrite(rxpkt, true);
+
+	(void)net_linkaddr_create(net_pkt_lladdr_src(rxpkt), &src, sizeof(src),
+				  NET_LINK_IEEE802154);
+
+	return rxpkt;
+}
+
+static bool test_fragment(struct net_fragment_data *data)
+{
+	struct net_pkt *rxpkt = NULL;
+	struct net_pkt *f_pkt = NULL;
+	int result = false;
+	struct net_buf *buf;
+
+	f_pkt = compress_and_fragment(data);
+	if (!f_pkt) {
+		goto end;
+	}
 
 #if DEBUG > 0
 	printk("length after compression and fragmentation %zd\n",
@@ -537,23 +578,11 @@ reassemble:
 
 	buf = f_pkt->buffer;
 	while (buf) {
-		rxpkt = net_pkt_rx_alloc(K_FOREVER);
+		rxpkt = rx_frame(buf, 0U);
 		if (!rxpkt) {
 			goto end;
 		}
 
-		dfrag = net_pkt_get_frag(rxpkt, buf->len, K_FOREVER);
-		if (!dfrag) {
-			goto end;
-		}
-
-		memcpy(dfrag->data, buf->data, buf->len);
-		dfrag->len = buf->len;
-
-		net_pkt_frag_add(rxpkt, dfrag);
-
-		net_pkt_set_overwrite(rxpkt, true);
-
 		switch (ieee802154_6lo_reassemble(rxpkt)) {
 		case NET_OK:
 			buf = buf->frags;
@@ -562,6 +591,7 @@ reassemble:
 			goto compare;
 		case NET_DROP:
 			net_pkt_unref(rxpkt);
+			rxpkt = NULL;
 			goto end;
 		}
 	}
@@ -578,10 +608,6 @@ compare:
 	}
 
 end:
-	if (pkt) {
-		net_pkt_unref(pkt);
-	}
-
 	if (f_pkt) {
 		net_pkt_unref(f_pkt);
 	}
@@ -656,4 +682,42 @@ ZTEST(ieee802154_6lo_fragment, test_fragment_ipv6_no_fragmentation_after_iphc)
 	zassert_true(ret);
 }
 
+/* Two neighbors sending datagrams of the same size with the same tag */
+ZTEST(ieee802154_6lo_fragment, test_fragment_interleaved_sources)
+{
+	struct net_pkt *rxpkt[2] = { NULL };
+	struct net_pkt *f_pkt;
+	struct net_buf *buf;
+	enum net_verdict verdict;
+
+	f_pkt = compress_and_fragment(&test_data_1);
+	zassert_not_null(f_pkt);
+	zassert_not_null(f_pkt->buffer->frags, "datagram not fragmented");
+
+	for (buf = f_pkt->buffer; buf; buf = buf->frags) {
+		for (uint8_t src = 0U; src < ARRAY_SIZE(rxpkt); src++) {
+			struct net_pkt *pkt = rx_frame(buf, src + 1U);
+
+			zassert_not_null(pkt);
+
+			verdict = ieee802154_6lo_reassemble(pkt);
+			if (buf->frags) {
+				zassert_equal(verdict, NET_OK, "datagram %u completed early", src);
+			} else {
+				zassert_equal(verdict, NET_CONTINUE, "datagram %u not completed",
+					      src);
+				rxpkt[src] = pkt;
+			}
+		}
+	}
+
+	for (uint8_t src = 0U; src < ARRAY_SIZE(rxpkt); src++) {
+		zassert_true(compare_data(rxpkt[src], &test_data_1),
+			     "datagram %u mismatch", src);
+		net_pkt_unref(rxpkt[src]);
+	}
+
+	net_pkt_unref(f_pkt);
+}
+
 ZTEST_SUITE(ieee802154_6lo_fragment, NULL, NULL, NULL, NULL, NULL);
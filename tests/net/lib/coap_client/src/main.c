@@ -932,3 +932,120 @@ ZTEST(coap_client, test_non_confirmable)
 	/* No callbacks from non-confirmable */
 	zassert_not_ok(k_sem_take(&sem1, K_MSEC(MORE_THAN_EXCHANGE_LIFETIME_MS)));
 }
+
+#if COAP_CLIENT_BLOCK2_WINDOW > 1
+#define BLOCK2_TEST_BLOCKS 10
+#define BLOCK2_TEST_LAST_LEN 17
+
+static uint8_t block2_responses[2 * COAP_CLIENT_BLOCK2_WINDOW][MAX_COAP_MSG_LEN];
+static size_t block2_response_len[ARRAY_SIZE(block2_responses)];
+static int block2_num_responses;
+static size_t block2_offset;
+static int block2_callbacks;
+
+/* Reply to each block request with the block, answers are taken from the most recent one */
+static ssize_t z_impl_zsock_sendto_custom_fake_block2(int sock, void *buf, size_t len, int flags,
+						      const struct sockaddr *dest_addr,
+						      socklen_t addrlen)
+{
+	static uint8_t payload[CONFIG_COAP_CLIENT_BLOCK_SIZE];
+	struct coap_packet request;
+	struct coap_packet response;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+	int block;
+	int num;
+
+	zassert_ok(coap_packet_parse(&request, buf, len, NULL, 0));
+	zassert_true(block2_num_responses < ARRAY_SIZE(block2_responses), "Too many requests");
+
+	block = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+	num = block < 0 ? 0 : GET_BLOCK_NUM(block);
+	tkl = coap_header_get_token(&request, token);
+
+	if (num >= BLOCK2_TEST_BLOCKS) {
+		coap_packet_init(&response, block2_responses[block2_num_responses],
+				 MAX_COAP_MSG_LEN, COAP_VERSION_1, COAP_TYPE_ACK, tkl, token,
+				 COAP_RESPONSE_CODE_BAD_OPTION, coap_header_get_id(&request));
+	} else {
+		coap_packet_init(&response, block2_responses[block2_num_responses],
+				 MAX_COAP_MSG_LEN, COAP_VERSION_1, COAP_TYPE_ACK, tkl, token,
+				 COAP_RESPONSE_CODE_CONTENT, coap_header_get_id(&request));
+		coap_append_option_int(&response, COAP_OPTION_BLOCK2,
+				       (num << 4) | ((num < BLOCK2_TEST_BLOCKS - 1) << 3) |
+				       coap_bytes_to_block_size(CONFIG_COAP_CLIENT_BLOCK_SIZE));
+		coap_packet_append_payload_marker(&response);
+		memset(payload, num, sizeof(payload));
+		coap_packet_append_payload(&response, payload,
+					   num == BLOCK2_TEST_BLOCKS - 1 ? BLOCK2_TEST_LAST_LEN :
+									   sizeof(payload));
+	}
+
+	block2_response_len[block2_num_responses++] = response.offset;
+	set_socket_events(sock, ZSOCK_POLLIN);
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_custom_fake_block2(int sock, void *buf, size_t max_len,
+							int flags, struct sockaddr *src_addr,
+							socklen_t *addrlen)
+{
+	size_t len;
+
+	zassert_true(block2_num_responses > 0, "No response to give");
+
+	block2_num_responses--;
+	len = block2_response_len[block2_num_responses];
+	memcpy(buf, block2_responses[block2_num_responses], len);
+
+	if (block2_num_responses == 0) {
+		clear_socket_events(sock, ZSOCK_POLLIN);
+	}
+
+	return len;
+}
+
+static void coap_callback_block2(const struct coap_client_response_data *data, void *user_data)
+{
+	zassert_equal(data->result_code, COAP_RESPONSE_CODE_CONTENT, "Unexpected response");
+	zassert_equal(data->offset, block2_offset, "Blocks delivered out of order");
+
+	for (size_t i = 0; i < data->payload_len; i++) {
+		zassert_equal(data->payload[i], data->offset / CONFIG_COAP_CLIENT_BLOCK_SIZE);
+	}
+
+	block2_offset += data->payload_len;
+	block2_callbacks++;
+
+	if (data->last_block) {
+		k_sem_give((struct k_sem *)user_data);
+	}
+}
+
+ZTEST(coap_client, test_block2_window)
+{
+	struct coap_client_request req = {
+		.method = COAP_METHOD_GET,
+		.confirmable = true,
+		.path = TEST_PATH,
+		.cb = coap_callback_block2,
+		.user_data = &sem1,
+	};
+
+	block2_num_responses = 0;
+	block2_offset = 0;
+	block2_callbacks = 0;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_custom_fake_block2;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_custom_fake_block2;
+
+	zassert_ok(coap_client_req(&client, 0, &dst_address, &req, NULL));
+	zassert_ok(k_sem_take(&sem1, K_MSEC(MORE_THAN_EXCHANGE_LIFETIME_MS)));
+
+	zassert_equal(block2_callbacks, BLOCK2_TEST_BLOCKS);
+	zassert_equal(block2_offset, (BLOCK2_TEST_BLOCKS - 1) * CONFIG_COAP_CLIENT_BLOCK_SIZE +
+				     BLOCK2_TEST_LAST_LEN);
+	/* Blocks past the end were requested before the last one was received */
+	zassert_true(z_impl_zsock_sendto_fake.call_count >= BLOCK2_TEST_BLOCKS);
+}
+#endif
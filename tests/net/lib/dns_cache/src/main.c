@@ -116,6 +116,77 @@ ZTEST(net_dns_cache_test, test_closest_expiry_removed)
 	zassert_equal(0, info_read.ai_family);
 }
 
+ZTEST(net_dns_cache_test, test_recently_used_kept)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *recently_used = "example.com";
+	enum dns_query_type query_type = DNS_QUERY_TYPE_A;
+
+	zassert_ok(dns_cache_add(&test_dns_cache, recently_used, &info_write,
+				 TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	for (size_t i = 0; i < TEST_DNS_CACHE_SIZE - 1; i++) {
+		zassert_ok(dns_cache_add(&test_dns_cache, "example2.com", &info_write,
+					 TEST_DNS_CACHE_DEFAULT_TTL),
+			   "Cache entry adding should work.");
+	}
+	zassert_equal(1,
+		      dns_cache_find(&test_dns_cache, recently_used, query_type, &info_read, 1));
+
+	/* The oldest example2.com entry goes first now */
+	zassert_ok(dns_cache_add(&test_dns_cache, "example3.com", &info_write,
+				 TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(1,
+		      dns_cache_find(&test_dns_cache, recently_used, query_type, &info_read, 1));
+	zassert_equal(AF_INET, info_read.ai_family);
+}
+
+ZTEST(net_dns_cache_test, test_negative_entry)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET6};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_A,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(0, info_read.ai_family);
+
+	/* Other address families are not affected */
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(1,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 + 1));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+}
+
+ZTEST(net_dns_cache_test, test_negative_entry_replaced)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+	enum dns_query_type query_type = DNS_QUERY_TYPE_A;
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, query_type,
+					  TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Negative cache entry adding should work.");
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, query_type, &info_read, 1));
+	zassert_equal(AF_INET, info_read.ai_family);
+
+	zassert_equal(-EINVAL, dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_SRV,
+						      TEST_DNS_CACHE_DEFAULT_TTL));
+}
+
 ZTEST(net_dns_cache_test, test_expired_entries_removed)
 {
 	struct dns_addrinfo info_write = {.ai_family = AF_INET};
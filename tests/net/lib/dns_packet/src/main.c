@@ -1533,6 +1533,62 @@ ZTEST(dns_packet, test_dns_invalid_compress_bits_cname)
 	net_buf_unref(dns_cname);
 }
 
+static uint8_t nxdomain_resp_ipv4[] = {
+	/* DNS msg header (12 bytes), NXDOMAIN with one authority RR */
+	0x12, 0x34, 0x81, 0x83, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00,
+
+	/* Query string (zephyr.test) */
+	0x06, 0x7a, 0x65, 0x70, 0x68, 0x79, 0x72, 0x04,
+	0x74, 0x65, 0x73, 0x74, 0x00,
+
+	/* Type and class */
+	0x00, 0x01, 0x00, 0x01,
+
+	/* SOA of test, TTL 3600 */
+	0xc0, 0x13, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00,
+	0x0e, 0x10, 0x00, 0x20,
+
+	/* MNAME (ns.test) and RNAME (host.test) */
+	0x02, 0x6e, 0x73, 0xc0, 0x13, 0x04, 0x68, 0x6f,
+	0x73, 0x74, 0xc0, 0x13,
+
+	/* Serial, refresh, retry, expire and minimum (300) */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1c, 0x20,
+	0x00, 0x00, 0x03, 0x84, 0x00, 0x12, 0x75, 0x00,
+	0x00, 0x00, 0x01, 0x2c,
+};
+
+ZTEST(dns_packet, test_dns_negative_ttl)
+{
+	uint8_t resp[sizeof(nxdomain_resp_ipv4)];
+	struct dns_msg_t dns_msg = { 0 };
+	uint32_t ttl = 0;
+	int ret;
+
+	memcpy(resp, nxdomain_resp_ipv4, sizeof(resp));
+	dns_msg.msg = resp;
+	dns_msg.msg_size = sizeof(resp);
+
+	ret = dns_unpack_response_query(&dns_msg);
+	zassert_equal(ret, 0, "Cannot unpack query (%d)", ret);
+
+	ret = dns_unpack_negative_ttl(&dns_msg, &ttl);
+	zassert_equal(ret, 0, "Cannot find negative TTL (%d)", ret);
+	zassert_equal(ttl, 300, "Wrong negative TTL %u", ttl);
+
+	/* Truncated SOA record */
+	dns_msg.msg_size = sizeof(resp) - 1;
+	ret = dns_unpack_negative_ttl(&dns_msg, &ttl);
+	zassert_equal(ret, -EINVAL, "Truncated SOA accepted (%d)", ret);
+
+	/* No authority section */
+	dns_msg.msg_size = sizeof(resp);
+	resp[9] = 0x00;
+	ret = dns_unpack_negative_ttl(&dns_msg, &ttl);
+	zassert_equal(ret, -ENOENT, "Negative TTL found without SOA (%d)", ret);
+}
+
 ZTEST_SUITE(dns_packet, NULL, NULL, NULL, NULL, NULL);
 /* TODO:
  *	1) add malformed DNS data (mostly done)
@@ -494,4 +494,90 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+#if HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0
+/* Requests from RFC7541, ch. C.4, encoded one after the other */
+static const struct example_headers test_dynamic_table_headers[] = {
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "http", { 0x86 }, 1 },
+	{ ":path", "/", { 0x84 }, 1 },
+	{ ":authority", "www.example.com",
+	  { 0x41, 0x8c, 0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a,
+	    0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff },
+	  14 },
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "http", { 0x86 }, 1 },
+	{ ":path", "/", { 0x84 }, 1 },
+	{ ":authority", "www.example.com", { 0xbe }, 1 },
+	{ "cache-control", "no-cache",
+	  { 0x58, 0x86, 0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf },
+	  8 },
+	{ ":method", "GET", { 0x82 }, 1 },
+	{ ":scheme", "https", { 0x87 }, 1 },
+	{ ":path", "/index.html", { 0x85 }, 1 },
+	{ ":authority", "www.example.com", { 0xbf }, 1 },
+	{ "custom-key", "custom-value",
+	  { 0x40, 0x88, 0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xa9,
+	    0x7d, 0x7f, 0x89, 0x25, 0xa8, 0x49, 0xe9, 0x5b,
+	    0xb8, 0xe8, 0xb4, 0xbf },
+	  20 },
+};
+
+static struct http_hpack_table test_table;
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_encode)
+{
+	http_hpack_table_init(&test_table);
+
+	for (int i = 0; i < ARRAY_SIZE(test_dynamic_table_headers); i++) {
+		const struct example_headers *example = &test_dynamic_table_headers[i];
+		struct http_hpack_header_buf hdr = {
+			.name = example->name,
+			.value = example->value,
+			.name_len = strlen(example->name),
+			.value_len = strlen(example->value)
+		};
+		int ret;
+
+		ret = http_hpack_encode_header_table(test_buf, sizeof(test_buf), &hdr,
+						     &test_table);
+		zassert_equal(ret, example->encoded_len, "Wrong encoding length (%d)", i);
+		zassert_mem_equal(test_buf, example->encoded, ret,
+				  "Header wrongly encoded (%d)", i);
+	}
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_size_update)
+{
+	struct http_hpack_header_buf hdr = {
+		.name = ":authority",
+		.value = "www.example.com",
+		.name_len = sizeof(":authority") - 1,
+		.value_len = sizeof("www.example.com") - 1,
+	};
+	int ret;
+
+	http_hpack_table_init(&test_table);
+
+	/* The size of the table is signalled once */
+	ret = http_hpack_encode_table_size_update(test_buf, sizeof(test_buf), &test_table);
+	zassert_true(ret > 0, "No size update");
+	zassert_equal(test_buf[0] & 0xe0, 0x20, "Not a size update");
+	zassert_equal(http_hpack_encode_table_size_update(test_buf, sizeof(test_buf),
+							  &test_table), 0);
+
+	/* A table of size 0 disables indexing */
+	http_hpack_table_set_max_size(&test_table, 0);
+	ret = http_hpack_encode_table_size_update(test_buf, sizeof(test_buf), &test_table);
+	zassert_equal(ret, 1, "Wrong encoding length");
+	zassert_equal(test_buf[0], 0x20, "Wrong size update");
+
+	for (int i = 0; i < 2; i++) {
+		ret = http_hpack_encode_header_table(test_buf, sizeof(test_buf), &hdr,
+						     &test_table);
+		zassert_equal(ret, 14, "Wrong encoding length");
+		zassert_equal(test_buf[0], 0x11, "Header indexed");
+	}
+}
+#endif /* HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0 */
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
@@ -571,6 +571,39 @@ ZTEST(lwm2m_registry, test_next_engine_obj_inst)
 	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
 }
 
+ZTEST(lwm2m_registry, test_obj_inst_lookup)
+{
+	struct lwm2m_engine_obj_inst *oi[4];
+	uint8_t u8_buf = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(oi); i++) {
+		zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, i)), 0);
+		oi[i] = lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, i));
+		zassert_not_null(oi[i]);
+		zassert_equal(oi[i]->obj_inst_id, i);
+	}
+
+	/* lookups still find the remaining instances once some are gone */
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 1)), 0);
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 2)), 0);
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 2)));
+	zassert_equal(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 0)), oi[0]);
+	zassert_equal(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 3)), oi[3]);
+
+	zassert_equal(lwm2m_set_res_buf(&LWM2M_OBJ(3303, 3, 6042), &u8_buf, sizeof(u8_buf),
+					sizeof(u8_buf), 0),
+		      0);
+	zassert_equal(lwm2m_set_u8(&LWM2M_OBJ(3303, 3, 6042), 0x5A), 0);
+	zassert_equal(u8_buf, 0x5A);
+	zassert_equal(lwm2m_set_u8(&LWM2M_OBJ(3303, 1, 6042), 0x5A), -ENOENT);
+	zassert_equal(lwm2m_set_u8(&LWM2M_OBJ(3303, 3, 49999), 0x5A), -ENOENT);
+
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 0)), 0);
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 3)), 0);
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 3)));
+}
+
 ZTEST(lwm2m_registry, test_null_strings)
 {
 	int ret;
@@ -64,6 +64,16 @@ static const uint8_t dns_sd_service_enumeration_query[] = {
 0x61, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x01
 };
 
+/* Same query, listing "_foo._udp.local" as a known answer */
+static const uint8_t dns_sd_known_answer_query[] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09,
+0x5f, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x07, 0x5f, 0x64, 0x6e,
+0x73, 0x2d, 0x73, 0x64, 0x04, 0x5f, 0x75, 0x64, 0x70, 0x05, 0x6c, 0x6f, 0x63,
+0x61, 0x6c, 0x00, 0x00, 0x0c, 0x00, 0x01, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x01,
+0x00, 0x00, 0x11, 0x94, 0x00, 0x0c, 0x04, 0x5f, 0x66, 0x6f, 0x6f, 0x04, 0x5f,
+0x75, 0x64, 0x70, 0xc0, 0x23
+};
+
 static const uint8_t service_enum_start[] = {
 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09,
 0x5f, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x07, 0x5f, 0x64, 0x6e,
@@ -279,6 +289,8 @@ static void cleanup(void *d)
 		}
 	}
 
+	responses_count = 0;
+
 	/* Clear semaphore counter */
 	while (k_sem_take(&wait_data, K_NO_WAIT) == 0) {
 		/* NOP */
@@ -440,4 +452,27 @@ ZTEST(test_mdns_responder, test_external_records)
 				     sizeof(payload_custom_tcp_local));
 }
 
+ZTEST(test_mdns_responder, test_known_answer_suppression)
+{
+	int res;
+	struct dns_sd_rec *record;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_MDNS_RESPONDER_KNOWN_ANSWER_SUPPRESSION);
+
+	record = alloc_ext_record("bar", "_foo", "_tcp", "local", NULL, 0, 5353);
+	zassert_not_null(record, "Failed to alloc the record");
+
+	/* The querier already knows the static "_foo._udp" service */
+	send_msg(dns_sd_known_answer_query, sizeof(dns_sd_known_answer_query));
+
+	res = k_sem_take(&wait_data, RESPONSE_TIMEOUT);
+	zassert_equal(res, 0, "Did not receive a response");
+
+	check_service_type_enum_resp(response_pkts[0], payload_foo_tcp_local,
+				     sizeof(payload_foo_tcp_local));
+
+	res = k_sem_take(&wait_data, RESPONSE_TIMEOUT);
+	zassert_not_equal(res, 0, "Known answer was sent again");
+}
+
 ZTEST_SUITE(test_mdns_responder, NULL, test_setup, before, cleanup, NULL);
@@ -445,6 +445,13 @@ static void publish_handler(struct mqtt_client *const client,
 		      "Invalid payload length: %d",
 		      evt->param.publish.message.payload.len);
 
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM)
+	/* The payload goes to payload_cb() instead. */
+	if (client->payload_cb != NULL) {
+		return;
+	}
+#endif
+
 	ret = mqtt_readall_publish_payload(client, buf, test_ctx.payload_left);
 	zassert_ok(ret, "Error while reading publish payload (%d)", ret);
 	zassert_mem_equal(test_ctx.payload, buf,
@@ -780,6 +787,104 @@ ZTEST(mqtt_client, test_mqtt_subscribe)
 	test_disconnect();
 }
 
+static void publish_param_init(struct mqtt_publish_param *param, enum mqtt_qos qos,
+			       uint16_t msg_id)
+{
+	memset(param, 0, sizeof(*param));
+	param->message.topic.qos = qos;
+	param->message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param->message.topic.topic.size = strlen(get_mqtt_topic());
+	param->message.payload.data = (uint8_t *)test_ctx.payload;
+	param->message.payload.len = strlen(test_ctx.payload);
+	param->message_id = msg_id;
+}
+
+static void test_publish_ack(void)
+{
+	int ret;
+
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	client_wait(false);
+	ret = mqtt_input(&client_ctx);
+	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+	test_ctx.puback_handled = false;
+}
+
+#if defined(CONFIG_MQTT_PUBLISH_MULTI)
+ZTEST(mqtt_client, test_mqtt_publish_multi)
+{
+	struct mqtt_publish_param params[3];
+	int ret;
+
+	test_ctx.payload = payload_short;
+	test_ctx.msg_id = 1;
+
+	publish_param_init(&params[0], MQTT_QOS_0_AT_MOST_ONCE, 0);
+	publish_param_init(&params[1], MQTT_QOS_0_AT_MOST_ONCE, 0);
+	publish_param_init(&params[2], MQTT_QOS_1_AT_LEAST_ONCE, test_ctx.msg_id);
+
+	test_connect();
+
+	ret = mqtt_publish_multi(&client_ctx, params, 0);
+	zassert_equal(ret, -EINVAL, "Empty publish should fail (%d)", ret);
+
+	ret = mqtt_publish_multi(&client_ctx, params, ARRAY_SIZE(params));
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* All messages came out of a single write in order. */
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	test_publish_ack();
+
+	test_disconnect();
+}
+#endif /* CONFIG_MQTT_PUBLISH_MULTI */
+
+#if CONFIG_MQTT_INFLIGHT_WINDOW == 1
+ZTEST(mqtt_client, test_mqtt_inflight_window)
+{
+	struct mqtt_publish_param param;
+	int ret;
+
+	test_ctx.payload = payload_short;
+	test_ctx.msg_id = 1;
+
+	test_connect();
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, test_ctx.msg_id);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* A new message id while the window is full */
+	param.message_id = 2;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EAGAIN, "Publish should wait for the window (%d)", ret);
+
+	/* QoS 0 messages are not held back */
+	param.message.topic.qos = MQTT_QOS_0_AT_MOST_ONCE;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* The message id in flight, which is not a retransmission */
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, test_ctx.msg_id);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EBUSY, "Message id reuse should fail (%d)", ret);
+
+	test_publish_ack();
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+
+	/* The PUBACK freed the window */
+	test_ctx.msg_id = 2;
+	param.message_id = test_ctx.msg_id;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+	test_publish_ack();
+
+	test_disconnect();
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW == 1 */
+
 static void test_pubsub(const uint8_t *payload, enum mqtt_qos qos)
 {
 	int ret;
@@ -818,6 +923,35 @@ ZTEST(mqtt_client, test_mqtt_pubsub_long)
 	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
 }
 
+#if defined(CONFIG_MQTT_PAYLOAD_STREAM)
+static int payload_cb(struct mqtt_client *client, const uint8_t *data, size_t len,
+		      uint32_t remaining)
+{
+	size_t offset = strlen(test_ctx.payload) - test_ctx.payload_left;
+
+	zassert_true(len > 0 && len <= test_ctx.payload_left, "Invalid chunk length %zu", len);
+	zassert_mem_equal(data, test_ctx.payload + offset, len, "Invalid payload content");
+
+	test_ctx.payload_left -= len;
+	zassert_equal(test_ctx.payload_left, remaining, "Invalid remaining length");
+
+	if (remaining == 0) {
+		test_ctx.publish_handled = true;
+	}
+
+	return 0;
+}
+
+ZTEST(mqtt_client, test_mqtt_pubsub_stream)
+{
+	client_ctx.payload_cb = payload_cb;
+
+	/* The payload is larger than the RX buffer, so it comes in chunks. */
+	test_pubsub(payload_long, MQTT_QOS_1_AT_LEAST_ONCE);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+}
+#endif /* CONFIG_MQTT_PAYLOAD_STREAM */
+
 static void mqtt_tests_before(void *fixture)
 {
 	ARG_UNUSED(fixture);
@@ -63,4 +63,43 @@ ZTEST(test_formatter, test_prometheus_formatter_simple)
 		      exposed, formatted);
 }
 
+/**
+ * @brief Test formatting one metric at a time
+ * @details The test shall format two metrics into the same buffer and check
+ * that the second one is appended to the first, that the number of written
+ * bytes is reported, and that a too small buffer is reported as such.
+ */
+ZTEST(test_formatter, test_prometheus_formatter_one_metric)
+{
+	int ret;
+	int written = 0;
+	char formatted[MAX_BUFFER_SIZE] = { 0 };
+	char exposed[] = "# HELP test_counter Test counter\n"
+			 "# TYPE test_counter counter\n"
+			 "test_counter{test=\"counter\"} 0\n"
+			 "# HELP test_counter2 Test counter 2\n"
+			 "# TYPE test_counter2 counter\n"
+			 "test_counter2{test=\"counter\"} 0\n";
+
+	test_counter.value = 0;
+	test_counter2.value = 0;
+
+	ret = prometheus_format_one_metric(&test_counter.base, formatted, sizeof(formatted),
+					   &written);
+	zassert_ok(ret, "Error formatting metric");
+
+	ret = prometheus_format_one_metric(&test_counter2.base, formatted, sizeof(formatted),
+					   &written);
+	zassert_ok(ret, "Error formatting metric 2");
+
+	zassert_equal(written, strlen(exposed), "Written length is not as expected");
+	zassert_equal(strcmp(formatted, exposed), 0,
+		      "Exposition format is not as expected (expected\n\"%s\", got\n\"%s\")",
+		      exposed, formatted);
+
+	ret = prometheus_format_one_metric(&test_counter.base, formatted, sizeof(formatted),
+					   &written);
+	zassert_equal(ret, -ENOMEM, "Buffer overflow not detected");
+}
+
 ZTEST_SUITE(test_formatter, NULL, NULL, NULL, NULL, NULL);
@@ -37,4 +37,40 @@ ZTEST(test_histogram, test_histogram_observe)
 	zassert_equal(test_histogram_m.sum, 3.0, "Histogram value is not 2");
 }
 
+/**
+ * @brief Test prometheus_histogram_set
+ *
+ * @details The test shall set the bucket counts of the histogram and check
+ * that the total count is their sum, and that a mismatching number of counts
+ * is rejected.
+ */
+ZTEST(test_histogram, test_histogram_set)
+{
+	struct prometheus_histogram_bucket buckets[] = {
+		{ .upper_bound = 1.0 },
+		{ .upper_bound = 2.0 },
+	};
+	const uint32_t counts[] = { 3, 4 };
+	int ret;
+
+	test_histogram_m.buckets = buckets;
+	test_histogram_m.num_buckets = ARRAY_SIZE(buckets);
+
+	ret = prometheus_histogram_set(&test_histogram_m, counts, 1, 10.0);
+	zassert_equal(ret, -EINVAL, "Mismatching counts accepted");
+
+	ret = prometheus_histogram_set(&test_histogram_m, counts, ARRAY_SIZE(counts), 10.0);
+	zassert_ok(ret, "Error setting histogram");
+
+	zassert_equal(buckets[0].count, 3, "Bucket count is not 3");
+	zassert_equal(buckets[1].count, 4, "Bucket count is not 4");
+	zassert_equal(test_histogram_m.count, 7, "Histogram count is not 7");
+	zassert_equal(test_histogram_m.sum, 10.0, "Histogram sum is not 10");
+
+	test_histogram_m.buckets = NULL;
+	test_histogram_m.num_buckets = 0;
+	test_histogram_m.count = 0;
+	test_histogram_m.sum = 0.0;
+}
+
 ZTEST_SUITE(test_histogram, NULL, NULL, NULL, NULL, NULL);
@@ -464,4 +464,87 @@ ZTEST(mgmt_fn_test_suite, test_mgmt_duplicate_handler)
 	net_mgmt_del_event_callback(&cb);
 }
 
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
+
+#define FULL_QUEUE_LATE_INFO 0xff
+
+static K_SEM_DEFINE(full_queue_unblock, 0, K_SEM_MAX_LIMIT);
+static uint8_t full_queue_rx[CONFIG_NET_MGMT_EVENT_QUEUE_SIZE + 2];
+static uint32_t full_queue_rx_calls;
+
+static void full_queue_handler(struct net_mgmt_event_callback *cb,
+			       uint64_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(iface);
+
+	if (mgmt_event != TEST_MGMT_EVENT || cb->info_length != sizeof(uint8_t)) {
+		return;
+	}
+
+	(void)k_sem_take(&full_queue_unblock, K_FOREVER);
+
+	if (full_queue_rx_calls < ARRAY_SIZE(full_queue_rx)) {
+		full_queue_rx[full_queue_rx_calls] = *(const uint8_t *)cb->info;
+	}
+
+	full_queue_rx_calls++;
+}
+
+static void full_queue_notify(uint8_t info)
+{
+	net_mgmt_event_notify_with_info(TEST_MGMT_EVENT, NULL, &info, sizeof(info));
+}
+
+ZTEST(mgmt_fn_test_suite, test_mgmt_full_queue)
+{
+	struct net_mgmt_event_callback cb;
+	uint32_t late = 0;
+
+	net_mgmt_init_event_callback(&cb, full_queue_handler, TEST_MGMT_EVENT);
+	net_mgmt_add_event_callback(&cb);
+
+	/* The first event is taken off the queue and blocks the handler */
+	full_queue_notify(0);
+	k_msleep(THREAD_SLEEP);
+
+	for (uint8_t i = 1; i <= CONFIG_NET_MGMT_EVENT_QUEUE_SIZE; i++) {
+		full_queue_notify(i);
+	}
+
+	/* This one finds the queue full and is lost */
+	full_queue_notify(FULL_QUEUE_LATE_INFO);
+
+	/* Make room for a single event, the queue is still not empty */
+	k_sem_give(&full_queue_unblock);
+	k_msleep(THREAD_SLEEP);
+
+	/* Sent again, it must not be coalesced with the lost one */
+	full_queue_notify(FULL_QUEUE_LATE_INFO);
+
+	for (int i = 0; i < ARRAY_SIZE(full_queue_rx); i++) {
+		k_sem_give(&full_queue_unblock);
+	}
+
+	k_msleep(THREAD_SLEEP);
+	net_mgmt_del_event_callback(&cb);
+	k_sem_reset(&full_queue_unblock);
+
+	zassert_equal(full_queue_rx_calls, CONFIG_NET_MGMT_EVENT_QUEUE_SIZE + 2,
+		      "Received %u events", full_queue_rx_calls);
+
+	for (int i = 0; i <= CONFIG_NET_MGMT_EVENT_QUEUE_SIZE; i++) {
+		zassert_equal(full_queue_rx[i], i, "Event %d out of order", i);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(full_queue_rx); i++) {
+		if (full_queue_rx[i] == FULL_QUEUE_LATE_INFO) {
+			late++;
+		}
+	}
+
+	zassert_equal(late, 1, "Event sent after a full queue received %u times", late);
+}
+
+#endif /* CONFIG_NET_MGMT_EVENT_QUEUE */
+
 ZTEST_SUITE(mgmt_fn_test_suite, NULL, NULL, NULL, NULL, NULL);
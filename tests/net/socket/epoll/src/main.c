@@ -0,0 +1,196 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+
+#include "../../socket_helpers.h"
+
+#define MY_IPV4_ADDR "127.0.0.1"
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+#define TEST_STR "test"
+#define WAIT_MS 100
+
+static int s_sock = -1;
+static int c_sock = -1;
+static int epfd = -1;
+
+static void send_msg(void)
+{
+	zassert_equal(zsock_send(c_sock, TEST_STR, sizeof(TEST_STR), 0), sizeof(TEST_STR));
+}
+
+static void recv_msg(void)
+{
+	char buf[sizeof(TEST_STR)];
+
+	zassert_equal(zsock_recv(s_sock, buf, sizeof(buf), 0), sizeof(TEST_STR));
+}
+
+static void add(int fd, uint32_t events)
+{
+	struct zsock_epoll_event event = {
+		.events = events,
+		.data.fd = fd,
+	};
+
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, fd, &event));
+}
+
+static int wait_one(struct zsock_epoll_event *event, int timeout)
+{
+	return zsock_epoll_wait(epfd, event, 1, timeout);
+}
+
+/**
+ * @brief Test level-triggered events
+ *
+ * @details Events are reported on every wait until the data is read.
+ */
+ZTEST(net_socket_epoll, test_level_triggered)
+{
+	struct zsock_epoll_event event;
+
+	add(s_sock, ZSOCK_EPOLLIN);
+
+	zassert_equal(wait_one(&event, 0), 0, "ready without data");
+
+	send_msg();
+
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(wait_one(&event, WAIT_MS), 1);
+		zassert_equal(event.events, ZSOCK_EPOLLIN);
+		zassert_equal(event.data.fd, s_sock);
+	}
+
+	recv_msg();
+	zassert_equal(wait_one(&event, 0), 0, "ready after reading the data");
+}
+
+/**
+ * @brief Test edge-triggered events
+ *
+ * @details Events are reported once per received datagram, even if older
+ * datagrams were not read.
+ */
+ZTEST(net_socket_epoll, test_edge_triggered)
+{
+	struct zsock_epoll_event event;
+
+	add(s_sock, ZSOCK_EPOLLIN | ZSOCK_EPOLLET);
+
+	send_msg();
+	zassert_equal(wait_one(&event, WAIT_MS), 1);
+	zassert_equal(event.events, ZSOCK_EPOLLIN);
+	zassert_equal(wait_one(&event, 0), 0, "reported twice");
+
+	send_msg();
+	zassert_equal(wait_one(&event, WAIT_MS), 1);
+	zassert_equal(wait_one(&event, 0), 0, "reported twice");
+
+	recv_msg();
+	recv_msg();
+}
+
+/**
+ * @brief Test one-shot events and re-arming
+ */
+ZTEST(net_socket_epoll, test_oneshot)
+{
+	struct zsock_epoll_event event = {
+		.events = ZSOCK_EPOLLIN | ZSOCK_EPOLLONESHOT,
+	};
+
+	add(s_sock, event.events);
+
+	send_msg();
+	zassert_equal(wait_one(&event, WAIT_MS), 1);
+
+	send_msg();
+	zassert_equal(wait_one(&event, WAIT_MS), 0, "reported when disarmed");
+
+	event.events = ZSOCK_EPOLLIN;
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, s_sock, &event));
+	zassert_equal(wait_one(&event, 0), 1, "not reported when re-armed");
+
+	recv_msg();
+	recv_msg();
+}
+
+/**
+ * @brief Test writable sockets and changes of the monitored set
+ */
+ZTEST(net_socket_epoll, test_ctl)
+{
+	struct zsock_epoll_event event = {
+		.events = ZSOCK_EPOLLOUT,
+	};
+
+	add(c_sock, ZSOCK_EPOLLOUT);
+	zassert_equal(wait_one(&event, 0), 1);
+	zassert_equal(event.events, ZSOCK_EPOLLOUT);
+	zassert_equal(event.data.fd, c_sock);
+
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, c_sock, &event), -1);
+	zassert_equal(errno, EEXIST);
+
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, c_sock, NULL));
+	zassert_equal(wait_one(&event, 0), 0, "reported after removal");
+
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, c_sock, NULL), -1);
+	zassert_equal(errno, ENOENT);
+
+	/* Only sockets can be monitored */
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, epfd, &event), -1);
+	zassert_equal(errno, EPERM);
+}
+
+static void *setup(void)
+{
+	struct sockaddr_in s_saddr;
+	struct sockaddr_in c_saddr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &c_sock, &c_saddr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	zassert_ok(zsock_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)));
+	zassert_ok(zsock_bind(c_sock, (struct sockaddr *)&c_saddr, sizeof(c_saddr)));
+	zassert_ok(zsock_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	epfd = zsock_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Closing the instance forgets the monitored sockets */
+	zsock_close(epfd);
+}
+
+static void teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zsock_close(c_sock);
+	zsock_close(s_sock);
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, setup, before, after, teardown);
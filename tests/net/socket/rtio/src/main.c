@@ -0,0 +1,150 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_rtio.h>
+#include <zephyr/rtio/rtio.h>
+
+#include "../../socket_helpers.h"
+
+#define MY_IPV4_ADDR "127.0.0.1"
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+#define NUM_MSGS 3
+#define MSG_LEN 16
+
+RTIO_DEFINE(r, 8, 8);
+
+ZSOCK_RTIO_IODEV_DEFINE(server_iodev);
+ZSOCK_RTIO_IODEV_DEFINE(client_iodev);
+ZSOCK_RTIO_IODEV_DEFINE(unbound_iodev);
+
+static int s_sock = -1;
+static int c_sock = -1;
+
+static uint8_t rx_bufs[NUM_MSGS][MSG_LEN];
+
+static void consume(int result, void *userdata)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&r);
+
+	zassert_equal(cqe->result, result, "result %d", cqe->result);
+	zassert_equal_ptr(cqe->userdata, userdata);
+	rtio_cqe_release(&r, cqe);
+}
+
+/**
+ * @brief Test receives outstanding before the data arrives
+ *
+ * @details Queue several receives on a socket, check that nothing completes
+ * until datagrams are sent, and that they complete in submission order.
+ */
+ZTEST(net_socket_rtio, test_rx)
+{
+	struct rtio_sqe *sqe;
+	char msg[MSG_LEN];
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_read(sqe, &server_iodev, RTIO_PRIO_NORM, rx_bufs[i],
+				   MSG_LEN, rx_bufs[i]);
+	}
+
+	zassert_ok(rtio_submit(&r, 0));
+
+	k_msleep(50);
+	zassert_is_null(rtio_cqe_consume(&r), "completed without data");
+	zassert_equal(zsock_rtio_iodev_set_fd(&server_iodev, -1), -EBUSY);
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		snprintk(msg, sizeof(msg), "message %d", i);
+		zassert_equal(zsock_send(c_sock, msg, strlen(msg) + 1, 0), strlen(msg) + 1);
+	}
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		snprintk(msg, sizeof(msg), "message %d", i);
+		consume(strlen(msg) + 1, rx_bufs[i]);
+		zassert_str_equal((char *)rx_bufs[i], msg);
+	}
+}
+
+/**
+ * @brief Test sends through a socket RTIO device
+ */
+ZTEST(net_socket_rtio, test_tx)
+{
+	static const uint8_t data[] = "rtio send";
+	struct rtio_sqe *sqe;
+	char buf[MSG_LEN];
+
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_write(sqe, &client_iodev, RTIO_PRIO_NORM, data, sizeof(data), NULL);
+
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_tiny_write(sqe, &client_iodev, RTIO_PRIO_NORM,
+				(const uint8_t *)"tiny", 5, buf);
+
+	zassert_ok(rtio_submit(&r, 0));
+
+	consume(sizeof(data), NULL);
+	consume(5, buf);
+
+	zassert_equal(zsock_recv(s_sock, buf, sizeof(buf), 0), sizeof(data));
+	zassert_mem_equal(buf, data, sizeof(data));
+	zassert_equal(zsock_recv(s_sock, buf, sizeof(buf), 0), 5);
+	zassert_str_equal(buf, "tiny");
+}
+
+/**
+ * @brief Test a socket RTIO device without a socket
+ */
+ZTEST(net_socket_rtio, test_no_socket)
+{
+	struct rtio_sqe *sqe;
+
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &unbound_iodev, RTIO_PRIO_NORM, rx_bufs[0], MSG_LEN, NULL);
+
+	zassert_ok(rtio_submit(&r, 0));
+	consume(-EBADF, NULL);
+}
+
+static void *setup(void)
+{
+	struct sockaddr_in s_saddr;
+	struct sockaddr_in c_saddr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &c_sock, &c_saddr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	zassert_ok(zsock_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)));
+	zassert_ok(zsock_bind(c_sock, (struct sockaddr *)&c_saddr, sizeof(c_saddr)));
+	zassert_ok(zsock_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr)));
+
+	zassert_ok(zsock_rtio_iodev_set_fd(&server_iodev, s_sock));
+	zassert_ok(zsock_rtio_iodev_set_fd(&client_iodev, c_sock));
+
+	return NULL;
+}
+
+static void teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zsock_close(c_sock);
+	zsock_close(s_sock);
+}
+
+ZTEST_SUITE(net_socket_rtio, NULL, setup, NULL, NULL, teardown);
@@ -2661,6 +2661,76 @@ ZTEST(net_socket_tcp, test_v6_listen_backlog)
 	test_common_listen_backlog(AF_INET6, TEST_BACKLOG_MAX);
 }
 
+#if defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+#define ZC_BUF_SIZE 32
+
+NET_BUF_POOL_FIXED_DEFINE(zc_pool, 1, ZC_BUF_SIZE, 0, NULL);
+#endif
+
+ZTEST(net_socket_tcp, test_v4_send_zerocopy_then_copy)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_SEND_ZEROCOPY);
+
+#if defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+	/* Data copied after a zero-copy send must not be appended in the
+	 * tailroom of the caller's buffer.
+	 */
+	static const char tail[] = "tail";
+	uint8_t expected[ZC_BUF_SIZE];
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) + sizeof(tail) - 2];
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *buf;
+	ssize_t len;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	buf = net_buf_alloc(&zc_pool, K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+	memset(buf->data, 0xaa, buf->size);
+	net_buf_add_mem(buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL));
+	memcpy(expected, buf->data, buf->size);
+
+	/* Keep the peer from acknowledging the buffer before the copied
+	 * data is queued behind it.
+	 */
+	k_sched_lock();
+	len = zsock_send_zerocopy(c_sock, buf, 0, NULL, 0);
+	zassert_equal(len, strlen(TEST_STR_SMALL), "send_zerocopy failed, %d", errno);
+	test_send(c_sock, tail, strlen(tail), 0);
+	k_sched_unlock();
+
+	len = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_WAITALL);
+	zassert_equal(len, sizeof(rx_buf), "invalid length %zd", len);
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL), "invalid data");
+	zassert_mem_equal(rx_buf + strlen(TEST_STR_SMALL), tail, strlen(tail), "invalid data");
+
+	zassert_equal(buf->len, strlen(TEST_STR_SMALL), "caller's buffer was extended");
+	zassert_mem_equal(buf->data, expected, buf->size, "caller's buffer was modified");
+	net_buf_unref(buf);
+
+	test_close(c_sock);
+	test_eof(new_sock);
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#endif /* CONFIG_NET_SOCKETS_SEND_ZEROCOPY */
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
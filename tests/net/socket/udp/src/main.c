@@ -3715,6 +3715,179 @@ ZTEST(net_socket_udp, test_47_ipv4_mapped_to_ipv6_sendmsg)
 	test_ipv4_mapped_to_ipv6_send_common(IPV4_MAPPED_TO_IPV6_SENDMSG);
 }
 
+ZTEST(net_socket_udp, test_48_v4_recv_zerocopy)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_RECV_ZEROCOPY);
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *frags;
+	ssize_t len;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	len = zsock_recv_zerocopy(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(len, -1, "recv_zerocopy should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	/* Spans several network buffers */
+	len = zsock_sendto(client_sock, BUF_AND_SIZE(TEST_STR2), 0,
+			   (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(len, STRLEN(TEST_STR2), "sendto failed");
+
+	len = zsock_recv_zerocopy(server_sock, &frags, 0,
+				  (struct sockaddr *)&addr, &addrlen);
+	zassert_equal(len, STRLEN(TEST_STR2), "invalid length %zd", len);
+	zassert_not_null(frags, "no fragments");
+	zassert_equal(net_buf_frags_len(frags), STRLEN(TEST_STR2), "headers not stripped");
+	zassert_equal(addrlen, sizeof(addr), "invalid address length");
+	zassert_equal(addr.sin_port, client_addr.sin_port, "invalid source port");
+
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), frags, 0, len), len);
+	zassert_mem_equal(rx_buf, TEST_STR2, STRLEN(TEST_STR2), "invalid data");
+	net_buf_unref(frags);
+
+	len = zsock_recv_zerocopy(server_sock, &frags, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(len, -1, "peek is not supported");
+	zassert_equal(errno, EINVAL, "unexpected errno %d", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+}
+
+#if defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+static K_SEM_DEFINE(zc_released, 0, 1);
+
+static void zc_buf_destroy(struct net_buf *buf)
+{
+	net_buf_destroy(buf);
+	k_sem_give(&zc_released);
+}
+
+NET_BUF_POOL_HEAP_DEFINE(zc_pool, 1, 0, zc_buf_destroy);
+#endif
+
+ZTEST(net_socket_udp, test_49_v4_send_zerocopy)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_SEND_ZEROCOPY);
+
+#if defined(CONFIG_NET_SOCKETS_SEND_ZEROCOPY)
+	static const char data[] = TEST_STR2;
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct net_buf *buf;
+	ssize_t len;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	buf = net_buf_alloc_with_data(&zc_pool, (void *)data, STRLEN(TEST_STR2), K_NO_WAIT);
+	zassert_not_null(buf, "cannot allocate buffer");
+
+	len = zsock_send_zerocopy(client_sock, buf, 0,
+				  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(len, STRLEN(TEST_STR2), "send_zerocopy failed, %d", errno);
+	net_buf_unref(buf);
+
+	len = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR2), "invalid length %zd", len);
+	zassert_mem_equal(rx_buf, TEST_STR2, STRLEN(TEST_STR2), "invalid data");
+
+	/* The stack must have released the data once sent */
+	zassert_ok(k_sem_take(&zc_released, K_SECONDS(1)), "buffer not released");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#endif /* CONFIG_NET_SOCKETS_SEND_ZEROCOPY */
+}
+
+#define MMSG_COUNT 5
+
+ZTEST_USER(net_socket_udp, test_50_v4_sendmmsg_recvmmsg)
+{
+	static const char * const data[MMSG_COUNT] = { "a", "bb", "ccc", "dddd", "eeeee" };
+	char rx[MMSG_COUNT][sizeof("eeeee")];
+	struct iovec tx_iov[MMSG_COUNT];
+	struct iovec rx_iov[MMSG_COUNT];
+	struct mmsghdr msgs[MMSG_COUNT];
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_iov[i].iov_base = (void *)data[i];
+		tx_iov[i].iov_len = strlen(data[i]);
+		msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", errno);
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(data[i]), "invalid length");
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		rx_iov[i].iov_base = rx[i];
+		rx_iov[i].iov_len = sizeof(rx[i]);
+		msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, 0, NULL);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", errno);
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(data[i]), "invalid length");
+		zassert_mem_equal(rx[i], data[i], strlen(data[i]), "invalid data");
+	}
+
+	/* Nothing left, the first message is not waited for with DONTWAIT */
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT,
+			    ZSOCK_MSG_WAITFORONE | ZSOCK_MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno %d", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -95,6 +95,12 @@ static const unsigned char frame2[] = {
 	0xe9, 0xdc
 };
 
+/* Unmasked text message in two fragments, "test " and "message" */
+static const unsigned char fragmented[] = {
+	0x01, 0x05, 't', 'e', 's', 't', ' ',
+	0x80, 0x07, 'm', 'e', 's', 's', 'a', 'g', 'e'
+};
+
 /* Empty websocket frame, opcode is ping, without mask */
 static const unsigned char ping[] = {0x89, 0x00};
 
@@ -461,6 +467,61 @@ ZTEST(net_websocket, test_recv_in_small_buffer)
 			  "Invalid message, should be '%s' was '%s'", frame1_msg, recv_buf);
 }
 
+ZTEST(net_websocket, test_send_inplace_lorem_ipsum)
+{
+	static struct websocket_context ctx;
+	static uint8_t buf[WEBSOCKET_HEADROOM + sizeof(lorem_ipsum)];
+	int fd, ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	test_msg_len = sizeof(lorem_ipsum) - 1;
+	memcpy(&buf[WEBSOCKET_HEADROOM], lorem_ipsum, test_msg_len);
+
+	fd = test_fd_alloc(&ctx);
+	ret = websocket_send_msg_inplace(fd, buf, test_msg_len,
+					 WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+					 SYS_FOREVER_MS);
+	zassert_equal(ret, test_msg_len,
+		      "Should have sent %zd bytes but sent %d instead",
+		      test_msg_len, ret);
+
+	zvfs_free_fd(fd);
+}
+
+ZTEST(net_websocket, test_recv_fragmented_msg)
+{
+	struct websocket_context ctx;
+	uint32_t msg_type = -1;
+	uint64_t remaining = -1;
+	int ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	memcpy(feed_buf, fragmented, sizeof(fragmented));
+
+	ret = test_recv_buf(feed_buf, sizeof(fragmented), &ctx, &msg_type, &remaining,
+			    recv_buf, sizeof(recv_buf));
+	zassert_equal(ret, 5, "Should have received 5 bytes but ret %d", ret);
+	zassert_equal(msg_type, WEBSOCKET_FLAG_TEXT, "First fragment type 0x%x", msg_type);
+	zassert_mem_equal(recv_buf, "test ", 5);
+
+	/* The continuation frame is already in the parser buffer */
+	ret = test_recv_buf(feed_buf, 0, &ctx, &msg_type, &remaining,
+			    &recv_buf[5], sizeof(recv_buf) - 5);
+	zassert_equal(ret, 7, "Should have received 7 bytes but ret %d", ret);
+	zassert_equal(msg_type, WEBSOCKET_FLAG_TEXT | WEBSOCKET_FLAG_FINAL,
+		      "Last fragment type 0x%x", msg_type);
+	zassert_equal(remaining, 0, "Msg not empty");
+	zassert_mem_equal(recv_buf, frame1_msg, sizeof(frame1_msg) - 1);
+}
+
 static void *setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
@@ -38,6 +38,12 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 #define MY_PORT 4242
 #define PEER_PORT 4242
 
+/* Tests in which the peer acknowledges bulk data sent by the device */
+#if defined(CONFIG_NET_TCP_SACK) || \
+	(defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE) && defined(CONFIG_NET_TCP_FAST_RETRANSMIT))
+#define TEST_BULK_DATA
+#endif
+
 /* Data (1280 bytes) to be sent */
 static const char lorem_ipsum[] = LOREM_IPSUM;
 
@@ -116,6 +122,7 @@ static enum test_case_no {
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
 	TEST_SERVER_FIN_ACK_AFTER_DATA = 21,
+	TEST_CLIENT_BULK = 22,
 } test_case_no;
 
 static enum test_state t_state;
@@ -143,6 +150,9 @@ static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
 static void handle_server_fin_ack_after_data_test(sa_family_t af, struct tcphdr *th);
+#if defined(TEST_BULK_DATA)
+static void handle_client_bulk_test(struct net_pkt *pkt, struct tcphdr *th);
+#endif
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -240,6 +250,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options added to the next packet sent by the peer */
+static uint8_t peer_options[40];
+static uint8_t peer_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -250,10 +264,12 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
-	uint8_t opts_len = 0;
+	const uint8_t *opts = peer_options;
+	uint8_t opts_len = peer_options_len;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
 	}
 
@@ -289,11 +305,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = htons(NET_IPV6_MTU);
@@ -308,9 +320,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -498,6 +510,11 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_FIN_ACK_AFTER_DATA:
 		handle_server_fin_ack_after_data_test(net_pkt_family(pkt), &th);
 		break;
+#if defined(TEST_BULK_DATA)
+	case TEST_CLIENT_BULK:
+		handle_client_bulk_test(pkt, &th);
+		break;
+#endif
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -511,6 +528,188 @@ fail:
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_TSO)
+/* The TSO tests use an Ethernet interface splitting the segments itself.
+ * Its "hardware" is the peer, replies are passed directly to IP.
+ */
+#define TSO_MSS 536 /* Default MSS, the peer sends no MSS option */
+
+static struct in_addr tso_my_addr = { { { 198, 51, 100, 1 } } };
+static struct in_addr tso_peer_addr = { { { 198, 51, 100, 2 } } };
+static struct in_addr tso_netmask = { { { 255, 255, 255, 0 } } };
+static struct sockaddr_in tso_peer_addr_s = {
+	.sin_family = AF_INET,
+	.sin_port = htons(PEER_PORT),
+	.sin_addr = { { { 198, 51, 100, 2 } } },
+};
+
+static struct net_if *tso_iface;
+static uint8_t tso_data[3 * TSO_MSS + 100];
+static uint16_t tso_seg_size;
+static int tso_data_segments;
+
+static void handle_tso_test(struct tcphdr *th, size_t payload_len,
+			    uint16_t seg_size);
+
+static void tso_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static enum ethernet_hw_caps tso_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ETHERNET_HW_TCP_TSO;
+}
+
+static int tso_tester_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct net_ipv4_hdr ip_hdr;
+	struct tcphdr th;
+	size_t hdr_len;
+
+	ARG_UNUSED(dev);
+
+	if (net_pkt_family(pkt) != AF_INET) {
+		return 0;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, sizeof(struct net_eth_hdr)) ||
+	    net_pkt_read(pkt, &ip_hdr, sizeof(ip_hdr)) ||
+	    ip_hdr.proto != IPPROTO_TCP) {
+		return 0;
+	}
+
+	hdr_len = (ip_hdr.vhl & NET_IPV4_IHL_MASK) * 4U;
+
+	zassert_ok(net_pkt_skip(pkt, hdr_len - sizeof(ip_hdr)));
+	zassert_ok(net_pkt_read(pkt, &th, sizeof(th)));
+
+	/* The whole segment is handed over, neither split nor fragmented */
+	zassert_equal(net_pkt_get_len(pkt) - sizeof(struct net_eth_hdr),
+		      ntohs(ip_hdr.len), "Segment length mismatch");
+
+	hdr_len += th.th_off * 4U;
+
+	net_pkt_cursor_init(pkt);
+
+	handle_tso_test(&th, ntohs(ip_hdr.len) - hdr_len, net_pkt_tso_size(pkt));
+
+	return 0;
+}
+
+static const struct ethernet_api tso_if_api = {
+	.iface_api.init = tso_iface_init,
+	.get_capabilities = tso_get_capabilities,
+	.send = tso_tester_send,
+};
+
+ETH_NET_DEVICE_INIT(net_tcp_tso_test, "net_tcp_tso_test", NULL, NULL,
+		    NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		    &tso_if_api, NET_ETH_MTU);
+
+static void tso_iface_setup(void)
+{
+	struct net_if_addr *ifaddr;
+
+	tso_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(ETHERNET));
+	zassert_not_null(tso_iface, "TSO interface not available");
+
+	ifaddr = net_if_ipv4_addr_add(tso_iface, &tso_my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Failed to add IPv4 address");
+
+	zassert_true(net_if_ipv4_set_netmask_by_addr(tso_iface, &tso_my_addr,
+						     &tso_netmask),
+		     "Failed to set netmask");
+}
+
+static void tso_send_reply(uint16_t dst_port, uint8_t flags)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	struct net_pkt *pkt;
+	struct tcphdr *th;
+
+	pkt = net_pkt_alloc_with_buffer(tso_iface, sizeof(struct tcphdr),
+					AF_INET, IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate reply");
+
+	zassert_ok(net_ipv4_create(pkt, &tso_peer_addr, &tso_my_addr));
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	zassert_not_null(th, "Cannot access TCP header");
+
+	memset(th, 0U, sizeof(struct tcphdr));
+
+	th->th_sport = htons(PEER_PORT);
+	th->th_dport = dst_port;
+	th->th_off = 5U;
+	th->th_flags = flags;
+	th->th_win = htons(UINT16_MAX);
+	th->th_seq = htonl(seq);
+	th->th_ack = htonl(ack);
+
+	zassert_ok(net_pkt_set_data(pkt, &tcp_access));
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP));
+
+	/* There is no Ethernet header to parse */
+	net_pkt_set_l2_processed(pkt, true);
+
+	zassert_ok(net_recv_data(tso_iface, pkt), "Cannot receive reply");
+}
+
+static void handle_tso_test(struct tcphdr *th, size_t payload_len,
+			    uint16_t seg_size)
+{
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		t_state = T_SYN_ACK;
+		tso_send_reply(th->th_sport, SYN | ACK);
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		t_state = T_DATA;
+		test_sem_give();
+		break;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+		tso_data_segments++;
+		tso_seg_size = seg_size;
+		seq++;
+		ack += payload_len;
+		zassert_equal(payload_len, sizeof(tso_data), "Data split by the stack");
+		t_state = T_FIN;
+		tso_send_reply(th->th_sport, ACK);
+		test_sem_give();
+		break;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack++;
+		t_state = T_FIN_ACK;
+		tso_send_reply(th->th_sport, FIN | ACK);
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		break;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+	}
+}
+#endif /* CONFIG_NET_TCP_TSO */
+
 /* Initial setup for the tests */
 static void *presetup(void)
 {
@@ -532,6 +731,11 @@ static void *presetup(void)
 	}
 
 	k_work_init_delayable(&test_server, test_server_timeout);
+
+#if defined(CONFIG_NET_TCP_TSO)
+	tso_iface_setup();
+#endif
+
 	return NULL;
 }
 
@@ -3206,4 +3410,550 @@ ZTEST(net_tcp, test_server_fin_ack_after_data)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+#if defined(TEST_BULK_DATA)
+/* The bulk data tests record the data segments sent by the device, and the
+ * test thread plays the peer, acknowledging them as it sees fit. Sequence
+ * numbers are relative to the initial sequence number of the device.
+ * The tests must complete before the data gets retransmitted on timeout.
+ */
+#define BULK_MSS 200
+
+struct bulk_segment {
+	uint32_t seq;
+	size_t len;
+};
+
+static struct bulk_segment bulk_segments[16];
+static int bulk_sent;
+static int bulk_checked;
+static uint16_t bulk_port;
+static bool bulk_sack;
+static K_SEM_DEFINE(bulk_sem, 0, K_SEM_MAX_LIMIT);
+
+static void handle_client_bulk_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	/* MSS, then 2 NOPs and SACK permitted */
+	static const uint8_t syn_options[] = {
+		NET_TCP_MSS_OPT, NET_TCP_MSS_SIZE, 0, BULK_MSS,
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+		NET_TCP_SACK_PERM_OPT, NET_TCP_SACK_PERM_SIZE,
+	};
+	struct net_pkt *reply;
+	size_t len;
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	      net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		device_initial_seq = ntohl(th->th_seq);
+		bulk_port = th->th_sport;
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		memcpy(peer_options, syn_options, sizeof(syn_options));
+		peer_options_len = bulk_sack ? sizeof(syn_options) : NET_TCP_MSS_SIZE;
+		reply = prepare_syn_ack_packet(net_pkt_family(pkt), htons(MY_PORT),
+					       th->th_sport);
+		peer_options_len = 0U;
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+		zassert_true(bulk_sent < ARRAY_SIZE(bulk_segments), "Too many segments");
+		bulk_segments[bulk_sent].seq = get_rel_seq(th);
+		bulk_segments[bulk_sent].len = len;
+		bulk_sent++;
+		k_sem_give(&bulk_sem);
+		return;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack = ntohl(th->th_seq) + 1U;
+		t_state = T_FIN_ACK;
+		reply = prepare_fin_ack_packet(net_pkt_family(pkt), htons(MY_PORT),
+					       th->th_sport);
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+}
+
+static struct net_context *bulk_connect(bool sack)
+{
+	struct net_context *ctx;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_BULK;
+	seq = ack = 0;
+	bulk_sack = sack;
+	bulk_sent = 0;
+	bulk_checked = 0;
+	k_sem_reset(&bulk_sem);
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_ok(ret, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in),
+				  NULL,
+				  K_MSEC(100), NULL);
+	zassert_ok(ret, "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	return ctx;
+}
+
+static void bulk_close(struct net_context *ctx)
+{
+	t_state = T_FIN;
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+static void bulk_send(struct net_context *ctx, size_t len)
+{
+	int ret;
+
+	ret = net_context_send(ctx, lorem_ipsum, len, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, len, "Failed to send data to peer %d", ret);
+}
+
+/* Acknowledge the data up to ack_seq, reporting the given SACK blocks */
+static void bulk_send_ack(uint32_t ack_seq, const uint32_t (*sack)[2],
+			  size_t sack_count)
+{
+	struct net_pkt *reply;
+
+	if (sack_count > 0) {
+		peer_options[0] = NET_TCP_NOP_OPT;
+		peer_options[1] = NET_TCP_NOP_OPT;
+		peer_options[2] = NET_TCP_SACK_OPT;
+		peer_options[3] = 2U + sack_count * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (size_t i = 0; i < sack_count; i++) {
+			uint8_t *block = &peer_options[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+			sys_put_be32(device_initial_seq + sack[i][0], block);
+			sys_put_be32(device_initial_seq + sack[i][1], block + 4);
+		}
+
+		peer_options_len = 4U + sack_count * NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	ack = device_initial_seq + ack_seq;
+	reply = prepare_ack_packet(AF_INET, htons(MY_PORT), bulk_port);
+	peer_options_len = 0U;
+
+	zassert_not_null(reply, "Cannot prepare ACK");
+	zassert_ok(net_recv_data(net_iface, reply), "Cannot receive ACK");
+}
+
+static void bulk_expect_segment(uint32_t seg_seq, int line)
+{
+	struct bulk_segment *seg;
+
+	zassert_ok(k_sem_take(&bulk_sem, K_MSEC(100)),
+		   "No segment at %u sent (line %d)", seg_seq, line);
+
+	seg = &bulk_segments[bulk_checked++];
+	zassert_equal(seg->seq, seg_seq, "Segment at %u instead of %u (line %d)",
+		      seg->seq, seg_seq, line);
+	zassert_equal(seg->len, BULK_MSS, "Segment of %zu bytes (line %d)",
+		      seg->len, line);
+}
+
+static void bulk_expect_no_segment(int line)
+{
+	zassert_not_ok(k_sem_take(&bulk_sem, K_MSEC(10)),
+		       "Segment at %u sent (line %d)",
+		       bulk_segments[bulk_checked].seq, line);
+}
+#endif /* TEST_BULK_DATA */
+
+#if defined(CONFIG_NET_TCP_SACK)
+static bool sack_board_has(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	for (int i = 0; i < conn->sack_board_count; i++) {
+		if (conn->sack_board[i].left == device_initial_seq + left &&
+		    conn->sack_board[i].right == device_initial_seq + right) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Test case scenario IPv4
+ *   expect SYN offering SACK,
+ *   send SYN ACK permitting SACK,
+ *   expect ACK,
+ *   expect 5 data segments,
+ *   send duplicate ACKs reporting segments 2, 4 and 5,
+ *   expect segments 1 and 3 only to be retransmitted,
+ *   send partial then full ACK,
+ *   expect the scoreboard to follow.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_ipv4)
+{
+	static const uint32_t sack_seg2[][2] = { { 201, 401 } };
+	static const uint32_t sack_seg4[][2] = { { 601, 801 }, { 201, 401 } };
+	static const uint32_t sack_seg5[][2] = { { 601, 1001 }, { 201, 401 } };
+	static const uint32_t sack_seg1[][2] = { { 601, 1001 } };
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	ctx = bulk_connect(true);
+	conn = ctx->tcp;
+
+	zassert_true(conn->sack_permitted, "SACK not negotiated");
+
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	/* Let all the data leave at once */
+	conn->ca.cwnd = UINT16_MAX;
+#endif
+
+	bulk_send(ctx, 5 * BULK_MSS);
+
+	for (int i = 0; i < 5; i++) {
+		bulk_expect_segment(1 + i * BULK_MSS, __LINE__);
+	}
+
+	/* Segments 1 and 3 are lost */
+	bulk_send_ack(1, sack_seg2, ARRAY_SIZE(sack_seg2));
+	bulk_send_ack(1, sack_seg4, ARRAY_SIZE(sack_seg4));
+	bulk_expect_no_segment(__LINE__);
+
+	zassert_equal(conn->sack_board_count, 2, "%d SACK blocks", conn->sack_board_count);
+	zassert_true(sack_board_has(conn, 201, 401), "Segment 2 not recorded");
+	zassert_true(sack_board_has(conn, 601, 801), "Segment 4 not recorded");
+
+	/* The third duplicate ACK only resends the first hole */
+	bulk_send_ack(1, sack_seg5, ARRAY_SIZE(sack_seg5));
+	bulk_expect_segment(1, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+
+	zassert_equal(conn->sack_board_count, 2, "%d SACK blocks", conn->sack_board_count);
+	zassert_true(sack_board_has(conn, 601, 1001), "Blocks not merged");
+	zassert_true(conn->sack_recovery, "Not recovering");
+
+	/* The next one resends the second hole, skipping segment 2 */
+	bulk_send_ack(1, sack_seg5, ARRAY_SIZE(sack_seg5));
+	bulk_expect_segment(401, __LINE__);
+
+	/* No hole is left */
+	bulk_send_ack(1, sack_seg5, ARRAY_SIZE(sack_seg5));
+	bulk_expect_no_segment(__LINE__);
+
+	/* A partial ACK trims the scoreboard, segment 3 was resent already */
+	bulk_send_ack(401, sack_seg1, ARRAY_SIZE(sack_seg1));
+	bulk_expect_no_segment(__LINE__);
+
+	zassert_equal(conn->sack_board_count, 1, "%d SACK blocks", conn->sack_board_count);
+	zassert_true(sack_board_has(conn, 601, 1001), "Segments 4 and 5 not recorded");
+	zassert_true(conn->sack_recovery, "Recovery ended early");
+
+	bulk_send_ack(1001, NULL, 0);
+	bulk_expect_no_segment(__LINE__);
+
+	zassert_equal(conn->sack_board_count, 0, "%d SACK blocks", conn->sack_board_count);
+	zassert_false(conn->sack_recovery, "Recovery not ended");
+
+	bulk_close(ctx);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN offering SACK,
+ *   send SYN ACK not permitting SACK,
+ *   expect ACK,
+ *   expect 3 data segments,
+ *   send duplicate ACKs with SACK blocks,
+ *   expect the blocks to be ignored.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_not_permitted_ipv4)
+{
+	static const uint32_t sack_seg3[][2] = { { 201, 601 } };
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	ctx = bulk_connect(false);
+	conn = ctx->tcp;
+
+	zassert_false(conn->sack_permitted, "SACK used without permission");
+
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	/* Let all the data leave at once */
+	conn->ca.cwnd = UINT16_MAX;
+#endif
+
+	bulk_send(ctx, 3 * BULK_MSS);
+
+	for (int i = 0; i < 3; i++) {
+		bulk_expect_segment(1 + i * BULK_MSS, __LINE__);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		bulk_send_ack(1, sack_seg3, ARRAY_SIZE(sack_seg3));
+	}
+
+	/* Regular fast retransmit */
+	bulk_expect_segment(1, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+
+	zassert_equal(conn->sack_board_count, 0, "%d SACK blocks", conn->sack_board_count);
+
+	bulk_send_ack(601, NULL, 0);
+	bulk_expect_no_segment(__LINE__);
+
+	bulk_close(ctx);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE) && defined(CONFIG_NET_TCP_FAST_RETRANSMIT)
+/* Run a connection through slow start, a fast retransmit and a first
+ * acknowledgment in congestion avoidance using the given algorithm, checking
+ * the congestion window along the way. The caller checks cwnd once
+ * increased from ssthresh, loss_ssthresh being expected after the loss.
+ */
+static struct net_context *congestion_test(const char *name, uint16_t loss_ssthresh)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+	int ret;
+
+	ctx = bulk_connect(false);
+	conn = ctx->tcp;
+
+	ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION, name, strlen(name));
+	zassert_ok(ret, "Cannot select %s (%d)", name, ret);
+
+	zassert_equal(conn->ca.cwnd, BULK_MSS, "Initial cwnd %u", conn->ca.cwnd);
+	zassert_equal(conn->ca.ssthresh, 3 * BULK_MSS, "Initial ssthresh %u",
+		      conn->ca.ssthresh);
+
+	/* Slow start, one more segment per acknowledged segment */
+	bulk_send(ctx, 6 * BULK_MSS);
+	bulk_expect_segment(1, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+
+	bulk_send_ack(1 + BULK_MSS, NULL, 0);
+	bulk_expect_segment(1 + BULK_MSS, __LINE__);
+	bulk_expect_segment(1 + 2 * BULK_MSS, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+	zassert_equal(conn->ca.cwnd, 2 * BULK_MSS, "Slow start cwnd %u", conn->ca.cwnd);
+
+	/* A single ACK grows cwnd by one MSS at most */
+	bulk_send_ack(1 + 3 * BULK_MSS, NULL, 0);
+	bulk_expect_segment(1 + 3 * BULK_MSS, __LINE__);
+	bulk_expect_segment(1 + 4 * BULK_MSS, __LINE__);
+	bulk_expect_segment(1 + 5 * BULK_MSS, __LINE__);
+	zassert_equal(conn->ca.cwnd, 3 * BULK_MSS, "Slow start cwnd %u", conn->ca.cwnd);
+
+	/* The first of the 3 segments in flight is lost */
+	for (int i = 0; i < 3; i++) {
+		bulk_send_ack(1 + 3 * BULK_MSS, NULL, 0);
+	}
+
+	bulk_expect_segment(1 + 3 * BULK_MSS, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+	zassert_equal(conn->ca.ssthresh, loss_ssthresh, "Loss ssthresh %u",
+		      conn->ca.ssthresh);
+	zassert_equal(conn->ca.cwnd, loss_ssthresh + 3 * BULK_MSS, "Loss cwnd %u",
+		      conn->ca.cwnd);
+
+	/* The recovery ends with cwnd deflated to ssthresh */
+	bulk_send_ack(1 + 6 * BULK_MSS, NULL, 0);
+	bulk_expect_no_segment(__LINE__);
+	zassert_equal(conn->ca.cwnd, loss_ssthresh, "Recovery cwnd %u", conn->ca.cwnd);
+
+	bulk_send(ctx, 2 * BULK_MSS);
+	bulk_expect_segment(1 + 6 * BULK_MSS, __LINE__);
+	bulk_expect_segment(1 + 7 * BULK_MSS, __LINE__);
+	bulk_expect_no_segment(__LINE__);
+
+	bulk_send_ack(1 + 8 * BULK_MSS, NULL, 0);
+	bulk_expect_no_segment(__LINE__);
+
+	return ctx;
+}
+
+/* Increase of New Reno per acknowledgment in congestion avoidance */
+#define RENO_AVOIDANCE_INC(cwnd) DIV_ROUND_UP(BULK_MSS * BULK_MSS, (cwnd))
+
+/* Test case scenario IPv4
+ *   expect SYN,
+ *   send SYN ACK,
+ *   expect ACK,
+ *   acknowledge the data segments, losing one,
+ *   expect cwnd and ssthresh to follow New Reno.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_congestion_reno)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	/* Half of the flight size, at least 2 MSS */
+	ctx = congestion_test("reno", 2 * BULK_MSS);
+	conn = ctx->tcp;
+
+	zassert_equal(conn->ca.cwnd, 2 * BULK_MSS + RENO_AVOIDANCE_INC(2 * BULK_MSS),
+		      "Avoidance cwnd %u", conn->ca.cwnd);
+
+	bulk_close(ctx);
+}
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+/* Test case scenario IPv4
+ *   expect SYN,
+ *   send SYN ACK,
+ *   expect ACK,
+ *   acknowledge the data segments, losing one,
+ *   expect cwnd and ssthresh to follow CUBIC.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_congestion_cubic)
+{
+	uint16_t ssthresh = 3 * BULK_MSS * 7 / 10;
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	/* 0.7 times the flight size, instead of half of it */
+	ctx = congestion_test("cubic", ssthresh);
+	conn = ctx->tcp;
+
+	zassert_equal(conn->ca.w_max, 3 * BULK_MSS, "w_max %u", conn->ca.w_max);
+
+	/* Back in the concave region, growing slower than New Reno */
+	zassert_true(conn->ca.cwnd > ssthresh, "Avoidance cwnd %u", conn->ca.cwnd);
+	zassert_true(conn->ca.cwnd < ssthresh + RENO_AVOIDANCE_INC(ssthresh),
+		     "Avoidance cwnd %u", conn->ca.cwnd);
+
+	bulk_close(ctx);
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_VEGAS)
+/* Test case scenario IPv4
+ *   expect SYN,
+ *   send SYN ACK,
+ *   expect ACK,
+ *   acknowledge the data segments, losing one,
+ *   expect cwnd and ssthresh to follow Vegas.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_congestion_vegas)
+{
+	struct net_context *ctx;
+	struct tcp *conn;
+
+	/* Losses are handled as New Reno does */
+	ctx = congestion_test("vegas", 2 * BULK_MSS);
+	conn = ctx->tcp;
+
+	/* With 2 segments in flight, less than VEGAS_ALPHA segments can be
+	 * queued, so the RTT sample grows cwnd by a whole MSS.
+	 */
+	zassert_true(conn->ca.base_rtt > 0U, "No RTT sample");
+	zassert_equal(conn->ca.cwnd, 3 * BULK_MSS, "Avoidance cwnd %u", conn->ca.cwnd);
+
+	bulk_close(ctx);
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_VEGAS */
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE && CONFIG_NET_TCP_FAST_RETRANSMIT */
+
+#if defined(CONFIG_NET_TCP_TSO)
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK,
+ *   send ACK,
+ *   send data bigger than the MSS,
+ *   expect ACK,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   The data must leave in a single segment to be split by the driver.
+ */
+ZTEST(net_tcp, test_client_tso_ipv4)
+{
+	struct net_context *ctx;
+	int ret;
+
+	t_state = T_SYN;
+	seq = ack = 0;
+	tso_seg_size = 0U;
+	tso_data_segments = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_ok(ret, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&tso_peer_addr_s,
+				  sizeof(struct sockaddr_in),
+				  NULL,
+				  K_MSEC(100), NULL);
+	zassert_ok(ret, "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	ret = net_context_send(ctx, tso_data, sizeof(tso_data), NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, sizeof(tso_data), "Failed to send data to peer %d", ret);
+
+	/* Peer will release the semaphore after it sends ACK for data */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_equal(tso_data_segments, 1, "Data sent in %d segments",
+		      tso_data_segments);
+	zassert_equal(tso_seg_size, TSO_MSS, "Wrong segment size %u", tso_seg_size);
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+#endif /* CONFIG_NET_TCP_TSO */
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
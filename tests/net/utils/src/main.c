@@ -1365,6 +1365,42 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+static uint8_t copydata[CHECKSUM_TEST_LENGTH];
+
+ZTEST(test_utils_fn, test_ip_checksum_copy)
+{
+	uint16_t sum_got;
+	uint16_t sum_exp;
+
+	for (int i = 0; i < CHECKSUM_TEST_LENGTH; i++) {
+		testdata[i] = (uint8_t)(i + 7) * 31;
+	}
+
+	/* Copy and sum at once */
+	for (int length = 1; length <= CHECKSUM_TEST_LENGTH; length += 37) {
+		memset(copydata, 0, sizeof(copydata));
+
+		sum_got = calc_chksum_copy(0x1234, copydata, testdata, length);
+		sum_exp = calc_chksum_ref(0x1234, testdata, length);
+
+		zassert_equal(sum_got, sum_exp, "Mismatch of copied checksum\n");
+		zassert_mem_equal(copydata, testdata, length, "Mismatch of copied data\n");
+	}
+
+	/* Sums of split data, the second part starting at any offset */
+	for (int split = 0; split < 64; split++) {
+		sum_got = calc_chksum_add(calc_chksum(0, testdata, split),
+					  calc_chksum(0, testdata + split,
+						      CHECKSUM_TEST_LENGTH - split),
+					  (split & 1) != 0);
+		sum_exp = calc_chksum_ref(0, testdata, CHECKSUM_TEST_LENGTH);
+
+		/* 0x0000 and 0xffff are both zero in one's complement */
+		zassert_equal((uint16_t)(sum_got % 0xffff), (uint16_t)(sum_exp % 0xffff),
+			      "Mismatch of split checksum at %d\n", split);
+	}
+}
+
 /* Verify that the net_pkt pointer to the received link layer address
  * is correct.
  */
@@ -43,6 +43,22 @@ static struct wifi_drv_context wifi_context;
 bool wifi_nm_op_called;
 bool wifi_offload_op_called;
 
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+static bool report_scan_results;
+
+static const struct wifi_scan_result scan_results[] = {
+	{ .ssid = "zephyr", .ssid_length = 6, .channel = 1, .rssi = -70,
+	  .mac = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 }, .mac_length = WIFI_MAC_ADDR_LEN },
+	{ .ssid = "zephyr", .ssid_length = 6, .channel = 6, .rssi = -40,
+	  .mac = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 }, .mac_length = WIFI_MAC_ADDR_LEN },
+	{ .ssid = "other", .ssid_length = 5, .channel = 11, .rssi = -50,
+	  .mac = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x03 }, .mac_length = WIFI_MAC_ADDR_LEN },
+	/* First BSS reported again, with a stronger signal */
+	{ .ssid = "zephyr", .ssid_length = 6, .channel = 1, .rssi = -60,
+	  .mac = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 }, .mac_length = WIFI_MAC_ADDR_LEN },
+};
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
 static void wifi_iface_init(struct net_if *iface)
 {
 	const struct device *dev = net_if_get_device(iface);
@@ -67,6 +83,20 @@ static int wifi_scan(const struct device *dev, struct wifi_scan_params *params,
 
 	wifi_offload_op_called = true;
 
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+	if (report_scan_results) {
+		struct net_if *iface = net_if_get_first_wifi();
+
+		ARRAY_FOR_EACH(scan_results, i) {
+			struct wifi_scan_result result = scan_results[i];
+
+			cb(iface, 0, &result);
+		}
+
+		cb(iface, 0, NULL);
+	}
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
+
 	return 0;
 }
 
@@ -182,5 +212,47 @@ ZTEST(net_wifi, test_wifi_nm_managed)
 	zassert_true(wifi_nm_op_called, "Scan callback not called");
 }
 
+#ifdef CONFIG_WIFI_MGMT_BSS_CACHE
+ZTEST(net_wifi, test_wifi_bss_cache)
+{
+	struct wifi_scan_result results[ARRAY_SIZE(scan_results)];
+	struct wifi_scan_result best;
+	struct net_if *iface = net_if_get_first_wifi();
+	int ret;
+#ifdef CONFIG_WIFI_NM
+	struct wifi_nm_instance *nm = wifi_nm_get_instance("test");
+
+	if (wifi_nm_get_instance_iface(iface)) {
+		ret = wifi_nm_unregister_mgd_iface(nm, iface);
+		zassert_equal(ret, 0, "Failed to unregister managed interface");
+	}
+#endif /* CONFIG_WIFI_NM */
+
+	report_scan_results = true;
+	ret = request_scan();
+	report_scan_results = false;
+	zassert_equal(ret, 0, "Scan request failed");
+
+	ret = wifi_mgmt_bss_cache_get(iface, results, ARRAY_SIZE(results));
+	zassert_equal(ret, 3, "Duplicate BSS not merged");
+	zassert_equal(results[0].rssi, -40, "Entries not sorted");
+	zassert_equal(results[1].rssi, -50, "Entries not sorted");
+	zassert_equal(results[2].rssi, -60, "Entry not updated by the latest result");
+
+	ret = wifi_mgmt_bss_cache_get(iface, results, 1);
+	zassert_equal(ret, 1, "Too many entries returned");
+	zassert_equal(results[0].rssi, -40, "Strongest entry not returned");
+
+	ret = wifi_mgmt_bss_cache_find(iface, (const uint8_t *)"zephyr", 6, &best);
+	zassert_equal(ret, 0, "Network not found");
+	zassert_equal(best.mac[5], 0x02, "Strongest BSS not found");
+
+	wifi_mgmt_bss_cache_flush(iface);
+	zassert_equal(wifi_mgmt_bss_cache_get(iface, results, ARRAY_SIZE(results)), 0,
+		      "Cache not flushed");
+	zassert_equal(wifi_mgmt_bss_cache_find(iface, (const uint8_t *)"zephyr", 6, &best),
+		      -ENOENT, "Cache not flushed");
+}
+#endif /* CONFIG_WIFI_MGMT_BSS_CACHE */
 
 ZTEST_SUITE(net_wifi, NULL, NULL, NULL, NULL, NULL);
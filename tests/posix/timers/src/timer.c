@@ -145,6 +145,34 @@ ZTEST(posix_timers, test_one_shot__SIGEV_SIGNAL)
 	zassert_equal(exp_count, 1, "Number of expiry is incorrect");
 }
 
+ZTEST(posix_timers, test_sub_millisecond_period)
+{
+	struct sigevent sig = {0};
+	struct itimerspec value = {0};
+
+	if (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 4 * MSEC_PER_SEC) {
+		/* periods would be rounded up to a tick of a millisecond or more */
+		ztest_test_skip();
+	}
+
+	exp_count = 0;
+	sig.sigev_notify = SIGEV_SIGNAL;
+	sig.sigev_notify_function = handler;
+	sig.sigev_value.sival_int = TEST_SIGNAL_VAL;
+
+	zassert_ok(timer_create(CLOCK_MONOTONIC, &sig, &timerid));
+
+	/* 2 kHz for 100 ms */
+	value.it_interval.tv_nsec = NSEC_PER_MSEC / 2;
+	value.it_value.tv_nsec = NSEC_PER_MSEC / 2;
+	zassert_ok(timer_settime(timerid, 0, &value, NULL));
+	k_sleep(K_MSEC(100));
+	zassert_ok(timer_delete(timerid));
+	timerid = -1;
+
+	zassert_within(exp_count, 200, 20, "%d expirations instead of 200", exp_count);
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -408,6 +408,57 @@ ZTEST(isotp_implementation, test_buffer_allocation_wait)
 	isotp_unbind(&recv_ctx);
 }
 
+#ifdef CONFIG_ISOTP_RX_DIRECT
+static int direct_send_expected;
+
+static void send_direct_complete_cb(int error_nr, void *arg)
+{
+	zassert_equal(error_nr, direct_send_expected, "Sending returned %d", error_nr);
+}
+
+static void send_direct_work_handler(struct k_work *work)
+{
+	int ret;
+
+	ret = isotp_send(&send_ctx, can_dev, random_data, sizeof(data_buf) * 2 + 10,
+			 &rx_addr, &tx_addr, send_direct_complete_cb, NULL);
+	zassert_equal(ret, 0, "Send returned %d", ret);
+}
+
+static K_WORK_DELAYABLE_DEFINE(send_direct_work, send_direct_work_handler);
+
+ZTEST(isotp_implementation, test_send_receive_direct)
+{
+	static uint8_t direct_buf[sizeof(data_buf) * 2 + 10];
+	int ret, i;
+
+	ret = isotp_bind(&recv_ctx, can_dev, &rx_addr, &tx_addr, &fc_opts,
+			 K_NO_WAIT);
+	zassert_equal(ret, 0, "Binding failed (%d)", ret);
+
+	for (i = 0; i < NUMBER_OF_REPETITIONS; i++) {
+		memset(direct_buf, 0, sizeof(direct_buf));
+		k_work_schedule(&send_direct_work, K_MSEC(10));
+		ret = isotp_recv_direct(&recv_ctx, direct_buf, sizeof(direct_buf),
+					K_MSEC(1000));
+		zassert_equal(ret, sizeof(direct_buf), "recv returned %d", ret);
+		check_data(direct_buf, random_data, sizeof(direct_buf));
+	}
+
+	/* a message larger than the buffer is rejected */
+	direct_send_expected = ISOTP_N_BUFFER_OVERFLW;
+	k_work_schedule(&send_direct_work, K_MSEC(10));
+	ret = isotp_recv_direct(&recv_ctx, direct_buf, sizeof(data_buf), K_MSEC(1000));
+	zassert_equal(ret, ISOTP_N_BUFFER_OVERFLW, "recv returned %d", ret);
+
+	ret = isotp_recv_direct(&recv_ctx, direct_buf, sizeof(direct_buf), K_MSEC(50));
+	zassert_equal(ret, ISOTP_RECV_TIMEOUT, "Expected timeout but got %d", ret);
+
+	isotp_unbind(&recv_ctx);
+	direct_send_expected = ISOTP_N_OK;
+}
+#endif /* CONFIG_ISOTP_RX_DIRECT */
+
 void *isotp_implementation_setup(void)
 {
 	int ret;
@@ -0,0 +1,85 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/cpu_freq/policy.h>
+#include <zephyr/cpu_freq/cpu_freq.h>
+
+#define WAIT_US  1000
+#define SLEEP_MS 10
+
+static const struct pstate *select_pstate(void)
+{
+	const struct pstate *pstate;
+	int ret;
+
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+	k_sched_lock(); /* Lock scheduler to prevent thread migration */
+#endif
+
+	ret = cpu_freq_policy_select_pstate(&pstate);
+
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+	k_sched_unlock();
+#endif
+
+	zassert_equal(ret, 0, "Expected success from cpu_freq_policy_select_pstate");
+
+	return pstate;
+}
+
+/*
+ * Test APIs of schedutil CPU frequency policy.
+ */
+ZTEST(cpu_freq_schedutil, test_pstates)
+{
+	const struct pstate *test_pstate;
+	uint8_t max_threshold;
+
+	/* Test invalid arg */
+	zassert_equal(cpu_freq_policy_select_pstate(NULL), -EINVAL,
+		      "Expected -EINVAL for NULL pstate_out");
+
+	/* Start a new measurement window and simulate high-load */
+	(void)select_pstate();
+	k_busy_wait(WAIT_US);
+
+	test_pstate = select_pstate();
+	max_threshold = test_pstate->load_threshold;
+
+	/* A short idle period does not drop the CPU from its P-state right away */
+	k_msleep(SLEEP_MS);
+	test_pstate = select_pstate();
+	zassert_equal(test_pstate->load_threshold, max_threshold,
+		      "Expected the same P-state after a short sleep");
+
+	/* But a longer one does */
+	for (int i = 0; i < 4; i++) {
+		k_msleep(SLEEP_MS);
+		test_pstate = select_pstate();
+	}
+
+	zassert_true(test_pstate->load_threshold < max_threshold,
+		     "Expected a lower P-state after sleeping");
+
+	/* A boost raises the CPU to its highest P-state whatever the utilization */
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+	k_sched_lock();
+	cpu_freq_boost();
+	test_pstate = select_pstate();
+	k_sched_unlock();
+#else
+	cpu_freq_boost();
+	k_msleep(SLEEP_MS);
+	test_pstate = select_pstate();
+#endif
+
+	zassert_equal(test_pstate->load_threshold, max_threshold,
+		      "Expected the highest P-state after a boost");
+}
+
+ZTEST_SUITE(cpu_freq_schedutil, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,118 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <ff.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#define TEST_FILE "/RAM:/rtio.bin"
+
+static FATFS fat_fs;
+static struct fs_mount_t fatfs_mnt = {
+	.type = FS_FATFS,
+	.mnt_point = "/RAM:",
+	.fs_data = &fat_fs,
+};
+
+static struct fs_file_t file;
+
+FS_RTIO_IODEV_DEFINE(file_iodev);
+RTIO_DEFINE(r, 8, 8);
+
+static const uint8_t chunk1[] = "first ";
+static const uint8_t chunk2[] = "tail";
+
+static void *fs_rtio_setup(void)
+{
+	zassert_ok(fs_mount(&fatfs_mnt));
+	return NULL;
+}
+
+static void fs_rtio_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, TEST_FILE, FS_O_CREATE | FS_O_RDWR | FS_O_TRUNC));
+	zassert_ok(fs_rtio_iodev_set_file(&file_iodev, &file));
+}
+
+static void fs_rtio_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(fs_rtio_iodev_set_file(&file_iodev, NULL));
+	zassert_ok(fs_close(&file));
+}
+
+static void fs_rtio_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(fs_unmount(&fatfs_mnt));
+}
+
+static void consume(int expected)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&r);
+
+	zassert_equal(cqe->result, expected, "got %d, expected %d", cqe->result, expected);
+	rtio_cqe_release(&r, cqe);
+}
+
+ZTEST(fs_rtio, test_write_sync_read)
+{
+	uint8_t buf[sizeof(chunk1) + sizeof(chunk2)];
+	struct rtio_sqe *sqe;
+
+	/* Writes, then a flush, chained so they run in order */
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_write(sqe, &file_iodev, RTIO_PRIO_NORM, chunk1, sizeof(chunk1), NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_tiny_write(sqe, &file_iodev, RTIO_PRIO_NORM, chunk2, sizeof(chunk2), NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_nop(sqe, &file_iodev, NULL);
+
+	zassert_ok(rtio_submit(&r, 3));
+	consume(sizeof(chunk1));
+	consume(sizeof(chunk2));
+	consume(0);
+
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_SET));
+
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_read(sqe, &file_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r, 1));
+	consume(sizeof(buf));
+
+	zassert_mem_equal(buf, chunk1, sizeof(chunk1));
+	zassert_mem_equal(buf + sizeof(chunk1), chunk2, sizeof(chunk2));
+
+	/* Reading at the end of the file completes with no data */
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_read(sqe, &file_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	zassert_ok(rtio_submit(&r, 1));
+	consume(0);
+}
+
+ZTEST(fs_rtio, test_no_file)
+{
+	struct rtio_sqe *sqe;
+
+	zassert_ok(fs_rtio_iodev_set_file(&file_iodev, NULL));
+
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_write(sqe, &file_iodev, RTIO_PRIO_NORM, chunk1, sizeof(chunk1), NULL);
+	zassert_ok(rtio_submit(&r, 1));
+	consume(-EBADF);
+}
+
+ZTEST_SUITE(fs_rtio, NULL, fs_rtio_setup, fs_rtio_before, fs_rtio_after, fs_rtio_teardown);
@@ -328,6 +328,9 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	/* 101st write will trigger 4th GC. */
 	const uint16_t max_writes_4 = 41 + 20 + 20 + 20;
 
+	/* Lookup cache snapshots change the number of writes per sector */
+	Z_TEST_SKIP_IFDEF(CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT);
+
 	fixture->fs.sector_count = 3;
 
 	err = zms_mount(&fixture->fs);
@@ -850,6 +853,189 @@ ZTEST_F(zms, test_zms_cache_gc)
 #endif
 }
 
+/*
+ * Test that ZMS lookup cache restored from its snapshot on zms_mount() matches
+ * the cache maintained by the writes.
+ */
+ZTEST_F(zms, test_zms_cache_snapshot)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_SNAPSHOT
+	int err;
+	uint16_t data = 0;
+	uint64_t cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+
+	fixture->fs.sector_count = 3;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	/* Write until a gc of the second sector stored a snapshot in the third one */
+
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		++data;
+		err = zms_write(&fixture->fs, data % 16, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	/* Entries written after the snapshot are replayed */
+
+	for (int id = 8; id < 24; id++) {
+		err = zms_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	memcpy(cache, fixture->fs.lookup_cache, sizeof(cache));
+	memset(fixture->fs.lookup_cache, 0xAA, sizeof(fixture->fs.lookup_cache));
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	zassert_mem_equal(cache, fixture->fs.lookup_cache, sizeof(cache),
+			  "invalid cache content after restart");
+
+	for (int id = 0; id < 24; id++) {
+		err = zms_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+	}
+#else
+	ztest_test_skip();
+#endif
+}
+
+#ifdef CONFIG_ZMS_BATCH
+static void fill_batch(struct zms_batch *batch, uint32_t value)
+{
+	uint32_t wr_buf[16];
+	ssize_t len;
+
+	for (int i = 0; i < ARRAY_SIZE(wr_buf); i++) {
+		wr_buf[i] = value;
+	}
+
+	/* A small and a large entry, a delete and an entry written twice */
+	len = zms_batch_write(batch, 1, &value, sizeof(value));
+	zassert_equal(len, sizeof(value), "zms_batch_write call failure: %d", len);
+	len = zms_batch_write(batch, 2, wr_buf, sizeof(wr_buf));
+	zassert_equal(len, sizeof(wr_buf), "zms_batch_write call failure: %d", len);
+	len = zms_batch_write(batch, 3, NULL, 0);
+	zassert_equal(len, 0, "zms_batch_write call failure: %d", len);
+	++value;
+	len = zms_batch_write(batch, 1, &value, sizeof(value));
+	zassert_equal(len, sizeof(value), "zms_batch_write call failure: %d", len);
+}
+
+static void check_batch(struct zms_fs *fs, uint32_t value)
+{
+	uint32_t rd_buf[16];
+	ssize_t len;
+
+	len = zms_read(fs, 1, rd_buf, sizeof(rd_buf));
+	zassert_equal(len, sizeof(uint32_t), "zms_read call failure: %d", len);
+	zassert_equal(rd_buf[0], value + 1, "wrong data of the entry written twice");
+
+	len = zms_read(fs, 2, rd_buf, sizeof(rd_buf));
+	zassert_equal(len, sizeof(rd_buf), "zms_read call failure: %d", len);
+	for (int i = 0; i < ARRAY_SIZE(rd_buf); i++) {
+		zassert_equal(rd_buf[i], value, "wrong data of the large entry");
+	}
+
+	len = zms_read(fs, 3, rd_buf, sizeof(rd_buf));
+	zassert_equal(len, -ENOENT, "deleted entry found: %d", len);
+}
+#endif /* CONFIG_ZMS_BATCH */
+
+/*
+ * Test ZMS batch writes, all the entries of a batch are found after a restart or none.
+ */
+ZTEST_F(zms, test_zms_batch)
+{
+#ifdef CONFIG_ZMS_BATCH
+	int err;
+	ssize_t len;
+	uint32_t data = 0;
+	uint8_t buf[256];
+	struct zms_batch batch;
+#ifdef CONFIG_TEST_ZMS_SIMULATOR
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+	uint32_t commit_write_calls;
+#endif
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	len = zms_write(&fixture->fs, 3, &data, sizeof(data));
+	zassert_equal(len, sizeof(data), "zms_write call failure: %d", len);
+
+	err = zms_batch_begin(&fixture->fs, &batch, buf, sizeof(buf));
+	zassert_true(err == 0, "zms_batch_begin call failure: %d", err);
+
+	len = zms_batch_write(&batch, ZMS_HEAD_ID, &data, sizeof(data));
+	zassert_equal(len, -EINVAL, "zms_batch_write accepted a reserved ID: %d", len);
+
+	fill_batch(&batch, 1);
+	len = zms_batch_write(&batch, 4, buf, sizeof(buf));
+	zassert_equal(len, -ENOMEM, "zms_batch_write overflowed the buffer: %d", len);
+
+	err = zms_batch_commit(&batch);
+	zassert_true(err == 0, "zms_batch_commit call failure: %d", err);
+	check_batch(&fixture->fs, 1);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch(&fixture->fs, 1);
+
+#ifdef CONFIG_TEST_ZMS_SIMULATOR
+	/* Start from an empty sector, for the batches below to be written without gc */
+	err = zms_clear(&fixture->fs);
+	zassert_true(err == 0, "zms_clear call failure: %d", err);
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	err = zms_batch_begin(&fixture->fs, &batch, buf, sizeof(buf));
+	zassert_true(err == 0, "zms_batch_begin call failure: %d", err);
+
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	*flash_write_stat = 0;
+	fill_batch(&batch, 2);
+	err = zms_batch_commit(&batch);
+	zassert_true(err == 0, "zms_batch_commit call failure: %d", err);
+	commit_write_calls = *flash_write_stat;
+
+	/* Power down before the ATE committing the batch is written, the batch is lost */
+	*flash_max_write_calls = commit_write_calls - 1;
+	*flash_write_stat = 0;
+	fill_batch(&batch, 3);
+	err = zms_batch_commit(&batch);
+	zassert_true(err == 0, "zms_batch_commit call failure: %d", err);
+
+	*flash_max_write_calls = 0;
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch(&fixture->fs, 2);
+
+	/* Power down while the ATEs are written, the batch is completed at mount */
+	err = zms_batch_begin(&fixture->fs, &batch, buf, sizeof(buf));
+	zassert_true(err == 0, "zms_batch_begin call failure: %d", err);
+	*flash_max_write_calls = commit_write_calls;
+	*flash_write_stat = 0;
+	fill_batch(&batch, 4);
+	err = zms_batch_commit(&batch);
+	zassert_true(err == 0, "zms_batch_commit call failure: %d", err);
+
+	*flash_max_write_calls = 0;
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_batch(&fixture->fs, 4);
+#endif /* CONFIG_TEST_ZMS_SIMULATOR */
+#else
+	ztest_test_skip();
+#endif
+}
+
 /*
  * Test ZMS lookup cache hash quality.
  */
@@ -0,0 +1,151 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/input/input.h>
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+
+static const struct device fake_dev_a;
+static const struct device fake_dev_b;
+static const struct device fake_dev_c;
+
+static struct input_event frame[CONFIG_INPUT_FRAME_MAX_EVENTS];
+static size_t frame_num;
+static int frame_count;
+static int frame_count_filtered;
+static int event_count;
+
+static void input_cb_event(struct input_event *evt, void *user_data)
+{
+	event_count++;
+}
+INPUT_CALLBACK_DEFINE(NULL, input_cb_event, NULL);
+
+static void input_cb_frame(const struct input_event *evts, size_t num, void *user_data)
+{
+	zassert_true(num > 0 && num <= ARRAY_SIZE(frame), "num: %zu", num);
+
+	memcpy(frame, evts, num * sizeof(evts[0]));
+	frame_num = num;
+	frame_count++;
+}
+INPUT_FRAME_CALLBACK_DEFINE(NULL, input_cb_frame, NULL);
+
+static void input_cb_frame_filtered(const struct input_event *evts, size_t num, void *user_data)
+{
+	zassert_equal(evts[0].dev, &fake_dev_b);
+
+	frame_count_filtered++;
+}
+INPUT_FRAME_CALLBACK_DEFINE(&fake_dev_b, input_cb_frame_filtered, NULL);
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	frame_num = 0;
+	frame_count = 0;
+	frame_count_filtered = 0;
+	event_count = 0;
+}
+
+ZTEST(input_frame, test_frame_on_sync)
+{
+	input_report_abs(&fake_dev_a, INPUT_ABS_X, 10, false, K_FOREVER);
+	input_report_abs(&fake_dev_a, INPUT_ABS_Y, 20, false, K_FOREVER);
+	zassert_equal(frame_count, 0, "frame dispatched before sync");
+
+	input_report_key(&fake_dev_a, INPUT_BTN_TOUCH, 1, true, K_FOREVER);
+	zassert_equal(frame_count, 1);
+	zassert_equal(event_count, 3, "events not dispatched individually");
+
+	zassert_equal(frame_num, 3);
+	zassert_equal(frame[0].code, INPUT_ABS_X);
+	zassert_equal(frame[0].value, 10);
+	zassert_equal(frame[1].code, INPUT_ABS_Y);
+	zassert_equal(frame[1].value, 20);
+	zassert_equal(frame[2].code, INPUT_BTN_TOUCH);
+	zassert_false(frame[0].sync);
+	zassert_true(frame[2].sync);
+	zassert_equal(frame_count_filtered, 0);
+}
+
+ZTEST(input_frame, test_interleaved_devices)
+{
+	input_report_rel(&fake_dev_a, INPUT_REL_X, 1, false, K_FOREVER);
+	input_report_rel(&fake_dev_b, INPUT_REL_X, 2, false, K_FOREVER);
+
+	/* both frames are in use, the third device is not batched */
+	input_report_rel(&fake_dev_c, INPUT_REL_X, 3, false, K_FOREVER);
+	zassert_equal(frame_count, 1);
+	zassert_equal(frame[0].dev, &fake_dev_c);
+
+	input_report_rel(&fake_dev_b, INPUT_REL_Y, 4, true, K_FOREVER);
+	zassert_equal(frame_count, 2);
+	zassert_equal(frame_count_filtered, 1);
+	zassert_equal(frame_num, 2);
+	zassert_equal(frame[0].dev, &fake_dev_b);
+	zassert_equal(frame[0].value, 2);
+	zassert_equal(frame[1].value, 4);
+
+	input_report_rel(&fake_dev_a, INPUT_REL_Y, 5, true, K_FOREVER);
+	zassert_equal(frame_count, 3);
+	zassert_equal(frame_num, 2);
+	zassert_equal(frame[0].dev, &fake_dev_a);
+	zassert_equal(frame[0].value, 1);
+	zassert_equal(frame[1].value, 5);
+}
+
+ZTEST(input_frame, test_split)
+{
+	if (IS_ENABLED(CONFIG_INPUT_FRAME_COALESCE)) {
+		ztest_test_skip();
+	}
+
+	for (int i = 0; i < CONFIG_INPUT_FRAME_MAX_EVENTS + 1; i++) {
+		input_report_abs(&fake_dev_a, INPUT_ABS_X, i, false, K_FOREVER);
+	}
+
+	zassert_equal(frame_count, 1);
+	zassert_equal(frame_num, CONFIG_INPUT_FRAME_MAX_EVENTS);
+	zassert_false(frame[frame_num - 1].sync);
+
+	input_report_abs(&fake_dev_a, INPUT_ABS_Y, 0, true, K_FOREVER);
+	zassert_equal(frame_count, 2);
+	zassert_equal(frame_num, 2);
+	zassert_equal(frame[0].value, CONFIG_INPUT_FRAME_MAX_EVENTS);
+	zassert_true(frame[1].sync);
+}
+
+ZTEST(input_frame, test_coalesce)
+{
+	if (!IS_ENABLED(CONFIG_INPUT_FRAME_COALESCE)) {
+		ztest_test_skip();
+	}
+
+	for (int i = 0; i < CONFIG_INPUT_FRAME_MAX_EVENTS * 2; i++) {
+		input_report_abs(&fake_dev_a, INPUT_ABS_X, i, false, K_FOREVER);
+		input_report_rel(&fake_dev_a, INPUT_REL_WHEEL, 1, false, K_FOREVER);
+	}
+
+	input_report_key(&fake_dev_a, INPUT_KEY_A, 1, false, K_FOREVER);
+	input_report_key(&fake_dev_a, INPUT_KEY_A, 0, true, K_FOREVER);
+
+	zassert_equal(frame_count, 1, "frame split");
+	zassert_equal(event_count, CONFIG_INPUT_FRAME_MAX_EVENTS * 4 + 2);
+	zassert_equal(frame_num, 4);
+	zassert_equal(frame[0].type, INPUT_EV_ABS);
+	zassert_equal(frame[0].value, CONFIG_INPUT_FRAME_MAX_EVENTS * 2 - 1, "not the last value");
+	zassert_equal(frame[1].type, INPUT_EV_REL);
+	zassert_equal(frame[1].value, CONFIG_INPUT_FRAME_MAX_EVENTS * 2, "not the sum");
+
+	/* key events are never merged */
+	zassert_equal(frame[2].value, 1);
+	zassert_equal(frame[3].value, 0);
+	zassert_true(frame[3].sync);
+}
+
+ZTEST_SUITE(input_frame, NULL, NULL, before, NULL, NULL);
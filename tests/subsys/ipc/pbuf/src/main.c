@@ -106,6 +106,58 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+/* In place write/read tests. */
+ZTEST(test_pbuf, test_in_place)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	volatile char *rx_buf;
+	char *tx_buf;
+	int ret;
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	/* Nothing to get yet. */
+	zassert_equal(pbuf_get_rx_buf(&pb, &rx_buf), 0);
+	zassert_equal(pbuf_free_rx_buf(&pb), -ENODATA);
+
+	/* Write MSGA_SZ bytes packet in place. */
+	ret = pbuf_get_tx_buf(&pb, &tx_buf);
+	zassert_true(ret >= MSGA_SZ);
+	memcpy(tx_buf, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_commit_tx_buf(&pb, MSGA_SZ), MSGA_SZ);
+
+	/* The packet is available in place until freed. */
+	ret = pbuf_get_rx_buf(&pb, &rx_buf);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_mem_equal((const void *)rx_buf, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_get_rx_buf(&pb, &rx_buf), MSGA_SZ);
+	zassert_equal(pbuf_free_rx_buf(&pb), 0);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+
+	/* In place packets cannot wrap around. */
+	ret = pbuf_get_tx_buf(&pb, &tx_buf);
+	zassert_equal(ret, (char *)cfg.data_loc + cfg.len - tx_buf);
+
+	/* Wrapped packet must be copied. */
+	ret = pbuf_write(&pb, write_buf, MPS);
+	zassert_equal(ret, MPS);
+	zassert_equal(pbuf_get_rx_buf(&pb, &rx_buf), -EFAULT);
+	ret = pbuf_read(&pb, read_buf, MPS);
+	zassert_equal(ret, MPS);
+	zassert_mem_equal(read_buf, write_buf, MPS);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
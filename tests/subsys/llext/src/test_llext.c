@@ -655,6 +655,40 @@ ZTEST(llext, test_fs_loader)
 }
 #endif
 
+#if defined(CONFIG_LLEXT_CACHE)
+/*
+ * Loading the same extension again should reuse its linked image from the
+ * cache, at the same address and still callable.
+ */
+ZTEST(llext, test_cache_reload)
+{
+	struct llext_buf_loader buf_loader =
+		LLEXT_BUF_LOADER(hello_world_ext, sizeof(hello_world_ext));
+	struct llext_loader *loader = &buf_loader.loader;
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	struct llext *ext = NULL;
+	void (*test_entry_fn)();
+	int res;
+
+	res = llext_load(loader, "hello_world", &ext, &ldr_parm);
+	zassert_ok(res, "load should succeed");
+
+	test_entry_fn = llext_find_sym(&ext->exp_tab, "test_entry");
+	zassert_not_null(test_entry_fn, "test_entry should be an exported symbol");
+
+	llext_unload(&ext);
+
+	res = llext_load(loader, "hello_world", &ext, &ldr_parm);
+	zassert_ok(res, "reload should succeed");
+
+	zassert_equal(llext_find_sym(&ext->exp_tab, "test_entry"), test_entry_fn,
+		      "reload should reuse the cached image");
+	test_entry_fn();
+
+	llext_unload(&ext);
+}
+#endif
+
 /*
  * Ensure that EXPORT_SYMBOL does indeed provide a symbol and a valid address
  * to it.
@@ -666,6 +700,29 @@ ZTEST(llext, test_printk_exported)
 	zassert_equal(printk_fn, printk, "printk should be an exported symbol");
 }
 
+/*
+ * Ensure that every built-in symbol is found at its own address, as lookups
+ * rely on the ordering of the export table.
+ */
+ZTEST(llext, test_find_builtin_syms)
+{
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+		const char *key = (const char *)sym->slid;
+#else
+		const char *key = sym->name;
+#endif
+
+		zassert_equal(llext_find_sym(NULL, key), sym->addr,
+			      "exported symbol %p not found", sym->addr);
+	}
+
+#ifndef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+	zassert_is_null(llext_find_sym(NULL, "not_an_exported_symbol"),
+			"unknown symbol should not be found");
+#endif
+}
+
 /*
  * The syscalls test above verifies that custom syscalls defined by extensions
  * are properly exported. Since `ext_syscalls.h` declares ext_syscall_fail, we
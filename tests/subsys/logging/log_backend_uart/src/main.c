@@ -63,6 +63,11 @@ ZTEST_F(log_backend_uart, test_log_backend_uart_multi_instance)
 
 	LOG_RAW(TEST_DATA);
 
+	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+		/* Let the logging thread process and flush the message */
+		k_msleep(100);
+	}
+
 	for (size_t i = 0; i < EMUL_UART_NUM; i++) {
 		memset(tx_content, 0, sizeof(tx_content));
 
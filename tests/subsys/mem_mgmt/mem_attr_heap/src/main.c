@@ -142,4 +142,81 @@ ZTEST(mem_attr_heap, test_mem_attr_heap)
 	zassert_true(((uintptr_t) block % 64 == 0), "");
 }
 
+#ifdef CONFIG_MEM_ATTR_HEAP_AFFINITY
+static const struct mem_attr_region_t *find_region(uintptr_t addr)
+{
+	const struct mem_attr_region_t *regions;
+	size_t num_regions = mem_attr_get_regions(&regions);
+
+	for (size_t idx = 0; idx < num_regions; idx++) {
+		if (regions[idx].dt_addr == addr) {
+			return &regions[idx];
+		}
+	}
+
+	return NULL;
+}
+
+ZTEST(mem_attr_heap, test_mem_attr_heap_affinity)
+{
+	const struct mem_attr_region_t *small, *big;
+	struct mem_attr_heap_stats before, after;
+	uint32_t other_cpus = ~BIT(arch_curr_cpu()->id);
+	void *block;
+	int ret;
+
+	ret = mem_attr_heap_pool_init();
+	zassert_true(ret == 0 || ret == -EALREADY, "Failed initialization");
+
+	small = find_region(ADDR_MEM_CACHE_SW);
+	big = find_region(ADDR_MEM_CACHE_BIG_SW);
+	zassert_not_null(small);
+	zassert_not_null(big);
+
+	/*
+	 * A region without a software attribute has no heap.
+	 */
+	zassert_equal(mem_attr_heap_get_stats(find_region(ADDR_MEM_CACHE), &before),
+		      -ENOENT, "Region without heap has statistics");
+
+	/*
+	 * With the first cacheable region local to other CPUs only, the
+	 * allocation lands in the second one, local to this CPU.
+	 */
+	zassert_equal(mem_attr_heap_set_cpu_affinity(small, other_cpus), 0);
+	zassert_equal(mem_attr_heap_get_stats(big, &before), 0);
+
+	block = mem_attr_heap_alloc(DT_MEM_SW_ALLOC_CACHE, 0x100);
+	zassert_not_null(block, "Failed to allocate memory");
+	zassert_equal(mem_attr_heap_get_region(block)->dt_addr, ADDR_MEM_CACHE_BIG_SW,
+		      "Memory allocated from a remote region");
+	mem_attr_heap_free(block);
+
+	zassert_equal(mem_attr_heap_get_stats(big, &after), 0);
+	zassert_equal(after.local_allocs, before.local_allocs + 1);
+	zassert_equal(after.remote_allocs, before.remote_allocs);
+
+	/*
+	 * An allocation too big for the local region falls back to a remote
+	 * one, and is accounted for as such.
+	 */
+	zassert_equal(mem_attr_heap_set_cpu_affinity(small, UINT32_MAX), 0);
+	zassert_equal(mem_attr_heap_set_cpu_affinity(big, other_cpus), 0);
+	zassert_equal(mem_attr_heap_get_stats(big, &before), 0);
+
+	block = mem_attr_heap_alloc(DT_MEM_SW_ALLOC_CACHE, 0x1500);
+	zassert_not_null(block, "Failed to allocate memory");
+	zassert_equal(mem_attr_heap_get_region(block)->dt_addr, ADDR_MEM_CACHE_BIG_SW,
+		      "Memory allocated from the wrong region");
+	mem_attr_heap_free(block);
+
+	zassert_equal(mem_attr_heap_get_stats(big, &after), 0);
+	zassert_equal(after.remote_allocs, before.remote_allocs + 1);
+	zassert_equal(mem_attr_heap_get_stats(small, &after), 0);
+	zassert_true(after.local_misses > 0, "Local region miss not accounted for");
+
+	zassert_equal(mem_attr_heap_set_cpu_affinity(big, UINT32_MAX), 0);
+}
+#endif /* CONFIG_MEM_ATTR_HEAP_AFFINITY */
+
 ZTEST_SUITE(mem_attr_heap, NULL, NULL, NULL, NULL, NULL);
@@ -630,6 +630,50 @@ ZTEST(modem_chat, test_script_run_dynamic_script_sync)
 	zassert_ok(modem_chat_run_script(&cmd, &stack_script), "Failed to run script");
 }
 
+ZTEST(modem_chat, test_script_response_match_modified_while_running)
+{
+	bool called;
+
+	struct modem_chat_match stack_response_match;
+	struct modem_chat_script_chat stack_script_chat;
+	struct modem_chat_script stack_script = {
+		.name = "Modified",
+		.script_chats = &stack_script_chat,
+		.script_chats_size = 1,
+		.abort_matches = NULL,
+		.abort_matches_size = 0,
+		.callback = on_script_result,
+		.timeout = 1,
+	};
+
+	modem_chat_match_init(&stack_response_match);
+	zassert_ok(modem_chat_match_set_match(&stack_response_match, "OK"));
+	modem_chat_script_chat_init(&stack_script_chat);
+	zassert_ok(modem_chat_script_chat_set_request(&stack_script_chat, "AT"));
+	zassert_ok(modem_chat_script_chat_set_response_matches(&stack_script_chat,
+							       &stack_response_match, 1));
+
+	zassert_ok(modem_chat_run_script_async(&cmd, &stack_script), "Failed to start script");
+	k_msleep(100);
+
+	modem_backend_mock_get(&mock, buffer, ARRAY_SIZE(buffer));
+	zassert_true(memcmp(buffer, "AT\r", sizeof("AT\r") - 1) == 0,
+		     "Request not sent as expected");
+
+	/*
+	 * Replace the active response match with a longer one, the received line
+	 * must be compared against the new match rather than skipped as too long
+	 */
+	zassert_ok(modem_chat_match_set_match(&stack_response_match, "OK LONGER"));
+	modem_backend_mock_put(&mock, "OK LONGER\r\n", sizeof("OK LONGER\r\n") - 1);
+	k_msleep(100);
+
+	called = atomic_test_bit(&callback_called, MODEM_CHAT_UTEST_ON_SCRIPT_CALLBACK_BIT);
+	zassert_true(called == true, "Script callback should have been called");
+	zassert_equal(script_result, MODEM_CHAT_SCRIPT_RESULT_SUCCESS,
+		      "Script should have stopped with success");
+}
+
 ZTEST(modem_chat, test_script_chat_timeout_cmd)
 {
 	int ret;
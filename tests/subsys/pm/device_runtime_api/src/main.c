@@ -288,6 +288,70 @@ ZTEST(device_runtime_api, test_api)
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+/**
+ * @brief Test resume ahead hints.
+ *
+ * Scenarios tested:
+ *
+ * - hint + wait until resumed + get, which triggers no further PM action
+ * - hint left unclaimed, device suspended again after the hold time
+ */
+ZTEST(device_runtime_api, test_resume_ahead)
+{
+	int ret;
+	size_t count;
+	enum pm_device_state state;
+
+	if (IS_ENABLED(CONFIG_TEST_PM_DEVICE_ISR_SAFE)) {
+		zassert_equal(pm_device_runtime_resume_ahead(test_dev, K_NO_WAIT), -ENOTSUP);
+		ztest_test_skip();
+	}
+
+	zassert_equal(pm_device_runtime_resume_ahead(test_dev, K_FOREVER), -EINVAL);
+
+	ret = pm_device_runtime_resume_ahead(test_dev, K_MSEC(20));
+	zassert_equal(ret, 0);
+
+	/* nothing happens before the hint is due */
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+
+	k_sleep(K_MSEC(30));
+
+	/* resumed and held, with a suspend pending */
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDING);
+	zassert_equal(pm_device_runtime_usage(test_dev), 0);
+
+	count = test_driver_pm_count(test_dev);
+
+	ret = pm_device_runtime_get(test_dev);
+	zassert_equal(ret, 0);
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+	zassert_equal(count, test_driver_pm_count(test_dev));
+
+	ret = pm_device_runtime_put(test_dev);
+	zassert_equal(ret, 0);
+
+	/* an unclaimed hint is released after the hold time */
+	ret = pm_device_runtime_resume_ahead(test_dev, K_NO_WAIT);
+	zassert_equal(ret, 0);
+
+	k_sleep(K_MSEC(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS / 2));
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDING);
+
+	k_sleep(K_MSEC(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS));
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
 DEVICE_DEFINE(pm_unsupported_device, "PM Unsupported", NULL, NULL, NULL, NULL,
 	      POST_KERNEL, 0, NULL);
 
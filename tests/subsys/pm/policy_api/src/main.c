@@ -23,7 +23,8 @@ void pm_state_exit_post_ops(enum pm_state state, uint8_t substate_id)
 	irq_unlock(0);
 }
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
+/* The predictive policy learns from the idle periods of the test itself */
+#if defined(CONFIG_PM_POLICY_DEFAULT) && !defined(CONFIG_PM_POLICY_DEFAULT_PREDICTIVE)
 /**
  * @brief Test the behavior of pm_policy_next_state() when
  * CONFIG_PM_POLICY_DEFAULT=y.
@@ -415,7 +416,61 @@ ZTEST(policy_api, test_pm_policy_state_constraints)
 {
 	ztest_test_skip();
 }
-#endif /* CONFIG_PM_POLICY_DEFAULT */
+#endif /* CONFIG_PM_POLICY_DEFAULT && !CONFIG_PM_POLICY_DEFAULT_PREDICTIVE */
+
+#ifdef CONFIG_PM_POLICY_DEFAULT_PREDICTIVE
+static void idle_periods(const struct pm_state_info *state, int32_t ticks, uint32_t idle_us)
+{
+	for (int i = 0; i < 64; i++) {
+		pm_policy_idle_update(0U, state, ticks, idle_us);
+	}
+}
+
+/**
+ * @brief Test that pm_policy_next_state() follows the idle durations seen
+ * when CONFIG_PM_POLICY_DEFAULT_PREDICTIVE=y.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	const struct pm_state_info *states;
+	const struct pm_state_info *next;
+
+	zassert_equal(pm_state_cpu_get_all(0U, &states), 2);
+
+	/* idle periods last as long as the timeout allows */
+	idle_periods(&states[1], K_TICKS_FOREVER, UINT32_MAX);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* interrupts end them after 200 ms, too early for suspend-to-ram */
+	idle_periods(&states[1], K_TICKS_FOREVER, 200000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* the timeout still bounds the prediction */
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(10999));
+	zassert_is_null(next);
+
+	/* then after 50 ms, too early for any state */
+	idle_periods(&states[0], K_TICKS_FOREVER, 50000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_is_null(next);
+
+	/* the timer firing exit-latency-us early is not mistaken for an interrupt */
+	idle_periods(&states[1], k_us_to_ticks_floor32(1150000), 1050000);
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1150000));
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	idle_periods(&states[1], K_TICKS_FOREVER, UINT32_MAX);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_DEFAULT_PREDICTIVE */
 
 #ifdef CONFIG_PM_POLICY_CUSTOM
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
@@ -0,0 +1,68 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/pmu.h>
+#include <zephyr/ztest.h>
+
+static volatile uint32_t sink;
+
+static void work(uint32_t loops)
+{
+	for (uint32_t i = 0; i < loops; i++) {
+		sink += i;
+	}
+}
+
+ZTEST(pmu, test_invalid)
+{
+	uint64_t value;
+
+	zassert_equal(pmu_counter_start(pmu_num_counters(), PMU_EVENT_CPU_CYCLES), -EINVAL);
+	zassert_equal(pmu_counter_start(0, PMU_EVENT_COUNT), -EINVAL);
+	zassert_equal(pmu_counter_stop(pmu_num_counters()), -EINVAL);
+	zassert_equal(pmu_counter_read(pmu_num_counters(), &value), -EINVAL);
+}
+
+ZTEST(pmu, test_count)
+{
+	uint64_t cycles, instructions, value;
+
+	zassert_true(pmu_num_counters() >= 2);
+	zassert_ok(pmu_counter_start(0, PMU_EVENT_CPU_CYCLES));
+	zassert_ok(pmu_counter_start(1, PMU_EVENT_INSTRUCTIONS));
+
+	work(1000);
+
+	zassert_ok(pmu_counter_stop(0));
+	zassert_ok(pmu_counter_stop(1));
+	zassert_ok(pmu_counter_read(0, &cycles));
+	zassert_ok(pmu_counter_read(1, &instructions));
+	zassert_true(cycles > 0);
+	zassert_true(instructions >= 1000, "%llu instructions", instructions);
+
+	/* Stopped counters keep their value */
+	work(1000);
+
+	zassert_ok(pmu_counter_read(0, &value));
+	zassert_equal(value, cycles);
+	zassert_ok(pmu_counter_read(1, &value));
+	zassert_equal(value, instructions);
+
+	/* Restarting resets the count */
+	zassert_ok(pmu_counter_start(1, PMU_EVENT_INSTRUCTIONS));
+	zassert_ok(pmu_counter_read(1, &value));
+	zassert_true(value < instructions);
+	zassert_ok(pmu_counter_stop(1));
+}
+
+ZTEST(pmu, test_event_name)
+{
+	zassert_str_equal(pmu_event_name(PMU_EVENT_CPU_CYCLES), "cycles");
+	zassert_str_equal(pmu_event_name(PMU_EVENT_RAW(0x12)), "raw");
+}
+
+ZTEST_SUITE(pmu, NULL, NULL, NULL, NULL, NULL);
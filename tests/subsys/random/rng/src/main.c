@@ -121,4 +121,43 @@ ZTEST(rng_common, test_rand32)
 #endif /* CONFIG_CSPRNG_ENABLED */
 }
 
+#if defined(CONFIG_CHACHA20_CSPRNG_GENERATOR)
+
+static uint32_t isr_buf[N_VALUES];
+static int isr_err;
+
+static void csrand_timer_fn(struct k_timer *timer)
+{
+	isr_err = sys_csrand_get(isr_buf, sizeof(isr_buf));
+}
+
+static K_TIMER_DEFINE(csrand_timer, csrand_timer_fn, NULL);
+
+ZTEST(rng_common, test_csrand_buffered)
+{
+	uint32_t buf[N_VALUES];
+	uint32_t prev[N_VALUES];
+
+	/* cross refills and several reseed intervals */
+	zassert_ok(sys_csrand_get(prev, sizeof(prev)));
+	for (size_t i = 0; i < 4 * CONFIG_CHACHA20_CSPRNG_RESEED_INTERVAL / sizeof(buf); i++) {
+		zassert_ok(sys_csrand_get(buf, sizeof(buf)));
+		zassert_true(memcmp(buf, prev, sizeof(buf)) != 0, "output repeated");
+		memcpy(prev, buf, sizeof(buf));
+		/* let the background reseed run */
+		if ((i % 32) == 0) {
+			k_yield();
+		}
+	}
+
+	/* reads are allowed from ISRs */
+	isr_err = -EINVAL;
+	k_timer_start(&csrand_timer, K_MSEC(1), K_NO_WAIT);
+	k_timer_status_sync(&csrand_timer);
+	zassert_ok(isr_err, "sys_csrand_get failed in ISR");
+	zassert_true(memcmp(isr_buf, prev, sizeof(isr_buf)) != 0, "output repeated in ISR");
+}
+
+#endif /* CONFIG_CHACHA20_CSPRNG_GENERATOR */
+
 ZTEST_SUITE(rng_common, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,104 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/retention/warmboot.h>
+
+static const uint8_t lease[] = {192, 0, 2, 1, 0x10, 0x0e, 0x00, 0x00};
+static uint8_t restored_lease[sizeof(lease)];
+static size_t restored_lease_size;
+
+static uint32_t counter;
+static unsigned int counter_restores;
+
+static ssize_t lease_save(uint8_t *buf, size_t size)
+{
+	if (size < sizeof(lease)) {
+		return -ENOMEM;
+	}
+
+	memcpy(buf, lease, sizeof(lease));
+
+	return sizeof(lease);
+}
+
+static void lease_restore(const uint8_t *buf, size_t size)
+{
+	restored_lease_size = MIN(size, sizeof(restored_lease));
+	memcpy(restored_lease, buf, restored_lease_size);
+}
+
+static ssize_t counter_save(uint8_t *buf, size_t size)
+{
+	memcpy(buf, &counter, sizeof(counter));
+
+	return sizeof(counter);
+}
+
+static void counter_restore(const uint8_t *buf, size_t size)
+{
+	zassert_equal(size, sizeof(counter));
+	memcpy(&counter, buf, sizeof(counter));
+	counter_restores++;
+}
+
+/* Has nothing to save */
+static ssize_t empty_save(uint8_t *buf, size_t size)
+{
+	return -ENODATA;
+}
+
+static void empty_restore(const uint8_t *buf, size_t size)
+{
+	ztest_test_fail();
+}
+
+WARMBOOT_HANDLER_DEFINE(test_lease, 1, lease_save, lease_restore);
+WARMBOOT_HANDLER_DEFINE(test_counter, 3, counter_save, counter_restore);
+WARMBOOT_HANDLER_DEFINE(test_empty, 1, empty_save, empty_restore);
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(restored_lease, 0, sizeof(restored_lease));
+	restored_lease_size = 0;
+	counter_restores = 0;
+}
+
+ZTEST(retention_warmboot, test_cold_boot)
+{
+	zassert_false(warmboot_is_warm(), "cold boot reported as warm");
+	zassert_equal(warmboot_restore(), 0, "snapshots restored on a cold boot");
+}
+
+ZTEST(retention_warmboot, test_save_restore)
+{
+	counter = 0x12345678;
+
+	zassert_equal(warmboot_save(), 2, "unexpected number of snapshots saved");
+
+	counter = 0;
+	zassert_equal(warmboot_restore(), 2, "unexpected number of snapshots restored");
+
+	zassert_true(warmboot_is_warm());
+	zassert_equal(restored_lease_size, sizeof(lease));
+	zassert_mem_equal(restored_lease, lease, sizeof(lease));
+	zassert_equal(counter, 0x12345678, "counter not restored");
+}
+
+ZTEST(retention_warmboot, test_restore_once)
+{
+	zassert_equal(warmboot_save(), 2);
+	zassert_equal(warmboot_restore(), 2);
+
+	/* The retention area is cleared once restored */
+	zassert_equal(warmboot_restore(), 0, "snapshots restored twice");
+	zassert_equal(counter_restores, 1);
+}
+
+ZTEST_SUITE(retention_warmboot, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,143 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/counter.h>
+
+#define PERIOD_US 1000
+#define PERIOD_TICKS (PERIOD_US * CONFIG_COUNTER_NATIVE_SIM_FREQUENCY / USEC_PER_SEC)
+#define TOLERANCE_TICKS (PERIOD_TICKS / 10)
+#define NUM_PERIODS 5
+
+static const struct device *const counter_dev = DEVICE_DT_GET(DT_NODELABEL(counter0));
+
+RTIO_COUNTER_IODEV_DEFINE(timer_iodev, counter_dev, 0, PERIOD_US);
+
+RTIO_DEFINE(r, 4, 4);
+
+static uint32_t stamps[NUM_PERIODS];
+static bool in_isr[NUM_PERIODS];
+
+static void stamp(struct rtio *r, const struct rtio_sqe *sqe, int res, void *arg0)
+{
+	uintptr_t i = (uintptr_t)arg0;
+
+	ARG_UNUSED(r);
+	ARG_UNUSED(sqe);
+	ARG_UNUSED(res);
+
+	in_isr[i] = k_is_in_isr();
+	(void)counter_get_value(counter_dev, &stamps[i]);
+}
+
+/**
+ * @brief Test a transfer chained after the counter iodev
+ *
+ * @details Each iteration is submitted with a varying delay within the
+ * period, they must still run on consecutive boundaries, from the alarm
+ * interrupt.
+ */
+ZTEST(rtio_counter, test_chain_cadence)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	for (uintptr_t i = 0; i < NUM_PERIODS; i++) {
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_nop(sqe, &timer_iodev, NULL);
+		sqe->flags |= RTIO_SQE_CHAINED;
+
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_callback(sqe, stamp, (void *)i, NULL);
+
+		zassert_ok(rtio_submit(&r, 2));
+
+		for (int j = 0; j < 2; j++) {
+			cqe = rtio_cqe_consume_block(&r);
+			zassert_ok(cqe->result);
+			rtio_cqe_release(&r, cqe);
+		}
+
+		k_busy_wait(i * PERIOD_US / (2 * NUM_PERIODS));
+	}
+
+	for (int i = 0; i < NUM_PERIODS; i++) {
+		zassert_true(in_isr[i], "not run from the alarm interrupt");
+	}
+
+	for (int i = 1; i < NUM_PERIODS; i++) {
+		uint32_t delta = stamps[i] - stamps[i - 1];
+
+		zassert_within(delta, PERIOD_TICKS, TOLERANCE_TICKS,
+			       "period %d lasted %u ticks", i, delta);
+	}
+}
+
+/**
+ * @brief Test a multishot submission to the counter iodev
+ */
+ZTEST(rtio_counter, test_multishot)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_nop(sqe, &timer_iodev, &timer_iodev);
+	sqe->flags |= RTIO_SQE_MULTISHOT;
+
+	zassert_ok(rtio_submit(&r, 0));
+
+	for (int i = 0; i < NUM_PERIODS; i++) {
+		cqe = rtio_cqe_consume_block(&r);
+		zassert_ok(cqe->result);
+		zassert_equal_ptr(cqe->userdata, &timer_iodev);
+		rtio_cqe_release(&r, cqe);
+	}
+
+	zassert_ok(rtio_sqe_cancel(sqe));
+}
+
+/**
+ * @brief Test unsupported operations
+ */
+ZTEST(rtio_counter, test_unsupported)
+{
+	static uint8_t buf[4];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &timer_iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+
+	zassert_ok(rtio_submit(&r, 1));
+
+	cqe = rtio_cqe_consume_block(&r);
+	zassert_equal(cqe->result, -ENOTSUP);
+	rtio_cqe_release(&r, cqe);
+}
+
+static void after(void *fixture)
+{
+	struct rtio_cqe *cqe;
+
+	ARG_UNUSED(fixture);
+
+	/* Let a cancelled multishot submission expire */
+	k_busy_wait(2 * PERIOD_US);
+
+	while ((cqe = rtio_cqe_consume(&r)) != NULL) {
+		rtio_cqe_release(&r, cqe);
+	}
+}
+
+ZTEST_SUITE(rtio_counter, NULL, NULL, NULL, after, NULL);
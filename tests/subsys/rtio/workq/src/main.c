@@ -161,6 +161,55 @@ ZTEST(rtio_work, test_work_supports_working_same_prio_items_on_separate_threads)
 	rtio_cqe_release(&r_test_2, cqe);
 }
 
+ZTEST(rtio_work, test_work_serializes_same_iodev_items)
+{
+	struct rtio_sqe *sqe_a;
+	struct rtio_sqe *sqe_b;
+	struct rtio_sqe *sqe_c;
+	struct rtio_cqe *cqe;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_RTIO_WORKQ_PER_IODEV);
+
+	sqe_a = rtio_sqe_acquire(&r_test);
+	rtio_sqe_prep_nop(sqe_a, &dummy_iodev, &work_handler_sem_1);
+	sqe_a->prio = RTIO_PRIO_NORM;
+
+	sqe_b = rtio_sqe_acquire(&r_test_2);
+	rtio_sqe_prep_nop(sqe_b, &dummy_iodev, &work_handler_sem_2);
+	sqe_b->prio = RTIO_PRIO_NORM;
+
+	sqe_c = rtio_sqe_acquire(&r_test_3);
+	rtio_sqe_prep_nop(sqe_c, &dummy_iodev_2, &work_handler_sem_3);
+	sqe_c->prio = RTIO_PRIO_NORM;
+
+	zassert_ok(rtio_submit(&r_test, 0));
+	zassert_ok(rtio_submit(&r_test_2, 0));
+	zassert_ok(rtio_submit(&r_test_3, 0));
+
+	/** The second item of dummy_iodev waits, the one of dummy_iodev_2 does not */
+	zassert_equal(2, work_handler_called);
+	zassert_equal(3, rtio_work_req_used_count_get());
+
+	k_sem_give(&work_handler_sem_3);
+	zassert_equal(2, work_handler_called);
+	zassert_equal(2, rtio_work_req_used_count_get());
+
+	k_sem_give(&work_handler_sem_1);
+	zassert_equal(3, work_handler_called);
+	zassert_equal(1, rtio_work_req_used_count_get());
+
+	k_sem_give(&work_handler_sem_2);
+	zassert_equal(0, rtio_work_req_used_count_get());
+
+	/** Clean-up */
+	cqe = rtio_cqe_consume_block(&r_test);
+	rtio_cqe_release(&r_test, cqe);
+	cqe = rtio_cqe_consume_block(&r_test_2);
+	rtio_cqe_release(&r_test_2, cqe);
+	cqe = rtio_cqe_consume_block(&r_test_3);
+	rtio_cqe_release(&r_test_3, cqe);
+}
+
 ZTEST(rtio_work, test_work_supports_preempting_on_higher_prio_submissions)
 {
 	struct rtio_sqe *sqe_a;
@@ -657,3 +657,50 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+SETTINGS_STATIC_HANDLER_DEFINE(lookup, "lookup", NULL, NULL, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(lookup_a_b, "lookup/a/b", NULL, NULL, NULL, NULL);
+
+static struct settings_handler lookup_a_settings = {
+	.name = "lookup/a",
+};
+
+static void check_lookup(const char *name, const struct settings_handler_static *handler,
+			 const char *next)
+{
+	struct settings_handler_static *ch;
+	const char *name_next;
+
+	ch = settings_parse_and_lookup(name, &name_next);
+	zassert_equal_ptr(ch, handler, "wrong handler for %s", name);
+	zassert_equal_ptr(name_next, next, "wrong next for %s", name);
+}
+
+ZTEST(settings_functional, test_handler_lookup)
+{
+	const char test1[] = "lookup/value";
+	const char test2[] = "lookup/a/b/c";
+	const char test3[] = "lookup/a/b=";
+	const char test4[] = "lookup/a/c";
+	int rc;
+
+	rc = settings_subsys_init();
+	zassert_true(rc == 0, "subsys init failed");
+
+	/* the handler with the longest matching name is found */
+	check_lookup(test1, &settings_handler_lookup, test1 + 7);
+	check_lookup(test2, &settings_handler_lookup_a_b, test2 + 11);
+	check_lookup(test3, &settings_handler_lookup_a_b, NULL);
+	check_lookup("lookup", &settings_handler_lookup, NULL);
+	check_lookup("lookupa/b", NULL, NULL);
+	check_lookup("look", NULL, NULL);
+
+	/* dynamic handlers are matched along with the static ones */
+	rc = settings_register(&lookup_a_settings);
+	zassert_true(rc == 0, "register of lookup/a settings failed");
+
+	check_lookup(test2, &settings_handler_lookup_a_b, test2 + 11);
+	check_lookup(test4, (struct settings_handler_static *)&lookup_a_settings, test4 + 9);
+
+	settings_deregister(&lookup_a_settings);
+}
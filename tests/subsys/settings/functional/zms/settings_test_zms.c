@@ -22,4 +22,64 @@ ZTEST(settings_functional, test_setting_storage_get)
 	rc = zms_write((struct zms_fs *)storage, 512, &data, sizeof(data));
 	zassert_true(rc >= 0, "Can't write ZMS entry (err=%d).", rc);
 }
+
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+#define FIXED_VAL_ID 0x100
+
+SETTINGS_ZMS_FIXED_ID_DEFINE(fixed_val, "fixed/val", FIXED_VAL_ID);
+
+static int fixed_val_load(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			  void *param)
+{
+	uint32_t *val = param;
+
+	zassert_is_null(key, "Unexpected key %s", key);
+	zassert_equal(len, sizeof(*val), "Unexpected length %zu", len);
+
+	return (read_cb(cb_arg, val, sizeof(*val)) == sizeof(*val)) ? 0 : -EIO;
+}
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+
+ZTEST(settings_functional, test_setting_fixed_id)
+{
+#ifdef CONFIG_SETTINGS_ZMS_FIXED_IDS
+	int rc;
+	void *storage;
+	uint32_t val = 0x12345678u;
+	uint32_t rd_val = 0;
+
+	rc = settings_save_one("fixed/val", &val, sizeof(val));
+	zassert_equal(0, rc, "Can't save settings item (err=%d)", rc);
+
+	/* The value is stored in the fixed ID entry */
+	rc = settings_storage_get(&storage);
+	zassert_equal(0, rc, "Can't fetch storage reference (err=%d)", rc);
+	rc = zms_read((struct zms_fs *)storage, FIXED_VAL_ID, &rd_val, sizeof(rd_val));
+	zassert_equal(sizeof(rd_val), rc, "Can't read ZMS entry (err=%d)", rc);
+	zassert_equal(val, rd_val, "Wrong value in ZMS entry");
+
+	rd_val = 0;
+	rc = settings_load_one("fixed/val", &rd_val, sizeof(rd_val));
+	zassert_equal(sizeof(rd_val), rc, "Can't load settings item (err=%d)", rc);
+	zassert_equal(val, rd_val, "Wrong loaded value");
+
+	rc = settings_get_val_len("fixed/val");
+	zassert_equal(sizeof(val), rc, "Wrong value length (%d)", rc);
+
+	rd_val = 0;
+	rc = settings_load_subtree_direct("fixed/val", fixed_val_load, &rd_val);
+	zassert_equal(0, rc, "Can't load subtree (err=%d)", rc);
+	zassert_equal(val, rd_val, "Wrong value loaded from subtree");
+
+	rc = settings_delete("fixed/val");
+	zassert_equal(0, rc, "Can't delete settings item (err=%d)", rc);
+	rc = settings_get_val_len("fixed/val");
+	zassert_equal(0, rc, "Deleted item has length %d", rc);
+	rc = settings_load_one("fixed/val", &rd_val, sizeof(rd_val));
+	zassert_equal(0, rc, "Deleted item loaded (%d)", rc);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SETTINGS_ZMS_FIXED_IDS */
+}
+
 ZTEST_SUITE(settings_functional, NULL, NULL, NULL, NULL, NULL);
@@ -38,6 +38,7 @@ static int cb_ret;
 static const char progress_key[] = "sf-test/progress";
 
 static uint8_t generic_buf[BUF_LEN];
+static uint8_t multi_page_buf[MAX_PAGE_SIZE * 2];
 static uint8_t read_buf[TESTBUF_SIZE];
 const static uint8_t write_buf[TESTBUF_SIZE] = {[0 ... TESTBUF_SIZE - 1] = 0xaa};
 static uint8_t written_pattern[TESTBUF_SIZE] = {[0 ... TESTBUF_SIZE - 1] = 0xaa};
@@ -96,6 +97,15 @@ static void init_target(void)
 {
 	int rc;
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* Tests leave streams unfinished, wait for their erase before reusing the context */
+	if (ctx.fdev != NULL) {
+		struct k_work_sync sync;
+
+		(void)k_work_flush(&ctx.erase_ahead_work, &sync);
+	}
+#endif
+
 	/* Ensure that target is clean */
 	memset(&ctx, 0, sizeof(ctx));
 	memset(generic_buf, 0, BUF_LEN);
@@ -312,19 +322,48 @@ ZTEST(lib_stream_flash, test_stream_flash_bytes_buffered)
 	zassert_equal(buffered, 128, "expected remaining buffered bytes after auto-flush");
 }
 
-ZTEST(lib_stream_flash, test_stream_flash_buf_size_greater_than_page_size)
+ZTEST(lib_stream_flash, test_stream_flash_buf_size_greater_than_area)
 {
 	int rc;
 
+	init_target();
+
 	/* To illustrate that other params does not trigger error */
-	rc = stream_flash_init(&ctx, fdev, generic_buf, 0x10, 0, FLASH_AVAILABLE, NULL);
+	rc = stream_flash_init(&ctx, fdev, generic_buf, 0x10, 0, 0x8000, NULL);
 	zassert_equal(rc, 0, "expected success");
 
 	/* Only change buf_len param */
-	rc = stream_flash_init(&ctx, fdev, generic_buf, 0x10000, 0, FLASH_AVAILABLE, NULL);
+	rc = stream_flash_init(&ctx, fdev, generic_buf, 0x10000, 0, 0x8000, NULL);
 	zassert_true(rc < 0, "expected failure");
 }
 
+ZTEST(lib_stream_flash, test_stream_flash_buffered_write_multi_page_buf)
+{
+	int rc;
+
+	zassume_true(page_size * 2 <= sizeof(multi_page_buf), "page size is too big");
+
+	init_target();
+
+	/* Buffer spanning two pages */
+	rc = stream_flash_init(&ctx, fdev, multi_page_buf, page_size * 2, FLASH_BASE,
+			       FLASH_AVAILABLE, NULL);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size * 3, false);
+	zassert_equal(rc, 0, "expected success");
+
+	/* First buffer should be written, the rest is buffered */
+	VERIFY_WRITTEN(0, page_size * 2);
+	zassert_equal(stream_flash_bytes_buffered(&ctx), page_size, "expected one page buffered");
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+
+	VERIFY_WRITTEN(0, page_size * 3);
+	VERIFY_ERASED(page_size * 3, page_size);
+}
+
 static int bad_read(const struct device *dev, off_t off, void *data, size_t len)
 {
 	return -EINVAL;
@@ -0,0 +1,117 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define MSG_COUNT    5
+#define SLOW_PRIO    7
+#define FAST_PRIO    3
+
+struct seq_msg {
+	uint32_t seq;
+};
+
+ZBUS_CHAN_DEFINE(seq_chan, struct seq_msg, NULL, NULL, ZBUS_OBSERVERS(slow_lis, fast_lis),
+		 ZBUS_MSG_INIT(0));
+
+static K_SEM_DEFINE(release_sem, 0, MSG_COUNT);
+static K_SEM_DEFINE(slow_done_sem, 0, MSG_COUNT);
+static K_SEM_DEFINE(fast_done_sem, 0, MSG_COUNT);
+
+static uint32_t slow_seq[MSG_COUNT];
+static uint32_t fast_seq[MSG_COUNT];
+static size_t slow_count;
+static size_t fast_count;
+static int slow_prio;
+static int fast_prio;
+static k_tid_t slow_thread;
+
+static void slow_cb(const struct zbus_channel *chan, const void *msg)
+{
+	const struct seq_msg *m = msg;
+
+	zassert_equal(chan, &seq_chan);
+
+	slow_prio = k_thread_priority_get(k_current_get());
+	slow_thread = k_current_get();
+
+	/* Blocks the listener, not the publisher */
+	k_sem_take(&release_sem, K_FOREVER);
+
+	slow_seq[slow_count++] = m->seq;
+	k_sem_give(&slow_done_sem);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(slow_lis, slow_cb, SLOW_PRIO);
+
+static void fast_cb(const struct zbus_channel *chan, const void *msg)
+{
+	const struct seq_msg *m = msg;
+
+	fast_prio = k_thread_priority_get(k_current_get());
+
+	fast_seq[fast_count++] = m->seq;
+	k_sem_give(&fast_done_sem);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(fast_lis, fast_cb, FAST_PRIO);
+
+ZTEST(async_listener, test_publish_does_not_wait)
+{
+	struct seq_msg msg;
+
+	for (uint32_t i = 0; i < MSG_COUNT; i++) {
+		msg.seq = i;
+		zassert_ok(zbus_chan_pub(&seq_chan, &msg, K_MSEC(100)));
+	}
+
+	/* The fast listener gets every message while the slow one is blocked */
+	for (uint32_t i = 0; i < MSG_COUNT; i++) {
+		zassert_ok(k_sem_take(&fast_done_sem, K_MSEC(500)));
+		zassert_equal(fast_seq[i], i);
+	}
+
+	zassert_equal(slow_count, 0);
+	zassert_not_equal(slow_thread, k_current_get());
+
+	for (uint32_t i = 0; i < MSG_COUNT; i++) {
+		k_sem_give(&release_sem);
+		zassert_ok(k_sem_take(&slow_done_sem, K_MSEC(500)));
+		zassert_equal(slow_seq[i], i, "messages out of order");
+	}
+
+	zassert_equal(slow_prio, SLOW_PRIO);
+	zassert_equal(fast_prio, FAST_PRIO);
+}
+
+ZTEST(async_listener, test_disabled)
+{
+	struct seq_msg msg = {.seq = 42};
+
+	zassert_ok(zbus_obs_set_enable(&slow_lis, false));
+	zassert_ok(zbus_chan_pub(&seq_chan, &msg, K_MSEC(100)));
+	zassert_ok(k_sem_take(&fast_done_sem, K_MSEC(500)));
+	zassert_equal(fast_seq[0], 42);
+
+	/* Nothing was queued for the disabled listener */
+	k_sem_give(&release_sem);
+	zassert_equal(k_sem_take(&slow_done_sem, K_MSEC(100)), -EAGAIN);
+	k_sem_reset(&release_sem);
+
+	zassert_ok(zbus_obs_set_enable(&slow_lis, true));
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	slow_count = 0;
+	fast_count = 0;
+	slow_thread = NULL;
+}
+
+ZTEST_SUITE(async_listener, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,106 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net_buf.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define FRAME_SIZE 128
+
+static atomic_t freed;
+
+static void frame_destroy(struct net_buf *buf)
+{
+	atomic_inc(&freed);
+	net_buf_destroy(buf);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(frame_pool, 3, FRAME_SIZE, 0, frame_destroy);
+
+static const struct net_buf *listened;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	listened = zbus_chan_ref_msg(chan);
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub);
+ZBUS_SUBSCRIBER_DEFINE(sub, 4);
+
+static bool frame_validator(const void *msg, size_t msg_size)
+{
+	ARG_UNUSED(msg);
+
+	return msg_size == FRAME_SIZE;
+}
+
+ZBUS_CHAN_REF_DEFINE(frame_chan, frame_validator, NULL, ZBUS_OBSERVERS(lis, msub, sub));
+
+static struct net_buf *frame_alloc(uint8_t fill)
+{
+	struct net_buf *buf = net_buf_alloc(&frame_pool, K_NO_WAIT);
+
+	zassert_not_null(buf);
+	memset(net_buf_add(buf, FRAME_SIZE), fill, FRAME_SIZE);
+
+	return buf;
+}
+
+ZTEST(ref_channel, test_shared_payload)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *first = frame_alloc(0xaa);
+	struct net_buf *second;
+	struct net_buf *rx;
+	atomic_val_t freed_before = atomic_get(&freed);
+
+	zassert_equal(zbus_chan_ref_get(&frame_chan, &rx, K_NO_WAIT), -ENODATA);
+
+	zassert_ok(zbus_chan_pub_ref(&frame_chan, first, K_NO_WAIT));
+	zassert_equal_ptr(listened, first);
+	/* Held by the channel and the message subscriber */
+	zassert_equal(first->ref, 2);
+
+	zassert_ok(zbus_sub_wait_msg(&msub, &chan, &rx, K_NO_WAIT));
+	zassert_equal_ptr(chan, &frame_chan);
+	zassert_equal_ptr(rx, first, "payload was copied");
+	zassert_equal(rx->data[0], 0xaa);
+	net_buf_unref(rx);
+
+	zassert_ok(zbus_sub_wait(&sub, &chan, K_NO_WAIT));
+	zassert_ok(zbus_chan_ref_get(&frame_chan, &rx, K_NO_WAIT));
+	zassert_equal_ptr(rx, first);
+
+	/* The first payload stays valid for the reader still holding it */
+	second = frame_alloc(0x55);
+	zassert_ok(zbus_chan_pub_ref(&frame_chan, second, K_NO_WAIT));
+	zassert_equal(atomic_get(&freed), freed_before);
+	zassert_equal(rx->data[0], 0xaa);
+
+	net_buf_unref(rx);
+	zassert_equal(atomic_get(&freed), freed_before + 1, "first payload not released");
+
+	zassert_ok(zbus_sub_wait_msg(&msub, &chan, &rx, K_NO_WAIT));
+	zassert_equal_ptr(rx, second);
+	net_buf_unref(rx);
+	zassert_ok(zbus_sub_wait(&sub, &chan, K_NO_WAIT));
+
+	zassert_equal(second->ref, 1);
+}
+
+ZTEST(ref_channel, test_invalid_payload)
+{
+	struct net_buf *buf = net_buf_alloc(&frame_pool, K_NO_WAIT);
+
+	zassert_not_null(buf);
+	zassert_equal(zbus_chan_pub_ref(&frame_chan, buf, K_NO_WAIT), -ENOMSG);
+	zassert_equal(buf->ref, 1, "reference taken by a failed publish");
+
+	net_buf_unref(buf);
+}
+
+ZTEST_SUITE(ref_channel, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,80 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/irq_offload.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct state_msg {
+	uint32_t a;
+	uint32_t b;
+};
+
+ZBUS_CHAN_SEQLOCK_DEFINE(state_chan, struct state_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+			 ZBUS_MSG_INIT(.a = 1, .b = 1));
+
+ZBUS_CHAN_DEFINE(plain_chan, struct state_msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+static struct state_msg isr_msg;
+static int isr_err;
+
+static void isr_read(const void *param)
+{
+	isr_err = zbus_chan_read(param, &isr_msg, K_NO_WAIT);
+}
+
+ZTEST(seqlock, test_read_published)
+{
+	struct state_msg msg;
+	struct state_msg pub = {.a = 42, .b = 42};
+
+	zassert_ok(zbus_chan_read(&state_chan, &msg, K_NO_WAIT));
+	zassert_equal(msg.a, 1);
+	zassert_equal(msg.b, 1);
+
+	for (uint32_t i = 0; i < 5; i++) {
+		pub.a = pub.b = i;
+		zassert_ok(zbus_chan_pub(&state_chan, &pub, K_NO_WAIT));
+		zassert_ok(zbus_chan_read(&state_chan, &msg, K_NO_WAIT));
+		zassert_equal(msg.a, i);
+		zassert_equal(msg.b, i);
+	}
+
+	irq_offload(isr_read, &state_chan);
+	zassert_ok(isr_err);
+	zassert_equal(isr_msg.a, 4);
+}
+
+ZTEST(seqlock, test_read_while_claimed)
+{
+	struct state_msg msg;
+	struct state_msg *claimed;
+
+	zassert_ok(zbus_chan_claim(&plain_chan, K_NO_WAIT));
+	zassert_equal(zbus_chan_read(&plain_chan, &msg, K_NO_WAIT), -EBUSY);
+	zassert_ok(zbus_chan_finish(&plain_chan));
+
+	/* Readers see the message as of the last publish, or claim */
+	zassert_ok(zbus_chan_claim(&state_chan, K_NO_WAIT));
+	claimed = zbus_chan_msg(&state_chan);
+	claimed->a = claimed->b = 100;
+
+	zassert_ok(zbus_chan_read(&state_chan, &msg, K_FOREVER));
+	zassert_not_equal(msg.a, 100);
+
+	irq_offload(isr_read, &state_chan);
+	zassert_ok(isr_err);
+	zassert_not_equal(isr_msg.a, 100);
+
+	zassert_ok(zbus_chan_finish(&state_chan));
+
+	zassert_ok(zbus_chan_read(&state_chan, &msg, K_NO_WAIT));
+	zassert_equal(msg.a, 100);
+	zassert_equal(msg.b, 100);
+}
+
+ZTEST_SUITE(seqlock, NULL, NULL, NULL, NULL, NULL);